@@ -29,6 +29,19 @@ $did = (int) $input['DID'];
 $rssi = isset($input['RSSI']) ? (int) $input['RSSI'] : null;
 $messageCode = (int) $input['message_code'];
 
+// Optional latency stamps from the gateway (milliseconds, see API/Read/latency.php)
+$latency = isset($input['latency']) && is_array($input['latency']) ? $input['latency'] : [];
+$latencyValue = function ($key) use ($latency) {
+    return isset($latency[$key]) && is_numeric($latency[$key]) ? max(0, (int) $latency[$key]) : null;
+};
+$txUiMs = $latencyValue('tx_ui_ms');
+$airMs = $latencyValue('air_ms');
+$gwMs = $latencyValue('gw_ms');
+
+// Alerts from this device the gateway's rate limit kept out since its previous
+// uplink (a stuck key or faulty trigger): stored on this row, not notified
+$suppressed = isset($input['suppressed']) && is_numeric($input['suppressed']) ? max(0, (int) $input['suppressed']) : 0;
+
 try {
     $db = getDB();
 
@@ -36,24 +49,102 @@ try {
     $deviceStmt = $db->prepare("SELECT DID FROM devices WHERE DID = :did");
     $deviceStmt->execute(['did' => $did]);
 
+    // A handheld that is not registered yet is added by the gateway when it
+    // asks (auto_register), so its first alert is stored, not turned away.
+    // The location is unknown (LID 0) until an operator sets it.
+    $autoRegistered = false;
     if (!$deviceStmt->fetch()) {
-        sendResponse(false, null, 'Device not found', 404);
+        if (empty($input['auto_register']) || $did <= 0) {
+            sendResponse(false, null, 'Device not found', 404);
+        }
+        $registerStmt = $db->prepare("
+            INSERT IGNORE INTO devices (DID, device_name, LID, status, last_ping)
+            VALUES (:did, :device_name, 0, 'active', NOW())
+        ");
+        $registerStmt->execute([
+            'did' => $did,
+            'device_name' => sprintf('Auto-registered TX%03d', $did)
+        ]);
+        $autoRegistered = true;
+    }
+
+    // A count the gateway could not send with an alert (the device flooded,
+    // then went quiet): added to the device's last row, nothing notified
+    if (!empty($input['suppressed_only'])) {
+        if ($suppressed === 0) {
+            sendResponse(false, null, 'suppressed_only needs a suppressed count', 400);
+        }
+        $countStmt = $db->prepare("
+            UPDATE messages SET suppressed = suppressed + :suppressed
+            WHERE DID = :did
+            ORDER BY MID DESC
+            LIMIT 1
+        ");
+        $countStmt->execute(['suppressed' => $suppressed, 'did' => $did]);
+        if ($countStmt->rowCount() === 0) {
+            sendResponse(false, null, 'No message from this device to add the count to', 409);
+        }
+        sendResponse(true, ['DID' => $did, 'suppressed' => $suppressed], 'Suppressed count recorded', 200);
     }
 
     // Insert new message
     $stmt = $db->prepare("
-        INSERT INTO messages (DID, RSSI, message_code, timestamp) 
-        VALUES (:did, :rssi, :message_code, NOW())
+        INSERT INTO messages (DID, RSSI, message_code, timestamp, tx_ui_ms, air_ms, gw_ms, suppressed) 
+        VALUES (:did, :rssi, :message_code, NOW(), :tx_ui_ms, :air_ms, :gw_ms, :suppressed)
     ");
 
     $stmt->execute([
         'did' => $did,
         'rssi' => $rssi,
-        'message_code' => $messageCode
+        'message_code' => $messageCode,
+        'tx_ui_ms' => $txUiMs,
+        'air_ms' => $airMs,
+        'gw_ms' => $gwMs,
+        'suppressed' => $suppressed
     ]);
 
     $messageId = $db->lastInsertId();
 
+    // The gateway only learns an uplink's round trip after the response,
+    // so it reports it with the next message. Only an earlier row of the
+    // same device can be stamped, so a stale or wrong MID changes nothing.
+    if (isset($input['prev_uplink']['MID'], $input['prev_uplink']['uplink_ms'])) {
+        $prevStmt = $db->prepare("
+            UPDATE messages SET uplink_ms = :uplink_ms
+            WHERE MID = :mid AND MID < :current_mid AND DID = :did AND uplink_ms IS NULL
+        ");
+        $prevStmt->execute([
+            'uplink_ms' => max(0, (int) $input['prev_uplink']['uplink_ms']),
+            'mid' => (int) $input['prev_uplink']['MID'],
+            'current_mid' => (int) $messageId,
+            'did' => $did
+        ]);
+    }
+
+    // Link quality of this device as the gateway hears it (averages and
+    // counters since the gateway booted); API/Read/links.php reports it
+    if (isset($input['link']) && is_array($input['link'])) {
+        $link = $input['link'];
+        $linkNumber = function ($key) use ($link) {
+            return isset($link[$key]) && is_numeric($link[$key]) ? $link[$key] : null;
+        };
+        $linkStmt = $db->prepare("
+            INSERT INTO device_links (DID, rssi_avg, snr_avg, packets, alerts, lost)
+            VALUES (:did, :rssi_avg, :snr_avg, :packets, :alerts, :lost)
+            ON DUPLICATE KEY UPDATE
+                rssi_avg = VALUES(rssi_avg), snr_avg = VALUES(snr_avg),
+                packets = VALUES(packets), alerts = VALUES(alerts), lost = VALUES(lost)
+        ");
+        $linkStmt->execute([
+            'did' => $did,
+            'rssi_avg' => $linkNumber('rssi'),
+            'snr_avg' => $linkNumber('snr'),
+            'packets' => max(0, (int) $linkNumber('packets')),
+            'alerts' => max(0, (int) $linkNumber('alerts')),
+            'lost' => max(0, (int) $linkNumber('lost'))
+        ]);
+    }
+
     // Update device last_ping
     $updateDeviceStmt = $db->prepare("UPDATE devices SET last_ping = NOW() WHERE DID = :did");
     $updateDeviceStmt->execute(['did' => $did]);
@@ -72,6 +163,7 @@ try {
     ");
     $fetchStmt->execute(['mid' => $messageId]);
     $message = $fetchStmt->fetch();
+    $message['auto_registered'] = $autoRegistered;
 
     // Send push notifications to all registered devices
     try {
@@ -127,6 +219,11 @@ try {
 
 } catch (PDOException $e) {
     error_log('Message create error: ' . $e->getMessage());
+    // 42S22 (unknown column): the code was deployed before its migration.
+    // Still a 5xx, so the gateway keeps the alert and retries it.
+    if ($e->getCode() === '42S22') {
+        sendResponse(false, null, 'Database schema is out of date: apply the scripts in migrations/', 500);
+    }
     sendResponse(false, null, 'Database error: ' . $e->getMessage(), 500);
 }
 ?>
\ No newline at end of file
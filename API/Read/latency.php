@@ -0,0 +1,135 @@
+<?php
+/**
+ * LifeLine Latency Report API
+ * Breaks SOS latency into stages and reports percentiles per stage
+ *
+ * Stages (milliseconds, stamped by the TX and the gateway):
+ *   tx_ui     - TX confirm key press to radio start
+ *   air       - LoRa time on air
+ *   gateway   - Gateway RxDone to uplink request
+ *   uplink    - Uplink request to API response (backhaul + API processing)
+ *   total     - Sum of the above for rows that have every stage
+ *
+ * Usage:
+ * GET /API/Read/latency.php - Report over all messages
+ * GET /API/Read/latency.php?did=1 - Filter by device ID
+ * GET /API/Read/latency.php?from=2026-01-01&to=2026-01-31 - Filter by date range
+ */
+
+require_once '../../database.php';
+
+// Only accept GET requests
+if ($_SERVER['REQUEST_METHOD'] !== 'GET') {
+    sendResponse(false, null, 'Method not allowed', 405);
+}
+
+/**
+ * Nearest-rank percentile of a sorted array
+ */
+function percentile(array $sorted, $pct)
+{
+    $count = count($sorted);
+    if ($count === 0) {
+        return null;
+    }
+    $rank = (int) ceil($pct / 100 * $count);
+    return $sorted[max(1, $rank) - 1];
+}
+
+/**
+ * Summary statistics for one stage
+ */
+function stageStats(array $values)
+{
+    sort($values, SORT_NUMERIC);
+    $count = count($values);
+
+    return [
+        'count' => $count,
+        'p50' => percentile($values, 50),
+        'p90' => percentile($values, 90),
+        'p99' => percentile($values, 99),
+        'max' => $count ? $values[$count - 1] : null,
+        'mean' => $count ? round(array_sum($values) / $count, 1) : null
+    ];
+}
+
+try {
+    $db = getDB();
+
+    $query = "
+        SELECT tx_ui_ms, air_ms, gw_ms, uplink_ms
+        FROM messages m
+        WHERE (tx_ui_ms IS NOT NULL OR air_ms IS NOT NULL OR gw_ms IS NOT NULL OR uplink_ms IS NOT NULL)
+    ";
+    $params = [];
+
+    // Filter by device ID
+    if (isset($_GET['did'])) {
+        $query .= " AND m.DID = :did";
+        $params['did'] = (int) $_GET['did'];
+    }
+
+    // Filter by date range
+    if (isset($_GET['from'])) {
+        $query .= " AND m.timestamp >= :from_date";
+        $params['from_date'] = $_GET['from'];
+    }
+
+    if (isset($_GET['to'])) {
+        $query .= " AND m.timestamp <= :to_date";
+        $params['to_date'] = $_GET['to'];
+    }
+
+    $stmt = $db->prepare($query);
+    $stmt->execute($params);
+
+    $columns = [
+        'tx_ui' => 'tx_ui_ms',
+        'air' => 'air_ms',
+        'gateway' => 'gw_ms',
+        'uplink' => 'uplink_ms'
+    ];
+    $samples = array_fill_keys(array_merge(array_keys($columns), ['total']), []);
+
+    while ($row = $stmt->fetch()) {
+        $complete = true;
+        $total = 0;
+        foreach ($columns as $stage => $column) {
+            if ($row[$column] === null) {
+                $complete = false;
+                continue;
+            }
+            $samples[$stage][] = (int) $row[$column];
+            $total += (int) $row[$column];
+        }
+        if ($complete) {
+            $samples['total'][] = $total;
+        }
+    }
+
+    $stages = [];
+    foreach ($samples as $stage => $values) {
+        $stages[$stage] = stageStats($values);
+    }
+
+    // Point at the stage with the largest median share
+    $dominant = null;
+    foreach ($columns as $stage => $column) {
+        if ($stages[$stage]['p50'] !== null &&
+            ($dominant === null || $stages[$stage]['p50'] > $stages[$dominant]['p50'])) {
+            $dominant = $stage;
+        }
+    }
+
+    sendResponse(true, [
+        'unit' => 'ms',
+        'stages' => $stages,
+        'dominant_stage' => $dominant
+    ], 'Latency report generated successfully');
+
+} catch (PDOException $e) {
+    error_log('Latency report error: ' . $e->getMessage());
+    sendResponse(false, null, 'Database error: ' . $e->getMessage(), 500);
+}
+?>
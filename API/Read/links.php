@@ -0,0 +1,85 @@
+<?php
+/**
+ * LifeLine Link Quality API
+ * Per-device link quality as the gateway hears it, weakest first
+ *
+ * Every uplink carries the sender's link stats (averages and counters kept by
+ * the gateway since it booted). A device is weak when its SNR average is
+ * under -15 dB (SF12 decodes to about -20 dB, so less than 5 dB of fade
+ * margin is left) or 10% or more of its alerts never arrived. Those are the
+ * handhelds that need a relay or a better antenna.
+ *
+ * Usage:
+ * GET /API/Read/links.php - Every device the gateway has reported
+ * GET /API/Read/links.php?did=1 - One device
+ * GET /API/Read/links.php?weak=1 - Only the weak links
+ */
+
+require_once '../../database.php';
+
+// Same thresholds as LinkStats.h on the gateway
+const LINK_WEAK_SNR_DB = -15;
+const LINK_WEAK_LOSS_PCT = 10;
+
+// Only accept GET requests
+if ($_SERVER['REQUEST_METHOD'] !== 'GET') {
+    sendResponse(false, null, 'Method not allowed', 405);
+}
+
+try {
+    $db = getDB();
+
+    $query = "
+        SELECT l.DID, d.device_name, d.LID,
+               JSON_UNQUOTE(JSON_EXTRACT(il.mapping, CONCAT('\$.', d.LID))) as location_name,
+               l.rssi_avg, l.snr_avg, l.packets, l.alerts, l.lost, l.updated_at
+        FROM device_links l
+        JOIN devices d ON l.DID = d.DID
+        LEFT JOIN indexes il ON il.type = 'location'
+    ";
+    $params = [];
+
+    // Filter by device ID
+    if (isset($_GET['did'])) {
+        $query .= " WHERE l.DID = :did";
+        $params['did'] = (int) $_GET['did'];
+    }
+
+    $stmt = $db->prepare($query);
+    $stmt->execute($params);
+
+    $devices = [];
+    while ($row = $stmt->fetch()) {
+        $sent = (int) $row['alerts'] + (int) $row['lost'];
+        $row['loss_pct'] = $sent ? round(100 * (int) $row['lost'] / $sent, 1) : 0;
+        $row['weak'] = ($row['snr_avg'] !== null && (float) $row['snr_avg'] < LINK_WEAK_SNR_DB) ||
+                       $row['loss_pct'] >= LINK_WEAK_LOSS_PCT;
+        if (isset($_GET['weak']) && $_GET['weak'] && !$row['weak']) {
+            continue;
+        }
+        $devices[] = $row;
+    }
+
+    // Weak first, then the lowest SNR
+    usort($devices, function ($a, $b) {
+        if ($a['weak'] !== $b['weak']) {
+            return $a['weak'] ? -1 : 1;
+        }
+        return (float) $a['snr_avg'] <=> (float) $b['snr_avg'];
+    });
+
+    $weakCount = count(array_filter($devices, function ($d) {
+        return $d['weak'];
+    }));
+
+    sendResponse(true, [
+        'thresholds' => ['snr_db' => LINK_WEAK_SNR_DB, 'loss_pct' => LINK_WEAK_LOSS_PCT],
+        'weak_count' => $weakCount,
+        'devices' => $devices
+    ], 'Link report generated successfully');
+
+} catch (PDOException $e) {
+    error_log('Link report error: ' . $e->getMessage());
+    sendResponse(false, null, 'Database error: ' . $e->getMessage(), 500);
+}
+?>
@@ -0,0 +1,46 @@
+<?php
+/**
+ * LifeLine Device Registry API
+ * Every registered device ID, for the gateway's registry cache
+ *
+ * The reply carries an ETag of the ID list. The gateway sends it back as
+ * If-None-Match on the next check; while no device was added or removed
+ * the answer is 304 with no body, so checking every few minutes is cheap.
+ *
+ * Usage:
+ * GET /API/Read/registry.php - {"count": n, "dids": [1, 2, ...]}, lowest first
+ */
+
+require_once '../../database.php';
+
+// Only accept GET requests
+if ($_SERVER['REQUEST_METHOD'] !== 'GET') {
+    sendResponse(false, null, 'Method not allowed', 405);
+}
+
+try {
+    $db = getDB();
+
+    $stmt = $db->query("SELECT DID FROM devices ORDER BY DID");
+    $dids = array_map('intval', $stmt->fetchAll(PDO::FETCH_COLUMN));
+
+    $etag = '"' . md5(implode(',', $dids)) . '"';
+    header('ETag: ' . $etag);
+    header('Cache-Control: no-cache');
+
+    $ifNoneMatch = isset($_SERVER['HTTP_IF_NONE_MATCH']) ? trim($_SERVER['HTTP_IF_NONE_MATCH']) : '';
+    if ($ifNoneMatch === $etag) {
+        http_response_code(304);
+        exit;
+    }
+
+    sendResponse(true, [
+        'count' => count($dids),
+        'dids' => $dids
+    ], 'Device registry retrieved successfully');
+
+} catch (PDOException $e) {
+    error_log('Device registry error: ' . $e->getMessage());
+    sendResponse(false, null, 'Database error: ' . $e->getMessage(), 500);
+}
+?>
@@ -6,6 +6,9 @@
  *
  * DISPLAY: ILI9488 3.5" TFT (8-bit Parallel Mode) - 320x480
  * RADIO: LoRa SX1278 @ 433 MHz
+ * PACKET: TX[ID],[CODE][;k=MS][;s=SEQ]  (k = TX key press → radio start, ms;
+ *         s = alert sequence, repeats are dropped)
+ * HEARTBEAT: HB[ID];i=[AVG_mA x10];l=[HOURS];u=[UPTIME_MIN] (logged only)
  *
  * ⚠️ PIN WARNINGS:
  *   - GPIO 2 (LoRa CS): Boot strapping pin - may need BOOT button during upload
@@ -21,6 +24,16 @@
 #include <SPI.h>
 #include <WiFi.h>
 
+#include <AaText.h>
+#include <AlertFrame.h>
+#include <AlertJournal.h>
+#include <BootSequencer.h>
+#include <LatencyBudget.h>
+#include <PinMap.h>
+#include <StagedRender.h>
+#include <UiText.h>
+#include <UiTextNe.h>
+
 // ═══════════════════════════════════════════════════════════════════════════
 //                         ILI9488 DISPLAY PINS (8-bit Parallel)
 // ═══════════════════════════════════════════════════════════════════════════
@@ -40,8 +53,10 @@
 #define TFT_D6 26
 #define TFT_D7 25
 
-const uint8_t dataPins[8] = {TFT_D0, TFT_D1, TFT_D2, TFT_D3,
-                             TFT_D4, TFT_D5, TFT_D6, TFT_D7};
+// D0/D1 sit in the high GPIO bank, the rest in the low one
+typedef lifeline::ParallelBus8<TFT_WR, TFT_D0, TFT_D1, TFT_D2, TFT_D3, TFT_D4,
+                               TFT_D5, TFT_D6, TFT_D7>
+    TftBus;
 
 // ═══════════════════════════════════════════════════════════════════════════
 //                         LORA SX1278 PINS
@@ -64,6 +79,7 @@ const uint8_t dataPins[8] = {TFT_D0, TFT_D1, TFT_D2, TFT_D3,
 #define LORA_SF 12
 #define LORA_BW 125E3
 #define LORA_SYNC_WORD 0x12
+#define LORA_INIT_RETRIES 3 // Extra LoRa.begin() attempts at boot
 
 // ═══════════════════════════════════════════════════════════════════════════
 //                         OTHER PINS
@@ -105,21 +121,19 @@ const uint8_t dataPins[8] = {TFT_D0, TFT_D1, TFT_D2, TFT_D3,
 
 #define ALERT_COUNT 15
 
-const char *alertNames[ALERT_COUNT] = {
-    "EMERGENCY",         "MEDICAL EMERGENCY", "MEDICINE SHORTAGE",
-    "EVACUATION NEEDED", "STATUS OK",         "INJURY REPORTED",
-    "FOOD SHORTAGE",     "WATER SHORTAGE",    "WEATHER ALERT",
-    "LOST PERSON",       "ANIMAL ATTACK",     "LANDSLIDE",
-    "SNOW STORM",        "EQUIPMENT FAILURE", "OTHER EMERGENCY"};
-
-const char *alertShort[ALERT_COUNT] = {
-    "EMERGENCY", "MEDICAL",   "MEDICINE", "EVACUATION", "STATUS OK",
-    "INJURY",    "FOOD",      "WATER",    "WEATHER",    "LOST PERSON",
-    "ANIMAL",    "LANDSLIDE", "SNOW",     "EQUIPMENT",  "OTHER"};
+// Alert names live once in LifelineCore (UiText.h)
+const lifeline::Text *const alertNames = lifeline::ui::ALERT_NAMES;
+const lifeline::Text *const alertShort = lifeline::ui::ALERT_WORDS;
+static_assert(lifeline::ui::ALERT_NAMES_COUNT == ALERT_COUNT,
+              "alert table size must match ALERT_COUNT");
+// Nepali alert words, shaped at build time (UiTextNe.h)
+const lifeline::ShapedText *const alertShortNe = lifeline::ui_ne::ALERT_WORDS;
+static_assert(lifeline::ui_ne::ALERT_WORDS_COUNT == ALERT_COUNT,
+              "Nepali alert table size must match ALERT_COUNT");
 
 const uint8_t alertPriority[ALERT_COUNT] = {0, 0, 2, 0, 3, 1, 2, 2,
                                             2, 1, 1, 1, 1, 2, 4};
-const char *priorityLabels[] = {"CRITICAL", "HIGH", "MEDIUM", "OK", "INFO"};
+const lifeline::Text *const priorityLabels = lifeline::ui::PRIORITY_LABELS;
 
 // ═══════════════════════════════════════════════════════════════════════════
 //                         STATE VARIABLES
@@ -146,21 +160,28 @@ int totalAlertsReceived = 0;
 bool loraInitialized = false;
 
 Preferences preferences;
+lifeline::Lang uiLang = lifeline::Lang::EN; // Serial "lang ne|en", kept in NVS
 String storedSSID = "";
 String storedPassword = "";
 bool wifiConnected = false;
 
+// Latency budget for the frame in flight (serial "lat" prints the report)
+lifeline::LatencyTrace rxTrace;
+lifeline::LatencyRecorder<> rxLatency;
+lifeline::DuplicateFilter rxDedupe; // TX retries/resumes repeat the same s=
+char serialCmd[16];
+uint8_t serialCmdLen = 0;
+
+// Overlapped panel / radio bring-up (serial "boot" prints the timeline)
+lifeline::BootSequencer bootSeq;
+int8_t radioBootTask = -1;
+int8_t panelBootTask = -1;
+
 // ═══════════════════════════════════════════════════════════════════════════
 //                         ILI9488 LOW-LEVEL DRIVER
 // ═══════════════════════════════════════════════════════════════════════════
 
-inline void writeData8(uint8_t data) {
-  for (int i = 0; i < 8; i++) {
-    digitalWrite(dataPins[i], (data >> i) & 0x01);
-  }
-  digitalWrite(TFT_WR, LOW);
-  digitalWrite(TFT_WR, HIGH);
-}
+inline void writeData8(uint8_t data) { TftBus::write(data); }
 
 void writeCommand(uint8_t cmd) {
   digitalWrite(TFT_RS, LOW);
@@ -176,27 +197,36 @@ void writeDataByte(uint8_t data) {
   digitalWrite(TFT_CS, HIGH);
 }
 
-void tftInit() {
-  // Reset
-  digitalWrite(TFT_RST, HIGH);
-  delay(50);
-  digitalWrite(TFT_RST, LOW);
-  delay(150);
-  digitalWrite(TFT_RST, HIGH);
-  delay(150);
-
-  writeCommand(0x01);
-  delay(150); // Software reset
-  writeCommand(0x11);
-  delay(150); // Sleep out
-  writeCommand(0x3A);
-  writeDataByte(0x55); // 16-bit color
-  writeCommand(0x36);
-  writeDataByte(0x48); // Memory access
-  writeCommand(0x29);
-  delay(50); // Display ON
-
-  Serial.println("[OK] ILI9488 initialized (8-bit parallel)");
+// Panel bring-up as boot phases: the waits are the reset, software reset and
+// sleep-out timers, during which the sequencer brings up the radio
+int32_t panelBootStep(uint8_t phase) {
+  switch (phase) {
+  case 0:
+    digitalWrite(TFT_RST, HIGH);
+    return 50;
+  case 1:
+    digitalWrite(TFT_RST, LOW);
+    return 150;
+  case 2:
+    digitalWrite(TFT_RST, HIGH);
+    return 150;
+  case 3:
+    writeCommand(0x01); // Software reset
+    return 150;
+  case 4:
+    writeCommand(0x11); // Sleep out
+    return 150;
+  case 5:
+    writeCommand(0x3A);
+    writeDataByte(0x55); // 16-bit color
+    writeCommand(0x36);
+    writeDataByte(0x48); // Memory access
+    writeCommand(0x29);
+    return 50; // Display ON
+  default:
+    Serial.println("[OK] ILI9488 initialized (8-bit parallel)");
+    return lifeline::BOOT_DONE;
+  }
 }
 
 void setAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
@@ -362,6 +392,60 @@ void drawTextCentered(int16_t y, const char *text, uint16_t color,
   drawText(x, y, text, color, size);
 }
 
+/**
+ * Draw a UI table string centered horizontally (width precomputed)
+ */
+void drawTextCentered(int16_t y, const lifeline::Text &text, uint16_t color,
+                      uint8_t size) {
+  drawText(lifeline::centerX(text, size, SCREEN_WIDTH), y, text.str, color,
+           size);
+}
+
+/**
+ * Alert word in the UI language. The 16 px Nepali font is drawn at half the
+ * text size and raised by its top margin, so it sits on the English line.
+ */
+void drawAlertWord(int16_t x, int16_t y, int alertIndex, uint16_t color,
+                   uint8_t size) {
+  if (uiLang == lifeline::Lang::NE) {
+    uint8_t scale = size > 1 ? size / 2 : 1;
+    lifeline::drawShaped(fillRect, lifeline::ui_ne::FONT,
+                         alertShortNe[alertIndex], x, y - 2 * scale, color,
+                         scale);
+  } else {
+    drawText(x, y, alertShort[alertIndex].str, color, size);
+  }
+}
+
+/**
+ * Anti-aliased text sink: one address window per text box, then the rows
+ * as they are blended. The box must be on screen (no clipping here).
+ */
+struct PanelSink {
+  void begin(int16_t x, int16_t y, int16_t w, int16_t h) {
+    setAddressWindow(x, y, x + w - 1, y + h - 1);
+    digitalWrite(TFT_RS, HIGH);
+    digitalWrite(TFT_CS, LOW);
+  }
+  void write(const uint16_t *pixels, uint16_t n) {
+    for (uint16_t i = 0; i < n; i++) {
+      writeData8(pixels[i] >> 8);
+      writeData8(pixels[i]);
+    }
+  }
+  void end() { digitalWrite(TFT_CS, HIGH); }
+};
+
+PanelSink panelSink;
+lifeline::AaTextRenderer aaText;
+
+/** Proportional text with its box top-left at (x, y), blended into bg. */
+uint16_t drawAaText(int16_t x, int16_t y, const char *text,
+                    const lifeline::AaFont &font, uint16_t color,
+                    uint16_t bg) {
+  return aaText.draw(panelSink, font, text, x, y, color, bg);
+}
+
 // ═══════════════════════════════════════════════════════════════════════════
 //                         UTILITY FUNCTIONS
 // ═══════════════════════════════════════════════════════════════════════════
@@ -423,8 +507,8 @@ void drawBootScreen() {
   drawRect(cx - 23, cy - 7, 46, 14, RGB565(255, 100, 100));
 
   // Title
-  drawTextCentered(130, "LifeLine", COLOR_WHITE, 4);
-  drawTextCentered(175, "EMERGENCY RECEIVER", COLOR_CYAN, 1);
+  drawTextCentered(130, lifeline::ui::LIFELINE, COLOR_WHITE, 4);
+  drawTextCentered(175, lifeline::ui::EMERGENCY_RECEIVER, COLOR_CYAN, 1);
 
   // Separator line
   drawHLine(60, 195, SCREEN_WIDTH - 120, COLOR_BORDER);
@@ -433,7 +517,7 @@ void drawBootScreen() {
   fillRect(40, 280, SCREEN_WIDTH - 80, 12, COLOR_BG_CARD);
   drawRect(40, 280, SCREEN_WIDTH - 80, 12, COLOR_BORDER);
 
-  drawTextCentered(300, "Initializing...", COLOR_TEXT_MUTED, 1);
+  drawTextCentered(300, lifeline::ui::INITIALIZING, COLOR_TEXT_MUTED, 1);
 
   // Bottom accent
   drawHLine(0, SCREEN_HEIGHT - 3, SCREEN_WIDTH, RGB565(0, 100, 120));
@@ -502,8 +586,8 @@ void drawIdleScreen() {
   drawCircle(rcx, rcy, 25, COLOR_CYAN); // Using simple lines instead
   fillCircle(rcx, rcy, 8, COLOR_CYAN);
 
-  drawTextCentered(140, "LISTENING", COLOR_WHITE, 2);
-  drawTextCentered(180, "Waiting for signals...", COLOR_TEXT_MUTED, 1);
+  drawTextCentered(140, lifeline::ui::LISTENING, COLOR_WHITE, 2);
+  drawTextCentered(180, lifeline::ui::WAITING_FOR_SIGNALS, COLOR_TEXT_MUTED, 1);
 
   // Stats
   int sy = 220;
@@ -546,46 +630,109 @@ void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
   }
 }
 
-void drawAlertScreen(int deviceId, int alertIndex, int rssi) {
-  uint16_t alertColor = getAlertColor(alertIndex);
-  uint8_t priority = alertPriority[alertIndex];
-
-  fillScreen(COLOR_BG_PRIMARY);
+// The alert screen in tiers (StagedRender.h). Tier 0 is what a responder
+// reads: the colour band, the alert word and code, the sender and signal.
+// Each step paints its own background, over whatever screen was there.
+const uint8_t ALERT_TIER_LABELS = 1;
+const uint8_t ALERT_TIER_BACKDROP = 2;
+const uint32_t ALERT_FRAME_US = 8000; // Drawing per loop pass after tier 0
+
+// The backdrop: every pixel outside the band, the cards and the badge,
+// cleared a part per step (the lower half in four parts)
+const int16_t ALERT_BACKDROP[][4] = {
+    {0, 50, SCREEN_WIDTH, 10},   {0, 60, 15, 25},   {95, 60, 225, 25},
+    {0, 85, SCREEN_WIDTH, 10},   {0, 95, 15, 80},   {305, 95, 15, 80},
+    {0, 175, SCREEN_WIDTH, 15},  {0, 190, 15, 50},  {155, 190, 10, 50},
+    {305, 190, 15, 50},
+};
+const uint8_t ALERT_BACKDROP_PARTS = 5;
 
-  // Alert header
-  fillRect(0, 0, SCREEN_WIDTH, 50, alertColor);
-  drawText(15, 15, "INCOMING ALERT", RGB565(10, 10, 10), 2);
+lifeline::StagedRender alertRender;
 
-  // Priority badge
-  fillRect(15, 60, 80, 25, alertColor);
-  drawText(20, 67, priorityLabels[min((int)priority, 4)], RGB565(10, 10, 10),
-           1);
+void drawAlertBand(uint8_t) {
+  fillRect(0, 0, SCREEN_WIDTH, 50, getAlertColor(lastAlertIndex));
+}
 
-  // Main alert card
+void drawAlertCard(uint8_t) {
+  const uint16_t alertColor = getAlertColor(lastAlertIndex);
+  const uint16_t ink = RGB565(10, 10, 10);
   fillRect(15, 95, SCREEN_WIDTH - 30, 80, COLOR_BG_CARD);
-  drawRect(15, 95, SCREEN_WIDTH - 30, 80, alertColor);
   fillRect(15, 95, 5, 80, alertColor); // Left accent
 
-  drawText(30, 110, alertShort[alertIndex], alertColor, 2);
+  if (uiLang == lifeline::Lang::NE) {
+    drawAlertWord(30, 110, lastAlertIndex, alertColor, 2);
+  } else {
+    // 32 px unless the word would run into the code box
+    const char *word = alertShort[lastAlertIndex].str;
+    const lifeline::AaFont &big =
+        lifeline::aaTextWidth(lifeline::aa::SANS_BOLD_32, word) <=
+                SCREEN_WIDTH - 95
+            ? lifeline::aa::SANS_BOLD_32
+            : lifeline::aa::SANS_BOLD_19;
+    drawAaText(30, 135 - big.height / 2, word, big, alertColor,
+               COLOR_BG_CARD);
+  }
 
   // Alert code
   fillRect(SCREEN_WIDTH - 55, 105, 35, 25, alertColor);
-  char code[2] = {getAlertCode(alertIndex), 0};
-  drawText(SCREEN_WIDTH - 48, 110, code, RGB565(10, 10, 10), 2);
+  char code[2] = {getAlertCode(lastAlertIndex), 0};
+  drawAaText(lifeline::centerSpan(
+                 lifeline::aaTextWidth(lifeline::aa::SANS_BOLD_19, code), 35,
+                 SCREEN_WIDTH - 55),
+             107, code, lifeline::aa::SANS_BOLD_19, ink, alertColor);
+}
 
-  // Device info
+void drawAlertSource(uint8_t) {
   fillRect(15, 190, 140, 50, COLOR_BG_CARD);
-  drawText(20, 200, "FROM DEVICE", COLOR_TEXT_MUTED, 1);
   char devBuf[15];
-  sprintf(devBuf, "TX #%03d", deviceId);
-  drawText(20, 220, devBuf, COLOR_CYAN, 2);
+  sprintf(devBuf, "TX #%03d", lastDeviceId);
+  drawAaText(20, 213, devBuf, lifeline::aa::SANS_BOLD_19, COLOR_CYAN,
+             COLOR_BG_CARD);
 
-  // Signal info
   fillRect(165, 190, 140, 50, COLOR_BG_CARD);
-  drawText(170, 200, "SIGNAL", COLOR_TEXT_MUTED, 1);
   char rssiBuf[15];
-  sprintf(rssiBuf, "%d dBm", rssi);
-  drawText(170, 220, rssiBuf, COLOR_GREEN, 2);
+  sprintf(rssiBuf, "%d dBm", lastRssi);
+  drawAaText(170, 213, rssiBuf, lifeline::aa::SANS_BOLD_19, COLOR_GREEN,
+             COLOR_BG_CARD);
+}
+
+void drawAlertLabels(uint8_t) {
+  const uint16_t alertColor = getAlertColor(lastAlertIndex);
+  const uint16_t ink = RGB565(10, 10, 10);
+  drawAaText(15, 14, "INCOMING ALERT", lifeline::aa::SANS_BOLD_19, ink,
+             alertColor);
+
+  // Priority badge
+  fillRect(15, 60, 80, 25, alertColor);
+  drawAaText(20, 66,
+             priorityLabels[min((int)alertPriority[lastAlertIndex], 4)].str,
+             lifeline::aa::SANS_BOLD_12, ink, alertColor);
+
+  drawRect(15, 95, SCREEN_WIDTH - 30, 80, alertColor);
+
+  drawAaText(20, 196, "FROM DEVICE", lifeline::aa::SANS_BOLD_12,
+             COLOR_TEXT_MUTED, COLOR_BG_CARD);
+  drawAaText(170, 196, "SIGNAL", lifeline::aa::SANS_BOLD_12, COLOR_TEXT_MUTED,
+             COLOR_BG_CARD);
+}
+
+void drawAlertBackdrop(uint8_t part) {
+  if (part == 0) {
+    for (const int16_t *r : ALERT_BACKDROP)
+      fillRect(r[0], r[1], r[2], r[3], COLOR_BG_PRIMARY);
+    return;
+  }
+  const int16_t rows = (SCREEN_HEIGHT - 240) / (ALERT_BACKDROP_PARTS - 1);
+  fillRect(0, 240 + (part - 1) * rows, SCREEN_WIDTH, rows, COLOR_BG_PRIMARY);
+}
+
+// A packet waiting in the FIFO: hand the loop back to the radio
+bool alertPacketWaiting() { return digitalRead(LORA_DIO0) == HIGH; }
+
+// Tier 0 now; the rest from loop() (continueAlertScreen). A later alert
+// replaces whatever is left of this one.
+void drawAlertScreen(int deviceId, int alertIndex, int rssi) {
+  uint8_t priority = alertPriority[alertIndex];
 
   alertReceivedTime = millis();
   lastDeviceId = deviceId;
@@ -593,11 +740,27 @@ void drawAlertScreen(int deviceId, int alertIndex, int rssi) {
   lastRssi = rssi;
   totalAlertsReceived++;
 
+  alertRender.begin();
+  alertRender.add(lifeline::RENDER_TIER_CRITICAL, drawAlertBand);
+  alertRender.add(lifeline::RENDER_TIER_CRITICAL, drawAlertCard);
+  alertRender.add(lifeline::RENDER_TIER_CRITICAL, drawAlertSource);
+  alertRender.add(ALERT_TIER_LABELS, drawAlertLabels);
+  for (uint8_t part = 0; part < ALERT_BACKDROP_PARTS; part++)
+    alertRender.add(ALERT_TIER_BACKDROP, drawAlertBackdrop, part);
+  alertRender.run(0);
+
+  // Alert is readable from here on; the tone is not part of the budget
+  if (rxTrace.active && rxTrace.displayedUs == 0)
+    rxTrace.displayedUs = micros();
+
   playAlertTone(priority);
   Serial.printf("[ALERT] Device=%d, Alert=%s, RSSI=%d\n", deviceId,
-                alertNames[alertIndex], rssi);
+                alertNames[alertIndex].str, rssi);
 }
 
+// One frame of the labels and backdrop left to draw
+void continueAlertScreen() { alertRender.run(ALERT_FRAME_US); }
+
 void updateIdleAnimation() {
   if (millis() - lastPulseTime >= 600) {
     lastPulseTime = millis();
@@ -613,45 +776,167 @@ void updateIdleAnimation() {
 //                         LORA FUNCTIONS
 // ═══════════════════════════════════════════════════════════════════════════
 
+// TX-prefixed frames with a known code only (see AlertFrame.h)
 bool parseLoRaPacket(int &deviceId, int &alertIndex, int &rssi) {
   int packetSize = LoRa.parsePacket();
   if (packetSize == 0)
     return false;
 
-  String packet = "";
+  rxTrace.begin(micros(), true);
+  rxTrace.airUs = lifeline::loraTimeOnAirUs(packetSize, LORA_SF, LORA_BW);
+
+  // Straight from the FIFO into a fixed buffer - no heap on the RX path
+  char packet[FRAME_MAX_LEN];
+  size_t len = 0;
   while (LoRa.available()) {
-    packet += (char)LoRa.read();
+    int c = LoRa.read();
+    if (len < sizeof(packet))
+      packet[len++] = (char)c;
   }
   rssi = LoRa.packetRssi();
 
-  // Parse TX[ID],[CODE] format
-  if (!packet.startsWith("TX"))
+  lifeline::AlertFrame frame;
+  const lifeline::FrameType type = lifeline::parseFrame(
+      packet, len, frame, lifeline::FRAME_RX_FLAGS, ALERT_COUNT);
+
+  // Energy heartbeat from a field unit - log it, never show as an alert
+  if (type == lifeline::FRAME_HEARTBEAT) {
+    rxTrace.active = false;
+    Serial.printf("[HB] TX #%03u: avg %.1f mA, projected %ld h, RSSI %d\n",
+                  frame.deviceId, frame.field('i') / 10.0f, frame.field('l'),
+                  rssi);
     return false;
+  }
 
-  int comma = packet.indexOf(',');
-  if (comma < 3)
+  if (type != lifeline::FRAME_ALERT) {
+    rxTrace.active = false;
     return false;
+  }
 
-  deviceId = packet.substring(2, comma).toInt();
-  String codePart = packet.substring(comma + 1);
-  codePart.trim();
+  if (frame.txUiMs >= 0)
+    rxTrace.txUiMs = frame.txUiMs;
+  deviceId = frame.deviceId;
+  alertIndex = frame.alertIndex;
 
-  if (codePart.length() == 1 && codePart[0] >= 'A' && codePart[0] <= 'O') {
-    alertIndex = codePart[0] - 'A';
-  } else {
-    alertIndex = codePart.toInt();
+  if (frame.codeDefaulted)
+    Serial.println("[RX] Unknown alert code, defaulting to OTHER");
+
+  // Already shown and uplinked: the TX retried or resumed after a reset
+  if (frame.seq >= 0 && rxDedupe.seen(deviceId, (uint16_t)frame.seq)) {
+    Serial.printf("[RX] Duplicate TX%03d s=%ld dropped (%lu total)\n",
+                  deviceId, frame.seq, (unsigned long)rxDedupe.dropped());
+    rxTrace.active = false;
+    return false;
+  }
+  rxTrace.parsedUs = micros();
+  return true;
+}
+
+void setUiLang(lifeline::Lang lang) {
+  uiLang = lang;
+  preferences.begin("lifeline", false);
+  preferences.putUChar("lang", (uint8_t)lang);
+  preferences.end();
+  Serial.printf("[OK] Alert words in %s\n",
+                lang == lifeline::Lang::NE ? "Nepali" : "English");
+}
+
+// Record the budget of the alert just drawn
+void finishLatencyTrace() {
+  if (!rxTrace.active)
+    return;
+  rxLatency.recordTrace(rxTrace);
+  if (rxTrace.preRxUs() > 0) {
+    Serial.printf("[LAT] ui %ld ms | air %u ms | screen %lu ms | key>screen "
+                  "%lu ms\n",
+                  (long)rxTrace.txUiMs, rxTrace.airMs(),
+                  (rxTrace.displayedUs - rxTrace.parsedUs) / 1000,
+                  (rxTrace.preRxUs() + rxTrace.displayedUs - rxTrace.rxDoneUs) /
+                      1000);
   }
+  rxTrace.active = false;
+}
 
-  return (alertIndex >= 0 && alertIndex < ALERT_COUNT);
+// Line-based serial commands: "lat" latency report, "boot" boot timeline,
+// "ui" alert screen timing, "lang ne" / "lang en" alert word language
+void checkSerialCommands() {
+  while (Serial.available()) {
+    char c = Serial.read();
+    if (c != '\n' && c != '\r') {
+      if (serialCmdLen < sizeof(serialCmd) - 1)
+        serialCmd[serialCmdLen++] = c;
+      continue;
+    }
+    serialCmd[serialCmdLen] = '\0';
+    if (strcmp(serialCmd, "lat") == 0)
+      rxLatency.printReport(Serial);
+    else if (strcmp(serialCmd, "boot") == 0)
+      bootSeq.printReport(Serial);
+    else if (strcmp(serialCmd, "ui") == 0)
+      alertRender.printReport(Serial, "alert screen");
+    else if (strcmp(serialCmd, "lang ne") == 0)
+      setUiLang(lifeline::Lang::NE);
+    else if (strcmp(serialCmd, "lang en") == 0)
+      setUiLang(lifeline::Lang::EN);
+    serialCmdLen = 0;
+  }
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
 //                         SETUP & LOOP
 // ═══════════════════════════════════════════════════════════════════════════
 
+// LoRa bring-up: reset pulse, then begin() with retries. The reset is timed
+// here so LoRa.begin() does not repeat it with delay().
+int32_t radioBootStep(uint8_t phase) {
+  switch (phase) {
+  case 0:
+    digitalWrite(LORA_RST, LOW);
+    return 10;
+  case 1:
+    digitalWrite(LORA_RST, HIGH);
+    return 10;
+  default:
+    LoRa.setPins(LORA_CS, -1, LORA_DIO0);
+    if (!LoRa.begin(LORA_FREQUENCY)) {
+      if (phase < 2 + LORA_INIT_RETRIES) {
+        Serial.printf("[WARN] LoRa init failed, retry %d/%d\n", phase - 1,
+                      LORA_INIT_RETRIES);
+        return 100;
+      }
+      Serial.println("[ERROR] LoRa init failed!");
+      loraInitialized = false;
+      return lifeline::BOOT_DONE;
+    }
+    LoRa.setSpreadingFactor(LORA_SF);
+    LoRa.setSignalBandwidth(LORA_BW);
+    LoRa.enableCrc();
+    loraInitialized = true;
+    bootSeq.mark("radio");
+    Serial.printf("[OK] LoRa @ 433MHz, SF12 (%lu ms)\n", millis());
+    return lifeline::BOOT_DONE;
+  }
+}
+
+// Leave boot as soon as the radio is listening
+void finishBoot() {
+  currentScreen = SCREEN_IDLE;
+  drawIdleScreen();
+  bootSeq.mark("idle");
+  Serial.printf("[BOOT] Listening %lu ms after boot (radio ready at %lu ms)\n",
+                millis(), bootSeq.markMs("radio"));
+}
+
+// Time to first over-the-air alert after power-on, logged once
+void markFirstAlert() {
+  if (bootSeq.markMs("first alert"))
+    return;
+  bootSeq.mark("first alert");
+  Serial.printf("[BOOT] First alert %lu ms after boot\n", millis());
+}
+
 void setup() {
   Serial.begin(115200);
-  delay(500);
 
   Serial.println("\n");
   Serial.println(
@@ -661,14 +946,16 @@ void setup() {
   Serial.println(
       "╚═══════════════════════════════════════════════════════════╝");
 
+  preferences.begin("lifeline", true); // Read-only
+  uiLang = (lifeline::Lang)preferences.getUChar("lang", 0);
+  preferences.end();
+
   // Initialize display pins
   pinMode(TFT_RST, OUTPUT);
   pinMode(TFT_CS, OUTPUT);
   pinMode(TFT_RS, OUTPUT);
-  pinMode(TFT_WR, OUTPUT);
   pinMode(TFT_RD, OUTPUT);
-  for (int i = 0; i < 8; i++)
-    pinMode(dataPins[i], OUTPUT);
+  TftBus::begin();
 
   digitalWrite(TFT_CS, HIGH);
   digitalWrite(TFT_RD, HIGH);
@@ -679,47 +966,36 @@ void setup() {
   pinMode(LORA_RST, OUTPUT);
   digitalWrite(LORA_CS, HIGH);
 
-  // Reset LoRa
-  digitalWrite(LORA_RST, LOW);
-  delay(10);
-  digitalWrite(LORA_RST, HIGH);
-  delay(10);
-
   // Initialize SPI for LoRa (custom pins)
   SPI.begin(LORA_SCK, LORA_MISO, LORA_MOSI);
   Serial.println("[OK] SPI initialized");
 
-  // Initialize LoRa
-  LoRa.setPins(LORA_CS, LORA_RST, LORA_DIO0);
-  if (!LoRa.begin(LORA_FREQUENCY)) {
-    Serial.println("[ERROR] LoRa init failed!");
-    loraInitialized = false;
+  // Panel (parallel bus) and radio (SPI) are independent: run their
+  // datasheet waits side by side
+  radioBootTask = bootSeq.add("radio", radioBootStep);
+  panelBootTask = bootSeq.add("panel", panelBootStep);
+  bootSeq.runUntil(panelBootTask);
+  alertRender.setPreempt(alertPacketWaiting);
+
+  // Boot screen only if the radio is still not listening
+  if (bootSeq.done(radioBootTask)) {
+    finishBoot();
   } else {
-    LoRa.setSpreadingFactor(LORA_SF);
-    LoRa.setSignalBandwidth(LORA_BW);
-    LoRa.enableCrc();
-    loraInitialized = true;
-    Serial.println("[OK] LoRa @ 433MHz, SF12");
+    currentScreen = SCREEN_BOOT;
+    drawBootScreen();
   }
 
-  // Initialize display
-  tftInit();
-  fillScreen(COLOR_BLACK);
-
-  // Show boot screen
-  currentScreen = SCREEN_BOOT;
-  drawBootScreen();
-
   Serial.println("[READY] Waiting for alerts...\n");
 }
 
 void loop() {
   switch (currentScreen) {
   case SCREEN_BOOT:
-    if (millis() - bootStartTime >= 2000) {
-      currentScreen = SCREEN_IDLE;
-      drawIdleScreen();
-    }
+    // Radio retries still running: keep the boot screen until it listens
+    bootSeq.poll();
+    updateBootAnimation();
+    if (bootSeq.done(radioBootTask))
+      finishBoot();
     break;
 
   case SCREEN_IDLE:
@@ -727,8 +1003,10 @@ void loop() {
     {
       int deviceId, alertIndex, rssi;
       if (parseLoRaPacket(deviceId, alertIndex, rssi)) {
+        markFirstAlert();
         currentScreen = SCREEN_ALERT;
         drawAlertScreen(deviceId, alertIndex, rssi);
+        finishLatencyTrace();
       }
     }
     break;
@@ -737,14 +1015,19 @@ void loop() {
     int deviceId, alertIndex, rssi;
     if (parseLoRaPacket(deviceId, alertIndex, rssi)) {
       drawAlertScreen(deviceId, alertIndex, rssi);
+      finishLatencyTrace();
+    } else {
+      continueAlertScreen();
     }
   }
     if (millis() - alertReceivedTime >= 30000) {
+      alertRender.cancel();
       currentScreen = SCREEN_IDLE;
       drawIdleScreen();
     }
     break;
   }
 
+  checkSerialCommands();
   delay(10);
 }
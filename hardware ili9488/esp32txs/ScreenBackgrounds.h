@@ -0,0 +1,1784 @@
+/*
+ * GENERATED from the draw*Background() and field functions in
+ * esp32txs.ino by hardware/host/tools/bake_screens.cpp. Do not edit;
+ * change the drawing code and rerun the tool (build the host tree,
+ * then bake_screens --write <this file>).
+ *
+ * 5 backgrounds, 34586 bytes of run-length RGB565 (PanelImage.h).
+ */
+
+#ifndef ESP32TXS_SCREEN_BACKGROUNDS_H
+#define ESP32TXS_SCREEN_BACKGROUNDS_H
+
+#include <PanelImage.h>
+#include <stdint.h>
+
+namespace bg {
+
+// MENU: 4588 bytes (1.5% of 300 KB raw)
+constexpr uint16_t MENU_WORDS[] = {
+    0x10B3, 0x1148, 0x0024, 0x18C5, 0x01BA, 0x1148, 0x0028, 0x18C5, 0x01B8, 0x1148,
+    0x0028, 0x18C5, 0x0007, 0x1148, 0x01B0, 0x1128, 0x002A, 0x18C5, 0x01B6, 0x1128,
+    0x002A, 0x18C5, 0x01B6, 0x1128, 0x002A, 0x18C5, 0x0006, 0x1128, 0x000C, 0x1127,
+    0x0008, 0xFFFF, 0x8002, 0x1127, 0x1127, 0x000A, 0xFFFF, 0x8004, 0x1127, 0x1127,
+    0xFFFF, 0xFFFF, 0x000A, 0x1127, 0x000A, 0xFFFF, 0x0004, 0x1127, 0x0006, 0xFFFF,
+    0x0004, 0x1127, 0x000A, 0xFFFF, 0x0010, 0x1127, 0x0006, 0xFFFF, 0x0004, 0x1127,
+    0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x1127, 0x000A, 0xFFFF, 0x8002, 0x1127, 0x1127,
+    0x0008, 0xFFFF, 0x0004, 0x1127, 0x000A, 0xFFFF, 0x000E, 0x1127, 0x000A, 0xFFFF,
+    0x8004, 0x1127, 0x1127, 0xFFFF, 0xFFFF, 0x0006, 0x1127, 0x8004, 0xFFFF, 0xFFFF,
+    0x1127, 0x1127, 0x0008, 0xFFFF, 0x0004, 0x1127, 0x000A, 0xFFFF, 0x00DC, 0x1127,
+    0x002A, 0x18C5, 0x0012, 0x1127, 0x0008, 0xFFFF, 0x8002, 0x0000, 0x1127, 0x000A,
+    0xFFFF, 0x8005, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x000A,
+    0xFFFF, 0x8001, 0x0000, 0x0003, 0x1127, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0003,
+    0x1127, 0x000A, 0xFFFF, 0x8001, 0x0000, 0x000F, 0x1127, 0x0006, 0xFFFF, 0x8001,
+    0x0000, 0x0003, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x000A,
+    0xFFFF, 0x8002, 0x0000, 0x1127, 0x0008, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1127,
+    0x000A, 0xFFFF, 0x8001, 0x0000, 0x000D, 0x1127, 0x000A, 0xFFFF, 0x8005, 0x0000,
+    0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8004, 0xFFFF, 0xFFFF, 0x0000,
+    0x1127, 0x0008, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1127, 0x000A, 0xFFFF, 0x8001,
+    0x0000, 0x00DB, 0x1127, 0x002A, 0x18C5, 0x0010, 0x1127, 0x8003, 0xFFFF, 0xFFFF,
+    0x1127, 0x0008, 0x0000, 0x8003, 0x1127, 0xFFFF, 0xFFFF, 0x0009, 0x0000, 0x8004,
+    0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8002, 0xFFFF, 0xFFFF, 0x0009,
+    0x0000, 0x8004, 0x1127, 0xFFFF, 0xFFFF, 0x1127, 0x0005, 0x0000, 0x8002, 0xFFFF,
+    0xFFFF, 0x0003, 0x1127, 0x0003, 0x0000, 0x8002, 0xFFFF, 0xFFFF, 0x0005, 0x0000,
+    0x000D, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x1127, 0x0005, 0x0000, 0x8007, 0xFFFF,
+    0xFFFF, 0x1127, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8002, 0xFFFF,
+    0xFFFF, 0x0009, 0x0000, 0x8003, 0x1127, 0xFFFF, 0xFFFF, 0x0006, 0x0000, 0x8002,
+    0xFFFF, 0xFFFF, 0x0003, 0x1127, 0x0003, 0x0000, 0x8002, 0xFFFF, 0xFFFF, 0x0005,
+    0x0000, 0x000E, 0x1127, 0x0003, 0x0000, 0x8002, 0xFFFF, 0xFFFF, 0x0005, 0x0000,
+    0x8004, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8006, 0xFFFF, 0xFFFF,
+    0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0006, 0x0000, 0x8006, 0xFFFF, 0xFFFF, 0x1127,
+    0x1127, 0xFFFF, 0xFFFF, 0x0009, 0x0000, 0x00DB, 0x1127, 0x002A, 0x18C5, 0x0010,
+    0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0011, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007,
+    0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0015, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127,
+    0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127,
+    0xFFFF, 0xFFFF, 0x0000, 0x00E3, 0x1127, 0x002A, 0x18C5, 0x0010, 0x1127, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0006, 0x1127, 0x8002,
+    0x0000, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0011, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000,
+    0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0015, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0006, 0x1127, 0x800E, 0x0000, 0xFFFF, 0xFFFF,
+    0x1127, 0x1127, 0xFFFF, 0xFFFF, 0x1127, 0x0000, 0x0000, 0x1127, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF,
+    0x0000, 0x00E3, 0x1127, 0x002A, 0x18C5, 0x0010, 0x1127, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x000D, 0x1127, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0011, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007,
+    0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0015, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0007, 0x1127, 0x8007,
+    0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0003, 0x1127, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127,
+    0xFFFF, 0xFFFF, 0x0000, 0x00E3, 0x1127, 0x002A, 0x18C5, 0x0011, 0x1127, 0x8001,
+    0x0000, 0x0006, 0xFFFF, 0x0004, 0x1127, 0x0008, 0xFFFF, 0x0004, 0x1127, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x0008, 0xFFFF, 0x0004, 0x1127, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x000D, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0011,
+    0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF,
+    0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x0008, 0xFFFF, 0x0004,
+    0x1127, 0x0008, 0xFFFF, 0x8003, 0x1127, 0x0000, 0x0000, 0x0005, 0x1127, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0015, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0008,
+    0x1127, 0x8006, 0x0000, 0xFFFF, 0xFFFF, 0x1127, 0x0000, 0x0000, 0x0003, 0x1127,
+    0x0008, 0xFFFF, 0x8004, 0x1127, 0x0000, 0x0000, 0x1127, 0x0008, 0xFFFF, 0x00DE,
+    0x1127, 0x002A, 0x18C5, 0x0006, 0x1127, 0x000C, 0x1107, 0x0006, 0xFFFF, 0x8001,
+    0x0000, 0x0003, 0x1107, 0x0008, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x0008, 0xFFFF, 0x8001, 0x0000, 0x0003,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x000D, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0011, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8007,
+    0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x0008,
+    0xFFFF, 0x8001, 0x0000, 0x0003, 0x1107, 0x0008, 0xFFFF, 0x8001, 0x0000, 0x0007,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0015, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x0008,
+    0xFFFF, 0x8001, 0x0000, 0x0003, 0x1107, 0x0008, 0xFFFF, 0x8001, 0x0000, 0x00DD,
+    0x1107, 0x002A, 0x18C5, 0x0013, 0x1107, 0x0005, 0x0000, 0x8006, 0xFFFF, 0xFFFF,
+    0x1107, 0x1107, 0xFFFF, 0xFFFF, 0x0007, 0x0000, 0x0003, 0x1107, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1107, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x0000, 0x0003,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x000D, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0011, 0x1107, 0x000A, 0xFFFF, 0x8005, 0x0000, 0x1107, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1107, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x0000, 0x0003, 0x1107,
+    0x8006, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0003, 0x0000, 0x0007,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0015, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8002,
+    0xFFFF, 0xFFFF, 0x0007, 0x0000, 0x0003, 0x1107, 0x8002, 0xFFFF, 0xFFFF, 0x0007,
+    0x0000, 0x00DD, 0x1107, 0x002A, 0x18C5, 0x0018, 0x1107, 0x8007, 0xFFFF, 0xFFFF,
+    0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x000D, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0011,
+    0x1107, 0x000A, 0xFFFF, 0x8005, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8007, 0xFFFF, 0xFFFF,
+    0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0015, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x00E4, 0x1107, 0x0028, 0x18C5, 0x0019,
+    0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8002,
+    0xFFFF, 0xFFFF, 0x0006, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0011, 0x1107,
+    0x8002, 0xFFFF, 0xFFFF, 0x0006, 0x0000, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1107, 0x8008, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0x1107, 0x0000, 0xFFFF, 0xFFFF,
+    0x0008, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0015, 0x1107, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x00E4, 0x1107, 0x0028, 0x18C5, 0x0019, 0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000,
+    0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0011, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0005, 0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000,
+    0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0003, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0007, 0x1107,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0015, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x00E6, 0x1107,
+    0x0024, 0x18C5, 0x0013, 0x1107, 0x0008, 0xFFFF, 0x8004, 0x1107, 0x0000, 0x0000,
+    0x1107, 0x000A, 0xFFFF, 0x8002, 0x1107, 0x1107, 0x000A, 0xFFFF, 0x8002, 0x1107,
+    0x1107, 0x000A, 0xFFFF, 0x0003, 0x1107, 0x8001, 0x0000, 0x0006, 0xFFFF, 0x8003,
+    0x1107, 0x0000, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0011,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8004, 0xFFFF, 0xFFFF,
+    0x0000, 0x1107, 0x000A, 0xFFFF, 0x8002, 0x1107, 0x1107, 0x000A, 0xFFFF, 0x8005,
+    0x1107, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0004, 0x1107, 0x8003, 0x0000, 0xFFFF,
+    0xFFFF, 0x0006, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0015, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x000A, 0xFFFF, 0x0116,
+    0x1107, 0x0008, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1107, 0x000A, 0xFFFF, 0x8002,
+    0x0000, 0x1107, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x1107, 0x000A, 0xFFFF, 0x8001,
+    0x0000, 0x0003, 0x1107, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0007, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0011, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8004, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0x000A, 0xFFFF, 0x8002, 0x0000,
+    0x1107, 0x000A, 0xFFFF, 0x8005, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0015, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1107, 0x000A, 0xFFFF, 0x8001, 0x0000, 0x010B, 0x1107, 0x000B, 0x1106, 0x0008,
+    0x0000, 0x0004, 0x1106, 0x000A, 0x0000, 0x8002, 0x1106, 0x1106, 0x000A, 0x0000,
+    0x8002, 0x1106, 0x1106, 0x000A, 0x0000, 0x0004, 0x1106, 0x0006, 0x0000, 0x0008,
+    0x1106, 0x8002, 0x0000, 0x0000, 0x0012, 0x1106, 0x8002, 0x0000, 0x0000, 0x0006,
+    0x1106, 0x8004, 0x0000, 0x0000, 0x1106, 0x1106, 0x000A, 0x0000, 0x8002, 0x1106,
+    0x1106, 0x000A, 0x0000, 0x8004, 0x1106, 0x1106, 0x0000, 0x0000, 0x0006, 0x1106,
+    0x8002, 0x0000, 0x0000, 0x0006, 0x1106, 0x8002, 0x0000, 0x0000, 0x0016, 0x1106,
+    0x8002, 0x0000, 0x0000, 0x000A, 0x1106, 0x8002, 0x0000, 0x0000, 0x0006, 0x1106,
+    0x8002, 0x0000, 0x0000, 0x000A, 0x1106, 0x000A, 0x0000, 0x06AB, 0x1106, 0x0F00,
+    0x10E6, 0x01E0, 0x04B9, 0x01E0, 0x06BF, 0x01E0, 0x04B9, 0x7FFF, 0x0861, 0x7FFF,
+    0x0861, 0x7FFF, 0x0861, 0x4983, 0x0861, 0x01E0, 0x2988, 0x168B, 0x0083, 0x0003,
+    0x63B1, 0x0008, 0x0083, 0x0004, 0x63B1, 0x0008, 0x0083, 0x8001, 0x63B1, 0x0003,
+    0x0083, 0x8001, 0x63B1, 0x0020, 0x0083, 0x0004, 0x63B1, 0x0008, 0x0083, 0x8002,
+    0x63B1, 0x63B1, 0x000A, 0x0083, 0x0003, 0x63B1, 0x0009, 0x0083, 0x0003, 0x63B1,
+    0x000A, 0x0083, 0x8002, 0x63B1, 0x63B1, 0x000E, 0x0083, 0x0003, 0x63B1, 0x0009,
+    0x0083, 0x8001, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1, 0x0008, 0x0083, 0x8002,
+    0x63B1, 0x63B1, 0x0147, 0x0083, 0x8001, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1,
+    0x0005, 0x0083, 0x8003, 0x63B1, 0x0083, 0x63B1, 0x0003, 0x0083, 0x8005, 0x63B1,
+    0x0083, 0x0083, 0x63B1, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1, 0x0003, 0x0083,
+    0x8001, 0x63B1, 0x0014, 0x0083, 0x8003, 0x63B1, 0x0083, 0x63B1, 0x0003, 0x0083,
+    0x8002, 0x63B1, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1, 0x000D, 0x0083, 0x8001,
+    0x63B1, 0x0009, 0x0083, 0x8001, 0x63B1, 0x0003, 0x0083, 0x8005, 0x63B1, 0x0083,
+    0x0083, 0x63B1, 0x63B1, 0x0005, 0x0083, 0x8001, 0x63B1, 0x000A, 0x0083, 0x8004,
+    0x63B1, 0x0083, 0x0083, 0x63B1, 0x000D, 0x0083, 0x8004, 0x63B1, 0x0083, 0x0083,
+    0x63B1, 0x0003, 0x0083, 0x8002, 0x63B1, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1,
+    0x0003, 0x0083, 0x8001, 0x63B1, 0x0009, 0x0083, 0x8001, 0x63B1, 0x0147, 0x0083,
+    0x8001, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1, 0x0004, 0x0083, 0x8004, 0x63B1,
+    0x0083, 0x0083, 0x63B1, 0x0003, 0x0083, 0x8005, 0x63B1, 0x0083, 0x0083, 0x63B1,
+    0x63B1, 0x0003, 0x0083, 0x8007, 0x63B1, 0x63B1, 0x0083, 0x0083, 0x63B1, 0x0083,
+    0x0083, 0x0003, 0x63B1, 0x8003, 0x0083, 0x0083, 0x63B1, 0x0003, 0x0083, 0x8001,
+    0x63B1, 0x0009, 0x0083, 0x8001, 0x63B1, 0x0004, 0x0083, 0x8002, 0x63B1, 0x63B1,
+    0x0003, 0x0083, 0x8001, 0x63B1, 0x0006, 0x0083, 0x0003, 0x63B1, 0x0004, 0x0083,
+    0x8001, 0x63B1, 0x0009, 0x0083, 0x8001, 0x63B1, 0x0006, 0x0083, 0x8002, 0x63B1,
+    0x63B1, 0x0005, 0x0083, 0x8001, 0x63B1, 0x0003, 0x0083, 0x8004, 0x63B1, 0x0083,
+    0x63B1, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1, 0x0005, 0x0083, 0x0003, 0x63B1,
+    0x0008, 0x0083, 0x8001, 0x63B1, 0x0003, 0x0083, 0x8005, 0x63B1, 0x0083, 0x0083,
+    0x63B1, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1, 0x0003, 0x0083, 0x8003, 0x63B1,
+    0x0083, 0x0083, 0x0003, 0x63B1, 0x0004, 0x0083, 0x8001, 0x63B1, 0x0003, 0x0083,
+    0x0004, 0x63B1, 0x0140, 0x0083, 0x8001, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1,
+    0x0003, 0x0083, 0x8001, 0x63B1, 0x0003, 0x0083, 0x0004, 0x63B1, 0x0008, 0x0083,
+    0x8005, 0x63B1, 0x0083, 0x63B1, 0x0083, 0x63B1, 0x0005, 0x0083, 0x8003, 0x63B1,
+    0x0083, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1, 0x0007, 0x0083, 0x0005, 0x63B1,
+    0x0008, 0x0083, 0x0003, 0x63B1, 0x8003, 0x0083, 0x0083, 0x63B1, 0x0003, 0x0083,
+    0x8001, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1, 0x0009, 0x0083, 0x8001, 0x63B1,
+    0x000D, 0x0083, 0x8001, 0x63B1, 0x0003, 0x0083, 0x8006, 0x63B1, 0x63B1, 0x0083,
+    0x0083, 0x63B1, 0x0083, 0x0003, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1, 0x0003,
+    0x0083, 0x8001, 0x63B1, 0x0007, 0x0083, 0x8001, 0x63B1, 0x0003, 0x0083, 0x8001,
+    0x63B1, 0x0007, 0x0083, 0x0005, 0x63B1, 0x8002, 0x0083, 0x63B1, 0x0003, 0x0083,
+    0x8001, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1, 0x0003, 0x0083, 0x8001, 0x63B1,
+    0x0003, 0x0083, 0x8001, 0x63B1, 0x0135, 0x0083, 0x000A, 0x0062, 0x0005, 0x63B1,
+    0x8003, 0x0062, 0x0062, 0x63B1, 0x0004, 0x0062, 0x8001, 0x63B1, 0x0003, 0x0062,
+    0x8005, 0x63B1, 0x0062, 0x0062, 0x63B1, 0x63B1, 0x0003, 0x0062, 0x8007, 0x63B1,
+    0x0062, 0x0062, 0x63B1, 0x63B1, 0x0062, 0x0062, 0x0004, 0x63B1, 0x8002, 0x0062,
+    0x63B1, 0x0003, 0x0062, 0x8001, 0x63B1, 0x0009, 0x0062, 0x8001, 0x63B1, 0x0004,
+    0x0062, 0x8002, 0x63B1, 0x63B1, 0x0007, 0x0062, 0x8002, 0x63B1, 0x0062, 0x0005,
+    0x63B1, 0x0003, 0x0062, 0x8001, 0x63B1, 0x0009, 0x0062, 0x8001, 0x63B1, 0x0006,
+    0x0062, 0x8002, 0x63B1, 0x63B1, 0x0005, 0x0062, 0x8001, 0x63B1, 0x0003, 0x0062,
+    0x8001, 0x63B1, 0x0003, 0x0062, 0x8004, 0x63B1, 0x0062, 0x0062, 0x63B1, 0x0004,
+    0x0062, 0x8001, 0x63B1, 0x0003, 0x0062, 0x8001, 0x63B1, 0x0007, 0x0062, 0x8001,
+    0x63B1, 0x0003, 0x0062, 0x8005, 0x63B1, 0x0062, 0x0062, 0x63B1, 0x63B1, 0x0003,
+    0x0062, 0x8001, 0x63B1, 0x0003, 0x0062, 0x8002, 0x63B1, 0x0062, 0x0005, 0x63B1,
+    0x0003, 0x0062, 0x8001, 0x63B1, 0x0003, 0x0062, 0x0004, 0x63B1, 0x0140, 0x0062,
+    0x8001, 0x63B1, 0x0003, 0x0062, 0x8003, 0x63B1, 0x0062, 0x63B1, 0x0005, 0x0062,
+    0x8001, 0x63B1, 0x0003, 0x0062, 0x8005, 0x63B1, 0x0062, 0x0062, 0x63B1, 0x63B1,
+    0x0003, 0x0062, 0x8001, 0x63B1, 0x0003, 0x0062, 0x8003, 0x63B1, 0x0062, 0x63B1,
+    0x0003, 0x0062, 0x8006, 0x63B1, 0x0062, 0x0062, 0x63B1, 0x0062, 0x63B1, 0x0009,
+    0x0062, 0x8003, 0x63B1, 0x0062, 0x63B1, 0x0003, 0x0062, 0x8002, 0x63B1, 0x63B1,
+    0x0007, 0x0062, 0x8003, 0x63B1, 0x0062, 0x63B1, 0x0007, 0x0062, 0x8001, 0x63B1,
+    0x0009, 0x0062, 0x8001, 0x63B1, 0x0003, 0x0062, 0x8005, 0x63B1, 0x0062, 0x0062,
+    0x63B1, 0x63B1, 0x0005, 0x0062, 0x8001, 0x63B1, 0x0003, 0x0062, 0x8001, 0x63B1,
+    0x0003, 0x0062, 0x8004, 0x63B1, 0x0062, 0x0062, 0x63B1, 0x0004, 0x0062, 0x8001,
+    0x63B1, 0x0003, 0x0062, 0x8001, 0x63B1, 0x0007, 0x0062, 0x8004, 0x63B1, 0x0062,
+    0x0062, 0x63B1, 0x0003, 0x0062, 0x8002, 0x63B1, 0x63B1, 0x0003, 0x0062, 0x8001,
+    0x63B1, 0x0003, 0x0062, 0x8003, 0x63B1, 0x0062, 0x63B1, 0x0007, 0x0062, 0x8001,
+    0x63B1, 0x0003, 0x0062, 0x8001, 0x63B1, 0x0143, 0x0062, 0x8001, 0x63B1, 0x0003,
+    0x0062, 0x8001, 0x63B1, 0x0007, 0x0062, 0x0004, 0x63B1, 0x0008, 0x0062, 0x8001,
+    0x63B1, 0x0003, 0x0062, 0x8003, 0x63B1, 0x0062, 0x0062, 0x0004, 0x63B1, 0x0003,
+    0x0062, 0x8001, 0x63B1, 0x0015, 0x0062, 0x0004, 0x63B1, 0x0003, 0x0062, 0x0003,
+    0x63B1, 0x0003, 0x0062, 0x0003, 0x63B1, 0x0009, 0x0062, 0x0003, 0x63B1, 0x0009,
+    0x0062, 0x0003, 0x63B1, 0x8003, 0x0062, 0x0062, 0x63B1, 0x0003, 0x0062, 0x8004,
+    0x63B1, 0x0062, 0x0062, 0x63B1, 0x0005, 0x0062, 0x0003, 0x63B1, 0x0008, 0x0062,
+    0x0003, 0x63B1, 0x0009, 0x0062, 0x8001, 0x63B1, 0x0003, 0x0062, 0x8003, 0x63B1,
+    0x0062, 0x0062, 0x0003, 0x63B1, 0x0003, 0x0062, 0x0003, 0x63B1, 0x8003, 0x0062,
+    0x0062, 0x63B1, 0x1999, 0x0062,
+};
+constexpr lifeline::PanelImage MENU = {480, 320, MENU_WORDS, 2294};
+constexpr lifeline::FieldRect MENU_ID = {436, 12, 23, 7};
+constexpr lifeline::FieldRect MENU_RANGE = {10, 50, 47, 7};
+constexpr lifeline::FieldRect MENU_LIST = {10, 68, 460, 167};
+
+// CONFIRM: 6308 bytes (2.1% of 300 KB raw)
+constexpr uint16_t CONFIRM_WORDS[] = {
+    0x03C0, 0x3960, 0x01E0, 0x3980, 0x01E0, 0x4180, 0x01E0, 0x41A0, 0x01E0, 0x49A0,
+    0x01E0, 0x49C0, 0x03C0, 0x51E0, 0x01E0, 0x5200, 0x01E0, 0x5A00, 0x01E0, 0x5A20,
+    0x01E0, 0x6220, 0x01E0, 0x6240, 0x002A, 0x6A60, 0x0006, 0x0841, 0x0006, 0x6A60,
+    0x0006, 0x0841, 0x0004, 0x6A60, 0x8002, 0x0841, 0x0841, 0x0006, 0x6A60, 0x8004,
+    0x0841, 0x0841, 0x6A60, 0x6A60, 0x000A, 0x0841, 0x0004, 0x6A60, 0x0006, 0x0841,
+    0x0004, 0x6A60, 0x0008, 0x0841, 0x0004, 0x6A60, 0x8002, 0x0841, 0x0841, 0x0006,
+    0x6A60, 0x8002, 0x0841, 0x0841, 0x000E, 0x6A60, 0x000A, 0x0841, 0x8002, 0x6A60,
+    0x6A60, 0x0008, 0x0841, 0x0006, 0x6A60, 0x0006, 0x0841, 0x0004, 0x6A60, 0x8002,
+    0x0841, 0x0841, 0x0006, 0x6A60, 0x8002, 0x0841, 0x0841, 0x0004, 0x6A60, 0x0008,
+    0x0841, 0x8004, 0x6A60, 0x6A60, 0x0841, 0x0841, 0x0006, 0x6A60, 0x8002, 0x0841,
+    0x0841, 0x0004, 0x6A60, 0x0006, 0x0841, 0x0006, 0x6A60, 0x0008, 0x0841, 0x0004,
+    0x6A60, 0x0008, 0x0841, 0x0004, 0x6A60, 0x0006, 0x0841, 0x0006, 0x6A60, 0x0006,
+    0x0841, 0x0004, 0x6A60, 0x8002, 0x0841, 0x0841, 0x0006, 0x6A60, 0x8002, 0x0841,
+    0x0841, 0x00F4, 0x6A60, 0x0006, 0x0841, 0x0006, 0x6A60, 0x0006, 0x0841, 0x0004,
+    0x6A60, 0x8002, 0x0841, 0x0841, 0x0006, 0x6A60, 0x8004, 0x0841, 0x0841, 0x6A60,
+    0x6A60, 0x000A, 0x0841, 0x0004, 0x6A60, 0x0006, 0x0841, 0x0004, 0x6A60, 0x0008,
+    0x0841, 0x0004, 0x6A60, 0x8002, 0x0841, 0x0841, 0x0006, 0x6A60, 0x8002, 0x0841,
+    0x0841, 0x000E, 0x6A60, 0x000A, 0x0841, 0x8002, 0x6A60, 0x6A60, 0x0008, 0x0841,
+    0x0006, 0x6A60, 0x0006, 0x0841, 0x0004, 0x6A60, 0x8002, 0x0841, 0x0841, 0x0006,
+    0x6A60, 0x8002, 0x0841, 0x0841, 0x0004, 0x6A60, 0x0008, 0x0841, 0x8004, 0x6A60,
+    0x6A60, 0x0841, 0x0841, 0x0006, 0x6A60, 0x8002, 0x0841, 0x0841, 0x0004, 0x6A60,
+    0x0006, 0x0841, 0x0006, 0x6A60, 0x0008, 0x0841, 0x0004, 0x6A60, 0x0008, 0x0841,
+    0x0004, 0x6A60, 0x0006, 0x0841, 0x0006, 0x6A60, 0x0006, 0x0841, 0x0004, 0x6A60,
+    0x8002, 0x0841, 0x0841, 0x0006, 0x6A60, 0x8002, 0x0841, 0x0841, 0x00CA, 0x6A60,
+    0x0028, 0x6A80, 0x8002, 0x0841, 0x0841, 0x0006, 0x6A80, 0x8006, 0x0841, 0x0841,
+    0x6A80, 0x6A80, 0x0841, 0x0841, 0x0006, 0x6A80, 0x8006, 0x0841, 0x0841, 0x6A80,
+    0x6A80, 0x0841, 0x0841, 0x0006, 0x6A80, 0x8006, 0x0841, 0x0841, 0x6A80, 0x6A80,
+    0x0841, 0x0841, 0x000E, 0x6A80, 0x8002, 0x0841, 0x0841, 0x0006, 0x6A80, 0x8002,
+    0x0841, 0x0841, 0x0006, 0x6A80, 0x8004, 0x0841, 0x0841, 0x6A80, 0x6A80, 0x0004,
+    0x0841, 0x8002, 0x6A80, 0x6A80, 0x0004, 0x0841, 0x0012, 0x6A80, 0x8002, 0x0841,
+    0x0841, 0x0006, 0x6A80, 0x8002, 0x0841, 0x0841, 0x0006, 0x6A80, 0x8006, 0x0841,
+    0x0841, 0x6A80, 0x6A80, 0x0841, 0x0841, 0x0006, 0x6A80, 0x8006, 0x0841, 0x0841,
+    0x6A80, 0x6A80, 0x0841, 0x0841, 0x0006, 0x6A80, 0x8006, 0x0841, 0x0841, 0x6A80,
+    0x6A80, 0x0841, 0x0841, 0x000A, 0x6A80, 0x0004, 0x0841, 0x8002, 0x6A80, 0x6A80,
+    0x0004, 0x0841, 0x0006, 0x6A80, 0x8002, 0x0841, 0x0841, 0x0006, 0x6A80, 0x8002,
+    0x0841, 0x0841, 0x000A, 0x6A80, 0x8002, 0x0841, 0x0841, 0x000E, 0x6A80, 0x8002,
+    0x0841, 0x0841, 0x0006, 0x6A80, 0x8002, 0x0841, 0x0841, 0x0006, 0x6A80, 0x8006,
+    0x0841, 0x0841, 0x6A80, 0x6A80, 0x0841, 0x0841, 0x0006, 0x6A80, 0x8002, 0x0841,
+    0x0841, 0x00CA, 0x6A80, 0x0028, 0x7280, 0x8002, 0x0841, 0x0841, 0x0006, 0x7280,
+    0x8006, 0x0841, 0x0841, 0x7280, 0x7280, 0x0841, 0x0841, 0x0006, 0x7280, 0x8006,
+    0x0841, 0x0841, 0x7280, 0x7280, 0x0841, 0x0841, 0x0006, 0x7280, 0x8006, 0x0841,
+    0x0841, 0x7280, 0x7280, 0x0841, 0x0841, 0x000E, 0x7280, 0x8002, 0x0841, 0x0841,
+    0x0006, 0x7280, 0x8002, 0x0841, 0x0841, 0x0006, 0x7280, 0x8004, 0x0841, 0x0841,
+    0x7280, 0x7280, 0x0004, 0x0841, 0x8002, 0x7280, 0x7280, 0x0004, 0x0841, 0x0012,
+    0x7280, 0x8002, 0x0841, 0x0841, 0x0006, 0x7280, 0x8002, 0x0841, 0x0841, 0x0006,
+    0x7280, 0x8006, 0x0841, 0x0841, 0x7280, 0x7280, 0x0841, 0x0841, 0x0006, 0x7280,
+    0x8006, 0x0841, 0x0841, 0x7280, 0x7280, 0x0841, 0x0841, 0x0006, 0x7280, 0x8006,
+    0x0841, 0x0841, 0x7280, 0x7280, 0x0841, 0x0841, 0x000A, 0x7280, 0x0004, 0x0841,
+    0x8002, 0x7280, 0x7280, 0x0004, 0x0841, 0x0006, 0x7280, 0x8002, 0x0841, 0x0841,
+    0x0006, 0x7280, 0x8002, 0x0841, 0x0841, 0x000A, 0x7280, 0x8002, 0x0841, 0x0841,
+    0x000E, 0x7280, 0x8002, 0x0841, 0x0841, 0x0006, 0x7280, 0x8002, 0x0841, 0x0841,
+    0x0006, 0x7280, 0x8006, 0x0841, 0x0841, 0x7280, 0x7280, 0x0841, 0x0841, 0x0006,
+    0x7280, 0x8002, 0x0841, 0x0841, 0x00CA, 0x7280, 0x0028, 0x72A0, 0x8002, 0x0841,
+    0x0841, 0x000A, 0x72A0, 0x8002, 0x0841, 0x0841, 0x0006, 0x72A0, 0x8004, 0x0841,
+    0x0841, 0x72A0, 0x72A0, 0x0004, 0x0841, 0x0004, 0x72A0, 0x8006, 0x0841, 0x0841,
+    0x72A0, 0x72A0, 0x0841, 0x0841, 0x000E, 0x72A0, 0x8002, 0x0841, 0x0841, 0x0006,
+    0x72A0, 0x8002, 0x0841, 0x0841, 0x0006, 0x72A0, 0x800E, 0x0841, 0x0841, 0x72A0,
+    0x72A0, 0x0841, 0x0841, 0x72A0, 0x72A0, 0x0841, 0x0841, 0x72A0, 0x72A0, 0x0841,
+    0x0841, 0x0012, 0x72A0, 0x8002, 0x0841, 0x0841, 0x0006, 0x72A0, 0x8002, 0x0841,
+    0x0841, 0x0006, 0x72A0, 0x8006, 0x0841, 0x0841, 0x72A0, 0x72A0, 0x0841, 0x0841,
+    0x0006, 0x72A0, 0x8004, 0x0841, 0x0841, 0x72A0, 0x72A0, 0x0004, 0x0841, 0x0004,
+    0x72A0, 0x8006, 0x0841, 0x0841, 0x72A0, 0x72A0, 0x0841, 0x0841, 0x000A, 0x72A0,
+    0x800A, 0x0841, 0x0841, 0x72A0, 0x72A0, 0x0841, 0x0841, 0x72A0, 0x72A0, 0x0841,
+    0x0841, 0x0006, 0x72A0, 0x8002, 0x0841, 0x0841, 0x0006, 0x72A0, 0x8002, 0x0841,
+    0x0841, 0x000A, 0x72A0, 0x8002, 0x0841, 0x0841, 0x000E, 0x72A0, 0x8002, 0x0841,
+    0x0841, 0x0006, 0x72A0, 0x8002, 0x0841, 0x0841, 0x0006, 0x72A0, 0x8004, 0x0841,
+    0x0841, 0x72A0, 0x72A0, 0x0004, 0x0841, 0x0004, 0x72A0, 0x8002, 0x0841, 0x0841,
+    0x00CA, 0x72A0, 0x0028, 0x7AA0, 0x8002, 0x0841, 0x0841, 0x000A, 0x7AA0, 0x8002,
+    0x0841, 0x0841, 0x0006, 0x7AA0, 0x8004, 0x0841, 0x0841, 0x7AA0, 0x7AA0, 0x0004,
+    0x0841, 0x0004, 0x7AA0, 0x8006, 0x0841, 0x0841, 0x7AA0, 0x7AA0, 0x0841, 0x0841,
+    0x000E, 0x7AA0, 0x8002, 0x0841, 0x0841, 0x0006, 0x7AA0, 0x8002, 0x0841, 0x0841,
+    0x0006, 0x7AA0, 0x800E, 0x0841, 0x0841, 0x7AA0, 0x7AA0, 0x0841, 0x0841, 0x7AA0,
+    0x7AA0, 0x0841, 0x0841, 0x7AA0, 0x7AA0, 0x0841, 0x0841, 0x0012, 0x7AA0, 0x8002,
+    0x0841, 0x0841, 0x0006, 0x7AA0, 0x8002, 0x0841, 0x0841, 0x0006, 0x7AA0, 0x8006,
+    0x0841, 0x0841, 0x7AA0, 0x7AA0, 0x0841, 0x0841, 0x0006, 0x7AA0, 0x8004, 0x0841,
+    0x0841, 0x7AA0, 0x7AA0, 0x0004, 0x0841, 0x0004, 0x7AA0, 0x8006, 0x0841, 0x0841,
+    0x7AA0, 0x7AA0, 0x0841, 0x0841, 0x000A, 0x7AA0, 0x800A, 0x0841, 0x0841, 0x7AA0,
+    0x7AA0, 0x0841, 0x0841, 0x7AA0, 0x7AA0, 0x0841, 0x0841, 0x0006, 0x7AA0, 0x8002,
+    0x0841, 0x0841, 0x0006, 0x7AA0, 0x8002, 0x0841, 0x0841, 0x000A, 0x7AA0, 0x8002,
+    0x0841, 0x0841, 0x000E, 0x7AA0, 0x8002, 0x0841, 0x0841, 0x0006, 0x7AA0, 0x8002,
+    0x0841, 0x0841, 0x0006, 0x7AA0, 0x8004, 0x0841, 0x0841, 0x7AA0, 0x7AA0, 0x0004,
+    0x0841, 0x0004, 0x7AA0, 0x8002, 0x0841, 0x0841, 0x00CA, 0x7AA0, 0x0028, 0x7AC0,
+    0x8002, 0x0841, 0x0841, 0x000A, 0x7AC0, 0x8002, 0x0841, 0x0841, 0x0006, 0x7AC0,
+    0x8010, 0x0841, 0x0841, 0x7AC0, 0x7AC0, 0x0841, 0x0841, 0x7AC0, 0x7AC0, 0x0841,
+    0x0841, 0x7AC0, 0x7AC0, 0x0841, 0x0841, 0x7AC0, 0x7AC0, 0x0006, 0x0841, 0x000A,
+    0x7AC0, 0x8002, 0x0841, 0x0841, 0x0006, 0x7AC0, 0x0008, 0x0841, 0x0004, 0x7AC0,
+    0x8002, 0x0841, 0x0841, 0x0006, 0x7AC0, 0x8002, 0x0841, 0x0841, 0x0012, 0x7AC0,
+    0x8002, 0x0841, 0x0841, 0x0006, 0x7AC0, 0x0008, 0x0841, 0x0004, 0x7AC0, 0x8002,
+    0x0841, 0x0841, 0x0006, 0x7AC0, 0x800E, 0x0841, 0x0841, 0x7AC0, 0x7AC0, 0x0841,
+    0x0841, 0x7AC0, 0x7AC0, 0x0841, 0x0841, 0x7AC0, 0x7AC0, 0x0841, 0x0841, 0x0004,
+    0x7AC0, 0x0006, 0x0841, 0x0004, 0x7AC0, 0x8002, 0x0841, 0x0841, 0x0006, 0x7AC0,
+    0x8002, 0x0841, 0x0841, 0x0006, 0x7AC0, 0x8002, 0x0841, 0x0841, 0x0008, 0x7AC0,
+    0x0006, 0x0841, 0x0006, 0x7AC0, 0x0006, 0x0841, 0x0008, 0x7AC0, 0x8002, 0x0841,
+    0x0841, 0x0006, 0x7AC0, 0x8002, 0x0841, 0x0841, 0x0006, 0x7AC0, 0x800E, 0x0841,
+    0x0841, 0x7AC0, 0x7AC0, 0x0841, 0x0841, 0x7AC0, 0x7AC0, 0x0841, 0x0841, 0x7AC0,
+    0x7AC0, 0x0841, 0x0841, 0x00CA, 0x7AC0, 0x0028, 0x82E0, 0x8002, 0x0841, 0x0841,
+    0x000A, 0x82E0, 0x8002, 0x0841, 0x0841, 0x0006, 0x82E0, 0x8010, 0x0841, 0x0841,
+    0x82E0, 0x82E0, 0x0841, 0x0841, 0x82E0, 0x82E0, 0x0841, 0x0841, 0x82E0, 0x82E0,
+    0x0841, 0x0841, 0x82E0, 0x82E0, 0x0006, 0x0841, 0x000A, 0x82E0, 0x8002, 0x0841,
+    0x0841, 0x0006, 0x82E0, 0x0008, 0x0841, 0x0004, 0x82E0, 0x8002, 0x0841, 0x0841,
+    0x0006, 0x82E0, 0x8002, 0x0841, 0x0841, 0x0012, 0x82E0, 0x8002, 0x0841, 0x0841,
+    0x0006, 0x82E0, 0x0008, 0x0841, 0x0004, 0x82E0, 0x8002, 0x0841, 0x0841, 0x0006,
+    0x82E0, 0x800E, 0x0841, 0x0841, 0x82E0, 0x82E0, 0x0841, 0x0841, 0x82E0, 0x82E0,
+    0x0841, 0x0841, 0x82E0, 0x82E0, 0x0841, 0x0841, 0x0004, 0x82E0, 0x0006, 0x0841,
+    0x0004, 0x82E0, 0x8002, 0x0841, 0x0841, 0x0006, 0x82E0, 0x8002, 0x0841, 0x0841,
+    0x0006, 0x82E0, 0x8002, 0x0841, 0x0841, 0x0008, 0x82E0, 0x0006, 0x0841, 0x0006,
+    0x82E0, 0x0006, 0x0841, 0x0008, 0x82E0, 0x8002, 0x0841, 0x0841, 0x0006, 0x82E0,
+    0x8002, 0x0841, 0x0841, 0x0006, 0x82E0, 0x800E, 0x0841, 0x0841, 0x82E0, 0x82E0,
+    0x0841, 0x0841, 0x82E0, 0x82E0, 0x0841, 0x0841, 0x82E0, 0x82E0, 0x0841, 0x0841,
+    0x00F2, 0x82E0, 0x8002, 0x0841, 0x0841, 0x000A, 0x82E0, 0x8002, 0x0841, 0x0841,
+    0x0006, 0x82E0, 0x8006, 0x0841, 0x0841, 0x82E0, 0x82E0, 0x0841, 0x0841, 0x0004,
+    0x82E0, 0x0004, 0x0841, 0x8004, 0x82E0, 0x82E0, 0x0841, 0x0841, 0x000E, 0x82E0,
+    0x8002, 0x0841, 0x0841, 0x0006, 0x82E0, 0x8006, 0x0841, 0x0841, 0x82E0, 0x82E0,
+    0x0841, 0x0841, 0x0006, 0x82E0, 0x8002, 0x0841, 0x0841, 0x0006, 0x82E0, 0x8002,
+    0x0841, 0x0841, 0x0012, 0x82E0, 0x8002, 0x0841, 0x0841, 0x0006, 0x82E0, 0x8006,
+    0x0841, 0x0841, 0x82E0, 0x82E0, 0x0841, 0x0841, 0x0006, 0x82E0, 0x000A, 0x0841,
+    0x8004, 0x82E0, 0x82E0, 0x0841, 0x0841, 0x0004, 0x82E0, 0x0004, 0x0841, 0x000A,
+    0x82E0, 0x8006, 0x0841, 0x0841, 0x82E0, 0x82E0, 0x0841, 0x0841, 0x0006, 0x82E0,
+    0x8002, 0x0841, 0x0841, 0x0006, 0x82E0, 0x8002, 0x0841, 0x0841, 0x000E, 0x82E0,
+    0x8002, 0x0841, 0x0841, 0x000A, 0x82E0, 0x8002, 0x0841, 0x0841, 0x0006, 0x82E0,
+    0x8002, 0x0841, 0x0841, 0x0006, 0x82E0, 0x8002, 0x0841, 0x0841, 0x0006, 0x82E0,
+    0x8006, 0x0841, 0x0841, 0x82E0, 0x82E0, 0x0841, 0x0841, 0x0004, 0x82E0, 0x0004,
+    0x0841, 0x00CA, 0x82E0, 0x0028, 0x8300, 0x8002, 0x0841, 0x0841, 0x000A, 0x8300,
+    0x8002, 0x0841, 0x0841, 0x0006, 0x8300, 0x8006, 0x0841, 0x0841, 0x8300, 0x8300,
+    0x0841, 0x0841, 0x0004, 0x8300, 0x0004, 0x0841, 0x8004, 0x8300, 0x8300, 0x0841,
+    0x0841, 0x000E, 0x8300, 0x8002, 0x0841, 0x0841, 0x0006, 0x8300, 0x8006, 0x0841,
+    0x0841, 0x8300, 0x8300, 0x0841, 0x0841, 0x0006, 0x8300, 0x8002, 0x0841, 0x0841,
+    0x0006, 0x8300, 0x8002, 0x0841, 0x0841, 0x0012, 0x8300, 0x8002, 0x0841, 0x0841,
+    0x0006, 0x8300, 0x8006, 0x0841, 0x0841, 0x8300, 0x8300, 0x0841, 0x0841, 0x0006,
+    0x8300, 0x000A, 0x0841, 0x8004, 0x8300, 0x8300, 0x0841, 0x0841, 0x0004, 0x8300,
+    0x0004, 0x0841, 0x000A, 0x8300, 0x8006, 0x0841, 0x0841, 0x8300, 0x8300, 0x0841,
+    0x0841, 0x0006, 0x8300, 0x8002, 0x0841, 0x0841, 0x0006, 0x8300, 0x8002, 0x0841,
+    0x0841, 0x000E, 0x8300, 0x8002, 0x0841, 0x0841, 0x000A, 0x8300, 0x8002, 0x0841,
+    0x0841, 0x0006, 0x8300, 0x8002, 0x0841, 0x0841, 0x0006, 0x8300, 0x8002, 0x0841,
+    0x0841, 0x0006, 0x8300, 0x8006, 0x0841, 0x0841, 0x8300, 0x8300, 0x0841, 0x0841,
+    0x0004, 0x8300, 0x0004, 0x0841, 0x00CA, 0x8300, 0x0028, 0x8B00, 0x8002, 0x0841,
+    0x0841, 0x0006, 0x8B00, 0x8006, 0x0841, 0x0841, 0x8B00, 0x8B00, 0x0841, 0x0841,
+    0x0006, 0x8B00, 0x8006, 0x0841, 0x0841, 0x8B00, 0x8B00, 0x0841, 0x0841, 0x0006,
+    0x8B00, 0x8006, 0x0841, 0x0841, 0x8B00, 0x8B00, 0x0841, 0x0841, 0x000E, 0x8B00,
+    0x8002, 0x0841, 0x0841, 0x0006, 0x8B00, 0x8002, 0x0841, 0x0841, 0x0004, 0x8B00,
+    0x8002, 0x0841, 0x0841, 0x0004, 0x8B00, 0x8002, 0x0841, 0x0841, 0x0006, 0x8B00,
+    0x8002, 0x0841, 0x0841, 0x0012, 0x8B00, 0x8002, 0x0841, 0x0841, 0x0006, 0x8B00,
+    0x8002, 0x0841, 0x0841, 0x0004, 0x8B00, 0x8002, 0x0841, 0x0841, 0x0004, 0x8B00,
+    0x8002, 0x0841, 0x0841, 0x0006, 0x8B00, 0x8006, 0x0841, 0x0841, 0x8B00, 0x8B00,
+    0x0841, 0x0841, 0x0006, 0x8B00, 0x8002, 0x0841, 0x0841, 0x000A, 0x8B00, 0x8006,
+    0x0841, 0x0841, 0x8B00, 0x8B00, 0x0841, 0x0841, 0x0006, 0x8B00, 0x8002, 0x0841,
+    0x0841, 0x0006, 0x8B00, 0x8002, 0x0841, 0x0841, 0x000E, 0x8B00, 0x8002, 0x0841,
+    0x0841, 0x000A, 0x8B00, 0x8002, 0x0841, 0x0841, 0x0006, 0x8B00, 0x8002, 0x0841,
+    0x0841, 0x0006, 0x8B00, 0x8002, 0x0841, 0x0841, 0x0006, 0x8B00, 0x8006, 0x0841,
+    0x0841, 0x8B00, 0x8B00, 0x0841, 0x0841, 0x0006, 0x8B00, 0x8002, 0x0841, 0x0841,
+    0x00CA, 0x8B00, 0x0028, 0x8B20, 0x8002, 0x0841, 0x0841, 0x0006, 0x8B20, 0x8006,
+    0x0841, 0x0841, 0x8B20, 0x8B20, 0x0841, 0x0841, 0x0006, 0x8B20, 0x8006, 0x0841,
+    0x0841, 0x8B20, 0x8B20, 0x0841, 0x0841, 0x0006, 0x8B20, 0x8006, 0x0841, 0x0841,
+    0x8B20, 0x8B20, 0x0841, 0x0841, 0x000E, 0x8B20, 0x8002, 0x0841, 0x0841, 0x0006,
+    0x8B20, 0x8002, 0x0841, 0x0841, 0x0004, 0x8B20, 0x8002, 0x0841, 0x0841, 0x0004,
+    0x8B20, 0x8002, 0x0841, 0x0841, 0x0006, 0x8B20, 0x8002, 0x0841, 0x0841, 0x0012,
+    0x8B20, 0x8002, 0x0841, 0x0841, 0x0006, 0x8B20, 0x8002, 0x0841, 0x0841, 0x0004,
+    0x8B20, 0x8002, 0x0841, 0x0841, 0x0004, 0x8B20, 0x8002, 0x0841, 0x0841, 0x0006,
+    0x8B20, 0x8006, 0x0841, 0x0841, 0x8B20, 0x8B20, 0x0841, 0x0841, 0x0006, 0x8B20,
+    0x8002, 0x0841, 0x0841, 0x000A, 0x8B20, 0x8006, 0x0841, 0x0841, 0x8B20, 0x8B20,
+    0x0841, 0x0841, 0x0006, 0x8B20, 0x8002, 0x0841, 0x0841, 0x0006, 0x8B20, 0x8002,
+    0x0841, 0x0841, 0x000E, 0x8B20, 0x8002, 0x0841, 0x0841, 0x000A, 0x8B20, 0x8002,
+    0x0841, 0x0841, 0x0006, 0x8B20, 0x8002, 0x0841, 0x0841, 0x0006, 0x8B20, 0x8002,
+    0x0841, 0x0841, 0x0006, 0x8B20, 0x8006, 0x0841, 0x0841, 0x8B20, 0x8B20, 0x0841,
+    0x0841, 0x0006, 0x8B20, 0x8002, 0x0841, 0x0841, 0x00CA, 0x8B20, 0x002A, 0x9320,
+    0x0006, 0x0841, 0x0006, 0x9320, 0x0006, 0x0841, 0x0004, 0x9320, 0x8002, 0x0841,
+    0x0841, 0x0006, 0x9320, 0x8006, 0x0841, 0x0841, 0x9320, 0x9320, 0x0841, 0x0841,
+    0x000C, 0x9320, 0x0006, 0x0841, 0x0004, 0x9320, 0x8002, 0x0841, 0x0841, 0x0006,
+    0x9320, 0x8006, 0x0841, 0x0841, 0x9320, 0x9320, 0x0841, 0x0841, 0x0006, 0x9320,
+    0x8002, 0x0841, 0x0841, 0x0012, 0x9320, 0x8002, 0x0841, 0x0841, 0x0006, 0x9320,
+    0x8002, 0x0841, 0x0841, 0x0006, 0x9320, 0x8006, 0x0841, 0x0841, 0x9320, 0x9320,
+    0x0841, 0x0841, 0x0006, 0x9320, 0x8006, 0x0841, 0x0841, 0x9320, 0x9320, 0x0841,
+    0x0841, 0x0006, 0x9320, 0x8004, 0x0841, 0x0841, 0x9320, 0x9320, 0x0008, 0x0841,
+    0x0004, 0x9320, 0x8002, 0x0841, 0x0841, 0x0006, 0x9320, 0x8002, 0x0841, 0x0841,
+    0x0004, 0x9320, 0x0006, 0x0841, 0x0004, 0x9320, 0x0008, 0x0841, 0x0004, 0x9320,
+    0x0008, 0x0841, 0x0006, 0x9320, 0x0006, 0x0841, 0x0006, 0x9320, 0x0006, 0x0841,
+    0x0004, 0x9320, 0x8002, 0x0841, 0x0841, 0x0006, 0x9320, 0x8002, 0x0841, 0x0841,
+    0x00CA, 0x9320, 0x002A, 0x9340, 0x0006, 0x0841, 0x0006, 0x9340, 0x0006, 0x0841,
+    0x0004, 0x9340, 0x8002, 0x0841, 0x0841, 0x0006, 0x9340, 0x8006, 0x0841, 0x0841,
+    0x9340, 0x9340, 0x0841, 0x0841, 0x000C, 0x9340, 0x0006, 0x0841, 0x0004, 0x9340,
+    0x8002, 0x0841, 0x0841, 0x0006, 0x9340, 0x8006, 0x0841, 0x0841, 0x9340, 0x9340,
+    0x0841, 0x0841, 0x0006, 0x9340, 0x8002, 0x0841, 0x0841, 0x0012, 0x9340, 0x8002,
+    0x0841, 0x0841, 0x0006, 0x9340, 0x8002, 0x0841, 0x0841, 0x0006, 0x9340, 0x8006,
+    0x0841, 0x0841, 0x9340, 0x9340, 0x0841, 0x0841, 0x0006, 0x9340, 0x8006, 0x0841,
+    0x0841, 0x9340, 0x9340, 0x0841, 0x0841, 0x0006, 0x9340, 0x8004, 0x0841, 0x0841,
+    0x9340, 0x9340, 0x0008, 0x0841, 0x0004, 0x9340, 0x8002, 0x0841, 0x0841, 0x0006,
+    0x9340, 0x8002, 0x0841, 0x0841, 0x0004, 0x9340, 0x0006, 0x0841, 0x0004, 0x9340,
+    0x0008, 0x0841, 0x0004, 0x9340, 0x0008, 0x0841, 0x0006, 0x9340, 0x0006, 0x0841,
+    0x0006, 0x9340, 0x0006, 0x0841, 0x0004, 0x9340, 0x8002, 0x0841, 0x0841, 0x0006,
+    0x9340, 0x8002, 0x0841, 0x0841, 0x00CA, 0x9340, 0x03C0, 0x9B60, 0x01E0, 0x9B80,
+    0x01E0, 0xA380, 0x01E0, 0xA3A0, 0x01E0, 0xABA0, 0x01E0, 0xABC0, 0x03C0, 0xB3E0,
+    0x01E0, 0xB400, 0x01E0, 0xBC00, 0x01E0, 0xBC20, 0x01E0, 0xC420, 0x01E0, 0xC440,
+    0x01E0, 0xFDC0, 0x7FFF, 0x0861, 0x7FFF, 0x0861, 0x7FFF, 0x0861, 0x1768, 0x0861,
+    0x005E, 0x07F0, 0x001A, 0x0861, 0x005E, 0xF9C7, 0x0109, 0x0861, 0x0060, 0x07F0,
+    0x0018, 0x0861, 0x8001, 0xF9C7, 0x005E, 0x18C5, 0x8001, 0xF9C7, 0x0107, 0x0861,
+    0x0062, 0x07F0, 0x0016, 0x0861, 0x8001, 0xF9C7, 0x0060, 0x18C5, 0x8001, 0xF9C7,
+    0x0105, 0x0861, 0x0064, 0x07F0, 0x0014, 0x0861, 0x8001, 0xF9C7, 0x0062, 0x18C5,
+    0x8001, 0xF9C7, 0x0104, 0x0861, 0x0064, 0x07F0, 0x0014, 0x0861, 0x8001, 0xF9C7,
+    0x0062, 0x18C5, 0x8001, 0xF9C7, 0x0104, 0x0861, 0x0064, 0x07F0, 0x0014, 0x0861,
+    0x8001, 0xF9C7, 0x0062, 0x18C5, 0x8001, 0xF9C7, 0x0104, 0x0861, 0x0064, 0x07F0,
+    0x0014, 0x0861, 0x8001, 0xF9C7, 0x0062, 0x18C5, 0x8001, 0xF9C7, 0x0104, 0x0861,
+    0x0064, 0x07F0, 0x0014, 0x0861, 0x8001, 0xF9C7, 0x0062, 0x18C5, 0x8001, 0xF9C7,
+    0x0104, 0x0861, 0x0064, 0x07F0, 0x0014, 0x0861, 0x8001, 0xF9C7, 0x0062, 0x18C5,
+    0x8001, 0xF9C7, 0x0104, 0x0861, 0x0064, 0x07F0, 0x0014, 0x0861, 0x8001, 0xF9C7,
+    0x0062, 0x18C5, 0x8001, 0xF9C7, 0x0104, 0x0861, 0x0064, 0x07F0, 0x0014, 0x0861,
+    0x8001, 0xF9C7, 0x0062, 0x18C5, 0x8001, 0xF9C7, 0x0104, 0x0861, 0x0064, 0x07F0,
+    0x0014, 0x0861, 0x8001, 0xF9C7, 0x0062, 0x18C5, 0x8001, 0xF9C7, 0x0104, 0x0861,
+    0x0064, 0x07F0, 0x0008, 0x0841, 0x8002, 0x0861, 0x0861, 0x000A, 0x0841, 0x8001,
+    0xF9C7, 0x000D, 0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7,
+    0x0012, 0x18C5, 0x0006, 0xF9C7, 0x0006, 0x18C5, 0x0006, 0xF9C7, 0x0004, 0x18C5,
+    0x8002, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x0004, 0x18C5,
+    0x0006, 0xF9C7, 0x0004, 0x18C5, 0x000A, 0xF9C7, 0x8006, 0x18C5, 0x18C5, 0xF9C7,
+    0xF9C7, 0x18C5, 0xF9C7, 0x0104, 0x0861, 0x0064, 0x07F0, 0x0008, 0x0841, 0x8002,
+    0x0861, 0x0861, 0x000A, 0x0841, 0x8001, 0xF9C7, 0x000D, 0x18C5, 0x8006, 0xF9C7,
+    0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0012, 0x18C5, 0x0006, 0xF9C7, 0x0006,
+    0x18C5, 0x0006, 0xF9C7, 0x0004, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x0006, 0x18C5,
+    0x8002, 0xF9C7, 0xF9C7, 0x0004, 0x18C5, 0x0006, 0xF9C7, 0x0004, 0x18C5, 0x000A,
+    0xF9C7, 0x8006, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x18C5, 0xF9C7, 0x0104, 0x0861,
+    0x004C, 0x07F0, 0x8006, 0x0841, 0x0841, 0x07F0, 0x07F0, 0x0841, 0x0841, 0x0010,
+    0x07F0, 0x8002, 0x0841, 0x0841, 0x000A, 0x0861, 0x8002, 0x0841, 0x0841, 0x0008,
+    0x0861, 0x8001, 0xF9C7, 0x000D, 0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5,
+    0xF9C7, 0xF9C7, 0x0010, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8006,
+    0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8006, 0xF9C7,
+    0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8006, 0xF9C7, 0xF9C7,
+    0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5,
+    0x18C5, 0xF9C7, 0xF9C7, 0x000A, 0x18C5, 0x8004, 0xF9C7, 0xF9C7, 0x18C5, 0xF9C7,
+    0x0104, 0x0861, 0x004C, 0x07F0, 0x8006, 0x0841, 0x0841, 0x07F0, 0x07F0, 0x0841,
+    0x0841, 0x0010, 0x07F0, 0x8002, 0x0841, 0x0841, 0x000A, 0x0861, 0x8002, 0x0841,
+    0x0841, 0x0008, 0x0861, 0x8001, 0xF9C7, 0x000D, 0x18C5, 0x8006, 0xF9C7, 0xF9C7,
+    0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0010, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x0006,
+    0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0006, 0x18C5,
+    0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8006,
+    0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8006, 0xF9C7,
+    0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x000A, 0x18C5, 0x8004, 0xF9C7, 0xF9C7,
+    0x18C5, 0xF9C7, 0x0104, 0x0861, 0x004E, 0x07F0, 0x8002, 0x0841, 0x0841, 0x0012,
+    0x07F0, 0x8002, 0x0841, 0x0841, 0x000A, 0x0861, 0x8002, 0x0841, 0x0841, 0x0008,
+    0x0861, 0x8001, 0xF9C7, 0x000B, 0x18C5, 0x000A, 0xF9C7, 0x000E, 0x18C5, 0x8002,
+    0xF9C7, 0xF9C7, 0x000A, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8004,
+    0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0x0004, 0xF9C7, 0x0004, 0x18C5, 0x8006, 0xF9C7,
+    0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x000A, 0x18C5, 0x8002, 0xF9C7, 0xF9C7,
+    0x000A, 0x18C5, 0x8004, 0xF9C7, 0xF9C7, 0x18C5, 0xF9C7, 0x0104, 0x0861, 0x004E,
+    0x07F0, 0x8002, 0x0841, 0x0841, 0x0012, 0x07F0, 0x8002, 0x0841, 0x0841, 0x000A,
+    0x0861, 0x8002, 0x0841, 0x0841, 0x0008, 0x0861, 0x8001, 0xF9C7, 0x000B, 0x18C5,
+    0x000A, 0xF9C7, 0x000E, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x000A, 0x18C5, 0x8002,
+    0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8004, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0x0004,
+    0xF9C7, 0x0004, 0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7,
+    0x000A, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x000A, 0x18C5, 0x8004, 0xF9C7, 0xF9C7,
+    0x18C5, 0xF9C7, 0x0104, 0x0861, 0x004A, 0x07F0, 0x000A, 0x0841, 0x0010, 0x07F0,
+    0x0006, 0x0841, 0x0004, 0x0861, 0x0008, 0x0841, 0x8003, 0x0861, 0x0861, 0xF9C7,
+    0x000D, 0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0010,
+    0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x000A, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x0006,
+    0x18C5, 0x8012, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5,
+    0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7,
+    0x000A, 0x18C5, 0x0008, 0xF9C7, 0x0004, 0x18C5, 0x8004, 0xF9C7, 0xF9C7, 0x18C5,
+    0xF9C7, 0x0104, 0x0861, 0x004A, 0x07F0, 0x000A, 0x0841, 0x0010, 0x07F0, 0x0006,
+    0x0841, 0x0004, 0x0861, 0x0008, 0x0841, 0x8003, 0x0861, 0x0861, 0xF9C7, 0x000D,
+    0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0010, 0x18C5,
+    0x8002, 0xF9C7, 0xF9C7, 0x000A, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x0006, 0x18C5,
+    0x8012, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7,
+    0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x000A,
+    0x18C5, 0x0008, 0xF9C7, 0x0004, 0x18C5, 0x8004, 0xF9C7, 0xF9C7, 0x18C5, 0xF9C7,
+    0x0104, 0x0861, 0x004E, 0x07F0, 0x8002, 0x0841, 0x0841, 0x0014, 0x07F0, 0x0006,
+    0x0861, 0x8006, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0008, 0x0861,
+    0x8001, 0xF9C7, 0x000B, 0x18C5, 0x000A, 0xF9C7, 0x000E, 0x18C5, 0x8002, 0xF9C7,
+    0xF9C7, 0x000A, 0x18C5, 0x000A, 0xF9C7, 0x8004, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7,
+    0x0004, 0x18C5, 0x0004, 0xF9C7, 0x8004, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x000A,
+    0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x000A, 0x18C5, 0x8004, 0xF9C7, 0xF9C7, 0x18C5,
+    0xF9C7, 0x0104, 0x0861, 0x004E, 0x07F0, 0x8002, 0x0841, 0x0841, 0x0014, 0x07F0,
+    0x0006, 0x0861, 0x8006, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0008,
+    0x0861, 0x8001, 0xF9C7, 0x000B, 0x18C5, 0x000A, 0xF9C7, 0x000E, 0x18C5, 0x8002,
+    0xF9C7, 0xF9C7, 0x000A, 0x18C5, 0x000A, 0xF9C7, 0x8004, 0x18C5, 0x18C5, 0xF9C7,
+    0xF9C7, 0x0004, 0x18C5, 0x0004, 0xF9C7, 0x8004, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7,
+    0x000A, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x000A, 0x18C5, 0x8004, 0xF9C7, 0xF9C7,
+    0x18C5, 0xF9C7, 0x0104, 0x0861, 0x004C, 0x07F0, 0x8006, 0x0841, 0x0841, 0x07F0,
+    0x07F0, 0x0841, 0x0841, 0x0012, 0x07F0, 0x0006, 0x0861, 0x8006, 0x0841, 0x0841,
+    0x0861, 0x0861, 0x0841, 0x0841, 0x0008, 0x0861, 0x8001, 0xF9C7, 0x000D, 0x18C5,
+    0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0010, 0x18C5, 0x8002,
+    0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7,
+    0xF9C7, 0x0006, 0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7,
+    0x0006, 0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0006,
+    0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x000A, 0x18C5,
+    0x8004, 0xF9C7, 0xF9C7, 0x18C5, 0xF9C7, 0x0104, 0x0861, 0x004C, 0x07F0, 0x8006,
+    0x0841, 0x0841, 0x07F0, 0x07F0, 0x0841, 0x0841, 0x0012, 0x07F0, 0x0006, 0x0861,
+    0x8006, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0008, 0x0861, 0x8001,
+    0xF9C7, 0x000D, 0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7,
+    0x0010, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8006, 0xF9C7, 0xF9C7,
+    0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5,
+    0x18C5, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5,
+    0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7,
+    0xF9C7, 0x000A, 0x18C5, 0x8004, 0xF9C7, 0xF9C7, 0x18C5, 0xF9C7, 0x0104, 0x0861,
+    0x0062, 0x07F0, 0x0008, 0x0841, 0x0004, 0x0861, 0x000A, 0x0841, 0x8001, 0xF9C7,
+    0x000D, 0x18C5, 0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0012,
+    0x18C5, 0x0006, 0xF9C7, 0x0004, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x0006, 0x18C5,
+    0x8006, 0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8002,
+    0xF9C7, 0xF9C7, 0x0004, 0x18C5, 0x0006, 0xF9C7, 0x0004, 0x18C5, 0x000A, 0xF9C7,
+    0x8002, 0x18C5, 0x18C5, 0x000A, 0xF9C7, 0x00FE, 0x0861, 0x0062, 0x07F0, 0x0008,
+    0x0841, 0x0004, 0x0861, 0x000A, 0x0841, 0x8001, 0xF9C7, 0x000D, 0x18C5, 0x8006,
+    0xF9C7, 0xF9C7, 0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0012, 0x18C5, 0x0006, 0xF9C7,
+    0x0004, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8006, 0xF9C7, 0xF9C7,
+    0x18C5, 0x18C5, 0xF9C7, 0xF9C7, 0x0006, 0x18C5, 0x8002, 0xF9C7, 0xF9C7, 0x0004,
+    0x18C5, 0x0006, 0xF9C7, 0x0004, 0x18C5, 0x000A, 0xF9C7, 0x8002, 0x18C5, 0x18C5,
+    0x000A, 0xF9C7, 0x00FE, 0x0861, 0x0064, 0x07F0, 0x0014, 0x0861, 0x8001, 0xF9C7,
+    0x0062, 0x18C5, 0x8001, 0xF9C7, 0x0104, 0x0861, 0x0064, 0x07F0, 0x0014, 0x0861,
+    0x8001, 0xF9C7, 0x0062, 0x18C5, 0x8001, 0xF9C7, 0x0104, 0x0861, 0x0064, 0x07F0,
+    0x0014, 0x0861, 0x8001, 0xF9C7, 0x0062, 0x18C5, 0x8001, 0xF9C7, 0x0104, 0x0861,
+    0x0064, 0x07F0, 0x0014, 0x0861, 0x8001, 0xF9C7, 0x0062, 0x18C5, 0x8001, 0xF9C7,
+    0x0104, 0x0861, 0x0064, 0x07F0, 0x0014, 0x0861, 0x8001, 0xF9C7, 0x0062, 0x18C5,
+    0x8001, 0xF9C7, 0x0104, 0x0861, 0x0064, 0x07F0, 0x0014, 0x0861, 0x8001, 0xF9C7,
+    0x0062, 0x18C5, 0x8001, 0xF9C7, 0x0104, 0x0861, 0x0064, 0x07F0, 0x0014, 0x0861,
+    0x8001, 0xF9C7, 0x0062, 0x18C5, 0x8001, 0xF9C7, 0x0104, 0x0861, 0x0064, 0x07F0,
+    0x0014, 0x0861, 0x8001, 0xF9C7, 0x0062, 0x18C5, 0x8001, 0xF9C7, 0x0104, 0x0861,
+    0x0064, 0x07F0, 0x0014, 0x0861, 0x8001, 0xF9C7, 0x0062, 0x18C5, 0x8001, 0xF9C7,
+    0x0105, 0x0861, 0x0062, 0x07F0, 0x0016, 0x0861, 0x8001, 0xF9C7, 0x0060, 0x18C5,
+    0x8001, 0xF9C7, 0x0107, 0x0861, 0x0060, 0x07F0, 0x0018, 0x0861, 0x8001, 0xF9C7,
+    0x005E, 0x18C5, 0x8001, 0xF9C7, 0x0109, 0x0861, 0x005E, 0x07F0, 0x001A, 0x0861,
+    0x005E, 0xF9C7, 0x29C5, 0x0861,
+};
+constexpr lifeline::PanelImage CONFIRM = {480, 320, CONFIRM_WORDS, 3154};
+constexpr lifeline::FieldRect CONFIRM_CARD = {10, 62, 462, 62};
+
+// SENDING: 12596 bytes (4.1% of 300 KB raw)
+constexpr uint16_t SENDING_WORDS[] = {
+    0x14A0, 0x1148, 0x05A0, 0x1128, 0x000A, 0x1127, 0x000A, 0xFFFF, 0x8002, 0x1127,
+    0x1127, 0x0008, 0xFFFF, 0x0006, 0x1127, 0x0006, 0xFFFF, 0x0004, 0x1127, 0x8002,
+    0xFFFF, 0xFFFF, 0x0006, 0x1127, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x1127, 0x0008,
+    0xFFFF, 0x8004, 0x1127, 0x1127, 0xFFFF, 0xFFFF, 0x0006, 0x1127, 0x8002, 0xFFFF,
+    0xFFFF, 0x0004, 0x1127, 0x0006, 0xFFFF, 0x0004, 0x1127, 0x000A, 0xFFFF, 0x8002,
+    0x1127, 0x1127, 0x000A, 0xFFFF, 0x0004, 0x1127, 0x0006, 0xFFFF, 0x0004, 0x1127,
+    0x8002, 0xFFFF, 0xFFFF, 0x0006, 0x1127, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x1127,
+    0x0006, 0xFFFF, 0x0154, 0x1127, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x1127, 0x0008,
+    0xFFFF, 0x8001, 0x0000, 0x0005, 0x1127, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0003,
+    0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0003, 0x1127, 0x0008, 0xFFFF, 0x8005, 0x0000, 0x1127, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0003, 0x1127, 0x0006,
+    0xFFFF, 0x8001, 0x0000, 0x0003, 0x1127, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x1127,
+    0x000A, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1127, 0x0006, 0xFFFF, 0x8001, 0x0000,
+    0x0003, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0003, 0x1127, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0154, 0x1127,
+    0x0003, 0x0000, 0x8002, 0xFFFF, 0xFFFF, 0x0005, 0x0000, 0x8003, 0x1127, 0xFFFF,
+    0xFFFF, 0x0006, 0x0000, 0x8007, 0xFFFF, 0xFFFF, 0x1127, 0x1127, 0xFFFF, 0xFFFF,
+    0x1127, 0x0005, 0x0000, 0x8007, 0xFFFF, 0xFFFF, 0x1127, 0x1127, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF,
+    0x1127, 0x0008, 0x0000, 0x8001, 0x1127, 0x0004, 0xFFFF, 0x8002, 0x1127, 0x1127,
+    0x0004, 0xFFFF, 0x8001, 0x0000, 0x0004, 0x1127, 0x8003, 0x0000, 0xFFFF, 0xFFFF,
+    0x0003, 0x0000, 0x0004, 0x1127, 0x0003, 0x0000, 0x8002, 0xFFFF, 0xFFFF, 0x0005,
+    0x0000, 0x8002, 0x1127, 0x1127, 0x0003, 0x0000, 0x8002, 0xFFFF, 0xFFFF, 0x0005,
+    0x0000, 0x0004, 0x1127, 0x8003, 0x0000, 0xFFFF, 0xFFFF, 0x0003, 0x0000, 0x0003,
+    0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF,
+    0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x1127, 0x0005, 0x0000, 0x8002, 0xFFFF, 0xFFFF,
+    0x0156, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1127, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x1127, 0x0004,
+    0xFFFF, 0x8001, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127,
+    0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0155,
+    0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1127, 0x8004, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0x0004, 0xFFFF,
+    0x0004, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000,
+    0x0009, 0x1127, 0x800B, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x1127,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127,
+    0x0004, 0xFFFF, 0x0004, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF,
+    0xFFFF, 0x0000, 0x0006, 0x1127, 0x8002, 0x0000, 0x0000, 0x0155, 0x1127, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1127, 0x8004, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0x0004, 0xFFFF, 0x8001, 0x0000,
+    0x0003, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000,
+    0x0009, 0x1127, 0x800B, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000,
+    0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127,
+    0x0004, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000,
+    0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x015D, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0005, 0x1127, 0x0008, 0xFFFF, 0x8007, 0x1127, 0x0000, 0x0000, 0x1127, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1127, 0x8012, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x1127, 0x1127, 0xFFFF, 0xFFFF, 0x0000,
+    0x1127, 0x1127, 0x0000, 0x0006, 0xFFFF, 0x0004, 0x1127, 0x800B, 0xFFFF, 0xFFFF,
+    0x0000, 0x1127, 0x1127, 0x0000, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x800F, 0xFFFF, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0xFFFF, 0x1127, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF,
+    0x0000, 0x014F, 0x1127, 0x000E, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x0008, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1107, 0x800F, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF,
+    0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0003,
+    0x1107, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1107, 0x800F, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF,
+    0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x015D,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8006, 0xFFFF, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0003, 0x0000, 0x0003, 0x1107, 0x000A, 0xFFFF,
+    0x8008, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0x1107, 0x0000, 0x0004,
+    0xFFFF, 0x8001, 0x0000, 0x0004, 0x1107, 0x0005, 0x0000, 0x8007, 0xFFFF, 0xFFFF,
+    0x1107, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8006, 0xFFFF, 0xFFFF,
+    0x0000, 0x1107, 0x1107, 0x0000, 0x0004, 0xFFFF, 0x8005, 0x0000, 0x1107, 0xFFFF,
+    0xFFFF, 0x0000, 0x0003, 0x1107, 0x0004, 0xFFFF, 0x0156, 0x1107, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1107, 0x000A, 0xFFFF, 0x8005, 0x0000, 0x1107, 0xFFFF,
+    0xFFFF, 0x0000, 0x0003, 0x1107, 0x0004, 0xFFFF, 0x8001, 0x0000, 0x0009, 0x1107,
+    0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0003, 0x1107, 0x0004, 0xFFFF, 0x8005, 0x0000,
+    0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0003, 0x1107, 0x0004, 0xFFFF, 0x8001, 0x0000,
+    0x0155, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8008, 0xFFFF,
+    0xFFFF, 0x0000, 0x1107, 0x1107, 0x0000, 0xFFFF, 0xFFFF, 0x0004, 0x1107, 0x8002,
+    0xFFFF, 0xFFFF, 0x0006, 0x0000, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF,
+    0xFFFF, 0x0000, 0x0004, 0x1107, 0x8004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0004, 0x1107, 0x8008, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0004, 0x1107, 0x8004, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0x0003, 0x1107, 0x0004, 0xFFFF, 0x0008, 0x1107, 0x0004,
+    0xFFFF, 0x0008, 0x1107, 0x0004, 0xFFFF, 0x0136, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0003, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0003, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8007, 0xFFFF, 0xFFFF,
+    0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0003, 0x1107, 0x0004,
+    0xFFFF, 0x8001, 0x0000, 0x0007, 0x1107, 0x0004, 0xFFFF, 0x8001, 0x0000, 0x0007,
+    0x1107, 0x0004, 0xFFFF, 0x8001, 0x0000, 0x0135, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0004, 0x1107, 0x8008,
+    0x0000, 0xFFFF, 0xFFFF, 0x1107, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107,
+    0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107,
+    0x8004, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0x0008, 0xFFFF, 0x8007, 0x1107, 0x0000,
+    0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0003, 0x1107, 0x0006, 0xFFFF, 0x0008, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0007, 0x1107, 0x0006,
+    0xFFFF, 0x0004, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8006,
+    0xFFFF, 0xFFFF, 0x0000, 0x1107, 0x1107, 0x0000, 0x0006, 0xFFFF, 0x8003, 0x1107,
+    0x0000, 0x0000, 0x0003, 0x1107, 0x0004, 0xFFFF, 0x8001, 0x0000, 0x0007, 0x1107,
+    0x0004, 0xFFFF, 0x8001, 0x0000, 0x0007, 0x1107, 0x0004, 0xFFFF, 0x8001, 0x0000,
+    0x0135, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1107, 0x8004, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0x0008,
+    0xFFFF, 0x8001, 0x0000, 0x0003, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0003, 0x1107, 0x0006, 0xFFFF, 0x8001,
+    0x0000, 0x0007, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0007, 0x1107, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0003,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0003, 0x1107, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0005, 0x1107, 0x0004,
+    0xFFFF, 0x8001, 0x0000, 0x0007, 0x1107, 0x0004, 0xFFFF, 0x8001, 0x0000, 0x0007,
+    0x1107, 0x0004, 0xFFFF, 0x8001, 0x0000, 0x0127, 0x1107, 0x000F, 0x1106, 0x8002,
+    0x0000, 0x0000, 0x0006, 0x1106, 0x8002, 0x0000, 0x0000, 0x0006, 0x1106, 0x8006,
+    0x0000, 0x0000, 0x1106, 0x1106, 0x0000, 0x0000, 0x0006, 0x1106, 0x8006, 0x0000,
+    0x0000, 0x1106, 0x1106, 0x0000, 0x0000, 0x0006, 0x1106, 0x8004, 0x0000, 0x0000,
+    0x1106, 0x1106, 0x0008, 0x0000, 0x0004, 0x1106, 0x8002, 0x0000, 0x0000, 0x0006,
+    0x1106, 0x8002, 0x0000, 0x0000, 0x0004, 0x1106, 0x0006, 0x0000, 0x0008, 0x1106,
+    0x8002, 0x0000, 0x0000, 0x000A, 0x1106, 0x8002, 0x0000, 0x0000, 0x0008, 0x1106,
+    0x0006, 0x0000, 0x0004, 0x1106, 0x8002, 0x0000, 0x0000, 0x0006, 0x1106, 0x8002,
+    0x0000, 0x0000, 0x0004, 0x1106, 0x0006, 0x0000, 0x0006, 0x1106, 0x0004, 0x0000,
+    0x0008, 0x1106, 0x0004, 0x0000, 0x0008, 0x1106, 0x0004, 0x0000, 0x06C7, 0x1106,
+    0x0F00, 0x10E6, 0x01E0, 0x04B9, 0x01E0, 0x06BF, 0x01E0, 0x04B9, 0x1588, 0x0863,
+    0x0011, 0x1041, 0x01CA, 0x0863, 0x0005, 0x1041, 0x0011, 0x0863, 0x0005, 0x1041,
+    0x01C1, 0x0863, 0x0004, 0x1041, 0x001B, 0x0863, 0x0004, 0x1041, 0x01B9, 0x0863,
+    0x0004, 0x1041, 0x0023, 0x0863, 0x0004, 0x1041, 0x01B3, 0x0863, 0x8002, 0x1041,
+    0x1041, 0x002B, 0x0863, 0x8002, 0x1041, 0x1041, 0x01AE, 0x0863, 0x0003, 0x1041,
+    0x002F, 0x0863, 0x0003, 0x1041, 0x01A9, 0x0863, 0x8002, 0x1041, 0x1041, 0x0035,
+    0x0863, 0x8002, 0x1041, 0x1041, 0x01A5, 0x0863, 0x8002, 0x1041, 0x1041, 0x0039,
+    0x0863, 0x8002, 0x1041, 0x1041, 0x01A1, 0x0863, 0x8002, 0x1041, 0x1041, 0x003D,
+    0x0863, 0x8002, 0x1041, 0x1041, 0x019D, 0x0863, 0x8002, 0x1041, 0x1041, 0x0041,
+    0x0863, 0x8002, 0x1041, 0x1041, 0x019A, 0x0863, 0x8001, 0x1041, 0x0045, 0x0863,
+    0x8001, 0x1041, 0x0197, 0x0863, 0x8002, 0x1041, 0x1041, 0x0047, 0x0863, 0x8002,
+    0x1041, 0x1041, 0x0194, 0x0863, 0x8001, 0x1041, 0x001E, 0x0863, 0x000F, 0x2081,
+    0x001E, 0x0863, 0x8001, 0x1041, 0x0192, 0x0863, 0x8001, 0x1041, 0x001A, 0x0863,
+    0x0005, 0x2081, 0x000F, 0x0863, 0x0005, 0x2081, 0x001A, 0x0863, 0x8001, 0x1041,
+    0x018F, 0x0863, 0x8002, 0x1041, 0x1041, 0x0017, 0x0863, 0x0004, 0x2081, 0x0019,
+    0x0863, 0x0004, 0x2081, 0x0017, 0x0863, 0x8002, 0x1041, 0x1041, 0x018C, 0x0863,
+    0x8001, 0x1041, 0x0016, 0x0863, 0x0003, 0x2081, 0x0021, 0x0863, 0x0003, 0x2081,
+    0x0016, 0x0863, 0x8001, 0x1041, 0x018A, 0x0863, 0x8001, 0x1041, 0x0015, 0x0863,
+    0x8002, 0x2081, 0x2081, 0x0027, 0x0863, 0x8002, 0x2081, 0x2081, 0x0015, 0x0863,
+    0x8001, 0x1041, 0x0188, 0x0863, 0x8001, 0x1041, 0x0014, 0x0863, 0x8002, 0x2081,
+    0x2081, 0x002B, 0x0863, 0x8002, 0x2081, 0x2081, 0x0014, 0x0863, 0x8001, 0x1041,
+    0x0186, 0x0863, 0x8001, 0x1041, 0x0013, 0x0863, 0x8002, 0x2081, 0x2081, 0x002F,
+    0x0863, 0x8002, 0x2081, 0x2081, 0x0013, 0x0863, 0x8001, 0x1041, 0x0184, 0x0863,
+    0x8001, 0x1041, 0x0012, 0x0863, 0x8002, 0x2081, 0x2081, 0x0033, 0x0863, 0x8002,
+    0x2081, 0x2081, 0x0012, 0x0863, 0x8001, 0x1041, 0x0182, 0x0863, 0x8001, 0x1041,
+    0x0011, 0x0863, 0x8002, 0x2081, 0x2081, 0x0037, 0x0863, 0x8002, 0x2081, 0x2081,
+    0x0011, 0x0863, 0x8001, 0x1041, 0x0180, 0x0863, 0x8001, 0x1041, 0x0011, 0x0863,
+    0x8001, 0x2081, 0x003B, 0x0863, 0x8001, 0x2081, 0x0011, 0x0863, 0x8001, 0x1041,
+    0x017E, 0x0863, 0x8001, 0x1041, 0x0011, 0x0863, 0x8001, 0x2081, 0x003D, 0x0863,
+    0x8001, 0x2081, 0x0011, 0x0863, 0x8001, 0x1041, 0x017C, 0x0863, 0x8001, 0x1041,
+    0x0010, 0x0863, 0x8002, 0x2081, 0x2081, 0x003F, 0x0863, 0x8002, 0x2081, 0x2081,
+    0x0010, 0x0863, 0x8001, 0x1041, 0x017A, 0x0863, 0x8001, 0x1041, 0x0010, 0x0863,
+    0x8001, 0x2081, 0x001B, 0x0863, 0x000D, 0x30C1, 0x001B, 0x0863, 0x8001, 0x2081,
+    0x0010, 0x0863, 0x8001, 0x1041, 0x0178, 0x0863, 0x8001, 0x1041, 0x0010, 0x0863,
+    0x8001, 0x2081, 0x0017, 0x0863, 0x0005, 0x30C1, 0x000D, 0x0863, 0x0005, 0x30C1,
+    0x0017, 0x0863, 0x8001, 0x2081, 0x0010, 0x0863, 0x8001, 0x1041, 0x0177, 0x0863,
+    0x8001, 0x1041, 0x000F, 0x0863, 0x8001, 0x2081, 0x0015, 0x0863, 0x0003, 0x30C1,
+    0x0017, 0x0863, 0x0003, 0x30C1, 0x0015, 0x0863, 0x8001, 0x2081, 0x000F, 0x0863,
+    0x8001, 0x1041, 0x0176, 0x0863, 0x8001, 0x1041, 0x000F, 0x0863, 0x8001, 0x2081,
+    0x0014, 0x0863, 0x8002, 0x30C1, 0x30C1, 0x001D, 0x0863, 0x8002, 0x30C1, 0x30C1,
+    0x0014, 0x0863, 0x8001, 0x2081, 0x000F, 0x0863, 0x8001, 0x1041, 0x0174, 0x0863,
+    0x8001, 0x1041, 0x000F, 0x0863, 0x8001, 0x2081, 0x0013, 0x0863, 0x8002, 0x30C1,
+    0x30C1, 0x0021, 0x0863, 0x8002, 0x30C1, 0x30C1, 0x0013, 0x0863, 0x8001, 0x2081,
+    0x000F, 0x0863, 0x8001, 0x1041, 0x0172, 0x0863, 0x8001, 0x1041, 0x000F, 0x0863,
+    0x8001, 0x2081, 0x0012, 0x0863, 0x8002, 0x30C1, 0x30C1, 0x0025, 0x0863, 0x8002,
+    0x30C1, 0x30C1, 0x0012, 0x0863, 0x8001, 0x2081, 0x000F, 0x0863, 0x8001, 0x1041,
+    0x0171, 0x0863, 0x8001, 0x1041, 0x000E, 0x0863, 0x8001, 0x2081, 0x0011, 0x0863,
+    0x8002, 0x30C1, 0x30C1, 0x0029, 0x0863, 0x8002, 0x30C1, 0x30C1, 0x0011, 0x0863,
+    0x8001, 0x2081, 0x000E, 0x0863, 0x8001, 0x1041, 0x0170, 0x0863, 0x8001, 0x1041,
+    0x000E, 0x0863, 0x8001, 0x2081, 0x0011, 0x0863, 0x8001, 0x30C1, 0x002D, 0x0863,
+    0x8001, 0x30C1, 0x0011, 0x0863, 0x8001, 0x2081, 0x000E, 0x0863, 0x8001, 0x1041,
+    0x016E, 0x0863, 0x8001, 0x1041, 0x000E, 0x0863, 0x8001, 0x2081, 0x0010, 0x0863,
+    0x8002, 0x30C1, 0x30C1, 0x002F, 0x0863, 0x8002, 0x30C1, 0x30C1, 0x0010, 0x0863,
+    0x8001, 0x2081, 0x000E, 0x0863, 0x8001, 0x1041, 0x016D, 0x0863, 0x8001, 0x1041,
+    0x000D, 0x0863, 0x8001, 0x2081, 0x0010, 0x0863, 0x8001, 0x30C1, 0x0017, 0x0863,
+    0x0005, 0xFBC0, 0x0017, 0x0863, 0x8001, 0x30C1, 0x0010, 0x0863, 0x8001, 0x2081,
+    0x000D, 0x0863, 0x8001, 0x1041, 0x016C, 0x0863, 0x8001, 0x1041, 0x000E, 0x0863,
+    0x8001, 0x2081, 0x000F, 0x0863, 0x8001, 0x30C1, 0x0017, 0x0863, 0x0007, 0xFBC0,
+    0x0017, 0x0863, 0x8001, 0x30C1, 0x000F, 0x0863, 0x8001, 0x2081, 0x000E, 0x0863,
+    0x8001, 0x1041, 0x016B, 0x0863, 0x8001, 0x1041, 0x000D, 0x0863, 0x8001, 0x2081,
+    0x000F, 0x0863, 0x8001, 0x30C1, 0x0017, 0x0863, 0x0009, 0xFBC0, 0x0017, 0x0863,
+    0x8001, 0x30C1, 0x000F, 0x0863, 0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x1041,
+    0x016A, 0x0863, 0x8001, 0x1041, 0x000D, 0x0863, 0x8001, 0x2081, 0x000F, 0x0863,
+    0x8001, 0x30C1, 0x0017, 0x0863, 0x000B, 0xFBC0, 0x0017, 0x0863, 0x8001, 0x30C1,
+    0x000F, 0x0863, 0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x1041, 0x0169, 0x0863,
+    0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081, 0x000F, 0x0863, 0x8001, 0x30C1,
+    0x0014, 0x0863, 0x0004, 0x4101, 0x000B, 0xFBC0, 0x0004, 0x4101, 0x0014, 0x0863,
+    0x8001, 0x30C1, 0x000F, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x1041,
+    0x0168, 0x0863, 0x8001, 0x1041, 0x000D, 0x0863, 0x8001, 0x2081, 0x000E, 0x0863,
+    0x8001, 0x30C1, 0x0013, 0x0863, 0x8002, 0x4101, 0x4101, 0x0004, 0x0863, 0x000B,
+    0xFBC0, 0x0004, 0x0863, 0x8002, 0x4101, 0x4101, 0x0013, 0x0863, 0x8001, 0x30C1,
+    0x000E, 0x0863, 0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x1041, 0x0167, 0x0863,
+    0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081, 0x000E, 0x0863, 0x8001, 0x30C1,
+    0x0011, 0x0863, 0x0003, 0x4101, 0x0006, 0x0863, 0x000B, 0xFBC0, 0x0006, 0x0863,
+    0x0003, 0x4101, 0x0011, 0x0863, 0x8001, 0x30C1, 0x000E, 0x0863, 0x8001, 0x2081,
+    0x000C, 0x0863, 0x8001, 0x1041, 0x0166, 0x0863, 0x8001, 0x1041, 0x000D, 0x0863,
+    0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x30C1, 0x0011, 0x0863, 0x8001, 0x4101,
+    0x0009, 0x0863, 0x000B, 0xFBC0, 0x0009, 0x0863, 0x8001, 0x4101, 0x0011, 0x0863,
+    0x8001, 0x30C1, 0x000D, 0x0863, 0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x1041,
+    0x0165, 0x0863, 0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081, 0x000D, 0x0863,
+    0x8001, 0x30C1, 0x0010, 0x0863, 0x8002, 0x4101, 0x4101, 0x000B, 0x0863, 0x0009,
+    0xFBC0, 0x000B, 0x0863, 0x8002, 0x4101, 0x4101, 0x0010, 0x0863, 0x8001, 0x30C1,
+    0x000D, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x1041, 0x0165, 0x0863,
+    0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x30C1,
+    0x000F, 0x0863, 0x8001, 0x4101, 0x000E, 0x0863, 0x0007, 0xFBC0, 0x000E, 0x0863,
+    0x8001, 0x4101, 0x000F, 0x0863, 0x8001, 0x30C1, 0x000D, 0x0863, 0x8001, 0x2081,
+    0x000C, 0x0863, 0x8001, 0x1041, 0x0164, 0x0863, 0x8001, 0x1041, 0x000C, 0x0863,
+    0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x30C1, 0x000F, 0x0863, 0x8001, 0x4101,
+    0x000F, 0x0863, 0x0006, 0xFBC0, 0x0010, 0x0863, 0x8001, 0x4101, 0x000F, 0x0863,
+    0x8001, 0x30C1, 0x000D, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x1041,
+    0x0163, 0x0863, 0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863,
+    0x8001, 0x30C1, 0x000F, 0x0863, 0x8001, 0x4101, 0x000F, 0x0863, 0x8001, 0x38E0,
+    0x0006, 0xFBC0, 0x8002, 0x38E0, 0x38E0, 0x000F, 0x0863, 0x8001, 0x4101, 0x000F,
+    0x0863, 0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001,
+    0x1041, 0x0162, 0x0863, 0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081, 0x000D,
+    0x0863, 0x8001, 0x30C1, 0x000E, 0x0863, 0x8001, 0x4101, 0x000D, 0x0863, 0x0003,
+    0x38E0, 0x8001, 0x0863, 0x0006, 0xFBC0, 0x8002, 0x0863, 0x0863, 0x0003, 0x38E0,
+    0x000D, 0x0863, 0x8001, 0x4101, 0x000E, 0x0863, 0x8001, 0x30C1, 0x000D, 0x0863,
+    0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x1041, 0x0161, 0x0863, 0x8001, 0x1041,
+    0x000C, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x30C1, 0x000E, 0x0863,
+    0x8001, 0x4101, 0x000B, 0x0863, 0x0003, 0x38E0, 0x0003, 0x0863, 0x8001, 0x5140,
+    0x0006, 0xFBC0, 0x8002, 0x5140, 0x5140, 0x0003, 0x0863, 0x0003, 0x38E0, 0x000B,
+    0x0863, 0x8001, 0x4101, 0x000E, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863, 0x8001,
+    0x2081, 0x000C, 0x0863, 0x8001, 0x1041, 0x0161, 0x0863, 0x8001, 0x1041, 0x000B,
+    0x0863, 0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x30C1, 0x000D, 0x0863, 0x8001,
+    0x4101, 0x000B, 0x0863, 0x8001, 0x38E0, 0x0003, 0x0863, 0x0003, 0x5140, 0x8001,
+    0x0863, 0x0006, 0xFBC0, 0x8002, 0x0863, 0x0863, 0x0003, 0x5140, 0x0003, 0x0863,
+    0x8001, 0x38E0, 0x000B, 0x0863, 0x8001, 0x4101, 0x000D, 0x0863, 0x8001, 0x30C1,
+    0x000D, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x0161, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x30C1,
+    0x000D, 0x0863, 0x8001, 0x4101, 0x000A, 0x0863, 0x8006, 0x38E0, 0x38E0, 0x0863,
+    0x0863, 0x5140, 0x5140, 0x0003, 0x0863, 0x8001, 0x79E0, 0x0006, 0xFBC0, 0x8002,
+    0x79E0, 0x79E0, 0x0003, 0x0863, 0x8006, 0x5140, 0x5140, 0x0863, 0x0863, 0x38E0,
+    0x38E0, 0x000A, 0x0863, 0x8001, 0x4101, 0x000D, 0x0863, 0x8001, 0x30C1, 0x000C,
+    0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x0160, 0x0863, 0x8001,
+    0x1041, 0x000C, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x30C1, 0x000C,
+    0x0863, 0x8001, 0x4101, 0x000A, 0x0863, 0x8007, 0x38E0, 0x0863, 0x0863, 0x5140,
+    0x5140, 0x0863, 0x0863, 0x0003, 0x79E0, 0x8001, 0x0863, 0x0006, 0xFBC0, 0x8002,
+    0x0863, 0x0863, 0x0003, 0x79E0, 0x8007, 0x0863, 0x0863, 0x5140, 0x5140, 0x0863,
+    0x0863, 0x38E0, 0x000A, 0x0863, 0x8001, 0x4101, 0x000C, 0x0863, 0x8001, 0x30C1,
+    0x000C, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x1041, 0x015F, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x30C1,
+    0x000D, 0x0863, 0x8001, 0x4101, 0x0009, 0x0863, 0x8008, 0x38E0, 0x0863, 0x0863,
+    0x5140, 0x0863, 0x0863, 0x79E0, 0x79E0, 0x0004, 0x0863, 0x0007, 0xFBC0, 0x0004,
+    0x0863, 0x8008, 0x79E0, 0x79E0, 0x0863, 0x0863, 0x5140, 0x0863, 0x0863, 0x38E0,
+    0x0009, 0x0863, 0x8001, 0x4101, 0x000D, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863,
+    0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015F, 0x0863, 0x8001, 0x1041,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863,
+    0x8001, 0x4101, 0x0009, 0x0863, 0x8007, 0x38E0, 0x0863, 0x0863, 0x5140, 0x0863,
+    0x0863, 0x79E0, 0x0003, 0x0863, 0x000D, 0xFBC0, 0x0003, 0x0863, 0x8007, 0x79E0,
+    0x0863, 0x0863, 0x5140, 0x0863, 0x0863, 0x38E0, 0x0009, 0x0863, 0x8001, 0x4101,
+    0x000C, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863,
+    0x8001, 0x1041, 0x015F, 0x0863, 0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081,
+    0x000B, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x4101, 0x0009, 0x0863,
+    0x8009, 0x38E0, 0x0863, 0x0863, 0x5140, 0x0863, 0x0863, 0x79E0, 0x0863, 0x0863,
+    0x0011, 0xFBC0, 0x8009, 0x0863, 0x0863, 0x79E0, 0x0863, 0x0863, 0x5140, 0x0863,
+    0x0863, 0x38E0, 0x0009, 0x0863, 0x8001, 0x4101, 0x000C, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015E, 0x0863,
+    0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000C, 0x0863, 0x8001, 0x4101, 0x0008, 0x0863, 0x8009, 0x38E0, 0x0863, 0x0863,
+    0x5140, 0x0863, 0x0863, 0x79E0, 0x0863, 0x0863, 0x0013, 0xFBC0, 0x8009, 0x0863,
+    0x0863, 0x79E0, 0x0863, 0x0863, 0x5140, 0x0863, 0x0863, 0x38E0, 0x0008, 0x0863,
+    0x8001, 0x4101, 0x000C, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x2081,
+    0x000C, 0x0863, 0x8001, 0x1041, 0x015D, 0x0863, 0x8001, 0x1041, 0x000B, 0x0863,
+    0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x4101,
+    0x0008, 0x0863, 0x8007, 0x38E0, 0x0863, 0x5140, 0x0863, 0x0863, 0x79E0, 0x0863,
+    0x0017, 0xFBC0, 0x8007, 0x0863, 0x79E0, 0x0863, 0x0863, 0x5140, 0x0863, 0x38E0,
+    0x0008, 0x0863, 0x8001, 0x4101, 0x000C, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863,
+    0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015D, 0x0863, 0x8001, 0x1041,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863,
+    0x8001, 0x4101, 0x0008, 0x0863, 0x8007, 0x38E0, 0x0863, 0x5140, 0x0863, 0x0863,
+    0x79E0, 0x0863, 0x0019, 0xFBC0, 0x8007, 0x0863, 0x79E0, 0x0863, 0x0863, 0x5140,
+    0x0863, 0x38E0, 0x0008, 0x0863, 0x8001, 0x4101, 0x000C, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015D, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000C, 0x0863, 0x8001, 0x4101, 0x0007, 0x0863, 0x8008, 0x38E0, 0x0863, 0x0863,
+    0x5140, 0x0863, 0x79E0, 0x0863, 0x0863, 0x0019, 0xFBC0, 0x8008, 0x0863, 0x0863,
+    0x79E0, 0x0863, 0x5140, 0x0863, 0x0863, 0x38E0, 0x0007, 0x0863, 0x8001, 0x4101,
+    0x000C, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863,
+    0x8001, 0x1041, 0x015D, 0x0863, 0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081,
+    0x000B, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x4101, 0x0008, 0x0863,
+    0x8007, 0x38E0, 0x0863, 0x5140, 0x0863, 0x79E0, 0x0863, 0x0863, 0x001B, 0xFBC0,
+    0x8007, 0x0863, 0x0863, 0x79E0, 0x0863, 0x5140, 0x0863, 0x38E0, 0x0008, 0x0863,
+    0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x2081,
+    0x000B, 0x0863, 0x8001, 0x1041, 0x015C, 0x0863, 0x8001, 0x1041, 0x000C, 0x0863,
+    0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x4101,
+    0x0008, 0x0863, 0x8006, 0x38E0, 0x0863, 0x5140, 0x0863, 0x79E0, 0x0863, 0x001D,
+    0xFBC0, 0x8006, 0x0863, 0x79E0, 0x0863, 0x5140, 0x0863, 0x38E0, 0x0008, 0x0863,
+    0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x2081,
+    0x000C, 0x0863, 0x8001, 0x1041, 0x015B, 0x0863, 0x8001, 0x1041, 0x000B, 0x0863,
+    0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x4101,
+    0x0007, 0x0863, 0x8007, 0x38E0, 0x0863, 0x5140, 0x0863, 0x79E0, 0x0863, 0x0863,
+    0x001D, 0xFBC0, 0x8007, 0x0863, 0x0863, 0x79E0, 0x0863, 0x5140, 0x0863, 0x38E0,
+    0x0007, 0x0863, 0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863,
+    0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015B, 0x0863, 0x8001, 0x1041,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863,
+    0x8001, 0x4101, 0x0007, 0x0863, 0x8006, 0x38E0, 0x0863, 0x5140, 0x0863, 0x79E0,
+    0x0863, 0x001F, 0xFBC0, 0x8006, 0x0863, 0x79E0, 0x0863, 0x5140, 0x0863, 0x38E0,
+    0x0007, 0x0863, 0x8001, 0x4101, 0x000C, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863,
+    0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015B, 0x0863, 0x8001, 0x1041,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863,
+    0x8001, 0x4101, 0x0008, 0x0863, 0x8006, 0x38E0, 0x0863, 0x5140, 0x0863, 0x79E0,
+    0x0863, 0x001F, 0xFBC0, 0x8006, 0x0863, 0x79E0, 0x0863, 0x5140, 0x0863, 0x38E0,
+    0x0008, 0x0863, 0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863,
+    0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015B, 0x0863, 0x8001, 0x1041,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863,
+    0x8001, 0x4101, 0x0007, 0x0863, 0x8007, 0x38E0, 0x0863, 0x5140, 0x0863, 0x79E0,
+    0x0863, 0x0863, 0x001F, 0xFBC0, 0x8007, 0x0863, 0x0863, 0x79E0, 0x0863, 0x5140,
+    0x0863, 0x38E0, 0x0007, 0x0863, 0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015B, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x4101, 0x0007, 0x0863, 0x8006, 0x38E0, 0x0863, 0x5140,
+    0x0863, 0x79E0, 0x0863, 0x0021, 0xFBC0, 0x8006, 0x0863, 0x79E0, 0x0863, 0x5140,
+    0x0863, 0x38E0, 0x0007, 0x0863, 0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015B, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x4101, 0x0007, 0x0863, 0x8006, 0x38E0, 0x0863, 0x5140,
+    0x0863, 0x79E0, 0x0863, 0x0021, 0xFBC0, 0x8006, 0x0863, 0x79E0, 0x0863, 0x5140,
+    0x0863, 0x38E0, 0x0007, 0x0863, 0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015B, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x4101, 0x0007, 0x0863, 0x8006, 0x38E0, 0x0863, 0x5140,
+    0x0863, 0x79E0, 0x0863, 0x0021, 0xFBC0, 0x8006, 0x0863, 0x79E0, 0x0863, 0x5140,
+    0x0863, 0x38E0, 0x0007, 0x0863, 0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015B, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x4101, 0x0007, 0x0863, 0x8006, 0x38E0, 0x0863, 0x5140,
+    0x0863, 0x79E0, 0x0863, 0x0021, 0xFBC0, 0x8006, 0x0863, 0x79E0, 0x0863, 0x5140,
+    0x0863, 0x38E0, 0x0007, 0x0863, 0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015B, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x4101, 0x0007, 0x0863, 0x8006, 0x38E0, 0x0863, 0x5140,
+    0x0863, 0x79E0, 0x0863, 0x0021, 0xFBC0, 0x8006, 0x0863, 0x79E0, 0x0863, 0x5140,
+    0x0863, 0x38E0, 0x0007, 0x0863, 0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015B, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x4101, 0x0007, 0x0863, 0x8006, 0x38E0, 0x0863, 0x5140,
+    0x0863, 0x79E0, 0x0863, 0x0021, 0xFBC0, 0x8006, 0x0863, 0x79E0, 0x0863, 0x5140,
+    0x0863, 0x38E0, 0x0007, 0x0863, 0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015B, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x4101, 0x0007, 0x0863, 0x8006, 0x38E0, 0x0863, 0x5140,
+    0x0863, 0x79E0, 0x0863, 0x0021, 0xFBC0, 0x8006, 0x0863, 0x79E0, 0x0863, 0x5140,
+    0x0863, 0x38E0, 0x0007, 0x0863, 0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015B, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x4101, 0x0007, 0x0863, 0x8007, 0x38E0, 0x0863, 0x5140,
+    0x0863, 0x79E0, 0x0863, 0x0863, 0x001F, 0xFBC0, 0x8007, 0x0863, 0x0863, 0x79E0,
+    0x0863, 0x5140, 0x0863, 0x38E0, 0x0007, 0x0863, 0x8001, 0x4101, 0x000B, 0x0863,
+    0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041,
+    0x015B, 0x0863, 0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863,
+    0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x4101, 0x0008, 0x0863, 0x8006, 0x38E0,
+    0x0863, 0x5140, 0x0863, 0x79E0, 0x0863, 0x001F, 0xFBC0, 0x8006, 0x0863, 0x79E0,
+    0x0863, 0x5140, 0x0863, 0x38E0, 0x0008, 0x0863, 0x8001, 0x4101, 0x000B, 0x0863,
+    0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041,
+    0x015B, 0x0863, 0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863,
+    0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x4101, 0x0007, 0x0863, 0x8006, 0x38E0,
+    0x0863, 0x5140, 0x0863, 0x79E0, 0x0863, 0x001F, 0xFBC0, 0x8006, 0x0863, 0x79E0,
+    0x0863, 0x5140, 0x0863, 0x38E0, 0x0007, 0x0863, 0x8001, 0x4101, 0x000C, 0x0863,
+    0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041,
+    0x015B, 0x0863, 0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863,
+    0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x4101, 0x0007, 0x0863, 0x8007, 0x38E0,
+    0x0863, 0x5140, 0x0863, 0x79E0, 0x0863, 0x0863, 0x001D, 0xFBC0, 0x8007, 0x0863,
+    0x0863, 0x79E0, 0x0863, 0x5140, 0x0863, 0x38E0, 0x0007, 0x0863, 0x8001, 0x4101,
+    0x000B, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863,
+    0x8001, 0x1041, 0x015B, 0x0863, 0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081,
+    0x000B, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x4101, 0x0008, 0x0863,
+    0x8006, 0x38E0, 0x0863, 0x5140, 0x0863, 0x79E0, 0x0863, 0x001D, 0xFBC0, 0x8006,
+    0x0863, 0x79E0, 0x0863, 0x5140, 0x0863, 0x38E0, 0x0008, 0x0863, 0x8001, 0x4101,
+    0x000B, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863,
+    0x8001, 0x1041, 0x015C, 0x0863, 0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081,
+    0x000B, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x4101, 0x0008, 0x0863,
+    0x8007, 0x38E0, 0x0863, 0x5140, 0x0863, 0x79E0, 0x0863, 0x0863, 0x001B, 0xFBC0,
+    0x8007, 0x0863, 0x0863, 0x79E0, 0x0863, 0x5140, 0x0863, 0x38E0, 0x0008, 0x0863,
+    0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x2081,
+    0x000B, 0x0863, 0x8001, 0x1041, 0x015D, 0x0863, 0x8001, 0x1041, 0x000B, 0x0863,
+    0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x4101,
+    0x0007, 0x0863, 0x8008, 0x38E0, 0x0863, 0x0863, 0x5140, 0x0863, 0x79E0, 0x0863,
+    0x0863, 0x0019, 0xFBC0, 0x8008, 0x0863, 0x0863, 0x79E0, 0x0863, 0x5140, 0x0863,
+    0x0863, 0x38E0, 0x0007, 0x0863, 0x8001, 0x4101, 0x000C, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015D, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000C, 0x0863, 0x8001, 0x4101, 0x0008, 0x0863, 0x8007, 0x38E0, 0x0863, 0x5140,
+    0x0863, 0x0863, 0x79E0, 0x0863, 0x0019, 0xFBC0, 0x8007, 0x0863, 0x79E0, 0x0863,
+    0x0863, 0x5140, 0x0863, 0x38E0, 0x0008, 0x0863, 0x8001, 0x4101, 0x000C, 0x0863,
+    0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041,
+    0x015D, 0x0863, 0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863,
+    0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x4101, 0x0008, 0x0863, 0x8007, 0x38E0,
+    0x0863, 0x5140, 0x0863, 0x0863, 0x79E0, 0x0863, 0x0017, 0xFBC0, 0x8007, 0x0863,
+    0x79E0, 0x0863, 0x0863, 0x5140, 0x0863, 0x38E0, 0x0008, 0x0863, 0x8001, 0x4101,
+    0x000C, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863,
+    0x8001, 0x1041, 0x015D, 0x0863, 0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081,
+    0x000B, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x4101, 0x0008, 0x0863,
+    0x8009, 0x38E0, 0x0863, 0x0863, 0x5140, 0x0863, 0x0863, 0x79E0, 0x0863, 0x0863,
+    0x0013, 0xFBC0, 0x8009, 0x0863, 0x0863, 0x79E0, 0x0863, 0x0863, 0x5140, 0x0863,
+    0x0863, 0x38E0, 0x0008, 0x0863, 0x8001, 0x4101, 0x000C, 0x0863, 0x8001, 0x30C1,
+    0x000B, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x1041, 0x015E, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x30C1,
+    0x000C, 0x0863, 0x8001, 0x4101, 0x0009, 0x0863, 0x8009, 0x38E0, 0x0863, 0x0863,
+    0x5140, 0x0863, 0x0863, 0x79E0, 0x0863, 0x0863, 0x0011, 0xFBC0, 0x8009, 0x0863,
+    0x0863, 0x79E0, 0x0863, 0x0863, 0x5140, 0x0863, 0x0863, 0x38E0, 0x0009, 0x0863,
+    0x8001, 0x4101, 0x000C, 0x0863, 0x8001, 0x30C1, 0x000B, 0x0863, 0x8001, 0x2081,
+    0x000B, 0x0863, 0x8001, 0x1041, 0x015F, 0x0863, 0x8001, 0x1041, 0x000B, 0x0863,
+    0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x4101,
+    0x0009, 0x0863, 0x8007, 0x38E0, 0x0863, 0x0863, 0x5140, 0x0863, 0x0863, 0x79E0,
+    0x0003, 0x0863, 0x000D, 0xFBC0, 0x0003, 0x0863, 0x8007, 0x79E0, 0x0863, 0x0863,
+    0x5140, 0x0863, 0x0863, 0x38E0, 0x0009, 0x0863, 0x8001, 0x4101, 0x000C, 0x0863,
+    0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041,
+    0x015F, 0x0863, 0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863,
+    0x8001, 0x30C1, 0x000D, 0x0863, 0x8001, 0x4101, 0x0009, 0x0863, 0x8008, 0x38E0,
+    0x0863, 0x0863, 0x5140, 0x0863, 0x0863, 0x79E0, 0x79E0, 0x0004, 0x0863, 0x0007,
+    0xFBC0, 0x0004, 0x0863, 0x8008, 0x79E0, 0x79E0, 0x0863, 0x0863, 0x5140, 0x0863,
+    0x0863, 0x38E0, 0x0009, 0x0863, 0x8001, 0x4101, 0x000D, 0x0863, 0x8001, 0x30C1,
+    0x000C, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x015F, 0x0863,
+    0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x30C1,
+    0x000C, 0x0863, 0x8001, 0x4101, 0x000A, 0x0863, 0x8007, 0x38E0, 0x0863, 0x0863,
+    0x5140, 0x5140, 0x0863, 0x0863, 0x0003, 0x79E0, 0x0009, 0x0863, 0x0003, 0x79E0,
+    0x8007, 0x0863, 0x0863, 0x5140, 0x5140, 0x0863, 0x0863, 0x38E0, 0x000A, 0x0863,
+    0x8001, 0x4101, 0x000C, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x2081,
+    0x000C, 0x0863, 0x8001, 0x1041, 0x0160, 0x0863, 0x8001, 0x1041, 0x000B, 0x0863,
+    0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x30C1, 0x000D, 0x0863, 0x8001, 0x4101,
+    0x000A, 0x0863, 0x8006, 0x38E0, 0x38E0, 0x0863, 0x0863, 0x5140, 0x5140, 0x0003,
+    0x0863, 0x0009, 0x79E0, 0x0003, 0x0863, 0x8006, 0x5140, 0x5140, 0x0863, 0x0863,
+    0x38E0, 0x38E0, 0x000A, 0x0863, 0x8001, 0x4101, 0x000D, 0x0863, 0x8001, 0x30C1,
+    0x000C, 0x0863, 0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x0161, 0x0863,
+    0x8001, 0x1041, 0x000B, 0x0863, 0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x30C1,
+    0x000D, 0x0863, 0x8001, 0x4101, 0x000B, 0x0863, 0x8001, 0x38E0, 0x0003, 0x0863,
+    0x0003, 0x5140, 0x0009, 0x0863, 0x0003, 0x5140, 0x0003, 0x0863, 0x8001, 0x38E0,
+    0x000B, 0x0863, 0x8001, 0x4101, 0x000D, 0x0863, 0x8001, 0x30C1, 0x000D, 0x0863,
+    0x8001, 0x2081, 0x000B, 0x0863, 0x8001, 0x1041, 0x0161, 0x0863, 0x8001, 0x1041,
+    0x000C, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x30C1, 0x000E, 0x0863,
+    0x8001, 0x4101, 0x000B, 0x0863, 0x0003, 0x38E0, 0x0003, 0x0863, 0x0009, 0x5140,
+    0x0003, 0x0863, 0x0003, 0x38E0, 0x000B, 0x0863, 0x8001, 0x4101, 0x000E, 0x0863,
+    0x8001, 0x30C1, 0x000C, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x1041,
+    0x0161, 0x0863, 0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081, 0x000D, 0x0863,
+    0x8001, 0x30C1, 0x000E, 0x0863, 0x8001, 0x4101, 0x000D, 0x0863, 0x0003, 0x38E0,
+    0x0009, 0x0863, 0x0003, 0x38E0, 0x000D, 0x0863, 0x8001, 0x4101, 0x000E, 0x0863,
+    0x8001, 0x30C1, 0x000D, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x1041,
+    0x0162, 0x0863, 0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863,
+    0x8001, 0x30C1, 0x000F, 0x0863, 0x8001, 0x4101, 0x000F, 0x0863, 0x0009, 0x38E0,
+    0x000F, 0x0863, 0x8001, 0x4101, 0x000F, 0x0863, 0x8001, 0x30C1, 0x000C, 0x0863,
+    0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x1041, 0x0163, 0x0863, 0x8001, 0x1041,
+    0x000C, 0x0863, 0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x30C1, 0x000F, 0x0863,
+    0x8001, 0x4101, 0x0025, 0x0863, 0x8001, 0x4101, 0x000F, 0x0863, 0x8001, 0x30C1,
+    0x000D, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x1041, 0x0164, 0x0863,
+    0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x30C1,
+    0x000F, 0x0863, 0x8001, 0x4101, 0x0023, 0x0863, 0x8001, 0x4101, 0x000F, 0x0863,
+    0x8001, 0x30C1, 0x000D, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x1041,
+    0x0165, 0x0863, 0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081, 0x000D, 0x0863,
+    0x8001, 0x30C1, 0x0010, 0x0863, 0x8002, 0x4101, 0x4101, 0x001F, 0x0863, 0x8002,
+    0x4101, 0x4101, 0x0010, 0x0863, 0x8001, 0x30C1, 0x000D, 0x0863, 0x8001, 0x2081,
+    0x000C, 0x0863, 0x8001, 0x1041, 0x0165, 0x0863, 0x8001, 0x1041, 0x000D, 0x0863,
+    0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x30C1, 0x0011, 0x0863, 0x8001, 0x4101,
+    0x001D, 0x0863, 0x8001, 0x4101, 0x0011, 0x0863, 0x8001, 0x30C1, 0x000D, 0x0863,
+    0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x1041, 0x0166, 0x0863, 0x8001, 0x1041,
+    0x000C, 0x0863, 0x8001, 0x2081, 0x000E, 0x0863, 0x8001, 0x30C1, 0x0011, 0x0863,
+    0x0003, 0x4101, 0x0017, 0x0863, 0x0003, 0x4101, 0x0011, 0x0863, 0x8001, 0x30C1,
+    0x000E, 0x0863, 0x8001, 0x2081, 0x000C, 0x0863, 0x8001, 0x1041, 0x0167, 0x0863,
+    0x8001, 0x1041, 0x000D, 0x0863, 0x8001, 0x2081, 0x000E, 0x0863, 0x8001, 0x30C1,
+    0x0013, 0x0863, 0x8002, 0x4101, 0x4101, 0x0013, 0x0863, 0x8002, 0x4101, 0x4101,
+    0x0013, 0x0863, 0x8001, 0x30C1, 0x000E, 0x0863, 0x8001, 0x2081, 0x000D, 0x0863,
+    0x8001, 0x1041, 0x0168, 0x0863, 0x8001, 0x1041, 0x000C, 0x0863, 0x8001, 0x2081,
+    0x000F, 0x0863, 0x8001, 0x30C1, 0x0014, 0x0863, 0x0004, 0x4101, 0x000B, 0x0863,
+    0x0004, 0x4101, 0x0014, 0x0863, 0x8001, 0x30C1, 0x000F, 0x0863, 0x8001, 0x2081,
+    0x000C, 0x0863, 0x8001, 0x1041, 0x0169, 0x0863, 0x8001, 0x1041, 0x000D, 0x0863,
+    0x8001, 0x2081, 0x000F, 0x0863, 0x8001, 0x30C1, 0x0017, 0x0863, 0x000B, 0x4101,
+    0x0017, 0x0863, 0x8001, 0x30C1, 0x000F, 0x0863, 0x8001, 0x2081, 0x000D, 0x0863,
+    0x8001, 0x1041, 0x016A, 0x0863, 0x8001, 0x1041, 0x000D, 0x0863, 0x8001, 0x2081,
+    0x000F, 0x0863, 0x8001, 0x30C1, 0x0037, 0x0863, 0x8001, 0x30C1, 0x000F, 0x0863,
+    0x8001, 0x2081, 0x000D, 0x0863, 0x8001, 0x1041, 0x016B, 0x0863, 0x8001, 0x1041,
+    0x000E, 0x0863, 0x8001, 0x2081, 0x000F, 0x0863, 0x8001, 0x30C1, 0x0035, 0x0863,
+    0x8001, 0x30C1, 0x000F, 0x0863, 0x8001, 0x2081, 0x000E, 0x0863, 0x8001, 0x1041,
+    0x016C, 0x0863, 0x8001, 0x1041, 0x000D, 0x0863, 0x8001, 0x2081, 0x0010, 0x0863,
+    0x8001, 0x30C1, 0x0033, 0x0863, 0x8001, 0x30C1, 0x0010, 0x0863, 0x8001, 0x2081,
+    0x000D, 0x0863, 0x8001, 0x1041, 0x016D, 0x0863, 0x8001, 0x1041, 0x000E, 0x0863,
+    0x8001, 0x2081, 0x0010, 0x0863, 0x8002, 0x30C1, 0x30C1, 0x002F, 0x0863, 0x8002,
+    0x30C1, 0x30C1, 0x0010, 0x0863, 0x8001, 0x2081, 0x000E, 0x0863, 0x8001, 0x1041,
+    0x016E, 0x0863, 0x8001, 0x1041, 0x000E, 0x0863, 0x8001, 0x2081, 0x0011, 0x0863,
+    0x8001, 0x30C1, 0x002D, 0x0863, 0x8001, 0x30C1, 0x0011, 0x0863, 0x8001, 0x2081,
+    0x000E, 0x0863, 0x8001, 0x1041, 0x0170, 0x0863, 0x8001, 0x1041, 0x000E, 0x0863,
+    0x8001, 0x2081, 0x0011, 0x0863, 0x8002, 0x30C1, 0x30C1, 0x0029, 0x0863, 0x8002,
+    0x30C1, 0x30C1, 0x0011, 0x0863, 0x8001, 0x2081, 0x000E, 0x0863, 0x8001, 0x1041,
+    0x0171, 0x0863, 0x8001, 0x1041, 0x000F, 0x0863, 0x8001, 0x2081, 0x0012, 0x0863,
+    0x8002, 0x30C1, 0x30C1, 0x0025, 0x0863, 0x8002, 0x30C1, 0x30C1, 0x0012, 0x0863,
+    0x8001, 0x2081, 0x000F, 0x0863, 0x8001, 0x1041, 0x0172, 0x0863, 0x8001, 0x1041,
+    0x000F, 0x0863, 0x8001, 0x2081, 0x0013, 0x0863, 0x8002, 0x30C1, 0x30C1, 0x0021,
+    0x0863, 0x8002, 0x30C1, 0x30C1, 0x0013, 0x0863, 0x8001, 0x2081, 0x000F, 0x0863,
+    0x8001, 0x1041, 0x0174, 0x0863, 0x8001, 0x1041, 0x000F, 0x0863, 0x8001, 0x2081,
+    0x0014, 0x0863, 0x8002, 0x30C1, 0x30C1, 0x001D, 0x0863, 0x8002, 0x30C1, 0x30C1,
+    0x0014, 0x0863, 0x8001, 0x2081, 0x000F, 0x0863, 0x8001, 0x1041, 0x00BA, 0x0863,
+    0x00BC, 0x0862, 0x8001, 0x1041, 0x000F, 0x0862, 0x8001, 0x2081, 0x0015, 0x0862,
+    0x0003, 0x30C1, 0x0017, 0x0862, 0x0003, 0x30C1, 0x0015, 0x0862, 0x8001, 0x2081,
+    0x000F, 0x0862, 0x8001, 0x1041, 0x0177, 0x0862, 0x8001, 0x1041, 0x0010, 0x0862,
+    0x8001, 0x2081, 0x0017, 0x0862, 0x0005, 0x30C1, 0x000D, 0x0862, 0x0005, 0x30C1,
+    0x0017, 0x0862, 0x8001, 0x2081, 0x0010, 0x0862, 0x8001, 0x1041, 0x0178, 0x0862,
+    0x8001, 0x1041, 0x0010, 0x0862, 0x8001, 0x2081, 0x001B, 0x0862, 0x000D, 0x30C1,
+    0x001B, 0x0862, 0x8001, 0x2081, 0x0010, 0x0862, 0x8001, 0x1041, 0x017A, 0x0862,
+    0x8001, 0x1041, 0x0010, 0x0862, 0x8002, 0x2081, 0x2081, 0x003F, 0x0862, 0x8002,
+    0x2081, 0x2081, 0x0010, 0x0862, 0x8001, 0x1041, 0x017C, 0x0862, 0x8001, 0x1041,
+    0x0011, 0x0862, 0x8001, 0x2081, 0x003D, 0x0862, 0x8001, 0x2081, 0x0011, 0x0862,
+    0x8001, 0x1041, 0x017E, 0x0862, 0x8001, 0x1041, 0x0011, 0x0862, 0x8001, 0x2081,
+    0x003B, 0x0862, 0x8001, 0x2081, 0x0011, 0x0862, 0x8001, 0x1041, 0x0180, 0x0862,
+    0x8001, 0x1041, 0x0011, 0x0862, 0x8002, 0x2081, 0x2081, 0x0037, 0x0862, 0x8002,
+    0x2081, 0x2081, 0x0011, 0x0862, 0x8001, 0x1041, 0x0182, 0x0862, 0x8001, 0x1041,
+    0x0012, 0x0862, 0x8002, 0x2081, 0x2081, 0x0033, 0x0862, 0x8002, 0x2081, 0x2081,
+    0x0012, 0x0862, 0x8001, 0x1041, 0x0184, 0x0862, 0x8001, 0x1041, 0x0013, 0x0862,
+    0x8002, 0x2081, 0x2081, 0x002F, 0x0862, 0x8002, 0x2081, 0x2081, 0x0013, 0x0862,
+    0x8001, 0x1041, 0x0186, 0x0862, 0x8001, 0x1041, 0x0014, 0x0862, 0x8002, 0x2081,
+    0x2081, 0x002B, 0x0862, 0x8002, 0x2081, 0x2081, 0x0014, 0x0862, 0x8001, 0x1041,
+    0x0188, 0x0862, 0x8001, 0x1041, 0x0015, 0x0862, 0x8002, 0x2081, 0x2081, 0x0027,
+    0x0862, 0x8002, 0x2081, 0x2081, 0x0015, 0x0862, 0x8001, 0x1041, 0x018A, 0x0862,
+    0x8001, 0x1041, 0x0016, 0x0862, 0x0003, 0x2081, 0x0021, 0x0862, 0x0003, 0x2081,
+    0x0016, 0x0862, 0x8001, 0x1041, 0x018C, 0x0862, 0x8002, 0x1041, 0x1041, 0x0017,
+    0x0862, 0x0004, 0x2081, 0x0019, 0x0862, 0x0004, 0x2081, 0x0017, 0x0862, 0x8002,
+    0x1041, 0x1041, 0x018F, 0x0862, 0x8001, 0x1041, 0x001A, 0x0862, 0x0005, 0x2081,
+    0x000F, 0x0862, 0x0005, 0x2081, 0x001A, 0x0862, 0x8001, 0x1041, 0x0192, 0x0862,
+    0x8001, 0x1041, 0x001E, 0x0862, 0x000F, 0x2081, 0x001E, 0x0862, 0x8001, 0x1041,
+    0x0194, 0x0862, 0x8002, 0x1041, 0x1041, 0x0047, 0x0862, 0x8002, 0x1041, 0x1041,
+    0x0197, 0x0862, 0x8001, 0x1041, 0x0045, 0x0862, 0x8001, 0x1041, 0x019A, 0x0862,
+    0x8002, 0x1041, 0x1041, 0x0041, 0x0862, 0x8002, 0x1041, 0x1041, 0x019D, 0x0862,
+    0x8002, 0x1041, 0x1041, 0x003D, 0x0862, 0x8002, 0x1041, 0x1041, 0x01A1, 0x0862,
+    0x8002, 0x1041, 0x1041, 0x0039, 0x0862, 0x8002, 0x1041, 0x1041, 0x00DB, 0x0862,
+    0x0005, 0xFBC0, 0x01C3, 0xCAC0, 0x0018, 0x0862, 0x0005, 0xFBC0, 0x01C3, 0x39EA,
+    0x8001, 0xCAC0, 0x0017, 0x0862, 0x0005, 0xFBC0, 0x01C4, 0x18C5, 0x8001, 0xCAC0,
+    0x0016, 0x0862, 0x0005, 0xFBC0, 0x01C5, 0x18C5, 0x8001, 0xCAC0, 0x0015, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8001, 0xCAC0, 0x0014, 0x0862, 0x0005, 0xFBC0,
+    0x01C6, 0x18C5, 0x8002, 0xCAC0, 0x0021, 0x0013, 0x0862, 0x0005, 0xFBC0, 0x01C6,
+    0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862, 0x0005, 0xFBC0, 0x01C6,
+    0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862, 0x0005, 0xFBC0, 0x01C6,
+    0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862, 0x0005, 0xFBC0, 0x01C6,
+    0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862, 0x0005, 0xFBC0, 0x000A,
+    0x18C5, 0x0004, 0x63B1, 0x8001, 0x18C5, 0x0005, 0x63B1, 0x8002, 0x18C5, 0x63B1,
+    0x0003, 0x18C5, 0x8002, 0x63B1, 0x18C5, 0x0003, 0x63B1, 0x0004, 0x18C5, 0x0003,
+    0x63B1, 0x8003, 0x18C5, 0x18C5, 0x63B1, 0x0003, 0x18C5, 0x8003, 0x63B1, 0x18C5,
+    0x18C5, 0x0003, 0x63B1, 0x0195, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012,
+    0x0862, 0x0005, 0xFBC0, 0x0009, 0x18C5, 0x8001, 0x63B1, 0x0005, 0x18C5, 0x8001,
+    0x63B1, 0x0005, 0x18C5, 0x8001, 0x63B1, 0x0003, 0x18C5, 0x8006, 0x63B1, 0x18C5,
+    0x63B1, 0x18C5, 0x18C5, 0x63B1, 0x0004, 0x18C5, 0x8001, 0x63B1, 0x0003, 0x18C5,
+    0x8001, 0x63B1, 0x0003, 0x18C5, 0x8003, 0x63B1, 0x18C5, 0x63B1, 0x0003, 0x18C5,
+    0x8005, 0x63B1, 0x18C5, 0x18C5, 0x63B1, 0x63B1, 0x0190, 0x18C5, 0x8003, 0xCAC0,
+    0x0021, 0x0021, 0x0012, 0x0862, 0x0005, 0xFBC0, 0x0009, 0x18C5, 0x8001, 0x63B1,
+    0x0005, 0x18C5, 0x8001, 0x63B1, 0x0005, 0x18C5, 0x8007, 0x63B1, 0x63B1, 0x18C5,
+    0x18C5, 0x63B1, 0x18C5, 0x63B1, 0x0003, 0x18C5, 0x8001, 0x63B1, 0x0003, 0x18C5,
+    0x8001, 0x63B1, 0x0003, 0x18C5, 0x8007, 0x63B1, 0x63B1, 0x18C5, 0x18C5, 0x63B1,
+    0x18C5, 0x63B1, 0x0006, 0x18C5, 0x8002, 0x63B1, 0x63B1, 0x0190, 0x18C5, 0x8003,
+    0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862, 0x0005, 0xFBC0, 0x000A, 0x18C5, 0x0003,
+    0x63B1, 0x8002, 0x18C5, 0x18C5, 0x0004, 0x63B1, 0x8009, 0x18C5, 0x18C5, 0x63B1,
+    0x18C5, 0x63B1, 0x18C5, 0x63B1, 0x18C5, 0x63B1, 0x0003, 0x18C5, 0x8001, 0x63B1,
+    0x0003, 0x18C5, 0x8001, 0x63B1, 0x0003, 0x18C5, 0x8007, 0x63B1, 0x18C5, 0x63B1,
+    0x18C5, 0x63B1, 0x18C5, 0x63B1, 0x0198, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021,
+    0x0012, 0x0862, 0x0005, 0xFBC0, 0x000D, 0x18C5, 0x8003, 0x63B1, 0x18C5, 0x63B1,
+    0x0005, 0x18C5, 0x8007, 0x63B1, 0x18C5, 0x18C5, 0x63B1, 0x63B1, 0x18C5, 0x63B1,
+    0x0003, 0x18C5, 0x8001, 0x63B1, 0x0003, 0x18C5, 0x8001, 0x63B1, 0x0003, 0x18C5,
+    0x800F, 0x63B1, 0x18C5, 0x18C5, 0x63B1, 0x63B1, 0x18C5, 0x63B1, 0x18C5, 0x18C5,
+    0x63B1, 0x63B1, 0x18C5, 0x18C5, 0x63B1, 0x63B1, 0x0190, 0x18C5, 0x8003, 0xCAC0,
+    0x0021, 0x0021, 0x0012, 0x0862, 0x0005, 0xFBC0, 0x000D, 0x18C5, 0x8003, 0x63B1,
+    0x18C5, 0x63B1, 0x0005, 0x18C5, 0x8001, 0x63B1, 0x0003, 0x18C5, 0x8006, 0x63B1,
+    0x18C5, 0x63B1, 0x18C5, 0x18C5, 0x63B1, 0x0004, 0x18C5, 0x8001, 0x63B1, 0x0003,
+    0x18C5, 0x8001, 0x63B1, 0x0003, 0x18C5, 0x8003, 0x63B1, 0x18C5, 0x63B1, 0x0003,
+    0x18C5, 0x8005, 0x63B1, 0x18C5, 0x18C5, 0x63B1, 0x63B1, 0x0190, 0x18C5, 0x8003,
+    0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862, 0x0005, 0xFBC0, 0x0009, 0x18C5, 0x0004,
+    0x63B1, 0x8002, 0x18C5, 0x18C5, 0x0005, 0x63B1, 0x8002, 0x18C5, 0x63B1, 0x0003,
+    0x18C5, 0x8002, 0x63B1, 0x18C5, 0x0003, 0x63B1, 0x0004, 0x18C5, 0x0003, 0x63B1,
+    0x8003, 0x18C5, 0x18C5, 0x63B1, 0x0003, 0x18C5, 0x8003, 0x63B1, 0x18C5, 0x18C5,
+    0x0003, 0x63B1, 0x0195, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C6, 0x18C5, 0x8003, 0xCAC0, 0x0021, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C5, 0x18C5, 0x8001, 0xCAC0, 0x0003, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C4, 0x18C5, 0x8001, 0xCAC0, 0x0004, 0x0021, 0x0012, 0x0862,
+    0x0005, 0xFBC0, 0x01C3, 0x18C5, 0x8001, 0xCAC0, 0x0004, 0x0021, 0x0013, 0x0862,
+    0x0005, 0xFBC0, 0x01C3, 0xCAC0, 0x0004, 0x0021, 0x0019, 0x0862, 0x01C6, 0x0021,
+    0x001B, 0x0862, 0x01C4, 0x0021, 0x7FFF, 0x0862, 0x250D, 0x0862,
+};
+constexpr lifeline::PanelImage SENDING = {480, 320, SENDING_WORDS, 6298};
+constexpr lifeline::FieldRect SENDING_ALERT = {24, 206, 130, 16};
+
+// RESULT_SENT: 4526 bytes (1.5% of 300 KB raw)
+constexpr uint16_t RESULT_SENT_WORDS[] = {
+    0x14A0, 0x1148, 0x05A0, 0x1128, 0x000C, 0x1127, 0x0008, 0xFFFF, 0x8004, 0x1127,
+    0x1127, 0xFFFF, 0xFFFF, 0x0006, 0x1127, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x1127,
+    0x0006, 0xFFFF, 0x0006, 0x1127, 0x0006, 0xFFFF, 0x0004, 0x1127, 0x000A, 0xFFFF,
+    0x0004, 0x1127, 0x0008, 0xFFFF, 0x0004, 0x1127, 0x0008, 0xFFFF, 0x0190, 0x1127,
+    0x0008, 0xFFFF, 0x8005, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0003, 0x1127, 0x0006, 0xFFFF, 0x8001, 0x0000,
+    0x0005, 0x1127, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1127, 0x000A, 0xFFFF,
+    0x8001, 0x0000, 0x0003, 0x1127, 0x0008, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1127,
+    0x0008, 0xFFFF, 0x8001, 0x0000, 0x018D, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x1127,
+    0x0008, 0x0000, 0x8004, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007,
+    0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x1127, 0x0005, 0x0000, 0x8007,
+    0xFFFF, 0xFFFF, 0x1127, 0x1127, 0xFFFF, 0xFFFF, 0x1127, 0x0005, 0x0000, 0x8006,
+    0xFFFF, 0xFFFF, 0x1127, 0x1127, 0xFFFF, 0xFFFF, 0x0009, 0x0000, 0x8004, 0x1127,
+    0xFFFF, 0xFFFF, 0x1127, 0x0008, 0x0000, 0x8004, 0x1127, 0xFFFF, 0xFFFF, 0x1127,
+    0x0008, 0x0000, 0x018D, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000,
+    0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000,
+    0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000,
+    0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0195, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127,
+    0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0006, 0x1127,
+    0x8006, 0x0000, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0006, 0x1127, 0x8006,
+    0x0000, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0195, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0005, 0x1127, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000,
+    0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0196, 0x1127, 0x8001, 0x0000, 0x0006, 0xFFFF,
+    0x0004, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8007, 0xFFFF,
+    0xFFFF, 0x0000, 0x1127, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1127, 0x0008, 0xFFFF, 0x0005, 0x1127, 0x8001, 0x0000,
+    0x0006, 0xFFFF, 0x0005, 0x1127, 0x8001, 0x0000, 0x0006, 0xFFFF, 0x0186, 0x1127,
+    0x000C, 0x1107, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1107, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107,
+    0x0008, 0xFFFF, 0x8001, 0x0000, 0x0005, 0x1107, 0x0006, 0xFFFF, 0x8001, 0x0000,
+    0x0005, 0x1107, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0192, 0x1107, 0x0005, 0x0000,
+    0x8007, 0xFFFF, 0xFFFF, 0x1107, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107,
+    0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8002, 0xFFFF, 0xFFFF, 0x0007,
+    0x0000, 0x0006, 0x1107, 0x0005, 0x0000, 0x8002, 0xFFFF, 0xFFFF, 0x0005, 0x1107,
+    0x0005, 0x0000, 0x8002, 0xFFFF, 0xFFFF, 0x0196, 0x1107, 0x8007, 0xFFFF, 0xFFFF,
+    0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8007, 0xFFFF, 0xFFFF,
+    0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0011, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0195,
+    0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x1107, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x1107, 0x1107, 0xFFFF, 0xFFFF, 0x0000, 0x0011,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0195, 0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF,
+    0x0000, 0x0005, 0x1107, 0x8007, 0xFFFF, 0xFFFF, 0x0000, 0x1107, 0xFFFF, 0xFFFF,
+    0x0000, 0x0011, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x018D, 0x1107, 0x0008, 0xFFFF, 0x8006, 0x1107, 0x0000,
+    0x0000, 0x1107, 0x1107, 0x0000, 0x0006, 0xFFFF, 0x8006, 0x1107, 0x0000, 0x0000,
+    0x1107, 0x1107, 0x0000, 0x0006, 0xFFFF, 0x8006, 0x1107, 0x0000, 0x0000, 0x1107,
+    0x1107, 0x0000, 0x0006, 0xFFFF, 0x8004, 0x1107, 0x0000, 0x0000, 0x1107, 0x000A,
+    0xFFFF, 0x8002, 0x1107, 0x1107, 0x0008, 0xFFFF, 0x8004, 0x1107, 0x0000, 0x0000,
+    0x1107, 0x0008, 0xFFFF, 0x8003, 0x1107, 0x0000, 0x0000, 0x018D, 0x1107, 0x0008,
+    0xFFFF, 0x8001, 0x0000, 0x0005, 0x1107, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0005,
+    0x1107, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0005, 0x1107, 0x0006, 0xFFFF, 0x8001,
+    0x0000, 0x0003, 0x1107, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x1107, 0x0008, 0xFFFF,
+    0x8001, 0x0000, 0x0003, 0x1107, 0x0008, 0xFFFF, 0x8001, 0x0000, 0x0185, 0x1107,
+    0x000B, 0x1106, 0x0008, 0x0000, 0x0006, 0x1106, 0x0006, 0x0000, 0x0006, 0x1106,
+    0x0006, 0x0000, 0x0006, 0x1106, 0x0006, 0x0000, 0x0004, 0x1106, 0x000A, 0x0000,
+    0x8002, 0x1106, 0x1106, 0x0008, 0x0000, 0x0004, 0x1106, 0x0008, 0x0000, 0x0725,
+    0x1106, 0x0F00, 0x10E6, 0x01E0, 0x04B9, 0x01E0, 0x06BF, 0x01E0, 0x04B9, 0x2760,
+    0x0943, 0x284B, 0x0923, 0x000B, 0x07F0, 0x01D0, 0x0923, 0x0015, 0x07F0, 0x01C9,
+    0x0923, 0x0019, 0x07F0, 0x01C4, 0x0923, 0x001F, 0x07F0, 0x01BF, 0x0923, 0x0023,
+    0x07F0, 0x01BC, 0x0923, 0x0025, 0x07F0, 0x01B9, 0x0923, 0x0029, 0x07F0, 0x01B6,
+    0x0923, 0x002B, 0x07F0, 0x01B4, 0x0923, 0x002D, 0x07F0, 0x01B2, 0x0923, 0x002F,
+    0x07F0, 0x01B0, 0x0923, 0x0031, 0x07F0, 0x01AE, 0x0923, 0x0033, 0x07F0, 0x01AC,
+    0x0923, 0x0035, 0x07F0, 0x01AA, 0x0923, 0x0037, 0x07F0, 0x01A8, 0x0923, 0x0039,
+    0x07F0, 0x01A6, 0x0923, 0x003B, 0x07F0, 0x01A5, 0x0923, 0x003B, 0x07F0, 0x01A4,
+    0x0923, 0x003D, 0x07F0, 0x01A2, 0x0923, 0x003F, 0x07F0, 0x01A1, 0x0923, 0x003F,
+    0x07F0, 0x01A0, 0x0923, 0x0041, 0x07F0, 0x019F, 0x0923, 0x0041, 0x07F0, 0x019F,
+    0x0923, 0x0041, 0x07F0, 0x019E, 0x0923, 0x0031, 0x07F0, 0x8001, 0x0841, 0x0011,
+    0x07F0, 0x019D, 0x0923, 0x0030, 0x07F0, 0x8002, 0x0841, 0x0841, 0x0011, 0x07F0,
+    0x019C, 0x0923, 0x0030, 0x07F0, 0x0003, 0x0841, 0x0012, 0x07F0, 0x019B, 0x0923,
+    0x002F, 0x07F0, 0x0004, 0x0841, 0x0012, 0x07F0, 0x019B, 0x0923, 0x002E, 0x07F0,
+    0x0005, 0x0841, 0x0012, 0x07F0, 0x019B, 0x0923, 0x002D, 0x07F0, 0x0005, 0x0841,
+    0x0013, 0x07F0, 0x019B, 0x0923, 0x002D, 0x07F0, 0x0004, 0x0841, 0x0014, 0x07F0,
+    0x019A, 0x0923, 0x002D, 0x07F0, 0x0004, 0x0841, 0x0016, 0x07F0, 0x0199, 0x0923,
+    0x002C, 0x07F0, 0x0004, 0x0841, 0x0017, 0x07F0, 0x0199, 0x0923, 0x002B, 0x07F0,
+    0x0004, 0x0841, 0x0018, 0x07F0, 0x0199, 0x0923, 0x0015, 0x07F0, 0x8001, 0x0841,
+    0x0014, 0x07F0, 0x0005, 0x0841, 0x0018, 0x07F0, 0x0199, 0x0923, 0x0015, 0x07F0,
+    0x8002, 0x0841, 0x0841, 0x0012, 0x07F0, 0x0005, 0x0841, 0x0019, 0x07F0, 0x0199,
+    0x0923, 0x0015, 0x07F0, 0x0003, 0x0841, 0x0010, 0x07F0, 0x0005, 0x0841, 0x001A,
+    0x07F0, 0x0199, 0x0923, 0x0015, 0x07F0, 0x0003, 0x0841, 0x000F, 0x07F0, 0x0005,
+    0x0841, 0x001B, 0x07F0, 0x0199, 0x0923, 0x0015, 0x07F0, 0x0004, 0x0841, 0x000D,
+    0x07F0, 0x0005, 0x0841, 0x001C, 0x07F0, 0x0199, 0x0923, 0x0016, 0x07F0, 0x0004,
+    0x0841, 0x000B, 0x07F0, 0x0005, 0x0841, 0x001D, 0x07F0, 0x0199, 0x0923, 0x0017,
+    0x07F0, 0x0004, 0x0841, 0x0009, 0x07F0, 0x0005, 0x0841, 0x001E, 0x07F0, 0x0199,
+    0x0923, 0x0017, 0x07F0, 0x0005, 0x0841, 0x0008, 0x07F0, 0x0004, 0x0841, 0x001F,
+    0x07F0, 0x019A, 0x0923, 0x0017, 0x07F0, 0x0005, 0x0841, 0x0006, 0x07F0, 0x0004,
+    0x0841, 0x001F, 0x07F0, 0x019B, 0x0923, 0x0018, 0x07F0, 0x0004, 0x0841, 0x0005,
+    0x07F0, 0x0004, 0x0841, 0x0020, 0x07F0, 0x00CD, 0x0923, 0x00CE, 0x0903, 0x0019,
+    0x07F0, 0x0004, 0x0841, 0x0003, 0x07F0, 0x0004, 0x0841, 0x0021, 0x07F0, 0x019B,
+    0x0903, 0x001A, 0x07F0, 0x0004, 0x0841, 0x8001, 0x07F0, 0x0005, 0x0841, 0x0021,
+    0x07F0, 0x019B, 0x0903, 0x001B, 0x07F0, 0x0008, 0x0841, 0x0022, 0x07F0, 0x019C,
+    0x0903, 0x001A, 0x07F0, 0x0007, 0x0841, 0x0022, 0x07F0, 0x019D, 0x0903, 0x001B,
+    0x07F0, 0x0005, 0x0841, 0x0023, 0x07F0, 0x019E, 0x0903, 0x001B, 0x07F0, 0x0003,
+    0x0841, 0x0023, 0x07F0, 0x019F, 0x0903, 0x001C, 0x07F0, 0x8001, 0x0841, 0x0024,
+    0x07F0, 0x019F, 0x0903, 0x0041, 0x07F0, 0x01A0, 0x0903, 0x003F, 0x07F0, 0x01A1,
+    0x0903, 0x003F, 0x07F0, 0x01A2, 0x0903, 0x003D, 0x07F0, 0x01A4, 0x0903, 0x003B,
+    0x07F0, 0x01A5, 0x0903, 0x003B, 0x07F0, 0x01A6, 0x0903, 0x0039, 0x07F0, 0x01A8,
+    0x0903, 0x0037, 0x07F0, 0x01AA, 0x0903, 0x0035, 0x07F0, 0x01AC, 0x0903, 0x0033,
+    0x07F0, 0x01AE, 0x0903, 0x0031, 0x07F0, 0x01B0, 0x0903, 0x002F, 0x07F0, 0x01B2,
+    0x0903, 0x002D, 0x07F0, 0x01B4, 0x0903, 0x002B, 0x07F0, 0x01B6, 0x0903, 0x0029,
+    0x07F0, 0x01B9, 0x0903, 0x0025, 0x07F0, 0x01BC, 0x0903, 0x0023, 0x07F0, 0x01BF,
+    0x0903, 0x001F, 0x07F0, 0x01C4, 0x0903, 0x0019, 0x07F0, 0x01C9, 0x0903, 0x0015,
+    0x07F0, 0x01D0, 0x0903, 0x000B, 0x07F0, 0x086A, 0x0903, 0x2622, 0x0902, 0x8002,
+    0x37F4, 0x37F4, 0x0006, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0058, 0x0902, 0x0008,
+    0x37F4, 0x001C, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x000C, 0x0902, 0x8002, 0x37F4,
+    0x37F4, 0x014A, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0006, 0x0902, 0x8002, 0x37F4,
+    0x37F4, 0x0058, 0x0902, 0x0008, 0x37F4, 0x001C, 0x0902, 0x8002, 0x37F4, 0x37F4,
+    0x000C, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x014A, 0x0902, 0x0004, 0x37F4, 0x8002,
+    0x0902, 0x0902, 0x0004, 0x37F4, 0x0056, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0024,
+    0x0902, 0x8002, 0x37F4, 0x37F4, 0x000C, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x014A,
+    0x0902, 0x0004, 0x37F4, 0x8002, 0x0902, 0x0902, 0x0004, 0x37F4, 0x0056, 0x0902,
+    0x8002, 0x37F4, 0x37F4, 0x0024, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x000C, 0x0902,
+    0x8002, 0x37F4, 0x37F4, 0x014A, 0x0902, 0x800A, 0x37F4, 0x37F4, 0x0902, 0x0902,
+    0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4, 0x0004, 0x0902, 0x0006, 0x37F4,
+    0x0006, 0x0902, 0x0006, 0x37F4, 0x0006, 0x0902, 0x0006, 0x37F4, 0x0006, 0x0902,
+    0x0006, 0x37F4, 0x0006, 0x0902, 0x0008, 0x37F4, 0x0004, 0x0902, 0x0006, 0x37F4,
+    0x0010, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x000C, 0x0902, 0x0006, 0x37F4, 0x0004,
+    0x0902, 0x8004, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x0004, 0x37F4, 0x0004, 0x0902,
+    0x0006, 0x37F4, 0x000A, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x014A, 0x0902, 0x800A,
+    0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4,
+    0x0004, 0x0902, 0x0006, 0x37F4, 0x0006, 0x0902, 0x0006, 0x37F4, 0x0006, 0x0902,
+    0x0006, 0x37F4, 0x0006, 0x0902, 0x0006, 0x37F4, 0x0006, 0x0902, 0x0008, 0x37F4,
+    0x0004, 0x0902, 0x0006, 0x37F4, 0x0010, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x000C,
+    0x0902, 0x0006, 0x37F4, 0x0004, 0x0902, 0x8004, 0x37F4, 0x37F4, 0x0902, 0x0902,
+    0x0004, 0x37F4, 0x0004, 0x0902, 0x0006, 0x37F4, 0x000A, 0x0902, 0x8002, 0x37F4,
+    0x37F4, 0x014A, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0006, 0x0902, 0x8006, 0x37F4,
+    0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4, 0x0006, 0x0902, 0x8006, 0x37F4, 0x37F4,
+    0x0902, 0x0902, 0x37F4, 0x37F4, 0x000A, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0012,
+    0x0902, 0x8006, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4, 0x0006, 0x0902,
+    0x8006, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4, 0x0006, 0x0902, 0x8002,
+    0x37F4, 0x37F4, 0x0010, 0x0902, 0x0006, 0x37F4, 0x0004, 0x0902, 0x8002, 0x37F4,
+    0x37F4, 0x0006, 0x0902, 0x8004, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x0004, 0x37F4,
+    0x0004, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0004, 0x0902, 0x8002, 0x37F4, 0x37F4,
+    0x000C, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x014A, 0x0902, 0x8002, 0x37F4, 0x37F4,
+    0x0006, 0x0902, 0x8006, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4, 0x0006,
+    0x0902, 0x8006, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4, 0x000A, 0x0902,
+    0x8002, 0x37F4, 0x37F4, 0x0012, 0x0902, 0x8006, 0x37F4, 0x37F4, 0x0902, 0x0902,
+    0x37F4, 0x37F4, 0x0006, 0x0902, 0x8006, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4,
+    0x37F4, 0x0006, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0010, 0x0902, 0x0006, 0x37F4,
+    0x0004, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0006, 0x0902, 0x8004, 0x37F4, 0x37F4,
+    0x0902, 0x0902, 0x0004, 0x37F4, 0x0004, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0004,
+    0x0902, 0x8002, 0x37F4, 0x37F4, 0x000C, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x014A,
+    0x0902, 0x8002, 0x37F4, 0x37F4, 0x0006, 0x0902, 0x8004, 0x37F4, 0x37F4, 0x0902,
+    0x0902, 0x000A, 0x37F4, 0x0004, 0x0902, 0x0006, 0x37F4, 0x0006, 0x0902, 0x0006,
+    0x37F4, 0x0006, 0x0902, 0x0008, 0x37F4, 0x0004, 0x0902, 0x0008, 0x37F4, 0x8002,
+    0x0902, 0x0902, 0x000A, 0x37F4, 0x0016, 0x0902, 0x8004, 0x37F4, 0x37F4, 0x0902,
+    0x0902, 0x000A, 0x37F4, 0x8004, 0x0902, 0x0902, 0x37F4, 0x37F4, 0x0006, 0x0902,
+    0x8002, 0x37F4, 0x37F4, 0x0004, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x000C, 0x0902,
+    0x8002, 0x37F4, 0x37F4, 0x014A, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0006, 0x0902,
+    0x8004, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x000A, 0x37F4, 0x0004, 0x0902, 0x0006,
+    0x37F4, 0x0006, 0x0902, 0x0006, 0x37F4, 0x0006, 0x0902, 0x0008, 0x37F4, 0x0004,
+    0x0902, 0x0008, 0x37F4, 0x8002, 0x0902, 0x0902, 0x000A, 0x37F4, 0x0016, 0x0902,
+    0x8004, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x000A, 0x37F4, 0x8004, 0x0902, 0x0902,
+    0x37F4, 0x37F4, 0x0006, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0004, 0x0902, 0x8002,
+    0x37F4, 0x37F4, 0x000C, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x014A, 0x0902, 0x8002,
+    0x37F4, 0x37F4, 0x0006, 0x0902, 0x8006, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4,
+    0x37F4, 0x0012, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x000A, 0x0902, 0x8006, 0x37F4,
+    0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4, 0x0006, 0x0902, 0x8002, 0x37F4, 0x37F4,
+    0x000A, 0x0902, 0x8006, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4, 0x001E,
+    0x0902, 0x8006, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4, 0x000A, 0x0902,
+    0x8002, 0x37F4, 0x37F4, 0x0006, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0004, 0x0902,
+    0x8002, 0x37F4, 0x37F4, 0x0004, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0152, 0x0902,
+    0x8002, 0x37F4, 0x37F4, 0x0006, 0x0902, 0x8006, 0x37F4, 0x37F4, 0x0902, 0x0902,
+    0x37F4, 0x37F4, 0x0012, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x000A, 0x0902, 0x8006,
+    0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4, 0x0006, 0x0902, 0x8002, 0x37F4,
+    0x37F4, 0x000A, 0x0902, 0x8006, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4,
+    0x001E, 0x0902, 0x8006, 0x37F4, 0x37F4, 0x0902, 0x0902, 0x37F4, 0x37F4, 0x000A,
+    0x0902, 0x8002, 0x37F4, 0x37F4, 0x0006, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x0004,
+    0x0902, 0x8002, 0x37F4, 0x37F4, 0x0004, 0x0902, 0x8002, 0x37F4, 0x37F4, 0x00B0,
+    0x0902, 0x00A2, 0x08E2, 0x8002, 0x37F4, 0x37F4, 0x0006, 0x08E2, 0x8002, 0x37F4,
+    0x37F4, 0x0004, 0x08E2, 0x0006, 0x37F4, 0x0004, 0x08E2, 0x0008, 0x37F4, 0x0004,
+    0x08E2, 0x0008, 0x37F4, 0x0006, 0x08E2, 0x0008, 0x37F4, 0x0006, 0x08E2, 0x0004,
+    0x37F4, 0x0006, 0x08E2, 0x0006, 0x37F4, 0x0010, 0x08E2, 0x0008, 0x37F4, 0x0006,
+    0x08E2, 0x0006, 0x37F4, 0x0004, 0x08E2, 0x8002, 0x37F4, 0x37F4, 0x0006, 0x08E2,
+    0x8002, 0x37F4, 0x37F4, 0x0006, 0x08E2, 0x0004, 0x37F4, 0x0008, 0x08E2, 0x8002,
+    0x37F4, 0x37F4, 0x014A, 0x08E2, 0x8002, 0x37F4, 0x37F4, 0x0006, 0x08E2, 0x8002,
+    0x37F4, 0x37F4, 0x0004, 0x08E2, 0x0006, 0x37F4, 0x0004, 0x08E2, 0x0008, 0x37F4,
+    0x0004, 0x08E2, 0x0008, 0x37F4, 0x0006, 0x08E2, 0x0008, 0x37F4, 0x0006, 0x08E2,
+    0x0004, 0x37F4, 0x0006, 0x08E2, 0x0006, 0x37F4, 0x0010, 0x08E2, 0x0008, 0x37F4,
+    0x0006, 0x08E2, 0x0006, 0x37F4, 0x0004, 0x08E2, 0x8002, 0x37F4, 0x37F4, 0x0006,
+    0x08E2, 0x8002, 0x37F4, 0x37F4, 0x0006, 0x08E2, 0x0004, 0x37F4, 0x0008, 0x08E2,
+    0x8002, 0x37F4, 0x37F4, 0x74E8, 0x08E2, 0x1B0C, 0x08C2, 0x0004, 0x63B1, 0x0009,
+    0x08C2, 0x8001, 0x63B1, 0x0018, 0x08C2, 0x8001, 0x63B1, 0x01B9, 0x08C2, 0x8001,
+    0x63B1, 0x0003, 0x08C2, 0x8001, 0x63B1, 0x0008, 0x08C2, 0x8001, 0x63B1, 0x01D2,
+    0x08C2, 0x8001, 0x63B1, 0x0003, 0x08C2, 0x8003, 0x63B1, 0x08C2, 0x08C2, 0x0003,
+    0x63B1, 0x8002, 0x08C2, 0x08C2, 0x0003, 0x63B1, 0x0003, 0x08C2, 0x8001, 0x63B1,
+    0x0003, 0x08C2, 0x800C, 0x63B1, 0x08C2, 0x63B1, 0x08C2, 0x63B1, 0x63B1, 0x08C2,
+    0x08C2, 0x63B1, 0x08C2, 0x63B1, 0x63B1, 0x0003, 0x08C2, 0x8002, 0x63B1, 0x63B1,
+    0x0003, 0x08C2, 0x8004, 0x63B1, 0x08C2, 0x63B1, 0x63B1, 0x0003, 0x08C2, 0x0004,
+    0x63B1, 0x01AB, 0x08C2, 0x0004, 0x63B1, 0x8003, 0x08C2, 0x08C2, 0x63B1, 0x0003,
+    0x08C2, 0x8004, 0x63B1, 0x08C2, 0x08C2, 0x63B1, 0x0004, 0x08C2, 0x8001, 0x63B1,
+    0x0003, 0x08C2, 0x800D, 0x63B1, 0x08C2, 0x63B1, 0x63B1, 0x08C2, 0x08C2, 0x63B1,
+    0x08C2, 0x63B1, 0x63B1, 0x08C2, 0x08C2, 0x63B1, 0x0003, 0x08C2, 0x8001, 0x63B1,
+    0x0003, 0x08C2, 0x8007, 0x63B1, 0x63B1, 0x08C2, 0x08C2, 0x63B1, 0x08C2, 0x63B1,
+    0x0003, 0x08C2, 0x8001, 0x63B1, 0x01AB, 0x08C2, 0x8003, 0x63B1, 0x08C2, 0x63B1,
+    0x0003, 0x08C2, 0x0005, 0x63B1, 0x8003, 0x08C2, 0x08C2, 0x63B1, 0x0004, 0x08C2,
+    0x8001, 0x63B1, 0x0003, 0x08C2, 0x8003, 0x63B1, 0x08C2, 0x63B1, 0x0005, 0x08C2,
+    0x8001, 0x63B1, 0x0003, 0x08C2, 0x8001, 0x63B1, 0x0003, 0x08C2, 0x8001, 0x63B1,
+    0x0003, 0x08C2, 0x8001, 0x63B1, 0x0003, 0x08C2, 0x8003, 0x63B1, 0x08C2, 0x08C2,
+    0x0004, 0x63B1, 0x01AB, 0x08C2, 0x8007, 0x63B1, 0x08C2, 0x08C2, 0x63B1, 0x08C2,
+    0x08C2, 0x63B1, 0x0006, 0x08C2, 0x800C, 0x63B1, 0x08C2, 0x08C2, 0x63B1, 0x08C2,
+    0x63B1, 0x08C2, 0x08C2, 0x63B1, 0x63B1, 0x08C2, 0x63B1, 0x0005, 0x08C2, 0x8001,
+    0x63B1, 0x0003, 0x08C2, 0x8001, 0x63B1, 0x0003, 0x08C2, 0x8001, 0x63B1, 0x0003,
+    0x08C2, 0x8001, 0x63B1, 0x0003, 0x08C2, 0x8001, 0x63B1, 0x0005, 0x08C2, 0x8005,
+    0x63B1, 0x08C2, 0x08C2, 0x63B1, 0x63B1, 0x0004, 0x08C2, 0x8002, 0x63B1, 0x63B1,
+    0x0004, 0x08C2, 0x8002, 0x63B1, 0x63B1, 0x019B, 0x08C2, 0x8001, 0x63B1, 0x0003,
+    0x08C2, 0x8003, 0x63B1, 0x08C2, 0x08C2, 0x0003, 0x63B1, 0x0004, 0x08C2, 0x8002,
+    0x63B1, 0x63B1, 0x0003, 0x08C2, 0x8006, 0x63B1, 0x63B1, 0x08C2, 0x63B1, 0x08C2,
+    0x63B1, 0x0005, 0x08C2, 0x8001, 0x63B1, 0x0003, 0x08C2, 0x8003, 0x63B1, 0x08C2,
+    0x08C2, 0x0003, 0x63B1, 0x8003, 0x08C2, 0x08C2, 0x63B1, 0x0003, 0x08C2, 0x8001,
+    0x63B1, 0x0003, 0x08C2, 0x8002, 0x63B1, 0x63B1, 0x0003, 0x08C2, 0x8002, 0x63B1,
+    0x63B1, 0x0004, 0x08C2, 0x8002, 0x63B1, 0x63B1, 0x0004, 0x08C2, 0x8002, 0x63B1,
+    0x63B1, 0x516F, 0x08C2,
+};
+constexpr lifeline::PanelImage RESULT_SENT = {480, 320, RESULT_SENT_WORDS, 2263};
+constexpr lifeline::FieldRect RESULT_SENT_ALERT = {207, 208, 65, 15};
+
+// RESULT_FAILED: 6568 bytes (2.1% of 300 KB raw)
+constexpr uint16_t RESULT_FAILED_WORDS[] = {
+    0x14A0, 0x1148, 0x05A0, 0x1128, 0x000A, 0x1127, 0x000A, 0xFFFF, 0x0004, 0x1127,
+    0x0006, 0xFFFF, 0x0006, 0x1127, 0x0006, 0xFFFF, 0x0004, 0x1127, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0x1127, 0x000A, 0xFFFF, 0x8002, 0x1127, 0x1127, 0x0006, 0xFFFF,
+    0x019E, 0x1127, 0x000A, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1127, 0x0006, 0xFFFF,
+    0x8001, 0x0000, 0x0005, 0x1127, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x000A, 0xFFFF, 0x8002, 0x0000,
+    0x1127, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x019D, 0x1127, 0x8002, 0xFFFF, 0xFFFF,
+    0x0009, 0x0000, 0x8004, 0x1127, 0xFFFF, 0xFFFF, 0x1127, 0x0005, 0x0000, 0x8002,
+    0xFFFF, 0xFFFF, 0x0005, 0x1127, 0x8003, 0x0000, 0xFFFF, 0xFFFF, 0x0003, 0x0000,
+    0x0003, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8002, 0xFFFF,
+    0xFFFF, 0x0009, 0x0000, 0x8003, 0x1127, 0xFFFF, 0xFFFF, 0x0004, 0x0000, 0x8002,
+    0xFFFF, 0xFFFF, 0x019C, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0003, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x019B, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0004, 0x1127, 0x8003, 0x0000, 0xFFFF, 0xFFFF, 0x019A, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0199, 0x1127, 0x0006, 0xFFFF,
+    0x0006, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1127, 0x0008, 0xFFFF, 0x0004, 0x1127,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1127, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x018F, 0x1127, 0x000A, 0x1107, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0005, 0x1107,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1107, 0x0008, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1107,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0199, 0x1107, 0x8002, 0xFFFF, 0xFFFF, 0x0005, 0x0000, 0x0005, 0x1107, 0x000A,
+    0xFFFF, 0x8001, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8002, 0xFFFF, 0xFFFF,
+    0x0007, 0x0000, 0x0003, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0199, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0009, 0x1107, 0x000A, 0xFFFF, 0x8001, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107,
+    0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000,
+    0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0199, 0x1107, 0x8003, 0xFFFF,
+    0xFFFF, 0x0000, 0x0009, 0x1107, 0x8002, 0xFFFF, 0xFFFF, 0x0006, 0x0000, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0003, 0x1107, 0x8005,
+    0xFFFF, 0xFFFF, 0x1107, 0x0000, 0x0000, 0x0199, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0009, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0003, 0x1107, 0x8003,
+    0xFFFF, 0xFFFF, 0x0000, 0x019B, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0003, 0x1107, 0x0006, 0xFFFF, 0x0004, 0x1107, 0x000A, 0xFFFF, 0x8002,
+    0x1107, 0x1107, 0x000A, 0xFFFF, 0x8002, 0x1107, 0x1107, 0x0006, 0xFFFF, 0x8003,
+    0x1107, 0x0000, 0x0000, 0x019B, 0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0009,
+    0x1107, 0x8003, 0xFFFF, 0xFFFF, 0x0000, 0x0005, 0x1107, 0x8003, 0xFFFF, 0xFFFF,
+    0x0000, 0x0003, 0x1107, 0x0006, 0xFFFF, 0x8001, 0x0000, 0x0003, 0x1107, 0x000A,
+    0xFFFF, 0x8002, 0x0000, 0x1107, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x1107, 0x0006,
+    0xFFFF, 0x8001, 0x0000, 0x0193, 0x1107, 0x000B, 0x1106, 0x8002, 0x0000, 0x0000,
+    0x000A, 0x1106, 0x8002, 0x0000, 0x0000, 0x0006, 0x1106, 0x8002, 0x0000, 0x0000,
+    0x0004, 0x1106, 0x0006, 0x0000, 0x0004, 0x1106, 0x000A, 0x0000, 0x8002, 0x1106,
+    0x1106, 0x000A, 0x0000, 0x8002, 0x1106, 0x1106, 0x0006, 0x0000, 0x0733, 0x1106,
+    0x0F00, 0x10E6, 0x01E0, 0x04B9, 0x01E0, 0x06BF, 0x01E0, 0x04B9, 0x4FAB, 0x2861,
+    0x000B, 0xF9C7, 0x01D0, 0x2861, 0x0015, 0xF9C7, 0x01C9, 0x2861, 0x0019, 0xF9C7,
+    0x01C4, 0x2861, 0x001F, 0xF9C7, 0x01BF, 0x2861, 0x0023, 0xF9C7, 0x01BC, 0x2861,
+    0x0025, 0xF9C7, 0x01B9, 0x2861, 0x0029, 0xF9C7, 0x01B6, 0x2861, 0x002B, 0xF9C7,
+    0x01B4, 0x2861, 0x002D, 0xF9C7, 0x01B2, 0x2861, 0x002F, 0xF9C7, 0x01B0, 0x2861,
+    0x0031, 0xF9C7, 0x01AE, 0x2861, 0x0033, 0xF9C7, 0x01AC, 0x2861, 0x0035, 0xF9C7,
+    0x01AA, 0x2861, 0x0037, 0xF9C7, 0x01A8, 0x2861, 0x0039, 0xF9C7, 0x01A6, 0x2861,
+    0x003B, 0xF9C7, 0x01A5, 0x2861, 0x003B, 0xF9C7, 0x01A4, 0x2861, 0x003D, 0xF9C7,
+    0x01A2, 0x2861, 0x003F, 0xF9C7, 0x01A1, 0x2861, 0x003F, 0xF9C7, 0x01A0, 0x2861,
+    0x0041, 0xF9C7, 0x019F, 0x2861, 0x0010, 0xF9C7, 0x0005, 0xFFFF, 0x0017, 0xF9C7,
+    0x0005, 0xFFFF, 0x0010, 0xF9C7, 0x00CF, 0x2861, 0x00D0, 0x2061, 0x0011, 0xF9C7,
+    0x0005, 0xFFFF, 0x0015, 0xF9C7, 0x0005, 0xFFFF, 0x0011, 0xF9C7, 0x019E, 0x2061,
+    0x0013, 0xF9C7, 0x0005, 0xFFFF, 0x0013, 0xF9C7, 0x0005, 0xFFFF, 0x0013, 0xF9C7,
+    0x019D, 0x2061, 0x0014, 0xF9C7, 0x0005, 0xFFFF, 0x0011, 0xF9C7, 0x0005, 0xFFFF,
+    0x0014, 0xF9C7, 0x019C, 0x2061, 0x0016, 0xF9C7, 0x0005, 0xFFFF, 0x000F, 0xF9C7,
+    0x0005, 0xFFFF, 0x0016, 0xF9C7, 0x019B, 0x2061, 0x0017, 0xF9C7, 0x0005, 0xFFFF,
+    0x000D, 0xF9C7, 0x0005, 0xFFFF, 0x0017, 0xF9C7, 0x019B, 0x2061, 0x0018, 0xF9C7,
+    0x0005, 0xFFFF, 0x000B, 0xF9C7, 0x0005, 0xFFFF, 0x0018, 0xF9C7, 0x019B, 0x2061,
+    0x0019, 0xF9C7, 0x0005, 0xFFFF, 0x0009, 0xF9C7, 0x0005, 0xFFFF, 0x0019, 0xF9C7,
+    0x019B, 0x2061, 0x001A, 0xF9C7, 0x0005, 0xFFFF, 0x0007, 0xF9C7, 0x0005, 0xFFFF,
+    0x001A, 0xF9C7, 0x019A, 0x2061, 0x001C, 0xF9C7, 0x0005, 0xFFFF, 0x0005, 0xF9C7,
+    0x0005, 0xFFFF, 0x001C, 0xF9C7, 0x0199, 0x2061, 0x001D, 0xF9C7, 0x0005, 0xFFFF,
+    0x0003, 0xF9C7, 0x0005, 0xFFFF, 0x001D, 0xF9C7, 0x0199, 0x2061, 0x001E, 0xF9C7,
+    0x0005, 0xFFFF, 0x8001, 0xF9C7, 0x0005, 0xFFFF, 0x001E, 0xF9C7, 0x0199, 0x2061,
+    0x001F, 0xF9C7, 0x0009, 0xFFFF, 0x001F, 0xF9C7, 0x0199, 0x2061, 0x0020, 0xF9C7,
+    0x0007, 0xFFFF, 0x0020, 0xF9C7, 0x0199, 0x2061, 0x0021, 0xF9C7, 0x0005, 0xFFFF,
+    0x0021, 0xF9C7, 0x0199, 0x2061, 0x0020, 0xF9C7, 0x0007, 0xFFFF, 0x0020, 0xF9C7,
+    0x0199, 0x2061, 0x001F, 0xF9C7, 0x0009, 0xFFFF, 0x001F, 0xF9C7, 0x0199, 0x2061,
+    0x001E, 0xF9C7, 0x0005, 0xFFFF, 0x8001, 0xF9C7, 0x0005, 0xFFFF, 0x001E, 0xF9C7,
+    0x0199, 0x2061, 0x001D, 0xF9C7, 0x0005, 0xFFFF, 0x0003, 0xF9C7, 0x0005, 0xFFFF,
+    0x001D, 0xF9C7, 0x0199, 0x2061, 0x001C, 0xF9C7, 0x0005, 0xFFFF, 0x0005, 0xF9C7,
+    0x0005, 0xFFFF, 0x001C, 0xF9C7, 0x019A, 0x2061, 0x001A, 0xF9C7, 0x0005, 0xFFFF,
+    0x0007, 0xF9C7, 0x0005, 0xFFFF, 0x001A, 0xF9C7, 0x019B, 0x2061, 0x0019, 0xF9C7,
+    0x0005, 0xFFFF, 0x0009, 0xF9C7, 0x0005, 0xFFFF, 0x0019, 0xF9C7, 0x019B, 0x2061,
+    0x0018, 0xF9C7, 0x0005, 0xFFFF, 0x000B, 0xF9C7, 0x0005, 0xFFFF, 0x0018, 0xF9C7,
+    0x019B, 0x2061, 0x0017, 0xF9C7, 0x0005, 0xFFFF, 0x000D, 0xF9C7, 0x0005, 0xFFFF,
+    0x0017, 0xF9C7, 0x019B, 0x2061, 0x0016, 0xF9C7, 0x0005, 0xFFFF, 0x000F, 0xF9C7,
+    0x0005, 0xFFFF, 0x0016, 0xF9C7, 0x019C, 0x2061, 0x0014, 0xF9C7, 0x0005, 0xFFFF,
+    0x0011, 0xF9C7, 0x0005, 0xFFFF, 0x0014, 0xF9C7, 0x019D, 0x2061, 0x0013, 0xF9C7,
+    0x0005, 0xFFFF, 0x0013, 0xF9C7, 0x0005, 0xFFFF, 0x0013, 0xF9C7, 0x019E, 0x2061,
+    0x0011, 0xF9C7, 0x0005, 0xFFFF, 0x0015, 0xF9C7, 0x0005, 0xFFFF, 0x0011, 0xF9C7,
+    0x019F, 0x2061, 0x0010, 0xF9C7, 0x0005, 0xFFFF, 0x0017, 0xF9C7, 0x0005, 0xFFFF,
+    0x0010, 0xF9C7, 0x019F, 0x2061, 0x0041, 0xF9C7, 0x01A0, 0x2061, 0x003F, 0xF9C7,
+    0x01A1, 0x2061, 0x003F, 0xF9C7, 0x01A2, 0x2061, 0x003D, 0xF9C7, 0x01A4, 0x2061,
+    0x003B, 0xF9C7, 0x01A5, 0x2061, 0x003B, 0xF9C7, 0x01A6, 0x2061, 0x0039, 0xF9C7,
+    0x01A8, 0x2061, 0x0037, 0xF9C7, 0x01AA, 0x2061, 0x0035, 0xF9C7, 0x01AC, 0x2061,
+    0x0033, 0xF9C7, 0x01AE, 0x2061, 0x0031, 0xF9C7, 0x01B0, 0x2061, 0x002F, 0xF9C7,
+    0x01B2, 0x2061, 0x002D, 0xF9C7, 0x01B4, 0x2061, 0x002B, 0xF9C7, 0x01B6, 0x2061,
+    0x0029, 0xF9C7, 0x01B9, 0x2061, 0x0025, 0xF9C7, 0x01BC, 0x2061, 0x0023, 0xF9C7,
+    0x01BF, 0x2061, 0x001F, 0xF9C7, 0x01C4, 0x2061, 0x0019, 0xF9C7, 0x01C9, 0x2061,
+    0x0015, 0xF9C7, 0x01D0, 0x2061, 0x000B, 0xF9C7, 0x2E94, 0x2061, 0x0008, 0xFB2C,
+    0x0022, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x000E, 0x2061, 0x000A, 0xFB2C, 0x0012,
+    0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0008, 0x2061, 0x0004, 0xFB2C, 0x001A, 0x2061,
+    0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0158, 0x2061,
+    0x0008, 0xFB2C, 0x0022, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x000E, 0x2061, 0x000A,
+    0xFB2C, 0x0012, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0008, 0x2061, 0x0004, 0xFB2C,
+    0x001A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x0156, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x002A, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x000E, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0026, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x001A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x0156, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x002A, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x000E, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0026, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x001A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x0156, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x000C, 0x2061, 0x0006, 0xFB2C, 0x0004,
+    0x2061, 0x8004, 0xFB2C, 0xFB2C, 0x2061, 0x2061, 0x0004, 0xFB2C, 0x0006, 0x2061,
+    0x0004, 0xFB2C, 0x8004, 0x2061, 0x2061, 0xFB2C, 0xFB2C, 0x000E, 0x2061, 0x8002,
+    0xFB2C, 0xFB2C, 0x000C, 0x2061, 0x0006, 0xFB2C, 0x0006, 0x2061, 0x0004, 0xFB2C,
+    0x000A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0008, 0x2061, 0x0006, 0xFB2C, 0x0006,
+    0x2061, 0x0004, 0xFB2C, 0x8004, 0x2061, 0x2061, 0xFB2C, 0xFB2C, 0x0006, 0x2061,
+    0x8002, 0xFB2C, 0xFB2C, 0x0156, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x000C, 0x2061,
+    0x0006, 0xFB2C, 0x0004, 0x2061, 0x8004, 0xFB2C, 0xFB2C, 0x2061, 0x2061, 0x0004,
+    0xFB2C, 0x0006, 0x2061, 0x0004, 0xFB2C, 0x8004, 0x2061, 0x2061, 0xFB2C, 0xFB2C,
+    0x000E, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x000C, 0x2061, 0x0006, 0xFB2C, 0x0006,
+    0x2061, 0x0004, 0xFB2C, 0x000A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0008, 0x2061,
+    0x0006, 0xFB2C, 0x0006, 0x2061, 0x0004, 0xFB2C, 0x8004, 0x2061, 0x2061, 0xFB2C,
+    0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0158, 0x2061, 0x0006, 0xFB2C,
+    0x0004, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8004, 0xFB2C, 0xFB2C,
+    0x2061, 0x2061, 0x0004, 0xFB2C, 0x0004, 0x2061, 0x8006, 0xFB2C, 0xFB2C, 0x2061,
+    0x2061, 0xFB2C, 0xFB2C, 0x0004, 0x2061, 0x0004, 0xFB2C, 0x000E, 0x2061, 0x0006,
+    0xFB2C, 0x000E, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C,
+    0xFB2C, 0x000A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C,
+    0xFB2C, 0x0006, 0x2061, 0x8006, 0xFB2C, 0xFB2C, 0x2061, 0x2061, 0xFB2C, 0xFB2C,
+    0x0004, 0x2061, 0x0004, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0158,
+    0x2061, 0x0006, 0xFB2C, 0x0004, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061,
+    0x8004, 0xFB2C, 0xFB2C, 0x2061, 0x2061, 0x0004, 0xFB2C, 0x0004, 0x2061, 0x8006,
+    0xFB2C, 0xFB2C, 0x2061, 0x2061, 0xFB2C, 0xFB2C, 0x0004, 0x2061, 0x0004, 0xFB2C,
+    0x000E, 0x2061, 0x0006, 0xFB2C, 0x000E, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006,
+    0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x000A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006,
+    0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8006, 0xFB2C, 0xFB2C, 0x2061,
+    0x2061, 0xFB2C, 0xFB2C, 0x0004, 0x2061, 0x0004, 0xFB2C, 0x0006, 0x2061, 0x8002,
+    0xFB2C, 0xFB2C, 0x015E, 0x2061, 0x8004, 0xFB2C, 0xFB2C, 0x2061, 0x2061, 0x000A,
+    0xFB2C, 0x8004, 0x2061, 0x2061, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8006, 0xFB2C,
+    0xFB2C, 0x2061, 0x2061, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x000E, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x000C, 0x2061, 0x0008, 0xFB2C, 0x0006,
+    0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x000A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006,
+    0x2061, 0x000A, 0xFB2C, 0x8004, 0x2061, 0x2061, 0xFB2C, 0xFB2C, 0x0006, 0x2061,
+    0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x015E, 0x2061,
+    0x8004, 0xFB2C, 0xFB2C, 0x2061, 0x2061, 0x000A, 0xFB2C, 0x8004, 0x2061, 0x2061,
+    0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8006, 0xFB2C, 0xFB2C, 0x2061, 0x2061, 0xFB2C,
+    0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x000E, 0x2061, 0x8002, 0xFB2C,
+    0xFB2C, 0x000C, 0x2061, 0x0008, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x000A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x000A, 0xFB2C, 0x8004,
+    0x2061, 0x2061, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006,
+    0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x015E, 0x2061, 0x8006, 0xFB2C, 0xFB2C, 0x2061,
+    0x2061, 0xFB2C, 0xFB2C, 0x000A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061,
+    0x8006, 0xFB2C, 0xFB2C, 0x2061, 0x2061, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002,
+    0xFB2C, 0xFB2C, 0x000E, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x000A, 0x2061, 0x8002,
+    0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002,
+    0xFB2C, 0xFB2C, 0x000A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002,
+    0xFB2C, 0xFB2C, 0x000A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002,
+    0xFB2C, 0xFB2C, 0x0166, 0x2061, 0x8006, 0xFB2C, 0xFB2C, 0x2061, 0x2061, 0xFB2C,
+    0xFB2C, 0x000A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8006, 0xFB2C,
+    0xFB2C, 0x2061, 0x2061, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x000E, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x000A, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x000A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x000A, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x015E, 0x2061, 0x0008, 0xFB2C, 0x0006, 0x2061, 0x0006, 0xFB2C, 0x0004, 0x2061,
+    0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0004, 0x2061,
+    0x0008, 0xFB2C, 0x000E, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x000C, 0x2061, 0x0008,
+    0xFB2C, 0x0004, 0x2061, 0x0006, 0xFB2C, 0x0006, 0x2061, 0x0006, 0xFB2C, 0x0006,
+    0x2061, 0x0006, 0xFB2C, 0x0006, 0x2061, 0x0008, 0xFB2C, 0x0006, 0x2061, 0x8002,
+    0xFB2C, 0xFB2C, 0x0156, 0x2061, 0x0008, 0xFB2C, 0x0006, 0x2061, 0x0006, 0xFB2C,
+    0x0004, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x0006, 0x2061, 0x8002, 0xFB2C, 0xFB2C,
+    0x0004, 0x2061, 0x0008, 0xFB2C, 0x000E, 0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x000C,
+    0x2061, 0x0008, 0xFB2C, 0x0004, 0x2061, 0x0006, 0xFB2C, 0x0006, 0x2061, 0x0006,
+    0xFB2C, 0x0006, 0x2061, 0x0006, 0xFB2C, 0x0006, 0x2061, 0x0008, 0xFB2C, 0x0006,
+    0x2061, 0x8002, 0xFB2C, 0xFB2C, 0x262E, 0x2061, 0x567F, 0x1861, 0x0054, 0xFDC0,
+    0x001A, 0x1861, 0x0054, 0x18C5, 0x011D, 0x1861, 0x0056, 0xFDC0, 0x0018, 0x1861,
+    0x0056, 0x18C5, 0x011B, 0x1861, 0x0058, 0xFDC0, 0x0016, 0x1861, 0x0058, 0x18C5,
+    0x0119, 0x1861, 0x005A, 0xFDC0, 0x0014, 0x1861, 0x005A, 0x18C5, 0x0118, 0x1861,
+    0x005A, 0xFDC0, 0x0014, 0x1861, 0x005A, 0x18C5, 0x0118, 0x1861, 0x005A, 0xFDC0,
+    0x0014, 0x1861, 0x005A, 0x18C5, 0x0118, 0x1861, 0x005A, 0xFDC0, 0x0014, 0x1861,
+    0x005A, 0x18C5, 0x0118, 0x1861, 0x005A, 0xFDC0, 0x0014, 0x1861, 0x005A, 0x18C5,
+    0x0118, 0x1861, 0x005A, 0xFDC0, 0x0014, 0x1861, 0x005A, 0x18C5, 0x0118, 0x1861,
+    0x005A, 0xFDC0, 0x0014, 0x1861, 0x005A, 0x18C5, 0x0118, 0x1861, 0x0024, 0xFDC0,
+    0x0008, 0x0841, 0x0004, 0xFDC0, 0x000A, 0x0841, 0x8002, 0xFDC0, 0xFDC0, 0x000A,
+    0x0841, 0x8002, 0xFDC0, 0xFDC0, 0x0008, 0x0841, 0x0004, 0xFDC0, 0x8002, 0x0841,
+    0x0841, 0x0004, 0xFDC0, 0x8004, 0x1861, 0x1861, 0x0841, 0x0841, 0x0010, 0x1861,
+    0x000E, 0x18C5, 0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0010,
+    0x18C5, 0x8002, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8004, 0xA598, 0xA598, 0x18C5,
+    0x18C5, 0x000A, 0xA598, 0x8004, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0006, 0x18C5,
+    0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8002,
+    0xA598, 0xA598, 0x0008, 0x18C5, 0x0118, 0x1861, 0x0024, 0xFDC0, 0x0008, 0x0841,
+    0x0004, 0xFDC0, 0x000A, 0x0841, 0x8002, 0xFDC0, 0xFDC0, 0x000A, 0x0841, 0x8002,
+    0xFDC0, 0xFDC0, 0x0008, 0x0841, 0x0004, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0004,
+    0xFDC0, 0x8004, 0x1861, 0x1861, 0x0841, 0x0841, 0x0010, 0x1861, 0x000E, 0x18C5,
+    0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0010, 0x18C5, 0x8002,
+    0xA598, 0xA598, 0x0006, 0x18C5, 0x8004, 0xA598, 0xA598, 0x18C5, 0x18C5, 0x000A,
+    0xA598, 0x8004, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8006, 0xA598,
+    0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8002, 0xA598, 0xA598,
+    0x0008, 0x18C5, 0x0118, 0x1861, 0x000E, 0xFDC0, 0x8006, 0x0841, 0x0841, 0xFDC0,
+    0xFDC0, 0x0841, 0x0841, 0x0010, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0,
+    0x8006, 0x0841, 0x0841, 0xFDC0, 0xFDC0, 0x0841, 0x0841, 0x000E, 0xFDC0, 0x8002,
+    0x0841, 0x0841, 0x0006, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0, 0x8006,
+    0x0841, 0x0841, 0xFDC0, 0xFDC0, 0x0841, 0x0841, 0x0004, 0xFDC0, 0x8004, 0x1861,
+    0x1861, 0x0841, 0x0841, 0x0010, 0x1861, 0x000E, 0x18C5, 0x8006, 0xA598, 0xA598,
+    0x18C5, 0x18C5, 0xA598, 0xA598, 0x0010, 0x18C5, 0x0004, 0xA598, 0x8002, 0x18C5,
+    0x18C5, 0x0004, 0xA598, 0x8004, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x000A, 0x18C5,
+    0x8002, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5,
+    0xA598, 0xA598, 0x0006, 0x18C5, 0x8002, 0xA598, 0xA598, 0x0008, 0x18C5, 0x0118,
+    0x1861, 0x000E, 0xFDC0, 0x8006, 0x0841, 0x0841, 0xFDC0, 0xFDC0, 0x0841, 0x0841,
+    0x0010, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0, 0x8006, 0x0841, 0x0841,
+    0xFDC0, 0xFDC0, 0x0841, 0x0841, 0x000E, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006,
+    0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0, 0x8006, 0x0841, 0x0841, 0xFDC0,
+    0xFDC0, 0x0841, 0x0841, 0x0004, 0xFDC0, 0x8004, 0x1861, 0x1861, 0x0841, 0x0841,
+    0x0010, 0x1861, 0x000E, 0x18C5, 0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598,
+    0xA598, 0x0010, 0x18C5, 0x0004, 0xA598, 0x8002, 0x18C5, 0x18C5, 0x0004, 0xA598,
+    0x8004, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x000A, 0x18C5, 0x8002, 0xA598, 0xA598,
+    0x0006, 0x18C5, 0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0006,
+    0x18C5, 0x8002, 0xA598, 0xA598, 0x0008, 0x18C5, 0x0118, 0x1861, 0x0010, 0xFDC0,
+    0x8002, 0x0841, 0x0841, 0x0012, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0,
+    0x8006, 0x0841, 0x0841, 0xFDC0, 0xFDC0, 0x0841, 0x0841, 0x000E, 0xFDC0, 0x8002,
+    0x0841, 0x0841, 0x0006, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0, 0x8002,
+    0x0841, 0x0841, 0x0004, 0xFDC0, 0x8006, 0x0841, 0x0841, 0xFDC0, 0xFDC0, 0x0841,
+    0x0841, 0x0012, 0x1861, 0x000C, 0x18C5, 0x000A, 0xA598, 0x000E, 0x18C5, 0x800E,
+    0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598,
+    0x18C5, 0x18C5, 0xA598, 0xA598, 0x000A, 0x18C5, 0x0004, 0xA598, 0x0004, 0x18C5,
+    0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8002,
+    0xA598, 0xA598, 0x0008, 0x18C5, 0x0118, 0x1861, 0x0010, 0xFDC0, 0x8002, 0x0841,
+    0x0841, 0x0012, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0, 0x8006, 0x0841,
+    0x0841, 0xFDC0, 0xFDC0, 0x0841, 0x0841, 0x000E, 0xFDC0, 0x8002, 0x0841, 0x0841,
+    0x0006, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0, 0x8002, 0x0841, 0x0841,
+    0x0004, 0xFDC0, 0x8006, 0x0841, 0x0841, 0xFDC0, 0xFDC0, 0x0841, 0x0841, 0x0012,
+    0x1861, 0x000C, 0x18C5, 0x000A, 0xA598, 0x000E, 0x18C5, 0x800E, 0xA598, 0xA598,
+    0x18C5, 0x18C5, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x18C5, 0x18C5,
+    0xA598, 0xA598, 0x000A, 0x18C5, 0x0004, 0xA598, 0x0004, 0x18C5, 0x8006, 0xA598,
+    0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8002, 0xA598, 0xA598,
+    0x0008, 0x18C5, 0x0118, 0x1861, 0x000C, 0xFDC0, 0x000A, 0x0841, 0x000E, 0xFDC0,
+    0x0008, 0x0841, 0x0004, 0xFDC0, 0x0008, 0x0841, 0x0008, 0xFDC0, 0x8002, 0x0841,
+    0x0841, 0x0006, 0xFDC0, 0x0008, 0x0841, 0x0008, 0xFDC0, 0x8002, 0x0841, 0x0841,
+    0x0014, 0x1861, 0x000E, 0x18C5, 0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598,
+    0xA598, 0x0010, 0x18C5, 0x8002, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8004, 0xA598,
+    0xA598, 0x18C5, 0x18C5, 0x0008, 0xA598, 0x0004, 0x18C5, 0x800E, 0xA598, 0xA598,
+    0x18C5, 0x18C5, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x18C5, 0x18C5,
+    0xA598, 0xA598, 0x0006, 0x18C5, 0x8002, 0xA598, 0xA598, 0x0008, 0x18C5, 0x0118,
+    0x1861, 0x000C, 0xFDC0, 0x000A, 0x0841, 0x000E, 0xFDC0, 0x0008, 0x0841, 0x0004,
+    0xFDC0, 0x0008, 0x0841, 0x0008, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0,
+    0x0008, 0x0841, 0x0008, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0014, 0x1861, 0x000E,
+    0x18C5, 0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0010, 0x18C5,
+    0x8002, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8004, 0xA598, 0xA598, 0x18C5, 0x18C5,
+    0x0008, 0xA598, 0x0004, 0x18C5, 0x800E, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598,
+    0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0006,
+    0x18C5, 0x8002, 0xA598, 0xA598, 0x0008, 0x18C5, 0x0118, 0x1861, 0x0010, 0xFDC0,
+    0x8002, 0x0841, 0x0841, 0x0012, 0xFDC0, 0x8006, 0x0841, 0x0841, 0xFDC0, 0xFDC0,
+    0x0841, 0x0841, 0x0006, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x000E, 0xFDC0, 0x8002,
+    0x0841, 0x0841, 0x0006, 0xFDC0, 0x8006, 0x0841, 0x0841, 0xFDC0, 0xFDC0, 0x0841,
+    0x0841, 0x000A, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0014, 0x1861, 0x000C, 0x18C5,
+    0x000A, 0xA598, 0x000E, 0x18C5, 0x8002, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8006,
+    0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x000A, 0x18C5, 0x8002, 0xA598,
+    0xA598, 0x0004, 0x18C5, 0x0004, 0xA598, 0x8004, 0x18C5, 0x18C5, 0xA598, 0xA598,
+    0x0006, 0x18C5, 0x8002, 0xA598, 0xA598, 0x0008, 0x18C5, 0x0118, 0x1861, 0x0010,
+    0xFDC0, 0x8002, 0x0841, 0x0841, 0x0012, 0xFDC0, 0x8006, 0x0841, 0x0841, 0xFDC0,
+    0xFDC0, 0x0841, 0x0841, 0x0006, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x000E, 0xFDC0,
+    0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0, 0x8006, 0x0841, 0x0841, 0xFDC0, 0xFDC0,
+    0x0841, 0x0841, 0x000A, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0014, 0x1861, 0x000C,
+    0x18C5, 0x000A, 0xA598, 0x000E, 0x18C5, 0x8002, 0xA598, 0xA598, 0x0006, 0x18C5,
+    0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x000A, 0x18C5, 0x8002,
+    0xA598, 0xA598, 0x0004, 0x18C5, 0x0004, 0xA598, 0x8004, 0x18C5, 0x18C5, 0xA598,
+    0xA598, 0x0006, 0x18C5, 0x8002, 0xA598, 0xA598, 0x0008, 0x18C5, 0x0118, 0x1861,
+    0x000E, 0xFDC0, 0x8006, 0x0841, 0x0841, 0xFDC0, 0xFDC0, 0x0841, 0x0841, 0x0010,
+    0xFDC0, 0x8002, 0x0841, 0x0841, 0x0004, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0004,
+    0xFDC0, 0x8002, 0x0841, 0x0841, 0x000E, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006,
+    0xFDC0, 0x8002, 0x0841, 0x0841, 0x0004, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0008,
+    0xFDC0, 0x8002, 0x0841, 0x0841, 0x0014, 0x1861, 0x000E, 0x18C5, 0x8006, 0xA598,
+    0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0010, 0x18C5, 0x8002, 0xA598, 0xA598,
+    0x0006, 0x18C5, 0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x000A,
+    0x18C5, 0x8002, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8006, 0xA598, 0xA598, 0x18C5,
+    0x18C5, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8002, 0xA598, 0xA598, 0x0008, 0x18C5,
+    0x0118, 0x1861, 0x000E, 0xFDC0, 0x8006, 0x0841, 0x0841, 0xFDC0, 0xFDC0, 0x0841,
+    0x0841, 0x0010, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0004, 0xFDC0, 0x8002, 0x0841,
+    0x0841, 0x0004, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x000E, 0xFDC0, 0x8002, 0x0841,
+    0x0841, 0x0006, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0004, 0xFDC0, 0x8002, 0x0841,
+    0x0841, 0x0008, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0014, 0x1861, 0x000E, 0x18C5,
+    0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0010, 0x18C5, 0x8002,
+    0xA598, 0xA598, 0x0006, 0x18C5, 0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598,
+    0xA598, 0x000A, 0x18C5, 0x8002, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8006, 0xA598,
+    0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8002, 0xA598, 0xA598,
+    0x0008, 0x18C5, 0x0118, 0x1861, 0x0024, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006,
+    0xFDC0, 0x8004, 0x0841, 0x0841, 0xFDC0, 0xFDC0, 0x000A, 0x0841, 0x0006, 0xFDC0,
+    0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0,
+    0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0014, 0x1861,
+    0x000E, 0x18C5, 0x8006, 0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0010,
+    0x18C5, 0x8002, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8004, 0xA598, 0xA598, 0x18C5,
+    0x18C5, 0x000A, 0xA598, 0x8004, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0006, 0x18C5,
+    0x8002, 0xA598, 0xA598, 0x0004, 0x18C5, 0x0006, 0xA598, 0x000A, 0x18C5, 0x0118,
+    0x1861, 0x0024, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0, 0x8004, 0x0841,
+    0x0841, 0xFDC0, 0xFDC0, 0x000A, 0x0841, 0x0006, 0xFDC0, 0x8002, 0x0841, 0x0841,
+    0x0006, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0006, 0xFDC0, 0x8002, 0x0841, 0x0841,
+    0x0006, 0xFDC0, 0x8002, 0x0841, 0x0841, 0x0014, 0x1861, 0x000E, 0x18C5, 0x8006,
+    0xA598, 0xA598, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0010, 0x18C5, 0x8002, 0xA598,
+    0xA598, 0x0006, 0x18C5, 0x8004, 0xA598, 0xA598, 0x18C5, 0x18C5, 0x000A, 0xA598,
+    0x8004, 0x18C5, 0x18C5, 0xA598, 0xA598, 0x0006, 0x18C5, 0x8002, 0xA598, 0xA598,
+    0x0004, 0x18C5, 0x0006, 0xA598, 0x000A, 0x18C5, 0x0118, 0x1861, 0x005A, 0xFDC0,
+    0x0014, 0x1861, 0x005A, 0x18C5, 0x0118, 0x1861, 0x005A, 0xFDC0, 0x0014, 0x1861,
+    0x005A, 0x18C5, 0x0118, 0x1861, 0x005A, 0xFDC0, 0x0014, 0x1861, 0x005A, 0x18C5,
+    0x0118, 0x1861, 0x005A, 0xFDC0, 0x0014, 0x1861, 0x005A, 0x18C5, 0x0118, 0x1861,
+    0x005A, 0xFDC0, 0x0014, 0x1861, 0x005A, 0x18C5, 0x0118, 0x1861, 0x005A, 0xFDC0,
+    0x0014, 0x1861, 0x005A, 0x18C5, 0x0118, 0x1861, 0x005A, 0xFDC0, 0x0014, 0x1861,
+    0x005A, 0x18C5, 0x0118, 0x1861, 0x005A, 0xFDC0, 0x0014, 0x1861, 0x005A, 0x18C5,
+    0x0118, 0x1861, 0x005A, 0xFDC0, 0x0014, 0x1861, 0x005A, 0x18C5, 0x0119, 0x1861,
+    0x0058, 0xFDC0, 0x0016, 0x1861, 0x0058, 0x18C5, 0x011B, 0x1861, 0x0056, 0xFDC0,
+    0x0018, 0x1861, 0x0056, 0x18C5, 0x011D, 0x1861, 0x0054, 0xFDC0, 0x001A, 0x1861,
+    0x0054, 0x18C5, 0x2DDF, 0x1861,
+};
+constexpr lifeline::PanelImage RESULT_FAILED = {480, 320, RESULT_FAILED_WORDS, 3284};
+constexpr lifeline::FieldRect RESULT_FAILED_ATTEMPT = {207, 210, 65, 7};
+
+} // namespace bg
+
+#endif // ESP32TXS_SCREEN_BACKGROUNDS_H
@@ -7,7 +7,8 @@
  * ═══════════════════════════════════════════════════════════════════════════════════
  *
  * Ported for ESP32-S3 with ILI9488 8-bit parallel display.
- * Uses manual GPIO bit-banging (proven working from LoveCode.ino).
+ * The display bus runs on LCD_CAM DMA (I80Panel.h), falling back to manual
+ * GPIO bit-banging (proven working from LoveCode.ino) without it.
  *
  * Hardware:
  *   - ESP32-S3 N8R2
@@ -15,6 +16,10 @@
  *   - LoRa SX1278 @ 433 MHz
  *   - 4x4 Matrix Keypad
  *
+ * Packet: TX[ID],[CODE][;k=MS];s=[SEQ]  (k = key press → radio start, ms;
+ *         s = alert sequence, repeated on retries/resumes for RX dedupe)
+ * Heartbeat: HB[ID];i=[AVG_mA x10];l=[HOURS];u=[UPTIME_MIN][;v=mV;b=%]
+ *
  * Version: 1.0.0-S3
  * ═══════════════════════════════════════════════════════════════════════════════════
  */
@@ -29,6 +34,20 @@
 #include <Wire.h>
 #include <vector>
 
+#include <AlertJournal.h>
+#include <BatteryMonitor.h>
+#include <BootSequencer.h>
+#include <EnergyMeter.h>
+#include <I80Panel.h>
+#include <LatencyBudget.h>
+#include <PanelImage.h>
+#include <PinMap.h>
+#include <ScreenCache.h>
+#include <UiText.h>
+#include <UiTextNe.h>
+
+#include "ScreenBackgrounds.h" // Generated: tools/bake_screens (host build)
+
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                     PART 1: CORE DISPLAY DRIVER
 // ═══════════════════════════════════════════════════════════════════════════════════
@@ -140,156 +159,78 @@
 //                         LOW-LEVEL DISPLAY FUNCTIONS
 // ═══════════════════════════════════════════════════════════════════════════════════
 
-// optimized writeData8 for ESP32-S3 (Reg Access)
-void writeData8(uint8_t d) {
-  uint32_t mask0_set = 0;
-  uint32_t mask0_clr = 0;
-  uint32_t mask1_set = 0;
-  uint32_t mask1_clr = 0;
-
-  // Bit 0 -> GPIO 8
-  if (d & 0x01)
-    mask0_set |= (1 << 8);
-  else
-    mask0_clr |= (1 << 8);
-  // Bit 1 -> GPIO 9
-  if (d & 0x02)
-    mask0_set |= (1 << 9);
-  else
-    mask0_clr |= (1 << 9);
-  // Bit 2 -> GPIO 21
-  if (d & 0x04)
-    mask0_set |= (1 << 21);
-  else
-    mask0_clr |= (1 << 21);
-  // Bit 3 -> GPIO 46 (High Register, bit 14)
-  if (d & 0x08)
-    mask1_set |= (1 << 14);
-  else
-    mask1_clr |= (1 << 14);
-  // Bit 4 -> GPIO 10
-  if (d & 0x10)
-    mask0_set |= (1 << 10);
-  else
-    mask0_clr |= (1 << 10);
-  // Bit 5 -> GPIO 11
-  if (d & 0x20)
-    mask0_set |= (1 << 11);
-  else
-    mask0_clr |= (1 << 11);
-  // Bit 6 -> GPIO 13
-  if (d & 0x40)
-    mask0_set |= (1 << 13);
-  else
-    mask0_clr |= (1 << 13);
-  // Bit 7 -> GPIO 12
-  if (d & 0x80)
-    mask0_set |= (1 << 12);
-  else
-    mask0_clr |= (1 << 12);
-
-  // Apply Writes (Low Register)
-  if (mask0_set)
-    REG_WRITE(GPIO_OUT_W1TS_REG, mask0_set);
-  if (mask0_clr)
-    REG_WRITE(GPIO_OUT_W1TC_REG, mask0_clr);
-
-  // Apply Writes (High Register)
-  if (mask1_set)
-    REG_WRITE(GPIO_OUT1_W1TS_REG, mask1_set);
-  if (mask1_clr)
-    REG_WRITE(GPIO_OUT1_W1TC_REG, mask1_clr);
-
-  // Pulse WR (GPIO 7 - Low Register)
-  REG_WRITE(GPIO_OUT_W1TC_REG, (1 << 7)); // WR LOW
-  REG_WRITE(GPIO_OUT_W1TS_REG, (1 << 7)); // WR HIGH
-}
+// Data bus and WR strobe as register writes; masks come from the pin list
+typedef lifeline::ParallelBus8<TFT_WR, TFT_D0, TFT_D1, TFT_D2, TFT_D3, TFT_D4,
+                               TFT_D5, TFT_D6, TFT_D7>
+    TftBus;
 
-void writeCommand(uint8_t cmd) {
-  digitalWrite(TFT_RS, LOW);
-  digitalWrite(TFT_CS, LOW);
-  writeData8(cmd);
-  digitalWrite(TFT_CS, HIGH);
-}
+// LCD_CAM drives the same pins by DMA; TftBus is the fallback
+lifeline::I80Panel<TftBus> tft(TFT_CS, TFT_RS);
 
-void writeDataByte(uint8_t data) {
-  digitalWrite(TFT_RS, HIGH);
-  digitalWrite(TFT_CS, LOW);
-  writeData8(data);
-  digitalWrite(TFT_CS, HIGH);
-}
+// Snapshots of the menu/confirm/sending/result screens in PSRAM; every
+// window and fill below is mirrored into the one being recorded
+lifeline::ScreenCache<> screens;
 
 void tftInitPins() {
   pinMode(TFT_RST, OUTPUT);
-  pinMode(TFT_CS, OUTPUT);
-  pinMode(TFT_RS, OUTPUT);
-  pinMode(TFT_WR, OUTPUT);
   pinMode(TFT_RD, OUTPUT);
-
-  pinMode(TFT_D0, OUTPUT);
-  pinMode(TFT_D1, OUTPUT);
-  pinMode(TFT_D2, OUTPUT);
-  pinMode(TFT_D3, OUTPUT);
-  pinMode(TFT_D4, OUTPUT);
-  pinMode(TFT_D5, OUTPUT);
-  pinMode(TFT_D6, OUTPUT);
-  pinMode(TFT_D7, OUTPUT);
-
-  digitalWrite(TFT_CS, HIGH);
-  digitalWrite(TFT_WR, HIGH);
   digitalWrite(TFT_RD, HIGH);
+  if (!tft.begin())
+    Serial.println("[INIT] TFT: no LCD_CAM DMA, bit-banged bus");
 }
 
-void tftInit() {
-  tftInitPins();
-
-  digitalWrite(TFT_RST, HIGH);
-  delay(50);
-  digitalWrite(TFT_RST, LOW);
-  delay(150);
-  digitalWrite(TFT_RST, HIGH);
-  delay(150);
-
-  writeCommand(0x01);
-  delay(150);
-  writeCommand(0x11);
-  delay(150);
-
-  writeCommand(0x3A);
-  writeDataByte(0x55); // 16-bit pixel format
-  writeCommand(0x36);
-  writeDataByte(
-      0x28); // Landscape Flipped (MV|BGR) - Fixed the upside-down issue
-  writeCommand(0x29);
-  delay(50);
+// Panel bring-up as boot phases: the waits are the reset, software reset and
+// sleep-out timers, during which the sequencer brings up radio and sensor
+int32_t panelBootStep(uint8_t phase) {
+  switch (phase) {
+  case 0:
+    tftInitPins();
+    digitalWrite(TFT_RST, HIGH);
+    return 50;
+  case 1:
+    digitalWrite(TFT_RST, LOW);
+    return 150;
+  case 2:
+    digitalWrite(TFT_RST, HIGH);
+    return 150;
+  case 3:
+    tft.command(0x01);
+    return 150;
+  case 4:
+    tft.command(0x11);
+    return 150;
+  case 5: {
+    const uint8_t format = 0x55; // 16-bit pixel format
+    // Landscape Flipped (MV|BGR) - Fixed the upside-down issue
+    const uint8_t madctl = 0x28;
+    tft.command(0x3A, &format, 1);
+    tft.command(0x36, &madctl, 1);
+    tft.command(0x29);
+    return 50;
+  }
+  default:
+    if (tft.dma())
+      Serial.printf("[INIT] TFT OK (%lu ms, i80 DMA @ %lu MHz)\n", millis(),
+                    (unsigned long)(tft.clockHz() / 1000000));
+    else
+      Serial.printf("[INIT] TFT OK (%lu ms, GPIO)\n", millis());
+    return lifeline::BOOT_DONE;
+  }
 }
 
 void setAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
-  writeCommand(0x2A);
-  writeDataByte(x0 >> 8);
-  writeDataByte(x0);
-  writeDataByte(x1 >> 8);
-  writeDataByte(x1);
-
-  writeCommand(0x2B);
-  writeDataByte(y0 >> 8);
-  writeDataByte(y0);
-  writeDataByte(y1 >> 8);
-  writeDataByte(y1);
+  tft.setAddressWindow(x0, y0, x1, y1);
+  screens.window(x0, y0, x1, y1);
+}
 
-  writeCommand(0x2C);
+void panelFill(uint16_t color, uint32_t count) {
+  tft.fill(color, count);
+  screens.fill(color, count);
 }
 
 void fillScreen(uint16_t color) {
   setAddressWindow(0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1);
-  digitalWrite(TFT_RS, HIGH);
-  digitalWrite(TFT_CS, LOW);
-  uint8_t hi = color >> 8, lo = color & 0xFF;
-  for (uint32_t i = 0; i < (uint32_t)SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
-    writeData8(hi);
-    writeData8(lo);
-  }
-  digitalWrite(TFT_CS, HIGH);
+  panelFill(color, (uint32_t)SCREEN_WIDTH * SCREEN_HEIGHT);
 }
 
 void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
@@ -311,25 +252,14 @@ void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
     return;
 
   setAddressWindow(x, y, x + w - 1, y + h - 1);
-  digitalWrite(TFT_RS, HIGH);
-  digitalWrite(TFT_CS, LOW);
-  uint8_t hi = color >> 8, lo = color & 0xFF;
-  for (uint32_t i = 0; i < (uint32_t)w * h; i++) {
-    writeData8(hi);
-    writeData8(lo);
-  }
-  digitalWrite(TFT_CS, HIGH);
+  panelFill(color, (uint32_t)w * h);
 }
 
 void drawPixel(int16_t x, int16_t y, uint16_t color) {
   if (x < 0 || x >= SCREEN_WIDTH || y < 0 || y >= SCREEN_HEIGHT)
     return;
   setAddressWindow(x, y, x, y);
-  digitalWrite(TFT_RS, HIGH);
-  digitalWrite(TFT_CS, LOW);
-  writeData8(color >> 8);
-  writeData8(color);
-  digitalWrite(TFT_CS, HIGH);
+  panelFill(color, 1);
 }
 
 void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
@@ -486,6 +416,15 @@ void drawTextCentered(int16_t y, const char *text, uint16_t color,
   drawText(x, y, text, color, size);
 }
 
+/**
+ * Draw a UI table string centered horizontally (width precomputed)
+ */
+void drawTextCentered(int16_t y, const lifeline::Text &text, uint16_t color,
+                      uint8_t size) {
+  drawText(lifeline::centerX(text, size, SCREEN_WIDTH), y, text.str, color,
+           size);
+}
+
 /**
  * Draw text right-aligned
  */
@@ -1065,6 +1004,33 @@ void drawSeparator(int16_t y) {
 #define LORA_FREQUENCY 433E6
 #define LORA_SF 12
 #define LORA_BW 125E3
+#define LORA_TX_POWER 17 // SOS power (dBm); heartbeats follow the power tier
+
+// Battery sense. Every ADC1 pin (GPIO1-10) is taken by the display bus and
+// LoRa, so this build has none by default; wire a divider to a free ADC1 pin
+// and set it here. Without it the tier stays NORMAL ("power <n>" forces one).
+#define BATTERY_ADC_PIN -1
+#define BATTERY_DIVIDER 2.0f
+
+#define HEARTBEAT_INTERVAL 900000 // Energy heartbeat period (ms) - 15 min
+
+// Energy model for this build (mA per state, see EnergyMeter.h for order)
+const lifeline::EnergyCalibration energyCalibration = {
+    {
+        {0.0002f, 1.6f, 10.8f, 100.0f}, // Radio: sleep, standby, rx, tx
+        {0.0f, 70.0f, 0.0f, 0.0f},      // Display: off, on (3.5" ILI9488)
+        {0.8f, 25.0f, 45.0f, 0.0f},     // CPU: light sleep, idle, active (S3)
+        {0.6f, 8.0f, 0.0f, 0.0f},       // NeoPixel: off, strobe @ 100/255
+        {0.0f, 0.0f, 0.0f, 0.0f},       // Buzzer: not fitted
+    },
+    5.5f // Board baseline (MPU6050, regulator, PSRAM)
+};
+lifeline::EnergyMeter energy(energyCalibration);
+lifeline::BatteryMonitor battery(BATTERY_ADC_PIN, BATTERY_DIVIDER);
+
+// Pending SOS and reset counters in RTC memory (survive brownout/watchdog)
+LIFELINE_RTC_NOINIT lifeline::RtcJournal rtcJournal;
+lifeline::AlertJournal alertJournal(rtcJournal);
 
 // Keypad Configuration (User Specified Serial Layout)
 const byte KEYPAD_ROWS = 4;
@@ -1085,15 +1051,26 @@ Adafruit_NeoPixel neopixel(NEOPIXEL_COUNT, NEOPIXEL_PIN, NEO_GRB + NEO_KHZ800);
 enum StrobeEffect { STROBE_RAINBOW, STROBE_RED, STROBE_BLUE, STROBE_GREEN };
 StrobeEffect currentStrobeEffect = STROBE_RAINBOW;
 
-// Rainbow Aeroplane Strobe Effect
+// Rainbow Aeroplane Strobe Effect (period and flash length follow the tier)
 void flashingStrobe() {
   static unsigned long lastStrobe = 0;
   static bool isOn = false;
   static uint16_t hue = 0;
   unsigned long now = millis();
+  const lifeline::PowerPolicy &policy = battery.policy();
+
+  if (policy.strobePeriodMs == 0) {
+    if (isOn) {
+      isOn = false;
+      neopixel.setPixelColor(0, 0);
+      neopixel.show();
+      energy.set(lifeline::EN_NEOPIXEL, lifeline::LOAD_OFF);
+    }
+    return;
+  }
 
-  // 1 second interval (flash every 1000ms)
-  if (!isOn && (now - lastStrobe >= 1000)) {
+  // Flash every strobePeriodMs (1 s at NORMAL)
+  if (!isOn && (now - lastStrobe >= policy.strobePeriodMs)) {
     lastStrobe = now;
     isOn = true;
 
@@ -1109,10 +1086,12 @@ void flashingStrobe() {
       neopixel.setPixelColor(0, neopixel.Color(0, 255, 0));
     }
     neopixel.show();
-  } else if (isOn && (now - lastStrobe >= 80)) { // 80ms flash duration
+    energy.set(lifeline::EN_NEOPIXEL, lifeline::LOAD_ON);
+  } else if (isOn && (now - lastStrobe >= policy.strobeOnMs)) {
     isOn = false;
     neopixel.setPixelColor(0, 0); // Off
     neopixel.show();
+    energy.set(lifeline::EN_NEOPIXEL, lifeline::LOAD_OFF);
   }
 }
 
@@ -1142,21 +1121,47 @@ Keypad keypad = Keypad(makeKeymap(keypadLayout), rowPins, colPins, KEYPAD_ROWS,
 
 #define ALERT_COUNT 15
 
-const char *alertNames[ALERT_COUNT] = {
-    "EMERGENCY",         "MEDICAL EMERGENCY", "MEDICINE SHORTAGE",
-    "EVACUATION NEEDED", "STATUS OK",         "INJURY REPORTED",
-    "FOOD SHORTAGE",     "WATER SHORTAGE",    "WEATHER ALERT",
-    "LOST PERSON",       "ANIMAL ATTACK",     "LANDSLIDE",
-    "SNOW STORM",        "EQUIPMENT FAILURE", "OTHER EMERGENCY"};
-
-const char *alertShort[ALERT_COUNT] = {
-    "EMERGENCY", "MEDICAL",   "MEDICINE", "EVACUATION", "STATUS OK",
-    "INJURY",    "FOOD",      "WATER",    "WEATHER",    "LOST PERSON",
-    "ANIMAL",    "LANDSLIDE", "SNOW",     "EQUIPMENT",  "OTHER"};
+// Alert names live once in LifelineCore (UiText.h)
+const lifeline::Text *const alertNames = lifeline::ui::ALERT_NAMES;
+const lifeline::Text *const alertShort = lifeline::ui::ALERT_WORDS;
+static_assert(lifeline::ui::ALERT_NAMES_COUNT == ALERT_COUNT,
+              "alert table size must match ALERT_COUNT");
 
 const uint8_t alertPriority[ALERT_COUNT] = {0, 0, 2, 0, 3, 1, 2, 2,
                                             2, 1, 1, 1, 1, 2, 4};
-const char *priorityLabels[] = {"CRITICAL", "HIGH", "MEDIUM", "OK", "INFO"};
+const lifeline::Text *const priorityLabels = lifeline::ui::PRIORITY_LABELS;
+
+// Nepali alert words, shaped at build time (UiTextNe.h); info hub key 4
+const lifeline::ShapedText *const alertShortNe = lifeline::ui_ne::ALERT_WORDS;
+static_assert(lifeline::ui_ne::ALERT_WORDS_COUNT == ALERT_COUNT,
+              "Nepali alert table size must match ALERT_COUNT");
+lifeline::Lang uiLang = lifeline::Lang::EN;
+
+/**
+ * Alert word in the UI language. The 16 px Nepali font is drawn at half the
+ * text size and raised by its top margin, so it sits on the English line.
+ */
+void drawAlertWord(int16_t x, int16_t y, int index, uint16_t color,
+                   uint8_t size) {
+  if (uiLang == lifeline::Lang::NE) {
+    uint8_t scale = size > 1 ? size / 2 : 1;
+    lifeline::drawShaped(fillRect, lifeline::ui_ne::FONT, alertShortNe[index],
+                         x, y - 2 * scale, color, scale);
+  } else {
+    drawText(x, y, alertShort[index].str, color, size);
+  }
+}
+
+void drawAlertWordCentered(int16_t y, int index, uint16_t color,
+                           uint8_t size) {
+  if (uiLang == lifeline::Lang::NE) {
+    uint8_t scale = size > 1 ? size / 2 : 1;
+    drawAlertWord(lifeline::centerX(alertShortNe[index], scale, SCREEN_WIDTH),
+                  y, index, color, size);
+  } else {
+    drawTextCentered(y, alertShort[index], color, size);
+  }
+}
 
 String getAlertCode(int index) {
   // Return the index as a string (0-14).
@@ -1182,7 +1187,7 @@ uint16_t getPriorityColor(uint8_t priority) {
 const char *getPriorityText(int index) {
   if (index < 0 || index >= ALERT_COUNT)
     return "";
-  return priorityLabels[alertPriority[index]];
+  return priorityLabels[alertPriority[index]].str;
 }
 
 uint16_t getAlertColor(int index) {
@@ -1221,7 +1226,6 @@ int manualPage = 0;
 
 unsigned long bootStartTime = 0;
 unsigned long resultStartTime = 0;
-#define BOOT_DISPLAY_TIME 1500
 #define RESULT_SUCCESS_TIME 2000
 
 bool lastTransmitSuccess = false;
@@ -1229,6 +1233,20 @@ int retryCount = 0;
 int totalTransmissions = 0;
 int successfulTransmissions = 0;
 bool loraInitialized = false;
+bool resumedOnBoot = false; // An interrupted SOS was re-sent during setup()
+
+// Latency budget: key press → radio start → TxDone (serial "lat")
+unsigned long keyPressMicros = 0;
+lifeline::LatencyRecorder<> txLatency;
+unsigned long lastHeartbeatTime = 0;
+char serialCmd[16];
+uint8_t serialCmdLen = 0;
+
+// Overlapped panel / radio / sensor bring-up (serial "boot" prints it)
+lifeline::BootSequencer bootSeq;
+int8_t radioBootTask = -1;
+int8_t panelBootTask = -1;
+#define LORA_INIT_RETRIES 3 // Extra LoRa.begin() attempts at boot
 
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                     MPU & LANDSLIDE LOGIC (Moved here for scope)
@@ -1243,7 +1261,7 @@ bool landslideDetecting = false;
 // Forward Declarations for Screen functions used in MPU logic
 void drawMenuScreen();
 void drawResultScreen();
-bool transmitAlert();
+bool transmitAlert(bool resumed = false);
 
 // Visualization
 void drawMPUBarGraph(float magnitude) {
@@ -1251,9 +1269,14 @@ void drawMPUBarGraph(float magnitude) {
   if (currentScreen != SCREEN_MENU)
     return;
 
+  // Power tiers slow the graph down, then drop it (detection keeps running)
+  const uint8_t animationLevel = battery.policy().animationLevel;
+  if (animationLevel == 0)
+    return;
+
   static unsigned long lastUpdate = 0;
-  if (millis() - lastUpdate < 50)
-    return; // Limit refresh to 20fps for anti-flicker
+  if (millis() - lastUpdate < (animationLevel >= 2 ? 50UL : 250UL))
+    return; // 20fps for anti-flicker, 4fps in SAVER
   lastUpdate = millis();
 
   int barW = 30;
@@ -1313,6 +1336,8 @@ void checkLandslide() {
       } else if (millis() - landslideStartTime >= LANDSLIDE_DURATION) {
         Serial.println(F("[AUTO] Landslide Triggered! SOS Code 55."));
         selectedAlertIndex = 11; // LANDSLIDE
+        keyPressMicros = micros(); // Sensor trigger stands in for the key
+        alertJournal.arm(selectedAlertIndex);
         transmitAlert();
 
         currentScreen = SCREEN_RESULT;
@@ -1359,8 +1384,9 @@ void drawBootScreen() {
   fillRect(cx - 22, cy - 5, 44, 10, COLOR_RED);
 
   // Title
-  drawTextCentered(100, "LifeLine", WHITE, TEXT_XLARGE);
-  drawTextCentered(145, "EMERGENCY TRANSMITTER", COLOR_CYAN_C, TEXT_SMALL);
+  drawTextCentered(100, lifeline::ui::LIFELINE, WHITE, TEXT_XLARGE);
+  drawTextCentered(145, lifeline::ui::EMERGENCY_TRANSMITTER, COLOR_CYAN_C,
+                   TEXT_SMALL);
 
   // Info cards
   int cardY = SCREEN_HEIGHT - 80;
@@ -1386,24 +1412,129 @@ void drawBootScreen() {
   bootStartTime = millis();
 }
 
-void drawMenuScreen() {
+// Backgrounds are drawn here but not on the device: tools/bake_screens in the
+// host build renders them into ScreenBackgrounds.h, which the screens below
+// send from flash in one stream. After changing one, rerun the tool (the
+// host tests fail until then).
+
+void drawMenuBackground() {
   drawHeader("SELECT ALERT TYPE");
   fillRect(0, HEADER_HEIGHT + 1, SCREEN_WIDTH,
            SCREEN_HEIGHT - HEADER_HEIGHT - FOOTER_HEIGHT - 2, COLOR_BG_PRIMARY);
+  fillRoundRect(SCREEN_WIDTH - 48, 8, 42, 18, 4, COLOR_BG_CARD); // ID badge
+
+  // Footer
+  int footerY = SCREEN_HEIGHT - FOOTER_HEIGHT;
+  drawFastHLine(0, footerY - 1, SCREEN_WIDTH, COLOR_ACCENT_LINE);
+  drawGradientV(0, footerY, SCREEN_WIDTH, FOOTER_HEIGHT, COLOR_BG_HEADER_ALT,
+                RGB565(5, 10, 15));
+  drawText(MARGIN, footerY + 12, "A/B:Nav *:Sel C:Info D:Help",
+           COLOR_TEXT_MUTED, TEXT_SMALL);
+}
+
+void drawConfirmBackground() {
+  drawGradientV(0, 0, SCREEN_WIDTH, HEADER_HEIGHT, RGB565(60, 45, 0),
+                COLOR_AMBER_DARK);
+  fillRect(0, HEADER_HEIGHT + 1, SCREEN_WIDTH,
+           SCREEN_HEIGHT - HEADER_HEIGHT - 1, COLOR_BG_PRIMARY);
+  drawFastHLine(0, HEADER_HEIGHT, SCREEN_WIDTH, COLOR_AMBER);
+
+  drawText(MARGIN + 30, (HEADER_HEIGHT - 14) / 2, "CONFIRM TRANSMISSION",
+           COLOR_TEXT_DARK, TEXT_MEDIUM);
+
+  // Buttons
+  int btnY = SCREEN_HEIGHT - 60;
+  int btnW = 100, btnH = 38;
+  int btnX1 = (SCREEN_WIDTH - btnW * 2 - 20) / 2;
+  int btnX2 = btnX1 + btnW + 20;
+
+  fillRoundRect(btnX1, btnY, btnW, btnH, 5, COLOR_GREEN);
+  drawTextCentered(btnY + 12, lifeline::ui::SEND, COLOR_TEXT_DARK, TEXT_MEDIUM);
+
+  fillRoundRect(btnX2, btnY, btnW, btnH, 5, COLOR_BG_CARD);
+  drawRoundRect(btnX2, btnY, btnW, btnH, 5, COLOR_RED);
+  drawText(btnX2 + 12, btnY + 12, "# CANCEL", COLOR_RED, TEXT_MEDIUM);
+}
+
+void drawSendingBackground() {
+  drawGradientV(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, RGB565(8, 15, 25),
+                COLOR_BG_PRIMARY);
+  drawHeader("TRANSMITTING...");
+
+  int cx = SCREEN_WIDTH / 2, cy = 120;
+  for (int i = 4; i > 0; i--) {
+    drawCircle(cx, cy, 18 + i * 12, RGB565(80 - i * 15, 40 - i * 8, 10));
+  }
+  drawGlowCircle(cx, cy, 16, COLOR_ORANGE);
+  fillRect(cx - 3, cy - 26, 6, 12, COLOR_ORANGE);
+  fillCircle(cx, cy - 28, 5, COLOR_ORANGE);
+
+  int cardY = 180;
+  drawPremiumCard(MARGIN, cardY, SCREEN_WIDTH - MARGIN * 2, 50, COLOR_BG_CARD,
+                  COLOR_ORANGE_DARK);
+  fillRect(MARGIN, cardY, 5, 50, COLOR_ORANGE);
+  drawText(MARGIN + 14, cardY + 10, "SENDING:", COLOR_TEXT_MUTED, TEXT_SMALL);
+}
+
+void drawResultSentBackground() {
+  drawGradientV(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, RGB565(10, 40, 25),
+                RGB565(5, 20, 12));
+  drawHeader("SUCCESS");
+
+  int cx = SCREEN_WIDTH / 2, cy = 120;
+  fillCircle(cx, cy, 35, COLOR_GREEN);
+  // Checkmark
+  for (int t = -2; t <= 2; t++) {
+    drawLine(cx - 14, cy + t, cx - 4, cy + 12 + t, COLOR_TEXT_DARK);
+    drawLine(cx - 4, cy + 12 + t, cx + 16, cy - 10 + t, COLOR_TEXT_DARK);
+  }
+
+  drawTextCentered(180, lifeline::ui::MESSAGE_SENT, COLOR_GREEN_BRIGHT,
+                   TEXT_MEDIUM);
+  drawTextCentered(SCREEN_HEIGHT - 50, lifeline::ui::RETURNING,
+                   COLOR_TEXT_MUTED, TEXT_SMALL);
+}
+
+void drawResultFailedBackground() {
+  drawGradientV(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, RGB565(45, 15, 15),
+                RGB565(20, 8, 8));
+  drawHeader("FAILED");
 
-  // Device ID badge
+  int cx = SCREEN_WIDTH / 2, cy = 120;
+  fillCircle(cx, cy, 35, COLOR_RED);
+  // X mark
+  for (int t = -2; t <= 2; t++) {
+    drawLine(cx - 14 + t, cy - 14, cx + 14 + t, cy + 14, WHITE);
+    drawLine(cx + 14 + t, cy - 14, cx - 14 + t, cy + 14, WHITE);
+  }
+
+  drawTextCentered(180, lifeline::ui::SEND_FAILED, COLOR_RED_BRIGHT,
+                   TEXT_MEDIUM);
+
+  int btnY = SCREEN_HEIGHT - 60;
+  fillRoundRect(60, btnY, 90, 36, 5, COLOR_AMBER);
+  drawText(72, btnY + 10, "* RETRY", COLOR_TEXT_DARK, TEXT_MEDIUM);
+  fillRoundRect(170, btnY, 90, 36, 5, COLOR_BG_CARD);
+  drawText(182, btnY + 10, "# MENU", COLOR_TEXT_SECONDARY, TEXT_MEDIUM);
+}
+
+// Fields: what is drawn over a background. The tool draws each one for every
+// alert and language and stores the rectangle they cover (bg::MENU_LIST...)
+
+void drawMenuId() {
   char idStr[10];
   sprintf(idStr, "#%03d", DEVICE_ID);
-  fillRoundRect(SCREEN_WIDTH - 48, 8, 42, 18, 4, COLOR_BG_CARD);
   drawText(SCREEN_WIDTH - 44, 12, idStr, COLOR_CYAN_C, TEXT_SMALL);
+}
 
-  // Scroll indicator
+void drawMenuRange() {
   char rangeStr[16];
   sprintf(rangeStr, "%d-%d/%d", menuScrollOffset + 1,
           min(menuScrollOffset + VISIBLE_MENU_ITEMS, ALERT_COUNT), ALERT_COUNT);
   drawText(MARGIN, HEADER_HEIGHT + 8, rangeStr, COLOR_TEXT_MUTED, TEXT_SMALL);
+}
 
-  // Menu items
+void drawMenuList() {
   int listY = HEADER_HEIGHT + 26;
   for (int i = 0; i < VISIBLE_MENU_ITEMS; i++) {
     int idx = menuScrollOffset + i;
@@ -1422,16 +1553,15 @@ void drawMenuScreen() {
       sprintf(numStr, "%2d", idx + 1);
       fillRoundRect(MARGIN + 6, itemY + 5, 24, 20, 3, COLOR_TEXT_DARK);
       drawText(MARGIN + 10, itemY + 8, numStr, COLOR_AMBER, TEXT_MEDIUM);
-      drawText(MARGIN + 36, itemY + 8, alertShort[idx], COLOR_TEXT_DARK,
-               TEXT_MEDIUM);
+      drawAlertWord(MARGIN + 36, itemY + 8, idx, COLOR_TEXT_DARK, TEXT_MEDIUM);
     } else {
       drawRoundRect(MARGIN, itemY, itemW, MENU_ITEM_HEIGHT - 3, 4,
                     COLOR_BORDER);
       char numStr[4];
       sprintf(numStr, "%2d", idx + 1);
       drawText(MARGIN + 8, itemY + 9, numStr, COLOR_TEXT_MUTED, TEXT_MEDIUM);
-      drawText(MARGIN + 32, itemY + 9, alertShort[idx], COLOR_TEXT_SECONDARY,
-               TEXT_MEDIUM);
+      drawAlertWord(MARGIN + 32, itemY + 9, idx, COLOR_TEXT_SECONDARY,
+                    TEXT_MEDIUM);
     }
 
     uint16_t pc = getAlertColor(idx);
@@ -1442,123 +1572,171 @@ void drawMenuScreen() {
     int labelX = SCREEN_WIDTH - MARGIN - 80;
     drawText(labelX, itemY + 9, label, pc, TEXT_SMALL);
   }
-
-  // Footer
-  int footerY = SCREEN_HEIGHT - FOOTER_HEIGHT;
-  drawFastHLine(0, footerY - 1, SCREEN_WIDTH, COLOR_ACCENT_LINE);
-  drawGradientV(0, footerY, SCREEN_WIDTH, FOOTER_HEIGHT, COLOR_BG_HEADER_ALT,
-                RGB565(5, 10, 15));
-  drawText(MARGIN, footerY + 12, "A/B:Nav *:Sel C:Info D:Help",
-           COLOR_TEXT_MUTED, TEXT_SMALL);
 }
 
-void drawConfirmScreen() {
-  drawGradientV(0, 0, SCREEN_WIDTH, HEADER_HEIGHT, RGB565(60, 45, 0),
-                COLOR_AMBER_DARK);
-  fillRect(0, HEADER_HEIGHT + 1, SCREEN_WIDTH,
-           SCREEN_HEIGHT - HEADER_HEIGHT - 1, COLOR_BG_PRIMARY);
-  drawFastHLine(0, HEADER_HEIGHT, SCREEN_WIDTH, COLOR_AMBER);
-
-  drawText(MARGIN + 30, (HEADER_HEIGHT - 14) / 2, "CONFIRM TRANSMISSION",
-           COLOR_TEXT_DARK, TEXT_MEDIUM);
-
+void drawConfirmCard() {
   int cardY = HEADER_HEIGHT + 20;
   uint16_t alertColor = getAlertColor(selectedAlertIndex);
 
   drawPremiumCard(MARGIN, cardY, SCREEN_WIDTH - MARGIN * 2, 60, COLOR_BG_CARD,
                   alertColor);
   fillRect(MARGIN, cardY, 6, 60, alertColor);
-  drawText(MARGIN + 18, cardY + 10, alertNames[selectedAlertIndex], alertColor,
-           TEXT_MEDIUM);
+  drawText(MARGIN + 18, cardY + 10, alertNames[selectedAlertIndex].str,
+           alertColor, TEXT_MEDIUM);
 
   // Priority Tag
   drawText(MARGIN + 18, cardY + 35, getPriorityText(selectedAlertIndex),
            COLOR_TEXT_MUTED, TEXT_SMALL);
 
   char codeStr[5];
-  sprintf(codeStr, "%d", getAlertCode(selectedAlertIndex));
+  snprintf(codeStr, sizeof(codeStr), "%s",
+           getAlertCode(selectedAlertIndex).c_str());
   fillRoundRect(SCREEN_WIDTH - MARGIN - 40, cardY + 18, 30, 24, 4, alertColor);
   drawText(SCREEN_WIDTH - MARGIN - 32, cardY + 22, codeStr, COLOR_TEXT_DARK,
            TEXT_MEDIUM);
+}
 
-  // Buttons
-  int btnY = SCREEN_HEIGHT - 60;
-  int btnW = 100, btnH = 38;
-  int btnX1 = (SCREEN_WIDTH - btnW * 2 - 20) / 2;
-  int btnX2 = btnX1 + btnW + 20;
+void drawSendingAlert() {
+  int cardY = 180;
+  drawAlertWord(MARGIN + 14, cardY + 28, selectedAlertIndex, WHITE,
+                TEXT_MEDIUM);
+}
 
-  fillRoundRect(btnX1, btnY, btnW, btnH, 5, COLOR_GREEN);
-  drawTextCentered(btnY + 12, "* SEND", COLOR_TEXT_DARK, TEXT_MEDIUM);
+void drawResultSentAlert() {
+  drawAlertWordCentered(210, selectedAlertIndex, WHITE, TEXT_SMALL);
+}
 
-  fillRoundRect(btnX2, btnY, btnW, btnH, 5, COLOR_BG_CARD);
-  drawRoundRect(btnX2, btnY, btnW, btnH, 5, COLOR_RED);
-  drawText(btnX2 + 12, btnY + 12, "# CANCEL", COLOR_RED, TEXT_MEDIUM);
+void drawResultAttempt() {
+  char retryStr[24];
+  sprintf(retryStr, "Attempt %d/%d", retryCount + 1, MAX_RETRY_ATTEMPTS);
+  drawTextCentered(210, retryStr, COLOR_TEXT_SECONDARY, TEXT_SMALL);
 }
 
-void drawSendingScreen() {
-  drawGradientV(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, RGB565(8, 15, 25),
-                COLOR_BG_PRIMARY);
-  drawHeader("TRANSMITTING...");
+// Baked images go where the drawing code's output goes: to the panel, and
+// into the screen being recorded. Short runs and literal pixels are packed
+// into span-sized transfers; long runs stay fills
+#define PANEL_PACK_MIN_RUN 64
+uint16_t panelPack[I80_SPAN_PIXELS];
 
-  int cx = SCREEN_WIDTH / 2, cy = 120;
-  for (int i = 4; i > 0; i--) {
-    drawCircle(cx, cy, 18 + i * 12, RGB565(80 - i * 15, 40 - i * 8, 10));
+struct PanelOut {
+  uint32_t packed = 0;
+
+  ~PanelOut() { drain(); }
+  void window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    drain();
+    setAddressWindow(x0, y0, x1, y1);
   }
-  drawGlowCircle(cx, cy, 16, COLOR_ORANGE);
-  fillRect(cx - 3, cy - 26, 6, 12, COLOR_ORANGE);
-  fillCircle(cx, cy - 28, 5, COLOR_ORANGE);
+  void fill(uint16_t color, uint32_t count) {
+    if (count >= PANEL_PACK_MIN_RUN) {
+      drain();
+      panelFill(color, count);
+      return;
+    }
+    while (count--)
+      put(color);
+  }
+  void pixels(const uint16_t *px, uint32_t n) {
+    for (uint32_t i = 0; i < n; i++)
+      put(px[i]);
+  }
+  void put(uint16_t color) {
+    if (packed == I80_SPAN_PIXELS)
+      drain();
+    panelPack[packed++] = color;
+  }
+  void drain() {
+    if (!packed)
+      return;
+    tft.pushPixels(panelPack, packed);
+    screens.pixels(panelPack, packed);
+    packed = 0;
+  }
+};
 
-  int cardY = 180;
-  drawPremiumCard(MARGIN, cardY, SCREEN_WIDTH - MARGIN * 2, 50, COLOR_BG_CARD,
-                  COLOR_ORANGE_DARK);
-  fillRect(MARGIN, cardY, 5, 50, COLOR_ORANGE);
-  drawText(MARGIN + 14, cardY + 10, "SENDING:", COLOR_TEXT_MUTED, TEXT_SMALL);
-  drawText(MARGIN + 14, cardY + 28, alertShort[selectedAlertIndex], WHITE,
-           TEXT_MEDIUM);
+void drawBackground(const lifeline::PanelImage &image) {
+  PanelOut out;
+  lifeline::drawPanelImage(image, out);
 }
 
-void drawResultScreen() {
-  if (lastTransmitSuccess) {
-    drawGradientV(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, RGB565(10, 40, 25),
-                  RGB565(5, 20, 12));
-    drawHeader("SUCCESS");
-
-    int cx = SCREEN_WIDTH / 2, cy = 120;
-    fillCircle(cx, cy, 35, COLOR_GREEN);
-    // Checkmark
-    for (int t = -2; t <= 2; t++) {
-      drawLine(cx - 14, cy + t, cx - 4, cy + 12 + t, COLOR_TEXT_DARK);
-      drawLine(cx - 4, cy + 12 + t, cx + 16, cy - 10 + t, COLOR_TEXT_DARK);
-    }
+/** The background under a field, before the field is drawn again. */
+void restoreField(const lifeline::PanelImage &image,
+                  const lifeline::FieldRect &field) {
+  PanelOut out;
+  lifeline::drawPanelImage(image, out, field);
+}
 
-    drawTextCentered(180, "Message Sent!", COLOR_GREEN_BRIGHT, TEXT_MEDIUM);
-    drawTextCentered(210, alertShort[selectedAlertIndex], WHITE, TEXT_SMALL);
-    drawTextCentered(SCREEN_HEIGHT - 50, "Returning...", COLOR_TEXT_MUTED,
-                     TEXT_SMALL);
-  } else {
-    drawGradientV(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, RGB565(45, 15, 15),
-                  RGB565(20, 8, 8));
-    drawHeader("FAILED");
-
-    int cx = SCREEN_WIDTH / 2, cy = 120;
-    fillCircle(cx, cy, 35, COLOR_RED);
-    // X mark
-    for (int t = -2; t <= 2; t++) {
-      drawLine(cx - 14 + t, cy - 14, cx + 14 + t, cy + 14, WHITE);
-      drawLine(cx + 14 + t, cy - 14, cx - 14 + t, cy + 14, WHITE);
-    }
+// Menu, confirm, sending and result come back from PSRAM when their static
+// layer was drawn before (serial "ui" prints the cache)
 
-    drawTextCentered(180, "Send Failed!", COLOR_RED_BRIGHT, TEXT_MEDIUM);
-    char retryStr[24];
-    sprintf(retryStr, "Attempt %d/%d", retryCount + 1, MAX_RETRY_ATTEMPTS);
-    drawTextCentered(210, retryStr, COLOR_TEXT_SECONDARY, TEXT_SMALL);
+/** Key of a static layer: the fields it shows, in the current language. */
+uint32_t screenKey(int32_t a, int32_t b = 0) {
+  const int32_t fields[3] = {(int32_t)uiLang, a, b};
+  return lifeline::fnv1a(fields, sizeof(fields));
+}
 
-    int btnY = SCREEN_HEIGHT - 60;
-    fillRoundRect(60, btnY, 90, 36, 5, COLOR_AMBER);
-    drawText(72, btnY + 10, "* RETRY", COLOR_TEXT_DARK, TEXT_MEDIUM);
-    fillRoundRect(170, btnY, 90, 36, 5, COLOR_BG_CARD);
-    drawText(182, btnY + 10, "# MENU", COLOR_TEXT_SECONDARY, TEXT_MEDIUM);
+/**
+ * Blit the stored static layer of (screen, key) and return true, or start
+ * recording it and return false: the caller draws it, then commits.
+ */
+bool blitScreen(uint8_t screen, uint32_t key) {
+  const uint8_t *frame = screens.find(screen, key);
+  if (!frame) {
+    screens.record(screen, key);
+    return false;
   }
+  setAddressWindow(0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1);
+  tft.pushStored(frame, (uint32_t)SCREEN_WIDTH * SCREEN_HEIGHT);
+  return true;
+}
+
+void drawMenuScreen() {
+  if (blitScreen(SCREEN_MENU, screenKey(menuScrollOffset, selectedAlertIndex)))
+    return;
+  drawBackground(bg::MENU);
+  drawMenuId();
+  drawMenuRange();
+  drawMenuList();
+  screens.commit();
+}
+
+/** A/B in the menu: only the list and its range change. */
+void drawMenuSelection() {
+  restoreField(bg::MENU, bg::MENU_RANGE);
+  drawMenuRange();
+  restoreField(bg::MENU, bg::MENU_LIST);
+  drawMenuList();
+}
+
+void drawConfirmScreen() {
+  if (blitScreen(SCREEN_CONFIRM, screenKey(selectedAlertIndex)))
+    return;
+  drawBackground(bg::CONFIRM);
+  drawConfirmCard();
+  screens.commit();
+}
+
+void drawSendingScreen() {
+  if (blitScreen(SCREEN_SENDING, screenKey(selectedAlertIndex)))
+    return;
+  drawBackground(bg::SENDING);
+  drawSendingAlert();
+  screens.commit();
+}
+
+void drawResultScreen() {
+  // The attempt counter is the one field drawn over the stored layer
+  if (!blitScreen(SCREEN_RESULT,
+                  screenKey(lastTransmitSuccess, selectedAlertIndex))) {
+    if (lastTransmitSuccess) {
+      drawBackground(bg::RESULT_SENT);
+      drawResultSentAlert();
+    } else {
+      drawBackground(bg::RESULT_FAILED);
+    }
+    screens.commit();
+  }
+  if (!lastTransmitSuccess)
+    drawResultAttempt();
   resultStartTime = millis();
 }
 
@@ -1594,6 +1772,24 @@ void drawSystemInfoScreen() {
           totalTransmissions);
   drawText(MARGIN + 12, y + 28, statsStr, WHITE, TEXT_MEDIUM);
 
+  y += 60;
+  drawPremiumCard(MARGIN, y, SCREEN_WIDTH - MARGIN * 2, 50, COLOR_BG_CARD,
+                  COLOR_AMBER_DARK);
+  char tierStr[32];
+  if (battery.present())
+    sprintf(tierStr, "POWER  %d%%  %s", battery.percent(),
+            lifeline::powerTierNames[battery.tier()]);
+  else
+    sprintf(tierStr, "POWER  USB  %s", lifeline::powerTierNames[battery.tier()]);
+  drawText(MARGIN + 12, y + 10, tierStr, COLOR_AMBER, TEXT_SMALL);
+  char powerStr[24];
+  float lifeHours = energy.projectedHours(remainingBatteryMah());
+  if (lifeHours >= 999.5f)
+    sprintf(powerStr, ">999 h");
+  else
+    sprintf(powerStr, "%.0f h @ %.0f mA", lifeHours, energy.averageMa());
+  drawText(MARGIN + 12, y + 28, powerStr, WHITE, TEXT_MEDIUM);
+
   drawFooter("Press any key to return");
 }
 
@@ -1611,7 +1807,8 @@ void drawUserManualScreen() {
 
   switch (manualPage) {
   case 0:
-    drawText(MARGIN, y, "SELECT ALERTS", COLOR_AMBER, TEXT_MEDIUM);
+    drawText(MARGIN, y, lifeline::ui::MANUAL_TITLES[0].str, COLOR_AMBER,
+             TEXT_MEDIUM);
     y += 30;
     drawText(MARGIN, y, "Use 1-9 for quick select", COLOR_TEXT_SECONDARY,
              TEXT_SMALL);
@@ -1620,7 +1817,8 @@ void drawUserManualScreen() {
              TEXT_SMALL);
     break;
   case 1:
-    drawText(MARGIN, y, "NAVIGATION", COLOR_CYAN_C, TEXT_MEDIUM);
+    drawText(MARGIN, y, lifeline::ui::MANUAL_TITLES[1].str, COLOR_CYAN_C,
+             TEXT_MEDIUM);
     y += 30;
     drawText(MARGIN, y, "A = Scroll UP", COLOR_TEXT_SECONDARY, TEXT_SMALL);
     y += 16;
@@ -1631,22 +1829,24 @@ void drawUserManualScreen() {
     drawText(MARGIN, y, "D = This Help", COLOR_TEXT_SECONDARY, TEXT_SMALL);
     break;
   case 2:
-    drawText(MARGIN, y, "SENDING", COLOR_GREEN, TEXT_MEDIUM);
+    drawText(MARGIN, y, lifeline::ui::MANUAL_TITLES[2].str, COLOR_GREEN,
+             TEXT_MEDIUM);
     y += 30;
     drawText(MARGIN, y, "* = Confirm & Send", COLOR_TEXT_SECONDARY, TEXT_SMALL);
     y += 16;
     drawText(MARGIN, y, "# = Cancel & Back", COLOR_TEXT_SECONDARY, TEXT_SMALL);
     break;
   case 3:
-    drawText(MARGIN, y, "LED INDICATORS", COLOR_PURPLE, TEXT_MEDIUM);
+    drawText(MARGIN, y, lifeline::ui::MANUAL_TITLES[3].str, COLOR_PURPLE,
+             TEXT_MEDIUM);
     y += 30;
     fillCircle(MARGIN + 8, y + 4, 6, COLOR_GREEN);
-    drawText(MARGIN + 22, y, "GREEN = Sent OK", COLOR_TEXT_SECONDARY,
-             TEXT_SMALL);
+    drawText(MARGIN + 22, y, lifeline::ui::MANUAL_LED_GREEN.str,
+             COLOR_TEXT_SECONDARY, TEXT_SMALL);
     y += 20;
     fillCircle(MARGIN + 8, y + 4, 6, COLOR_RED);
-    drawText(MARGIN + 22, y, "RED = Send Failed", COLOR_TEXT_SECONDARY,
-             TEXT_SMALL);
+    drawText(MARGIN + 22, y, lifeline::ui::MANUAL_LED_RED.str,
+             COLOR_TEXT_SECONDARY, TEXT_SMALL);
     break;
   }
 
@@ -1704,7 +1904,7 @@ void drawInfoHubScreen() {
            SCREEN_HEIGHT - HEADER_HEIGHT - FOOTER_HEIGHT - 2, COLOR_BG_PRIMARY);
 
   int y = HEADER_HEIGHT + 25;
-  drawPremiumCard(MARGIN, y, SCREEN_WIDTH - MARGIN * 2, 120, COLOR_BG_CARD,
+  drawPremiumCard(MARGIN, y, SCREEN_WIDTH - MARGIN * 2, 155, COLOR_BG_CARD,
                   COLOR_BORDER);
 
   drawText(MARGIN + 20, y + 15, "1: DISPLAY SETTINGS", COLOR_CYAN_C,
@@ -1713,6 +1913,10 @@ void drawInfoHubScreen() {
            TEXT_MEDIUM);
   drawText(MARGIN + 20, y + 85, "3: NEOPIXEL COLORS", COLOR_PURPLE,
            TEXT_MEDIUM);
+  drawText(MARGIN + 20, y + 120,
+           uiLang == lifeline::Lang::NE ? "4: LANGUAGE NEPALI"
+                                        : "4: LANGUAGE ENGLISH",
+           COLOR_GREEN, TEXT_MEDIUM);
 
   drawFooter("#:Back to Menu");
 }
@@ -1729,6 +1933,11 @@ void handleInfoHubInput(char key) {
     // Let's use a temporary jump or add to enum.
     // I'll use handleKeyPress to route based on a 'subState' or just separate
     // SCREENS. Adding SCREEN_NEO_SETTINGS to enum for clarity.
+  } else if (key == '4') {
+    // Alert words in the menu, sending and result screens
+    uiLang = uiLang == lifeline::Lang::NE ? lifeline::Lang::EN
+                                          : lifeline::Lang::NE;
+    drawInfoHubScreen();
   } else if (key == '#') {
     currentScreen = SCREEN_MENU;
     drawMenuScreen();
@@ -1764,8 +1973,9 @@ void calibrateMPU() {
   fillRect(0, HEADER_HEIGHT + 1, SCREEN_WIDTH,
            SCREEN_HEIGHT - HEADER_HEIGHT - FOOTER_HEIGHT - 2, COLOR_BG_PRIMARY);
 
-  drawTextCentered(130, "CALIBRATING...", COLOR_AMBER, 2);
-  drawTextCentered(160, "KEEP DEVICE STILL", COLOR_TEXT_SECONDARY, 1);
+  drawTextCentered(130, lifeline::ui::CALIBRATING, COLOR_AMBER, 2);
+  drawTextCentered(160, lifeline::ui::KEEP_DEVICE_STILL, COLOR_TEXT_SECONDARY,
+                   1);
 
   float axAvg = 0, ayAvg = 0, azAvg = 0;
   float gxAvg = 0, gyAvg = 0, gzAvg = 0;
@@ -1790,7 +2000,7 @@ void calibrateMPU() {
   // Note: These must be declared at the top of the file.
   // We'll trust they still are from previous steps.
 
-  drawTextCentered(240, "CALIBRATION COMPLETE!", COLOR_GREEN, 1);
+  drawTextCentered(240, lifeline::ui::CALIBRATION_COMPLETE, COLOR_GREEN, 1);
   delay(1500);
   currentScreen = SCREEN_SETTINGS;
   drawSettingsScreen();
@@ -1808,9 +2018,9 @@ void drawLandslideAlertScreen() {
   // Exclamation mark inside triangle
   drawText(cx - 5, cy + 20, "!", COLOR_RED, 2);
 
-  drawTextCentered(170, "WARNING!", WHITE, 3);
-  drawTextCentered(210, "LANDSLIDE DETECTED", WHITE, 2);
-  drawTextCentered(250, "SENDING SOS CODE: 55", COLOR_AMBER, 1);
+  drawTextCentered(170, lifeline::ui::WARNING, WHITE, 3);
+  drawTextCentered(210, lifeline::ui::LANDSLIDE_DETECTED, WHITE, 2);
+  drawTextCentered(250, lifeline::ui::SENDING_SOS_CODE, COLOR_AMBER, 1);
 
   // Rapid Red Blink logic is handled by the flash in checkLandslide or caller
   for (int i = 0; i < 4; i++) {
@@ -1827,18 +2037,40 @@ void drawLandslideAlertScreen() {
 //                     PART 6: INPUT HANDLERS & LORA
 // ═══════════════════════════════════════════════════════════════════════════════════
 
-bool transmitAlert() {
+// Send the journaled alert; s= lets the RX drop repeats, k= is omitted for
+// an alert resumed at boot (no key press to measure from)
+bool transmitAlert(bool resumed) {
   if (!loraInitialized)
     return false;
 
-  char packet[20];
-  sprintf(packet, "TX%03d,%s", DEVICE_ID,
-          getAlertCode(selectedAlertIndex).c_str());
-  Serial.printf("[LORA] TX: %s\n", packet);
+  // Stamp radio start; the UI share of the budget travels in the frame
+  unsigned long radioStartMicros = micros();
+  unsigned long uiMs = (radioStartMicros - keyPressMicros) / 1000;
 
+  char packet[40];
+  if (resumed)
+    snprintf(packet, sizeof(packet), "TX%03d,%s;s=%u", DEVICE_ID,
+             getAlertCode(selectedAlertIndex).c_str(), alertJournal.seq());
+  else
+    snprintf(packet, sizeof(packet), "TX%03d,%s;k=%lu;s=%u", DEVICE_ID,
+             getAlertCode(selectedAlertIndex).c_str(), uiMs,
+             alertJournal.seq());
+
+  LoRa.setTxPower(LORA_TX_POWER); // SOS always at full power
+  energy.set(lifeline::EN_RADIO, lifeline::RADIO_TX);
   LoRa.beginPacket();
   LoRa.print(packet);
   bool success = LoRa.endPacket();
+  radioRest();
+  if (success)
+    alertJournal.sent();
+
+  unsigned long radioDoneMicros = micros();
+  if (!resumed)
+    txLatency.record(lifeline::LAT_TX_UI, radioStartMicros - keyPressMicros);
+  txLatency.record(lifeline::LAT_TX_RADIO, radioDoneMicros - radioStartMicros);
+  Serial.printf("[LORA] TX: %s (radio %lu ms)\n", packet,
+                (radioDoneMicros - radioStartMicros) / 1000);
 
   totalTransmissions++;
   if (success)
@@ -1847,6 +2079,128 @@ bool transmitAlert() {
   return success;
 }
 
+// Re-send an SOS that a reset interrupted, before the UI comes up. It keeps
+// its sequence number, so a copy that did go out is dropped by the RX.
+void resumePendingAlert() {
+  if (alertJournal.abandoned()) {
+    Serial.printf("[RESUME] Alert s=%u abandoned after %d resets during send\n",
+                  alertJournal.seq(), JOURNAL_MAX_RESUMES);
+    return;
+  }
+  if (!alertJournal.pending() || !loraInitialized)
+    return;
+  if (alertJournal.pendingAlert() >= ALERT_COUNT) {
+    alertJournal.cancel();
+    return;
+  }
+
+  selectedAlertIndex = alertJournal.pendingAlert();
+  Serial.printf("[RESUME] Re-sending %s (s=%u, attempt %u) after %s reset\n",
+                alertNames[selectedAlertIndex].str, alertJournal.seq(),
+                alertJournal.resumes(), alertJournal.resetReasonName());
+  lastTransmitSuccess = transmitAlert(true);
+  retryCount = 0;
+  resumedOnBoot = true;
+}
+
+// Park the radio after TX: sleep in saver tiers (beginPacket() wakes it)
+void radioRest() {
+  if (battery.policy().radioSleep) {
+    LoRa.sleep();
+    energy.set(lifeline::EN_RADIO, lifeline::RADIO_SLEEP);
+  } else {
+    LoRa.idle();
+    energy.set(lifeline::EN_RADIO, lifeline::RADIO_STANDBY);
+  }
+}
+
+// Battery left for projections: measured charge, or a full pack on USB
+float remainingBatteryMah() {
+  int pct = battery.percent();
+  return pct >= 0 ? ENERGY_BATTERY_MAH * pct / 100.0f : ENERGY_BATTERY_MAH;
+}
+
+// Heartbeat period for the current tier (0 = heartbeats off)
+unsigned long heartbeatInterval() {
+  return (unsigned long)HEARTBEAT_INTERVAL * battery.policy().heartbeatScale;
+}
+
+// Energy projection broadcast; not counted as a transmission and sent with
+// the tier's efficient radio profile
+void sendHeartbeat() {
+  lastHeartbeatTime = millis();
+  if (!loraInitialized)
+    return;
+
+  energy.checkpoint();
+
+  char packet[64];
+  int len = snprintf(packet, sizeof(packet), "HB%03d;i=%u;l=%u;u=%lu",
+                     DEVICE_ID, (unsigned)(energy.averageMa() * 10.0f + 0.5f),
+                     (unsigned)(energy.projectedHours(remainingBatteryMah()) +
+                                0.5f),
+                     (unsigned long)(energy.uptimeMs() / 60000ULL));
+  if (battery.present())
+    snprintf(packet + len, sizeof(packet) - len, ";v=%u;b=%d",
+             battery.millivolts(), battery.percent());
+
+  LoRa.setTxPower(battery.policy().heartbeatTxPower);
+  energy.set(lifeline::EN_RADIO, lifeline::RADIO_TX);
+  LoRa.beginPacket();
+  LoRa.print(packet);
+  bool success = LoRa.endPacket();
+  LoRa.setTxPower(LORA_TX_POWER);
+  radioRest();
+
+  Serial.printf("[HB] %s %s\n", packet, success ? "sent" : "FAILED");
+}
+
+// Apply a new power tier (called once per tier change)
+void applyPowerTier() {
+  const lifeline::PowerPolicy &policy = battery.policy();
+  Serial.printf("[POWER] Tier %s at %d%%: strobe %u ms, heartbeat x%u @ %d "
+                "dBm, graph %u\n",
+                lifeline::powerTierNames[battery.tier()], battery.percent(),
+                policy.strobePeriodMs, policy.heartbeatScale,
+                policy.heartbeatTxPower, policy.animationLevel);
+  if (loraInitialized)
+    radioRest();
+  if (currentScreen == SCREEN_MENU)
+    drawMenuScreen(); // Clears a frozen MPU graph
+  else if (currentScreen == SCREEN_SYSTEM_INFO)
+    drawSystemInfoScreen();
+}
+
+// Line-based serial commands: "lat" latency report, "energy" energy report,
+// "resets" reset counters, "boot" boot timeline, "ui" screen cache,
+// "power <0-3>" pins a power tier, "power auto" releases it
+void checkSerialCommands() {
+  while (Serial.available()) {
+    char c = Serial.read();
+    if (c != '\n' && c != '\r') {
+      if (serialCmdLen < sizeof(serialCmd) - 1)
+        serialCmd[serialCmdLen++] = c;
+      continue;
+    }
+    serialCmd[serialCmdLen] = '\0';
+    if (strcmp(serialCmd, "lat") == 0)
+      txLatency.printReport(Serial);
+    else if (strcmp(serialCmd, "energy") == 0)
+      energy.printReport(Serial, remainingBatteryMah());
+    else if (strcmp(serialCmd, "resets") == 0)
+      alertJournal.printReport(Serial);
+    else if (strcmp(serialCmd, "boot") == 0)
+      bootSeq.printReport(Serial);
+    else if (strcmp(serialCmd, "ui") == 0)
+      screens.printReport(Serial);
+    else if (strncmp(serialCmd, "power ", 6) == 0)
+      battery.forceTier(strcmp(serialCmd + 6, "auto") == 0
+                            ? -1
+                            : (int8_t)atoi(serialCmd + 6));
+    serialCmdLen = 0;
+  }
+}
+
 void handleMenuInput(char key) {
   // Digit shortcut handling (Specific user mapping)
   if (key == '1')
@@ -1873,12 +2227,12 @@ void handleMenuInput(char key) {
     selectedAlertIndex =
         (selectedAlertIndex > 0) ? selectedAlertIndex - 1 : ALERT_COUNT - 1;
     updateMenuScroll();
-    drawMenuScreen();
+    drawMenuSelection();
   } else if (key == 'B' || key == '9') { // DOWN
     selectedAlertIndex =
         (selectedAlertIndex < ALERT_COUNT - 1) ? selectedAlertIndex + 1 : 0;
     updateMenuScroll();
-    drawMenuScreen();
+    drawMenuSelection();
   } else if (key == '*' || key == '4') { // Confirm/Selection
     currentScreen = SCREEN_CONFIRM;
     drawConfirmScreen();
@@ -1894,6 +2248,8 @@ void handleMenuInput(char key) {
 
 void handleConfirmInput(char key) {
   if (key == '*') {
+    // Journal first: a reset from here on resumes this alert at boot
+    alertJournal.arm(selectedAlertIndex);
     currentScreen = SCREEN_SENDING;
     drawSendingScreen();
     delay(300);
@@ -1921,6 +2277,7 @@ void handleResultInput(char key) {
       currentScreen = SCREEN_RESULT;
       drawResultScreen();
     } else if (key == '#') {
+      alertJournal.cancel();
       retryCount = 0;
       currentScreen = SCREEN_MENU;
       drawMenuScreen();
@@ -2002,13 +2359,90 @@ void handleKeyPress(char key) {
 //                     SETUP & LOOP
 // ═══════════════════════════════════════════════════════════════════════════════════
 
+// LoRa bring-up: reset pulse, then begin() with retries. The reset is timed
+// here so LoRa.begin() does not repeat it with delay().
+int32_t radioBootStep(uint8_t phase) {
+  switch (phase) {
+  case 0:
+    digitalWrite(LORA_RST, LOW);
+    return 10;
+  case 1:
+    digitalWrite(LORA_RST, HIGH);
+    return 10;
+  default:
+    LoRa.setPins(LORA_CS, -1, LORA_DIO0);
+    if (!LoRa.begin(LORA_FREQUENCY)) {
+      if (phase < 2 + LORA_INIT_RETRIES) {
+        Serial.printf("[INIT] LoRa retry %d/%d\n", phase - 1,
+                      LORA_INIT_RETRIES);
+        return 100;
+      }
+      loraInitialized = false;
+      Serial.println(F("[INIT] LoRa FAILED"));
+      return lifeline::BOOT_DONE;
+    }
+    LoRa.setSpreadingFactor(LORA_SF);
+    LoRa.setSignalBandwidth(LORA_BW);
+    LoRa.enableCrc();
+    LoRa.setTxPower(LORA_TX_POWER);
+    loraInitialized = true;
+    energy.set(lifeline::EN_RADIO, lifeline::RADIO_STANDBY);
+    bootSeq.mark("radio");
+    Serial.printf("[INIT] LoRa OK (%lu ms)\n", millis());
+
+    // Interrupted SOS goes out before the UI and sensors
+    resumePendingAlert();
+    return lifeline::BOOT_DONE;
+  }
+}
+
+// MPU6050 bring-up. begin() blocks ~200 ms in its own resets, so it waits for
+// the radio and starts inside the panel's 150 ms reset-low window
+int32_t mpuBootStep(uint8_t phase) {
+  if (!bootSeq.done(radioBootTask) || bootSeq.phase(panelBootTask) < 2)
+    return 5;
+  Wire.begin(I2C_SDA, I2C_SCL);
+  if (mpu.begin()) {
+    mpuInitialized = true;
+    mpu.setAccelerometerRange(MPU6050_RANGE_8_G);
+    mpu.setGyroRange(MPU6050_RANGE_500_DEG);
+    mpu.setFilterBandwidth(MPU6050_BAND_21_HZ);
+    Serial.printf("[INIT] MPU6050 OK (%lu ms)\n", millis());
+  } else {
+    Serial.println(F("[INIT] MPU6050 FAILED"));
+  }
+  return lifeline::BOOT_DONE;
+}
+
+// Leave boot as soon as the radio is up; a resumed SOS shows its result
+// (failure waits for retry/cancel)
+void finishBoot() {
+  bootSeq.mark("ready");
+  if (resumedOnBoot) {
+    resumedOnBoot = false;
+    currentScreen = SCREEN_RESULT;
+    drawResultScreen();
+  } else {
+    currentScreen = SCREEN_MENU;
+    drawMenuScreen();
+  }
+  Serial.printf("[BOOT] SOS-ready %lu ms after boot (radio at %lu ms)\n",
+                millis(), bootSeq.markMs("radio"));
+}
+
 void setup() {
+  alertJournal.begin();
   Serial.begin(115200);
-  delay(100);
+  energy.begin();
+  energy.set(lifeline::EN_CPU, lifeline::CPU_ACTIVE);
 
   Serial.println(F("═══════════════════════════════════════════════════"));
   Serial.println(F("    LIFELINE TX - ESP32-S3 + ILI9488 Edition"));
   Serial.println(F("═══════════════════════════════════════════════════"));
+  Serial.printf("[INIT] Reset: %s (boot #%lu)\n", alertJournal.resetReasonName(),
+                (unsigned long)alertJournal.boots());
+  if (alertJournal.resetReason() != lifeline::RESET_POWERON)
+    alertJournal.printReport(Serial);
 
   // LEDs (if connected)
   if (LED_GREEN >= 0) {
@@ -2022,25 +2456,24 @@ void setup() {
   if (BUZZER_PIN >= 0)
     pinMode(BUZZER_PIN, OUTPUT);
 
-  // Initialize TFT
-  Serial.println(F("[INIT] TFT..."));
-  tftInit();
-  fillScreen(COLOR_BG_PRIMARY);
+  if (battery.begin())
+    Serial.printf("[INIT] Battery: %u mV, %d%% (ADC cal: %s)\n",
+                  battery.millivolts(), battery.percent(),
+                  battery.vrefSource());
 
-  // Initialize LoRa
-  Serial.println(F("[INIT] LoRa..."));
+  // Panel (parallel GPIO), radio (SPI) and MPU (I2C) are independent: run
+  // their waits side by side. The radio goes first in every gap and resumes
+  // an interrupted SOS as soon as it is up.
+  pinMode(LORA_RST, OUTPUT);
   SPI.begin(LORA_SCK, LORA_MISO, LORA_MOSI, LORA_CS);
-  LoRa.setPins(LORA_CS, LORA_RST, LORA_DIO0);
-  if (LoRa.begin(LORA_FREQUENCY)) {
-    LoRa.setSpreadingFactor(LORA_SF);
-    LoRa.setSignalBandwidth(LORA_BW);
-    LoRa.enableCrc();
-    loraInitialized = true;
-    Serial.println(F("[INIT] LoRa OK"));
-  } else {
-    loraInitialized = false;
-    Serial.println(F("[INIT] LoRa FAILED"));
-  }
+  radioBootTask = bootSeq.add("radio", radioBootStep);
+  panelBootTask = bootSeq.add("panel", panelBootStep);
+  bootSeq.add("mpu", mpuBootStep);
+  bootSeq.runUntil(panelBootTask);
+  fillScreen(COLOR_BG_PRIMARY);
+  if (!screens.begin(SCREEN_WIDTH, SCREEN_HEIGHT))
+    Serial.println("[INIT] No PSRAM: screens drawn on every visit");
+  energy.set(lifeline::EN_DISPLAY, lifeline::DISPLAY_ON);
 
   // Initialize Animations
   initLoveAnimations();
@@ -2050,19 +2483,7 @@ void setup() {
   neopixel.setBrightness(100);
   neopixel.setPixelColor(0, neopixel.Color(0, 50, 0));
   neopixel.show();
-
-  // Initialize MPU6050
-  Serial.println(F("[INIT] MPU6050..."));
-  Wire.begin(I2C_SDA, I2C_SCL);
-  if (mpu.begin()) {
-    mpuInitialized = true;
-    mpu.setAccelerometerRange(MPU6050_RANGE_8_G);
-    mpu.setGyroRange(MPU6050_RANGE_500_DEG);
-    mpu.setFilterBandwidth(MPU6050_BAND_21_HZ);
-    Serial.println(F("[INIT] MPU6050 OK"));
-  } else {
-    Serial.println(F("[INIT] MPU6050 FAILED"));
-  }
+  energy.set(lifeline::EN_NEOPIXEL, lifeline::LOAD_ON);
 
   // Check for secret key 'D' to enter Love Mode directly
   char key = keypad.getKey();
@@ -2073,15 +2494,28 @@ void setup() {
     // Let's rely on menu access for now to avoid complexity in setup blocking.
   }
 
-  // Show boot screen
-  currentScreen = SCREEN_BOOT;
-  drawBootScreen();
+  // Boot screen only if the radio is still not up
+  if (bootSeq.done(radioBootTask)) {
+    finishBoot();
+  } else {
+    currentScreen = SCREEN_BOOT;
+    drawBootScreen();
+  }
   Serial.println(F("[INIT] Ready"));
 }
 
 void loop() {
   unsigned long now = millis();
 
+  // Remaining boot tasks (radio retries, MPU)
+  if (!bootSeq.allDone())
+    bootSeq.poll(now);
+
+  // Battery & power tier
+  battery.update(now);
+  if (battery.tierChanged())
+    applyPowerTier();
+
   // Aeroplane Strobe
   flashingStrobe();
 
@@ -2090,12 +2524,9 @@ void loop() {
 
   switch (currentScreen) {
   case SCREEN_BOOT:
-    // Run animation on boot (Black background needed for clean redraw)
-    // For now, we just wait.
-    if (now - bootStartTime >= BOOT_DISPLAY_TIME) {
-      currentScreen = SCREEN_MENU;
-      drawMenuScreen();
-    }
+    // Radio retries still running: keep the boot screen until it is up
+    if (bootSeq.done(radioBootTask))
+      finishBoot();
     break;
 
   case SCREEN_RESULT:
@@ -2115,6 +2546,7 @@ void loop() {
     if (keypad.getKeys()) {
       for (int i = 0; i < 10; i++) { // 10 is typical LIST_MAX
         if (keypad.key[i].stateChanged && keypad.key[i].kstate == PRESSED) {
+          keyPressMicros = micros();
           char key = keypad.key[i].kchar;
           int code = keypad.key[i].kcode;
           int r = code / KEYPAD_COLS;
@@ -2133,6 +2565,10 @@ void loop() {
         }
       }
     }
+
+    if (currentScreen == SCREEN_MENU && heartbeatInterval() > 0 &&
+        millis() - lastHeartbeatTime >= heartbeatInterval())
+      sendHeartbeat();
   } break;
 
     // We need to add SCREEN_LOVE_MODE case if we added it to enum.
@@ -2142,5 +2578,10 @@ void loop() {
     break;
   }
 
+  checkSerialCommands();
+
+  // Loop pacing is idle time in the energy model
+  energy.set(lifeline::EN_CPU, lifeline::CPU_IDLE);
   delay(10);
+  energy.set(lifeline::EN_CPU, lifeline::CPU_ACTIVE);
 }
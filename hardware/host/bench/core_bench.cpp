@@ -0,0 +1,158 @@
+/*
+ * LifelineCore hot paths, measured on the host. Absolute numbers are the
+ * workstation's; compare runs against each other, not against the ESP32.
+ */
+
+#include <Arduino.h>
+#include <LifelineCore.h>
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+using namespace lifeline;
+
+static void BM_FrameTrailerField(benchmark::State &state) {
+  const char *trailer = ";k=412;s=7;b=88";
+  long v = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frameTrailerField(trailer, 's', v));
+    benchmark::DoNotOptimize(v);
+  }
+}
+BENCHMARK(BM_FrameTrailerField);
+
+static void BM_TimeOnAir(benchmark::State &state) {
+  uint16_t len = 20;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(len);
+    benchmark::DoNotOptimize(loraTimeOnAirUs(len, 12, 125000));
+  }
+}
+BENCHMARK(BM_TimeOnAir);
+
+static void BM_Crc32(benchmark::State &state) {
+  RtcJournal rtc = {};
+  for (auto _ : state)
+    benchmark::DoNotOptimize(crc32(&rtc, sizeof(rtc)));
+  state.SetBytesProcessed(state.iterations() * (int64_t)sizeof(rtc));
+}
+BENCHMARK(BM_Crc32);
+
+static void BM_JournalArm(benchmark::State &state) {
+  RtcJournal rtc = {};
+  AlertJournal journal(rtc);
+  journal.begin(RESET_POWERON);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(journal.arm(3));
+    journal.sent();
+  }
+}
+BENCHMARK(BM_JournalArm);
+
+static void BM_DuplicateFilterMiss(benchmark::State &state) {
+  DuplicateFilter filter;
+  uint16_t seq = 0;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(filter.seen(3, seq++, 0));
+}
+BENCHMARK(BM_DuplicateFilterMiss);
+
+static void BM_LatencyPercentile(benchmark::State &state) {
+  LatencyRecorder<> rec;
+  for (uint32_t i = 0; i < LATENCY_SAMPLES; i++)
+    rec.record(LAT_KEY_TO_ACK, (i * 7919u) % 100000u);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(rec.percentile(LAT_KEY_TO_ACK, 99));
+}
+BENCHMARK(BM_LatencyPercentile);
+
+// Mixed traffic: alerts with and without trailers, heartbeats, junk
+static const char *const frameMix[] = {
+    "TX003,A;k=412;s=7",
+    "TX012,O;k=95;s=31000",
+    "TX7,c",
+    "HB003;i=123;l=40;u=9;v=3900;b=76",
+    "TX5,ZZ;s=2",
+    "\x13\x88garbage,;;==",
+    "3,5",
+    "TX65536,A",
+};
+static const size_t frameMixCount = sizeof(frameMix) / sizeof(frameMix[0]);
+
+static void BM_ParseFrame(benchmark::State &state) {
+  const uint8_t flags = (uint8_t)state.range(0);
+  size_t lens[frameMixCount];
+  for (size_t i = 0; i < frameMixCount; i++)
+    lens[i] = strlen(frameMix[i]);
+  AlertFrame f;
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(parseFrame(frameMix[i], lens[i], f, flags));
+    benchmark::DoNotOptimize(f);
+    i = (i + 1 == frameMixCount) ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ParseFrame)
+    ->Arg(0)
+    ->Arg(FRAME_REQUIRE_TX | FRAME_STRICT_CODE)
+    ->ArgNames({"flags"});
+
+// One packet in flight: pool block against the heap it replaces
+struct BenchPacket {
+  char data[FRAME_MAX_LEN + 1];
+  int16_t rssi;
+};
+
+static void BM_PoolCreateDestroy(benchmark::State &state) {
+  static ObjectPool<BenchPacket, 16> pool;
+  for (auto _ : state) {
+    BenchPacket *p = pool.create();
+    benchmark::DoNotOptimize(p);
+    pool.destroy(p);
+  }
+}
+BENCHMARK(BM_PoolCreateDestroy)->ThreadRange(1, 4);
+
+static void BM_HeapNewDelete(benchmark::State &state) {
+  for (auto _ : state) {
+    BenchPacket *p = new BenchPacket();
+    benchmark::DoNotOptimize(p);
+    delete p;
+  }
+}
+BENCHMARK(BM_HeapNewDelete)->ThreadRange(1, 4);
+
+// Thread 0 consumes, the others produce; items/s is what gets through
+template <typename Q> static void queueThroughput(benchmark::State &state) {
+  static Q q;
+  const int producers = state.threads() - 1;
+  uint32_t v = 0;
+  for (auto _ : state) {
+    if (state.thread_index() == 0) {
+      for (int i = 0; i < producers; i++) {
+        while (!q.pop(v))
+          std::this_thread::yield();
+      }
+    } else {
+      while (!q.push(v))
+        std::this_thread::yield();
+    }
+  }
+  if (state.thread_index() == 0) {
+    // Producers may finish a few items ahead; drain for the next run
+    while (q.pop(v))
+      ;
+    state.SetItemsProcessed(state.iterations() * producers);
+  }
+}
+
+static void BM_SpscHandoff(benchmark::State &state) {
+  queueThroughput<SpscQueue<uint32_t, 64>>(state);
+}
+BENCHMARK(BM_SpscHandoff)->Threads(2)->UseRealTime();
+
+static void BM_MpscHandoff(benchmark::State &state) {
+  queueThroughput<MpscQueue<uint32_t, 64>>(state);
+}
+BENCHMARK(BM_MpscHandoff)->Threads(2)->Threads(3)->Threads(5)->UseRealTime();
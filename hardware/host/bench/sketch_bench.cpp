@@ -0,0 +1,44 @@
+/*
+ * Whole-sketch cost on the host: real CPU time for one alert through the
+ * receiver (radio poll, parse, screen, uplink), with the virtual clock
+ * standing in for the radio and the network.
+ */
+
+#include <HostSketch.h>
+#include <benchmark/benchmark.h>
+
+#include <stdio.h>
+
+namespace rx_pro {
+void setup();
+void loop();
+} // namespace rx_pro
+
+static void BM_RxProAlertCycle(benchmark::State &state) {
+  static host::Sketch rx("rx_pro", rx_pro::setup, rx_pro::loop);
+  static bool booted = false;
+  if (!booted) {
+    rx.node.nvs["lifeline"]["ssid"] = "base";
+    rx.node.httpHandler = [](const host::HttpRequest &) {
+      return host::HttpResponse();
+    };
+    rx.begin();
+    rx.runUntil([] { return rx.node.wifi.connected; }, 5000);
+    booted = true;
+  }
+
+  uint16_t seq = 0;
+  char frame[32];
+  for (auto _ : state) {
+    // A fresh sequence number each time keeps the duplicate filter out
+    snprintf(frame, sizeof(frame), "TX003,A;k=120;s=%u", seq++);
+    const size_t uplinks = rx.node.httpLog.size();
+    rx.node.injectFrame(frame);
+    rx.runUntil([&] { return rx.node.httpLog.size() > uplinks; }, 1000);
+    state.PauseTiming();
+    rx.node.takeSerial();
+    rx.node.httpLog.clear();
+    state.ResumeTiming();
+  }
+}
+BENCHMARK(BM_RxProAlertCycle);
@@ -0,0 +1,70 @@
+/*
+ * libFuzzer target for lifeline::parseFrame().
+ *
+ * Every input is parsed under all four policies. Besides the sanitizers
+ * catching overreads and UB, the results must be self-consistent:
+ *   - an accepted alert has a code inside the table and error == FRAME_OK,
+ *   - a rejected frame says why,
+ *   - the trailer lies inside the input,
+ *   - a stricter policy never accepts what a looser one rejects, and never
+ *     disagrees with it about device and code.
+ */
+
+#include <Arduino.h>
+#include <AlertFrame.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+using namespace lifeline;
+
+#define FUZZ_CHECK(cond)                                                       \
+  do {                                                                         \
+    if (!(cond))                                                               \
+      abort();                                                                 \
+  } while (0)
+
+static void checkOne(const char *data, size_t size, const AlertFrame &f,
+                     FrameType type) {
+  FUZZ_CHECK(type == f.type);
+  if (type == FRAME_INVALID) {
+    FUZZ_CHECK(f.error != FRAME_OK);
+    return;
+  }
+  FUZZ_CHECK(f.error == FRAME_OK);
+  if (type == FRAME_ALERT)
+    FUZZ_CHECK(f.alertIndex >= 0 && f.alertIndex < FRAME_ALERT_CODES);
+  if (f.trailer) {
+    FUZZ_CHECK(f.trailer >= data && f.trailer < data + size);
+    FUZZ_CHECK(f.trailer + f.trailerLen == data + size);
+    FUZZ_CHECK(*f.trailer == ';');
+  }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *bytes, size_t size) {
+  const char *data = (const char *)bytes;
+  static const uint8_t policies[] = {
+      0, FRAME_REQUIRE_TX, FRAME_STRICT_CODE,
+      FRAME_REQUIRE_TX | FRAME_STRICT_CODE};
+
+  AlertFrame f[4];
+  FrameType t[4];
+  for (uint8_t i = 0; i < 4; i++) {
+    t[i] = parseFrame(data, size, f[i], policies[i]);
+    checkOne(data, size, f[i], t[i]);
+  }
+
+  // Policy i is at least as strict as every policy whose bits it contains
+  for (uint8_t strict = 1; strict < 4; strict++) {
+    for (uint8_t loose = 0; loose < 4; loose++) {
+      if ((policies[strict] & policies[loose]) != policies[loose] ||
+          t[strict] == FRAME_INVALID)
+        continue;
+      FUZZ_CHECK(t[loose] == t[strict]);
+      FUZZ_CHECK(f[loose].deviceId == f[strict].deviceId);
+      FUZZ_CHECK(f[loose].alertIndex == f[strict].alertIndex);
+      FUZZ_CHECK(f[loose].seq == f[strict].seq);
+    }
+  }
+  return 0;
+}
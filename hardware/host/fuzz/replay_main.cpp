@@ -0,0 +1,110 @@
+/*
+ * Stand-in for the libFuzzer driver when the compiler has none (GCC).
+ *
+ *   frame_fuzz [-runs=N] <corpus dir or file>...
+ *
+ * Runs every corpus file, then N deterministic mutations of them (bit flips,
+ * byte insertions and deletions, splices, truncations). No coverage
+ * feedback, so it is a smoke test, not a substitute for a Clang run.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+namespace {
+
+const size_t MAX_LEN = 300; // A little past FRAME_MAX_LEN
+
+uint32_t rng = 0x9E3779B9u;
+uint32_t next() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+void run(const std::string &input) {
+  // Exact-size heap copy so sanitizers see reads past the end
+  std::vector<uint8_t> buf(input.begin(), input.end());
+  LLVMFuzzerTestOneInput(buf.data(), buf.size());
+}
+
+void load(const std::filesystem::path &p, std::vector<std::string> &corpus) {
+  if (std::filesystem::is_directory(p)) {
+    for (const auto &e : std::filesystem::directory_iterator(p))
+      load(e.path(), corpus);
+    return;
+  }
+  std::ifstream in(p, std::ios::binary);
+  corpus.emplace_back(std::istreambuf_iterator<char>(in),
+                      std::istreambuf_iterator<char>());
+}
+
+std::string mutate(const std::vector<std::string> &corpus) {
+  static const char dict[] = "TXHB,;=ksilu0123456789AaOoP -+\t";
+  std::string s = corpus[next() % corpus.size()];
+  const int edits = 1 + next() % 4;
+  for (int e = 0; e < edits; e++) {
+    const size_t pos = s.empty() ? 0 : next() % (s.size() + 1);
+    switch (next() % 6) {
+    case 0:
+      if (!s.empty())
+        s[pos % s.size()] ^= (char)(1u << (next() % 8));
+      break;
+    case 1:
+      s.insert(pos, 1, dict[next() % (sizeof(dict) - 1)]);
+      break;
+    case 2:
+      s.insert(pos, 1, (char)next());
+      break;
+    case 3:
+      if (!s.empty())
+        s.erase(pos % s.size(), 1 + next() % 3);
+      break;
+    case 4:
+      s.resize(pos);
+      break;
+    default: {
+      const std::string &o = corpus[next() % corpus.size()];
+      s.insert(pos, o, o.empty() ? 0 : next() % o.size(), std::string::npos);
+      break;
+    }
+    }
+  }
+  if (s.size() > MAX_LEN)
+    s.resize(MAX_LEN);
+  return s;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  long runs = 200000;
+  std::vector<std::string> corpus;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "-runs=", 6) == 0)
+      runs = atol(argv[i] + 6);
+    else if (argv[i][0] != '-')
+      load(argv[i], corpus);
+  }
+  if (corpus.empty())
+    corpus.emplace_back();
+
+  for (const std::string &c : corpus)
+    run(c);
+  for (long i = 0; i < runs; i++)
+    run(mutate(corpus));
+  printf("frame_fuzz: %zu corpus inputs, %ld mutations, no failures\n",
+         corpus.size(), runs);
+  return 0;
+}
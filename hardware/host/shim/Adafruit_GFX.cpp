@@ -0,0 +1,410 @@
+/*
+ * Primitives follow Adafruit_GFX so shapes land on the same pixels as on
+ * the panel (midpoint circles, quarter-circle round rects, scanline
+ * triangles).
+ */
+
+#include "Adafruit_GFX.h"
+
+#include <algorithm>
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h)
+    : width_(w), height_(h), fb_((size_t)w * h, 0), nativeW_(w),
+      nativeH_(h) {}
+
+void Adafruit_GFX::resize(int16_t w, int16_t h) {
+  nativeW_ = w;
+  nativeH_ = h;
+  fb_.assign((size_t)w * h, 0);
+  setRotation(rotation_);
+}
+
+void Adafruit_GFX::setRotation(uint8_t r) {
+  rotation_ = r & 3;
+  const bool swap = rotation_ & 1;
+  width_ = swap ? nativeH_ : nativeW_;
+  height_ = swap ? nativeW_ : nativeH_;
+}
+
+void Adafruit_GFX::plot(int16_t x, int16_t y, uint16_t color) {
+  int16_t t;
+  switch (rotation_) {
+  case 1:
+    t = x;
+    x = nativeW_ - 1 - y;
+    y = t;
+    break;
+  case 2:
+    x = nativeW_ - 1 - x;
+    y = nativeH_ - 1 - y;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = nativeH_ - 1 - t;
+    break;
+  }
+  fb_[(size_t)y * nativeW_ + x] = color;
+}
+
+uint16_t Adafruit_GFX::pixel(int16_t x, int16_t y) const {
+  if (x < 0 || y < 0 || x >= width_ || y >= height_)
+    return 0;
+  int16_t t;
+  switch (rotation_) {
+  case 1:
+    t = x;
+    x = nativeW_ - 1 - y;
+    y = t;
+    break;
+  case 2:
+    x = nativeW_ - 1 - x;
+    y = nativeH_ - 1 - y;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = nativeH_ - 1 - t;
+    break;
+  }
+  return fb_[(size_t)y * nativeW_ + x];
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                PIXEL SINK
+// ═══════════════════════════════════════════════════════════════════════════
+
+void Adafruit_GFX::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  drawCalls++;
+  if (x < 0 || y < 0 || x >= width_ || y >= height_)
+    return;
+  plot(x, y, color);
+  pixelsWritten++;
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+  drawCalls++;
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  int16_t x2 = x + w, y2 = y + h;
+  x = std::max<int16_t>(x, 0);
+  y = std::max<int16_t>(y, 0);
+  x2 = std::min<int16_t>(x2, width_);
+  y2 = std::min<int16_t>(y2, height_);
+  if (x >= x2 || y >= y2)
+    return;
+  for (int16_t j = y; j < y2; j++) {
+    for (int16_t i = x; i < x2; i++)
+      plot(i, j, color);
+  }
+  pixelsWritten += (uint64_t)(x2 - x) * (y2 - y);
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                 uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                 uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+  fillRect(0, 0, width_, height_, color);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                  SHAPES
+// ═══════════════════════════════════════════════════════════════════════════
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                            uint16_t color) {
+  if (x0 == x1) {
+    if (y0 > y1)
+      std::swap(y0, y1);
+    drawFastVLine(x0, y0, y1 - y0 + 1, color);
+    return;
+  }
+  if (y0 == y1) {
+    if (x0 > x1)
+      std::swap(x0, x1);
+    drawFastHLine(x0, y0, x1 - x0 + 1, color);
+    return;
+  }
+  const bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    std::swap(x0, y0);
+    std::swap(x1, y1);
+  }
+  if (x0 > x1) {
+    std::swap(x0, x1);
+    std::swap(y0, y1);
+  }
+  const int16_t dx = x1 - x0, dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  const int16_t ystep = y0 < y1 ? 1 : -1;
+  for (; x0 <= x1; x0++) {
+    if (steep)
+      drawPixel(y0, x0, color);
+    else
+      drawPixel(x0, y0, color);
+    err -= dy;
+    if (err < 0) {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y, h, color);
+  drawFastVLine(x + w - 1, y, h, color);
+}
+
+void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r,
+                              uint16_t color) {
+  int16_t f = 1 - r, ddFx = 1, ddFy = -2 * r, x = 0, y = r;
+  drawPixel(x0, y0 + r, color);
+  drawPixel(x0, y0 - r, color);
+  drawPixel(x0 + r, y0, color);
+  drawPixel(x0 - r, y0, color);
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddFy += 2;
+      f += ddFy;
+    }
+    x++;
+    ddFx += 2;
+    f += ddFx;
+    drawPixel(x0 + x, y0 + y, color);
+    drawPixel(x0 - x, y0 + y, color);
+    drawPixel(x0 + x, y0 - y, color);
+    drawPixel(x0 - x, y0 - y, color);
+    drawPixel(x0 + y, y0 + x, color);
+    drawPixel(x0 - y, y0 + x, color);
+    drawPixel(x0 + y, y0 - x, color);
+    drawPixel(x0 - y, y0 - x, color);
+  }
+}
+
+void Adafruit_GFX::drawCircleHelper(int16_t x0, int16_t y0, int16_t r,
+                                    uint8_t corners, uint16_t color) {
+  int16_t f = 1 - r, ddFx = 1, ddFy = -2 * r, x = 0, y = r;
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddFy += 2;
+      f += ddFy;
+    }
+    x++;
+    ddFx += 2;
+    f += ddFx;
+    if (corners & 0x4) {
+      drawPixel(x0 + x, y0 + y, color);
+      drawPixel(x0 + y, y0 + x, color);
+    }
+    if (corners & 0x2) {
+      drawPixel(x0 + x, y0 - y, color);
+      drawPixel(x0 + y, y0 - x, color);
+    }
+    if (corners & 0x8) {
+      drawPixel(x0 - y, y0 + x, color);
+      drawPixel(x0 - x, y0 + y, color);
+    }
+    if (corners & 0x1) {
+      drawPixel(x0 - y, y0 - x, color);
+      drawPixel(x0 - x, y0 - y, color);
+    }
+  }
+}
+
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r,
+                              uint16_t color) {
+  drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+  fillCircleHelper(x0, y0, r, 3, 0, color);
+}
+
+void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
+                                    uint8_t corners, int16_t delta,
+                                    uint16_t color) {
+  int16_t f = 1 - r, ddFx = 1, ddFy = -2 * r, x = 0, y = r, px = x, py = y;
+  delta++;
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddFy += 2;
+      f += ddFy;
+    }
+    x++;
+    ddFx += 2;
+    f += ddFx;
+    if (x < (y + 1)) {
+      if (corners & 1)
+        drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+      if (corners & 2)
+        drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+    }
+    if (y != py) {
+      if (corners & 1)
+        drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+      if (corners & 2)
+        drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 int16_t r, uint16_t color) {
+  const int16_t maxR = ((w < h) ? w : h) / 2;
+  if (r > maxR)
+    r = maxR;
+  drawFastHLine(x + r, y, w - 2 * r, color);
+  drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+  drawFastVLine(x, y + r, h - 2 * r, color);
+  drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+  drawCircleHelper(x + r, y + r, r, 1, color);
+  drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+  drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+  drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 int16_t r, uint16_t color) {
+  const int16_t maxR = ((w < h) ? w : h) / 2;
+  if (r > maxR)
+    r = maxR;
+  fillRect(x + r, y, w - 2 * r, h, color);
+  fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+  fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+}
+
+void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                int16_t y1, int16_t x2, int16_t y2,
+                                uint16_t color) {
+  drawLine(x0, y0, x1, y1, color);
+  drawLine(x1, y1, x2, y2, color);
+  drawLine(x2, y2, x0, y0, color);
+}
+
+void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                int16_t y1, int16_t x2, int16_t y2,
+                                uint16_t color) {
+  if (y0 > y1) {
+    std::swap(y0, y1);
+    std::swap(x0, x1);
+  }
+  if (y1 > y2) {
+    std::swap(y2, y1);
+    std::swap(x2, x1);
+  }
+  if (y0 > y1) {
+    std::swap(y0, y1);
+    std::swap(x0, x1);
+  }
+
+  if (y0 == y2) { // Degenerate: one scanline
+    int16_t a = x0, b = x0;
+    a = std::min({a, x1, x2});
+    b = std::max({b, x1, x2});
+    drawFastHLine(a, y0, b - a + 1, color);
+    return;
+  }
+
+  const int32_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0,
+                dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t sa = 0, sb = 0;
+  const int16_t last = (y1 == y2) ? y1 : y1 - 1;
+  int16_t y;
+  for (y = y0; y <= last; y++) {
+    int16_t a = x0 + sa / dy01;
+    int16_t b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b)
+      std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+  sa = (int32_t)dx12 * (y - y1);
+  sb = (int32_t)dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    int16_t a = x1 + sa / dy12;
+    int16_t b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b)
+      std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                   TEXT
+// ═══════════════════════════════════════════════════════════════════════════
+
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (c == '\n') {
+    cursorX_ = 0;
+    cursorY_ += textSizeY_ * 8;
+  } else if (c != '\r') {
+    if (wrap_ && (cursorX_ + textSizeX_ * 6) > width_) {
+      cursorX_ = 0;
+      cursorY_ += textSizeY_ * 8;
+    }
+    textChars++;
+    if (textBg_ != textColor_)
+      fillRect(cursorX_, cursorY_, textSizeX_ * 6, textSizeY_ * 8, textBg_);
+    else
+      drawCalls++;
+    cursorX_ += textSizeX_ * 6;
+  }
+  return 1;
+}
+
+void Adafruit_GFX::getTextBounds(const char *s, int16_t x, int16_t y,
+                                 int16_t *x1, int16_t *y1, uint16_t *w,
+                                 uint16_t *h) {
+  *x1 = x;
+  *y1 = y;
+  *w = *h = 0;
+  int16_t minx = width_, miny = height_, maxx = -1, maxy = -1;
+  for (; s && *s; s++) {
+    const char c = *s;
+    if (c == '\n') {
+      x = 0;
+      y += textSizeY_ * 8;
+    } else if (c != '\r') {
+      if (wrap_ && (x + textSizeX_ * 6) > width_) {
+        x = 0;
+        y += textSizeY_ * 8;
+      }
+      const int16_t x2 = x + textSizeX_ * 6 - 1, y2 = y + textSizeY_ * 8 - 1;
+      minx = std::min(minx, x);
+      miny = std::min(miny, y);
+      maxx = std::max(maxx, x2);
+      maxy = std::max(maxy, y2);
+      x += textSizeX_ * 6;
+    }
+  }
+  if (maxx >= minx) {
+    *x1 = minx;
+    *w = (uint16_t)(maxx - minx + 1);
+  }
+  if (maxy >= miny) {
+    *y1 = miny;
+    *h = (uint16_t)(maxy - miny + 1);
+  }
+}
@@ -0,0 +1,117 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                   LIFELINE HOST - ADAFRUIT GFX (FRAMEBUFFER)
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Adafruit_GFX drawing API over an in-memory RGB565 framebuffer, so screen
+ * code runs on the host and tests can read pixels back.
+ *
+ * Geometry follows the library (rotation, classic 6x8 text cells, text
+ * bounds, wrap), but text is rendered as cell advances only: glyph bitmaps
+ * are not reproduced. Every primitive is counted, so benchmarks can report
+ * pixels pushed per screen.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_HOST_ADAFRUIT_GFX_H
+#define LIFELINE_HOST_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+#include <vector>
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h);
+
+  // ── Pixel sink (panels override to model their bus) ───────────────────
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color);
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color);
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  virtual void fillScreen(uint16_t color);
+
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                uint16_t color);
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+  void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r,
+                     uint16_t color);
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r,
+                     uint16_t color);
+  void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                    int16_t x2, int16_t y2, uint16_t color);
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                    int16_t x2, int16_t y2, uint16_t color);
+
+  // ── Text ──────────────────────────────────────────────────────────────
+  using Print::write;
+  size_t write(uint8_t c) override;
+  void setCursor(int16_t x, int16_t y) {
+    cursorX_ = x;
+    cursorY_ = y;
+  }
+  int16_t getCursorX() const { return cursorX_; }
+  int16_t getCursorY() const { return cursorY_; }
+  void setTextSize(uint8_t s) { setTextSize(s, s); }
+  void setTextSize(uint8_t sx, uint8_t sy) {
+    textSizeX_ = sx ? sx : 1;
+    textSizeY_ = sy ? sy : 1;
+  }
+  void setTextColor(uint16_t c) { textColor_ = textBg_ = c; }
+  void setTextColor(uint16_t c, uint16_t bg) {
+    textColor_ = c;
+    textBg_ = bg;
+  }
+  void setTextWrap(bool w) { wrap_ = w; }
+  void getTextBounds(const char *s, int16_t x, int16_t y, int16_t *x1,
+                     int16_t *y1, uint16_t *w, uint16_t *h);
+  void getTextBounds(const String &s, int16_t x, int16_t y, int16_t *x1,
+                     int16_t *y1, uint16_t *w, uint16_t *h) {
+    getTextBounds(s.c_str(), x, y, x1, y1, w, h);
+  }
+
+  // ── Geometry ──────────────────────────────────────────────────────────
+  virtual void setRotation(uint8_t r);
+  uint8_t getRotation() const { return rotation_; }
+  int16_t width() const { return width_; }
+  int16_t height() const { return height_; }
+
+  // ── Host inspection ───────────────────────────────────────────────────
+  /** Colour at rotated coordinates (0 outside the panel). */
+  uint16_t pixel(int16_t x, int16_t y) const;
+  const std::vector<uint16_t> &framebuffer() const { return fb_; }
+  uint64_t pixelsWritten = 0; // Pixels pushed by every primitive
+  uint64_t drawCalls = 0;     // Primitive calls (one bus transaction each)
+  uint64_t textChars = 0;
+
+protected:
+  /** Store one pixel in native (rotation 0) coordinates. */
+  void plot(int16_t x, int16_t y, uint16_t color);
+  void resize(int16_t w, int16_t h);
+
+  int16_t width_;
+  int16_t height_;
+
+private:
+  void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners,
+                        int16_t delta, uint16_t color);
+  void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners,
+                        uint16_t color);
+
+  std::vector<uint16_t> fb_;
+  int16_t nativeW_;
+  int16_t nativeH_;
+  uint8_t rotation_ = 0;
+  int16_t cursorX_ = 0;
+  int16_t cursorY_ = 0;
+  uint8_t textSizeX_ = 1;
+  uint8_t textSizeY_ = 1;
+  uint16_t textColor_ = 0xFFFF;
+  uint16_t textBg_ = 0xFFFF;
+  bool wrap_ = true;
+};
+
+#endif // LIFELINE_HOST_ADAFRUIT_GFX_H
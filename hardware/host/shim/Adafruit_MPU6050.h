@@ -0,0 +1,65 @@
+/*
+ * Host stand-in for Adafruit_MPU6050. Readings come from the current
+ * node's Imu block.
+ */
+
+#ifndef LIFELINE_HOST_ADAFRUIT_MPU6050_H
+#define LIFELINE_HOST_ADAFRUIT_MPU6050_H
+
+#include <Adafruit_Sensor.h>
+#include <Arduino.h>
+#include <Wire.h>
+
+typedef enum {
+  MPU6050_RANGE_2_G,
+  MPU6050_RANGE_4_G,
+  MPU6050_RANGE_8_G,
+  MPU6050_RANGE_16_G
+} mpu6050_accel_range_t;
+
+typedef enum {
+  MPU6050_RANGE_250_DEG,
+  MPU6050_RANGE_500_DEG,
+  MPU6050_RANGE_1000_DEG,
+  MPU6050_RANGE_2000_DEG
+} mpu6050_gyro_range_t;
+
+typedef enum {
+  MPU6050_BAND_260_HZ,
+  MPU6050_BAND_184_HZ,
+  MPU6050_BAND_94_HZ,
+  MPU6050_BAND_44_HZ,
+  MPU6050_BAND_21_HZ,
+  MPU6050_BAND_10_HZ,
+  MPU6050_BAND_5_HZ
+} mpu6050_bandwidth_t;
+
+class Adafruit_MPU6050 {
+public:
+  bool begin(uint8_t address = 0x68, TwoWire *wire = &Wire,
+             int32_t sensorId = 0) {
+    (void)address;
+    (void)wire;
+    (void)sensorId;
+    return host::currentNode().imu.present;
+  }
+  void setAccelerometerRange(mpu6050_accel_range_t) {}
+  void setGyroRange(mpu6050_gyro_range_t) {}
+  void setFilterBandwidth(mpu6050_bandwidth_t) {}
+
+  bool getEvent(sensors_event_t *accel, sensors_event_t *gyro,
+                sensors_event_t *temp) {
+    const host::Node::Imu &imu = host::currentNode().imu;
+    if (!imu.present)
+      return false;
+    *accel = sensors_event_t();
+    accel->acceleration = {imu.ax, imu.ay, imu.az};
+    *gyro = sensors_event_t();
+    gyro->gyro = {imu.gx, imu.gy, imu.gz};
+    *temp = sensors_event_t();
+    temp->temperature = imu.tempC;
+    return true;
+  }
+};
+
+#endif // LIFELINE_HOST_ADAFRUIT_MPU6050_H
@@ -0,0 +1,106 @@
+/*
+ * Host stand-in for Adafruit_NeoPixel. Keeps the pixel buffer so tests can
+ * check what show() would have latched.
+ */
+
+#ifndef LIFELINE_HOST_ADAFRUIT_NEOPIXEL_H
+#define LIFELINE_HOST_ADAFRUIT_NEOPIXEL_H
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <vector>
+
+#define NEO_GRB ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_RGB ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_KHZ800 0x0000
+#define NEO_KHZ400 0x0100
+
+typedef uint16_t neoPixelType;
+
+class Adafruit_NeoPixel {
+public:
+  Adafruit_NeoPixel(uint16_t n, int16_t pin = 6,
+                    neoPixelType type = NEO_GRB + NEO_KHZ800)
+      : pin_(pin), pixels_(n, 0), latched_(n, 0) {
+    (void)type;
+  }
+
+  void begin() {}
+  void show() {
+    latched_ = pixels_;
+    shows++;
+  }
+  void clear() { std::fill(pixels_.begin(), pixels_.end(), 0); }
+  void setBrightness(uint8_t b) { brightness_ = b; }
+  uint8_t getBrightness() const { return brightness_; }
+  uint16_t numPixels() const { return (uint16_t)pixels_.size(); }
+
+  void setPixelColor(uint16_t n, uint32_t c) {
+    if (n < pixels_.size())
+      pixels_[n] = c;
+  }
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    setPixelColor(n, Color(r, g, b));
+  }
+  uint32_t getPixelColor(uint16_t n) const {
+    return n < pixels_.size() ? pixels_[n] : 0;
+  }
+  /** Colour on the LED after the last show(). */
+  uint32_t shownColor(uint16_t n) const {
+    return n < latched_.size() ? latched_[n] : 0;
+  }
+
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+    return ((uint32_t)w << 24) | Color(r, g, b);
+  }
+  static uint32_t ColorHSV(uint16_t hue, uint8_t sat = 255,
+                           uint8_t val = 255) {
+    // Same six-sector ramp as the library (without its exact rounding)
+    const uint32_t h = ((uint32_t)hue * 1530UL + 32768UL) / 65536UL;
+    uint8_t r, g, b;
+    if (h < 255) {
+      r = 255; g = (uint8_t)h; b = 0;
+    } else if (h < 510) {
+      r = (uint8_t)(510 - h); g = 255; b = 0;
+    } else if (h < 765) {
+      r = 0; g = 255; b = (uint8_t)(h - 510);
+    } else if (h < 1020) {
+      r = 0; g = (uint8_t)(1020 - h); b = 255;
+    } else if (h < 1275) {
+      r = (uint8_t)(h - 1020); g = 0; b = 255;
+    } else if (h < 1530) {
+      r = 255; g = 0; b = (uint8_t)(1530 - h);
+    } else {
+      r = 255; g = 0; b = 0;
+    }
+    const uint32_t v1 = 1 + val;
+    const uint16_t s1 = 1 + sat;
+    const uint8_t s2 = 255 - sat;
+    return ((((((r * s1) >> 8) + s2) * v1) & 0xff00) << 8) |
+           (((((g * s1) >> 8) + s2) * v1) & 0xff00) |
+           (((((b * s1) >> 8) + s2) * v1) >> 8);
+  }
+  static uint32_t gamma32(uint32_t c) {
+    uint8_t *p = (uint8_t *)&c;
+    for (uint8_t i = 0; i < 4; i++)
+      p[i] = gamma8(p[i]);
+    return c;
+  }
+  static uint8_t gamma8(uint8_t x) {
+    return (uint8_t)(pow(x / 255.0, 2.6) * 255.0 + 0.5);
+  }
+
+  uint32_t shows = 0;
+
+private:
+  int16_t pin_;
+  uint8_t brightness_ = 255;
+  std::vector<uint32_t> pixels_;
+  std::vector<uint32_t> latched_;
+};
+
+#endif // LIFELINE_HOST_ADAFRUIT_NEOPIXEL_H
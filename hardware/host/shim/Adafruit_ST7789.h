@@ -0,0 +1,50 @@
+/*
+ * Host stand-in for Adafruit_ST7789: an Adafruit_GFX framebuffer sized by
+ * init(), with the SPITFT helpers the sketches call.
+ */
+
+#ifndef LIFELINE_HOST_ADAFRUIT_ST7789_H
+#define LIFELINE_HOST_ADAFRUIT_ST7789_H
+
+#include <Adafruit_GFX.h>
+#include <SPI.h>
+
+#define ST77XX_BLACK 0x0000
+#define ST77XX_WHITE 0xFFFF
+#define ST77XX_RED 0xF800
+#define ST77XX_GREEN 0x07E0
+#define ST77XX_BLUE 0x001F
+#define ST77XX_CYAN 0x07FF
+#define ST77XX_MAGENTA 0xF81F
+#define ST77XX_YELLOW 0xFFE0
+#define ST77XX_ORANGE 0xFC00
+
+class Adafruit_ST7789 : public Adafruit_GFX {
+public:
+  Adafruit_ST7789(int8_t cs, int8_t dc, int8_t rst)
+      : Adafruit_GFX(240, 320), cs_(cs), dc_(dc), rst_(rst) {}
+
+  void init(uint16_t width, uint16_t height, uint8_t spiMode = SPI_MODE0) {
+    (void)spiMode;
+    resize((int16_t)width, (int16_t)height);
+    initialised = true;
+  }
+  void setSPISpeed(uint32_t) {}
+  void invertDisplay(bool i) { inverted = i; }
+  void enableDisplay(bool e) { enabled = e; }
+  void enableSleep(bool s) { sleeping = s; }
+
+  static uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+  }
+
+  bool initialised = false;
+  bool inverted = false;
+  bool enabled = true;
+  bool sleeping = false;
+
+private:
+  int8_t cs_, dc_, rst_;
+};
+
+#endif // LIFELINE_HOST_ADAFRUIT_ST7789_H
@@ -0,0 +1,27 @@
+/*
+ * Host stand-in for the Adafruit Unified Sensor types.
+ */
+
+#ifndef LIFELINE_HOST_ADAFRUIT_SENSOR_H
+#define LIFELINE_HOST_ADAFRUIT_SENSOR_H
+
+#include <Arduino.h>
+
+typedef struct {
+  float x;
+  float y;
+  float z;
+} sensors_vec_t;
+
+typedef struct {
+  int32_t version;
+  int32_t sensor_id;
+  int32_t type;
+  int32_t reserved0;
+  int32_t timestamp;
+  sensors_vec_t acceleration;
+  sensors_vec_t gyro;
+  float temperature;
+} sensors_event_t;
+
+#endif // LIFELINE_HOST_ADAFRUIT_SENSOR_H
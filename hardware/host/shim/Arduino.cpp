@@ -0,0 +1,179 @@
+#include "Arduino.h"
+
+#include <stdio.h>
+
+#include "SPI.h"
+#include "Wire.h"
+#include "soc/gpio_reg.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+SPIClass SPI;
+TwoWire Wire;
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                   GPIO
+// ═══════════════════════════════════════════════════════════════════════════
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  host::Node &n = host::currentNode();
+  if (pin >= HOST_PINS)
+    return;
+  n.pinMode[pin] = mode;
+  if ((mode & PULLUP) && !(mode & 0x02))
+    n.pinLevel[pin] = HIGH; // Undriven input reads the pull-up
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+  host::currentNode().writePin(pin, level);
+}
+
+int digitalRead(uint8_t pin) {
+  host::Node &n = host::currentNode();
+  if (pin == n.radio.dio0)
+    return n.radio.rxDone(host::nowUs()) ? HIGH : LOW;
+  return pin < HOST_PINS ? n.pinLevel[pin] : LOW;
+}
+
+uint16_t analogRead(uint8_t pin) {
+  return pin < HOST_PINS ? (uint16_t)host::currentNode().analogValue[pin] : 0;
+}
+
+void analogWrite(uint8_t pin, int value) {
+  if (pin < HOST_PINS)
+    host::currentNode().analogValue[pin] = value;
+}
+
+void analogReadResolution(uint8_t) {}
+
+void pinMatrixOutAttach(uint8_t pin, uint8_t function, bool, bool) {
+  if (pin < HOST_PINS)
+    host::currentNode().pinSignal[pin] = function;
+}
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long durationMs) {
+  host::ShimAlloc shim;
+  host::currentNode().tones.push_back(
+      {pin, frequency, (uint32_t)durationMs, host::nowUs()});
+}
+
+void noTone(uint8_t) {}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                  RANDOM
+// ═══════════════════════════════════════════════════════════════════════════
+
+static uint32_t randomState = 0x2545F491UL;
+
+void randomSeed(unsigned long seed) {
+  if (seed)
+    randomState = (uint32_t)seed;
+}
+
+static uint32_t nextRandom() {
+  // xorshift32: deterministic across runs so tests can rely on it
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+long random(long howBig) {
+  return howBig > 0 ? (long)(nextRandom() % (uint32_t)howBig) : 0;
+}
+
+long random(long howSmall, long howBig) {
+  return howSmall >= howBig ? howSmall : howSmall + random(howBig - howSmall);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                  SERIAL
+// ═══════════════════════════════════════════════════════════════════════════
+
+int HardwareSerial::available() {
+  return (int)host::currentNode().serialIn.size();
+}
+
+int HardwareSerial::read() {
+  std::deque<char> &in = host::currentNode().serialIn;
+  if (in.empty())
+    return -1;
+  const char c = in.front();
+  in.pop_front();
+  return (uint8_t)c;
+}
+
+int HardwareSerial::peek() {
+  std::deque<char> &in = host::currentNode().serialIn;
+  return in.empty() ? -1 : (uint8_t)in.front();
+}
+
+size_t HardwareSerial::write(uint8_t c) { return write(&c, 1); }
+
+size_t HardwareSerial::write(const uint8_t *buf, size_t len) {
+  host::Node &n = host::currentNode();
+  host::ShimAlloc shim; // The log is the test's, not the board's
+  n.serialOut.append((const char *)buf, len);
+  if (n.echoSerial)
+    fwrite(buf, 1, len, stdout);
+  return len;
+}
+
+void EspClass::restart() { host::currentNode().restartRequested = true; }
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                             GPIO REGISTERS
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace host {
+
+static uint32_t outMask(uint8_t firstPin) {
+  const Node &n = currentNode();
+  uint32_t m = 0;
+  for (uint8_t b = 0; b < 32 && firstPin + b < HOST_PINS; b++)
+    m |= (uint32_t)n.pinLevel[firstPin + b] << b;
+  return m;
+}
+
+void regWrite(uint32_t addr, uint32_t value) {
+  Node &n = currentNode();
+  switch (addr) {
+  case GPIO_OUT_W1TS_REG:
+    n.writePinMask(0, value, HIGH);
+    break;
+  case GPIO_OUT_W1TC_REG:
+    n.writePinMask(0, value, LOW);
+    break;
+  case GPIO_OUT1_W1TS_REG:
+    n.writePinMask(32, value, HIGH);
+    break;
+  case GPIO_OUT1_W1TC_REG:
+    n.writePinMask(32, value, LOW);
+    break;
+  case GPIO_OUT_REG:
+    n.writePinMask(0, ~outMask(0) & value, HIGH);
+    n.writePinMask(0, outMask(0) & ~value, LOW);
+    break;
+  case GPIO_OUT1_REG:
+    n.writePinMask(32, ~outMask(32) & value, HIGH);
+    n.writePinMask(32, outMask(32) & ~value, LOW);
+    break;
+  default:
+    break;
+  }
+}
+
+uint32_t regRead(uint32_t addr) {
+  switch (addr) {
+  case GPIO_OUT_REG:
+  case GPIO_IN_REG:
+    return outMask(0);
+  case GPIO_OUT1_REG:
+  case GPIO_IN1_REG:
+    return outMask(32);
+  default:
+    return 0;
+  }
+}
+
+} // namespace host
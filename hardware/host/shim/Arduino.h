@@ -0,0 +1,197 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                      LIFELINE HOST - ARDUINO CORE SHIM
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Just enough of the arduino-esp32 core for the LifeLine sketches and
+ * LifelineCore to build as Linux code. Time comes from the virtual clock in
+ * HostNode.h; pins, serial and peripherals act on host::currentNode().
+ *
+ * ESP_PLATFORM stays undefined so LifelineCore takes its portable paths.
+ * LIFELINE_HOST is defined for the rare place a sketch must know.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_HOST_ARDUINO_H
+#define LIFELINE_HOST_ARDUINO_H
+
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <type_traits>
+
+#include "HostNode.h"
+#include "IPAddress.h"
+#include "Print.h"
+#include "WString.h"
+
+#define LIFELINE_HOST 1
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef uint16_t word;
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              CONSTANTS & MACROS
+// ═══════════════════════════════════════════════════════════════════════════
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define PULLUP 0x04
+#define INPUT_PULLUP 0x05
+#define PULLDOWN 0x08
+#define INPUT_PULLDOWN 0x09
+
+#define PI 3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define F(s) (s)
+#define FPSTR(p) ((const char *)(p))
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_float(addr) (*(const float *)(addr))
+#define pgm_read_ptr(addr) (*(const void *const *)(addr))
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+
+#define radians(deg) ((deg) * DEG_TO_RAD)
+#define degrees(rad) ((rad) * RAD_TO_DEG)
+#define sq(x) ((x) * (x))
+#define constrain(amt, low, high)                                              \
+  ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define bit(b) (1UL << (b))
+#define bitRead(value, b) (((value) >> (b)) & 0x01)
+#define bitSet(value, b) ((value) |= (1UL << (b)))
+#define bitClear(value, b) ((value) &= ~(1UL << (b)))
+#define bitWrite(value, b, v) ((v) ? bitSet(value, b) : bitClear(value, b))
+
+// By value: decltype(a < b ? a : b) would be a reference to a parameter
+template <typename A, typename B>
+inline typename std::common_type<A, B>::type min(A a, B b) {
+  return b < a ? b : a;
+}
+template <typename A, typename B>
+inline typename std::common_type<A, B>::type max(A a, B b) {
+  return a < b ? b : a;
+}
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  if (inMax == inMin)
+    return outMin;
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+inline bool isDigit(int c) { return isdigit(c) != 0; }
+inline bool isAlpha(int c) { return isalpha(c) != 0; }
+inline bool isAlphaNumeric(int c) { return isalnum(c) != 0; }
+inline bool isSpace(int c) { return isspace(c) != 0; }
+inline bool isWhitespace(int c) { return c == ' ' || c == '\t'; }
+inline bool isPrintable(int c) { return isprint(c) != 0; }
+inline bool isUpperCase(int c) { return isupper(c) != 0; }
+inline bool isLowerCase(int c) { return islower(c) != 0; }
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                   TIME
+// ═══════════════════════════════════════════════════════════════════════════
+
+inline unsigned long millis() {
+  return (unsigned long)(uint32_t)(host::nowUs() / 1000ULL);
+}
+inline unsigned long micros() { return (unsigned long)(uint32_t)host::nowUs(); }
+inline void delay(uint32_t ms) { host::advanceMs(ms); }
+inline void delayMicroseconds(uint32_t us) { host::advanceUs(us); }
+inline void yield() { host::advanceUs(HOST_YIELD_US); }
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                   GPIO
+// ═══════════════════════════════════════════════════════════════════════════
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+void analogReadResolution(uint8_t bits);
+
+/** GPIO matrix: drive pin from a peripheral output (soc/gpio_sig_map.h). */
+void pinMatrixOutAttach(uint8_t pin, uint8_t function, bool invertOut,
+                        bool invertEnable);
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long durationMs = 0);
+void noTone(uint8_t pin);
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                  RANDOM
+// ═══════════════════════════════════════════════════════════════════════════
+
+void randomSeed(unsigned long seed);
+long random(long howBig);
+long random(long howSmall, long howBig);
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                  SERIAL
+// ═══════════════════════════════════════════════════════════════════════════
+
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long baud) { baud_ = baud; }
+  void end() {}
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buf, size_t len) override;
+  using Print::write;
+  explicit operator bool() const { return true; }
+
+private:
+  unsigned long baud_ = 0;
+};
+
+extern HardwareSerial Serial;
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                   ESP
+// ═══════════════════════════════════════════════════════════════════════════
+
+class EspClass {
+public:
+  /** Flags the node; the harness decides what a reboot means. */
+  void restart();
+  uint32_t getFreeHeap() const { return host::currentNode().heap.freeBytes; }
+  uint32_t getHeapSize() const { return 320 * 1024; }
+  uint32_t getMinFreeHeap() const {
+    const host::Node::Heap &h = host::currentNode().heap;
+    return h.freeBytes < h.minFreeBytes ? h.freeBytes : h.minFreeBytes;
+  }
+  uint32_t getMaxAllocHeap() const {
+    return host::currentNode().heap.largestBlock;
+  }
+  uint32_t getCpuFreqMHz() const { return 240; }
+  /** From the virtual clock, so code that never waits costs 0 cycles. */
+  uint32_t getCycleCount() const { return (uint32_t)(host::nowUs() * 240); }
+  const char *getChipModel() const { return "host"; }
+};
+
+extern EspClass ESP;
+
+#endif // LIFELINE_HOST_ARDUINO_H
@@ -0,0 +1,56 @@
+#include "freertos/task.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+struct HostTask {
+  std::mutex lock;
+  std::condition_variable wake;
+  uint32_t count = 0;
+};
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  static thread_local HostTask self;
+  return &self;
+}
+
+TickType_t xTaskGetTickCount() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return (TickType_t)duration_cast<milliseconds>(steady_clock::now() - start)
+      .count();
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  {
+    std::lock_guard<std::mutex> guard(task->lock);
+    task->count++;
+  }
+  task->wake.notify_one();
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityWoken) {
+  xTaskNotifyGive(task);
+  if (higherPriorityWoken)
+    *higherPriorityWoken = pdTRUE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait) {
+  HostTask *self = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> guard(self->lock);
+  const auto ready = [self] { return self->count > 0; };
+  if (ticksToWait == portMAX_DELAY) {
+    // Timed waits only: the untimed one needs a newer libstdc++ than some
+    // GoogleTest installs bring along
+    while (!self->wake.wait_for(guard, std::chrono::hours(1), ready))
+      ;
+  } else {
+    self->wake.wait_for(guard, std::chrono::milliseconds(ticksToWait), ready);
+  }
+  const uint32_t count = self->count;
+  if (count)
+    self->count = clearCountOnExit ? 0 : count - 1;
+  return count;
+}
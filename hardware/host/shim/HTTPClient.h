@@ -0,0 +1,60 @@
+/*
+ * Host stand-in for the ESP32 HTTPClient. Requests go to the current
+ * node's httpHandler when WiFi is up and block the caller for the
+ * response's latencyMs of virtual time, or for the read timeout when that
+ * is shorter. With no handler the connect times out. Every request is
+ * logged with the timeouts it was sent with.
+ */
+
+#ifndef LIFELINE_HOST_HTTPCLIENT_H
+#define LIFELINE_HOST_HTTPCLIENT_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_STREAM (-6)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+#define HTTPC_ERROR_TOO_LESS_RAM (-8)
+#define HTTPC_ERROR_ENCODING (-9)
+#define HTTPC_ERROR_STREAM_WRITE (-10)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_NOT_MODIFIED 304
+
+class HTTPClient {
+public:
+  bool begin(const String &url);
+  void end();
+  void addHeader(const String &name, const String &value);
+  void setTimeout(uint16_t ms) { timeoutMs_ = ms; }
+  void setConnectTimeout(int32_t ms) { connectTimeoutMs_ = ms; }
+  void setReuse(bool) {}
+  void collectHeaders(const char *headerKeys[], size_t count);
+
+  int GET();
+  int POST(const String &payload);
+  int POST(const uint8_t *payload, size_t size);
+  int sendRequest(const char *method, const String &payload = String());
+
+  String getString() { return String(response_.body); }
+  int getSize() { return (int)response_.body.size(); }
+  String header(const char *name);
+  bool hasHeader(const char *name);
+
+  static String errorToString(int error);
+
+private:
+  host::HttpRequest request_;
+  host::HttpResponse response_;
+  std::vector<std::string> collect_;
+  int32_t connectTimeoutMs_ = 5000; // HTTPCLIENT_DEFAULT_TCP_TIMEOUT
+  uint16_t timeoutMs_ = 5000;
+};
+
+#endif // LIFELINE_HOST_HTTPCLIENT_H
@@ -0,0 +1,196 @@
+#include "HostNode.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <new>
+
+namespace host {
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                  CLOCK
+// ═══════════════════════════════════════════════════════════════════════════
+
+static uint64_t clockUs = 0;
+
+uint64_t nowUs() { return clockUs; }
+void advanceUs(uint64_t us) { clockUs += us; }
+void resetClock() { clockUs = 0; }
+void setClockUs(uint64_t us) { clockUs = us; }
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                   NODE
+// ═══════════════════════════════════════════════════════════════════════════
+
+Node::Node(const std::string &name) : name(name) {
+  const char *echo = getenv("HOST_SERIAL_ECHO");
+  echoSerial = echo && echo[0] == '1';
+  for (uint16_t &sig : pinSignal)
+    sig = 256; // SIG_GPIO_OUT_IDX
+}
+
+void Node::typeLine(const std::string &line) {
+  serialIn.insert(serialIn.end(), line.begin(), line.end());
+  serialIn.push_back('\n');
+}
+
+std::string Node::takeSerial() {
+  std::string out;
+  out.swap(serialOut);
+  return out;
+}
+
+void Node::writePin(uint8_t pin, uint8_t level) {
+  if (pin >= HOST_PINS)
+    return;
+  pinLevel[pin] = level ? 1 : 0;
+  pinWrites++;
+  for (PinListener &l : pinListeners)
+    l(*this, pin, pinLevel[pin]);
+}
+
+void Node::writePinMask(uint8_t firstPin, uint32_t mask, uint8_t level) {
+  // Latch every bit before anyone looks, like the W1TS/W1TC registers
+  for (uint8_t b = 0; b < 32; b++) {
+    if ((mask >> b) & 1 && firstPin + b < HOST_PINS)
+      pinLevel[firstPin + b] = level ? 1 : 0;
+  }
+  pinWrites++;
+  for (uint8_t b = 0; b < 32; b++) {
+    if ((mask >> b) & 1 && firstPin + b < HOST_PINS) {
+      for (PinListener &l : pinListeners)
+        l(*this, (uint8_t)(firstPin + b), level ? 1 : 0);
+    }
+  }
+}
+
+void Node::injectFrame(const std::string &payload, int rssi,
+                       uint64_t delayUs) {
+  RadioFrame f;
+  f.payload = payload;
+  f.rssi = rssi;
+  f.sentUs = nowUs();
+  f.readyUs = nowUs() + delayUs;
+  radio.inbox.push_back(f);
+}
+
+void Node::pressKeys(const std::string &sequence) {
+  keys.insert(keys.end(), sequence.begin(), sequence.end());
+}
+
+static Node defaultNode("default");
+static Node *current = &defaultNode;
+
+Node &currentNode() { return *current; }
+void setCurrentNode(Node *node) { current = node ? node : &defaultNode; }
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                   AIR
+// ═══════════════════════════════════════════════════════════════════════════
+
+void Air::attach(Node &node) {
+  if (std::find(nodes_.begin(), nodes_.end(), &node) == nodes_.end())
+    nodes_.push_back(&node);
+}
+
+void Air::detach(Node &node) {
+  nodes_.erase(std::remove(nodes_.begin(), nodes_.end(), &node),
+               nodes_.end());
+}
+
+void Air::clear() {
+  nodes_.clear();
+  drop = nullptr;
+  delivered = lost = 0;
+}
+
+void Air::transmit(Node &from, const RadioFrame &frame) {
+  for (Node *to : nodes_) {
+    if (to == &from)
+      continue;
+    if (drop && drop(from, *to, frame)) {
+      lost++;
+      continue;
+    }
+    RadioFrame rx = frame;
+    rx.rssi = rssi;
+    rx.readyUs = frame.sentUs;
+    to->radio.inbox.push_back(rx);
+    delivered++;
+  }
+}
+
+Air &air() {
+  static Air instance;
+  return instance;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                   HEAP
+// ═══════════════════════════════════════════════════════════════════════════
+
+static thread_local int sketchDepth = 0;
+static thread_local int shimDepth = 0;
+
+void heapFreeze(bool trap) {
+  Node &n = currentNode();
+  n.heap.frozen = true;
+  n.heap.trap = trap;
+}
+
+void heapLibraryEnter() { currentNode().heap.libraryDepth++; }
+void heapLibraryLeave() { currentNode().heap.libraryDepth--; }
+
+void sketchCodeEnter() { sketchDepth++; }
+void sketchCodeLeave() { sketchDepth--; }
+void shimAllocEnter() { shimDepth++; }
+void shimAllocLeave() { shimDepth--; }
+
+static void noteAlloc(size_t size) {
+  if (sketchDepth == 0 || shimDepth > 0)
+    return;
+  Node::Heap &h = current->heap;
+  if (!h.frozen)
+    return;
+  h.allocs++;
+  if (h.libraryDepth > 0)
+    return;
+  h.violations++;
+  // stdio only: anything that allocates would come straight back here
+  fprintf(stderr, "[HEAP] %s: %zu B allocated after the heap was frozen\n",
+          current->name.c_str(), size);
+  if (h.trap)
+    abort();
+}
+
+} // namespace host
+
+// Every form is replaced so new/delete pairs stay on malloc/free, also under
+// a sanitizer that would otherwise supply its own array or nothrow forms.
+
+static void *hostAlloc(size_t size) {
+  host::noteAlloc(size);
+  void *p = malloc(size ? size : 1);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+
+void *operator new(size_t size) { return hostAlloc(size); }
+void *operator new[](size_t size) { return hostAlloc(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  host::noteAlloc(size);
+  return malloc(size ? size : 1);
+}
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+  host::noteAlloc(size);
+  return malloc(size ? size : 1);
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept { free(p); }
+void operator delete[](void *p, const std::nothrow_t &) noexcept { free(p); }
@@ -0,0 +1,388 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                  LIFELINE HOST - VIRTUAL CLOCK & NODE STATE
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Everything the Arduino shim pretends to be hardware lives here, so a test
+ * can set it up before setup() and inspect it after loop().
+ *
+ *   Clock   one virtual microsecond counter shared by every node.
+ *           delay()/delayMicroseconds() advance it, yield() advances it by
+ *           HOST_YIELD_US so spin-waits terminate, and calls that block on
+ *           hardware (endPacket(), waiting for SPI results) advance it by
+ *           the time they take. A harness that runs boards side by side
+ *           may keep a time per board and set it before each step.
+ *   Node    the board around one sketch: serial in/out, pin levels, radio,
+ *           WiFi, HTTP endpoint, NVS, keypad, IMU. The shim's global objects
+ *           (Serial, LoRa, WiFi, Wire, SPI) act on the current node.
+ *   SPI     ESP-IDF spi_master transactions take bus time at the device's
+ *           clock and complete in order; results are only applied (and
+ *           seen by the ST7789 model) once the clock has passed them.
+ *   Air     a shared LoRa medium. endPacket() blocks the sender for the
+ *           time on air; at TxDone the frame reaches every other attached
+ *           node unless `drop` says no.
+ *   Heap    operator new is counted while a sketch runs. Once the sketch
+ *           freezes its heap (MemoryBudget.h), an allocation outside a
+ *           LibraryHeap scope is a violation. The shim's own bookkeeping
+ *           (serial log, radio queues) runs under ShimAlloc and is ignored.
+ *
+ * A single-sketch test never touches Node directly beyond the default one;
+ * a multi-sketch simulation switches with NodeScope around each call.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_HOST_NODE_H
+#define LIFELINE_HOST_NODE_H
+
+#include <stdint.h>
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#ifndef HOST_YIELD_US
+#define HOST_YIELD_US 100 // Virtual time one yield() costs
+#endif
+#ifndef HOST_PINS
+#define HOST_PINS 64 // GPIO numbers modelled per node
+#endif
+#ifndef HOST_PANEL_SIDE
+#define HOST_PANEL_SIDE 480 // Columns and pages of the modelled panel GRAM
+#endif
+
+namespace host {
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                  CLOCK
+// ═══════════════════════════════════════════════════════════════════════════
+
+uint64_t nowUs();
+void advanceUs(uint64_t us);
+inline void advanceMs(uint32_t ms) { advanceUs((uint64_t)ms * 1000ULL); }
+/** Back to t = 0 (call between tests, before creating nodes). */
+void resetClock();
+/** Jump to us, forwards or back (a harness switching to another board). */
+void setClockUs(uint64_t us);
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                   NODE
+// ═══════════════════════════════════════════════════════════════════════════
+
+struct RadioFrame {
+  std::string payload;
+  int rssi = -60;
+  float snr = 9.5f;
+  uint64_t sentUs = 0;  // TX: TxDone time
+  uint64_t readyUs = 0; // RX: RxDone time (parsePacket() hides it before)
+};
+
+struct HttpRequest {
+  std::string method;
+  std::string url;
+  std::map<std::string, std::string> headers;
+  std::string body;
+  uint64_t atUs = 0;
+  uint32_t connectTimeoutMs = 0; // As the client had them set
+  uint32_t timeoutMs = 0;
+};
+
+struct HttpResponse {
+  int status = 200; // < 0: HTTPClient error code (e.g. -1 refused)
+  std::string body;
+  std::map<std::string, std::string> headers;
+  uint32_t latencyMs = 40; // Virtual time the request blocks the caller
+};
+
+struct WebRequest {
+  std::string path;
+  std::map<std::string, std::string> args;
+};
+
+struct WebResponse {
+  std::string path;
+  int status = 0;
+  std::string contentType;
+  std::string body;
+};
+
+struct ToneEvent {
+  uint8_t pin;
+  uint32_t freq;
+  uint32_t durationMs;
+  uint64_t atUs;
+};
+
+class Node;
+
+/** Observes pin writes (bus models, logic probes). */
+typedef std::function<void(Node &, uint8_t pin, uint8_t level)> PinListener;
+
+class Node {
+public:
+  explicit Node(const std::string &name = "node");
+
+  std::string name;
+
+  // ── Serial ────────────────────────────────────────────────────────────
+  std::string serialOut;
+  std::deque<char> serialIn;
+  bool echoSerial = false; // Mirror output to stdout (HOST_SERIAL_ECHO=1)
+  /** Queue a line of console input (a newline is appended). */
+  void typeLine(const std::string &line);
+  /** Output since the last call. */
+  std::string takeSerial();
+
+  // ── GPIO ──────────────────────────────────────────────────────────────
+  uint8_t pinLevel[HOST_PINS] = {};
+  uint8_t pinMode[HOST_PINS] = {};
+  int analogValue[HOST_PINS] = {}; // Raw 12-bit counts
+  uint64_t pinWrites = 0;
+  uint16_t pinSignal[HOST_PINS]; // GPIO matrix output (SIG_GPIO_OUT_IDX)
+  std::vector<PinListener> pinListeners;
+  void writePin(uint8_t pin, uint8_t level);
+  /** Set/clear several pins at once (GPIO_OUT_W1TS/W1TC). */
+  void writePinMask(uint8_t firstPin, uint32_t mask, uint8_t level);
+
+  std::vector<ToneEvent> tones;
+
+  // ── LoRa ──────────────────────────────────────────────────────────────
+  struct Radio {
+    bool present = true; // begin() fails when false
+    bool failTx = false; // endPacket() returns 0 when true
+    long frequency = 0;
+    uint8_t sf = 7;
+    long bandwidth = 125000;
+    int txPower = 17;
+    bool crc = false;
+    enum Mode { SLEEP, STANDBY, RX, TX } mode = STANDBY;
+    std::string txBuffer;
+    bool inPacket = false;
+    std::deque<RadioFrame> inbox;
+    std::vector<RadioFrame> sent;
+    RadioFrame current; // Packet being read after parsePacket()
+    size_t readPos = 0;
+    int dio0 = -1;         // From setPins(): digitalRead() gives RxDone
+    uint64_t overruns = 0; // Frames the next one overwrote in the FIFO
+    /** RxDone raised: a frame has arrived and parsePacket() has not run. */
+    bool rxDone(uint64_t now) const {
+      return mode != SLEEP && !inbox.empty() && inbox.front().readyUs <= now;
+    }
+  } radio;
+  /** Make a frame available to parsePacket() now (or after delayUs). */
+  void injectFrame(const std::string &payload, int rssi = -60,
+                   uint64_t delayUs = 0);
+
+  // ── SPI master (driver/spi_master.h) ─────────────────────────────────
+  struct Spi {
+    uint64_t transactions = 0; // Executed, queued or polling
+    uint64_t bytes = 0;
+    uint64_t busNs = 0;     // Bus time of those transactions
+    uint64_t stallUs = 0;   // Virtual time callers waited for the bus
+    size_t maxQueued = 0;   // Deepest device queue seen
+    uint64_t misrouted = 0; // Sent while SCK was routed elsewhere
+    struct Bus {
+      bool up = false; // spi_bus_initialize() called
+      int sclk = -1, mosi = -1, miso = -1;
+      uint64_t freeNs = 0; // End of the last transaction queued on it
+    } bus[3];               // SPI1_HOST..SPI3_HOST
+  } spi;
+
+  // ── LCD_CAM i80 bus (esp_lcd_panel_io.h) ─────────────────────────────
+  struct Lcd {
+    bool present = true; // false: esp_lcd_new_i80_bus() is not supported
+    bool up = false;     // Bus created
+    int dc = -1, wr = -1;
+    int data[8] = {-1, -1, -1, -1, -1, -1, -1, -1};
+    uint32_t pclkHz = 0;
+    uint64_t transfers = 0;  // Executed (params and colour)
+    uint64_t bytes = 0;      // Command and data bytes on the bus
+    uint64_t busNs = 0;
+    uint64_t stallUs = 0;    // Virtual time callers waited for the bus
+    uint64_t callbacks = 0;  // on_color_trans_done calls
+    size_t maxQueued = 0;
+    uint64_t freeNs = 0;     // End of the last transfer queued
+    void *io = nullptr;      // The panel IO (LcdI80.cpp)
+  } lcd;
+
+  /**
+   * The panel, on SPI (ST7789) or on the i80 bus (ILI9488): decodes
+   * CASET/RASET/RAMWR/RAMWR-continue/RAMRD/MADCTL into a GRAM addressed as
+   * the host sees it (after MADCTL). Pixels written faster than maxWriteHz
+   * latch inverted; reads faster than maxReadHz or without MISO return
+   * 0xFF. On SPI only transactions to cs reach it; the i80 bus has no
+   * other device.
+   */
+  struct Panel {
+    int8_t cs = 16; // The pro boards' TFT_CS and TFT_DC
+    int8_t dc = 4;
+    bool misoWired = true;
+    uint32_t maxWriteHz = 62500000;
+    uint32_t maxReadHz = 6666667;
+    uint8_t madctl = 0;
+    uint64_t pixels = 0; // Pixels written to GRAM
+    uint64_t commands = 0;
+    uint64_t windows = 0; // CASET + RASET pairs
+    /** GRAM at (column, page); 0 where nothing was written. */
+    uint16_t pixel(uint16_t x, uint16_t y) const {
+      return x < HOST_PANEL_SIDE && y < HOST_PANEL_SIDE && !gram.empty()
+                 ? gram[(size_t)y * HOST_PANEL_SIDE + x]
+                 : 0;
+    }
+
+    // Decoder state (SpiMaster.cpp)
+    uint8_t cmd = 0;
+    uint8_t argc = 0;
+    uint8_t args[4] = {};
+    uint16_t col0 = 0, col1 = HOST_PANEL_SIDE - 1;
+    uint16_t row0 = 0, row1 = HOST_PANEL_SIDE - 1;
+    uint16_t col = 0, row = 0;
+    int16_t pendingByte = -1; // First byte of a pixel split across writes
+    bool readDummy = false;   // RAMRD still owes its dummy byte
+    std::vector<uint16_t> gram;
+  } panel;
+
+  // ── WiFi / HTTP ───────────────────────────────────────────────────────
+  struct Wifi {
+    bool apInRange = true;     // An AP answers begin()
+    std::string ssid;          // Empty accepts any SSID
+    std::string password;      // Empty accepts any password
+    uint32_t associateMs = 1500;
+    bool outage = false;       // Link drops (status WL_CONNECTION_LOST)
+    int mode = 0;
+    bool connecting = false;
+    bool connected = false;
+    bool softAp = false;
+    int failStatus = 0; // wl_status_t left by a failed begin()
+    uint64_t connectAtUs = 0;
+    std::string joinedSsid;
+  } wifi;
+
+  /** Backend behind HTTPClient; unset means every request is refused. */
+  std::function<HttpResponse(const HttpRequest &)> httpHandler;
+  std::vector<HttpRequest> httpLog; // Every attempt, served or refused
+
+  std::deque<WebRequest> webQueue; // Served by WebServer::handleClient()
+  std::vector<WebResponse> webResponses;
+
+  // ── NVS (Preferences) ─────────────────────────────────────────────────
+  std::map<std::string, std::map<std::string, std::string>> nvs;
+
+  // ── Keypad ────────────────────────────────────────────────────────────
+  std::deque<char> keys;
+  void pressKeys(const std::string &sequence);
+
+  // ── MPU6050 ───────────────────────────────────────────────────────────
+  struct Imu {
+    bool present = true;
+    float ax = 0.0f, ay = 0.0f, az = 9.81f; // m/s^2
+    float gx = 0.0f, gy = 0.0f, gz = 0.0f;  // rad/s
+    float tempC = 25.0f;
+  } imu;
+
+  // ── Heap ──────────────────────────────────────────────────────────────
+  struct Heap {
+    uint32_t freeBytes = 240 * 1024;    // ESP.getFreeHeap()
+    uint32_t minFreeBytes = 200 * 1024; // ESP.getMinFreeHeap() (floor)
+    uint32_t largestBlock = 112 * 1024; // ESP.getMaxAllocHeap()
+    bool frozen = false;     // heapFreeze() was called
+    bool trap = false;       // abort() on a violation
+    int libraryDepth = 0;    // Open LibraryHeap scopes
+    uint64_t allocs = 0;     // Sketch allocations since the freeze
+    uint64_t violations = 0; // ... of those outside a LibraryHeap scope
+  } heap;
+
+  bool restartRequested = false; // ESP.restart()
+};
+
+/** Node the shim objects currently act on (a default one always exists). */
+Node &currentNode();
+void setCurrentNode(Node *node);
+
+/**
+ * Bytes to node.panel (SpiMaster.cpp). command: DC low. hz: the write
+ * clock, 0 when the bytes are bit-banged (never too fast).
+ */
+void panelWrite(Node &n, const uint8_t *data, size_t len, bool command,
+                uint32_t hz);
+
+/**
+ * Wait on the virtual clock until every queued i80 transfer is on
+ * node.panel (LcdI80.cpp), as a host-side look at the screen needs.
+ */
+void lcdDrain(Node &n);
+
+/** Switch the current node for the lifetime of the scope. */
+class NodeScope {
+public:
+  explicit NodeScope(Node &node) : prev_(&currentNode()) {
+    setCurrentNode(&node);
+  }
+  ~NodeScope() { setCurrentNode(prev_); }
+
+private:
+  Node *prev_;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                   HEAP
+// ═══════════════════════════════════════════════════════════════════════════
+
+/** From now on the current node's sketch must not allocate (see Heap). */
+void heapFreeze(bool trap);
+/** LibraryHeap scope on the current node. */
+void heapLibraryEnter();
+void heapLibraryLeave();
+
+void sketchCodeEnter();
+void sketchCodeLeave();
+void shimAllocEnter();
+void shimAllocLeave();
+
+/** Code running as the sketch: Sketch::begin()/step() open one. */
+class SketchCode {
+public:
+  SketchCode() { sketchCodeEnter(); }
+  ~SketchCode() { sketchCodeLeave(); }
+};
+
+/** Shim bookkeeping the firmware would not allocate for. */
+class ShimAlloc {
+public:
+  ShimAlloc() { shimAllocEnter(); }
+  ~ShimAlloc() { shimAllocLeave(); }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                   AIR
+// ═══════════════════════════════════════════════════════════════════════════
+
+class Air {
+public:
+  void attach(Node &node);
+  void detach(Node &node);
+  void clear();
+
+  /**
+   * Called by LoRa.endPacket() at TxDone; every other attached node can
+   * parse the frame from frame.sentUs on.
+   */
+  void transmit(Node &from, const RadioFrame &frame);
+
+  /** Return true to lose the frame on the way to `to`. */
+  std::function<bool(const Node &from, const Node &to, const RadioFrame &)>
+      drop;
+  int rssi = -72;
+  uint64_t delivered = 0;
+  uint64_t lost = 0;
+
+private:
+  std::vector<Node *> nodes_;
+};
+
+Air &air();
+
+} // namespace host
+
+#endif // LIFELINE_HOST_NODE_H
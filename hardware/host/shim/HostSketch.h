@@ -0,0 +1,92 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                      LIFELINE HOST - SKETCH HARNESS
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Binds a sketch's setup()/loop() to a Node and runs it on the virtual
+ * clock. A loop() pass that does not advance time itself costs
+ * HOST_LOOP_TICK_US, standing in for the real loop period, so runFor()
+ * always terminates.
+ *
+ *   host::Sketch rx("rx", rx_pro::setup, rx_pro::loop);
+ *   rx.begin();
+ *   rx.node.injectFrame("TX003,A;s=7");
+ *   rx.runFor(100);
+ *
+ * Several sketches on one Air are stepped round-robin by host::runAll().
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_HOST_SKETCH_H
+#define LIFELINE_HOST_SKETCH_H
+
+#include "HostNode.h"
+
+#include <initializer_list>
+
+#ifndef HOST_LOOP_TICK_US
+#define HOST_LOOP_TICK_US 1000 // Virtual cost of an idle loop() pass
+#endif
+
+namespace host {
+
+class Sketch {
+public:
+  typedef void (*EntryPoint)();
+
+  Sketch(const std::string &name, EntryPoint setupFn, EntryPoint loopFn)
+      : node(name), setup_(setupFn), loop_(loopFn) {}
+
+  void begin() {
+    NodeScope scope(node);
+    SketchCode code;
+    setup_();
+  }
+
+  /** One loop() pass on this sketch's node. */
+  void step() {
+    NodeScope scope(node);
+    const uint64_t before = nowUs();
+    {
+      SketchCode code;
+      loop_();
+    }
+    loops++;
+    if (nowUs() == before)
+      advanceUs(HOST_LOOP_TICK_US);
+  }
+
+  void runFor(uint32_t ms) {
+    const uint64_t end = nowUs() + (uint64_t)ms * 1000ULL;
+    while (nowUs() < end)
+      step();
+  }
+
+  /** Step until pred() holds or timeoutMs passes; returns pred(). */
+  template <typename Pred> bool runUntil(Pred pred, uint32_t timeoutMs) {
+    const uint64_t end = nowUs() + (uint64_t)timeoutMs * 1000ULL;
+    while (!pred() && nowUs() < end)
+      step();
+    return pred();
+  }
+
+  Node node;
+  uint64_t loops = 0;
+
+private:
+  EntryPoint setup_;
+  EntryPoint loop_;
+};
+
+/** Round-robin several sketches for ms of virtual time. */
+inline void runAll(std::initializer_list<Sketch *> sketches, uint32_t ms) {
+  const uint64_t end = nowUs() + (uint64_t)ms * 1000ULL;
+  while (nowUs() < end) {
+    for (Sketch *s : sketches)
+      s->step();
+  }
+}
+
+} // namespace host
+
+#endif // LIFELINE_HOST_SKETCH_H
@@ -0,0 +1,46 @@
+/*
+ * Host stand-in for the Arduino IPAddress class (IPv4 only).
+ */
+
+#ifndef LIFELINE_HOST_IPADDRESS_H
+#define LIFELINE_HOST_IPADDRESS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "Print.h"
+#include "WString.h"
+
+class IPAddress : public Printable {
+public:
+  IPAddress() : b_{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : b_{a, b, c, d} {}
+
+  uint8_t operator[](int i) const { return b_[i & 3]; }
+  bool operator==(const IPAddress &o) const {
+    return b_[0] == o.b_[0] && b_[1] == o.b_[1] && b_[2] == o.b_[2] &&
+           b_[3] == o.b_[3];
+  }
+
+  bool fromString(const char *s) {
+    unsigned a, b, c, d;
+    if (sscanf(s, "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 ||
+        b > 255 || c > 255 || d > 255)
+      return false;
+    *this = IPAddress((uint8_t)a, (uint8_t)b, (uint8_t)c, (uint8_t)d);
+    return true;
+  }
+
+  size_t printTo(Print &p) const override { return p.print(toString()); }
+
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", b_[0], b_[1], b_[2], b_[3]);
+    return String(buf);
+  }
+
+private:
+  uint8_t b_[4];
+};
+
+#endif // LIFELINE_HOST_IPADDRESS_H
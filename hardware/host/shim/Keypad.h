@@ -0,0 +1,87 @@
+/*
+ * Host stand-in for the Keypad library. Keys come from the current node's
+ * script (Node::pressKeys); each getKey() call takes one, and getKeys()
+ * reports it as PRESSED and then RELEASED on the following scan.
+ */
+
+#ifndef LIFELINE_HOST_KEYPAD_H
+#define LIFELINE_HOST_KEYPAD_H
+
+#include <Arduino.h>
+
+#define NO_KEY '\0'
+#define LIST_MAX 10
+#define makeKeymap(x) ((char *)x)
+
+typedef enum { IDLE, PRESSED, HOLD, RELEASED } KeyState;
+
+class Key {
+public:
+  char kchar = NO_KEY;
+  int kcode = -1;
+  KeyState kstate = IDLE;
+  bool stateChanged = false;
+};
+
+class Keypad {
+public:
+  Keypad(char *userKeymap, byte *row, byte *col, byte numRows, byte numCols)
+      : keymap_(userKeymap), rows_(numRows), cols_(numCols) {
+    (void)row;
+    (void)col;
+  }
+
+  char getKey() {
+    std::deque<char> &keys = host::currentNode().keys;
+    if (keys.empty())
+      return NO_KEY;
+    const char k = keys.front();
+    keys.pop_front();
+    return k;
+  }
+
+  bool getKeys() {
+    bool changed = false;
+    for (uint8_t i = 0; i < LIST_MAX; i++) {
+      key[i].stateChanged = false;
+      if (key[i].kstate == PRESSED) {
+        key[i].kstate = RELEASED;
+        key[i].stateChanged = true;
+        changed = true;
+      } else if (key[i].kstate == RELEASED) {
+        key[i] = Key();
+      }
+    }
+    const char k = getKey();
+    if (k != NO_KEY) {
+      Key &slot = key[0].kstate == IDLE ? key[0] : key[1];
+      slot.kchar = k;
+      slot.kcode = codeOf(k);
+      slot.kstate = PRESSED;
+      slot.stateChanged = true;
+      changed = true;
+    }
+    return changed;
+  }
+
+  KeyState getState() const { return key[0].kstate; }
+  void setDebounceTime(unsigned int) {}
+  void setHoldTime(unsigned int) {}
+
+  Key key[LIST_MAX];
+
+private:
+  int codeOf(char k) const {
+    for (int i = 0; i < rows_ * cols_; i++) {
+      if (keymap_[i] == k)
+        return i;
+    }
+    return -1;
+  }
+
+  char *keymap_;
+  byte rows_;
+  byte cols_;
+};
+
+#endif // LIFELINE_HOST_KEYPAD_H
@@ -0,0 +1,184 @@
+#include "esp_lcd_panel_io.h"
+
+#include <Arduino.h>
+
+#include <deque>
+
+namespace {
+
+const uint32_t LCD_CLK_HZ = 160000000;
+
+struct Transfer {
+  int cmd; // -1: data only
+  const uint8_t *data;
+  size_t len;
+  uint64_t doneNs;
+};
+
+} // namespace
+
+struct esp_lcd_i80_bus_t {
+  host::Node *node;
+  size_t maxBytes;
+};
+
+struct esp_lcd_panel_io_t {
+  esp_lcd_i80_bus_t *bus;
+  esp_lcd_panel_io_i80_config_t cfg;
+  uint32_t hz; // LCD clock over a whole divider
+  std::deque<Transfer> queue;
+};
+
+static uint64_t nowNs() { return host::nowUs() * 1000ULL; }
+
+static void send(esp_lcd_panel_io_t *io, const Transfer &t) {
+  host::Node &n = *io->bus->node;
+  host::NodeScope scope(n);
+  if (t.cmd >= 0) {
+    const uint8_t c = (uint8_t)t.cmd;
+    host::panelWrite(n, &c, 1, true, io->hz);
+  }
+  if (t.len && t.data)
+    host::panelWrite(n, t.data, t.len, false, io->hz);
+  n.lcd.transfers++;
+  n.lcd.bytes += t.len + (t.cmd >= 0 ? 1 : 0);
+  n.lcd.busNs += (t.len + (t.cmd >= 0 ? 1 : 0)) * 1000000000ULL / io->hz;
+}
+
+/** Execute the queued transfers the clock has passed and retire them. */
+static void settle(esp_lcd_panel_io_t *io) {
+  const uint64_t now = nowNs();
+  while (!io->queue.empty() && io->queue.front().doneNs <= now) {
+    const Transfer t = io->queue.front();
+    {
+      host::ShimAlloc shim;
+      io->queue.pop_front();
+    }
+    send(io, t);
+    if (io->cfg.on_color_trans_done) {
+      io->bus->node->lcd.callbacks++;
+      esp_lcd_panel_io_event_data_t edata = {0};
+      io->cfg.on_color_trans_done(io, &edata, io->cfg.user_ctx);
+    }
+  }
+}
+
+static uint64_t reserveBus(esp_lcd_panel_io_t *io, int cmd, size_t len) {
+  host::Node::Lcd &lcd = io->bus->node->lcd;
+  const uint64_t start = lcd.freeNs > nowNs() ? lcd.freeNs : nowNs();
+  lcd.freeNs = start + (len + (cmd >= 0 ? 1 : 0)) * 1000000000ULL / io->hz;
+  return lcd.freeNs;
+}
+
+static void waitUntil(esp_lcd_panel_io_t *io, uint64_t ns) {
+  const uint64_t now = nowNs();
+  if (ns <= now)
+    return;
+  const uint64_t us = (ns - now + 999) / 1000;
+  io->bus->node->lcd.stallUs += us;
+  host::advanceUs(us);
+  settle(io);
+}
+
+esp_err_t esp_lcd_new_i80_bus(const esp_lcd_i80_bus_config_t *config,
+                              esp_lcd_i80_bus_handle_t *ret_bus) {
+  if (!config || !ret_bus || config->bus_width != 8)
+    return ESP_ERR_INVALID_ARG;
+  host::Node &n = host::currentNode();
+  if (!n.lcd.present)
+    return ESP_ERR_NOT_SUPPORTED;
+  if (n.lcd.up)
+    return ESP_ERR_INVALID_STATE;
+  n.lcd.up = true;
+  n.lcd.dc = config->dc_gpio_num;
+  n.lcd.wr = config->wr_gpio_num;
+  for (int i = 0; i < 8; i++)
+    n.lcd.data[i] = config->data_gpio_nums[i];
+  host::ShimAlloc shim;
+  *ret_bus = new esp_lcd_i80_bus_t{&n, config->max_transfer_bytes};
+  return ESP_OK;
+}
+
+esp_err_t esp_lcd_del_i80_bus(esp_lcd_i80_bus_handle_t bus) {
+  if (!bus)
+    return ESP_ERR_INVALID_ARG;
+  bus->node->lcd.up = false;
+  host::ShimAlloc shim;
+  delete bus;
+  return ESP_OK;
+}
+
+esp_err_t esp_lcd_new_panel_io_i80(esp_lcd_i80_bus_handle_t bus,
+                                   const esp_lcd_panel_io_i80_config_t *config,
+                                   esp_lcd_panel_io_handle_t *ret_io) {
+  if (!bus || !config || !ret_io || !config->pclk_hz ||
+      config->trans_queue_depth < 1)
+    return ESP_ERR_INVALID_ARG;
+  host::ShimAlloc shim;
+  esp_lcd_panel_io_t *io = new esp_lcd_panel_io_t();
+  io->bus = bus;
+  io->cfg = *config;
+  const uint32_t div = (LCD_CLK_HZ + config->pclk_hz - 1) / config->pclk_hz;
+  io->hz = LCD_CLK_HZ / (div ? div : 1);
+  bus->node->lcd.pclkHz = io->hz;
+  bus->node->lcd.io = io;
+  *ret_io = io;
+  return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_del(esp_lcd_panel_io_handle_t io) {
+  if (!io)
+    return ESP_ERR_INVALID_ARG;
+  if (!io->queue.empty())
+    waitUntil(io, io->queue.back().doneNs);
+  if (io->bus->node->lcd.io == io)
+    io->bus->node->lcd.io = nullptr;
+  host::ShimAlloc shim;
+  delete io;
+  return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd,
+                                    const void *param, size_t param_size) {
+  if (!io || (param_size && !param))
+    return ESP_ERR_INVALID_ARG;
+  settle(io);
+  if (!io->queue.empty())
+    waitUntil(io, io->queue.back().doneNs);
+  // Sent by the CPU-driven path while the caller waits
+  const Transfer t = {lcd_cmd, (const uint8_t *)param, param_size, 0};
+  waitUntil(io, reserveBus(io, lcd_cmd, param_size));
+  send(io, t);
+  return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int lcd_cmd,
+                                    const void *color, size_t color_size) {
+  if (!io || (color_size && !color) || color_size > io->bus->maxBytes)
+    return ESP_ERR_INVALID_ARG;
+  settle(io);
+  // A full queue blocks until the oldest transfer is done
+  if (io->queue.size() >= io->cfg.trans_queue_depth)
+    waitUntil(io, io->queue.front().doneNs);
+  host::ShimAlloc shim;
+  io->queue.push_back({lcd_cmd, (const uint8_t *)color, color_size,
+                       reserveBus(io, lcd_cmd, color_size)});
+  host::Node::Lcd &lcd = io->bus->node->lcd;
+  if (io->queue.size() > lcd.maxQueued)
+    lcd.maxQueued = io->queue.size();
+  return ESP_OK;
+}
+
+namespace host {
+
+void lcdDrain(Node &n) {
+  esp_lcd_panel_io_t *io = (esp_lcd_panel_io_t *)n.lcd.io;
+  if (!io)
+    return;
+  NodeScope scope(n);
+  settle(io);
+  if (!io->queue.empty())
+    waitUntil(io, io->queue.back().doneNs);
+}
+
+} // namespace host
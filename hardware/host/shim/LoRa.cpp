@@ -0,0 +1,142 @@
+#include "LoRa.h"
+
+#include <LatencyBudget.h>
+
+LoRaClass LoRa;
+
+static host::Node::Radio &radio() { return host::currentNode().radio; }
+
+int LoRaClass::begin(long frequency) {
+  host::Node::Radio &r = radio();
+  if (!r.present)
+    return 0;
+  r.frequency = frequency;
+  r.mode = host::Node::Radio::STANDBY;
+  r.dio0 = dio0_;
+  return 1;
+}
+
+int LoRaClass::beginPacket(int implicitHeader) {
+  (void)implicitHeader;
+  host::Node::Radio &r = radio();
+  if (r.mode == host::Node::Radio::TX)
+    return 0;
+  r.mode = host::Node::Radio::STANDBY;
+  r.txBuffer.clear();
+  r.inPacket = true;
+  return 1;
+}
+
+int LoRaClass::endPacket(bool async) {
+  host::Node &n = host::currentNode();
+  host::Node::Radio &r = n.radio;
+  if (!r.inPacket)
+    return 0;
+  r.inPacket = false;
+  if (r.failTx) {
+    r.mode = host::Node::Radio::STANDBY;
+    return 0;
+  }
+
+  // The CPU spins on TxDone for the whole time on air
+  r.mode = host::Node::Radio::TX;
+  const uint32_t airUs = lifeline::loraTimeOnAirUs(
+      (uint16_t)r.txBuffer.size(), r.sf, (uint32_t)r.bandwidth, crDenom_,
+      preamble_, r.crc);
+  if (!async)
+    host::advanceUs(airUs);
+  r.mode = host::Node::Radio::STANDBY;
+
+  {
+    host::ShimAlloc shim; // The FIFO and the air are not the board's heap
+    host::RadioFrame f;
+    f.payload = r.txBuffer;
+    f.sentUs = host::nowUs() + (async ? airUs : 0);
+    r.sent.push_back(f);
+    host::air().transmit(n, f);
+  }
+  if (onTxDone_)
+    onTxDone_();
+  return 1;
+}
+
+size_t LoRaClass::write(uint8_t byte) { return write(&byte, 1); }
+
+size_t LoRaClass::write(const uint8_t *buffer, size_t size) {
+  host::Node::Radio &r = radio();
+  if (!r.inPacket)
+    return 0;
+  const size_t room = 255 - r.txBuffer.size(); // SX127x FIFO payload limit
+  if (size > room)
+    size = room;
+  host::ShimAlloc shim;
+  r.txBuffer.append((const char *)buffer, size);
+  return size;
+}
+
+int LoRaClass::parsePacket(int size) {
+  (void)size;
+  host::Node::Radio &r = radio();
+  const uint64_t now = host::nowUs();
+  if (r.mode == host::Node::Radio::SLEEP) {
+    // A sleeping radio misses whatever went past
+    while (!r.inbox.empty() && r.inbox.front().readyUs <= now)
+      r.inbox.pop_front();
+    return 0;
+  }
+  if (r.inbox.empty() || r.inbox.front().readyUs > now)
+    return 0;
+  host::ShimAlloc shim;
+  // One FIFO: a frame not read before the next RxDone is overwritten
+  while (r.inbox.size() > 1 && r.inbox[1].readyUs <= now) {
+    r.inbox.pop_front();
+    r.overruns++;
+  }
+  r.current = r.inbox.front();
+  r.inbox.pop_front();
+  r.readPos = 0;
+  r.mode = host::Node::Radio::STANDBY;
+  return (int)r.current.payload.size();
+}
+
+int LoRaClass::packetRssi() { return radio().current.rssi; }
+float LoRaClass::packetSnr() { return radio().current.snr; }
+
+int LoRaClass::available() {
+  host::Node::Radio &r = radio();
+  return (int)(r.current.payload.size() - r.readPos);
+}
+
+int LoRaClass::read() {
+  host::Node::Radio &r = radio();
+  if (r.readPos >= r.current.payload.size())
+    return -1;
+  return (uint8_t)r.current.payload[r.readPos++];
+}
+
+int LoRaClass::peek() {
+  host::Node::Radio &r = radio();
+  if (r.readPos >= r.current.payload.size())
+    return -1;
+  return (uint8_t)r.current.payload[r.readPos];
+}
+
+void LoRaClass::receive(int size) {
+  (void)size;
+  radio().mode = host::Node::Radio::RX;
+}
+
+void LoRaClass::idle() { radio().mode = host::Node::Radio::STANDBY; }
+void LoRaClass::sleep() { radio().mode = host::Node::Radio::SLEEP; }
+
+void LoRaClass::setTxPower(int level, int outputPin) {
+  (void)outputPin;
+  radio().txPower = level;
+}
+void LoRaClass::setFrequency(long frequency) { radio().frequency = frequency; }
+void LoRaClass::setSpreadingFactor(int sf) {
+  radio().sf = (uint8_t)(sf < 6 ? 6 : sf > 12 ? 12 : sf);
+}
+void LoRaClass::setSignalBandwidth(long sbw) { radio().bandwidth = sbw; }
+void LoRaClass::enableCrc() { radio().crc = true; }
+void LoRaClass::disableCrc() { radio().crc = false; }
@@ -0,0 +1,85 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                     LIFELINE HOST - SX127x (LoRa) SHIM
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Same API as sandeepmistry/arduino-LoRa, acting on the current node's
+ * Radio. endPacket() blocks for the real time on air (virtual clock) and
+ * hands the frame to host::air(); parsePacket() returns frames whose RxDone
+ * time has passed. The FIFO holds one frame: when a second one is done
+ * before parsePacket() ran, the first is lost (node.radio.overruns). The
+ * DIO0 pin given to setPins() reads high while a frame waits.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_HOST_LORA_H
+#define LIFELINE_HOST_LORA_H
+
+#include <Arduino.h>
+#include <SPI.h>
+
+class LoRaClass : public Stream {
+public:
+  int begin(long frequency);
+  void end() {}
+
+  int beginPacket(int implicitHeader = false);
+  int endPacket(bool async = false);
+
+  int parsePacket(int size = 0);
+  int packetRssi();
+  float packetSnr();
+  long packetFrequencyError() { return 0; }
+  int rssi() { return -110; }
+
+  size_t write(uint8_t byte) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  void flush() override {}
+
+  void receive(int size = 0);
+  void idle();
+  void sleep();
+
+  void setTxPower(int level, int outputPin = 1);
+  void setFrequency(long frequency);
+  void setSpreadingFactor(int sf);
+  void setSignalBandwidth(long sbw);
+  void setCodingRate4(int denominator) { crDenom_ = (uint8_t)denominator; }
+  void setPreambleLength(long length) { preamble_ = (uint16_t)length; }
+  void setSyncWord(int sw) { syncWord_ = (uint8_t)sw; }
+  void enableCrc();
+  void disableCrc();
+  void enableInvertIQ() {}
+  void disableInvertIQ() {}
+  void setOCP(uint8_t) {}
+  void setGain(uint8_t) {}
+
+  void setPins(int ss = 10, int reset = 9, int dio0 = 2) {
+    ss_ = ss;
+    reset_ = reset;
+    dio0_ = dio0;
+  }
+  void setSPI(SPIClass &) {}
+  void setSPIFrequency(uint32_t) {}
+  void onReceive(void (*callback)(int)) { onReceive_ = callback; }
+  void onTxDone(void (*callback)()) { onTxDone_ = callback; }
+
+  uint8_t random() { return (uint8_t)::random(256); }
+
+private:
+  int ss_ = 10, reset_ = 9, dio0_ = 2;
+  uint8_t crDenom_ = 5;
+  uint16_t preamble_ = 8;
+  uint8_t syncWord_ = 0x12;
+  void (*onReceive_)(int) = nullptr;
+  void (*onTxDone_)() = nullptr;
+};
+
+extern LoRaClass LoRa;
+
+#endif // LIFELINE_HOST_LORA_H
@@ -0,0 +1,246 @@
+#include <HTTPClient.h>
+#include <WebServer.h>
+#include <WiFi.h>
+
+WiFiClass WiFi;
+
+static host::Node::Wifi &wifi() { return host::currentNode().wifi; }
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                   WIFI
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool WiFiClass::mode(wifi_mode_t m) {
+  wifi().mode = m;
+  if (!(m & WIFI_STA)) {
+    wifi().connecting = false;
+    wifi().connected = false;
+  }
+  if (!(m & WIFI_AP))
+    wifi().softAp = false;
+  return true;
+}
+
+wifi_mode_t WiFiClass::getMode() { return (wifi_mode_t)wifi().mode; }
+
+wl_status_t WiFiClass::begin(const char *ssid, const char *passphrase) {
+  host::Node::Wifi &w = wifi();
+  w.mode |= WIFI_STA;
+  w.connected = false;
+  w.connecting = false;
+  w.joinedSsid = ssid ? ssid : "";
+  const std::string pass = passphrase ? passphrase : "";
+  if (!w.apInRange || (!w.ssid.empty() && w.ssid != w.joinedSsid)) {
+    w.failStatus = WL_NO_SSID_AVAIL;
+  } else if (!w.password.empty() && w.password != pass) {
+    w.failStatus = WL_CONNECT_FAILED;
+  } else {
+    w.failStatus = 0;
+    w.connecting = true;
+    w.connectAtUs = host::nowUs() + (uint64_t)w.associateMs * 1000ULL;
+  }
+  return WL_DISCONNECTED;
+}
+
+bool WiFiClass::disconnect(bool wifiOff, bool eraseAp) {
+  (void)eraseAp;
+  host::Node::Wifi &w = wifi();
+  w.connecting = false;
+  w.connected = false;
+  w.failStatus = 0;
+  if (wifiOff)
+    w.mode &= ~WIFI_STA;
+  return true;
+}
+
+bool WiFiClass::reconnect() {
+  host::Node::Wifi &w = wifi();
+  begin(w.joinedSsid.c_str(), w.password.c_str());
+  return true;
+}
+
+wl_status_t WiFiClass::status() {
+  host::Node::Wifi &w = wifi();
+  if (w.connecting && host::nowUs() >= w.connectAtUs) {
+    w.connecting = false;
+    w.connected = true;
+  }
+  if (w.connected)
+    return w.outage ? WL_CONNECTION_LOST : WL_CONNECTED;
+  if (w.failStatus)
+    return (wl_status_t)w.failStatus;
+  return w.connecting ? WL_DISCONNECTED : WL_IDLE_STATUS;
+}
+
+IPAddress WiFiClass::localIP() {
+  return status() == WL_CONNECTED ? IPAddress(192, 168, 1, 50) : IPAddress();
+}
+
+String WiFiClass::SSID() {
+  return status() == WL_CONNECTED ? String(wifi().joinedSsid) : String();
+}
+
+int32_t WiFiClass::RSSI() { return status() == WL_CONNECTED ? -58 : 0; }
+
+bool WiFiClass::softAP(const char *ssid, const char *passphrase, int channel,
+                       int hidden, int maxConnection) {
+  (void)ssid;
+  (void)passphrase;
+  (void)channel;
+  (void)hidden;
+  (void)maxConnection;
+  wifi().mode |= WIFI_AP;
+  wifi().softAp = true;
+  return true;
+}
+
+bool WiFiClass::softAPdisconnect(bool wifiOff) {
+  wifi().softAp = false;
+  if (wifiOff)
+    wifi().mode &= ~WIFI_AP;
+  return true;
+}
+
+IPAddress WiFiClass::softAPIP() {
+  return wifi().softAp ? IPAddress(192, 168, 4, 1) : IPAddress();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                HTTP CLIENT
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool HTTPClient::begin(const String &url) {
+  request_ = host::HttpRequest();
+  response_ = host::HttpResponse();
+  request_.url = url.str();
+  return true;
+}
+
+void HTTPClient::end() {
+  request_ = host::HttpRequest();
+}
+
+void HTTPClient::addHeader(const String &name, const String &value) {
+  request_.headers[name.str()] = value.str();
+}
+
+void HTTPClient::collectHeaders(const char *headerKeys[], size_t count) {
+  collect_.assign(headerKeys, headerKeys + count);
+}
+
+int HTTPClient::GET() { return sendRequest("GET"); }
+int HTTPClient::POST(const String &payload) {
+  return sendRequest("POST", payload);
+}
+int HTTPClient::POST(const uint8_t *payload, size_t size) {
+  return sendRequest("POST",
+                     String(std::string((const char *)payload, size)));
+}
+
+int HTTPClient::sendRequest(const char *method, const String &payload) {
+  host::Node &n = host::currentNode();
+  request_.method = method;
+  request_.body = payload.str();
+  request_.atUs = host::nowUs();
+  request_.connectTimeoutMs = (uint32_t)connectTimeoutMs_;
+  request_.timeoutMs = timeoutMs_;
+  n.httpLog.push_back(request_);
+
+  response_ = host::HttpResponse();
+  if (WiFi.status() != WL_CONNECTED) {
+    response_.status = HTTPC_ERROR_CONNECTION_REFUSED;
+    return response_.status;
+  }
+  if (!n.httpHandler) {
+    host::advanceMs((uint32_t)connectTimeoutMs_);
+    response_.status = HTTPC_ERROR_CONNECTION_REFUSED;
+    return response_.status;
+  }
+  response_ = n.httpHandler(request_);
+  if (response_.latencyMs > timeoutMs_) {
+    host::advanceMs(timeoutMs_);
+    response_ = host::HttpResponse();
+    response_.status = HTTPC_ERROR_READ_TIMEOUT;
+    return response_.status;
+  }
+  host::advanceMs(response_.latencyMs);
+  return response_.status;
+}
+
+String HTTPClient::header(const char *name) {
+  const auto it = response_.headers.find(name);
+  return it == response_.headers.end() ? String() : String(it->second);
+}
+
+bool HTTPClient::hasHeader(const char *name) {
+  return response_.headers.count(name) > 0;
+}
+
+String HTTPClient::errorToString(int error) {
+  switch (error) {
+  case HTTPC_ERROR_CONNECTION_REFUSED:
+    return F("connection refused");
+  case HTTPC_ERROR_SEND_HEADER_FAILED:
+    return F("send header failed");
+  case HTTPC_ERROR_SEND_PAYLOAD_FAILED:
+    return F("send payload failed");
+  case HTTPC_ERROR_NOT_CONNECTED:
+    return F("not connected");
+  case HTTPC_ERROR_CONNECTION_LOST:
+    return F("connection lost");
+  case HTTPC_ERROR_NO_STREAM:
+    return F("no stream");
+  case HTTPC_ERROR_NO_HTTP_SERVER:
+    return F("no HTTP server");
+  case HTTPC_ERROR_TOO_LESS_RAM:
+    return F("too less ram");
+  case HTTPC_ERROR_ENCODING:
+    return F("Transfer-Encoding not supported");
+  case HTTPC_ERROR_STREAM_WRITE:
+    return F("Stream write error");
+  case HTTPC_ERROR_READ_TIMEOUT:
+    return F("read Timeout");
+  default:
+    return String();
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                WEB SERVER
+// ═══════════════════════════════════════════════════════════════════════════
+
+void WebServer::handleClient() {
+  host::Node &n = host::currentNode();
+  if (!running_ || n.webQueue.empty())
+    return;
+  const host::WebRequest req = n.webQueue.front();
+  n.webQueue.pop_front();
+  path_ = req.path;
+  args_ = req.args;
+  const auto it = routes_.find(path_);
+  if (it != routes_.end())
+    it->second();
+  else if (notFound_)
+    notFound_();
+  else
+    send(404, "text/plain", "Not found");
+}
+
+String WebServer::arg(const String &name) {
+  const auto it = args_.find(name.str());
+  return it == args_.end() ? String() : String(it->second);
+}
+
+bool WebServer::hasArg(const String &name) {
+  return args_.count(name.str()) > 0;
+}
+
+void WebServer::send(int code, const char *contentType,
+                     const String &content) {
+  host::WebResponse r;
+  r.path = path_;
+  r.status = code;
+  r.contentType = contentType ? contentType : "";
+  r.body = content.str();
+  host::currentNode().webResponses.push_back(r);
+}
@@ -0,0 +1,103 @@
+/*
+ * Host stand-in for the ESP32 Preferences (NVS) API, stored as strings in
+ * the current node so values survive a simulated reboot.
+ */
+
+#ifndef LIFELINE_HOST_PREFERENCES_H
+#define LIFELINE_HOST_PREFERENCES_H
+
+#include <Arduino.h>
+
+class Preferences {
+public:
+  bool begin(const char *name, bool readOnly = false) {
+    ns_ = name;
+    readOnly_ = readOnly;
+    open_ = true;
+    return true;
+  }
+  void end() { open_ = false; }
+
+  bool clear() {
+    if (!writable())
+      return false;
+    store().clear();
+    return true;
+  }
+  bool remove(const char *key) {
+    return writable() && store().erase(key) > 0;
+  }
+  bool isKey(const char *key) { return open_ && store().count(key) > 0; }
+
+  size_t putString(const char *key, const String &value) {
+    return put(key, value.str()) ? value.length() : 0;
+  }
+  size_t putString(const char *key, const char *value) {
+    return putString(key, String(value));
+  }
+  String getString(const char *key, const String &defaultValue = String()) {
+    const std::string *v = get(key);
+    return v ? String(*v) : defaultValue;
+  }
+  /** Like the ESP32 core: length with the NUL, 0 if missing or too long. */
+  size_t getString(const char *key, char *value, size_t maxLen) {
+    const std::string *v = get(key);
+    if (!v || !value || v->size() + 1 > maxLen)
+      return 0;
+    memcpy(value, v->c_str(), v->size() + 1);
+    return v->size() + 1;
+  }
+
+  size_t putInt(const char *key, int32_t v) { return putNumber(key, v, 4); }
+  size_t putUInt(const char *key, uint32_t v) { return putNumber(key, v, 4); }
+  size_t putLong(const char *key, int32_t v) { return putNumber(key, v, 4); }
+  size_t putUChar(const char *key, uint8_t v) { return putNumber(key, v, 1); }
+  size_t putUShort(const char *key, uint16_t v) { return putNumber(key, v, 2); }
+  size_t putBool(const char *key, bool v) { return putNumber(key, v, 1); }
+  int32_t getInt(const char *key, int32_t d = 0) { return getNumber(key, d); }
+  uint32_t getUInt(const char *key, uint32_t d = 0) {
+    return (uint32_t)getNumber(key, d);
+  }
+  int32_t getLong(const char *key, int32_t d = 0) { return getNumber(key, d); }
+  uint8_t getUChar(const char *key, uint8_t d = 0) {
+    return (uint8_t)getNumber(key, d);
+  }
+  uint16_t getUShort(const char *key, uint16_t d = 0) {
+    return (uint16_t)getNumber(key, d);
+  }
+  bool getBool(const char *key, bool d = false) {
+    return getNumber(key, d) != 0;
+  }
+
+private:
+  std::map<std::string, std::string> &store() {
+    return host::currentNode().nvs[ns_];
+  }
+  bool writable() const { return open_ && !readOnly_; }
+  bool put(const char *key, const std::string &v) {
+    if (!writable())
+      return false;
+    store()[key] = v;
+    return true;
+  }
+  const std::string *get(const char *key) {
+    if (!open_)
+      return nullptr;
+    std::map<std::string, std::string> &s = store();
+    const auto it = s.find(key);
+    return it == s.end() ? nullptr : &it->second;
+  }
+  size_t putNumber(const char *key, long long v, size_t width) {
+    return put(key, std::to_string(v)) ? width : 0;
+  }
+  long long getNumber(const char *key, long long d) {
+    const std::string *v = get(key);
+    return v ? strtoll(v->c_str(), nullptr, 10) : d;
+  }
+
+  std::string ns_;
+  bool readOnly_ = false;
+  bool open_ = false;
+};
+
+#endif // LIFELINE_HOST_PREFERENCES_H
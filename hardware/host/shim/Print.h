@@ -0,0 +1,136 @@
+/*
+ * Host stand-in for Arduino Print/Stream, including the ESP32 core's
+ * printf(). Sinks only implement write(uint8_t).
+ */
+
+#ifndef LIFELINE_HOST_PRINT_H
+#define LIFELINE_HOST_PRINT_H
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "WString.h"
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print;
+
+/** Objects that know how to print themselves (IPAddress). */
+class Printable {
+public:
+  virtual ~Printable() {}
+  virtual size_t printTo(Print &p) const = 0;
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buf, size_t len) {
+    size_t n = 0;
+    while (len--)
+      n += write(*buf++);
+    return n;
+  }
+  size_t write(const char *s) {
+    return s ? write((const uint8_t *)s, strlen(s)) : 0;
+  }
+  size_t write(const char *buf, size_t len) {
+    return write((const uint8_t *)buf, len);
+  }
+
+  size_t print(const char *s) { return write(s); }
+  size_t print(const String &s) { return write(s.c_str(), s.length()); }
+  size_t print(const Printable &p) { return p.printTo(*this); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char v, int base = DEC) {
+    return print((unsigned long)v, base);
+  }
+  size_t print(int v, int base = DEC) { return print((long)v, base); }
+  size_t print(unsigned int v, int base = DEC) {
+    return print((unsigned long)v, base);
+  }
+  size_t print(long v, int base = DEC) {
+    return print(String((long long)v, (unsigned char)base));
+  }
+  size_t print(unsigned long v, int base = DEC) {
+    return print(String((unsigned long long)v, (unsigned char)base));
+  }
+  size_t print(long long v, int base = DEC) {
+    return print(String(v, (unsigned char)base));
+  }
+  size_t print(unsigned long long v, int base = DEC) {
+    return print(String(v, (unsigned char)base));
+  }
+  size_t print(double v, int digits = 2) {
+    return print(String(v, (unsigned int)digits));
+  }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T &v) {
+    const size_t n = print(v);
+    return n + println();
+  }
+  template <typename T> size_t println(const T &v, int format) {
+    const size_t n = print(v, format);
+    return n + println();
+  }
+
+  __attribute__((format(printf, 2, 3))) size_t printf(const char *format,
+                                                      ...) {
+    char small[64]; // Same as the ESP32 core: longer output is new[]'d
+    va_list args;
+    va_start(args, format);
+    va_list copy;
+    va_copy(copy, args);
+    const int len = vsnprintf(small, sizeof(small), format, copy);
+    va_end(copy);
+    if (len < 0) {
+      va_end(args);
+      return 0;
+    }
+    if ((size_t)len < sizeof(small)) {
+      va_end(args);
+      return write((const uint8_t *)small, (size_t)len);
+    }
+    char *big = new char[len + 1];
+    vsnprintf(big, len + 1, format, args);
+    va_end(args);
+    const size_t n = write((const uint8_t *)big, (size_t)len);
+    delete[] big;
+    return n;
+  }
+
+  virtual void flush() {}
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  String readStringUntil(char terminator) {
+    String s;
+    int c;
+    while ((c = read()) >= 0 && c != terminator)
+      s += (char)c;
+    return s;
+  }
+  String readString() {
+    String s;
+    int c;
+    while ((c = read()) >= 0)
+      s += (char)c;
+    return s;
+  }
+  void setTimeout(unsigned long) {}
+};
+
+#endif // LIFELINE_HOST_PRINT_H
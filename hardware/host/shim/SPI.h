@@ -0,0 +1,75 @@
+/*
+ * Host stand-in for the ESP32 SPIClass. Transfers return 0xFF (idle MISO)
+ * and are only counted.
+ */
+
+#ifndef LIFELINE_HOST_SPI_H
+#define LIFELINE_HOST_SPI_H
+
+#include <Arduino.h>
+
+#include "soc/gpio_sig_map.h"
+
+#define MSBFIRST 1
+#define LSBFIRST 0
+#define SPI_MODE0 0
+#define SPI_MODE1 1
+#define SPI_MODE2 2
+#define SPI_MODE3 3
+
+class SPISettings {
+public:
+  SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST,
+              uint8_t dataMode = SPI_MODE0)
+      : clock(clock), bitOrder(bitOrder), dataMode(dataMode) {}
+  uint32_t clock;
+  uint8_t bitOrder;
+  uint8_t dataMode;
+};
+
+class SPIClass {
+public:
+  void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1,
+             int8_t ss = -1) {
+    sck_ = sck;
+    miso_ = miso;
+    mosi_ = mosi;
+    ss_ = ss;
+    // VSPI, as the ESP32 core's SPI object
+    if (sck >= 0)
+      pinMatrixOutAttach(sck, VSPICLK_OUT_IDX, false, false);
+    if (mosi >= 0)
+      pinMatrixOutAttach(mosi, VSPID_OUT_IDX, false, false);
+  }
+  void end() {}
+  void setFrequency(uint32_t hz) { hz_ = hz; }
+  void beginTransaction(SPISettings s) {
+    hz_ = s.clock;
+    transactions++;
+  }
+  void endTransaction() {}
+  uint8_t transfer(uint8_t) {
+    bytes++;
+    return 0xFF;
+  }
+  uint16_t transfer16(uint16_t) {
+    bytes += 2;
+    return 0xFFFF;
+  }
+  void transfer(void *buf, uint32_t len) {
+    memset(buf, 0xFF, len);
+    bytes += len;
+  }
+  void writeBytes(const uint8_t *, uint32_t len) { bytes += len; }
+
+  uint64_t bytes = 0;
+  uint64_t transactions = 0;
+
+private:
+  int8_t sck_ = -1, miso_ = -1, mosi_ = -1, ss_ = -1;
+  uint32_t hz_ = 1000000;
+};
+
+extern SPIClass SPI;
+
+#endif // LIFELINE_HOST_SPI_H
@@ -0,0 +1,347 @@
+#include "driver/spi_master.h"
+
+#include <Arduino.h>
+
+#include <deque>
+
+#include "soc/gpio_sig_map.h"
+
+namespace {
+
+const uint32_t APB_HZ = 80000000;
+
+struct Pending {
+  spi_transaction_t *t;
+  uint64_t doneNs;
+  bool executed;
+};
+
+} // namespace
+
+struct spi_device_t {
+  host::Node *node;
+  spi_host_device_t host;
+  spi_device_interface_config_t cfg;
+  uint32_t hz; // APB over a whole divider
+  std::deque<Pending> queue;
+};
+
+static uint64_t nowNs() { return host::nowUs() * 1000ULL; }
+
+static bool halfDuplex(const spi_device_t *d) {
+  return d->cfg.flags & SPI_DEVICE_HALFDUPLEX;
+}
+
+static uint64_t transactionBits(const spi_device_t *d,
+                                const spi_transaction_t *t) {
+  uint64_t bits = t->length + d->cfg.command_bits + d->cfg.address_bits +
+                  d->cfg.dummy_bits;
+  if (halfDuplex(d))
+    bits += t->rxlength;
+  return bits;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              ST7789 MODEL
+// ═══════════════════════════════════════════════════════════════════════════
+
+static void panelStore(host::Node::Panel &p, uint16_t color, bool corrupt) {
+  if (p.gram.empty()) {
+    host::ShimAlloc shim;
+    p.gram.assign((size_t)HOST_PANEL_SIDE * HOST_PANEL_SIDE, 0);
+  }
+  if (p.col < HOST_PANEL_SIDE && p.row < HOST_PANEL_SIDE)
+    p.gram[(size_t)p.row * HOST_PANEL_SIDE + p.col] =
+        corrupt ? (uint16_t)~color : color;
+  p.pixels++;
+  if (++p.col > p.col1) {
+    p.col = p.col0;
+    if (++p.row > p.row1)
+      p.row = p.row0;
+  }
+}
+
+namespace host {
+
+void panelWrite(Node &n, const uint8_t *data, size_t len, bool command,
+                uint32_t hz) {
+  Node::Panel &p = n.panel;
+  for (size_t i = 0; i < len; i++) {
+    const uint8_t b = data[i];
+    if (command) {
+      p.cmd = b;
+      p.argc = 0;
+      p.commands++;
+      p.pendingByte = -1;
+      if (b == 0x2C || b == 0x2E) { // RAMWR / RAMRD restart at the window
+        p.col = p.col0;
+        p.row = p.row0;
+        p.readDummy = b == 0x2E;
+      }
+      if (b == 0x3C) // RAMWR continue: carry on where the last one was
+        p.cmd = 0x2C;
+      continue;
+    }
+    switch (p.cmd) {
+    case 0x2A: // CASET
+    case 0x2B: // RASET
+      if (p.argc < 4)
+        p.args[p.argc++] = b;
+      if (p.argc == 4) {
+        const uint16_t from = (uint16_t)(p.args[0] << 8 | p.args[1]);
+        const uint16_t to = (uint16_t)(p.args[2] << 8 | p.args[3]);
+        if (p.cmd == 0x2A) {
+          p.col0 = from;
+          p.col1 = to;
+        } else {
+          p.row0 = from;
+          p.row1 = to;
+          p.windows++;
+        }
+        p.argc = 5;
+      }
+      break;
+    case 0x36: // MADCTL
+      p.madctl = b;
+      break;
+    case 0x2C: // RAMWR, big-endian RGB565
+      if (p.pendingByte < 0) {
+        p.pendingByte = b;
+      } else {
+        panelStore(p, (uint16_t)(p.pendingByte << 8 | b), hz > p.maxWriteHz);
+        p.pendingByte = -1;
+      }
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+} // namespace host
+
+/** RAMRD: a dummy byte, then R, G, B (6 bits, left aligned) per pixel. */
+static void panelRead(host::Node &n, uint8_t *out, size_t len, uint32_t hz) {
+  host::Node::Panel &p = n.panel;
+  const bool valid = p.misoWired && hz <= p.maxReadHz && p.cmd == 0x2E;
+  size_t i = 0;
+  if (valid && p.readDummy && len) {
+    out[i++] = 0x00;
+    p.readDummy = false;
+  }
+  while (i < len) {
+    if (!valid) {
+      out[i++] = 0xFF;
+      continue;
+    }
+    const uint16_t c = p.pixel(p.col, p.row);
+    const uint8_t rgb[3] = {(uint8_t)((c >> 8) & 0xF8),
+                            (uint8_t)((c >> 3) & 0xFC),
+                            (uint8_t)(c << 3)};
+    for (uint8_t k = 0; k < 3 && i < len; k++)
+      out[i++] = rgb[k];
+    if (++p.col > p.col1) {
+      p.col = p.col0;
+      if (++p.row > p.row1)
+        p.row = p.row0;
+    }
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              TRANSACTIONS
+// ═══════════════════════════════════════════════════════════════════════════
+
+static void execute(spi_device_t *d, spi_transaction_t *t) {
+  host::Node &n = *d->node;
+  host::NodeScope scope(n);
+  if (d->cfg.pre_cb)
+    d->cfg.pre_cb(t);
+
+  const host::Node::Spi::Bus &bus = n.spi.bus[d->host];
+  const uint16_t clockSignal =
+      d->host == SPI2_HOST ? HSPICLK_OUT_IDX : VSPICLK_OUT_IDX;
+  const bool routed = bus.sclk < 0 || bus.sclk >= HOST_PINS ||
+                      n.pinSignal[bus.sclk] == clockSignal;
+  const bool panel = routed && d->cfg.spics_io_num == n.panel.cs;
+
+  const size_t txBytes = (t->length + 7) / 8;
+  const uint8_t *tx = (t->flags & SPI_TRANS_USE_TXDATA)
+                          ? t->tx_data
+                          : (const uint8_t *)t->tx_buffer;
+  if (panel && txBytes && tx)
+    host::panelWrite(n, tx, txBytes, n.panel.dc >= 0 && !n.pinLevel[n.panel.dc],
+                     d->hz);
+
+  const size_t rxBits = t->rxlength ? t->rxlength
+                                    : (halfDuplex(d) ? 0 : t->length);
+  const size_t rxBytes = (rxBits + 7) / 8;
+  uint8_t *rx = (t->flags & SPI_TRANS_USE_RXDATA) ? t->rx_data
+                                                  : (uint8_t *)t->rx_buffer;
+  if (rx && rxBytes) {
+    if (panel)
+      panelRead(n, rx, rxBytes, d->hz);
+    else
+      memset(rx, 0xFF, rxBytes);
+  }
+
+  if (!routed)
+    n.spi.misrouted++;
+  n.spi.transactions++;
+  n.spi.bytes += txBytes + (halfDuplex(d) ? rxBytes : 0);
+  n.spi.busNs += transactionBits(d, t) * 1000000000ULL / d->hz;
+  if (d->cfg.post_cb)
+    d->cfg.post_cb(t);
+}
+
+/** Execute the queued transactions the clock has already passed. */
+static void settle(spi_device_t *d) {
+  const uint64_t now = nowNs();
+  for (Pending &p : d->queue) {
+    if (p.doneNs > now)
+      break;
+    if (!p.executed) {
+      p.executed = true;
+      execute(d, p.t);
+    }
+  }
+}
+
+static uint64_t reserveBus(spi_device_t *d, const spi_transaction_t *t) {
+  host::Node::Spi::Bus &bus = d->node->spi.bus[d->host];
+  const uint64_t start = bus.freeNs > nowNs() ? bus.freeNs : nowNs();
+  bus.freeNs = start + transactionBits(d, t) * 1000000000ULL / d->hz;
+  return bus.freeNs;
+}
+
+static void waitUntil(host::Node &n, uint64_t ns) {
+  const uint64_t now = nowNs();
+  if (ns <= now)
+    return;
+  const uint64_t us = (ns - now + 999) / 1000;
+  n.spi.stallUs += us;
+  host::advanceUs(us);
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host,
+                             const spi_bus_config_t *config, int) {
+  if (host == SPI1_HOST || !config)
+    return ESP_ERR_INVALID_ARG;
+  host::Node &n = host::currentNode();
+  host::Node::Spi::Bus &bus = n.spi.bus[host];
+  if (bus.up)
+    return ESP_ERR_INVALID_STATE;
+  bus.up = true;
+  bus.sclk = config->sclk_io_num;
+  bus.mosi = config->mosi_io_num;
+  bus.miso = config->miso_io_num;
+  const bool h = host == SPI2_HOST;
+  if (bus.sclk >= 0)
+    pinMatrixOutAttach(bus.sclk, h ? HSPICLK_OUT_IDX : VSPICLK_OUT_IDX, false,
+                       false);
+  if (bus.mosi >= 0)
+    pinMatrixOutAttach(bus.mosi, h ? HSPID_OUT_IDX : VSPID_OUT_IDX, false,
+                       false);
+  return ESP_OK;
+}
+
+esp_err_t spi_bus_free(spi_host_device_t host) {
+  host::Node::Spi::Bus &bus = host::currentNode().spi.bus[host];
+  if (!bus.up)
+    return ESP_ERR_INVALID_STATE;
+  bus = host::Node::Spi::Bus();
+  return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host,
+                             const spi_device_interface_config_t *config,
+                             spi_device_handle_t *handle) {
+  host::Node &n = host::currentNode();
+  if (!config || !handle || config->clock_speed_hz <= 0 ||
+      !n.spi.bus[host].up)
+    return ESP_ERR_INVALID_ARG;
+  host::ShimAlloc shim;
+  spi_device_t *d = new spi_device_t();
+  d->node = &n;
+  d->host = host;
+  d->cfg = *config;
+  if (d->cfg.queue_size < 1)
+    d->cfg.queue_size = 1;
+  const uint32_t div =
+      (APB_HZ + (uint32_t)config->clock_speed_hz - 1) / config->clock_speed_hz;
+  d->hz = APB_HZ / (div ? div : 1);
+  *handle = d;
+  return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle) {
+  if (!handle)
+    return ESP_ERR_INVALID_ARG;
+  if (!handle->queue.empty())
+    return ESP_ERR_INVALID_STATE;
+  host::ShimAlloc shim;
+  delete handle;
+  return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle,
+                                 spi_transaction_t *trans, TickType_t) {
+  if (!handle || !trans)
+    return ESP_ERR_INVALID_ARG;
+  settle(handle);
+  // Results not yet collected count against the queue, as in the driver
+  if (handle->queue.size() >= (size_t)handle->cfg.queue_size)
+    return ESP_ERR_TIMEOUT;
+  host::ShimAlloc shim;
+  handle->queue.push_back({trans, reserveBus(handle, trans), false});
+  host::Node::Spi &spi = handle->node->spi;
+  if (handle->queue.size() > spi.maxQueued)
+    spi.maxQueued = handle->queue.size();
+  return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle,
+                                      spi_transaction_t **trans,
+                                      TickType_t wait) {
+  if (!handle || !trans)
+    return ESP_ERR_INVALID_ARG;
+  if (handle->queue.empty())
+    return ESP_ERR_TIMEOUT;
+  Pending &front = handle->queue.front();
+  if (front.doneNs > nowNs()) {
+    if (wait == 0)
+      return ESP_ERR_TIMEOUT;
+    waitUntil(*handle->node, front.doneNs);
+  }
+  settle(handle);
+  *trans = front.t;
+  host::ShimAlloc shim;
+  handle->queue.pop_front();
+  return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle,
+                                      spi_transaction_t *trans) {
+  if (!handle || !trans)
+    return ESP_ERR_INVALID_ARG;
+  if (!handle->queue.empty())
+    return ESP_ERR_INVALID_STATE;
+  // The CPU spins on the bus, behind anything other devices queued
+  waitUntil(*handle->node, reserveBus(handle, trans));
+  execute(handle, trans);
+  return ESP_OK;
+}
+
+esp_err_t spi_device_acquire_bus(spi_device_handle_t handle, TickType_t) {
+  return handle ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+void spi_device_release_bus(spi_device_handle_t) {}
+
+esp_err_t spi_device_get_actual_freq(spi_device_handle_t handle,
+                                     int *freqKhz) {
+  if (!handle || !freqKhz)
+    return ESP_ERR_INVALID_ARG;
+  *freqKhz = (int)(handle->hz / 1000);
+  return ESP_OK;
+}
@@ -0,0 +1,223 @@
+/*
+ * Host stand-in for the Arduino String class, backed by std::string.
+ * Covers the subset the LifeLine sketches use.
+ */
+
+#ifndef LIFELINE_HOST_WSTRING_H
+#define LIFELINE_HOST_WSTRING_H
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string>
+
+class String {
+public:
+  String() {}
+  String(const char *s) : s_(s ? s : "") {}
+  String(const std::string &s) : s_(s) {}
+  String(char c) : s_(1, c) {}
+  String(unsigned char v, unsigned char base = 10) { fromUnsigned(v, base); }
+  String(int v, unsigned char base = 10) { fromSigned(v, base); }
+  String(unsigned int v, unsigned char base = 10) { fromUnsigned(v, base); }
+  String(long v, unsigned char base = 10) { fromSigned(v, base); }
+  String(unsigned long v, unsigned char base = 10) { fromUnsigned(v, base); }
+  String(long long v, unsigned char base = 10) { fromSigned(v, base); }
+  String(unsigned long long v, unsigned char base = 10) {
+    fromUnsigned(v, base);
+  }
+  String(float v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+  String(double v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  bool isEmpty() const { return s_.empty(); }
+  const char *c_str() const { return s_.c_str(); }
+  const std::string &str() const { return s_; }
+  bool reserve(unsigned int n) {
+    s_.reserve(n);
+    return true;
+  }
+
+  char charAt(unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char &operator[](unsigned int i) { return s_[i]; }
+  void setCharAt(unsigned int i, char c) {
+    if (i < s_.size())
+      s_[i] = c;
+  }
+
+  String &operator=(const char *s) {
+    s_ = s ? s : "";
+    return *this;
+  }
+  String &operator+=(const String &o) {
+    s_ += o.s_;
+    return *this;
+  }
+  String &operator+=(const char *s) {
+    if (s)
+      s_ += s;
+    return *this;
+  }
+  String &operator+=(char c) {
+    s_ += c;
+    return *this;
+  }
+  template <typename T> String &operator+=(T v) { return *this += String(v); }
+  template <typename T> bool concat(T v) {
+    *this += v;
+    return true;
+  }
+
+  bool operator==(const String &o) const { return s_ == o.s_; }
+  bool operator==(const char *s) const { return s_ == (s ? s : ""); }
+  bool operator!=(const String &o) const { return s_ != o.s_; }
+  bool operator!=(const char *s) const { return !(*this == s); }
+  bool operator<(const String &o) const { return s_ < o.s_; }
+  bool equals(const String &o) const { return s_ == o.s_; }
+  bool equalsIgnoreCase(const String &o) const {
+    if (s_.size() != o.s_.size())
+      return false;
+    for (size_t i = 0; i < s_.size(); i++) {
+      if (tolower((unsigned char)s_[i]) != tolower((unsigned char)o.s_[i]))
+        return false;
+    }
+    return true;
+  }
+
+  int indexOf(char c, unsigned int from = 0) const {
+    const size_t p = s_.find(c, from);
+    return p == std::string::npos ? -1 : (int)p;
+  }
+  int indexOf(const String &o, unsigned int from = 0) const {
+    const size_t p = s_.find(o.s_, from);
+    return p == std::string::npos ? -1 : (int)p;
+  }
+  int lastIndexOf(char c) const {
+    const size_t p = s_.rfind(c);
+    return p == std::string::npos ? -1 : (int)p;
+  }
+  bool startsWith(const String &o) const {
+    return s_.compare(0, o.s_.size(), o.s_) == 0;
+  }
+  bool endsWith(const String &o) const {
+    return s_.size() >= o.s_.size() &&
+           s_.compare(s_.size() - o.s_.size(), o.s_.size(), o.s_) == 0;
+  }
+
+  String substring(unsigned int from) const {
+    return from < s_.size() ? String(s_.substr(from)) : String();
+  }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) {
+      const unsigned int t = from;
+      from = to;
+      to = t;
+    }
+    if (from >= s_.size())
+      return String();
+    return String(s_.substr(from, to - from));
+  }
+
+  void trim() {
+    const size_t b = s_.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) {
+      s_.clear();
+      return;
+    }
+    const size_t e = s_.find_last_not_of(" \t\r\n");
+    s_ = s_.substr(b, e - b + 1);
+  }
+  void toUpperCase() {
+    for (char &c : s_)
+      c = (char)toupper((unsigned char)c);
+  }
+  void toLowerCase() {
+    for (char &c : s_)
+      c = (char)tolower((unsigned char)c);
+  }
+  void replace(const String &from, const String &to) {
+    if (from.s_.empty())
+      return;
+    size_t p = 0;
+    while ((p = s_.find(from.s_, p)) != std::string::npos) {
+      s_.replace(p, from.s_.size(), to.s_);
+      p += to.s_.size();
+    }
+  }
+  void remove(unsigned int index, unsigned int count = (unsigned int)-1) {
+    if (index < s_.size())
+      s_.erase(index, count);
+  }
+
+  long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(s_.c_str(), nullptr); }
+  double toDouble() const { return strtod(s_.c_str(), nullptr); }
+
+  void getBytes(unsigned char *buf, unsigned int len) const {
+    if (!len)
+      return;
+    const size_t n = s_.size() < len - 1 ? s_.size() : len - 1;
+    s_.copy((char *)buf, n);
+    buf[n] = 0;
+  }
+  void toCharArray(char *buf, unsigned int len) const {
+    getBytes((unsigned char *)buf, len);
+  }
+
+private:
+  void fromSigned(long long v, unsigned char base) {
+    if (v < 0 && base == 10) {
+      fromUnsigned((unsigned long long)(-v), base);
+      s_.insert(s_.begin(), '-');
+    } else {
+      fromUnsigned((unsigned long long)v, base);
+    }
+  }
+  void fromUnsigned(unsigned long long v, unsigned char base) {
+    if (base < 2 || base > 36)
+      base = 10;
+    char buf[66];
+    char *p = buf + sizeof(buf) - 1;
+    *p = 0;
+    do {
+      const unsigned d = (unsigned)(v % base);
+      *--p = (char)(d < 10 ? '0' + d : 'A' + d - 10);
+      v /= base;
+    } while (v);
+    s_ = p;
+  }
+  void fromDouble(double v, unsigned int decimals) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    s_ = buf;
+  }
+
+  std::string s_;
+};
+
+inline String operator+(const String &a, const String &b) {
+  String r(a);
+  r += b;
+  return r;
+}
+inline String operator+(const String &a, const char *b) {
+  String r(a);
+  r += b;
+  return r;
+}
+inline String operator+(const char *a, const String &b) {
+  String r(a);
+  r += b;
+  return r;
+}
+template <typename T> String operator+(const String &a, T b) {
+  String r(a);
+  r += String(b);
+  return r;
+}
+inline bool operator==(const char *a, const String &b) { return b == a; }
+
+#endif // LIFELINE_HOST_WSTRING_H
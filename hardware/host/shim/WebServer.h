@@ -0,0 +1,56 @@
+/*
+ * Host stand-in for the ESP32 WebServer. handleClient() serves one queued
+ * Node::webQueue request per call and records the reply in
+ * Node::webResponses.
+ */
+
+#ifndef LIFELINE_HOST_WEBSERVER_H
+#define LIFELINE_HOST_WEBSERVER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#include <functional>
+
+typedef enum { HTTP_ANY, HTTP_GET, HTTP_POST, HTTP_PUT, HTTP_DELETE } HTTPMethod;
+
+class WebServer {
+public:
+  typedef std::function<void(void)> THandlerFunction;
+
+  explicit WebServer(int port = 80) : port_(port) {}
+
+  void begin() { running_ = true; }
+  void stop() { running_ = false; }
+  void close() { stop(); }
+  void handleClient();
+
+  void on(const String &uri, THandlerFunction handler) {
+    on(uri, HTTP_ANY, handler);
+  }
+  void on(const String &uri, HTTPMethod, THandlerFunction handler) {
+    routes_[uri.str()] = handler;
+  }
+  void onNotFound(THandlerFunction handler) { notFound_ = handler; }
+
+  String arg(const String &name);
+  bool hasArg(const String &name);
+  String uri() { return String(path_); }
+
+  void send(int code, const char *contentType = nullptr,
+            const String &content = String());
+  void send(int code, const String &contentType, const String &content) {
+    send(code, contentType.c_str(), content);
+  }
+  void sendHeader(const String &, const String &, bool = false) {}
+
+private:
+  int port_;
+  bool running_ = false;
+  std::map<std::string, THandlerFunction> routes_;
+  THandlerFunction notFound_;
+  std::string path_;
+  std::map<std::string, std::string> args_;
+};
+
+#endif // LIFELINE_HOST_WEBSERVER_H
@@ -0,0 +1,59 @@
+/*
+ * Host stand-in for the ESP32 WiFi class. Association completes
+ * Node::Wifi::associateMs after begin() when an AP with matching
+ * credentials is in range; Node::Wifi::outage drops the link.
+ */
+
+#ifndef LIFELINE_HOST_WIFI_H
+#define LIFELINE_HOST_WIFI_H
+
+#include <Arduino.h>
+
+typedef enum {
+  WL_NO_SHIELD = 255,
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA = 1,
+  WIFI_AP = 2,
+  WIFI_AP_STA = 3
+} wifi_mode_t;
+
+class WiFiClass {
+public:
+  bool mode(wifi_mode_t m);
+  wifi_mode_t getMode();
+  wl_status_t begin(const char *ssid, const char *passphrase = nullptr);
+  wl_status_t begin(const String &ssid, const String &passphrase) {
+    return begin(ssid.c_str(), passphrase.c_str());
+  }
+  bool disconnect(bool wifiOff = false, bool eraseAp = false);
+  bool reconnect();
+  wl_status_t status();
+  bool isConnected() { return status() == WL_CONNECTED; }
+  void setAutoReconnect(bool) {}
+  void setSleep(bool) {}
+  void setHostname(const char *) {}
+
+  IPAddress localIP();
+  String SSID();
+  int32_t RSSI();
+  String macAddress() { return String("24:6F:28:00:00:01"); }
+
+  bool softAP(const char *ssid, const char *passphrase = nullptr,
+              int channel = 1, int hidden = 0, int maxConnection = 4);
+  bool softAPdisconnect(bool wifiOff = false);
+  IPAddress softAPIP();
+};
+
+extern WiFiClass WiFi;
+
+#endif // LIFELINE_HOST_WIFI_H
@@ -0,0 +1,32 @@
+/*
+ * Host stand-in for the ESP32 TwoWire (I2C). Bus traffic is not modelled;
+ * device shims (Adafruit_MPU6050) read the current node directly.
+ */
+
+#ifndef LIFELINE_HOST_WIRE_H
+#define LIFELINE_HOST_WIRE_H
+
+#include <Arduino.h>
+
+class TwoWire : public Stream {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) {
+    (void)sda;
+    (void)scl;
+    (void)frequency;
+    return true;
+  }
+  void setClock(uint32_t) {}
+  void beginTransmission(uint8_t) {}
+  uint8_t endTransmission(bool = true) { return 0; }
+  uint8_t requestFrom(uint8_t, uint8_t, bool = true) { return 0; }
+  size_t write(uint8_t) override { return 1; }
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+};
+
+extern TwoWire Wire;
+
+#endif // LIFELINE_HOST_WIRE_H
@@ -0,0 +1,110 @@
+/*
+ * Host stand-in for the ESP-IDF SPI master driver (driver/spi_master.h).
+ *
+ * Transactions occupy their bus for (bits / clock) of virtual time, one
+ * after another, and complete in queue order. Nothing is sent when they are
+ * queued: a transaction is executed (pre_cb, bytes to the ST7789 model on
+ * host::Node::panel, rx filled, post_cb) once the virtual clock has passed
+ * its end and the caller looks at the queue again. get_trans_result() waits
+ * for the oldest one by advancing the clock, counted as node.spi.stallUs.
+ * So a buffer the caller rewrites before it has the result back is what
+ * the bus sends, as on the chip.
+ */
+
+#ifndef LIFELINE_HOST_SPI_MASTER_H
+#define LIFELINE_HOST_SPI_MASTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+typedef enum {
+  SPI1_HOST = 0,
+  SPI2_HOST = 1,
+  SPI3_HOST = 2,
+} spi_host_device_t;
+
+#define HSPI_HOST SPI2_HOST
+#define VSPI_HOST SPI3_HOST
+#define SPI_DMA_CH_AUTO 3
+
+typedef struct {
+  int mosi_io_num;
+  int miso_io_num;
+  int sclk_io_num;
+  int quadwp_io_num;
+  int quadhd_io_num;
+  int max_transfer_sz;
+  uint32_t flags;
+  int intr_flags;
+} spi_bus_config_t;
+
+#define SPI_DEVICE_HALFDUPLEX (1 << 4)
+#define SPI_DEVICE_NO_DUMMY (1 << 6)
+
+#define SPI_TRANS_USE_RXDATA (1 << 2)
+#define SPI_TRANS_USE_TXDATA (1 << 3)
+#define SPI_TRANS_CS_KEEP_ACTIVE (1 << 8)
+
+typedef struct spi_transaction_t spi_transaction_t;
+typedef void (*transaction_cb_t)(spi_transaction_t *trans);
+
+typedef struct {
+  uint8_t command_bits;
+  uint8_t address_bits;
+  uint8_t dummy_bits;
+  uint8_t mode;
+  uint16_t duty_cycle_pos;
+  uint16_t cs_ena_pretrans;
+  uint8_t cs_ena_posttrans;
+  int clock_speed_hz;
+  int input_delay_ns;
+  int spics_io_num;
+  uint32_t flags;
+  int queue_size;
+  transaction_cb_t pre_cb;
+  transaction_cb_t post_cb;
+} spi_device_interface_config_t;
+
+struct spi_transaction_t {
+  uint32_t flags;
+  uint16_t cmd;
+  uint64_t addr;
+  size_t length;   // Bits sent
+  size_t rxlength; // Bits received (half duplex)
+  void *user;
+  union {
+    const void *tx_buffer;
+    uint8_t tx_data[4];
+  };
+  union {
+    void *rx_buffer;
+    uint8_t rx_data[4];
+  };
+};
+
+typedef struct spi_device_t *spi_device_handle_t;
+
+esp_err_t spi_bus_initialize(spi_host_device_t host,
+                             const spi_bus_config_t *config, int dmaChan);
+esp_err_t spi_bus_free(spi_host_device_t host);
+esp_err_t spi_bus_add_device(spi_host_device_t host,
+                             const spi_device_interface_config_t *config,
+                             spi_device_handle_t *handle);
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle);
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle,
+                                 spi_transaction_t *trans, TickType_t wait);
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle,
+                                      spi_transaction_t **trans,
+                                      TickType_t wait);
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle,
+                                      spi_transaction_t *trans);
+esp_err_t spi_device_acquire_bus(spi_device_handle_t handle, TickType_t wait);
+void spi_device_release_bus(spi_device_handle_t handle);
+/** Clock the device actually runs at: APB (80 MHz) over a whole divider. */
+esp_err_t spi_device_get_actual_freq(spi_device_handle_t handle,
+                                     int *freqKhz);
+
+#endif // LIFELINE_HOST_SPI_MASTER_H
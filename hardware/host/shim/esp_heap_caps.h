@@ -0,0 +1,28 @@
+/*
+ * Host stand-in for the ESP-IDF capability allocator. Every capability is
+ * the plain heap; the allocation counts on the node like any other.
+ */
+
+#ifndef LIFELINE_HOST_ESP_HEAP_CAPS_H
+#define LIFELINE_HOST_ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+inline void *heap_caps_malloc(size_t size, uint32_t) { return malloc(size); }
+
+inline void *heap_caps_aligned_alloc(size_t alignment, size_t size,
+                                     uint32_t) {
+  return aligned_alloc(alignment, (size + alignment - 1) / alignment *
+                                      alignment);
+}
+
+inline void heap_caps_free(void *ptr) { free(ptr); }
+
+#endif // LIFELINE_HOST_ESP_HEAP_CAPS_H
@@ -0,0 +1,25 @@
+/*
+ * Host stand-in for the FreeRTOS base types and macros the firmware uses.
+ * One tick is one millisecond, as in the Arduino-ESP32 build.
+ */
+
+#ifndef LIFELINE_HOST_FREERTOS_H
+#define LIFELINE_HOST_FREERTOS_H
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portYIELD_FROM_ISR(...) ((void)0)
+
+#endif // LIFELINE_HOST_FREERTOS_H
@@ -0,0 +1,25 @@
+/*
+ * Host stand-in for FreeRTOS direct-to-task notifications. A task is a host
+ * thread: its handle is created on first use and notifications wait on a
+ * condition variable. Ticks here are wall-clock milliseconds, not the
+ * virtual clock. Only threads block on notifications, and the virtual clock
+ * belongs to the sketch loop.
+ */
+
+#ifndef LIFELINE_HOST_FREERTOS_TASK_H
+#define LIFELINE_HOST_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef struct HostTask *TaskHandle_t;
+
+/** The calling thread's task (stable for the thread's lifetime). */
+TaskHandle_t xTaskGetCurrentTaskHandle();
+TickType_t xTaskGetTickCount();
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityWoken);
+/** Wait for the count to be non-zero; returns it (then cleared or decremented). */
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait);
+
+#endif // LIFELINE_HOST_FREERTOS_TASK_H
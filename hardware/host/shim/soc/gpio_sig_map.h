@@ -0,0 +1,17 @@
+/*
+ * Host stand-in for the ESP32 GPIO matrix signal numbers (the SPI outputs
+ * the shim routes; see pinMatrixOutAttach()).
+ */
+
+#ifndef LIFELINE_HOST_GPIO_SIG_MAP_H
+#define LIFELINE_HOST_GPIO_SIG_MAP_H
+
+#define HSPICLK_OUT_IDX 8
+#define HSPIQ_OUT_IDX 9
+#define HSPID_OUT_IDX 10
+#define VSPICLK_OUT_IDX 63
+#define VSPIQ_OUT_IDX 64
+#define VSPID_OUT_IDX 65
+#define SIG_GPIO_OUT_IDX 256 // Plain GPIO output, no peripheral
+
+#endif // LIFELINE_HOST_GPIO_SIG_MAP_H
@@ -0,0 +1,19 @@
+/*
+ * Host stand-in for the ESP32 register access macros. Only the GPIO output
+ * set/clear registers are modelled; they drive the current node's pins.
+ */
+
+#ifndef LIFELINE_HOST_SOC_H
+#define LIFELINE_HOST_SOC_H
+
+#include <stdint.h>
+
+namespace host {
+void regWrite(uint32_t addr, uint32_t value);
+uint32_t regRead(uint32_t addr);
+} // namespace host
+
+#define REG_WRITE(addr, val) ::host::regWrite((uint32_t)(addr), (uint32_t)(val))
+#define REG_READ(addr) ::host::regRead((uint32_t)(addr))
+
+#endif // LIFELINE_HOST_SOC_H
@@ -0,0 +1,13 @@
+/*
+ * Host stand-in for the SoC capability macros. The shim models an
+ * ESP32-S3, so the LCD_CAM i80 bus is there (node.lcd.present turns it off
+ * at run time).
+ */
+
+#ifndef LIFELINE_HOST_SOC_CAPS_H
+#define LIFELINE_HOST_SOC_CAPS_H
+
+#define SOC_LCD_I80_SUPPORTED 1
+#define SOC_LCD_I80_BUS_WIDTH 16
+
+#endif // LIFELINE_HOST_SOC_CAPS_H
@@ -0,0 +1,250 @@
+/*
+ * LifelineCore's lock-free structures under real threads. Threads stand in
+ * for the contexts on the board (LoRa callback, loop task, the other core).
+ * The same tests are built a second time with -fsanitize=thread when the
+ * compiler supports it (the ".tsan" tests in ctest).
+ */
+
+#include <Arduino.h>
+#include <LifelineCore.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace lifeline;
+
+namespace {
+
+const int THREADS = 4;
+const int ROUNDS = 20000;
+
+/** Block whose contents show whether two owners ever shared it. */
+struct Packet {
+  uint32_t owner;
+  uint32_t round;
+  uint8_t payload[24];
+
+  void stamp(uint32_t who, uint32_t r) {
+    owner = who;
+    round = r;
+    memset(payload, (int)(who ^ r) & 0xFF, sizeof(payload));
+  }
+  bool intact(uint32_t who, uint32_t r) const {
+    if (owner != who || round != r)
+      return false;
+    for (uint8_t b : payload) {
+      if (b != ((who ^ r) & 0xFF))
+        return false;
+    }
+    return true;
+  }
+};
+
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                               ObjectPool.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(PoolStress, ContendedTakeAndReturnNeverSharesABlock) {
+  static ObjectPool<Packet, 16> pool;
+  std::atomic<int> corrupt{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS; t++) {
+    threads.emplace_back([&, t] {
+      Packet *held[3] = {};
+      for (int r = 0; r < ROUNDS; r++) {
+        for (Packet *&p : held) {
+          p = pool.create();
+          if (p)
+            p->stamp((uint32_t)t, (uint32_t)r);
+        }
+        std::this_thread::yield();
+        for (Packet *&p : held) {
+          if (p && !p->intact((uint32_t)t, (uint32_t)r))
+            corrupt++;
+          pool.destroy(p);
+          p = nullptr;
+        }
+      }
+    });
+  }
+  for (std::thread &t : threads)
+    t.join();
+
+  EXPECT_EQ(0, corrupt.load());
+  EXPECT_EQ(0u, pool.inUse());
+  EXPECT_LE(pool.highWater(), 12u);
+  // The free list still holds every block exactly once
+  std::set<void *> blocks;
+  while (void *b = pool.allocate())
+    blocks.insert(b);
+  EXPECT_EQ(16u, blocks.size());
+}
+
+TEST(PoolStress, BlocksHandedFromProducerToConsumer) {
+  // LoRa callback fills a packet, the loop task consumes and frees it
+  static ObjectPool<Packet, 8> pool;
+  static std::atomic<Packet *> mailbox[4];
+  const uint32_t total = ROUNDS;
+  std::atomic<uint32_t> received{0};
+  std::atomic<int> corrupt{0};
+
+  std::thread producer([&] {
+    uint32_t sent = 0;
+    while (sent < total) {
+      Packet *p = pool.create();
+      if (!p) {
+        std::this_thread::yield(); // Pool dry: the consumer is behind
+        continue;
+      }
+      p->stamp(1, sent);
+      Packet *expected = nullptr;
+      while (!mailbox[sent % 4].compare_exchange_weak(
+          expected, p, std::memory_order_release, std::memory_order_relaxed)) {
+        expected = nullptr;
+        std::this_thread::yield();
+      }
+      sent++;
+    }
+  });
+  std::thread consumer([&] {
+    uint32_t next = 0;
+    while (next < total) {
+      Packet *p = mailbox[next % 4].exchange(nullptr, std::memory_order_acquire);
+      if (!p) {
+        std::this_thread::yield();
+        continue;
+      }
+      if (!p->intact(1, next))
+        corrupt++;
+      pool.destroy(p);
+      next++;
+      received++;
+    }
+  });
+  producer.join();
+  consumer.join();
+
+  EXPECT_EQ(total, received.load());
+  EXPECT_EQ(0, corrupt.load());
+  EXPECT_EQ(0u, pool.inUse());
+  EXPECT_LE(pool.highWater(), 8u);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                               RingQueue.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+/** Producers push (id << 24 | n); the consumer checks per-producer order. */
+template <typename Q> void stressQueue(Q &q, int producers) {
+  const uint32_t perProducer = ROUNDS;
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; p++) {
+    threads.emplace_back([&, p] {
+      for (uint32_t n = 0; n < perProducer; n++) {
+        while (!q.push(((uint32_t)p << 24) | n))
+          std::this_thread::yield();
+      }
+    });
+  }
+  std::vector<uint32_t> next(producers, 0);
+  uint32_t received = 0, outOfOrder = 0;
+  while (received < perProducer * producers) {
+    uint32_t v;
+    if (!q.pop(v)) {
+      std::this_thread::yield();
+      continue;
+    }
+    const uint32_t p = v >> 24;
+    if ((v & 0xFFFFFF) != next[p])
+      outOfOrder++;
+    next[p] = (v & 0xFFFFFF) + 1;
+    received++;
+  }
+  for (std::thread &t : threads)
+    t.join();
+  EXPECT_EQ(0u, outOfOrder);
+  for (int p = 0; p < producers; p++)
+    EXPECT_EQ(perProducer, next[p]);
+  EXPECT_TRUE(q.empty());
+}
+
+} // namespace
+
+TEST(QueueStress, SpscKeepsOrderUnderContention) {
+  static SpscQueue<uint32_t, 16> q;
+  stressQueue(q, 1);
+}
+
+TEST(QueueStress, MpscKeepsEachProducersOrder) {
+  static MpscQueue<uint32_t, 16> q;
+  stressQueue(q, THREADS);
+}
+
+TEST(QueueStress, PooledRecordsThroughMpsc) {
+  // Radio and serial hand pooled records to the uplink worker
+  static ObjectPool<Packet, 8> pool;
+  static MpscQueue<Packet *, 8> q;
+  std::atomic<int> corrupt{0};
+  std::vector<std::thread> producers;
+  for (int p = 0; p < 2; p++) {
+    producers.emplace_back([&, p] {
+      for (uint32_t n = 0; n < (uint32_t)ROUNDS; n++) {
+        Packet *rec;
+        while (!(rec = pool.create()))
+          std::this_thread::yield();
+        rec->stamp((uint32_t)p, n);
+        while (!q.push(rec))
+          std::this_thread::yield();
+      }
+    });
+  }
+  uint32_t next[2] = {0, 0};
+  for (uint32_t got = 0; got < 2u * ROUNDS;) {
+    Packet *rec;
+    if (!q.pop(rec)) {
+      std::this_thread::yield();
+      continue;
+    }
+    if (!rec->intact(rec->owner, next[rec->owner]++))
+      corrupt++;
+    pool.destroy(rec);
+    got++;
+  }
+  for (std::thread &t : producers)
+    t.join();
+  EXPECT_EQ(0, corrupt.load());
+  EXPECT_EQ(0u, pool.inUse());
+}
+
+TEST(QueueStress, BlockingPopWakesOnNotification) {
+  static NotifyingQueue<MpscQueue<uint32_t, 8>> q;
+  q.setConsumer(xTaskGetCurrentTaskHandle());
+  std::thread producer([] {
+    for (uint32_t n = 0; n < 200; n++) {
+      while (!q.push(n))
+        std::this_thread::yield();
+      if (n % 50 == 0) // Let the consumer fall asleep now and then
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+  });
+  uint32_t got = 0, v;
+  while (got < 200 && q.pop(v, 2000)) {
+    EXPECT_EQ(got, v);
+    got++;
+  }
+  producer.join();
+  EXPECT_EQ(200u, got);
+
+  // Nothing pushed: the timeout is honoured
+  const TickType_t start = xTaskGetTickCount();
+  EXPECT_FALSE(q.pop(v, 20));
+  EXPECT_GE(xTaskGetTickCount() - start, 20u);
+}
@@ -0,0 +1,1977 @@
+/*
+ * LifelineCore on the host: the pure helpers and the classes that read the
+ * clock or the ADC through the shim.
+ */
+
+#include <Adafruit_ST7789.h>
+#include <Arduino.h>
+#include <I80Panel.h>
+#include <LifelineCore.h>
+#include <LoRa.h>
+#include <ScreenCache.h>
+#include <St7789Dma.h>
+#include <gtest/gtest.h>
+
+#include <limits.h>
+#include <string.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace lifeline;
+
+namespace {
+
+/** Raw 12-bit count that the shim ADC path turns back into batteryMv. */
+int rawForBattery(uint16_t batteryMv, float divider = 2.0f) {
+  return (int)((batteryMv / divider) * 4095.0f / 3300.0f + 0.5f);
+}
+
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              LatencyBudget.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(TimeOnAir, MatchesSemtechCalculator) {
+  // 20 bytes, CR 4/5, 8 symbol preamble, explicit header, CRC on
+  EXPECT_EQ(56576u, loraTimeOnAirUs(20, 7, 125000));
+  // SF12/125 kHz switches on low data rate optimisation
+  EXPECT_EQ(1318912u, loraTimeOnAirUs(20, 12, 125000));
+  EXPECT_LT(loraTimeOnAirUs(20, 7, 250000), loraTimeOnAirUs(20, 7, 125000));
+}
+
+TEST(FrameTrailer, FindsFieldsInAnyOrder) {
+  long v = 0;
+  EXPECT_TRUE(frameTrailerField(";k=412;s=7", 'k', v));
+  EXPECT_EQ(412, v);
+  EXPECT_TRUE(frameTrailerField(";k=412;s=7", 's', v));
+  EXPECT_EQ(7, v);
+  EXPECT_FALSE(frameTrailerField(";k=412;s=7", 'x', v));
+  EXPECT_FALSE(frameTrailerField("", 'k', v));
+  EXPECT_FALSE(frameTrailerField(nullptr, 'k', v));
+}
+
+TEST(LatencyRecorder, NearestRankPercentiles) {
+  LatencyRecorder<16> rec;
+  EXPECT_EQ(0u, rec.percentile(LAT_AIR, 50));
+  for (uint32_t us = 1; us <= 10; us++)
+    rec.record(LAT_AIR, us * 1000);
+  EXPECT_EQ(10u, rec.count(LAT_AIR));
+  EXPECT_EQ(5000u, rec.percentile(LAT_AIR, 50));
+  EXPECT_EQ(9000u, rec.percentile(LAT_AIR, 90));
+  EXPECT_EQ(10000u, rec.percentile(LAT_AIR, 99));
+  EXPECT_EQ(1000u, rec.percentile(LAT_AIR, 0));
+}
+
+TEST(LatencyRecorder, WindowKeepsNewestSamples) {
+  LatencyRecorder<4> rec;
+  for (uint32_t us = 1; us <= 8; us++)
+    rec.record(LAT_RX_PARSE, us);
+  EXPECT_EQ(4u, rec.count(LAT_RX_PARSE));
+  EXPECT_EQ(5u, rec.percentile(LAT_RX_PARSE, 1));
+  EXPECT_EQ(8u, rec.percentile(LAT_RX_PARSE, 100));
+}
+
+TEST(LatencyRecorder, TraceFillsEveryStage) {
+  LatencyTrace t;
+  t.begin(1000000, true);
+  t.txUiMs = 120;
+  t.airUs = 56576;
+  t.parsedUs = 1000050;
+  t.displayedUs = 1040050;
+  t.uplinkSentUs = 1040100;
+  t.uplinkAckUs = 1080100;
+
+  LatencyRecorder<8> rec;
+  rec.recordTrace(t);
+  EXPECT_EQ(50u, rec.percentile(LAT_RX_PARSE, 50));
+  EXPECT_EQ(40000u, rec.percentile(LAT_RX_DISPLAY, 50));
+  EXPECT_EQ(40000u, rec.percentile(LAT_UPLINK_ACK, 50));
+  EXPECT_EQ(120000u + 56576u + 40050u, rec.percentile(LAT_KEY_TO_SCREEN, 50));
+  EXPECT_EQ(120000u + 56576u + 80100u, rec.percentile(LAT_KEY_TO_ACK, 50));
+  EXPECT_EQ(57u, t.airMs());
+  EXPECT_EQ(40u, t.gatewayMs());
+}
+
+TEST(LatencyRecorder, SerialPacketsSkipAirStages) {
+  LatencyTrace t;
+  t.begin(500, false);
+  t.txUiMs = 120;
+  t.parsedUs = 600;
+  LatencyRecorder<8> rec;
+  rec.recordTrace(t);
+  EXPECT_EQ(0u, rec.count(LAT_AIR));
+  EXPECT_EQ(0u, rec.count(LAT_TX_UI));
+  EXPECT_EQ(1u, rec.count(LAT_RX_PARSE));
+}
+
+TEST(FrameTrailer, StopsAtLength) {
+  long v = -1;
+  const char buf[] = ";s=12345";
+  EXPECT_TRUE(frameTrailerField(buf, 5, 's', v)); // Sees ";s=12" only
+  EXPECT_EQ(12, v);
+  EXPECT_FALSE(frameTrailerField(buf, 2, 's', v));
+  EXPECT_TRUE(frameTrailerField(";s=-4", 5, 's', v));
+  EXPECT_EQ(-4, v);
+  EXPECT_TRUE(frameTrailerField(";s=99999999999999999999999", 26, 's', v));
+  EXPECT_EQ(LONG_MAX, v);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                               AlertFrame.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+const uint8_t STRICT_FLAGS = FRAME_REQUIRE_TX | FRAME_STRICT_CODE;
+
+FrameType parse(const std::string &s, AlertFrame &f, uint8_t flags = 0) {
+  return parseFrame(s.data(), s.size(), f, flags);
+}
+
+} // namespace
+
+TEST(AlertFrame, ParsesAlertWithTrailer) {
+  AlertFrame f;
+  ASSERT_EQ(FRAME_ALERT, parse("TX003,A;k=412;s=7", f));
+  EXPECT_EQ(3, f.deviceId);
+  EXPECT_EQ(0, f.alertIndex);
+  EXPECT_EQ(412, f.txUiMs);
+  EXPECT_EQ(7, f.seq);
+  EXPECT_FALSE(f.codeDefaulted);
+  EXPECT_EQ(10, f.trailerLen);
+}
+
+TEST(AlertFrame, CodeForms) {
+  AlertFrame f;
+  ASSERT_EQ(FRAME_ALERT, parse("TX12,O", f));
+  EXPECT_EQ(14, f.alertIndex);
+  ASSERT_EQ(FRAME_ALERT, parse("TX12,c", f));
+  EXPECT_EQ(2, f.alertIndex);
+  ASSERT_EQ(FRAME_ALERT, parse("TX12, 11 ", f));
+  EXPECT_EQ(11, f.alertIndex);
+  EXPECT_EQ(-1, f.seq);
+  EXPECT_EQ(-1, f.txUiMs);
+}
+
+TEST(AlertFrame, ReceiverPolicyIsLenient) {
+  AlertFrame f;
+  ASSERT_EQ(FRAME_ALERT, parse("5,B", f, FRAME_RX_FLAGS)); // No TX prefix
+  EXPECT_EQ(5, f.deviceId);
+  EXPECT_EQ(1, f.alertIndex);
+
+  for (const char *bad : {"TX5,P", "TX5,15", "TX5,ZZ", "TX5,", "TX5,-1"}) {
+    ASSERT_EQ(FRAME_ALERT, parse(bad, f, FRAME_RX_FLAGS)) << bad;
+    EXPECT_EQ(FRAME_ALERT_CODES - 1, f.alertIndex) << bad;
+    EXPECT_TRUE(f.codeDefaulted) << bad;
+  }
+}
+
+TEST(AlertFrame, StrictFlagsRejectBareFramesAndUnknownCodes) {
+  AlertFrame f;
+  EXPECT_EQ(FRAME_INVALID, parse("5,B", f, STRICT_FLAGS));
+  EXPECT_EQ(FRAME_NO_PREFIX, f.error);
+  EXPECT_EQ(FRAME_INVALID, parse("TX5,P", f, STRICT_FLAGS));
+  EXPECT_EQ(FRAME_BAD_CODE, f.error);
+  EXPECT_EQ(FRAME_ALERT, parse("TX5,B;s=1", f, STRICT_FLAGS));
+}
+
+TEST(AlertFrame, Heartbeat) {
+  const std::string hb = "HB007;i=123;l=40;u=9;v=3900;b=76";
+  AlertFrame f; // trailer points into hb
+  ASSERT_EQ(FRAME_HEARTBEAT, parse(hb, f, STRICT_FLAGS));
+  EXPECT_EQ(7, f.deviceId);
+  EXPECT_EQ(123, f.field('i'));
+  EXPECT_EQ(40, f.field('l'));
+  EXPECT_EQ(76, f.field('b'));
+  EXPECT_EQ(-1, f.field('x'));
+}
+
+TEST(AlertFrame, RejectsMalformed) {
+  AlertFrame f;
+  EXPECT_EQ(FRAME_INVALID, parseFrame(nullptr, 0, f));
+  EXPECT_EQ(FRAME_EMPTY, f.error);
+  EXPECT_EQ(FRAME_INVALID, parse("TX003A", f));
+  EXPECT_EQ(FRAME_NO_COMMA, f.error);
+  EXPECT_EQ(FRAME_INVALID, parse("TX,A", f));
+  EXPECT_EQ(FRAME_BAD_DEVICE, f.error);
+  EXPECT_EQ(FRAME_INVALID, parse("TXabc,A", f));
+  EXPECT_EQ(FRAME_BAD_DEVICE, f.error);
+  EXPECT_EQ(FRAME_INVALID, parse("TX65536,A", f));
+  EXPECT_EQ(FRAME_BAD_DEVICE, f.error);
+  EXPECT_EQ(FRAME_INVALID, parse("TX3;s=1,A", f)); // Comma after trailer
+  EXPECT_EQ(FRAME_NO_COMMA, f.error);
+  EXPECT_EQ(FRAME_INVALID, parse(std::string(FRAME_MAX_LEN + 1, '1'), f));
+  EXPECT_EQ(FRAME_TOO_LONG, f.error);
+  EXPECT_EQ(FRAME_INVALID, parse(std::string("TX3\0,A", 6), f));
+}
+
+TEST(AlertFrame, NeverReadsPastLength) {
+  const std::string full = "TX003,A;s=77";
+  AlertFrame f;
+  for (size_t n = 0; n <= full.size(); n++) {
+    // Exact-size heap copy so a sanitizer build flags any overread
+    std::vector<char> buf(full.begin(), full.begin() + n);
+    parseFrame(buf.data(), buf.size(), f);
+  }
+  ASSERT_EQ(FRAME_ALERT, f.type);
+  EXPECT_EQ(77, f.seq);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              AlertJournal.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(Crc32, KnownVector) {
+  EXPECT_EQ(0xCBF43926u, crc32("123456789", 9));
+  EXPECT_EQ(0u, crc32("", 0));
+}
+
+TEST(AlertJournal, ColdBootStartsClean) {
+  RtcJournal rtc;
+  memset(&rtc, 0xA5, sizeof(rtc)); // RTC_NOINIT garbage after power-on
+  AlertJournal j(rtc);
+  EXPECT_EQ(RESET_POWERON, j.begin(RESET_POWERON));
+  EXPECT_EQ(1u, j.boots());
+  EXPECT_EQ(1u, j.resets(RESET_POWERON));
+  EXPECT_FALSE(j.pending());
+  EXPECT_FALSE(j.recovered());
+}
+
+TEST(AlertJournal, ArmedAlertResumesAfterReset) {
+  RtcJournal rtc = {};
+  {
+    AlertJournal j(rtc);
+    j.begin(RESET_POWERON);
+    const uint16_t seq = j.arm(5);
+    EXPECT_EQ(seq, j.seq());
+    EXPECT_TRUE(j.pending());
+  }
+  AlertJournal j(rtc);
+  j.begin(4); // panic
+  EXPECT_TRUE(j.recovered());
+  EXPECT_FALSE(j.abandoned());
+  EXPECT_TRUE(j.pending());
+  EXPECT_EQ(5, j.pendingAlert());
+  EXPECT_EQ(1, j.resumes());
+  EXPECT_STREQ("panic", j.resetReasonName());
+
+  const uint16_t seq = j.seq();
+  j.sent();
+  EXPECT_FALSE(j.pending());
+  EXPECT_EQ((uint16_t)(seq + 1), j.arm(2));
+}
+
+TEST(AlertJournal, GivesUpAfterRepeatedCrashes) {
+  RtcJournal rtc = {};
+  {
+    AlertJournal j(rtc);
+    j.begin(RESET_POWERON);
+    j.arm(1);
+  }
+  for (int boot = 0; boot < JOURNAL_MAX_RESUMES; boot++) {
+    AlertJournal j(rtc);
+    j.begin(4);
+    ASSERT_TRUE(j.pending());
+  }
+  AlertJournal j(rtc);
+  j.begin(4);
+  EXPECT_TRUE(j.recovered());
+  EXPECT_TRUE(j.abandoned());
+  EXPECT_FALSE(j.pending());
+}
+
+TEST(AlertJournal, CorruptAlertBlockIsDiscarded) {
+  RtcJournal rtc = {};
+  {
+    AlertJournal j(rtc);
+    j.begin(RESET_POWERON);
+    j.arm(3);
+  }
+  rtc.alert.alertIndex ^= 0x40;
+  AlertJournal j(rtc);
+  j.begin(4);
+  EXPECT_FALSE(j.pending());
+  EXPECT_FALSE(j.recovered());
+  EXPECT_EQ(2u, j.boots());
+}
+
+TEST(DuplicateFilter, DropsRepeatsInsideWindow) {
+  DuplicateFilter f;
+  EXPECT_FALSE(f.seen(3, 7, 1000));
+  EXPECT_TRUE(f.seen(3, 7, 2000));
+  EXPECT_FALSE(f.seen(4, 7, 2000));
+  EXPECT_FALSE(f.seen(3, 8, 2000));
+  EXPECT_EQ(1u, f.dropped());
+  EXPECT_FALSE(f.seen(3, 7, 1000 + DEDUPE_WINDOW_MS));
+}
+
+TEST(DuplicateFilter, ForgetsOldestSlot) {
+  DuplicateFilter f;
+  for (uint16_t s = 0; s < DEDUPE_SLOTS; s++)
+    f.seen(1, s, 0);
+  f.seen(1, 1000, 0);
+  EXPECT_FALSE(f.seen(1, 0, 0));
+  EXPECT_TRUE(f.seen(1, DEDUPE_SLOTS - 1, 0));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                               AlertInbox.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(AlertInbox, MostUrgentThenOldestOnTop) {
+  AlertInbox<8> inbox;
+  const uint32_t other = inbox.push(4, 14, 4, -90, 1000);
+  const uint32_t food = inbox.push(5, 6, 2, -80, 2000);
+  const uint32_t sos = inbox.push(3, 0, 0, -70, 3000);
+  const uint32_t medical = inbox.push(6, 1, 0, -60, 4000);
+  EXPECT_EQ(sos, inbox.top()->id);
+
+  InboxAlert rows[8];
+  ASSERT_EQ(4, inbox.page(rows, 0, 8));
+  EXPECT_EQ(sos, rows[0].id);
+  EXPECT_EQ(medical, rows[1].id);
+  EXPECT_EQ(food, rows[2].id);
+  EXPECT_EQ(other, rows[3].id);
+  ASSERT_EQ(1, inbox.page(rows, 3, 2)); // Last page
+  EXPECT_EQ(other, rows[0].id);
+  EXPECT_EQ(0, inbox.page(rows, 4, 2));
+
+  // Acknowledging the top brings the next critical one up
+  EXPECT_TRUE(inbox.acknowledge(sos));
+  EXPECT_FALSE(inbox.acknowledge(sos));
+  EXPECT_EQ(medical, inbox.top()->id);
+  EXPECT_TRUE(inbox.acknowledge(food)); // From the middle
+  ASSERT_EQ(2, inbox.page(rows, 0, 8));
+  EXPECT_EQ(medical, rows[0].id);
+  EXPECT_EQ(other, rows[1].id);
+  EXPECT_EQ(1, inbox.countAtMost(1));
+  EXPECT_EQ(2u, inbox.stats().acknowledged);
+}
+
+TEST(AlertInbox, RepeatsAreCountedOnTheOpenAlert) {
+  AlertInbox<4> inbox;
+  const uint32_t id = inbox.push(3, 0, 0, -70, 1000);
+  const uint32_t v = inbox.version();
+  EXPECT_EQ(id, inbox.push(3, 0, 0, -65, 5000));
+  EXPECT_NE(v, inbox.version());
+  EXPECT_EQ(1, inbox.size());
+  EXPECT_EQ(1, inbox.top()->repeats);
+  EXPECT_EQ(-65, inbox.top()->rssi);
+  EXPECT_EQ(1000u, inbox.top()->receivedMs);
+  EXPECT_NE(id, inbox.push(3, 1, 0, -70, 6000)); // Another code: its own
+  EXPECT_EQ(1u, inbox.stats().merged);
+
+  // Closed: the next one is a new alert again
+  inbox.acknowledge(id);
+  EXPECT_NE(id, inbox.push(3, 0, 0, -70, 7000));
+}
+
+TEST(AlertInbox, AFullInboxKeepsTheMostUrgent) {
+  AlertInbox<4> inbox;
+  for (uint16_t d = 1; d <= 4; d++)
+    inbox.push(d, 14, 4, -90, d * 1000); // OTHER, neutral
+  EXPECT_EQ(0u, inbox.push(9, 14, 4, -90, 9000)); // No more urgent: not kept
+  const uint32_t sos = inbox.push(7, 0, 0, -70, 10000);
+  EXPECT_NE(0u, sos);
+  EXPECT_EQ(4, inbox.size());
+  EXPECT_EQ(sos, inbox.top()->id);
+  EXPECT_EQ(2u, inbox.dropped());
+  EXPECT_EQ(4, inbox.stats().peak);
+
+  // The newest of the least urgent went: device 4
+  InboxAlert rows[4];
+  ASSERT_EQ(4, inbox.page(rows, 0, 4));
+  EXPECT_EQ(1, rows[1].deviceId);
+  EXPECT_EQ(2, rows[2].deviceId);
+  EXPECT_EQ(3, rows[3].deviceId);
+
+  // Both losses are named, newest first
+  InboxLost gone[4];
+  ASSERT_EQ(2, inbox.lost(gone, 4));
+  EXPECT_EQ(4, gone[0].deviceId);
+  EXPECT_EQ(10000u, gone[0].lostMs);
+  EXPECT_EQ(9, gone[1].deviceId);
+  EXPECT_EQ(14, gone[1].alertIndex);
+}
+
+TEST(AlertInbox, CriticalAlertsGoOnlyWhenAllAreCritical) {
+  AlertInbox<4> inbox;
+  inbox.push(1, 0, 0, -90, 1000);
+  for (uint16_t d = 2; d <= 4; d++)
+    inbox.push(d, 5, 1, -90, d * 1000);
+  for (uint16_t d = 5; d <= 7; d++)
+    EXPECT_NE(0u, inbox.push(d, 0, 0, -90, d * 1000));
+  EXPECT_EQ(4, inbox.countAtMost(0));
+
+  // Full of critical alerts: the next critical one is the one lost
+  EXPECT_EQ(0u, inbox.push(8, 0, 0, -90, 8000));
+  InboxLost gone[ALERT_INBOX_LOST];
+  ASSERT_EQ(4, inbox.lost(gone, ALERT_INBOX_LOST));
+  const uint16_t order[] = {8, 2, 3, 4};
+  for (int i = 0; i < 4; i++)
+    EXPECT_EQ(order[i], gone[i].deviceId) << i;
+
+  // Only the last ALERT_INBOX_LOST are kept
+  for (uint16_t d = 100; d < 100 + ALERT_INBOX_LOST; d++)
+    inbox.push(d, 14, 4, -90, d * 1000);
+  ASSERT_EQ(ALERT_INBOX_LOST, inbox.lost(gone, 255));
+  EXPECT_EQ(100 + ALERT_INBOX_LOST - 1, gone[0].deviceId);
+  EXPECT_EQ(100, gone[ALERT_INBOX_LOST - 1].deviceId);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                LinkStats.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(LinkStats, AveragesSignalAndCountsSequenceGaps) {
+  LinkStats<16> links;
+  links.record(3, -90, -4.0f, 7, 0, 1000);
+  const LinkEntry *e = links.find(3);
+  ASSERT_NE(nullptr, e);
+  EXPECT_FLOAT_EQ(-90.0f, e->rssi()); // The first frame seeds the average
+  EXPECT_FLOAT_EQ(-4.0f, e->snr());
+
+  links.record(3, -90, -4.0f, 7, 0, 2000);   // Retry of s=7: no loss
+  links.record(3, -82, 4.0f, 10, 1, 3000);   // 8 and 9 never arrived
+  links.record(3, -82, 4.0f, -1, -1, 4000);  // Heartbeat
+  EXPECT_EQ(4u, e->packets);
+  EXPECT_EQ(2u, e->alerts);
+  EXPECT_EQ(2u, e->lost);
+  EXPECT_EQ(50, e->lossPct());
+  EXPECT_TRUE(e->weak());
+  EXPECT_EQ(1, e->lastAlert);
+  EXPECT_EQ(3000u, e->lastAlertMs);
+  EXPECT_EQ(4000u, e->lastSeenMs);
+  // 1/8 of the way to each -82 sample
+  EXPECT_NEAR(-90 + 8 / 8.0 + 7 / 8.0, e->rssi(), 0.2);
+
+  // Back to s=0 is a TX restart, and a jump over 65535 wraps
+  links.record(3, -82, 4.0f, 0, 0, 5000);
+  links.record(3, -82, 4.0f, 65535, 0, 6000);
+  links.record(3, -82, 4.0f, 1, 0, 7000);
+  EXPECT_EQ(2u + 3u, e->alerts);
+  EXPECT_EQ(2u + 1u, e->lost); // Only s=0 between 65535 and 1
+  EXPECT_EQ(nullptr, links.find(4));
+}
+
+TEST(LinkStats, WeakLinksComeFirst) {
+  LinkStats<16> links;
+  links.record(1, -70, 9.0f, -1, -1, 0);
+  links.record(2, -118, -17.0f, -1, -1, 0); // Under the SNR floor
+  links.record(3, -95, 2.0f, 1, 0, 0);
+  links.record(3, -95, 2.0f, 5, 0, 0);      // 3 of 5 alerts lost
+  links.record(4, -100, -6.0f, -1, -1, 0);
+  EXPECT_EQ(2, links.weakCount());
+
+  LinkEntry rows[4];
+  ASSERT_EQ(4, links.page(rows, 0, 4));
+  EXPECT_EQ(2, rows[0].deviceId);
+  EXPECT_EQ(3, rows[1].deviceId);
+  EXPECT_EQ(4, rows[2].deviceId);
+  EXPECT_EQ(1, rows[3].deviceId);
+  ASSERT_EQ(1, links.page(rows, 3, 2));
+  EXPECT_EQ(1, rows[0].deviceId);
+}
+
+TEST(LinkStats, AFullTableDropsTheDeviceHeardLeast) {
+  LinkStats<8> links; // 6 devices
+  EXPECT_EQ(6, links.capacity());
+  for (uint16_t d = 0; d < 6; d++)
+    links.record(d * 8 + 1, -80, 5.0f, -1, -1, 1000 + d);
+  EXPECT_GT(links.stats().maxProbe, 0); // Six in eight slots: some collide
+  links.record(1, -80, 5.0f, -1, -1, 2000); // Device 9 is now the stalest
+  links.record(100, -80, 5.0f, -1, -1, 3000);
+  EXPECT_EQ(6, links.size());
+  EXPECT_EQ(1u, links.stats().evicted);
+  EXPECT_EQ(nullptr, links.find(9));
+  // Everything else is still found past the hole
+  for (uint16_t d : {1, 17, 25, 33, 41, 100})
+    EXPECT_NE(nullptr, links.find(d)) << d;
+  EXPECT_EQ(2u, links.find(1)->packets);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              RateLimiter.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(RateLimiter, BurstThenRefillAndCountsTheRest) {
+  RateLimiter<4> limiter;
+  RateLimits limits;
+  limits.perMinute = 6; // One every 10 s
+  limits.burst = 2;
+  limits.criticalBurst = 1;
+  limiter.setLimits(limits);
+
+  EXPECT_EQ(RATE_PASS, limiter.admit(7, false, 0));
+  EXPECT_EQ(RATE_PASS, limiter.admit(7, false, 100));
+  EXPECT_EQ(RATE_SUPPRESS, limiter.admit(7, false, 200));
+  EXPECT_EQ(RATE_PASS_CRITICAL, limiter.admit(7, true, 300));
+  EXPECT_EQ(RATE_SUPPRESS, limiter.admit(7, true, 400)); // Reserve spent
+  EXPECT_EQ(RATE_SUPPRESS, limiter.admit(7, false, 9999));
+  EXPECT_EQ(RATE_PASS, limiter.admit(7, false, 10000)); // One token back
+
+  uint32_t since = 0;
+  EXPECT_EQ(3u, limiter.takeSuppressed(7, since));
+  EXPECT_EQ(200u, since);
+  EXPECT_EQ(0u, limiter.takeSuppressed(7, since)); // Reported once
+  EXPECT_EQ(3u, limiter.find(7)->suppressed);
+
+  // The bucket fills first, then the critical reserve
+  EXPECT_EQ(RATE_PASS, limiter.admit(7, false, 40000));
+  EXPECT_EQ(RATE_PASS, limiter.admit(7, false, 40000));
+  EXPECT_EQ(RATE_PASS_CRITICAL, limiter.admit(7, true, 40000));
+  EXPECT_EQ(2u, limiter.stats().critical);
+}
+
+TEST(RateLimiter, OneFloodingDeviceLeavesTheOthersAlone) {
+  RateLimiter<2> limiter; // Default limits
+  for (uint32_t t = 0; t < 1000; t += 10)
+    limiter.admit(1, false, t);
+  EXPECT_EQ(RATE_PASS, limiter.admit(2, false, 1000));
+  EXPECT_EQ(1, limiter.suppressing());
+
+  // A third device takes the slot of the one heard least recently; the
+  // count device 1 had not reported is handed off, not lost
+  EXPECT_EQ(RATE_PASS, limiter.admit(3, false, 2000));
+  EXPECT_EQ(nullptr, limiter.find(1));
+  EXPECT_EQ(1u, limiter.stats().evicted);
+  EXPECT_EQ(1, limiter.suppressing());
+  uint16_t device = 0;
+  uint32_t since = 0;
+  EXPECT_EQ(100u - RATE_BURST, limiter.takeOverdue(2000, 60000, device, since));
+  EXPECT_EQ(1, device);
+  EXPECT_EQ(RATE_BURST * 10u, since);
+  EXPECT_EQ(0u, limiter.stats().lostCounts);
+  EXPECT_EQ(0, limiter.suppressing());
+}
+
+TEST(RateLimiter, QuietDevicesReportTheirCountsOnTheirOwn) {
+  RateLimiter<2> limiter;
+  RateLimits limits;
+  limits.burst = 1;
+  limits.criticalBurst = 0;
+  limiter.setLimits(limits);
+  limiter.admit(4, false, 0);
+  limiter.admit(4, false, 1000); // Suppressed, then nothing more
+  limiter.admit(5, false, 2000);
+  limiter.admit(5, false, 3000);
+  limiter.admit(5, false, 3500);
+
+  uint16_t device = 0;
+  uint32_t since = 0;
+  EXPECT_EQ(0u, limiter.takeOverdue(60999, 60000, device, since)); // Not yet
+  EXPECT_EQ(1u, limiter.takeOverdue(61000, 60000, device, since));
+  EXPECT_EQ(4, device);
+  EXPECT_EQ(1000u, since);
+  EXPECT_EQ(2u, limiter.takeOverdue(63000, 60000, device, since));
+  EXPECT_EQ(5, device);
+  EXPECT_EQ(0u, limiter.takeOverdue(99000, 60000, device, since)); // Once
+
+  // More evicted counts than the handoff holds: the rest are lost
+  for (uint16_t d = 10; d < 10 + RATE_HANDOFF_SLOTS + 3; d++) {
+    limiter.admit(d, false, 100000 + d * 10);
+    limiter.admit(d, false, 100000 + d * 10 + 1);
+  }
+  EXPECT_EQ(RATE_HANDOFF_SLOTS, limiter.stats().handedOff);
+  EXPECT_EQ(1u, limiter.stats().lostCounts);
+}
+
+TEST(RateLimiter, NewLimitsApplyAtOnce) {
+  RateLimiter<4> limiter;
+  EXPECT_EQ(RATE_PASS, limiter.admit(5, false, 0));
+  RateLimits limits;
+  limits.perMinute = 1;
+  limits.burst = 1;
+  limits.criticalBurst = 0;
+  limiter.setLimits(limits);
+  EXPECT_EQ(RATE_PASS, limiter.admit(5, false, 0)); // Cut down to 1 token
+  EXPECT_EQ(RATE_SUPPRESS, limiter.admit(5, true, 0));
+
+  limits.perMinute = 0; // Off
+  limiter.setLimits(limits);
+  for (int i = 0; i < 50; i++)
+    EXPECT_EQ(RATE_PASS, limiter.admit(5, false, 0));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                    DeviceRegistry.h / UplinkLane.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(DeviceRegistry, LoadsSortedDidsAndKeepsTheETag) {
+  DeviceRegistry<8> registry;
+  EXPECT_EQ(DEVICE_UNSURE, registry.lookup(3)); // Nothing fetched yet
+  EXPECT_STREQ("", registry.etag());
+
+  const char body[] = "{\"success\":true,\"data\":{\"count\":4,"
+                      "\"dids\": [12, 3,\n7,1]}}";
+  ASSERT_TRUE(registry.load(body, strlen(body), "\"a1\"", 1000));
+  EXPECT_EQ(4, registry.size());
+  EXPECT_EQ(DEVICE_KNOWN, registry.lookup(7));
+  EXPECT_EQ(DEVICE_KNOWN, registry.lookup(12));
+  EXPECT_EQ(DEVICE_UNKNOWN, registry.lookup(9));
+  EXPECT_STREQ("\"a1\"", registry.etag());
+
+  // Auto-registered between fetches; the next 304 keeps it
+  EXPECT_TRUE(registry.add(9));
+  registry.notModified(5000);
+  EXPECT_EQ(DEVICE_KNOWN, registry.lookup(9));
+  EXPECT_EQ(5000u, registry.syncedMs());
+  EXPECT_EQ(1u, registry.stats().learned);
+
+  const char empty[] = "{\"data\":{\"count\":0,\"dids\":[]}}";
+  ASSERT_TRUE(registry.load(empty, strlen(empty), nullptr, 6000));
+  EXPECT_EQ(DEVICE_UNKNOWN, registry.lookup(9));
+  EXPECT_STREQ("", registry.etag());
+}
+
+TEST(DeviceRegistry, ABadBodyLeavesTheCacheAlone) {
+  DeviceRegistry<4> registry;
+  const char good[] = "{\"dids\":[1,2]}";
+  ASSERT_TRUE(registry.load(good, strlen(good), "\"g\"", 0));
+
+  for (const char *bad : {"{\"dids\":[1,2,3,4,5]}", // More than 4
+                          "{\"dids\":[1,,2]}", "{\"dids\":[1,2,]}",
+                          "{\"dids\":[1 2]}", "{\"dids\":[70000]}",
+                          "{\"dids\":[1,2", "{\"ids\":[1]}",
+                          "{\"dids\":\"1\"}"}) {
+    EXPECT_FALSE(registry.load(bad, strlen(bad), "\"x\"", 0)) << bad;
+  }
+  EXPECT_EQ(8u, registry.stats().rejected);
+  EXPECT_EQ(2, registry.size());
+  EXPECT_STREQ("\"g\"", registry.etag());
+  EXPECT_FALSE(registry.add(3) && registry.add(4) && registry.add(5));
+}
+
+TEST(UplinkLane, ClassifiesReplies) {
+  EXPECT_EQ(UPLINK_OK, classifyUplink(201, "{\"MID\":5}"));
+  EXPECT_EQ(UPLINK_RETRY, classifyUplink(-11, "")); // Read timeout
+  EXPECT_EQ(UPLINK_RETRY, classifyUplink(-1, nullptr));
+  EXPECT_EQ(UPLINK_RETRY, classifyUplink(429, nullptr));
+  EXPECT_EQ(UPLINK_RETRY, classifyUplink(503, "<html>"));
+  EXPECT_EQ(UPLINK_UNKNOWN,
+            classifyUplink(404, "{\"message\":\"Device not found\"}"));
+  EXPECT_EQ(UPLINK_TERMINAL, classifyUplink(404, "Not Found")); // Wrong URL
+  EXPECT_EQ(UPLINK_TERMINAL, classifyUplink(400, "Invalid message code"));
+}
+
+TEST(UplinkLane, BacksOffAndSendsTheMostUrgentFirst) {
+  UplinkLane<4> lane;
+  EXPECT_EQ(2000u, lane.backoffMs(1));
+  EXPECT_EQ(8000u, lane.backoffMs(3));
+  EXPECT_EQ(60000u, lane.backoffMs(20));
+
+  PendingUplink low = {};
+  low.deviceId = 1;
+  low.priority = 3;
+  low.attempts = 1;
+  PendingUplink sos = low;
+  sos.deviceId = 2;
+  sos.priority = 0;
+  PendingUplink fresh = low;
+  fresh.deviceId = 5;
+  fresh.attempts = 1;
+
+  lane.push(low, UPLINK_RETRY, 0);
+  lane.push(sos, UPLINK_RETRY, 500);
+  lane.push(fresh, UPLINK_UNKNOWN, 1000); // Due at once, auto_register
+
+  PendingUplink out;
+  ASSERT_TRUE(lane.popDue(out, 1000));
+  EXPECT_EQ(5, out.deviceId);
+  EXPECT_TRUE(out.autoRegister);
+  EXPECT_FALSE(lane.popDue(out, 1999));
+  ASSERT_TRUE(lane.popDue(out, 2500)); // Both due: the SOS goes first
+  EXPECT_EQ(2, out.deviceId);
+  ASSERT_TRUE(lane.popDue(out, 2500));
+  EXPECT_EQ(1, out.deviceId);
+  EXPECT_TRUE(lane.empty());
+
+  // A registered device's waiting alerts are released at once
+  lane.push(low, UPLINK_RETRY, 3000);
+  lane.release(1, 3000);
+  EXPECT_TRUE(lane.popDue(out, 3000));
+}
+
+TEST(UplinkLane, AFullLaneKeepsTheMostUrgent) {
+  UplinkLane<2> lane;
+  PendingUplink p = {};
+  p.priority = 2;
+  p.deviceId = 1;
+  EXPECT_TRUE(lane.push(p, UPLINK_RETRY, 0));
+  p.deviceId = 2;
+  EXPECT_TRUE(lane.push(p, UPLINK_RETRY, 0));
+  p.deviceId = 3;
+  EXPECT_FALSE(lane.push(p, UPLINK_RETRY, 0)); // Not more urgent
+  p.deviceId = 4;
+  p.priority = 0;
+  EXPECT_TRUE(lane.push(p, UPLINK_RETRY, 0));
+  EXPECT_EQ(2, lane.size());
+  EXPECT_EQ(2u, lane.stats().dropped);
+
+  PendingUplink out;
+  ASSERT_TRUE(lane.popDue(out, 60000));
+  EXPECT_EQ(4, out.deviceId);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              EnergyMeter.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(EnergyMeter, ChargeFollowsTimeInState) {
+  EnergyMeter m;
+  m.begin(0);
+  m.set(EN_RADIO, RADIO_RX, 0);
+  m.set(EN_RADIO, RADIO_TX, 1000);
+  m.set(EN_RADIO, RADIO_SLEEP, 1100);
+  EXPECT_EQ(1000u, m.timeInState(EN_RADIO, RADIO_RX, 1100));
+  EXPECT_EQ(100u, m.timeInState(EN_RADIO, RADIO_TX, 1100));
+  EXPECT_NEAR((1000 * 10.8 + 100 * 100.0) / 3.6e6, m.chargeMah(EN_RADIO, 1100),
+              1e-6);
+}
+
+TEST(EnergyMeter, PulseMovesTimeBetweenStates) {
+  EnergyMeter m;
+  m.begin(0);
+  m.pulse(EN_BUZZER, LOAD_ON, 200);
+  EXPECT_EQ(200u, m.timeInState(EN_BUZZER, LOAD_ON, 1000));
+  EXPECT_EQ(800u, m.timeInState(EN_BUZZER, LOAD_OFF, 1000));
+  EXPECT_EQ(LOAD_OFF, m.state(EN_BUZZER));
+}
+
+TEST(EnergyMeter, CheckpointKeepsTotals) {
+  EnergyMeter a, b;
+  a.begin(0);
+  b.begin(0);
+  a.set(EN_CPU, CPU_ACTIVE, 0);
+  b.set(EN_CPU, CPU_ACTIVE, 0);
+  b.checkpoint(30000);
+  EXPECT_EQ(a.uptimeMs(60000), b.uptimeMs(60000));
+  EXPECT_FLOAT_EQ(a.totalChargeMah(60000), b.totalChargeMah(60000));
+  EXPECT_GT(a.projectedHours(2000, 60000), 0.0f);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                             BatteryMonitor.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(SocCurve, InterpolatesAndClamps) {
+  EXPECT_EQ(100, socFromMillivolts(4300));
+  EXPECT_EQ(100, socFromMillivolts(4200));
+  EXPECT_EQ(50, socFromMillivolts(3840));
+  EXPECT_EQ(22, socFromMillivolts(3740));
+  EXPECT_EQ(0, socFromMillivolts(3000));
+}
+
+TEST(BatteryMonitor, NoPinMeansNoBattery) {
+  BatteryMonitor b(-1, 2.0f);
+  EXPECT_FALSE(b.begin());
+  EXPECT_FALSE(b.present());
+  EXPECT_EQ(-1, b.percent());
+  EXPECT_EQ(POWER_NORMAL, b.tier());
+}
+
+TEST(BatteryMonitor, TierFollowsChargeWithHysteresis) {
+  const uint8_t pin = 35;
+  host::Node node("battery");
+  host::NodeScope scope(node);
+
+  node.analogValue[pin] = rawForBattery(4100);
+  BatteryMonitor b(pin, 2.0f);
+  ASSERT_TRUE(b.begin());
+  EXPECT_TRUE(b.present());
+  EXPECT_NEAR(4100, b.millivolts(), 5);
+  EXPECT_EQ(POWER_NORMAL, b.tier());
+
+  auto settle = [&](uint16_t mv) {
+    node.analogValue[pin] = rawForBattery(mv);
+    for (int i = 0; i < 80; i++) {
+      host::advanceMs(BATTERY_SAMPLE_INTERVAL);
+      b.update();
+    }
+  };
+
+  settle(3765); // ~28 %
+  EXPECT_EQ(POWER_SAVER, b.tier());
+  EXPECT_TRUE(b.tierChanged());
+  EXPECT_FALSE(b.tierChanged());
+
+  settle(3775); // ~31 %: above the threshold but inside the hysteresis
+  EXPECT_EQ(POWER_SAVER, b.tier());
+
+  settle(3800); // 40 %
+  EXPECT_EQ(POWER_NORMAL, b.tier());
+
+  settle(3680); // ~9 %
+  EXPECT_EQ(POWER_LOW, b.tier());
+  EXPECT_EQ(0, b.policy().animationLevel);
+
+  b.forceTier(POWER_CRITICAL);
+  EXPECT_EQ(POWER_CRITICAL, b.tier());
+  EXPECT_EQ(0, b.policy().heartbeatScale);
+  b.forceTier(-1);
+  EXPECT_EQ(POWER_LOW, b.tier());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                             BootSequencer.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+int32_t slowStep(uint8_t phase) { return phase < 3 ? 100 : BOOT_DONE; }
+int32_t fastStep(uint8_t phase) { return phase < 1 ? 20 : BOOT_DONE; }
+
+} // namespace
+
+TEST(BootSequencer, TasksOverlap) {
+  BootSequencer seq;
+  const uint32_t t0 = millis();
+  const int8_t slow = seq.add("slow", slowStep);
+  const int8_t fast = seq.add("fast", fastStep);
+
+  seq.runUntil(fast);
+  EXPECT_TRUE(seq.done(fast));
+  EXPECT_FALSE(seq.done(slow));
+  EXPECT_NEAR(20, (int)(seq.doneAtMs(fast) - t0), 1);
+
+  seq.runUntil();
+  EXPECT_TRUE(seq.allDone());
+  EXPECT_EQ(4, seq.phase(slow));
+  // The waits ran side by side, not back to back
+  EXPECT_NEAR(300, (int)(seq.doneAtMs(slow) - t0), 1);
+}
+
+TEST(BootSequencer, FirstMarkWins) {
+  BootSequencer seq;
+  seq.mark("radio", 10);
+  seq.mark("radio", 20);
+  EXPECT_EQ(10u, seq.markMs("radio"));
+  EXPECT_EQ(0u, seq.markMs("wifi"));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                 PinMap.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+// esp32txs (ESP32-S3): D3 on GPIO 46 is the only high-bank line
+typedef ParallelBus8<7, 8, 9, 21, 46, 10, 11, 13, 12> S3Bus;
+// LifelineRX_ILI9488 (ESP32): D0/D1 on GPIO 33/32
+typedef ParallelBus8<22, 33, 32, 13, 12, 14, 27, 26, 25> RxBus;
+// Everything in the low bank
+typedef ParallelBus8<4, 0, 1, 2, 3, 5, 6, 7, 15> LowBus;
+
+static_assert(S3Bus::BANK1_MASK == 1u << (46 - 32), "S3 high bank");
+static_assert(S3Bus::setMask(0, 0x08) == 0, "D3 is not in bank 0");
+static_assert(RxBus::BANK1_MASK == 0x3, "RX high bank");
+static_assert(LowBus::BANK1_MASK == 0, "no high bank");
+
+/** Per-bit reference: what writeData8() used to compute in branches. */
+uint32_t naiveMask(const uint8_t pins[8], uint8_t bank, uint8_t d) {
+  uint32_t m = 0;
+  for (int i = 0; i < 8; i++) {
+    if ((d >> i) & 1 && pins[i] / 32 == bank)
+      m |= 1u << (pins[i] % 32);
+  }
+  return m;
+}
+
+template <typename Bus>
+void expectDrives(const uint8_t pins[8], uint8_t wr) {
+  host::Node node("bus");
+  host::NodeScope scope(node);
+  Bus::begin();
+  EXPECT_EQ(HIGH, digitalRead(wr));
+
+  int strobes = 0;
+  node.pinListeners.push_back([&](host::Node &, uint8_t pin, uint8_t level) {
+    if (pin == wr && level == LOW)
+      strobes++;
+  });
+  for (int d = 0; d < 256; d++) {
+    Bus::write((uint8_t)d);
+    for (int i = 0; i < 8; i++)
+      ASSERT_EQ((d >> i) & 1, digitalRead(pins[i])) << d << " D" << i;
+  }
+  EXPECT_EQ(256, strobes);
+  EXPECT_EQ(HIGH, digitalRead(wr));
+}
+
+} // namespace
+
+TEST(PinMap, TablesMatchPerBitMasks) {
+  const uint8_t s3[8] = {8, 9, 21, 46, 10, 11, 13, 12};
+  const uint8_t rx[8] = {33, 32, 13, 12, 14, 27, 26, 25};
+  for (int d = 0; d < 256; d++) {
+    for (uint8_t bank = 0; bank < 2; bank++) {
+      EXPECT_EQ(naiveMask(s3, bank, (uint8_t)d), S3Bus::setMask(bank, d));
+      EXPECT_EQ(naiveMask(rx, bank, (uint8_t)d), RxBus::setMask(bank, d));
+    }
+  }
+}
+
+TEST(PinMap, WriteDrivesEveryLineAndStrobesOnce) {
+  const uint8_t s3[8] = {8, 9, 21, 46, 10, 11, 13, 12};
+  const uint8_t rx[8] = {33, 32, 13, 12, 14, 27, 26, 25};
+  const uint8_t low[8] = {0, 1, 2, 3, 5, 6, 7, 15};
+  expectDrives<S3Bus>(s3, 7);
+  expectDrives<RxBus>(rx, 22);
+  expectDrives<LowBus>(low, 4);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                I80Panel.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+const uint8_t S3_DATA[8] = {8, 9, 21, 46, 10, 11, 13, 12};
+typedef I80Panel<S3Bus> S3Panel; // CS 5, DC 6 on esp32txs
+
+/** Latch bit-banged bytes into node.panel on WR's rising edge. */
+void decodeGpioBus(host::Node &node) {
+  auto wrLow = std::make_shared<bool>(false);
+  node.pinListeners.push_back([wrLow](host::Node &n, uint8_t pin,
+                                      uint8_t level) {
+    if (pin != 7)
+      return;
+    if (level == LOW) {
+      *wrLow = true;
+      return;
+    }
+    if (!*wrLow)
+      return;
+    *wrLow = false;
+    uint8_t b = 0;
+    for (int i = 0; i < 8; i++)
+      b |= (uint8_t)(n.pinLevel[S3_DATA[i]] << i);
+    host::panelWrite(n, &b, 1, !n.pinLevel[6], 0);
+  });
+}
+
+uint16_t ramp(int x, int y) { return (uint16_t)(x * 0x0841 ^ y << 11); }
+
+void drawPanelScene(S3Panel &tft) {
+  tft.setAddressWindow(0, 0, 479, 319);
+  tft.fill(0x18C5, 480u * 320u);
+  tft.setAddressWindow(10, 10, 309, 49);
+  tft.fill(0xF800, 300u * 40u);
+  tft.setAddressWindow(10, 10, 309, 49); // Same window: no CASET/RASET
+  tft.fill(0x07E0, 300u * 20u);
+  tft.fill(0x001F, 300u * 20u); // The rest of it, continued
+  uint16_t row[200];
+  for (int y = 100; y < 110; y++) {
+    for (int x = 0; x < 200; x++)
+      row[x] = ramp(x, y);
+    tft.setAddressWindow(40, (uint16_t)y, 239, (uint16_t)y);
+    tft.pushPixels(row, 200);
+  }
+  tft.setAddressWindow(479, 319, 479, 319);
+  tft.fill(0xFFFF, 1);
+  tft.flush();
+}
+
+int idleCalls = 0;
+void countIdle(void *) { idleCalls++; }
+
+} // namespace
+
+TEST(I80Panel, DmaAndGpioPathsDrawTheSamePanel) {
+  host::Node dma("dma"), gpio("gpio");
+  gpio.lcd.present = false;
+  decodeGpioBus(gpio);
+  {
+    host::NodeScope scope(dma);
+    static S3Panel tft(5, 6);
+    ASSERT_TRUE(tft.begin());
+    EXPECT_TRUE(tft.dma());
+    EXPECT_EQ(20000000u, tft.clockHz());
+    drawPanelScene(tft);
+    EXPECT_GT(tft.stats().windowsSkipped, 0u);
+    EXPECT_EQ(0u, tft.pending());
+  }
+  {
+    host::NodeScope scope(gpio);
+    static S3Panel tft(5, 6);
+    EXPECT_FALSE(tft.begin());
+    EXPECT_FALSE(tft.dma());
+    EXPECT_EQ(0u, tft.clockHz());
+    drawPanelScene(tft);
+  }
+  EXPECT_EQ(0u, gpio.lcd.transfers);
+  EXPECT_EQ(0x001F, dma.panel.pixel(309, 49));
+  EXPECT_EQ(ramp(199, 109), dma.panel.pixel(239, 109));
+  for (int y = 0; y < 320; y++) {
+    for (int x = 0; x < 480; x++)
+      ASSERT_EQ(gpio.panel.pixel(x, y), dma.panel.pixel(x, y)) << x << "," << y;
+  }
+}
+
+TEST(I80Panel, FillsRunOnTheBusWhileTheCpuQueues) {
+  host::Node node("s3");
+  host::NodeScope scope(node);
+  static S3Panel tft(5, 6);
+  idleCalls = 0;
+  tft.onIdle(countIdle, nullptr);
+  ASSERT_TRUE(tft.begin(I80Memory::PSRAM));
+
+  // Up to the queue depth, a fill costs the caller nothing
+  const uint64_t t0 = host::nowUs();
+  tft.setAddressWindow(0, 0, 479, 9);
+  tft.fill(0xF800, 4800);
+  EXPECT_EQ(t0, host::nowUs());
+  EXPECT_EQ(0u, node.lcd.stallUs);
+  EXPECT_EQ(7u, tft.pending()); // CASET, RASET and five spans
+  EXPECT_GE(node.lcd.freeNs, t0 * 1000 + 4800 * 2 * 50);
+
+  // A full screen: 307 KB at 20 MHz, the slots are reused, not rewritten
+  tft.setAddressWindow(0, 0, 479, 319);
+  tft.fill(0x07E0, 480u * 320u);
+  EXPECT_GT(tft.stats().spansReused, 100u);
+  EXPECT_LE(tft.stats().spansWritten, 14u);
+  tft.flush();
+  EXPECT_GE(host::nowUs() - t0, 15000u);
+  EXPECT_EQ(0x07E0, node.panel.pixel(479, 319));
+  EXPECT_EQ(tft.stats().transfers, node.lcd.callbacks);
+  EXPECT_GE(idleCalls, 1);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              ScreenCache.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+/** A screen's worth of windows, fills and rows, mirrored into the cache. */
+template <typename Cache> void drawCachedScene(S3Panel &tft, Cache &cache) {
+  auto window = [&](uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    tft.setAddressWindow(x0, y0, x1, y1);
+    cache.window(x0, y0, x1, y1);
+  };
+  auto fill = [&](uint16_t color, uint32_t n) {
+    tft.fill(color, n);
+    cache.fill(color, n);
+  };
+  window(0, 0, 479, 319);
+  fill(0x18C5, 480u * 320u);
+  window(10, 10, 309, 49);
+  fill(0xF800, 300u * 40u);
+  fill(0x07E0, 300u * 10u + 17u); // Wraps back to the window's top
+  uint16_t row[200];
+  for (int y = 100; y < 110; y++) {
+    for (int x = 0; x < 200; x++)
+      row[x] = ramp(x, y);
+    window(40, (uint16_t)y, 239, (uint16_t)y);
+    tft.pushPixels(row, 200);
+    cache.pixels(row, 200);
+  }
+  window(479, 319, 479, 319);
+  fill(0xFFFF, 1);
+  tft.flush();
+}
+
+} // namespace
+
+TEST(ScreenCache, BlitDrawsWhatWasRecorded) {
+  host::Node node("s3");
+  host::NodeScope scope(node);
+  static S3Panel tft(5, 6);
+  ASSERT_TRUE(tft.begin());
+  ScreenCache<2> cache;
+  ASSERT_TRUE(cache.begin(480, 320));
+  EXPECT_EQ(2u, cache.frames());
+
+  const uint32_t key = fnv1a("menu", 4);
+  EXPECT_EQ(nullptr, cache.find(1, key));
+  cache.record(1, key);
+  drawCachedScene(tft, cache);
+  cache.commit();
+  std::vector<uint16_t> drawn(480 * 320);
+  for (int y = 0; y < 320; y++) {
+    for (int x = 0; x < 480; x++)
+      drawn[y * 480 + x] = node.panel.pixel(x, y);
+  }
+  EXPECT_EQ(0x07E0, drawn[10 * 480 + 26]); // Wrapped fill
+
+  // Another screen, then back: one window and 150 spans straight from
+  // the frame, no slot written
+  tft.setAddressWindow(0, 0, 479, 319);
+  tft.fill(0x0000, 480u * 320u);
+  tft.flush();
+  const uint8_t *frame = cache.find(1, key);
+  ASSERT_NE(nullptr, frame);
+  EXPECT_EQ(nullptr, cache.find(1, fnv1a("menu2", 5)));
+  const uint32_t written = tft.stats().spansWritten;
+  const uint64_t t0 = host::nowUs();
+  tft.setAddressWindow(0, 0, 479, 319);
+  tft.pushStored(frame, 480u * 320u);
+  tft.flush();
+  EXPECT_EQ(written, tft.stats().spansWritten);
+  EXPECT_EQ(150u, tft.stats().spansStored);
+  EXPECT_LT(host::nowUs() - t0, 16000u); // 300 KB at 20 MHz
+  for (int y = 0; y < 320; y++) {
+    for (int x = 0; x < 480; x++)
+      ASSERT_EQ(drawn[y * 480 + x], node.panel.pixel(x, y)) << x << "," << y;
+  }
+  EXPECT_EQ(1u, cache.stats().hits);
+  EXPECT_EQ(2u, cache.stats().misses);
+}
+
+TEST(ScreenCache, TheShownFrameIsNeverRecordedOver) {
+  host::Node node("s3");
+  host::NodeScope scope(node);
+  ScreenCache<3> cache;
+  ASSERT_TRUE(cache.begin(16, 8));
+  auto draw = [&](uint8_t id, uint16_t color) {
+    cache.record(id, id);
+    cache.fill(color, 16 * 8);
+    cache.commit();
+  };
+  draw(1, 0x1111);
+  draw(2, 0x2222);
+  draw(3, 0x3333);
+  EXPECT_EQ(0u, cache.stats().evictions);
+
+  // 1 is the least recently used, but it is on the panel
+  ASSERT_NE(nullptr, cache.find(1, 1));
+  draw(4, 0x4444);
+  EXPECT_NE(nullptr, cache.find(1, 1));
+  EXPECT_EQ(nullptr, cache.find(2, 2)); // Replaced
+  EXPECT_NE(nullptr, cache.find(3, 3));
+  const uint8_t *f4 = cache.find(4, 4);
+  ASSERT_NE(nullptr, f4);
+  EXPECT_EQ(0x44, f4[0]);
+  EXPECT_EQ(1u, cache.stats().evictions);
+
+  // An unfinished recording is not found
+  cache.record(5, 5);
+  cache.fill(0x5555, 10);
+  cache.abort();
+  EXPECT_EQ(nullptr, cache.find(5, 5));
+  EXPECT_NE(fnv1a("a", 1), fnv1a("b", 1));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                               PanelImage.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+/** Sink that records the calls and places pixels like the panel does. */
+struct ImageSink {
+  uint16_t px[4][8] = {};
+  uint16_t x0 = 0, y0 = 0, x1 = 0, y1 = 0, x = 0, y = 0;
+  int windows = 0, fills = 0, literals = 0;
+  void window(uint16_t a, uint16_t b, uint16_t c, uint16_t d) {
+    x0 = x = a, y0 = y = b, x1 = c, y1 = d;
+    windows++;
+  }
+  void put(uint16_t c) {
+    px[y][x] = c;
+    if (++x > x1) {
+      x = x0;
+      y = y < y1 ? y + 1 : y0;
+    }
+  }
+  void fill(uint16_t c, uint32_t n) {
+    fills++;
+    while (n--)
+      put(c);
+  }
+  void pixels(const uint16_t *p, uint32_t n) {
+    literals++;
+    for (uint32_t i = 0; i < n; i++)
+      put(p[i]);
+  }
+};
+
+// 8x4: a row and a half of 0x1111 (the run crosses the row end), four
+// literal pixels, then 0x2222 to the end
+const uint16_t IMAGE_WORDS[] = {12, 0x1111, PANEL_IMAGE_LITERAL | 4, 0xA, 0xB,
+                                0xC, 0xD, 16, 0x2222};
+const PanelImage IMAGE = {8, 4, IMAGE_WORDS, 9};
+
+} // namespace
+
+TEST(PanelImage, StreamsRunsAndLiteralsAcrossRows) {
+  ImageSink sink;
+  drawPanelImage(IMAGE, sink);
+  EXPECT_EQ(1, sink.windows);
+  EXPECT_EQ(2, sink.fills);
+  EXPECT_EQ(1, sink.literals);
+  EXPECT_EQ(0x1111, sink.px[1][3]);
+  EXPECT_EQ(0xA, sink.px[1][4]);
+  EXPECT_EQ(0xD, sink.px[1][7]);
+  EXPECT_EQ(0x2222, sink.px[2][0]);
+  EXPECT_EQ(0x2222, sink.px[3][7]);
+}
+
+TEST(PanelImage, RestoresOnlyTheField) {
+  ImageSink sink;
+  const FieldRect field = {3, 1, 3, 2}; // Columns 3..5, rows 1..2
+  drawPanelImage(IMAGE, sink, field);
+  EXPECT_EQ(1, sink.windows);
+  EXPECT_EQ(0x1111, sink.px[1][3]);
+  EXPECT_EQ(0xA, sink.px[1][4]);
+  EXPECT_EQ(0xB, sink.px[1][5]);
+  EXPECT_EQ(0x2222, sink.px[2][3]);
+  EXPECT_EQ(0x2222, sink.px[2][5]);
+  EXPECT_EQ(0, sink.px[1][2]); // Outside: untouched
+  EXPECT_EQ(0, sink.px[1][6]);
+  EXPECT_EQ(0, sink.px[0][4]);
+  EXPECT_EQ(0, sink.px[3][4]);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              StagedRender.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+std::vector<int> drawn;
+bool packetWaiting = false;
+
+/** 3 ms of drawing; logs its arg (tier * 10 + index here). */
+void tierStep(uint8_t arg) {
+  delayMicroseconds(3000);
+  drawn.push_back(arg);
+}
+bool packetCheck() { return packetWaiting; }
+
+} // namespace
+
+TEST(StagedRender, CriticalTierFirstThenFramesOfTheRest) {
+  StagedRender render;
+  drawn.clear();
+  render.begin();
+  render.add(2, tierStep, 20);
+  render.add(1, tierStep, 10);
+  render.add(RENDER_TIER_CRITICAL, tierStep, 0);
+  render.add(2, tierStep, 21);
+  render.add(RENDER_TIER_CRITICAL, tierStep, 1);
+
+  // Tier 0 whole, even with no budget; nothing past it
+  EXPECT_FALSE(render.run(0));
+  EXPECT_TRUE(render.readable());
+  EXPECT_EQ((std::vector<int>{0, 1}), drawn);
+  EXPECT_NEAR(6000, (int)render.stats().lastReadableUs, 100);
+
+  // 5 ms frames of 3 ms steps: two steps per frame
+  EXPECT_FALSE(render.run(5000));
+  EXPECT_EQ((std::vector<int>{0, 1, 10, 20}), drawn);
+  EXPECT_EQ(1, render.stepsLeft());
+  EXPECT_TRUE(render.run(5000));
+  EXPECT_EQ((std::vector<int>{0, 1, 10, 20, 21}), drawn);
+  EXPECT_TRUE(render.done());
+  EXPECT_NEAR(15000, (int)render.stats().lastCompleteUs, 100);
+  EXPECT_EQ(1u, render.stats().completed);
+  EXPECT_EQ(3u, render.stats().frames);
+  EXPECT_TRUE(render.run(5000)); // Nothing left: not a frame
+  EXPECT_EQ(3u, render.stats().frames);
+}
+
+TEST(StagedRender, APacketCutsTheFrameAndANewScreenDropsTheRest) {
+  StagedRender render;
+  render.setPreempt(packetCheck);
+  drawn.clear();
+  packetWaiting = true;
+  render.begin();
+  render.add(RENDER_TIER_CRITICAL, tierStep, 0);
+  render.add(1, tierStep, 10);
+  render.add(1, tierStep, 11);
+
+  // Never before tier 0 is up; a frame still makes progress
+  EXPECT_FALSE(render.run(100000));
+  EXPECT_EQ((std::vector<int>{0}), drawn);
+  EXPECT_FALSE(render.run(100000));
+  EXPECT_EQ((std::vector<int>{0, 10}), drawn);
+
+  render.begin();
+  render.add(RENDER_TIER_CRITICAL, tierStep, 1);
+  EXPECT_TRUE(render.run(0));
+  EXPECT_EQ((std::vector<int>{0, 10, 1}), drawn);
+  EXPECT_EQ(2u, render.stats().screens);
+  EXPECT_EQ(1u, render.stats().preempted);
+  EXPECT_EQ(1u, render.stats().completed);
+  packetWaiting = false;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              MemoryBudget.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(FixedString, AppendsAndCutsAtCapacity) {
+  FixedString<8> s;
+  EXPECT_TRUE(s.append("abc"));
+  EXPECT_TRUE(s.appendf("%d", 42));
+  EXPECT_STREQ("abc42", s.c_str());
+  EXPECT_FALSE(s.append("xyz"));
+  EXPECT_STREQ("abc42xy", s.c_str());
+  EXPECT_EQ(7u, s.length());
+  EXPECT_TRUE(s.truncated());
+
+  s = "hello";
+  EXPECT_FALSE(s.truncated());
+  EXPECT_FALSE(s.appendf("%s", "world"));
+  EXPECT_STREQ("hellowo", s.c_str());
+  s.truncate(2);
+  EXPECT_TRUE(s.equals("he"));
+}
+
+TEST(FixedVector, RefusesPastCapacity) {
+  FixedVector<int, 3> v;
+  EXPECT_TRUE(v.push_back(1));
+  EXPECT_TRUE(v.push_back(2));
+  EXPECT_TRUE(v.push_back(3));
+  EXPECT_FALSE(v.push_back(4));
+  v.erase(0);
+  ASSERT_EQ(2u, v.size());
+  EXPECT_EQ(2, v[0]);
+  EXPECT_EQ(3, v.back());
+  int sum = 0;
+  for (int x : v)
+    sum += x;
+  EXPECT_EQ(5, sum);
+}
+
+TEST(MemoryBudget, PrintfToCutsLongLines) {
+  host::Node node("mem");
+  host::NodeScope scope(node);
+  const std::string longText(PRINTF_TO_MAX * 2, 'x');
+  EXPECT_EQ((size_t)PRINTF_TO_MAX - 1,
+            printfTo(Serial, "%s", longText.c_str()));
+  EXPECT_EQ(std::string(PRINTF_TO_MAX - 1, 'x'), node.takeSerial());
+}
+
+TEST(MemoryBudget, ReportsBlocksAndTracksDrift) {
+  host::Node node("mem");
+  host::NodeScope scope(node);
+  MemoryBudget budget;
+  budget.add("uplink body", 256);
+  budget.add("rx frame", 64);
+  EXPECT_EQ(320u, budget.staticBytes());
+  EXPECT_EQ(0u, budget.driftBytes());
+
+  budget.freeze(false);
+  EXPECT_TRUE(node.heap.frozen);
+  node.heap.freeBytes -= 4096;
+  EXPECT_TRUE(budget.check(Serial));
+  EXPECT_EQ(4096u, budget.driftBytes());
+  node.heap.freeBytes -= HEAP_DRIFT_LIMIT;
+  EXPECT_FALSE(budget.check(Serial));
+  node.heap.freeBytes += 8192; // The lowest point is what counts
+  EXPECT_FALSE(budget.check(Serial));
+
+  budget.printReport(Serial);
+  const std::string out = node.takeSerial();
+  EXPECT_NE(std::string::npos, out.find("Heap drifted"));
+  EXPECT_NE(std::string::npos, out.find("[MEM] uplink body"));
+  EXPECT_NE(std::string::npos, out.find("static total    320 B"));
+}
+
+TEST(MemoryBudget, ReportsBlocksPastTheCap) {
+  host::Node node("mem");
+  host::NodeScope scope(node);
+  MemoryBudget budget;
+  for (int i = 0; i < BUDGET_MAX_ENTRIES; i++)
+    EXPECT_TRUE(budget.add("block", 10));
+  EXPECT_FALSE(budget.add("late", 100));
+  EXPECT_FALSE(budget.add("later", 20));
+  EXPECT_EQ(BUDGET_MAX_ENTRIES * 10u + 120u, budget.staticBytes());
+
+  budget.printReport(Serial);
+  const std::string out = node.takeSerial();
+  EXPECT_NE(std::string::npos, out.find("[MEM] 2 more blocks    120 B"))
+      << out;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                               ObjectPool.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+struct Tracked {
+  static int alive;
+  explicit Tracked(int v) : value(v) { alive++; }
+  ~Tracked() { alive--; }
+  int value;
+};
+int Tracked::alive = 0;
+
+} // namespace
+
+TEST(ObjectPool, HandsOutEveryBlockOnceThenFails) {
+  ObjectPool<Tracked, 4> pool;
+  Tracked *got[4];
+  for (int i = 0; i < 4; i++) {
+    got[i] = pool.create(i);
+    ASSERT_NE(nullptr, got[i]);
+    EXPECT_TRUE(pool.owns(got[i]));
+    for (int j = 0; j < i; j++)
+      EXPECT_NE(got[j], got[i]);
+  }
+  EXPECT_EQ(4, Tracked::alive);
+  EXPECT_EQ(nullptr, pool.create(9));
+  EXPECT_EQ(1u, pool.failures());
+
+  pool.destroy(got[2]);
+  EXPECT_EQ(3, Tracked::alive);
+  EXPECT_EQ(got[2], pool.create(7)); // Last freed is reused first
+  EXPECT_EQ(7, got[2]->value);
+  for (Tracked *t : got)
+    pool.destroy(t);
+  EXPECT_EQ(0, Tracked::alive);
+  EXPECT_EQ(0u, pool.inUse());
+  EXPECT_EQ(4u, pool.highWater());
+}
+
+TEST(ObjectPool, RejectsForeignPointers) {
+  ObjectPool<uint32_t, 2> pool;
+  uint32_t outside = 0;
+  EXPECT_FALSE(pool.release(&outside));
+  uint8_t *block = (uint8_t *)pool.allocate();
+  EXPECT_FALSE(pool.release(block + 1)); // Not a block boundary
+  EXPECT_TRUE(pool.release(block));
+  EXPECT_EQ(0u, pool.inUse());
+}
+
+TEST(ObjectPool, PrintsStats) {
+  host::Node node("pool");
+  host::NodeScope scope(node);
+  ObjectPool<int, 3> pool;
+  pool.allocate();
+  pool.printStats(Serial, "rx packets");
+  EXPECT_EQ("[POOL] rx packets       1/3   in use, high   1, failed 0\n",
+            node.takeSerial());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                               RingQueue.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+template <typename Q> void expectFifoAcrossWrap() {
+  Q q;
+  int out = -1;
+  EXPECT_FALSE(q.pop(out));
+  int next = 0, expect = 0;
+  // Keep it part-full so head and tail wrap many times
+  for (int round = 0; round < 100; round++) {
+    while (q.push(next))
+      next++;
+    EXPECT_EQ(Q::capacity(), q.size());
+    for (int i = 0; i < 3; i++) {
+      ASSERT_TRUE(q.pop(out));
+      EXPECT_EQ(expect++, out);
+    }
+  }
+  while (q.pop(out))
+    EXPECT_EQ(expect++, out);
+  EXPECT_EQ(next, expect);
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(100u, q.dropped());
+}
+
+TEST(SpscQueue, FifoAcrossWrapAndCountsDrops) {
+  expectFifoAcrossWrap<SpscQueue<int, 8>>();
+}
+
+TEST(MpscQueue, FifoAcrossWrapAndCountsDrops) {
+  expectFifoAcrossWrap<MpscQueue<int, 8>>();
+}
+
+TEST(NotifyingQueue, PopReturnsQueuedItemWithoutWaiting) {
+  NotifyingQueue<SpscQueue<int, 4>> q;
+  EXPECT_TRUE(q.push(7));
+  int out = 0;
+  EXPECT_TRUE(q.pop(out, 0));
+  EXPECT_EQ(7, out);
+  EXPECT_FALSE(q.pop(out, 0));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                 UI TEXT
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(UiText, WidthsMatchGfxBoundsAtEverySize) {
+  Adafruit_ST7789 tft(-1, -1, -1);
+  tft.init(240, 320);
+  tft.setTextWrap(false); // Long strings at size 4 run past the panel
+  const Text *tables[] = {ui::ALERT_NAMES, ui::ALERT_SHORT, ui::ALERT_WORDS,
+                          ui::PRIORITY_LABELS, ui::MANUAL_TITLES};
+  const uint8_t counts[] = {ui::ALERT_NAMES_COUNT, ui::ALERT_SHORT_COUNT,
+                            ui::ALERT_WORDS_COUNT, ui::PRIORITY_LABELS_COUNT,
+                            ui::MANUAL_TITLES_COUNT};
+  for (size_t t = 0; t < 5; t++) {
+    for (uint8_t i = 0; i < counts[t]; i++) {
+      const Text &text = tables[t][i];
+      for (uint8_t size = 1; size <= 4; size++) {
+        tft.setTextSize(size);
+        int16_t x1, y1;
+        uint16_t w, h;
+        tft.getTextBounds(text.str, 0, 0, &x1, &y1, &w, &h);
+        EXPECT_EQ(w, text.widthAt(size)) << text.str << " @" << (int)size;
+        EXPECT_EQ(h, TEXT_CHAR_H * size);
+      }
+    }
+  }
+}
+
+TEST(UiText, TablesShareOnePool) {
+  EXPECT_STREQ("EMERGENCY", ui::ALERT_NAMES[0].str);
+  EXPECT_STREQ("OTHER EMERGENCY", ui::ALERT_NAMES[14].str);
+  EXPECT_STREQ("EQUIP FAIL", ui::ALERT_SHORT[13].str);
+  EXPECT_STREQ("SNOW", ui::ALERT_WORDS[12].str);
+  EXPECT_STREQ("INFO", ui::PRIORITY_LABELS[4].str);
+  // Equal strings are one copy, a tail points into the longer string
+  EXPECT_EQ(ui::ALERT_NAMES[4].str, ui::ALERT_SHORT[4].str);
+  EXPECT_EQ(ui::ALERT_NAMES[1].str + 8, ui::ALERT_NAMES[0].str);
+  EXPECT_EQ(ui::EMERGENCY_TRANSMITTER.str + 10, ui::TRANSMITTER.str);
+  for (const Text &t : ui::ALERT_NAMES) {
+    EXPECT_GE(t.str, ui::POOL);
+    EXPECT_LT(t.str, ui::POOL + sizeof(ui::POOL));
+  }
+}
+
+TEST(UiText, CentreAndRightAlign) {
+  static_assert(centerX(ui::LIFELINE, 4, 240) == (240 - 8 * 6 * 4) / 2,
+                "centring is a compile-time constant");
+  EXPECT_EQ(20 + (100 - 36) / 2, centerX(ui::SEND, 1, 100, 20));
+  EXPECT_EQ(230 - 48 * 2, rightX(ui::PRIORITY_LABELS[0], 2, 230));
+  EXPECT_EQ(textWidth("#042", 2), 4 * 12);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              NEPALI UI TEXT
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+struct Fill {
+  int16_t x, y, w, h;
+};
+
+/** drawShaped() into a list of rectangles. */
+std::vector<Fill> recordShaped(const ShapedText &t, int16_t x, int16_t y,
+                               uint8_t scale) {
+  std::vector<Fill> fills;
+  const uint16_t n = drawShaped(
+      [&](int16_t fx, int16_t fy, int16_t fw, int16_t fh, uint16_t) {
+        fills.push_back({fx, fy, fw, fh});
+      },
+      ui_ne::FONT, t, x, y, 0xFFFF, scale);
+  EXPECT_EQ(n, fills.size());
+  return fills;
+}
+
+/** drawShaped() onto a cleared panel; returns the lit pixel count. */
+int renderShaped(Adafruit_ST7789 &tft, const ShapedText &t, uint8_t scale) {
+  tft.fillScreen(0);
+  drawShaped(
+      [&](int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+        tft.fillRect(x, y, w, h, c);
+      },
+      ui_ne::FONT, t, 10, 10, 0xFFFF, scale);
+  int lit = 0;
+  for (uint16_t px : tft.framebuffer())
+    lit += px != 0;
+  return lit;
+}
+
+} // namespace
+
+TEST(UiTextNe, TablesMatchTheEnglishIndices) {
+  static_assert(ui_ne::ALERT_WORDS_COUNT == ui::ALERT_WORDS_COUNT,
+                "one Nepali word per English one");
+  for (const ShapedText &t : ui_ne::ALERT_WORDS) {
+    ASSERT_GT(t.count, 0);
+    uint16_t width = 0;
+    for (uint8_t i = 0; i < t.count; i++) {
+      ASSERT_LT(t.glyphs[i], ui_ne::GLYPH_COUNT);
+      width += ui_ne::FONT.glyphs[t.glyphs[i]].advance;
+    }
+    EXPECT_EQ(width, t.width);
+  }
+}
+
+TEST(UiTextNe, RunsStayInsideTheTextBox) {
+  for (uint8_t scale = 1; scale <= 2; scale++) {
+    for (const ShapedText &t : ui_ne::ALERT_WORDS) {
+      for (const Fill &f : recordShaped(t, 20, 30, scale)) {
+        EXPECT_GT(f.w, 0);
+        EXPECT_GT(f.h, 0);
+        EXPECT_EQ(0, f.w % scale);
+        EXPECT_GE(f.x, 20);
+        EXPECT_LE(f.x + f.w, 20 + t.widthAt(scale));
+        EXPECT_GE(f.y, 30);
+        EXPECT_LE(f.y + f.h, 30 + ui_ne::FONT.height * scale);
+      }
+    }
+  }
+}
+
+TEST(UiTextNe, HeadlineSpansEachWord) {
+  Adafruit_ST7789 tft(-1, -1, -1);
+  tft.init(240, 320);
+  const int16_t row = 10 + ui_ne::FONT.headlineRow;
+  // उद्धार: one word, one unbroken line over the conjunct and the signs
+  const ShapedText &rescue = ui_ne::ALERT_WORDS[3];
+  renderShaped(tft, rescue, 1);
+  for (int16_t x = 10; x < 10 + rescue.width; x++)
+    EXPECT_NE(0, tft.pixel(x, row)) << x;
+  EXPECT_EQ(0, tft.pixel(10 + rescue.width, row));
+  // सबै ठीक: the space breaks the line
+  const ShapedText &ok = ui_ne::ALERT_WORDS[4];
+  renderShaped(tft, ok, 1);
+  int gap = 0;
+  for (int16_t x = 10; x < 10 + ok.width; x++)
+    gap += tft.pixel(x, row) == 0;
+  EXPECT_EQ(ui_ne::FONT.glyphs[ui_ne::ALERT_WORDS[4].glyphs[3]].advance, gap);
+}
+
+TEST(UiTextNe, RunsNeedFewerFillsThanPixels) {
+  Adafruit_ST7789 tft(-1, -1, -1);
+  tft.init(240, 320);
+  for (uint8_t i = 0; i < ui_ne::ALERT_WORDS_COUNT; i++) {
+    const ShapedText &t = ui_ne::ALERT_WORDS[i];
+    const int lit = renderShaped(tft, t, 1);
+    const size_t fills = recordShaped(t, 0, 0, 1).size();
+    EXPECT_LT(fills * 2, (size_t)lit) << "ALERT_WORDS[" << (int)i << "]";
+    // Scaling grows the rectangles, not their number
+    EXPECT_EQ(fills, recordShaped(t, 0, 0, 3).size());
+    EXPECT_EQ(lit * 4, renderShaped(tft, t, 2));
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                           ANTI-ALIASED TEXT
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+/** AaTextRenderer sink that keeps the box and its rows. */
+struct BoxSink {
+  int16_t x = 0, y = 0, w = 0, h = 0;
+  int windows = 0, ends = 0;
+  std::vector<std::vector<uint16_t>> rows;
+
+  void begin(int16_t bx, int16_t by, int16_t bw, int16_t bh) {
+    x = bx, y = by, w = bw, h = bh;
+    windows++;
+  }
+  void write(const uint16_t *px, uint16_t n) { rows.emplace_back(px, px + n); }
+  void end() { ends++; }
+};
+
+const AaFont *const AA_FONTS[] = {&aa::SANS_BOLD_12, &aa::SANS_BOLD_19,
+                                  &aa::SANS_BOLD_32};
+
+} // namespace
+
+TEST(AaText, OneWindowPerRunAroundTheInk) {
+  static AaTextRenderer text;
+  for (const AaFont *font : AA_FONTS) {
+    BoxSink sink;
+    const uint16_t w = text.draw(sink, *font, "LOST PERSON", 30, 119, 0xF800,
+                                 0x0000);
+    EXPECT_EQ(1, sink.windows);
+    EXPECT_EQ(1, sink.ends);
+    EXPECT_EQ(aaTextWidth(*font, "LOST PERSON"), w);
+    // Capitals only: the window skips the descender rows and the bearings
+    EXPECT_GE(sink.x, 30);
+    EXPECT_GT(sink.y, 119);
+    EXPECT_LE(sink.x + sink.w, 30 + w);
+    EXPECT_LT(sink.y + sink.h, 119 + font->height);
+    EXPECT_GT(sink.w * 10, w * 9);
+    ASSERT_EQ((size_t)sink.h, sink.rows.size());
+    for (const auto &row : sink.rows)
+      EXPECT_EQ((size_t)sink.w, row.size());
+  }
+  BoxSink empty;
+  EXPECT_EQ(0, text.draw(empty, aa::SANS_BOLD_19, "", 0, 0, 0xFFFF, 0));
+  EXPECT_EQ(aaTextWidth(aa::SANS_BOLD_19, "  "),
+            text.draw(empty, aa::SANS_BOLD_19, "  ", 0, 0, 0xFFFF, 0));
+  EXPECT_EQ(0, empty.windows);
+}
+
+TEST(AaText, EdgesBlendBetweenTheTwoColours) {
+  static AaTextRenderer text;
+  const uint16_t fg = 0xFFFF, bg = 0x18C5; // COLOR_BG_CARD
+  BoxSink sink;
+  text.draw(sink, aa::SANS_BOLD_32, "EMERGENCY", 0, 0, fg, bg);
+  int solid = 0, edge = 0, clear = 0;
+  for (const auto &row : sink.rows) {
+    for (uint16_t px : row) {
+      if (px == fg)
+        solid++;
+      else if (px == bg)
+        clear++;
+      else
+        edge++;
+    }
+  }
+  EXPECT_GT(solid, 0);
+  EXPECT_GT(edge, 0);
+  EXPECT_GT(clear, solid);
+  // Every row of the window crosses ink
+  for (const auto &row : sink.rows) {
+    bool ink = false;
+    for (uint16_t px : row)
+      ink |= px != bg;
+    EXPECT_TRUE(ink);
+  }
+  EXPECT_EQ(bg, aaBlend(fg, bg, 0));
+  EXPECT_EQ(fg, aaBlend(fg, bg, 15));
+}
+
+TEST(AaText, GlyphsFitTheLineAndKerningTightensPairs) {
+  for (const AaFont *font : AA_FONTS) {
+    for (int c = font->first; c <= font->last; c++) {
+      const AaGlyph *g = aaGlyph(*font, (char)c);
+      if (!g)
+        continue;
+      EXPECT_LE(g->top + g->height, font->height) << c;
+      EXPECT_GE(g->left + g->width, 0) << c;
+    }
+    for (uint16_t i = 1; i < font->kernCount; i++)
+      EXPECT_LT(font->kerns[i - 1].left << 8 | font->kerns[i - 1].right,
+                font->kerns[i].left << 8 | font->kerns[i].right);
+    EXPECT_LT(aaKern(*font, 'A', 'V'), 0);
+    EXPECT_LT(aaTextWidth(*font, "AV"),
+              aaTextWidth(*font, "A") + aaTextWidth(*font, "V"));
+    EXPECT_EQ(0, aaKern(*font, 'O', 'O'));
+  }
+  // The headline face only has capitals, digits and punctuation
+  EXPECT_EQ(nullptr, aaGlyph(aa::SANS_BOLD_32, 'a'));
+  EXPECT_EQ(aaTextWidth(aa::SANS_BOLD_32, "OK"),
+            aaTextWidth(aa::SANS_BOLD_32, "O~K"));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                               St7789Dma.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+/** The same primitives on the DMA driver and on the framebuffer panel. */
+void drawScene(Adafruit_GFX &gfx) {
+  gfx.fillScreen(0x18C5);
+  gfx.fillRect(10, 10, 300, 40, 0xF800);
+  gfx.fillRect(10, 60, 300, 40, 0x07E0); // Other colour: the other span
+  gfx.fillRect(-20, 200, 400, 100, 0x001F); // Clipped on three sides
+  gfx.fillRoundRect(40, 110, 120, 60, 12, 0xFFE0);
+  gfx.drawRoundRect(40, 110, 120, 60, 12, 0x0000);
+  gfx.fillCircle(240, 140, 30, 0xF81F);
+  gfx.drawCircle(240, 140, 36, 0xFFFF);
+  gfx.drawLine(0, 0, 319, 239, 0x7BEF);
+  gfx.fillTriangle(180, 20, 200, 90, 160, 90, 0x07FF);
+  for (int16_t i = 0; i < 60; i++) // Many tiny fills: the queue wraps
+    gfx.drawPixel((int16_t)(100 + i), (int16_t)(105 + (i & 3)),
+                  (uint16_t)(i * 0x0421));
+}
+
+uint16_t gradient(int16_t x, int16_t y) {
+  return (uint16_t)((x * 31 / 63) << 11 | (y * 63 / 47) << 5 | ((x ^ y) & 31));
+}
+
+} // namespace
+
+TEST(St7789Dma, PanelMatchesTheFramebufferDriver) {
+  host::Node node("tft");
+  host::NodeScope scope(node);
+  static St7789Dma tft(16, 4, 2, 240, 320);
+  ASSERT_TRUE(tft.begin(5, 17, 27));
+  Adafruit_ST7789 ref(16, 4, 2);
+  ref.init(240, 320);
+  tft.setRotation(1);
+  ref.setRotation(1);
+  drawScene(tft);
+  drawScene(ref);
+
+  static uint16_t block[64 * 48];
+  for (int16_t y = 0; y < 48; y++) {
+    for (int16_t x = 0; x < 64; x++) {
+      block[y * 64 + x] = gradient(x, y);
+      ref.drawPixel((int16_t)(250 + x), (int16_t)(180 + y), gradient(x, y));
+    }
+  }
+  tft.pushPixels(250, 180, 64, 48, block);
+  tft.flush();
+
+  EXPECT_EQ(0xA0, node.panel.madctl); // MY | MV, as Adafruit_ST7789
+  int diff = 0;
+  for (int16_t y = 0; y < 240; y++) {
+    for (int16_t x = 0; x < 320; x++)
+      diff += node.panel.pixel((uint16_t)x, (uint16_t)y) != ref.pixel(x, y);
+  }
+  EXPECT_EQ(0, diff);
+  EXPECT_EQ(0u, node.spi.misrouted);
+  EXPECT_EQ(tft.stats().transactions, node.spi.transactions - 2); // + RAMRD
+}
+
+TEST(St7789Dma, PrimitivesReturnBeforeTheBusIsDone) {
+  host::Node node("tft");
+  host::NodeScope scope(node);
+  static St7789Dma tft(16, 4, -1, 240, 320);
+  ASSERT_TRUE(tft.begin(5, 17, 27));
+  EXPECT_EQ(40000000u, tft.clockHz());
+  EXPECT_TRUE(tft.clockProbed());
+
+  const uint64_t stall = node.spi.stallUs, t0 = host::nowUs();
+  tft.fillRect(0, 0, 40, 50, 0xF800); // 2000 px, under the in-flight cap
+  EXPECT_EQ(stall, node.spi.stallUs);
+  EXPECT_EQ(t0, host::nowUs());
+  // 4000 bytes at 40 MHz is ~0.8 ms of bus time still to run
+  EXPECT_GT(node.spi.bus[HSPI_HOST].freeNs, t0 * 1000 + 750000);
+  EXPECT_EQ(0u, node.panel.pixel(39, 49)); // Nothing has been sent yet
+  tft.flush();
+  EXPECT_GE(host::nowUs(), t0 + 750);
+  EXPECT_EQ(0xF800, node.panel.pixel(39, 49));
+
+  // A full screen waits on the cap; it returns with only the tail queued,
+  // so the bus is never further ahead than ST7789_INFLIGHT_PIXELS
+  const uint64_t t1 = host::nowUs();
+  tft.fillScreen(0x001F);
+  EXPECT_GT(tft.stats().capWaits, 0u);
+  const uint64_t returned = host::nowUs();
+  EXPECT_GT(returned - t1, 14000u); // 150 KB at 40 MHz
+  EXPECT_LE(node.spi.bus[HSPI_HOST].freeNs,
+            returned * 1000 + ST7789_INFLIGHT_PIXELS * 16 * 25 + 50000);
+  tft.flush();
+  EXPECT_GT(host::nowUs(), returned);
+  EXPECT_EQ(0x001F, node.panel.pixel(239, 319));
+}
+
+TEST(St7789Dma, ProbeKeepsTheFastestClockThatReadsBack) {
+  {
+    host::Node node("slow");
+    host::NodeScope scope(node);
+    node.panel.maxWriteHz = 30000000; // A module that corrupts at 40 MHz
+    static St7789Dma tft(16, 4, -1, 240, 320);
+    ASSERT_TRUE(tft.begin(5, 17, 27));
+    EXPECT_EQ(26666667u, tft.clockHz());
+    EXPECT_TRUE(tft.clockProbed());
+    tft.fillRect(0, 0, 10, 10, 0x07E0);
+    tft.flush();
+    EXPECT_EQ(0x07E0, node.panel.pixel(9, 9));
+  }
+  {
+    host::Node node("nomiso");
+    host::NodeScope scope(node);
+    node.panel.misoWired = false;
+    static St7789Dma tft(16, 4, -1, 240, 320);
+    ASSERT_TRUE(tft.begin(5, -1, 27));
+    EXPECT_EQ((uint32_t)ST7789_FALLBACK_HZ, tft.clockHz());
+    EXPECT_FALSE(tft.clockProbed());
+  }
+}
+
+TEST(St7789Dma, ReleaseBusHandsThePinsBackToVspi) {
+  host::Node node("tft");
+  host::NodeScope scope(node);
+  static St7789Dma tft(16, 4, -1, 240, 320);
+  ASSERT_TRUE(tft.begin(5, 17, 27));
+  // begin() ends released, as the radio expects
+  EXPECT_EQ(VSPICLK_OUT_IDX, node.pinSignal[5]);
+  EXPECT_EQ(VSPID_OUT_IDX, node.pinSignal[27]);
+
+  tft.fillRect(0, 0, 100, 100, 0xFFFF);
+  EXPECT_EQ(HSPICLK_OUT_IDX, node.pinSignal[5]);
+  EXPECT_EQ(HSPID_OUT_IDX, node.pinSignal[27]);
+  tft.releaseBus(); // Drains first
+  EXPECT_EQ(0xFFFF, node.panel.pixel(99, 99));
+  EXPECT_EQ(VSPICLK_OUT_IDX, node.pinSignal[5]);
+  EXPECT_EQ(VSPID_OUT_IDX, node.pinSignal[27]);
+  EXPECT_EQ(0u, node.spi.misrouted);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                               SpiArbiter.h
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+int fifoReads = 0;
+
+bool dio0High(void *) { return digitalRead(19) == HIGH; }
+
+void readFifo(void *) {
+  if (LoRa.parsePacket()) {
+    LoRa.readString();
+    fifoReads++;
+  }
+  LoRa.receive();
+}
+
+/**
+ * Full-screen paints while 20 frames arrive 6 ms apart, under half a paint.
+ * Without an arbiter the FIFO is only read between paints.
+ */
+void paintWhileReceiving(host::Node &node, St7789Dma &tft,
+                         SpiArbiter *arbiter) {
+  fifoReads = 0;
+  LoRa.setPins(18, -1, 19);
+  ASSERT_EQ(1, LoRa.begin(433E6));
+  LoRa.receive();
+  if (arbiter) {
+    tft.attachArbiter(*arbiter);
+    arbiter->setRadio(dio0High, readFifo, nullptr);
+  }
+  ASSERT_TRUE(tft.begin(5, 17, 27));
+  for (int i = 0; i < 20; i++)
+    node.injectFrame("TX001,A", -80, 6000ULL * (uint64_t)(i + 1));
+  const uint64_t end = host::nowUs() + 140000;
+  for (uint16_t c = 1; host::nowUs() < end; c++) {
+    tft.fillScreen((uint16_t)(c * 0x0841));
+    if (!arbiter && dio0High(nullptr))
+      readFifo(nullptr);
+  }
+  tft.fillScreen(0xFFE0);
+  tft.flush();
+  EXPECT_EQ(0xFFE0, node.panel.pixel(239, 319)); // Preemption lost nothing
+}
+
+} // namespace
+
+TEST(SpiArbiter, RadioIsReadBetweenDisplaySlices) {
+  host::Node node("rx");
+  host::NodeScope scope(node);
+  static St7789Dma tft(16, 4, -1, 240, 320);
+  static SpiArbiter bus;
+  paintWhileReceiving(node, tft, &bus);
+  EXPECT_EQ(20, fifoReads);
+  EXPECT_EQ(0u, node.radio.overruns);
+  EXPECT_EQ(20u, bus.stats().grants);
+  EXPECT_GT(bus.stats().preemptions, 0u);
+  // One in-flight cap of bus time (~0.8 ms at 40 MHz) plus a slice
+  EXPECT_LT(bus.stats().maxPaintWaitUs, 1500u);
+  EXPECT_GT(bus.stats().polls, 100u);
+}
+
+TEST(SpiArbiter, WithoutItPaintsOverrunTheFifo) {
+  host::Node node("rx");
+  host::NodeScope scope(node);
+  static St7789Dma tft(16, 4, -1, 240, 320);
+  paintWhileReceiving(node, tft, nullptr);
+  EXPECT_GT(node.radio.overruns, 5u);
+  EXPECT_EQ(20, fifoReads + (int)node.radio.overruns);
+}
+
+TEST(SpiArbiter, RadioAccessWaitsForOnlyTheInFlightPixels) {
+  host::Node node("tx");
+  host::NodeScope scope(node);
+  static St7789Dma tft(16, 4, -1, 240, 320);
+  static SpiArbiter bus;
+  tft.attachArbiter(bus);
+  ASSERT_TRUE(tft.begin(5, 17, 27));
+  tft.fillScreen(0x07E0);
+  bus.radioAccess();
+  EXPECT_GT(bus.lastWaitUs(), 0u);
+  EXPECT_LT(bus.lastWaitUs(), 1000u);
+  EXPECT_EQ(VSPICLK_OUT_IDX, node.pinSignal[5]); // LoRa has the pins
+  EXPECT_EQ(0x07E0, node.panel.pixel(239, 319));
+}
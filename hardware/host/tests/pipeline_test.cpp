@@ -0,0 +1,446 @@
+/*
+ * End-to-end alert pipeline on the host shim: tx_pro keypad → LoRa channel
+ * → rx_pro gateway → a stand-in for API/Create/message.php.
+ *
+ * A Scenario lists the alerts to key in and what the world does to them:
+ * frames the channel loses or repeats, windows where the gateway's WiFi is
+ * down. The channel records what actually happened to every frame, so the
+ * expected API rows follow from the run itself and the test checks the
+ * rows the mock server recorded against them: each delivered alert once,
+ * in keying order, within the latency budget.
+ *
+ * What the firmware does not (yet) guarantee is asserted as such: a frame
+ * lost on air is gone (the TX has no acknowledgement). An alert that
+ * reaches the gateway during an outage waits in its retry lane and goes
+ * out once WiFi is back, without latency stamps; a repeat of it is still a
+ * duplicate.
+ *
+ * Both sketches are booted once per process; scenarios run one after the
+ * other on the same pair, starting from the TX menu and the RX idle screen.
+ */
+
+#include <HostSketch.h>
+#include <gtest/gtest.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <regex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace tx_pro {
+void setup();
+void loop();
+} // namespace tx_pro
+namespace rx_pro {
+void setup();
+void loop();
+} // namespace rx_pro
+
+namespace {
+
+const char *const API_PATH = "API/Create/message.php";
+const int TX_DEVICE_ID = 3; // DEVICE_ID in lifeline_tx_pro.ino
+
+bool contains(const std::string &haystack, const std::string &needle) {
+  return haystack.find(needle) != std::string::npos;
+}
+
+long jsonField(const std::string &body, const char *key) {
+  std::smatch m;
+  if (!std::regex_search(body, m,
+                         std::regex(std::string("\"") + key + "\":(\\d+)")))
+    return -1;
+  return atol(m[1].str().c_str());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                 SCENARIO
+// ═══════════════════════════════════════════════════════════════════════════
+
+struct Outage {
+  uint32_t fromMs, toMs; // Gateway WiFi down in [from, to)
+};
+
+struct Scenario {
+  std::string alerts;                  // Menu digits, one alert each
+  uint32_t spacingMs = 2500;           // Between the first keys of two alerts
+  std::set<int> lose;                  // Alert frames (1-based) lost on air
+  uint8_t lossPercent = 0;             // Plus random loss at this rate...
+  uint32_t seed = 1;                   // ...from this seed
+  std::set<int> repeat;                // Alert frames heard twice
+  uint32_t repeatDelayMs = 300;        // Second copy after this long
+  std::vector<Outage> outages;         // Relative to the scenario start
+  uint32_t keyToApiBudgetMs = 1600;    // First key → API request
+  uint32_t txUiBudgetMs = 100;         // k= field: confirm key → radio start
+  uint32_t tailMs = 3000;              // Settling time after the last alert
+};
+
+/** One alert frame as the channel saw it. */
+struct AirFrame {
+  std::string payload;
+  long seq = -1;
+  uint64_t sentUs = 0;
+  bool lost = false;
+  bool repeated = false;
+};
+
+/** One request the mock API server answered. */
+struct ApiRow {
+  long mid;
+  long did;
+  long code;
+  long txUiMs;
+  long gwMs;
+  uint64_t atUs;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                 PIPELINE
+// ═══════════════════════════════════════════════════════════════════════════
+
+class Pipeline {
+public:
+  /** The booted TX/RX pair shared by every scenario in this process. */
+  static Pipeline &get() {
+    static std::unique_ptr<Pipeline> instance(new Pipeline());
+    return *instance;
+  }
+
+  host::Sketch tx{"tx_pro", tx_pro::setup, tx_pro::loop};
+  host::Sketch rx{"rx_pro", rx_pro::setup, rx_pro::loop};
+
+  // Results of the last run()
+  std::vector<AirFrame> frames;
+  std::vector<ApiRow> rows;
+  std::vector<uint64_t> keyedUs; // When each alert's keys were queued
+  std::string rxLog;
+  uint64_t startUs = 0;
+
+  void run(const Scenario &s) {
+    frames.clear();
+    rows.clear();
+    keyedUs.clear();
+    rxLog.clear();
+    scenario_ = &s;
+    outages_ = s.outages;
+    rng_ = s.seed ? s.seed : 1;
+    startUs = txUs_ = rxUs_ = host::nowUs();
+    tx.node.radio.sent.clear();
+
+    for (size_t i = 0; i < s.alerts.size(); i++) {
+      runUntilMs((uint32_t)(i * s.spacingMs));
+      keyedUs.push_back(txUs_);
+      // Digit opens the confirm screen, '*' sends, '#' leaves the result
+      tx.node.pressKeys(std::string(1, s.alerts[i]) + "*#");
+    }
+    runUntilMs((uint32_t)(s.alerts.size() * s.spacingMs + s.tailMs));
+    setOutage(false);
+    scenario_ = nullptr;
+  }
+
+  /** True when the gateway's WiFi was down at t (absolute). */
+  bool outageAt(uint64_t t) const {
+    for (const Outage &o : outages_) {
+      if (t >= startUs + o.fromMs * 1000ULL && t < startUs + o.toMs * 1000ULL)
+        return true;
+    }
+    return false;
+  }
+
+private:
+  Pipeline() {
+    host::air().clear();
+    host::air().attach(tx.node);
+    host::air().attach(rx.node);
+    host::air().drop = [this](const host::Node &, const host::Node &,
+                              const host::RadioFrame &f) {
+      return onAir(f);
+    };
+
+    rx.node.nvs["lifeline"]["ssid"] = "base";
+    rx.node.nvs["lifeline"]["password"] = "secret";
+    // One TX sends every scenario back to back: the per-device rate limit
+    // is sized so it never steps in (sketch_test covers it)
+    rx.node.nvs["lifeline"]["rate_pm"] = "60";
+    rx.node.nvs["lifeline"]["rate_burst"] = "20";
+    rx.node.httpHandler = [this](const host::HttpRequest &req) {
+      return serve(req);
+    };
+
+    rx.begin();
+    tx.begin();
+    runFor(5000);
+    tx.node.takeSerial();
+    rx.node.takeSerial();
+  }
+
+  /** Channel model: decide the fate of a frame at TxDone. */
+  bool onAir(const host::RadioFrame &f) {
+    if (!scenario_ || f.payload.compare(0, 2, "TX") != 0)
+      return false; // Heartbeats and frames outside a scenario pass
+    AirFrame a;
+    a.payload = f.payload;
+    a.sentUs = f.sentUs;
+    std::smatch m;
+    if (std::regex_search(f.payload, m, std::regex(";s=(\\d+)")))
+      a.seq = atol(m[1].str().c_str());
+    const int n = (int)frames.size() + 1;
+    a.lost = scenario_->lose.count(n) != 0 ||
+             (scenario_->lossPercent && next() % 100 < scenario_->lossPercent);
+    a.repeated = !a.lost && scenario_->repeat.count(n) != 0;
+    if (a.repeated)
+      repeats_.push_back({f.payload, f.sentUs +
+                                         scenario_->repeatDelayMs * 1000ULL});
+    frames.push_back(a);
+    return a.lost;
+  }
+
+  /** The API/Create/message.php stand-in. */
+  host::HttpResponse serve(const host::HttpRequest &req) {
+    host::HttpResponse r;
+    const std::string &url = req.url;
+    if (req.method != "POST" || url.size() < strlen(API_PATH) ||
+        url.compare(url.size() - strlen(API_PATH), std::string::npos,
+                    API_PATH) != 0) {
+      r.status = 404;
+      return r;
+    }
+    ApiRow row;
+    row.mid = nextMid_++;
+    row.did = jsonField(req.body, "DID");
+    row.code = jsonField(req.body, "message_code");
+    row.txUiMs = jsonField(req.body, "tx_ui_ms");
+    row.gwMs = jsonField(req.body, "gw_ms");
+    row.atUs = req.atUs;
+    rows.push_back(row);
+    r.status = 201;
+    r.body = "{\"status\":\"success\",\"MID\":" + std::to_string(row.mid) + "}";
+    r.latencyMs = 60;
+    return r;
+  }
+
+  void setOutage(bool down) { rx.node.wifi.outage = down; }
+
+  /**
+   * Step both boards to ms after the scenario start, driving the world.
+   * Each board keeps its own time and the one behind runs next, so a board
+   * blocked for a time on air or a display flush does not hold the other
+   * back. The clock is left at the later of the two.
+   */
+  void runUntilMs(uint32_t ms) {
+    const uint64_t end = startUs + ms * 1000ULL;
+    while (txUs_ < end || rxUs_ < end) {
+      const bool txNext = txUs_ <= rxUs_;
+      uint64_t &at = txNext ? txUs_ : rxUs_;
+      host::setClockUs(at);
+      applyWorld();
+      (txNext ? tx : rx).step();
+      at = host::nowUs();
+      rxLog += rx.node.takeSerial();
+    }
+    host::setClockUs(std::max(txUs_, rxUs_));
+  }
+
+  /** Outage state and due repeats at the current time. */
+  void applyWorld() {
+    const uint64_t now = host::nowUs();
+    setOutage(outageAt(now));
+    for (size_t i = 0; i < repeats_.size();) {
+      if (repeats_[i].dueUs <= now) {
+        rx.node.injectFrame(repeats_[i].payload, host::air().rssi);
+        repeats_.erase(repeats_.begin() + i);
+      } else {
+        i++;
+      }
+    }
+  }
+
+  void runFor(uint32_t ms) {
+    startUs = txUs_ = rxUs_ = host::nowUs();
+    runUntilMs(ms);
+  }
+
+  uint32_t next() {
+    rng_ ^= rng_ << 13;
+    rng_ ^= rng_ >> 17;
+    rng_ ^= rng_ << 5;
+    return rng_;
+  }
+
+  struct Repeat {
+    std::string payload;
+    uint64_t dueUs;
+  };
+
+  const Scenario *scenario_ = nullptr;
+  std::vector<Outage> outages_; // Of the last run, for outageAt()
+  std::vector<Repeat> repeats_;
+  uint32_t rng_ = 1;
+  long nextMid_ = 1;
+  uint64_t txUs_ = 0, rxUs_ = 0; // Each board's own time in runUntilMs()
+};
+
+/**
+ * Run the scenario and check the API rows against what the channel let
+ * through. Alerts heard while the gateway had WiFi go out at once, in
+ * keying order; those heard during an outage go out after it. Returns the
+ * number of rows expected.
+ */
+size_t runAndCheck(const Scenario &s) {
+  Pipeline &p = Pipeline::get();
+  p.run(s);
+
+  // Every key was taken and made one frame with a fresh sequence number
+  EXPECT_TRUE(p.tx.node.keys.empty());
+  EXPECT_EQ(s.alerts.size(), p.frames.size());
+  if (p.frames.size() != s.alerts.size())
+    return 0;
+  for (size_t i = 1; i < p.frames.size(); i++)
+    EXPECT_GT(p.frames[i].seq, p.frames[i - 1].seq);
+
+  // Expected: every alert not lost on air. The first copy decides whether
+  // it went out at once or was held; a repeat is a duplicate either way.
+  std::vector<size_t> expected, held;
+  for (size_t i = 0; i < p.frames.size(); i++) {
+    if (p.frames[i].lost)
+      continue;
+    (p.outageAt(p.frames[i].sentUs) ? held : expected).push_back(i);
+  }
+
+  // Held alerts come from the retry lane with no latency stamps, most
+  // urgent first, so they are matched by alert code
+  std::vector<ApiRow> live;
+  std::multiset<long> heldCodes, heldRows;
+  for (size_t i : held)
+    heldCodes.insert(s.alerts[i] - '1');
+  for (const ApiRow &row : p.rows) {
+    if (row.gwMs >= 0) {
+      live.push_back(row);
+      continue;
+    }
+    heldRows.insert(row.code);
+    EXPECT_EQ(TX_DEVICE_ID, row.did);
+    EXPECT_FALSE(p.outageAt(row.atUs));
+  }
+  EXPECT_EQ(heldCodes, heldRows) << p.rxLog;
+
+  EXPECT_EQ(expected.size(), live.size()) << p.rxLog;
+  const size_t n = std::min(expected.size(), live.size());
+  for (size_t r = 0; r < n; r++) {
+    const size_t i = expected[r];
+    const ApiRow &row = live[r];
+    SCOPED_TRACE("alert " + std::to_string(i + 1) + ": " +
+                 p.frames[i].payload);
+    EXPECT_EQ(TX_DEVICE_ID, row.did);
+    EXPECT_EQ(s.alerts[i] - '1', row.code);
+    EXPECT_FALSE(p.outageAt(row.atUs));
+
+    const uint64_t keyToApiMs = (row.atUs - p.keyedUs[i]) / 1000;
+    EXPECT_LE(keyToApiMs, s.keyToApiBudgetMs);
+    EXPECT_GE(row.txUiMs, 0);
+    EXPECT_LE(row.txUiMs, (long)s.txUiBudgetMs);
+    EXPECT_GE(row.gwMs, 0);
+  }
+  for (size_t r = 1; r < p.rows.size(); r++)
+    EXPECT_GT(p.rows[r].atUs, p.rows[r - 1].atUs);
+
+  // Every repeat that reached the gateway was recognised
+  size_t repeats = 0;
+  for (const AirFrame &f : p.frames)
+    repeats += f.repeated ? 1 : 0;
+  size_t dropped = 0;
+  for (size_t pos = 0;
+       (pos = p.rxLog.find("[RX] Duplicate TX003", pos)) != std::string::npos;
+       pos++)
+    dropped++;
+  EXPECT_EQ(repeats, dropped);
+  return expected.size() + held.size();
+}
+
+} // namespace
+
+// ── Clean channel ───────────────────────────────────────────────────────────
+
+TEST(Pipeline, CleanChannelDeliversEveryAlertInOrder) {
+  Scenario s;
+  s.alerts = "12345";
+  EXPECT_EQ(5u, runAndCheck(s));
+}
+
+TEST(Pipeline, AlertsAsFastAsTheRadioAllowsKeepTheirOrder) {
+  Scenario s;
+  s.alerts = "9182";
+  s.spacingMs = 1500; // Time on air plus a few loop passes
+  EXPECT_EQ(4u, runAndCheck(s));
+}
+
+// ── Loss ────────────────────────────────────────────────────────────────────
+
+TEST(Pipeline, LostFramesAreMissingWithoutReordering) {
+  Scenario s;
+  s.alerts = "123456";
+  s.lose = {2, 5};
+  EXPECT_EQ(4u, runAndCheck(s));
+  EXPECT_TRUE(Pipeline::get().frames[1].lost);
+  EXPECT_TRUE(Pipeline::get().frames[4].lost);
+}
+
+TEST(Pipeline, RandomLossMatchesTheChannelRecord) {
+  Scenario s;
+  s.alerts = "3141592653";
+  s.spacingMs = 2000;
+  s.lossPercent = 30;
+  s.seed = 0xC0FFEE;
+  const size_t delivered = runAndCheck(s);
+  EXPECT_LT(delivered, s.alerts.size()); // The seed does lose some
+  EXPECT_GT(delivered, 0u);
+}
+
+// ── Dedupe ──────────────────────────────────────────────────────────────────
+
+TEST(Pipeline, RepeatedFramesAreUplinkedOnce) {
+  Scenario s;
+  s.alerts = "1234";
+  s.repeat = {1, 3, 4};
+  EXPECT_EQ(4u, runAndCheck(s));
+}
+
+// ── WiFi outages ────────────────────────────────────────────────────────────
+
+TEST(Pipeline, OutageHoldsUplinksUntilWiFiIsBack) {
+  Scenario s;
+  s.alerts = "12345";
+  s.outages = {{3000, 6500}}; // Alerts 2 and 3 arrive during it
+  EXPECT_EQ(5u, runAndCheck(s));
+  const std::string &log = Pipeline::get().rxLog;
+  EXPECT_TRUE(contains(log, "[API] WiFi not connected, alert held"));
+  EXPECT_TRUE(contains(log, "delivered after 1 attempts"));
+}
+
+TEST(Pipeline, AlertHeardDuringOutageIsUplinkedOnceDespiteItsRepeat) {
+  // The held alert goes out when WiFi returns; its repeat, heard after
+  // that, is still a duplicate
+  Scenario s;
+  s.alerts = "12";
+  s.outages = {{0, 2000}};
+  s.repeat = {1};
+  s.repeatDelayMs = 1000;
+  EXPECT_EQ(2u, runAndCheck(s));
+  EXPECT_EQ(2u, Pipeline::get().rows.size());
+}
+
+// ── Everything at once ──────────────────────────────────────────────────────
+
+TEST(Pipeline, LossRepeatsAndOutagesTogether) {
+  Scenario s;
+  s.alerts = "7162534";
+  s.lose = {3};
+  s.repeat = {1, 5};
+  s.outages = {{6000, 7000}, {13500, 14500}}; // Alerts 3 and 6 arrive
+  EXPECT_EQ(6u, runAndCheck(s));
+}
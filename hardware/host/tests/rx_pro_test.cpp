@@ -0,0 +1,510 @@
+/*
+ * lifeline_rx_pro, unmodified, as the gateway on the host shim: one test per
+ * feature.
+ *
+ * Sketch globals live for the whole process, so the gateway is booted once
+ * and shared by every test here, as pipeline_test does with its pair. ctest
+ * runs each test in its own process; run together, they run in the order
+ * below. Either way a test must pass, so each one uses its own devices and
+ * checks what it caused, not totals since boot, and leaves the gateway on
+ * the idle screen with nothing open.
+ */
+
+#include <HostSketch.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rx_pro {
+void setup();
+void loop();
+} // namespace rx_pro
+
+namespace {
+
+bool contains(const std::string &haystack, const std::string &needle) {
+  return haystack.find(needle) != std::string::npos;
+}
+
+uint16_t rgb565(int r, int g, int b) {
+  return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+/**
+ * The booted gateway and the API it talks to: a registry of 3, 6 and 9
+ * (tag "r1"), 404 for a POST from device 9 without auto_register until it
+ * is registered, and the next failure queued in nextStatus (or the next slow
+ * answer in nextLatencyMs).
+ */
+class Gateway {
+public:
+  static Gateway &get() {
+    static std::unique_ptr<Gateway> instance(new Gateway());
+    return *instance;
+  }
+
+  host::Sketch rx{"rx_pro", rx_pro::setup, rx_pro::loop};
+
+  std::string bootLog;
+  host::HttpRequest registryFetch; // The first request after WiFi came up
+  bool registered9 = false;
+  int nextStatus = 0;
+  uint32_t nextLatencyMs = 0; // Next POST answers this late
+
+  std::vector<host::HttpRequest> posts() const {
+    std::vector<host::HttpRequest> out;
+    for (const host::HttpRequest &req : rx.node.httpLog) {
+      if (req.method == "POST")
+        out.push_back(req);
+    }
+    return out;
+  }
+
+private:
+  Gateway() {
+    rx.node.nvs["lifeline"]["ssid"] = "base";
+    rx.node.nvs["lifeline"]["password"] = "secret";
+    rx.node.httpHandler = [this](const host::HttpRequest &req) {
+      return serve(req);
+    };
+    rx.begin();
+    bootLog = rx.node.takeSerial();
+    rx.runUntil([&] { return rx.node.wifi.connected; }, 5000);
+    rx.runUntil([&] { return !rx.node.httpLog.empty(); }, 1000);
+    if (!rx.node.httpLog.empty())
+      registryFetch = rx.node.httpLog.front();
+    rx.runUntil([&] { return rx.node.heap.frozen; }, 1000);
+    bootLog += rx.node.takeSerial();
+  }
+
+  host::HttpResponse serve(const host::HttpRequest &req) {
+    host::HttpResponse r;
+    if (contains(req.url, "/API/Read/registry.php")) {
+      const auto tag = req.headers.find("If-None-Match");
+      if (tag != req.headers.end() && tag->second == "\"r1\"") {
+        r.status = 304;
+        return r;
+      }
+      r.body = "{\"success\":true,\"data\":{\"count\":3,\"dids\":[3,6,9]}}";
+      r.headers["ETag"] = "\"r1\"";
+      return r;
+    }
+    if (nextLatencyMs) {
+      r.latencyMs = nextLatencyMs;
+      nextLatencyMs = 0;
+    }
+    if (nextStatus) {
+      r.status = nextStatus;
+      r.body = "{\"success\":false,\"message\":\"Try again\"}";
+      nextStatus = 0;
+      return r;
+    }
+    if (contains(req.body, "\"DID\":9,") && !registered9) {
+      if (!contains(req.body, "\"auto_register\":true")) {
+        r.status = 404;
+        r.body = "{\"success\":false,\"message\":\"Device not found\"}";
+        return r;
+      }
+      registered9 = true;
+    }
+    r.body = "{\"MID\":5}";
+    return r;
+  }
+};
+
+class RxPro : public ::testing::Test {
+protected:
+  RxPro() : gw(Gateway::get()), rx(gw.rx) {}
+
+  void SetUp() override {
+    ASSERT_TRUE(rx.node.wifi.connected);
+    rx.node.takeSerial();
+  }
+
+  // Whatever a test did ran after boot on static buffers; HTTPClient may
+  // allocate inside its LibraryHeap scope, nothing else may
+  void TearDown() override { EXPECT_EQ(0u, rx.node.heap.violations); }
+
+  /** A serial command and what the gateway printed for it. */
+  std::string command(const char *line) {
+    rx.node.typeLine(line);
+    rx.runFor(50);
+    return rx.node.takeSerial();
+  }
+
+  /** The BOOT button held for ms. */
+  void button(uint32_t ms) {
+    rx.node.pinLevel[0] = 0; // Pressed
+    rx.runFor(ms);
+    rx.node.pinLevel[0] = 1;
+    rx.runFor(50);
+  }
+
+  /** Acknowledge every open alert, which brings the idle screen back. */
+  void acknowledgeAll() {
+    for (int i = 0; i < 64 && !contains(command("inbox"), "[INBOX] 0 open");
+         i++)
+      command("ack");
+    rx.node.takeSerial();
+  }
+
+  Gateway &gw;
+  host::Sketch &rx;
+};
+
+} // namespace
+
+// ── Boot and uplink ─────────────────────────────────────────────────────────
+
+TEST_F(RxPro, BootsAndFetchesTheRegistry) {
+  EXPECT_TRUE(contains(gw.bootLog, "[OK] LoRa initialized"));
+  EXPECT_TRUE(contains(gw.bootLog, "Connecting to base in background"));
+
+  // The registry is fetched as soon as WiFi is up
+  EXPECT_EQ("GET", gw.registryFetch.method);
+  EXPECT_TRUE(contains(gw.registryFetch.url, "/API/Read/registry.php"));
+  EXPECT_EQ(0u, gw.registryFetch.headers.count("If-None-Match"));
+  EXPECT_TRUE(contains(gw.bootLog, "[REG] 3 registered devices"));
+}
+
+TEST_F(RxPro, UplinksAlertAndDropsDuplicate) {
+  const size_t before = gw.posts().size();
+  rx.node.injectFrame("TX003,A;k=120;s=7");
+  ASSERT_TRUE(rx.runUntil([&] { return gw.posts().size() > before; }, 1000));
+  const host::HttpRequest post = gw.posts().back();
+  EXPECT_TRUE(contains(post.body, "\"DID\":3"));
+  EXPECT_TRUE(contains(post.body, "\"message_code\":0"));
+  EXPECT_TRUE(contains(post.body, "\"tx_ui_ms\":120"));
+  EXPECT_FALSE(contains(post.body, "auto_register")); // 3 is registered
+  EXPECT_TRUE(contains(post.body, "\"link\":{\"rssi\":-60.0,\"snr\":9.5,"
+                                  "\"packets\":1,\"alerts\":1,\"lost\":0}"))
+      << post.body;
+
+  rx.runFor(200);
+  rx.node.injectFrame("TX003,A;k=120;s=7");
+  rx.runFor(200);
+  EXPECT_EQ(before + 1, gw.posts().size());
+  EXPECT_TRUE(contains(rx.node.takeSerial(), "Duplicate TX003 s=7 dropped"));
+  acknowledgeAll();
+}
+
+// ── Inbox ───────────────────────────────────────────────────────────────────
+
+TEST_F(RxPro, InboxKeepsAlertsUntilAcknowledged) {
+  // Both stay open; OTHER is less urgent, so the list comes up with the
+  // emergency on top instead of OTHER taking the screen
+  rx.node.typeLine("5,A");
+  rx.runFor(200);
+  rx.node.typeLine("12,O");
+  rx.runFor(200);
+  std::string log = rx.node.takeSerial();
+  EXPECT_TRUE(contains(log, "[SCREEN] Inbox: 2 open")) << log;
+  log = command("inbox");
+  EXPECT_TRUE(contains(log, "[INBOX] 2 open (1 critical)")) << log;
+  EXPECT_TRUE(contains(log, "[INBOX] 1. #")) << log;
+  EXPECT_LT(log.find("TX #005 EMERGENCY, "), log.find("TX #012 OTHER")) << log;
+  EXPECT_EQ(1, rx.node.pinLevel[13]); // Red LED: a critical alert is open
+
+  // BOOT button: press steps to row 2, a hold opens it, another hold
+  // acknowledges it
+  button(100);
+  button(1000);
+  log = rx.node.takeSerial();
+  EXPECT_TRUE(contains(log, "Alert displayed: Device 12")) << log;
+  button(1000);
+  log = rx.node.takeSerial();
+  EXPECT_TRUE(contains(log, "TX #012 OTHER EMERGENCY (1 still open)")) << log;
+  EXPECT_TRUE(contains(log, "[SCREEN] Inbox: 1 open")) << log;
+
+  // The serial keys do the same; the last one closed brings idle back
+  rx.node.typeLine("open");
+  rx.runFor(50);
+  rx.node.typeLine("ack");
+  rx.runFor(50);
+  log = rx.node.takeSerial();
+  EXPECT_TRUE(contains(log, "Alert displayed: Device 5")) << log;
+  EXPECT_TRUE(contains(log, "TX #005 EMERGENCY (0 still open)")) << log;
+  EXPECT_TRUE(contains(log, "Idle screen displayed")) << log;
+  EXPECT_EQ(0, rx.node.pinLevel[13]);
+  EXPECT_EQ(1, rx.node.pinLevel[21]);
+}
+
+TEST_F(RxPro, FullInboxShowsHowManyWereDropped) {
+  // 49 alerts of the same priority from 49 devices: the 49th finds the
+  // inbox full of alerts as urgent as itself and is not kept
+  for (int id = 100; id <= 148; id++) {
+    rx.node.typeLine(std::to_string(id) + ",F");
+    rx.runFor(100);
+  }
+  std::string log = rx.node.takeSerial();
+  EXPECT_TRUE(contains(log, "[INBOX] Full of more urgent alerts: TX #148")) << log;
+  log = command("inbox");
+  EXPECT_TRUE(contains(log, "[INBOX] 48 open")) << log;
+  EXPECT_TRUE(contains(log, "1 dropped")) << log;
+
+  // A critical alert still gets in: the newest of the others makes room,
+  // and both lost alerts are named, newest first
+  rx.node.typeLine("149,A");
+  rx.runFor(100);
+  log = rx.node.takeSerial();
+  EXPECT_TRUE(contains(log, "[INBOX] Full: TX #147 INJURY REPORTED dropped for "
+                            "TX #149 EMERGENCY"))
+      << log;
+  log = command("inbox");
+  EXPECT_TRUE(contains(log, "[INBOX] 48 open (1 critical)")) << log;
+  EXPECT_TRUE(contains(log, "[INBOX] Last lost: TX #147 code 5, TX #148 code 5\n"))
+      << log;
+
+  // The list's last row carries the count in red, and the devices it lost
+  // last (not checked: the shim draws no glyphs), also when drawn afresh
+  command("open");
+  log = command("back");
+  EXPECT_TRUE(contains(log, "[SCREEN] Inbox: 48 open, +2 dropped")) << log;
+  const int droppedRowY = 46 + 5 * 26; // CONTENT_START_Y + 5 rows (240x320)
+  EXPECT_EQ(rgb565(255, 59, 59), rx.node.panel.pixel(11, droppedRowY + 4));
+  EXPECT_EQ(rgb565(26, 26, 46), rx.node.panel.pixel(200, droppedRowY + 2));
+  acknowledgeAll();
+}
+
+// ── Link statistics ─────────────────────────────────────────────────────────
+
+TEST_F(RxPro, LinkScreenPutsTheWeakestDeviceFirst) {
+  // An alert and its duplicate both count on device 7's link
+  rx.node.injectFrame("TX007,B;s=1");
+  rx.runFor(200);
+  rx.node.injectFrame("TX007,B;s=1");
+  rx.runFor(200);
+  acknowledgeAll();
+
+  // A heartbeat at -17 dB SNR
+  host::RadioFrame hb;
+  hb.payload = "HB008;i=50;l=40;u=9";
+  hb.rssi = -121;
+  hb.snr = -17.0f;
+  hb.sentUs = hb.readyUs = host::nowUs();
+  rx.node.radio.inbox.push_back(hb);
+  rx.runFor(100);
+
+  const std::string log = command("links");
+  EXPECT_TRUE(contains(log, " devices (1 weak) of 48")) << log;
+  EXPECT_TRUE(contains(log, "[LINK] TX #008 WEAK -121.0 dBm, SNR -17.0 dB, "
+                            "1 frames, 0 alerts, 0 lost (0%), heard now, last -"))
+      << log;
+  EXPECT_TRUE(contains(log, "[LINK] TX #007 -60.0 dBm, SNR 9.5 dB, 2 frames, "
+                            "1 alerts"))
+      << log;
+  EXPECT_LT(log.find("TX #008"), log.find("TX #007"));
+
+  // A press on the idle screen opens it, a hold goes back
+  button(100);
+  const std::string screen = rx.node.takeSerial();
+  EXPECT_TRUE(contains(screen, "[SCREEN] Links: ")) << screen;
+  EXPECT_TRUE(contains(screen, ", 1 weak")) << screen;
+  button(1000);
+  EXPECT_TRUE(contains(rx.node.takeSerial(), "Idle screen displayed"));
+}
+
+// ── Device registry and uplink lane ─────────────────────────────────────────
+
+TEST_F(RxPro, UnknownDevicesAreAutoRegistered) {
+  // rx_pro is lenient: bare frames are fine, unknown codes become OTHER.
+  // Device 4 is not in the registry: its first alert asks to be registered
+  size_t before = gw.posts().size();
+  rx.node.injectFrame("4,ZZ;s=1");
+  ASSERT_TRUE(rx.runUntil([&] { return gw.posts().size() > before; }, 1000));
+  EXPECT_TRUE(contains(gw.posts().back().body, "\"DID\":4"));
+  EXPECT_TRUE(contains(gw.posts().back().body, "\"message_code\":14"));
+  EXPECT_TRUE(contains(gw.posts().back().body, "\"auto_register\":true"));
+  rx.runFor(100);
+  EXPECT_TRUE(contains(rx.node.takeSerial(), "[UPLINK] TX #004 auto-registered"));
+
+  // Device 9 was removed on the server after the registry was fetched: its
+  // 404 goes straight back out with auto_register, and the SOS is stored
+  before = gw.posts().size();
+  rx.node.typeLine("9,A");
+  ASSERT_TRUE(rx.runUntil([&] { return gw.registered9; }, 1000));
+  const std::vector<host::HttpRequest> sent = gw.posts();
+  ASSERT_EQ(before + 2, sent.size());
+  EXPECT_FALSE(contains(sent[before].body, "auto_register"));
+  EXPECT_TRUE(contains(sent.back().body, "\"DID\":9,"));
+  EXPECT_TRUE(contains(sent.back().body, "\"auto_register\":true"));
+  rx.runFor(100);
+  const std::string log = rx.node.takeSerial();
+  EXPECT_TRUE(contains(log, "TX #009 EMERGENCY queued (unknown device, attempt 1)")) << log;
+  EXPECT_TRUE(contains(log, "[UPLINK] TX #009 auto-registered")) << log;
+  acknowledgeAll();
+}
+
+TEST_F(RxPro, RetryableFailuresWaitInTheLane) {
+  // A 503 is retried after the backoff; a 400 is not retried at all
+  gw.nextStatus = 503;
+  rx.node.typeLine("3,B");
+  rx.runFor(1000);
+  EXPECT_TRUE(contains(rx.node.takeSerial(), "queued (retry, attempt 1)"));
+  const size_t before = gw.posts().size();
+  rx.runFor(1500);
+  EXPECT_EQ(before + 1, gw.posts().size());
+  std::string log = rx.node.takeSerial();
+  EXPECT_TRUE(contains(log, "TX #003 MEDICAL EMERGENCY delivered after 2 attempts")) << log;
+
+  gw.nextStatus = 400;
+  rx.node.typeLine("3,C");
+  rx.runFor(5000);
+  EXPECT_EQ(before + 2, gw.posts().size());
+  log = rx.node.takeSerial();
+  EXPECT_TRUE(contains(log, "refused (400), not retried")) << log;
+  log = command("uplink");
+  EXPECT_TRUE(contains(log, "[LANE] 0 waiting of 8")) << log;
+  acknowledgeAll();
+}
+
+TEST_F(RxPro, SlowApiTimesOutIntoTheLane) {
+  // Every request goes out with the short timeouts; an API that answers
+  // after 9 s holds the gateway for the read timeout, not the 9 s
+  gw.nextLatencyMs = 9000;
+  const size_t before = gw.posts().size();
+  rx.node.typeLine("6,B");
+  ASSERT_TRUE(rx.runUntil([&] { return gw.posts().size() > before; }, 1000));
+  const uint64_t sentUs = gw.posts().back().atUs;
+  EXPECT_EQ(3000u, gw.posts().back().connectTimeoutMs);
+  EXPECT_EQ(4000u, gw.posts().back().timeoutMs);
+  EXPECT_EQ(3000u, gw.registryFetch.connectTimeoutMs);
+  EXPECT_EQ(4000u, gw.registryFetch.timeoutMs);
+
+  ASSERT_TRUE(rx.runUntil([&] { return gw.posts().size() > before + 1; }, 10000));
+  EXPECT_LT(gw.posts().back().atUs - sentUs, 9000000u);
+  rx.runFor(200);
+  const std::string log = rx.node.takeSerial();
+  EXPECT_TRUE(contains(log, "queued (retry, attempt 1)")) << log;
+  EXPECT_TRUE(contains(log, "delivered after 2 attempts")) << log;
+  acknowledgeAll();
+}
+
+TEST_F(RxPro, RegistryIsRecheckedWithItsETag) {
+  // Five minutes on, the registry is checked again with its ETag: 304
+  rx.runFor(300000);
+  const host::HttpRequest &recheck = rx.node.httpLog.back();
+  EXPECT_EQ("GET", recheck.method);
+  EXPECT_EQ("\"r1\"", recheck.headers.at("If-None-Match"));
+  const std::string log = command("uplink");
+  EXPECT_TRUE(contains(log, " DIDs, etag \"r1\", checked ")) << log;
+  EXPECT_TRUE(contains(log, "1 loads, 1 not modified")) << log;
+}
+
+// ── Rate limit ──────────────────────────────────────────────────────────────
+
+TEST_F(RxPro, RateLimitSuppressesOnlyTheFloodingDevice) {
+  // TX #011 with a stuck key: 4 back to back, then suppressed and counted.
+  // A critical alert still gets through on the reserve and carries the count
+  const size_t before = gw.posts().size();
+  for (int i = 0; i < 6; i++) {
+    rx.node.typeLine("11,F");
+    rx.runFor(100);
+  }
+  EXPECT_EQ(before + 4, gw.posts().size());
+  std::string log = rx.node.takeSerial();
+  EXPECT_TRUE(contains(log, "[RATE] TX #011 over 6 alerts/min: suppressing")) << log;
+  rx.node.typeLine("11,A");
+  rx.runFor(100);
+  ASSERT_EQ(before + 5, gw.posts().size());
+  EXPECT_TRUE(contains(gw.posts().back().body, "\"suppressed\":2"))
+      << gw.posts().back().body;
+  log = rx.node.takeSerial();
+  EXPECT_TRUE(contains(log, "TX #011 EMERGENCY let through on the critical reserve")) << log;
+  EXPECT_TRUE(contains(log, "[RATE] TX #011: 2 alerts suppressed")) << log;
+
+  // Everyone else is unaffected
+  rx.node.typeLine("14,F");
+  rx.runFor(100);
+  EXPECT_EQ(before + 6, gw.posts().size());
+  rx.node.takeSerial();
+  log = command("rate");
+  EXPECT_TRUE(contains(log, "[RATE] 6/min per device, burst 4, critical +6")) << log;
+  EXPECT_TRUE(contains(log, "[RATE] TX #011 2 suppressed, 0 not reported yet")) << log;
+  EXPECT_FALSE(contains(log, "TX #014")) << log;
+  acknowledgeAll();
+}
+
+TEST_F(RxPro, QuietFloodReportsItsCountOnItsOwn) {
+  // TX #016 floods and then goes quiet: no alert of its own carries the
+  // count, so a minute later it is uplinked on its own
+  const size_t before = gw.posts().size();
+  for (int i = 1; i <= 7; i++) {
+    rx.node.injectFrame("TX016,F;s=" + std::to_string(i));
+    rx.runFor(300);
+  }
+  EXPECT_EQ(before + 4, gw.posts().size());
+  rx.runFor(50000);
+  EXPECT_EQ(before + 4, gw.posts().size()); // Not yet
+  ASSERT_TRUE(rx.runUntil([&] { return gw.posts().size() > before + 4; }, 15000));
+  const std::string body = gw.posts().back().body;
+  EXPECT_TRUE(contains(body, "\"DID\":16,\"message_code\":5,\"RSSI\":-60")) << body;
+  EXPECT_TRUE(contains(body, "\"suppressed\":3,\"suppressed_only\":true")) << body;
+  EXPECT_FALSE(contains(body, "latency")) << body;
+  const std::string log = rx.node.takeSerial();
+  EXPECT_TRUE(contains(log, "[RATE] TX #016: 3 alerts suppressed over the last 60 s, "
+                            "reported on their own"))
+      << log;
+
+  // Reported once
+  rx.runFor(70000);
+  EXPECT_EQ(before + 5, gw.posts().size());
+  EXPECT_TRUE(contains(command("rate"), "[RATE] TX #016 3 suppressed, 0 not reported yet"));
+  acknowledgeAll();
+}
+
+TEST_F(RxPro, PortalSetsTheRateLimits) {
+  // The WiFi portal (a 3 s hold, the AP gone) sets the limits; they apply
+  // at once, and a burst of 0 is refused
+  rx.node.wifi.apInRange = false;
+  button(3500);
+  ASSERT_TRUE(contains(rx.node.takeSerial(), "Portal started"));
+  const size_t before = rx.node.webResponses.size();
+  rx.node.webQueue.push_back(
+      {"/limits", {{"per_minute", "2"}, {"burst", "1"}, {"critical_burst", "0"}}});
+  rx.node.webQueue.push_back({"/limits", {{"per_minute", "2"}, {"burst", "0"}}});
+  rx.runFor(100);
+  ASSERT_EQ(before + 2, rx.node.webResponses.size());
+  EXPECT_EQ(200, rx.node.webResponses[before].status);
+  EXPECT_EQ(400, rx.node.webResponses[before + 1].status);
+  EXPECT_EQ("2", rx.node.nvs["lifeline"]["rate_pm"]);
+  EXPECT_EQ("1", rx.node.nvs["lifeline"]["rate_burst"]);
+  EXPECT_EQ("0", rx.node.nvs["lifeline"]["rate_crit"]);
+  EXPECT_TRUE(contains(rx.node.takeSerial(),
+                       "[RATE] Saved: 2 alerts/min per device, burst 1, critical +0"));
+
+  // Defaults back, the portal closed and WiFi up again for the next test
+  rx.node.webQueue.push_back(
+      {"/limits", {{"per_minute", "6"}, {"burst", "4"}, {"critical_burst", "6"}}});
+  rx.runFor(100);
+  rx.node.wifi.apInRange = true;
+  button(3500);
+  ASSERT_TRUE(rx.runUntil([&] { return rx.node.wifi.connected; }, 5000));
+  rx.runFor(100);
+  EXPECT_TRUE(contains(command("rate"), "[RATE] 6/min per device, burst 4"));
+}
+
+// ── Memory budget ───────────────────────────────────────────────────────────
+
+TEST_F(RxPro, HeapIsFrozenAndEveryBlockIsBooked) {
+  EXPECT_TRUE(rx.node.heap.frozen);
+  EXPECT_TRUE(rx.node.heap.trap);
+  // An uplink allocates, inside HTTPClient only (see TearDown)
+  const uint64_t allocs = rx.node.heap.allocs;
+  rx.node.typeLine("15,D");
+  rx.runFor(200);
+  EXPECT_GT(rx.node.heap.allocs, allocs);
+  acknowledgeAll();
+
+  const std::string mem = command("mem");
+  for (const char *block :
+       {"alert history", "alert inbox", "uplink body", "uplink reply",
+        "device registry", "uplink lane", "dedupe filter", "link stats",
+        "rate limiter", "latency log", "rx frames", "wifi creds",
+        "serial input"})
+    EXPECT_TRUE(contains(mem, std::string("[MEM] ") + block)) << block;
+  EXPECT_FALSE(contains(mem, "more blocks")) << mem;
+  EXPECT_TRUE(contains(mem, "drift 0 B")) << mem;
+}
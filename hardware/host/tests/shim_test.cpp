@@ -0,0 +1,359 @@
+/*
+ * The Arduino shim itself: if these drift from the real core the sketch
+ * tests stop meaning anything.
+ */
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <HostSketch.h>
+#include <LoRa.h>
+#include <LifelineCore.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <gtest/gtest.h>
+#include <soc/gpio_reg.h>
+#include <soc/soc.h>
+
+namespace {
+
+/** Fresh node made current for the test; the clock keeps running. */
+class ShimTest : public ::testing::Test {
+protected:
+  ShimTest() : scope_(node) {}
+
+  host::Node node{"shim"};
+
+private:
+  host::NodeScope scope_;
+};
+
+} // namespace
+
+// ── Clock ───────────────────────────────────────────────────────────────────
+
+TEST_F(ShimTest, ClockOnlyMovesWhenTold) {
+  const unsigned long t0 = micros();
+  EXPECT_EQ(t0, micros());
+  delay(5);
+  EXPECT_EQ(t0 + 5000, micros());
+  delayMicroseconds(7);
+  yield();
+  EXPECT_EQ(t0 + 5007 + HOST_YIELD_US, micros());
+}
+
+// ── Serial ──────────────────────────────────────────────────────────────────
+
+TEST_F(ShimTest, SerialCapturesOutputAndReplaysInput) {
+  Serial.printf("a=%d ", 3);
+  Serial.println(F("ok"));
+  Serial.print(2.5f, 1);
+  EXPECT_EQ("a=3 ok\r\n2.5", node.takeSerial());
+  EXPECT_EQ("", node.takeSerial());
+
+  node.typeLine("lat");
+  EXPECT_EQ(4, Serial.available());
+  EXPECT_EQ("lat", std::string(Serial.readStringUntil('\n').c_str()));
+  EXPECT_EQ(0, Serial.available());
+}
+
+// ── GPIO ────────────────────────────────────────────────────────────────────
+
+TEST_F(ShimTest, RegisterWritesDriveSeveralPins) {
+  REG_WRITE(GPIO_OUT_W1TS_REG, (1UL << 4) | (1UL << 21));
+  REG_WRITE(GPIO_OUT1_W1TS_REG, 1UL << (46 - 32));
+  EXPECT_EQ(HIGH, digitalRead(4));
+  EXPECT_EQ(HIGH, digitalRead(21));
+  EXPECT_EQ(HIGH, digitalRead(46));
+
+  REG_WRITE(GPIO_OUT_W1TC_REG, 1UL << 4);
+  EXPECT_EQ(LOW, digitalRead(4));
+  EXPECT_EQ(1UL << 21, REG_READ(GPIO_OUT_REG));
+
+  int seen = 0;
+  node.pinListeners.push_back(
+      [&](host::Node &, uint8_t, uint8_t) { seen++; });
+  REG_WRITE(GPIO_OUT_REG, 0x3);
+  EXPECT_EQ(3, seen); // 0 and 1 set, 21 cleared
+}
+
+// ── LoRa ────────────────────────────────────────────────────────────────────
+
+TEST_F(ShimTest, LoRaTransmitBlocksForTimeOnAir) {
+  ASSERT_EQ(1, LoRa.begin(433E6));
+  LoRa.setSpreadingFactor(7);
+  LoRa.setSignalBandwidth(125E3);
+  LoRa.enableCrc();
+
+  const uint64_t t0 = host::nowUs();
+  LoRa.beginPacket();
+  LoRa.print("TX003,A;s=1");
+  ASSERT_EQ(1, LoRa.endPacket());
+  ASSERT_EQ(1u, node.radio.sent.size());
+  EXPECT_EQ("TX003,A;s=1", node.radio.sent[0].payload);
+  EXPECT_EQ(t0 + lifeline::loraTimeOnAirUs(11, 7, 125000),
+            node.radio.sent[0].sentUs);
+  EXPECT_EQ(node.radio.sent[0].sentUs, host::nowUs());
+
+  node.radio.failTx = true;
+  LoRa.beginPacket();
+  LoRa.print("x");
+  EXPECT_EQ(0, LoRa.endPacket());
+}
+
+TEST_F(ShimTest, LoRaReceiveHonoursReadyTime) {
+  ASSERT_EQ(1, LoRa.begin(433E6));
+  node.injectFrame("TX001,B", -88, 2000);
+  EXPECT_EQ(0, LoRa.parsePacket());
+  delay(2);
+  ASSERT_EQ(7, LoRa.parsePacket());
+  EXPECT_EQ(-88, LoRa.packetRssi());
+  EXPECT_EQ("TX001,B", std::string(LoRa.readString().c_str()));
+  EXPECT_EQ(0, LoRa.parsePacket());
+
+  node.injectFrame("lost");
+  LoRa.sleep();
+  EXPECT_EQ(0, LoRa.parsePacket());
+}
+
+TEST_F(ShimTest, LoRaDio0RisesAtRxDoneAndTheFifoHoldsOneFrame) {
+  LoRa.setPins(18, 14, 19);
+  ASSERT_EQ(1, LoRa.begin(433E6));
+  EXPECT_EQ(LOW, digitalRead(19));
+  node.injectFrame("first", -70, 1000);
+  node.injectFrame("second", -71, 3000);
+  delay(1);
+  EXPECT_EQ(HIGH, digitalRead(19));
+  ASSERT_EQ(5, LoRa.parsePacket());
+  EXPECT_EQ(LOW, digitalRead(19)); // Read before the next RxDone
+  delay(2);
+  EXPECT_EQ(HIGH, digitalRead(19));
+  ASSERT_EQ(6, LoRa.parsePacket());
+  EXPECT_EQ(0u, node.radio.overruns);
+
+  // Not read in time: the later frame overwrites the earlier one
+  node.injectFrame("third", -72, 1000);
+  node.injectFrame("fourth", -73, 2000);
+  delay(3);
+  ASSERT_EQ(6, LoRa.parsePacket());
+  EXPECT_EQ("fourth", std::string(LoRa.readString().c_str()));
+  EXPECT_EQ(1u, node.radio.overruns);
+}
+
+TEST(Air, DeliversToOtherNodesUnlessDropped) {
+  host::Node a("a"), b("b"), c("c");
+  host::air().clear();
+  host::air().attach(a);
+  host::air().attach(b);
+  host::air().attach(c);
+  host::air().drop = [](const host::Node &, const host::Node &to,
+                        const host::RadioFrame &) { return to.name == "c"; };
+
+  {
+    host::NodeScope scope(a);
+    LoRa.begin(433E6);
+    LoRa.beginPacket();
+    LoRa.print("hello");
+    LoRa.endPacket();
+  }
+  {
+    host::NodeScope scope(b);
+    EXPECT_EQ(5, LoRa.parsePacket());
+    EXPECT_EQ(host::air().rssi, LoRa.packetRssi());
+  }
+  {
+    host::NodeScope scope(c);
+    EXPECT_EQ(0, LoRa.parsePacket());
+  }
+  {
+    host::NodeScope scope(a);
+    EXPECT_EQ(0, LoRa.parsePacket()); // No echo to the sender
+  }
+  EXPECT_EQ(1u, host::air().delivered);
+  EXPECT_EQ(1u, host::air().lost);
+  host::air().clear();
+}
+
+// ── WiFi / HTTP ─────────────────────────────────────────────────────────────
+
+TEST_F(ShimTest, WiFiAssociatesAfterDelay) {
+  node.wifi.ssid = "base";
+  node.wifi.password = "secret";
+  node.wifi.associateMs = 800;
+
+  WiFi.mode(WIFI_STA);
+  WiFi.begin("base", "wrong");
+  delay(1000);
+  EXPECT_NE(WL_CONNECTED, WiFi.status());
+
+  WiFi.begin("base", "secret");
+  delay(799);
+  EXPECT_NE(WL_CONNECTED, WiFi.status());
+  delay(1);
+  EXPECT_EQ(WL_CONNECTED, WiFi.status());
+  EXPECT_EQ("base", std::string(WiFi.SSID().c_str()));
+
+  node.wifi.outage = true;
+  EXPECT_EQ(WL_CONNECTION_LOST, WiFi.status());
+}
+
+TEST_F(ShimTest, HttpGoesToHandlerAndTakesItsLatency) {
+  node.wifi.associateMs = 0;
+  WiFi.begin("any", "any");
+  ASSERT_EQ(WL_CONNECTED, WiFi.status());
+  node.httpHandler = [](const host::HttpRequest &req) {
+    host::HttpResponse r;
+    r.status = req.headers.count("Content-Type") ? 201 : 400;
+    r.body = req.body;
+    r.latencyMs = 75;
+    return r;
+  };
+
+  HTTPClient http;
+  http.begin("http://api.local/alerts");
+  http.addHeader("Content-Type", "application/json");
+  const uint64_t t0 = host::nowUs();
+  EXPECT_EQ(201, http.POST("{\"DID\":3}"));
+  EXPECT_EQ(t0 + 75000, host::nowUs());
+  EXPECT_EQ("{\"DID\":3}", std::string(http.getString().c_str()));
+  http.end();
+  ASSERT_EQ(1u, node.httpLog.size());
+  EXPECT_EQ("http://api.local/alerts", node.httpLog[0].url);
+
+  node.wifi.outage = true;
+  http.begin("http://api.local/alerts");
+  EXPECT_EQ(HTTPC_ERROR_CONNECTION_REFUSED, http.POST("{}"));
+  http.end();
+  EXPECT_EQ(2u, node.httpLog.size()); // Attempts are logged, served or not
+}
+
+TEST_F(ShimTest, HttpGivesUpAtTheClientTimeouts) {
+  node.wifi.associateMs = 0;
+  WiFi.begin("any", "any");
+  ASSERT_EQ(WL_CONNECTED, WiFi.status());
+  node.httpHandler = [](const host::HttpRequest &) {
+    host::HttpResponse r;
+    r.latencyMs = 9000;
+    return r;
+  };
+
+  HTTPClient http;
+  http.begin("http://api.local/alerts");
+  http.setConnectTimeout(1500);
+  http.setTimeout(2500);
+  uint64_t t0 = host::nowUs();
+  EXPECT_EQ(HTTPC_ERROR_READ_TIMEOUT, http.GET());
+  EXPECT_EQ(t0 + 2500000, host::nowUs());
+  ASSERT_EQ(1u, node.httpLog.size());
+  EXPECT_EQ(1500u, node.httpLog[0].connectTimeoutMs);
+  EXPECT_EQ(2500u, node.httpLog[0].timeoutMs);
+
+  // No server answering: the connect timeout applies
+  node.httpHandler = nullptr;
+  t0 = host::nowUs();
+  EXPECT_EQ(HTTPC_ERROR_CONNECTION_REFUSED, http.GET());
+  EXPECT_EQ(t0 + 1500000, host::nowUs());
+  http.end();
+}
+
+// ── NVS ─────────────────────────────────────────────────────────────────────
+
+TEST_F(ShimTest, PreferencesPersistPerNamespace) {
+  Preferences prefs;
+  prefs.begin("lifeline");
+  prefs.putString("ssid", "base");
+  prefs.putUShort("seq", 513);
+  prefs.end();
+
+  prefs.begin("lifeline", true);
+  EXPECT_EQ("base", std::string(prefs.getString("ssid").c_str()));
+  EXPECT_EQ(513, prefs.getUShort("seq"));
+  EXPECT_EQ(0u, prefs.putString("ssid", "other")); // Read-only
+  prefs.end();
+
+  prefs.begin("other");
+  EXPECT_FALSE(prefs.isKey("ssid"));
+  prefs.end();
+  EXPECT_EQ("base", node.nvs["lifeline"]["ssid"]);
+}
+
+// ── Heap ────────────────────────────────────────────────────────────────────
+
+namespace heap_sketch {
+std::string *kept = nullptr;
+bool viaLibrary = false;
+// volatile so the compiler cannot elide the new/delete pair
+void churn() {
+  int *volatile p = new int(1);
+  delete p;
+}
+void setup() { kept = new std::string(64, 'x'); } // Before the freeze: fine
+void loop() {
+  if (viaLibrary) {
+    lifeline::LibraryHeap library;
+    churn();
+  } else {
+    churn();
+  }
+  Serial.println("only the shim allocates for this line");
+}
+} // namespace heap_sketch
+
+TEST(Heap, AllocationAfterFreezeIsViolationOutsideLibrary) {
+  host::Sketch sketch("heap", heap_sketch::setup, heap_sketch::loop);
+  sketch.begin();
+  sketch.step();
+  EXPECT_EQ(0u, sketch.node.heap.allocs); // Not frozen yet
+
+  {
+    host::NodeScope scope(sketch.node);
+    host::heapFreeze(false);
+  }
+  heap_sketch::viaLibrary = true;
+  sketch.step();
+  EXPECT_EQ(1u, sketch.node.heap.allocs);
+  EXPECT_EQ(0u, sketch.node.heap.violations);
+
+  heap_sketch::viaLibrary = false;
+  sketch.step();
+  EXPECT_EQ(2u, sketch.node.heap.allocs);
+  EXPECT_EQ(1u, sketch.node.heap.violations);
+
+  // Test code outside the sketch is never counted
+  heap_sketch::churn();
+  EXPECT_EQ(2u, sketch.node.heap.allocs);
+  delete heap_sketch::kept;
+}
+
+namespace printf_sketch {
+int width = 0;
+void setup() {}
+void loop() { Serial.printf("%*s", width, "x"); }
+} // namespace printf_sketch
+
+TEST(Heap, PrintfAllocatesOnlyForLongOutput) {
+  host::Sketch sketch("printf", printf_sketch::setup, printf_sketch::loop);
+  sketch.begin();
+  {
+    host::NodeScope scope(sketch.node);
+    host::heapFreeze(false);
+  }
+  printf_sketch::width = 63;
+  sketch.step();
+  EXPECT_EQ(0u, sketch.node.heap.violations);
+  printf_sketch::width = 64; // Past the core's 64-byte stack buffer
+  sketch.step();
+  EXPECT_EQ(1u, sketch.node.heap.violations);
+}
+
+TEST_F(ShimTest, PreferencesCopyStringIntoBuffer) {
+  node.nvs["lifeline"]["ssid"] = "base";
+  Preferences prefs;
+  prefs.begin("lifeline", true);
+  char buf[8];
+  EXPECT_EQ(5u, prefs.getString("ssid", buf, sizeof(buf)));
+  EXPECT_STREQ("base", buf);
+  char tiny[4];
+  EXPECT_EQ(0u, prefs.getString("ssid", tiny, sizeof(tiny)));
+  EXPECT_EQ(0u, prefs.getString("missing", buf, sizeof(buf)));
+  prefs.end();
+}
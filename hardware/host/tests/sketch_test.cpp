@@ -0,0 +1,202 @@
+/*
+ * The LifeLine sketches, unmodified, running on the host shim. The gateway,
+ * lifeline_rx_pro, has one test per feature in rx_pro_test.cpp.
+ *
+ * Sketch globals live for the whole process, so each sketch is booted by
+ * exactly one test; a test walks it through a whole scenario.
+ */
+
+#include <HostSketch.h>
+#include <gtest/gtest.h>
+
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace tx_pro {
+void setup();
+void loop();
+} // namespace tx_pro
+namespace rx_ili9488 {
+void setup();
+void loop();
+} // namespace rx_ili9488
+namespace esp32txs {
+void setup();
+void loop();
+} // namespace esp32txs
+
+namespace {
+
+bool contains(const std::string &haystack, const std::string &needle) {
+  return haystack.find(needle) != std::string::npos;
+}
+
+/** LifelineRX_ILI9488's 8-bit bus into node.panel: WR 22, RS (DC) 21. */
+void decodeRxIli9488Bus(host::Node &node) {
+  static const uint8_t DATA[8] = {33, 32, 13, 12, 14, 27, 26, 25};
+  node.pinListeners.push_back([](host::Node &n, uint8_t pin, uint8_t level) {
+    if (pin != 22 || !level)
+      return;
+    uint8_t b = 0;
+    for (int i = 0; i < 8; i++)
+      b |= (uint8_t)(n.pinLevel[DATA[i]] << i);
+    host::panelWrite(n, &b, 1, !n.pinLevel[21], 0);
+  });
+}
+
+uint16_t rgb565(int r, int g, int b) {
+  return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+} // namespace
+
+TEST(TxPro, KeypadAlertBecomesFrame) {
+  host::Sketch tx("tx_pro", tx_pro::setup, tx_pro::loop);
+  tx.begin();
+  tx.runFor(3000);
+  ASSERT_TRUE(tx.node.radio.sent.empty());
+
+  tx.node.pressKeys("2*");
+  ASSERT_TRUE(tx.runUntil([&] { return !tx.node.radio.sent.empty(); },
+                          10000));
+  const std::string &frame = tx.node.radio.sent.front().payload;
+  EXPECT_TRUE(std::regex_match(frame, std::regex("TX003,B;k=\\d+;s=\\d+")))
+      << frame;
+}
+
+TEST(RxIli9488, LogsReceivedAlert) {
+  host::Sketch rx("rx_ili9488", rx_ili9488::setup, rx_ili9488::loop);
+  decodeRxIli9488Bus(rx.node);
+  rx.begin();
+  rx.runFor(3000);
+  rx.node.takeSerial();
+
+  std::string log;
+  rx.node.injectFrame("TX003,A;k=120;s=7");
+  EXPECT_TRUE(rx.runUntil(
+      [&] {
+        log += rx.node.takeSerial();
+        return contains(log, "[ALERT] Device=3, Alert=EMERGENCY");
+      },
+      2000))
+      << log;
+
+  // Readable first: band and word are up, the idle stats card underneath
+  // is still there and the priority badge is not drawn yet
+  const uint16_t card = rgb565(26, 26, 46), bg = rgb565(13, 13, 15);
+  const uint16_t band = rx.node.panel.pixel(5, 5);
+  EXPECT_NE(rgb565(10, 25, 41), band);
+  EXPECT_EQ(card, rx.node.panel.pixel(50, 250));
+  EXPECT_NE(band, rx.node.panel.pixel(17, 62));
+  rx.runFor(100);
+  EXPECT_EQ(bg, rx.node.panel.pixel(50, 250));
+  EXPECT_EQ(band, rx.node.panel.pixel(17, 62));
+  EXPECT_EQ(band, rx.node.panel.pixel(304, 120)); // Card border
+  EXPECT_EQ(bg, rx.node.panel.pixel(319, 479));
+
+  // An alert arriving mid-screen replaces the rest of the first one
+  log.clear();
+  rx.node.injectFrame("TX006,A;s=20");
+  rx.node.injectFrame("TX007,A;s=21", -60, 100000);
+  EXPECT_TRUE(rx.runUntil(
+      [&] {
+        log += rx.node.takeSerial();
+        return contains(log, "[ALERT] Device=7");
+      },
+      5000))
+      << log;
+  rx.runFor(100);
+  rx.node.typeLine("ui");
+  rx.runFor(50);
+  const std::string ui = rx.node.takeSerial();
+  EXPECT_TRUE(contains(ui, "3 screens")) << ui;
+  EXPECT_TRUE(contains(ui, "1 preempted")) << ui;
+  EXPECT_EQ(bg, rx.node.panel.pixel(50, 250));
+
+  // Same parser policy as rx_pro: a bare frame is an alert, and an
+  // unknown code is shown as OTHER rather than dropped
+  log.clear();
+  rx.node.injectFrame("5,B;s=1");
+  rx.node.injectFrame("TX005,ZZ;s=2", -60, 100000);
+  EXPECT_TRUE(rx.runUntil(
+      [&] {
+        log += rx.node.takeSerial();
+        return contains(log, "[ALERT] Device=5, Alert=OTHER");
+      },
+      5000))
+      << log;
+  EXPECT_TRUE(contains(log, "[ALERT] Device=5, Alert=MEDICAL"));
+  EXPECT_TRUE(contains(log, "Unknown alert code, defaulting to OTHER"));
+  rx.runFor(100);
+
+  // Nepali alert words: kept in NVS, next card is drawn from UiTextNe.h
+  rx.node.typeLine("lang ne");
+  rx.runFor(50);
+  EXPECT_TRUE(contains(rx.node.takeSerial(), "[OK] Alert words in Nepali"));
+  EXPECT_EQ(1u, rx.node.nvs["lifeline"].count("lang"));
+  log.clear();
+  rx.node.injectFrame("TX004,D;s=8");
+  EXPECT_TRUE(rx.runUntil(
+      [&] {
+        log += rx.node.takeSerial();
+        return contains(log, "[ALERT] Device=4");
+      },
+      2000))
+      << log;
+}
+
+TEST(Esp32Txs, ConfirmedAlertIsTransmitted) {
+  host::Sketch tx("esp32txs", esp32txs::setup, esp32txs::loop);
+  tx.begin();
+  const std::string boot = tx.node.takeSerial();
+  EXPECT_TRUE(contains(boot, "[INIT] Ready"));
+  EXPECT_TRUE(contains(boot, "i80 DMA @ 20 MHz")) << boot;
+  EXPECT_GT(tx.node.lcd.transfers, 0u);
+  tx.runFor(3000);
+  host::lcdDrain(tx.node);
+  std::vector<uint16_t> menu(480 * 320);
+  for (int y = 0; y < 320; y++) {
+    for (int x = 0; x < 480; x++)
+      menu[y * 480 + x] = tx.node.panel.pixel(x, y);
+  }
+
+  // Menu: '*' selects the highlighted alert, '*' again confirms it
+  tx.node.pressKeys("**");
+  ASSERT_TRUE(tx.runUntil(
+      [&] {
+        for (const host::RadioFrame &f : tx.node.radio.sent) {
+          if (f.payload.rfind("TX", 0) == 0)
+            return true;
+        }
+        return false;
+      },
+      10000));
+
+  // The result screen times out to the menu, which comes back from PSRAM
+  tx.runFor(4000);
+  host::lcdDrain(tx.node);
+  for (int y = 0; y < 320; y++) {
+    for (int x = 0; x < 480; x++)
+      ASSERT_EQ(menu[y * 480 + x], tx.node.panel.pixel(x, y)) << x << "," << y;
+  }
+  // Down and up again: the list field is restored from the baked background
+  // (the key debug line stays in the bottom 15 rows)
+  tx.node.pressKeys("BA");
+  tx.runFor(1000);
+  host::lcdDrain(tx.node);
+  for (int y = 0; y < 305; y++) {
+    for (int x = 0; x < 480; x++)
+      ASSERT_EQ(menu[y * 480 + x], tx.node.panel.pixel(x, y)) << x << "," << y;
+  }
+  tx.node.takeSerial();
+  for (char c : std::string("ui\n"))
+    tx.node.serialIn.push_back(c);
+  tx.runFor(100);
+  const std::string ui = tx.node.takeSerial();
+  std::smatch m;
+  ASSERT_TRUE(std::regex_search(
+      ui, m, std::regex("screen cache: 4 x 300 KB PSRAM, (\\d+) hits")))
+      << ui;
+  EXPECT_GE(std::stoi(m[1]), 1) << ui;
+}
@@ -0,0 +1,341 @@
+/*
+ * Bake the esp32txs screen backgrounds into ScreenBackgrounds.h.
+ *
+ *   bake_screens --write "hardware ili9488/esp32txs/ScreenBackgrounds.h"
+ *   bake_screens --check "hardware ili9488/esp32txs/ScreenBackgrounds.h"
+ *
+ * Boots the sketch on the host shim and runs its draw*Background()
+ * functions against the virtual ILI9488. Each frame read back becomes a
+ * run-length image (PanelImage.h). The fields drawn over a background are
+ * drawn for every alert and language; the pixels that change give the
+ * field's rectangle. A background must paint the whole screen: it is
+ * drawn over two different fills and both results must match.
+ *
+ * --check exits 1 when the header differs from what the sketch draws now.
+ */
+
+#include <HostSketch.h>
+#include <PanelImage.h>
+#include <UiText.h>
+#include <UiTextNe.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace esp32txs {
+void setup();
+void loop();
+void updateMenuScroll();
+void drawMenuBackground();
+void drawConfirmBackground();
+void drawSendingBackground();
+void drawResultSentBackground();
+void drawResultFailedBackground();
+void drawMenuId();
+void drawMenuRange();
+void drawMenuList();
+void drawConfirmCard();
+void drawSendingAlert();
+void drawResultSentAlert();
+void drawResultAttempt();
+extern int selectedAlertIndex;
+extern int retryCount;
+extern lifeline::Lang uiLang;
+} // namespace esp32txs
+
+namespace {
+
+const int W = 480, H = 320;
+
+typedef void (*Draw)();
+
+/** What a field shows: one thing, each alert in each language, attempts. */
+enum class Vary { NONE, ALERT, ATTEMPT };
+
+struct Field {
+  const char *name;
+  Draw draw;
+  Vary vary;
+};
+
+struct Screen {
+  const char *name;
+  Draw background;
+  std::vector<Field> fields;
+};
+
+const std::vector<Screen> SCREENS = {
+    {"MENU",
+     esp32txs::drawMenuBackground,
+     {{"MENU_ID", esp32txs::drawMenuId, Vary::NONE},
+      {"MENU_RANGE", esp32txs::drawMenuRange, Vary::ALERT},
+      {"MENU_LIST", esp32txs::drawMenuList, Vary::ALERT}}},
+    {"CONFIRM",
+     esp32txs::drawConfirmBackground,
+     {{"CONFIRM_CARD", esp32txs::drawConfirmCard, Vary::ALERT}}},
+    {"SENDING",
+     esp32txs::drawSendingBackground,
+     {{"SENDING_ALERT", esp32txs::drawSendingAlert, Vary::ALERT}}},
+    {"RESULT_SENT",
+     esp32txs::drawResultSentBackground,
+     {{"RESULT_SENT_ALERT", esp32txs::drawResultSentAlert, Vary::ALERT}}},
+    {"RESULT_FAILED",
+     esp32txs::drawResultFailedBackground,
+     {{"RESULT_FAILED_ATTEMPT", esp32txs::drawResultAttempt,
+       Vary::ATTEMPT}}},
+};
+
+typedef std::vector<uint16_t> Frame;
+
+/** Draw, wait for the bus, read the panel back. */
+Frame render(host::Node &node, Draw background, Draw field = nullptr) {
+  background();
+  if (field)
+    field();
+  host::lcdDrain(node);
+  Frame f(W * H);
+  for (int y = 0; y < H; y++) {
+    for (int x = 0; x < W; x++)
+      f[y * W + x] = node.panel.pixel(x, y);
+  }
+  return f;
+}
+
+void fillGram(host::Node &node, uint16_t color) {
+  node.panel.gram.assign((size_t)HOST_PANEL_SIDE * HOST_PANEL_SIDE, color);
+}
+
+/** Runs of three or more; everything else in literal blocks. */
+std::vector<uint16_t> encode(const Frame &f) {
+  const size_t MAX = lifeline::PANEL_IMAGE_LITERAL - 1;
+  std::vector<uint16_t> out, lit;
+  auto flush = [&] {
+    if (lit.empty())
+      return;
+    out.push_back((uint16_t)(lifeline::PANEL_IMAGE_LITERAL | lit.size()));
+    out.insert(out.end(), lit.begin(), lit.end());
+    lit.clear();
+  };
+  size_t i = 0;
+  while (i < f.size()) {
+    size_t j = i;
+    while (j < f.size() && f[j] == f[i] && j - i < MAX)
+      j++;
+    if (j - i >= 3) {
+      flush();
+      out.push_back((uint16_t)(j - i));
+      out.push_back(f[i]);
+    } else {
+      for (size_t k = i; k < j; k++) {
+        lit.push_back(f[k]);
+        if (lit.size() == MAX)
+          flush();
+      }
+    }
+    i = j;
+  }
+  flush();
+  return out;
+}
+
+/** PanelImage sink into a frame, for checking the encoding. */
+struct FrameSink {
+  Frame &f;
+  uint16_t x0 = 0, y0 = 0, x1 = 0, y1 = 0, x = 0, y = 0;
+  void window(uint16_t a, uint16_t b, uint16_t c, uint16_t d) {
+    x0 = x = a, y0 = y = b, x1 = c, y1 = d;
+  }
+  void put(uint16_t color) {
+    f[y * W + x] = color;
+    if (++x > x1) {
+      x = x0;
+      y = y < y1 ? y + 1 : y0;
+    }
+  }
+  void fill(uint16_t color, uint32_t n) {
+    while (n--)
+      put(color);
+  }
+  void pixels(const uint16_t *px, uint32_t n) {
+    for (uint32_t i = 0; i < n; i++)
+      put(px[i]);
+  }
+};
+
+struct Rect {
+  int x0 = W, y0 = H, x1 = -1, y1 = -1;
+  bool empty() const { return x1 < 0; }
+  void add(int x, int y) {
+    x0 = x < x0 ? x : x0;
+    y0 = y < y0 ? y : y0;
+    x1 = x > x1 ? x : x1;
+    y1 = y > y1 ? y : y1;
+  }
+};
+
+/** Every value the field can show. */
+template <typename Fn> void eachVariant(Vary vary, Fn fn) {
+  const lifeline::Lang langs[2] = {lifeline::Lang::EN, lifeline::Lang::NE};
+  switch (vary) {
+  case Vary::NONE:
+    fn();
+    break;
+  case Vary::ALERT:
+    for (lifeline::Lang lang : langs) {
+      esp32txs::uiLang = lang;
+      for (int i = 0; i < (int)lifeline::ui::ALERT_NAMES_COUNT; i++) {
+        esp32txs::selectedAlertIndex = i;
+        esp32txs::updateMenuScroll();
+        fn();
+      }
+    }
+    esp32txs::uiLang = lifeline::Lang::EN;
+    break;
+  case Vary::ATTEMPT:
+    // Single digits all have one width: 1..9 covers any retry limit below 10
+    for (int i = 0; i < 9; i++) {
+      esp32txs::retryCount = i;
+      fn();
+    }
+    break;
+  }
+}
+
+std::string bake(host::Node &node, std::string &error) {
+  std::ostringstream h;
+  size_t totalBytes = 0;
+  for (const Screen &s : SCREENS) {
+    fillGram(node, 0x0000);
+    const Frame f = render(node, s.background);
+    fillGram(node, 0xFFFF);
+    if (render(node, s.background) != f) {
+      error = std::string(s.name) + ": the background leaves pixels unpainted";
+      return "";
+    }
+    const std::vector<uint16_t> words = encode(f);
+    const lifeline::PanelImage img = {W, H, words.data(),
+                                      (uint32_t)words.size()};
+    Frame decoded(W * H, 0);
+    FrameSink sink{decoded};
+    lifeline::drawPanelImage(img, sink);
+    if (decoded != f) {
+      error = std::string(s.name) + ": the encoding does not decode back";
+      return "";
+    }
+    totalBytes += words.size() * 2;
+
+    char line[160];
+    snprintf(line, sizeof(line), "// %s: %zu bytes (%.1f%% of %d KB raw)\n",
+             s.name, words.size() * 2, 100.0 * words.size() / (W * H),
+             W * H * 2 / 1024);
+    h << "\n" << line;
+    h << "constexpr uint16_t " << s.name << "_WORDS[] = {";
+    for (size_t i = 0; i < words.size(); i++) {
+      snprintf(line, sizeof(line), "%s0x%04X,", i % 10 ? " " : "\n    ",
+               words[i]);
+      h << line;
+    }
+    h << "\n};\n";
+    h << "constexpr lifeline::PanelImage " << s.name << " = {" << W << ", "
+      << H << ", " << s.name << "_WORDS, " << words.size() << "};\n";
+
+    for (const Field &field : s.fields) {
+      Rect r;
+      eachVariant(field.vary, [&] {
+        const Frame v = render(node, s.background, field.draw);
+        for (int i = 0; i < W * H; i++) {
+          if (v[i] != f[i])
+            r.add(i % W, i / W);
+        }
+      });
+      if (r.empty()) {
+        error = std::string(field.name) + ": the field draws nothing";
+        return "";
+      }
+      // The restore path must give back exactly the background
+      const lifeline::FieldRect fr = {(uint16_t)r.x0, (uint16_t)r.y0,
+                                      (uint16_t)(r.x1 - r.x0 + 1),
+                                      (uint16_t)(r.y1 - r.y0 + 1)};
+      Frame restored(W * H, 0);
+      FrameSink rs{restored};
+      lifeline::drawPanelImage(img, rs, fr);
+      for (int y = r.y0; y <= r.y1; y++) {
+        for (int x = r.x0; x <= r.x1; x++) {
+          if (restored[y * W + x] != f[y * W + x]) {
+            error = std::string(field.name) + ": restore does not match";
+            return "";
+          }
+        }
+      }
+      snprintf(line, sizeof(line),
+               "constexpr lifeline::FieldRect %s = {%u, %u, %u, %u};\n",
+               field.name, fr.x, fr.y, fr.w, fr.h);
+      h << line;
+    }
+  }
+
+  std::ostringstream out;
+  out << "/*\n"
+         " * GENERATED from the draw*Background() and field functions in\n"
+         " * esp32txs.ino by hardware/host/tools/bake_screens.cpp. Do not "
+         "edit;\n"
+         " * change the drawing code and rerun the tool (build the host tree,"
+         "\n"
+         " * then bake_screens --write <this file>).\n"
+         " *\n"
+         " * "
+      << SCREENS.size() << " backgrounds, " << totalBytes
+      << " bytes of run-length RGB565 (PanelImage.h).\n"
+         " */\n\n"
+         "#ifndef ESP32TXS_SCREEN_BACKGROUNDS_H\n"
+         "#define ESP32TXS_SCREEN_BACKGROUNDS_H\n\n"
+         "#include <PanelImage.h>\n"
+         "#include <stdint.h>\n\n"
+         "namespace bg {\n"
+      << h.str()
+      << "\n} // namespace bg\n\n"
+         "#endif // ESP32TXS_SCREEN_BACKGROUNDS_H\n";
+  return out.str();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc != 3 || (strcmp(argv[1], "--write") && strcmp(argv[1], "--check"))) {
+    fprintf(stderr, "usage: bake_screens --write|--check <ScreenBackgrounds.h>\n");
+    return 2;
+  }
+  host::Sketch tx("bake", esp32txs::setup, esp32txs::loop);
+  tx.begin();
+  host::NodeScope scope(tx.node);
+  host::SketchCode code;
+
+  std::string error;
+  const std::string header = bake(tx.node, error);
+  if (header.empty()) {
+    fprintf(stderr, "bake_screens: %s\n", error.c_str());
+    return 1;
+  }
+
+  if (!strcmp(argv[1], "--check")) {
+    std::ifstream in(argv[2], std::ios::binary);
+    std::stringstream current;
+    current << in.rdbuf();
+    if (current.str() != header) {
+      fprintf(stderr,
+              "bake_screens: %s is stale; rerun bake_screens --write\n",
+              argv[2]);
+      return 1;
+    }
+    return 0;
+  }
+  std::ofstream out(argv[2], std::ios::binary);
+  out << header;
+  printf("bake_screens: wrote %s\n", argv[2]);
+  return out ? 0 : 1;
+}
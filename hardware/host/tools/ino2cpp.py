@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+"""
+Turn an Arduino sketch (.ino) into a C++ translation unit for the host build.
+
+Does what the Arduino builder does before compiling:
+  * includes <Arduino.h> first,
+  * inserts prototypes for every top-level function definition just before
+    the first one, so functions can be called before they are defined.
+
+Functions with default arguments are not prototyped (the default may only be
+given once); the sketches already declare those themselves when needed.
+
+With --namespace the sketch body is wrapped in `namespace <name> { ... }`
+so several sketches can be linked into one simulation. Top-level #include
+lines close and reopen the namespace around themselves, which keeps any
+#define that precedes an include in effect for it.
+
+#line directives point compiler errors back at the .ino.
+"""
+
+import argparse
+import re
+import sys
+
+KEYWORDS = {
+    "if", "else", "while", "for", "switch", "return", "do", "case",
+    "struct", "class", "enum", "union", "namespace", "typedef", "using",
+    "template", "extern", "sizeof",
+}
+
+FUNC_RE = re.compile(
+    r"^(?P<prefix>.*?)\b(?P<name>[A-Za-z_]\w*)\s*\((?P<params>.*)\)\s*"
+    r"(?P<suffix>(?:const|noexcept|override|\s)*)$",
+    re.S,
+)
+
+
+def mask(text):
+    """Blank out comments and literal contents, keeping offsets and newlines."""
+    out = list(text)
+    i, n = 0, len(text)
+    while i < n:
+        c = text[i]
+        if text.startswith("//", i):
+            while i < n and text[i] != "\n":
+                out[i] = " "
+                i += 1
+        elif text.startswith("/*", i):
+            end = text.find("*/", i + 2)
+            end = n if end < 0 else end + 2
+            for j in range(i, end):
+                if text[j] != "\n":
+                    out[j] = " "
+            i = end
+        elif c in "\"'":
+            j = i + 1
+            while j < n and text[j] != c:
+                if text[j] == "\\":
+                    out[j] = " "
+                    j += 1
+                if j < n and text[j] != "\n":
+                    out[j] = " "
+                j += 1
+            i = j + 1
+        else:
+            i += 1
+    return "".join(out)
+
+
+def line_of(text, pos):
+    return text.count("\n", 0, pos)
+
+
+def scan(text, masked):
+    """Return (function prototypes with their line, top-level include lines)."""
+    protos = []
+    includes = []
+    depth = 0
+    stmt_start = 0
+    i, n = 0, len(masked)
+    at_line_start = True
+    while i < n:
+        c = masked[i]
+        if at_line_start:
+            j = i
+            while j < n and masked[j] in " \t":
+                j += 1
+            if j < n and masked[j] == "#":
+                end = j
+                while True:
+                    end = masked.find("\n", end)
+                    if end < 0:
+                        end = n
+                        break
+                    if masked[end - 1] != "\\":
+                        break
+                    end += 1
+                if depth == 0:
+                    if re.match(r"#\s*include\b", masked[j:end]):
+                        includes.append(line_of(masked, j))
+                    stmt_start = end
+                i = end
+                continue
+        at_line_start = c == "\n"
+        if c == "{":
+            if depth == 0:
+                proto = function_prototype(masked[stmt_start:i])
+                if proto:
+                    first = stmt_start + (len(masked[stmt_start:i]) -
+                                          len(masked[stmt_start:i].lstrip()))
+                    protos.append((line_of(masked, first), proto))
+            depth += 1
+        elif c == "}":
+            depth -= 1
+            if depth == 0:
+                stmt_start = i + 1
+        elif c == ";" and depth == 0:
+            stmt_start = i + 1
+        i += 1
+    return protos, includes
+
+
+def function_prototype(stmt):
+    sig = " ".join(stmt.split())
+    if not sig or "=" in sig.split("(")[0]:
+        return None
+    m = FUNC_RE.match(sig)
+    if not m:
+        return None
+    prefix = m.group("prefix").strip()
+    name = m.group("name")
+    params = m.group("params")
+    if not prefix or name in KEYWORDS:
+        return None
+    if prefix.split()[0] in KEYWORDS or "::" in prefix.split()[-1]:
+        return None
+    if "=" in params:
+        return None  # default arguments: keep the sketch's own declaration
+    return sig + ";"
+
+
+def convert(src, path, namespace):
+    masked = mask(src)
+    protos, includes = scan(src, masked)
+    lines = src.split("\n")
+    include_lines = set(includes)
+    quoted = path.replace("\\", "\\\\").replace('"', '\\"')
+
+    out = ["// Generated from %s by ino2cpp.py - do not edit" % path,
+           "#include <Arduino.h>"]
+    if namespace:
+        out.append("namespace %s {" % namespace)
+    out.append('#line 1 "%s"' % quoted)
+
+    first_fn = protos[0][0] if protos else None
+    for idx, line in enumerate(lines):
+        if idx == first_fn:
+            out.extend(p for _, p in protos)
+            out.append('#line %d "%s"' % (idx + 1, quoted))
+        if namespace and idx in include_lines:
+            out.append("} // namespace %s" % namespace)
+            out.append(line)
+            out.append("namespace %s {" % namespace)
+            out.append('#line %d "%s"' % (idx + 2, quoted))
+        else:
+            out.append(line)
+    if namespace:
+        out.append("} // namespace %s" % namespace)
+    return "\n".join(out) + "\n"
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().split("\n")[0])
+    ap.add_argument("sketch")
+    ap.add_argument("output")
+    ap.add_argument("--namespace", default="")
+    args = ap.parse_args()
+
+    with open(args.sketch, encoding="utf-8") as f:
+        src = f.read()
+    result = convert(src, args.sketch, args.namespace)
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(result)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,84 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                 LIFELINE CORE - QUEUE & POOL CYCLE COUNTS
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Cycles per operation on the board for the ring queues and the object
+ * pool, next to a FreeRTOS queue copying the same 64-byte record. Flash it
+ * on the gateway's board and open the serial monitor at 115200:
+ *
+ *   [BENCH] spsc push+pop       ... cycles
+ *   [BENCH] mpsc push+pop       ... cycles
+ *   [BENCH] pool create+destroy ... cycles
+ *   [BENCH] xQueue send+recv    ... cycles (64 B copy)
+ *
+ * Single context, so these are uncontended costs; core_bench on the host
+ * measures the queues between threads. The host build only compiles this.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#include <LifelineCore.h>
+
+#ifndef LIFELINE_HOST
+#include <freertos/queue.h>
+#endif
+
+#define BENCH_OPS 10000
+#define BENCH_PERIOD_MS 5000
+
+struct Record {
+  uint8_t bytes[64];
+};
+
+lifeline::ObjectPool<Record, 16> pool;
+lifeline::SpscQueue<Record *, 16> spsc;
+lifeline::MpscQueue<Record *, 16> mpsc;
+
+template <typename Q> uint32_t queueCycles(Q &q) {
+  Record *rec = pool.create();
+  Record *out = nullptr;
+  const uint32_t start = ESP.getCycleCount();
+  for (uint32_t i = 0; i < BENCH_OPS; i++) {
+    q.push(rec);
+    q.pop(out);
+  }
+  const uint32_t cycles = ESP.getCycleCount() - start;
+  pool.destroy(out);
+  return cycles / BENCH_OPS;
+}
+
+uint32_t poolCycles() {
+  const uint32_t start = ESP.getCycleCount();
+  for (uint32_t i = 0; i < BENCH_OPS; i++)
+    pool.destroy(pool.create());
+  return (ESP.getCycleCount() - start) / BENCH_OPS;
+}
+
+#ifndef LIFELINE_HOST
+uint32_t xQueueCycles() {
+  static QueueHandle_t q = xQueueCreate(16, sizeof(Record));
+  static Record in, out;
+  const uint32_t start = ESP.getCycleCount();
+  for (uint32_t i = 0; i < BENCH_OPS; i++) {
+    xQueueSend(q, &in, 0);
+    xQueueReceive(q, &out, 0);
+  }
+  return (ESP.getCycleCount() - start) / BENCH_OPS;
+}
+#endif
+
+void setup() { Serial.begin(115200); }
+
+void loop() {
+  lifeline::printfTo(Serial, "[BENCH] spsc push+pop       %lu cycles\n",
+                     (unsigned long)queueCycles(spsc));
+  lifeline::printfTo(Serial, "[BENCH] mpsc push+pop       %lu cycles\n",
+                     (unsigned long)queueCycles(mpsc));
+  lifeline::printfTo(Serial, "[BENCH] pool create+destroy %lu cycles\n",
+                     (unsigned long)poolCycles());
+#ifndef LIFELINE_HOST
+  lifeline::printfTo(Serial, "[BENCH] xQueue send+recv    %lu cycles (64 B copy)\n",
+                     (unsigned long)xQueueCycles());
+#endif
+  delay(BENCH_PERIOD_MS);
+}
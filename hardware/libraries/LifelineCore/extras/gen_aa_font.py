@@ -0,0 +1,512 @@
+#!/usr/bin/env python3
+"""
+Generate src/AaTextFonts.h, the anti-aliased fonts for AaText.h.
+
+Each font is rasterised here from a TrueType file (DejaVu Sans Bold by
+default) with no library beyond Python: the outlines are flattened and
+filled with exact horizontal and 8x vertical coverage, then quantised to
+4 bits per pixel. Glyphs are cropped to their ink and carry their own
+offsets, so widths are proportional. Kerning comes from the font's 'kern'
+table, rounded to whole pixels, and only non-zero pairs are kept.
+
+  gen_aa_font.py            rewrite src/AaTextFonts.h
+  gen_aa_font.py --check    exit 1 if src/AaTextFonts.h is stale
+  gen_aa_font.py --preview  print every glyph as shaded text art
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_OUTPUT = os.path.join(HERE, "..", "src", "AaTextFonts.h")
+FONT_DIRS = [
+    "/usr/share/fonts/truetype/dejavu",
+    "/usr/share/fonts/TTF",
+    "/usr/share/fonts/dejavu",
+    "/Library/Fonts",
+]
+DEFAULT_FONT = "DejaVuSans-Bold.ttf"
+
+PRINTABLE = "".join(chr(c) for c in range(32, 127))
+HEADLINE = " !#%&'()+,-./0123456789:?ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+
+# (name, pixels per em, characters). 19 px has the 14 px capitals of
+# font5x7 at size 2, 12 px is the smallest that stays legible and 32 px is
+# for the alert word.
+FONTS = [
+    ("SANS_BOLD_12", 12, PRINTABLE),
+    ("SANS_BOLD_19", 19, PRINTABLE),
+    ("SANS_BOLD_32", 32, HEADLINE),
+]
+
+SUBROWS = 8  # Vertical samples per pixel; horizontal coverage is exact
+CURVE_STEPS = 8  # Line segments per quadratic curve
+
+
+class FontError(Exception):
+    pass
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+#                              TRUETYPE READER
+# ═══════════════════════════════════════════════════════════════════════════
+
+class TrueType:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        self.name = os.path.basename(path)
+        count = struct.unpack_from(">H", self.data, 4)[0]
+        self.tables = {}
+        for i in range(count):
+            tag, _, off, length = struct.unpack_from(">4sIII", self.data,
+                                                     12 + 16 * i)
+            self.tables[tag.decode("latin-1")] = (off, length)
+        for tag in ("head", "hhea", "hmtx", "cmap", "loca", "glyf", "maxp"):
+            if tag not in self.tables:
+                raise FontError(f"{self.name}: no '{tag}' table")
+        head = self.tables["head"][0]
+        self.units = struct.unpack_from(">H", self.data, head + 18)[0]
+        self.long_loca = struct.unpack_from(">h", self.data, head + 50)[0]
+        hhea = self.tables["hhea"][0]
+        self.hmetrics = struct.unpack_from(">H", self.data, hhea + 34)[0]
+        self.cmap = self._read_cmap()
+        self.kerning = self._read_kern()
+
+    def _read_cmap(self):
+        base = self.tables["cmap"][0]
+        count = struct.unpack_from(">H", self.data, base + 2)[0]
+        for i in range(count):
+            platform, encoding, off = struct.unpack_from(
+                ">HHI", self.data, base + 4 + 8 * i)
+            sub = base + off
+            if (platform, encoding) in ((3, 1), (0, 3)) and \
+                    struct.unpack_from(">H", self.data, sub)[0] == 4:
+                return self._read_cmap4(sub)
+        raise FontError(f"{self.name}: no Unicode BMP cmap")
+
+    def _read_cmap4(self, sub):
+        segs = struct.unpack_from(">H", self.data, sub + 6)[0] // 2
+        ends = struct.unpack_from(f">{segs}H", self.data, sub + 14)
+        starts = struct.unpack_from(f">{segs}H", self.data,
+                                    sub + 16 + 2 * segs)
+        deltas = struct.unpack_from(f">{segs}h", self.data,
+                                    sub + 16 + 4 * segs)
+        ranges_at = sub + 16 + 6 * segs
+        ranges = struct.unpack_from(f">{segs}H", self.data, ranges_at)
+        cmap = {}
+        for s in range(segs):
+            for c in range(starts[s], min(ends[s], 0x7F) + 1):
+                if ranges[s] == 0:
+                    g = (c + deltas[s]) & 0xFFFF
+                else:
+                    at = ranges_at + 2 * s + ranges[s] + 2 * (c - starts[s])
+                    g = struct.unpack_from(">H", self.data, at)[0]
+                    if g:
+                        g = (g + deltas[s]) & 0xFFFF
+                cmap[chr(c)] = g
+        return cmap
+
+    def _read_kern(self):
+        if "kern" not in self.tables:
+            return {}
+        base = self.tables["kern"][0]
+        count = struct.unpack_from(">H", self.data, base + 2)[0]
+        pairs, at = {}, base + 4
+        for _ in range(count):
+            _, length, coverage = struct.unpack_from(">HHH", self.data, at)
+            if coverage >> 8 == 0 and coverage & 1:  # Horizontal format 0
+                n = struct.unpack_from(">H", self.data, at + 6)[0]
+                for i in range(n):
+                    left, right, value = struct.unpack_from(
+                        ">HHh", self.data, at + 14 + 6 * i)
+                    pairs[(left, right)] = value
+            at += length
+        return pairs
+
+    def advance(self, glyph):
+        i = min(glyph, self.hmetrics - 1)
+        return struct.unpack_from(">H", self.data,
+                                  self.tables["hmtx"][0] + 4 * i)[0]
+
+    def _glyph_range(self, glyph):
+        loca = self.tables["loca"][0]
+        if self.long_loca:
+            start, end = struct.unpack_from(">II", self.data, loca + 4 * glyph)
+        else:
+            start, end = struct.unpack_from(">HH", self.data, loca + 2 * glyph)
+            start, end = start * 2, end * 2
+        return self.tables["glyf"][0] + start, end - start
+
+    def contours(self, glyph, depth=0):
+        """Closed contours as lists of (x, y, on_curve) in font units."""
+        at, length = self._glyph_range(glyph)
+        if length == 0:
+            return []
+        n = struct.unpack_from(">h", self.data, at)[0]
+        if n >= 0:
+            return self._simple(at, n)
+        if depth > 4:
+            raise FontError(f"{self.name}: composite glyph {glyph} nests")
+        return self._composite(at, depth)
+
+    def _simple(self, at, n):
+        ends = struct.unpack_from(f">{n}H", self.data, at + 10)
+        points = ends[-1] + 1 if n else 0
+        p = at + 10 + 2 * n
+        p += 2 + struct.unpack_from(">H", self.data, p)[0]
+        flags = []
+        while len(flags) < points:
+            f = self.data[p]
+            p += 1
+            repeat = 1
+            if f & 8:
+                repeat += self.data[p]
+                p += 1
+            flags += [f] * repeat
+        coords = []
+        for short, same in ((2, 16), (4, 32)):
+            value, out = 0, []
+            for f in flags:
+                if f & short:
+                    d = self.data[p]
+                    p += 1
+                    value += d if f & same else -d
+                elif not f & same:
+                    value += struct.unpack_from(">h", self.data, p)[0]
+                    p += 2
+                out.append(value)
+            coords.append(out)
+        contours, start = [], 0
+        for end in ends:
+            contours.append([(coords[0][i], coords[1][i], bool(flags[i] & 1))
+                             for i in range(start, end + 1)])
+            start = end + 1
+        return contours
+
+    def _composite(self, at, depth):
+        p, out = at + 10, []
+        while True:
+            flags, glyph = struct.unpack_from(">HH", self.data, p)
+            p += 4
+            if flags & 1:
+                dx, dy = struct.unpack_from(">hh", self.data, p)
+                p += 4
+            else:
+                dx, dy = struct.unpack_from(">bb", self.data, p)
+                p += 2
+            if not flags & 2:
+                raise FontError(f"{self.name}: point-matched composite")
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 8:
+                a = d = struct.unpack_from(">h", self.data, p)[0] / 16384
+                p += 2
+            elif flags & 0x40:
+                a, d = (v / 16384 for v in
+                        struct.unpack_from(">hh", self.data, p))
+                p += 4
+            elif flags & 0x80:
+                a, b, c, d = (v / 16384 for v in
+                              struct.unpack_from(">hhhh", self.data, p))
+                p += 8
+            for contour in self.contours(glyph, depth + 1):
+                out.append([(x * a + y * c + dx, x * b + y * d + dy, on)
+                            for x, y, on in contour])
+            if not flags & 0x20:
+                return out
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+#                                RASTERISER
+# ═══════════════════════════════════════════════════════════════════════════
+
+def flatten(contour, scale, baseline):
+    """Polygon in pixels (y down, baseline at row `baseline`)."""
+    pts = [(x * scale, baseline - y * scale, on) for x, y, on in contour]
+    if not pts:
+        return []
+    # Start on an on-curve point, inventing one between two off-curve ones
+    start = next((i for i, p in enumerate(pts) if p[2]), None)
+    if start is None:
+        a, b = pts[0], pts[1]
+        pts.insert(0, ((a[0] + b[0]) / 2, (a[1] + b[1]) / 2, True))
+        start = 0
+    pts = pts[start:] + pts[:start] + [pts[start]]
+    poly, ctrl = [pts[0][:2]], None
+    for x, y, on in pts[1:]:
+        if on:
+            if ctrl is None:
+                poly.append((x, y))
+            else:
+                poly += curve(poly[-1], ctrl, (x, y))
+                ctrl = None
+        elif ctrl is None:
+            ctrl = (x, y)
+        else:
+            mid = ((ctrl[0] + x) / 2, (ctrl[1] + y) / 2)
+            poly += curve(poly[-1], ctrl, mid)
+            ctrl = (x, y)
+    return poly
+
+
+def curve(p0, p1, p2):
+    out = []
+    for i in range(1, CURVE_STEPS + 1):
+        t = i / CURVE_STEPS
+        u = 1 - t
+        out.append((u * u * p0[0] + 2 * u * t * p1[0] + t * t * p2[0],
+                    u * u * p0[1] + 2 * u * t * p1[1] + t * t * p2[1]))
+    return out
+
+
+def rasterise(polys, width, height, x0, y0):
+    """Coverage 0..1 per pixel of the box at (x0, y0), nonzero winding."""
+    cover = [[0.0] * width for _ in range(height)]
+    edges = []
+    for poly in polys:
+        for (ax, ay), (bx, by) in zip(poly, poly[1:]):
+            if ay != by:
+                edges.append((ax - x0, ay - y0, bx - x0, by - y0))
+    for row in range(height):
+        line = cover[row]
+        for k in range(SUBROWS):
+            sy = row + (k + 0.5) / SUBROWS
+            hits = []
+            for ax, ay, bx, by in edges:
+                if (ay <= sy < by) or (by <= sy < ay):
+                    x = ax + (sy - ay) * (bx - ax) / (by - ay)
+                    hits.append((x, 1 if by > ay else -1))
+            hits.sort()
+            winding = 0
+            for i, (x, d) in enumerate(hits):
+                before = winding
+                winding += d
+                if before == 0 and winding != 0:
+                    span_from = x
+                elif before != 0 and winding == 0:
+                    add_span(line, span_from, x, 1.0 / SUBROWS)
+    return cover
+
+
+def add_span(line, a, b, weight):
+    a, b = max(a, 0.0), min(b, float(len(line)))
+    if b <= a:
+        return
+    first, last = int(a), int(math.ceil(b)) - 1
+    for px in range(first, last + 1):
+        line[px] += (min(b, px + 1) - max(a, px)) * weight
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+#                                  FONTS
+# ═══════════════════════════════════════════════════════════════════════════
+
+class Glyph:
+    def __init__(self, char, advance, left, top, alpha):
+        self.char = char
+        self.advance = advance
+        self.left = left
+        self.top = top
+        self.alpha = alpha  # Rows of 0..15
+        self.width = len(alpha[0]) if alpha else 0
+        self.height = len(alpha)
+
+
+def build_font(tt, px, chars):
+    scale = px / tt.units
+    # Baseline at row `ascent` of a box that fits every included glyph
+    raw = {}
+    for c in chars:
+        if c not in tt.cmap:
+            raise FontError(f"{tt.name} has no glyph for {c!r}")
+        g = tt.cmap[c]
+        polys = [flatten(ct, scale, 0.0) for ct in tt.contours(g)]
+        raw[c] = (g, [p for p in polys if len(p) > 2])
+    ys = [y for _, polys in raw.values() for p in polys for _, y in p]
+    ascent = int(math.ceil(-min(ys)))
+    descent = int(math.ceil(max(ys)))
+
+    glyphs = {}
+    for c, (g, polys) in raw.items():
+        advance = int(round(tt.advance(g) * scale))
+        if not polys:
+            glyphs[c] = Glyph(c, advance, 0, 0, [])
+            continue
+        xs = [x for p in polys for x, _ in p]
+        ys = [y for p in polys for _, y in p]
+        x0, y0 = int(math.floor(min(xs))), int(math.floor(min(ys)))
+        w = int(math.ceil(max(xs))) - x0
+        h = int(math.ceil(max(ys))) - y0
+        cover = rasterise(polys, w, h, x0, y0)
+        alpha = [[min(15, int(round(v * 15))) for v in row] for row in cover]
+        # Crop to the pixels that survived quantisation
+        rows = [i for i, r in enumerate(alpha) if any(r)]
+        cols = [i for i in range(w) if any(r[i] for r in alpha)]
+        if not rows:
+            glyphs[c] = Glyph(c, advance, 0, 0, [])
+            continue
+        alpha = [r[cols[0]:cols[-1] + 1] for r in alpha[rows[0]:rows[-1] + 1]]
+        glyphs[c] = Glyph(c, advance, x0 + cols[0], ascent + y0 + rows[0],
+                          alpha)
+
+    kerns = []
+    index = {tt.cmap[c]: c for c in chars}
+    for (left, right), value in tt.kerning.items():
+        if left in index and right in index:
+            dx = int(round(value * scale))
+            if dx:
+                kerns.append((index[left], index[right], dx))
+    kerns.sort(key=lambda k: (ord(k[0]), ord(k[1])))
+    return glyphs, kerns, ascent, ascent + descent
+
+
+def pack(alpha):
+    """4-bpp, two pixels per byte (left pixel in the high nibble)."""
+    flat = [v for row in alpha for v in row]
+    if len(flat) % 2:
+        flat.append(0)
+    return bytes(flat[i] << 4 | flat[i + 1] for i in range(0, len(flat), 2))
+
+
+def c_char(c):
+    return {"'": "\\'", "\\": "\\\\"}.get(c, c)
+
+
+def render(tt):
+    out = [
+        "/*",
+        f" * GENERATED from {tt.name} by extras/gen_aa_font.py.",
+        " * Do not edit; change FONTS in the generator and rerun it.",
+        " *",
+        " * DejaVu fonts are derived from Bitstream Vera: free to embed and",
+        " * redistribute, see https://dejavu-fonts.github.io/License.html.",
+        " */",
+        "",
+        "#ifndef LIFELINE_AA_TEXT_FONTS_H",
+        "#define LIFELINE_AA_TEXT_FONTS_H",
+        "",
+        "namespace lifeline {",
+        "namespace aa {",
+        "",
+    ]
+    for name, px, chars in FONTS:
+        glyphs, kerns, ascent, height = build_font(tt, px, chars)
+        first, last = ord(min(chars)), ord(max(chars))
+        bitmap, entries = bytearray(), []
+        for code in range(first, last + 1):
+            c = chr(code)
+            g = glyphs.get(c)
+            if g is None:
+                entries.append(("{0, 0, 0, 0, 0, 0}", "(none)"))
+                continue
+            entries.append((f"{{{len(bitmap)}, {g.width}, {g.height}, "
+                            f"{g.left}, {g.top}, {g.advance}}}",
+                            f"'{c}'" if c != " " else "space"))
+            bitmap += pack(g.alpha)
+        total = len(bitmap) + 8 * len(entries) + 3 * len(kerns)
+        out += [
+            f"// {px} px, {len(chars)} glyphs, {height} px line: "
+            f"{len(bitmap)} bitmap bytes, {total} in all",
+            f"constexpr uint8_t {name}_BITMAP[] = {{",
+        ]
+        items = [f"0x{b:02X}" for b in bitmap]
+        for i in range(0, len(items), 12):
+            out.append("    " + ", ".join(items[i:i + 12]) + ",")
+        out += ["};", f"constexpr AaGlyph {name}_GLYPHS[] = {{"]
+        for entry, label in entries:
+            out.append(f"    {entry}, // {label}")
+        out.append("};")
+        if kerns:
+            out.append(f"constexpr AaKern {name}_KERNS[] = {{")
+            line = "   "
+            for left, right, dx in kerns:
+                item = f" {{'{c_char(left)}', '{c_char(right)}', {dx}}},"
+                if len(line) + len(item) > 79:
+                    out.append(line)
+                    line = "   "
+                line += item
+            out += [line, "};"]
+            kern_ref, kern_count = f"{name}_KERNS", len(kerns)
+        else:
+            kern_ref, kern_count = "nullptr", 0
+        head = f"constexpr AaFont {name} = {{"
+        out += [
+            f"{head}{name}_BITMAP, {name}_GLYPHS,",
+            f"{' ' * len(head)}{kern_ref}, {kern_count}, {first}, {last}, "
+            f"{height}, {ascent}}};",
+            "",
+        ]
+    out += [
+        "} // namespace aa",
+        "} // namespace lifeline",
+        "",
+        "#endif // LIFELINE_AA_TEXT_FONTS_H",
+        "",
+    ]
+    return "\n".join(out)
+
+
+def preview(tt):
+    shades = " .:-=+*#%@"
+    for name, px, chars in FONTS:
+        glyphs, kerns, ascent, height = build_font(tt, px, chars)
+        print(f"{name}: {height} px line, baseline at row {ascent}, "
+              f"{len(kerns)} kerning pairs")
+        for c in chars:
+            g = glyphs[c]
+            print(f"'{c}' advance {g.advance} left {g.left} top {g.top}")
+            for row in g.alpha:
+                print("".join(shades[v * (len(shades) - 1) // 15]
+                              for v in row))
+
+
+def find_font(name):
+    for d in FONT_DIRS:
+        path = os.path.join(d, name)
+        if os.path.exists(path):
+            return path
+    return None
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("output", nargs="?", default=DEFAULT_OUTPUT)
+    ap.add_argument("--font", help=f"TrueType file (default: {DEFAULT_FONT} "
+                    "from the system font directories)")
+    ap.add_argument("--check", action="store_true",
+                    help="compare with the output file instead of writing it")
+    ap.add_argument("--preview", action="store_true",
+                    help="print the glyphs instead of writing")
+    args = ap.parse_args()
+
+    path = args.font or find_font(DEFAULT_FONT)
+    if not path:
+        sys.exit(f"gen_aa_font: {DEFAULT_FONT} not found; pass --font")
+    try:
+        tt = TrueType(path)
+        if args.preview:
+            preview(tt)
+            return
+        text = render(tt)
+    except (FontError, struct.error) as e:
+        sys.exit(f"gen_aa_font: {e}")
+
+    if args.check:
+        try:
+            with open(args.output, encoding="utf-8") as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = None
+        if current != text:
+            sys.exit(f"gen_aa_font: {args.output} is stale; rerun "
+                     "extras/gen_aa_font.py and commit it")
+        return
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    main()
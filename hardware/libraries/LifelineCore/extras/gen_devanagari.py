@@ -0,0 +1,369 @@
+#!/usr/bin/env python3
+"""
+Generate src/UiTextNeTable.h from extras/ui_text_ne.txt.
+
+The firmware does no text shaping. Each string is shaped here into a list
+of glyph indices: independent vowels without a glyph of their own are
+decomposed (आ = अ + ा), conjuncts and half forms are matched longest first
+(द्ध, न्), and the short i sign (ि) is moved in front of its consonant
+cluster. Only the glyphs that the shaped strings use are kept.
+
+Glyph bitmaps are stored as horizontal runs. A row is one header byte
+(repeat - 1) << 4 | runs, followed by one x << 4 | (length - 1) byte per
+run, and identical rows below each other share one header with a repeat
+count, so the renderer fills each run with one rectangle. The headline
+(shirorekha) is not stored per glyph: glyphs that join it carry a flag and
+the renderer draws one line per word.
+
+  gen_devanagari.py            rewrite src/UiTextNeTable.h
+  gen_devanagari.py --check    exit 1 if src/UiTextNeTable.h is stale
+  gen_devanagari.py --preview  print the shaped strings as text art
+"""
+
+import argparse
+import os
+import re
+import sys
+
+sys.dont_write_bytecode = True  # Keep extras/ free of __pycache__
+
+from gen_ui_text import TextError, parse  # noqa: E402
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_INPUT = os.path.join(HERE, "ui_text_ne.txt")
+DEFAULT_GLYPHS = os.path.join(HERE, "devanagari16.glyphs")
+DEFAULT_ENGLISH = os.path.join(HERE, "ui_text.txt")
+DEFAULT_OUTPUT = os.path.join(HERE, "..", "src", "UiTextNeTable.h")
+
+HEIGHT = 16
+HEADLINE_ROW = 3
+VIRAMA = "्"
+SIGN_I = "ि"  # ि, written before the consonant it follows
+DECOMPOSE = {
+    "आ": "अा",  # आ = अ + ा
+    "ओ": "अो",  # ओ = अ + ो
+    "औ": "अौ",  # औ = अ + ौ
+}
+
+GLYPH_RE = re.compile(
+    r"^glyph\s+(\S+)\s+advance=(\d+)(?:\s+bearing=(-?\d+))?$")
+ROW_RE = re.compile(r"^(\d+)\s+([#.]+)$")
+
+
+def is_consonant(c):
+    return "क" <= c <= "ह"
+
+
+class Glyph:
+    def __init__(self, name, advance, bearing):
+        self.name = name
+        self.advance = advance
+        self.bearing = bearing
+        self.rows = {}
+
+    def ink(self):
+        """(left, right) of the set pixels relative to the pen."""
+        cols = [x for row in self.rows.values()
+                for x, c in enumerate(row) if c == "#"]
+        if not cols:
+            return 0, 0
+        return self.bearing + min(cols), self.bearing + max(cols) + 1
+
+
+def load_glyphs(path):
+    glyphs, glyph = {}, None
+    with open(path, encoding="utf-8") as f:
+        for lineno, raw in enumerate(f, 1):
+            where = f"{os.path.basename(path)}:{lineno}"
+            line = raw.strip()
+            if not line or line.startswith("#"):
+                continue
+            m = GLYPH_RE.match(line)
+            if m:
+                name = " " if m.group(1) == "space" else m.group(1)
+                if name in glyphs:
+                    raise TextError(f"{where}: glyph {name} drawn twice")
+                glyph = Glyph(name, int(m.group(2)), int(m.group(3) or 0))
+                glyphs[name] = glyph
+                continue
+            m = ROW_RE.match(line)
+            if not m or glyph is None:
+                raise TextError(
+                    f"{where}: expected 'glyph' or '<row> <pixels>'")
+            row = int(m.group(1))
+            if row >= HEIGHT or row in glyph.rows:
+                raise TextError(f"{where}: bad or repeated row {row}")
+            glyph.rows[row] = m.group(2)
+    return glyphs
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+#                                 SHAPING
+# ═══════════════════════════════════════════════════════════════════════════
+
+def shape(text, glyphs, where):
+    """Glyph names for text in visual order."""
+    text = "".join(DECOMPOSE.get(c, c) for c in text)
+    longest = max(len(name) for name in glyphs)
+    out, cluster, joined, i = [], 0, False, 0
+    while i < len(text):
+        for n in range(min(longest, len(text) - i), 0, -1):
+            name = text[i:i + n]
+            # A half form needs a consonant after it
+            half = name.endswith(VIRAMA)
+            if name in glyphs and (not half or (i + n < len(text) and
+                                                is_consonant(text[i + n]))):
+                break
+        else:
+            raise TextError(f"{where}: no glyph for {text[i:i + 2]!r} "
+                            f"in {text!r}")
+        if name == SIGN_I:
+            out.insert(cluster, name)
+        else:
+            if is_consonant(name[0]) and not joined:
+                cluster = len(out)
+            out.append(name)
+        joined = name.endswith(VIRAMA)
+        i += n
+    return out
+
+
+def layout(names, glyphs, where):
+    """Pen width of the shaped names; the ink must stay inside it."""
+    pen, left, right = 0, 0, 0
+    for name in names:
+        g = glyphs[name]
+        lo, hi = g.ink()
+        if lo != hi:
+            left, right = min(left, pen + lo), max(right, pen + hi)
+        pen += g.advance
+    if left < 0 or right > pen:
+        raise TextError(f"{where}: ink runs outside the text box "
+                        f"({left}..{right} of {pen})")
+    return pen
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+#                                 ENCODING
+# ═══════════════════════════════════════════════════════════════════════════
+
+def row_runs(row):
+    return [(m.start(), m.end() - m.start()) for m in re.finditer("#+", row)]
+
+
+def encode(glyph):
+    """(bytes, top, groups, headline) for one glyph."""
+    rows = dict(glyph.rows)
+    span = set(range(-glyph.bearing, -glyph.bearing + glyph.advance))
+    head = rows.get(HEADLINE_ROW, "")
+    headline = (glyph.advance > 0 and
+                {x for x, c in enumerate(head) if c == "#"} == span)
+    if headline:
+        del rows[HEADLINE_ROW]
+    used = [r for r, pixels in rows.items() if "#" in pixels]
+    if not used:
+        return b"", 0, 0, headline
+    top, bottom = min(used), max(used)
+    groups = []
+    for r in range(top, bottom + 1):
+        runs = row_runs(rows.get(r, ""))
+        if groups and groups[-1][1] == runs and groups[-1][0] < 16:
+            groups[-1][0] += 1
+        else:
+            groups.append([1, runs])
+    out = bytearray()
+    for repeat, runs in groups:
+        if len(runs) > 15 or any(x > 15 or n > 16 for x, n in runs):
+            raise TextError(f"glyph {glyph.name}: too wide for run bytes")
+        out.append((repeat - 1) << 4 | len(runs))
+        out.extend(x << 4 | (n - 1) for x, n in runs)
+    return bytes(out), top, len(groups), headline
+
+
+def pool(seqs):
+    """Lay index sequences out in one array, sharing equal tails."""
+    pieces, offsets, end = [], {}, 0
+    for s in sorted(set(seqs), key=lambda s: (-len(s), s)):
+        for owner, start in pieces:
+            if owner[len(owner) - len(s):] == s:
+                offsets[s] = start + len(owner) - len(s)
+                break
+        else:
+            pieces.append((s, end))
+            offsets[s] = end
+            end += len(s)
+    return pieces, offsets
+
+
+def c_bytes(data, indent="    ", per_line=12):
+    items = [f"0x{b:02X}" for b in data]
+    return [indent + ", ".join(items[i:i + per_line]) + ","
+            for i in range(0, len(items), per_line)]
+
+
+def build(entries, english, glyphs, source):
+    known = dict(english)
+    shaped = []
+    for name, value in entries:
+        if name not in known:
+            raise TextError(f"{source}: {name} is not in ui_text.txt")
+        if isinstance(value, list) != isinstance(known[name], list) or (
+                isinstance(value, list) and len(value) != len(known[name])):
+            raise TextError(f"{source}: {name} does not match ui_text.txt")
+        texts = value if isinstance(value, list) else [value]
+        rows = []
+        for text in texts:
+            where = f"{source} {name}"
+            names = shape(text, glyphs, where)
+            rows.append((text, names, layout(names, glyphs, where)))
+        shaped.append((name, isinstance(value, list), rows))
+
+    used = sorted({n for _, _, rows in shaped for _, names, _ in rows
+                   for n in names}, key=list(glyphs).index)
+    index = {n: i for i, n in enumerate(used)}
+    if len(used) > 255:
+        raise TextError("more than 255 glyphs in use")
+    return shaped, used, index
+
+
+def render(entries, english, glyphs, source):
+    shaped, used, index = build(entries, english, glyphs, source)
+
+    runs, infos = bytearray(), []
+    for name in used:
+        data, top, groups, headline = encode(glyphs[name])
+        infos.append((len(runs), glyphs[name].bearing, glyphs[name].advance,
+                      top, groups, headline, name))
+        runs += data
+    seqs = [bytes(index[n] for n in names)
+            for _, _, rows in shaped for _, names, _ in rows]
+    pieces, offsets = pool(seqs)
+    seq_bytes = sum(len(s) for s, _ in pieces)
+    info_bytes = 8 * len(infos)
+
+    out = [
+        "/*",
+        f" * GENERATED from extras/{source} and extras/devanagari16.glyphs by",
+        " * extras/gen_devanagari.py. Do not edit; change the text or glyph",
+        " * file and rerun the generator.",
+        " */",
+        "",
+        "#ifndef LIFELINE_UI_TEXT_NE_TABLE_H",
+        "#define LIFELINE_UI_TEXT_NE_TABLE_H",
+        "",
+        "namespace lifeline {",
+        "namespace ui_ne {",
+        "",
+        f"// {len(used)} of {len(glyphs)} glyphs: {len(runs)} run bytes, "
+        f"{info_bytes} metric bytes,",
+        f"// {seq_bytes} glyph index bytes for {len(seqs)} strings",
+        "constexpr uint8_t RUNS[] = {",
+    ]
+    out += c_bytes(runs)
+    out += ["};", "", "constexpr GlyphInfo GLYPHS[] = {"]
+    for off, bearing, advance, top, groups, headline, name in infos:
+        flags = "GLYPH_HEADLINE" if headline else "0"
+        label = "space" if name == " " else name
+        out.append(f"    {{{off}, {bearing}, {advance}, {top}, {groups}, "
+                   f"{flags}}}, // {label}")
+    out += [
+        "};",
+        f"constexpr uint8_t GLYPH_COUNT = {len(used)};",
+        "",
+        f"constexpr RunFont FONT = {{RUNS, GLYPHS, GLYPH_COUNT, {HEIGHT}, "
+        f"{HEADLINE_ROW}}};",
+        "",
+        "constexpr uint8_t SEQ[] = {",
+    ]
+    for s, start in pieces:
+        out += c_bytes(s)
+    out += ["};", ""]
+
+    def entry(names, width):
+        s = bytes(index[n] for n in names)
+        return f"{{SEQ + {offsets[s]}, {len(s)}, {width}}}"
+
+    for name, is_array, rows in shaped:
+        if is_array:
+            out.append(f"constexpr ShapedText {name}[{len(rows)}] = {{")
+            for i, (text, names, width) in enumerate(rows):
+                sep = "," if i < len(rows) - 1 else ""
+                out.append(f"    {entry(names, width)}{sep} // {text}")
+            out.append("};")
+            out.append(f"constexpr uint8_t {name}_COUNT = {len(rows)};")
+            out.append("")
+    singles = [(name, rows[0]) for name, is_array, rows in shaped
+               if not is_array]
+    for name, (text, names, width) in singles:
+        out.append(f"constexpr ShapedText {name} = {entry(names, width)}; "
+                   f"// {text}")
+    if singles:
+        out.append("")
+    out += [
+        "} // namespace ui_ne",
+        "} // namespace lifeline",
+        "",
+        "#endif // LIFELINE_UI_TEXT_NE_TABLE_H",
+        "",
+    ]
+    return "\n".join(out)
+
+
+def preview(entries, english, glyphs, source):
+    """Text art of every string, drawn from the glyph source."""
+    shaped, _, _ = build(entries, english, glyphs, source)
+    for name, _, rows in shaped:
+        for i, (text, names, width) in enumerate(rows):
+            canvas = [[" "] * width for _ in range(HEIGHT)]
+            pen = 0
+            for n in names:
+                g = glyphs[n]
+                for r, pixels in g.rows.items():
+                    for x, c in enumerate(pixels):
+                        if c == "#":
+                            canvas[r][pen + g.bearing + x] = "#"
+                pen += g.advance
+            print(f"{name}[{i}] {text} ({width} px): {' + '.join(names)}")
+            print("\n".join("".join(r).rstrip() for r in canvas))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("input", nargs="?", default=DEFAULT_INPUT)
+    ap.add_argument("output", nargs="?", default=DEFAULT_OUTPUT)
+    ap.add_argument("--glyphs", default=DEFAULT_GLYPHS)
+    ap.add_argument("--english", default=DEFAULT_ENGLISH)
+    ap.add_argument("--check", action="store_true",
+                    help="compare with the output file instead of writing it")
+    ap.add_argument("--preview", action="store_true",
+                    help="print the shaped strings instead of writing")
+    args = ap.parse_args()
+
+    try:
+        entries = parse(args.input, ascii_only=False)
+        english = parse(args.english)
+        glyphs = load_glyphs(args.glyphs)
+        source = os.path.basename(args.input)
+        if args.preview:
+            preview(entries, english, glyphs, source)
+            return
+        text = render(entries, english, glyphs, source)
+    except TextError as e:
+        sys.exit(f"gen_devanagari: {e}")
+
+    if args.check:
+        try:
+            with open(args.output, encoding="utf-8") as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = None
+        if current != text:
+            sys.exit(f"gen_devanagari: {args.output} is stale; rerun "
+                     "extras/gen_devanagari.py and commit it")
+        return
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+"""
+Generate src/UiTextTable.h from extras/ui_text.txt.
+
+Every string goes into one flash-resident pool, and equal strings are stored
+once. A string that is the tail of a longer one ("EMERGENCY" in
+"MEDICAL EMERGENCY") points into that one instead of getting its own bytes.
+Each entry carries its pixel width at text size 1 in the classic 6x8 GFX
+font. That font scales by whole pixels, so width * size is the exact width
+at any size and centring needs no strlen().
+
+  gen_ui_text.py            rewrite src/UiTextTable.h
+  gen_ui_text.py --check    exit 1 if src/UiTextTable.h is stale
+"""
+
+import argparse
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_INPUT = os.path.join(HERE, "ui_text.txt")
+DEFAULT_OUTPUT = os.path.join(HERE, "..", "src", "UiTextTable.h")
+
+# Advance of every glyph in the classic Adafruit GFX font (5 columns + gap)
+CHAR_ADVANCE = 6
+
+NAME_RE = re.compile(r"^[A-Z][A-Z0-9_]*$")
+
+
+class TextError(Exception):
+    pass
+
+
+def unquote(text, where, ascii_only=True):
+    if len(text) >= 2 and text[0] == text[-1] == '"':
+        text = text[1:-1]
+    for c in text:
+        if ascii_only and not " " <= c <= "~":
+            raise TextError(f"{where}: {c!r} is not printable ASCII")
+    if '"' in text or "\\" in text:
+        raise TextError(f"{where}: quotes and backslashes are not supported")
+    if not text:
+        raise TextError(f"{where}: empty string")
+    return text
+
+
+def parse(path, ascii_only=True):
+    """Return [(name, [text, ...] or text)] in file order."""
+    entries, names = [], set()
+    section = None
+    with open(path, encoding="utf-8") as f:
+        for lineno, raw in enumerate(f, 1):
+            where = f"{os.path.basename(path)}:{lineno}"
+            line = raw.rstrip("\n").strip()
+            if not line or line.startswith("#"):
+                continue
+            m = re.match(r"^\[(array\s+(\w+)|strings)\]$", line)
+            if m:
+                if m.group(2):
+                    section = m.group(2)
+                    if not NAME_RE.match(section) or section in names:
+                        raise TextError(f"{where}: bad or repeated name {section}")
+                    names.add(section)
+                    entries.append((section, []))
+                else:
+                    section = ""
+                continue
+            if section is None:
+                raise TextError(f"{where}: text before the first section")
+            if section:
+                entries[-1][1].append(unquote(line, where, ascii_only))
+                continue
+            name, sep, text = line.partition("=")
+            name = name.strip()
+            if not sep or not NAME_RE.match(name) or name in names:
+                raise TextError(f"{where}: expected a new NAME = text")
+            names.add(name)
+            entries.append((name, unquote(text.strip(), where, ascii_only)))
+    for name, value in entries:
+        if isinstance(value, list) and not value:
+            raise TextError(f"{os.path.basename(path)}: array {name} is empty")
+    return entries
+
+
+def intern(strings):
+    """Lay the strings out in one pool. Returns (pieces, offsets)."""
+    unique = sorted(set(strings), key=lambda s: (-len(s), s))
+    pieces, offsets, end = [], {}, 0
+    for s in unique:
+        for owner, start in pieces:
+            if owner.endswith(s):
+                offsets[s] = start + len(owner) - len(s)
+                break
+        else:
+            pieces.append((s, end))
+            offsets[s] = end
+            end += len(s) + 1
+    return pieces, offsets
+
+
+def width(text):
+    return len(text) * CHAR_ADVANCE
+
+
+def render(entries, source):
+    strings = []
+    for _, value in entries:
+        strings.extend(value if isinstance(value, list) else [value])
+    pieces, offsets = intern(strings)
+    pool_bytes = sum(len(s) + 1 for s, _ in pieces)
+    naive_bytes = sum(len(s) + 1 for s in strings)
+
+    def entry(text):
+        return f"{{POOL + {offsets[text]}, {width(text)}}}"
+
+    out = [
+        "/*",
+        f" * GENERATED from extras/{source} by extras/gen_ui_text.py.",
+        " * Do not edit; change the text file and rerun the generator.",
+        " */",
+        "",
+        "#ifndef LIFELINE_UI_TEXT_TABLE_H",
+        "#define LIFELINE_UI_TEXT_TABLE_H",
+        "",
+        "namespace lifeline {",
+        "namespace ui {",
+        "",
+        f"// {len(strings)} strings in {pool_bytes} bytes "
+        f"({naive_bytes} as separate literals)",
+        "constexpr char POOL[] =",
+    ]
+    for i, (s, start) in enumerate(pieces):
+        end = ";" if i == len(pieces) - 1 else ""
+        out.append(f'    "{s}\\0"{end} // {start}')
+    out.append("")
+    for name, value in entries:
+        if isinstance(value, list):
+            out.append(f"constexpr Text {name}[{len(value)}] = {{")
+            for i, text in enumerate(value):
+                sep = "," if i < len(value) - 1 else ""
+                out.append(f"    {entry(text)}{sep} // {text}")
+            out.append("};")
+            out.append(f"constexpr uint8_t {name}_COUNT = {len(value)};")
+            out.append("")
+    for name, value in entries:
+        if not isinstance(value, list):
+            out.append(f"constexpr Text {name} = {entry(value)}; // {value}")
+    out += [
+        "",
+        "} // namespace ui",
+        "} // namespace lifeline",
+        "",
+        "#endif // LIFELINE_UI_TEXT_TABLE_H",
+        "",
+    ]
+    return "\n".join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("input", nargs="?", default=DEFAULT_INPUT)
+    ap.add_argument("output", nargs="?", default=DEFAULT_OUTPUT)
+    ap.add_argument("--check", action="store_true",
+                    help="compare with the output file instead of writing it")
+    args = ap.parse_args()
+
+    try:
+        text = render(parse(args.input), os.path.basename(args.input))
+    except TextError as e:
+        sys.exit(f"gen_ui_text: {e}")
+
+    if args.check:
+        try:
+            with open(args.output, encoding="utf-8") as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = None
+        if current != text:
+            sys.exit(f"gen_ui_text: {args.output} is stale; rerun "
+                     "extras/gen_ui_text.py and commit it")
+        return
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    main()
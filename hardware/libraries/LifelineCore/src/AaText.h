@@ -0,0 +1,234 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                LIFELINE CORE - ANTI-ALIASED PROPORTIONAL TEXT
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * font5x7 scaled to size 2-4 is blocky, and the ILI9488 sketches draw each
+ * scaled pixel with its own fillRect(), which opens its own address window.
+ * AaTextRenderer draws proportional, kerned text from 4-bpp glyphs instead.
+ * The background colour under the text is known (the card or header the
+ * text sits on), so the renderer blends each edge pixel into it in a line
+ * buffer. It sends the rectangle around the ink through one window, a row
+ * at a time:
+ *
+ *   lifeline::AaTextRenderer aaText;   // static: holds the line buffers
+ *   aaText.draw(panel, lifeline::aa::SANS_BOLD_32, "EMERGENCY", x, y,
+ *               alertColor, cardColor);
+ *
+ * The panel argument is any sink with begin(x, y, w, h), write(pixels, n)
+ * (n RGB565 values, one row) and end(). The text box is the string's width
+ * by the font's line height, with y at its top; the caller has already
+ * filled it with bg, so rows and columns without ink are not sent. The
+ * fonts live in
+ * AaTextFonts.h, generated by extras/gen_aa_font.py from DejaVu Sans Bold.
+ * Characters a font does not have are skipped.
+ *
+ * Cost per run is one window, then the ink rectangle's pixels, with no
+ * per-pixel command bytes. font5x7 at size 2 pays a window for every lit
+ * pixel.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_AA_TEXT_H
+#define LIFELINE_AA_TEXT_H
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef AA_LINE_MAX
+#define AA_LINE_MAX 480 // Widest text box in pixels (the ILI9488 long side)
+#endif
+#ifndef AA_RUN_MAX
+#define AA_RUN_MAX 48 // Longest string drawn as one run (the rest is cut)
+#endif
+
+namespace lifeline {
+
+/**
+ * One glyph: width x height alpha values (0-15) at bitmap + offset, two
+ * per byte with the left pixel in the high nibble, rows back to back.
+ * advance 0 marks a character the font does not have.
+ */
+struct AaGlyph {
+  uint16_t offset;
+  uint8_t width;
+  uint8_t height;
+  int8_t left;     // Ink column relative to the pen
+  uint8_t top;     // Ink row below the top of the line
+  uint8_t advance; // Pen step in pixels
+};
+static_assert(sizeof(AaGlyph) == 8, "gen_aa_font.py counts 8 bytes");
+
+/** Pen adjustment between two characters, sorted by (left, right). */
+struct AaKern {
+  char left;
+  char right;
+  int8_t dx;
+};
+
+struct AaFont {
+  const uint8_t *bitmap;
+  const AaGlyph *glyphs; // One per character first..last
+  const AaKern *kerns;
+  uint16_t kernCount;
+  uint8_t first;
+  uint8_t last;
+  uint8_t height; // Line height: every glyph fits in it
+  uint8_t ascent; // Baseline row
+};
+
+/** Glyph for c, or nullptr when the font does not have it. */
+inline const AaGlyph *aaGlyph(const AaFont &font, char c) {
+  const uint8_t u = (uint8_t)c;
+  if (u < font.first || u > font.last)
+    return nullptr;
+  const AaGlyph *g = &font.glyphs[u - font.first];
+  return g->advance ? g : nullptr;
+}
+
+/** Kerning between left and right (binary search, 0 when none). */
+inline int8_t aaKern(const AaFont &font, char left, char right) {
+  uint16_t lo = 0, hi = font.kernCount;
+  const uint16_t key = (uint16_t)((uint8_t)left << 8 | (uint8_t)right);
+  while (lo < hi) {
+    const uint16_t mid = (uint16_t)((lo + hi) / 2);
+    const AaKern &k = font.kerns[mid];
+    const uint16_t at = (uint16_t)((uint8_t)k.left << 8 | (uint8_t)k.right);
+    if (at == key)
+      return k.dx;
+    if (at < key)
+      lo = (uint16_t)(mid + 1);
+    else
+      hi = mid;
+  }
+  return 0;
+}
+
+/** Width of the text box for s: the pen end or the last ink, if further. */
+inline uint16_t aaTextWidth(const AaFont &font, const char *s) {
+  int16_t pen = 0, right = 0;
+  char prev = 0;
+  for (uint8_t n = 0; *s && n < AA_RUN_MAX; s++) {
+    const AaGlyph *g = aaGlyph(font, *s);
+    if (!g)
+      continue;
+    n++;
+    if (prev)
+      pen = (int16_t)(pen + aaKern(font, prev, *s));
+    if (g->width && pen + g->left + g->width > right)
+      right = (int16_t)(pen + g->left + g->width);
+    pen = (int16_t)(pen + g->advance);
+    prev = *s;
+  }
+  if (pen > right)
+    right = pen;
+  return right > AA_LINE_MAX ? AA_LINE_MAX : (uint16_t)right;
+}
+
+/** fg over bg at alpha / 15, per RGB565 channel. */
+constexpr uint16_t aaBlend(uint16_t fg, uint16_t bg, uint8_t alpha) {
+  return (uint16_t)(
+      (((fg >> 11) * alpha + (bg >> 11) * (15 - alpha) + 7) / 15) << 11 |
+      ((((fg >> 5) & 0x3F) * alpha + ((bg >> 5) & 0x3F) * (15 - alpha) + 7) /
+       15)
+          << 5 |
+      (((fg & 0x1F) * alpha + (bg & 0x1F) * (15 - alpha) + 7) / 15));
+}
+
+class AaTextRenderer {
+public:
+  /**
+   * Draw s with the top-left of its box at (x, y), fg blended over bg.
+   * Only the rectangle around the ink is sent: the rest of the box is
+   * already bg. Returns the box width (0 when there is nothing to draw).
+   */
+  template <typename Sink>
+  uint16_t draw(Sink &sink, const AaFont &font, const char *s, int16_t x,
+                int16_t y, uint16_t fg, uint16_t bg) {
+    const uint16_t w = layout(font, s);
+    if (inkRight_ <= inkLeft_ || inkBottom_ <= inkTop_)
+      return w;
+    uint16_t lut[16];
+    for (uint8_t a = 0; a < 16; a++)
+      lut[a] = aaBlend(fg, bg, a);
+
+    const uint16_t n = (uint16_t)(inkRight_ - inkLeft_);
+    sink.begin((int16_t)(x + inkLeft_), (int16_t)(y + inkTop_), (int16_t)n,
+               (int16_t)(inkBottom_ - inkTop_));
+    for (uint8_t row = inkTop_; row < inkBottom_; row++) {
+      memset(alpha_, 0, n);
+      for (uint8_t i = 0; i < count_; i++)
+        blitRow(font, *glyph_[i], (int16_t)(pen_[i] - inkLeft_), row, n);
+      for (uint16_t i = 0; i < n; i++)
+        line_[i] = lut[alpha_[i]];
+      sink.write(line_, n);
+    }
+    sink.end();
+    return w;
+  }
+
+private:
+  /** Glyphs, pen positions and ink bounds of s; returns the box width. */
+  uint16_t layout(const AaFont &font, const char *s) {
+    const uint16_t w = aaTextWidth(font, s);
+    count_ = 0;
+    inkLeft_ = (int16_t)w, inkRight_ = 0;
+    inkTop_ = font.height, inkBottom_ = 0;
+    int16_t pen = 0;
+    char prev = 0;
+    for (; *s && count_ < AA_RUN_MAX; s++) {
+      const AaGlyph *g = aaGlyph(font, *s);
+      if (!g)
+        continue;
+      if (prev)
+        pen = (int16_t)(pen + aaKern(font, prev, *s));
+      glyph_[count_] = g;
+      pen_[count_++] = pen;
+      if (g->width) {
+        const int16_t l = (int16_t)(pen + g->left);
+        if (l < inkLeft_)
+          inkLeft_ = l < 0 ? 0 : l;
+        if (l + g->width > inkRight_)
+          inkRight_ = (int16_t)(l + g->width);
+        if (g->top < inkTop_)
+          inkTop_ = g->top;
+        if (g->top + g->height > inkBottom_)
+          inkBottom_ = (uint8_t)(g->top + g->height);
+      }
+      pen = (int16_t)(pen + g->advance);
+      prev = *s;
+    }
+    if (inkRight_ > (int16_t)w)
+      inkRight_ = (int16_t)w;
+    return w;
+  }
+
+  /** Max-combine row `row` of g at pen into alpha_ (kerned glyphs touch). */
+  void blitRow(const AaFont &font, const AaGlyph &g, int16_t pen, uint8_t row,
+               uint16_t w) {
+    if (row < g.top || row >= g.top + g.height)
+      return;
+    const uint8_t *bits = font.bitmap + g.offset;
+    uint16_t i = (uint16_t)((row - g.top) * g.width);
+    int16_t px = (int16_t)(pen + g.left);
+    for (uint8_t col = 0; col < g.width; col++, i++, px++) {
+      const uint8_t a = (i & 1) ? bits[i >> 1] & 0x0F : bits[i >> 1] >> 4;
+      if (a && px >= 0 && px < (int16_t)w && a > alpha_[px])
+        alpha_[px] = a;
+    }
+  }
+
+  const AaGlyph *glyph_[AA_RUN_MAX];
+  int16_t pen_[AA_RUN_MAX];
+  uint8_t count_ = 0;
+  int16_t inkLeft_ = 0, inkRight_ = 0; // Ink columns [left, right) in the box
+  uint8_t inkTop_ = 0, inkBottom_ = 0; // Ink rows [top, bottom)
+  uint8_t alpha_[AA_LINE_MAX];
+  uint16_t line_[AA_LINE_MAX];
+};
+
+} // namespace lifeline
+
+#include "AaTextFonts.h"
+
+#endif // LIFELINE_AA_TEXT_H
@@ -0,0 +1,2167 @@
+/*
+ * GENERATED from DejaVuSans-Bold.ttf by extras/gen_aa_font.py.
+ * Do not edit; change FONTS in the generator and rerun it.
+ *
+ * DejaVu fonts are derived from Bitstream Vera: free to embed and
+ * redistribute, see https://dejavu-fonts.github.io/License.html.
+ */
+
+#ifndef LIFELINE_AA_TEXT_FONTS_H
+#define LIFELINE_AA_TEXT_FONTS_H
+
+namespace lifeline {
+namespace aa {
+
+// 12 px, 95 glyphs, 13 px line: 3055 bitmap bytes, 4073 in all
+constexpr uint8_t SANS_BOLD_12_BITMAP[] = {
+    0x4B, 0x95, 0xFC, 0x5F, 0xC5, 0xFC, 0x3F, 0xA1, 0xF8, 0x12, 0x15, 0xFC,
+    0x5F, 0xC0, 0xA6, 0x3B, 0x1D, 0x84, 0xF2, 0xD8, 0x4F, 0x26, 0x42, 0x81,
+    0x00, 0x00, 0x92, 0x29, 0x10, 0x00, 0x04, 0xF1, 0x6E, 0x00, 0x03, 0x6A,
+    0xE6, 0xBC, 0x61, 0x07, 0xDF, 0xED, 0xFE, 0xD3, 0x00, 0x1F, 0x42, 0xF2,
+    0x00, 0x18, 0x9F, 0x8A, 0xF8, 0x40, 0x2B, 0xDE, 0xBE, 0xDB, 0x60, 0x00,
+    0xB9, 0x0D, 0x60, 0x00, 0x00, 0xE5, 0x2F, 0x20, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x04, 0xA0, 0x00, 0x01, 0x8C, 0xEA, 0x80, 0x0C, 0xFB, 0xDA,
+    0xE0, 0x1F, 0xD5, 0xA0, 0x00, 0x0C, 0xFF, 0xE9, 0x30, 0x01, 0x8D, 0xFF,
+    0xF4, 0x00, 0x04, 0xA7, 0xF8, 0x1C, 0x88, 0xCA, 0xF6, 0x0A, 0xDF, 0xFD,
+    0x80, 0x00, 0x04, 0xA0, 0x00, 0x00, 0x03, 0x70, 0x00, 0x09, 0xDC, 0x30,
+    0x03, 0xD2, 0x00, 0x7F, 0x3A, 0xD0, 0x0B, 0x80, 0x00, 0x9D, 0x06, 0xF1,
+    0x5D, 0x10, 0x00, 0x6F, 0x3A, 0xD1, 0xE5, 0x00, 0x00, 0x08, 0xDB, 0x38,
+    0xB1, 0x79, 0x50, 0x00, 0x00, 0x3E, 0x2B, 0xD7, 0xF5, 0x00, 0x00, 0xB8,
+    0x0F, 0x70, 0xD9, 0x00, 0x05, 0xD1, 0x0E, 0x80, 0xE8, 0x00, 0x1E, 0x50,
+    0x06, 0xFE, 0xD2, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x2B, 0xDD,
+    0xA1, 0x00, 0x00, 0xCF, 0xA8, 0xC1, 0x00, 0x00, 0xEF, 0x40, 0x00, 0x00,
+    0x00, 0xBF, 0xD1, 0x01, 0x42, 0x0A, 0xFD, 0xFC, 0x15, 0xF7, 0x3F, 0xD0,
+    0xAF, 0xBB, 0xF3, 0x4F, 0xD0, 0x1C, 0xFF, 0xB0, 0x1E, 0xFA, 0x6A, 0xFF,
+    0x90, 0x03, 0xDF, 0xFE, 0x9D, 0xF8, 0x00, 0x02, 0x20, 0x00, 0x00, 0xA6,
+    0xD8, 0xD8, 0x64, 0x00, 0x21, 0x09, 0xF3, 0x2F, 0xC0, 0x7F, 0x70, 0xCF,
+    0x30, 0xEF, 0x10, 0xEF, 0x00, 0xDF, 0x20, 0xAF, 0x50, 0x4F, 0x90, 0x0C,
+    0xE1, 0x04, 0x94, 0x21, 0x00, 0xBE, 0x20, 0x4F, 0x80, 0x0E, 0xE0, 0x0B,
+    0xF4, 0x09, 0xF6, 0x08, 0xF7, 0x09, 0xF5, 0x0C, 0xF2, 0x2F, 0xC0, 0x8F,
+    0x50, 0x88, 0x00, 0x00, 0x58, 0x00, 0x78, 0x6A, 0x5A, 0x18, 0xFF, 0xA2,
+    0x3B, 0xDE, 0xD6, 0x54, 0x5A, 0x27, 0x00, 0x36, 0x00, 0x00, 0x05, 0x50,
+    0x00, 0x00, 0x0A, 0xB0, 0x00, 0x00, 0x0A, 0xB0, 0x00, 0x58, 0x8D, 0xD8,
+    0x86, 0xAD, 0xDE, 0xED, 0xDA, 0x00, 0x0A, 0xB0, 0x00, 0x00, 0x0A, 0xB0,
+    0x00, 0x00, 0x0A, 0xB0, 0x00, 0x03, 0x41, 0x0C, 0xF5, 0x0C, 0xF4, 0x1F,
+    0xA0, 0x3B, 0x10, 0x14, 0x44, 0x15, 0xFF, 0xF5, 0x26, 0x66, 0x20, 0x34,
+    0x1C, 0xF5, 0xCF, 0x50, 0x00, 0x1B, 0x30, 0x05, 0xE1, 0x00, 0x9A, 0x00,
+    0x0E, 0x50, 0x04, 0xF1, 0x00, 0x8B, 0x00, 0x0D, 0x60, 0x03, 0xF2, 0x00,
+    0x7C, 0x00, 0x0C, 0x70, 0x00, 0x21, 0x00, 0x00, 0x00, 0x8D, 0xDA, 0x20,
+    0x09, 0xFD, 0xBF, 0xE1, 0x2F, 0xF1, 0x0B, 0xF7, 0x5F, 0xD0, 0x08, 0xFA,
+    0x6F, 0xD0, 0x07, 0xFC, 0x6F, 0xD0, 0x08, 0xFB, 0x3F, 0xF1, 0x0A, 0xF8,
+    0x0C, 0xFA, 0x7F, 0xF2, 0x02, 0xCF, 0xFE, 0x50, 0x00, 0x01, 0x20, 0x00,
+    0x48, 0xBB, 0x60, 0x0A, 0xEE, 0xF8, 0x00, 0x10, 0x9F, 0x80, 0x00, 0x09,
+    0xF8, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x09, 0xF8, 0x00, 0x00, 0x9F, 0x80,
+    0x04, 0x8C, 0xFB, 0x84, 0x9F, 0xFF, 0xFF, 0x80, 0x08, 0xCD, 0xDA, 0x20,
+    0x0F, 0xC9, 0xEF, 0xE1, 0x04, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x2F, 0xF2,
+    0x00, 0x01, 0xCF, 0x80, 0x00, 0x2D, 0xF8, 0x00, 0x03, 0xEF, 0x60, 0x00,
+    0x1E, 0xFD, 0x99, 0x93, 0x1F, 0xFF, 0xFF, 0xF5, 0x08, 0xCD, 0xDA, 0x30,
+    0x0C, 0xB9, 0xDF, 0xE1, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x34, 0x8F, 0xC0,
+    0x00, 0xAF, 0xFE, 0x50, 0x00, 0x34, 0x7F, 0xF3, 0x00, 0x00, 0x0D, 0xF6,
+    0x3B, 0x76, 0x9F, 0xF3, 0x2E, 0xFF, 0xFD, 0x60, 0x00, 0x22, 0x20, 0x00,
+    0x00, 0x02, 0xBB, 0x60, 0x00, 0x0C, 0xFF, 0x80, 0x00, 0x7F, 0xBF, 0x80,
+    0x02, 0xF7, 0x9F, 0x80, 0x0C, 0xC0, 0x9F, 0x80, 0x6F, 0x64, 0xAF, 0xA3,
+    0x7F, 0xFF, 0xFF, 0xFC, 0x36, 0x66, 0xBF, 0xB4, 0x00, 0x00, 0x9F, 0x80,
+    0x08, 0xBB, 0xBB, 0xA0, 0x0B, 0xFD, 0xDD, 0xC0, 0x0B, 0xF1, 0x00, 0x00,
+    0x0B, 0xFD, 0xDA, 0x30, 0x0B, 0xCA, 0xDF, 0xE2, 0x01, 0x00, 0x1D, 0xF7,
+    0x00, 0x00, 0x0C, 0xF7, 0x1D, 0x86, 0x9F, 0xF3, 0x1C, 0xFF, 0xFE, 0x60,
+    0x00, 0x12, 0x20, 0x00, 0x00, 0x4A, 0xDD, 0xA1, 0x04, 0xFF, 0xA9, 0xD2,
+    0x0D, 0xF5, 0x00, 0x00, 0x2F, 0xF8, 0xBA, 0x40, 0x4F, 0xFE, 0xBF, 0xF4,
+    0x3F, 0xF4, 0x09, 0xFA, 0x1F, 0xF3, 0x07, 0xFA, 0x0A, 0xFA, 0x4D, 0xF6,
+    0x01, 0xAF, 0xFF, 0x80, 0x00, 0x01, 0x21, 0x00, 0x2B, 0xBB, 0xBB, 0xB4,
+    0x3D, 0xDD, 0xDF, 0xF5, 0x00, 0x00, 0x4F, 0xE1, 0x00, 0x00, 0xBF, 0x70,
+    0x00, 0x03, 0xFE, 0x10, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x1F, 0xF2, 0x00,
+    0x00, 0x8F, 0xA0, 0x00, 0x01, 0xEF, 0x30, 0x00, 0x02, 0xAD, 0xDC, 0x50,
+    0x0D, 0xFB, 0x9F, 0xF3, 0x1F, 0xF1, 0x0B, 0xF6, 0x0B, 0xF9, 0x6E, 0xE2,
+    0x03, 0xEF, 0xFF, 0x70, 0x1E, 0xF4, 0x2C, 0xF5, 0x4F, 0xD0, 0x08, 0xF9,
+    0x2F, 0xF7, 0x4D, 0xF7, 0x06, 0xEF, 0xFF, 0xA0, 0x00, 0x02, 0x21, 0x00,
+    0x02, 0x9D, 0xD9, 0x10, 0x0D, 0xFA, 0xAF, 0xC0, 0x4F, 0xD0, 0x0D, 0xF4,
+    0x5F, 0xD0, 0x0D, 0xF8, 0x2F, 0xF8, 0x8F, 0xF9, 0x05, 0xDF, 0xED, 0xF8,
+    0x00, 0x00, 0x0C, 0xF4, 0x08, 0x65, 0xAF, 0xC0, 0x0B, 0xFF, 0xFA, 0x10,
+    0x00, 0x12, 0x10, 0x00, 0x69, 0x4A, 0xF7, 0x7B, 0x50, 0x00, 0x24, 0x2A,
+    0xF7, 0xAF, 0x70, 0x06, 0x94, 0x0A, 0xF7, 0x07, 0xB5, 0x00, 0x00, 0x02,
+    0x42, 0x0A, 0xF7, 0x0A, 0xF6, 0x0E, 0xC0, 0x2B, 0x30, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x15, 0xBB, 0x00, 0x49, 0xEF, 0xB5, 0x6D, 0xFC, 0x61,
+    0x00, 0xBF, 0xB4, 0x00, 0x00, 0x16, 0xBF, 0xE9, 0x40, 0x00, 0x02, 0x7C,
+    0xFB, 0x00, 0x00, 0x00, 0x36, 0x8B, 0xBB, 0xBB, 0xB9, 0x79, 0x99, 0x99,
+    0x97, 0x12, 0x22, 0x22, 0x21, 0xBF, 0xFF, 0xFF, 0xFC, 0x34, 0x44, 0x44,
+    0x43, 0x10, 0x00, 0x00, 0x00, 0xBB, 0x51, 0x00, 0x00, 0x5B, 0xFE, 0xA4,
+    0x00, 0x00, 0x16, 0xBF, 0xE7, 0x00, 0x00, 0x4B, 0xFC, 0x04, 0x9E, 0xFB,
+    0x61, 0xAF, 0xD7, 0x20, 0x00, 0x63, 0x00, 0x00, 0x00, 0x1A, 0xDD, 0xB4,
+    0x03, 0xEA, 0xBF, 0xE1, 0x11, 0x00, 0xFF, 0x20, 0x00, 0x7F, 0xD0, 0x00,
+    0x7F, 0xD2, 0x00, 0x0E, 0xF4, 0x00, 0x00, 0x22, 0x00, 0x00, 0x0E, 0xF2,
+    0x00, 0x00, 0xEF, 0x20, 0x00, 0x00, 0x00, 0x36, 0x64, 0x00, 0x00, 0x00,
+    0x2C, 0xEB, 0xAD, 0xD4, 0x00, 0x02, 0xE8, 0x10, 0x00, 0x5E, 0x40, 0x0A,
+    0x90, 0x5B, 0x97, 0x56, 0xC0, 0x1F, 0x23, 0xF8, 0x7F, 0x71, 0xF1, 0x3E,
+    0x07, 0xE0, 0x0D, 0x70, 0xF2, 0x2E, 0x06, 0xE0, 0x0E, 0x74, 0xE0, 0x0E,
+    0x31, 0xEC, 0xCE, 0xCE, 0x50, 0x08, 0xC1, 0x27, 0x55, 0x62, 0x00, 0x00,
+    0xBC, 0x51, 0x14, 0xB3, 0x00, 0x00, 0x07, 0xDF, 0xFD, 0x71, 0x00, 0x00,
+    0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x09, 0xBB, 0x10, 0x00, 0x00, 0x2F,
+    0xFF, 0x70, 0x00, 0x00, 0x8F, 0xDF, 0xC0, 0x00, 0x00, 0xDF, 0x4E, 0xF3,
+    0x00, 0x04, 0xFD, 0x09, 0xF8, 0x00, 0x0A, 0xFA, 0x47, 0xFE, 0x00, 0x1E,
+    0xFF, 0xFF, 0xFF, 0x50, 0x6F, 0xD6, 0x66, 0xAF, 0xA0, 0xBF, 0x80, 0x00,
+    0x3F, 0xF1, 0xAB, 0xBB, 0xA7, 0x10, 0xDF, 0xDB, 0xEF, 0xA0, 0xDF, 0x50,
+    0x6F, 0xE0, 0xDF, 0x96, 0xBF, 0xA0, 0xDF, 0xFF, 0xFF, 0x50, 0xDF, 0x72,
+    0x6F, 0xF2, 0xDF, 0x50, 0x0F, 0xF4, 0xDF, 0xA8, 0xBF, 0xF2, 0xDF, 0xFF,
+    0xFC, 0x50, 0x00, 0x39, 0xDD, 0xC7, 0x00, 0x4F, 0xFE, 0xBD, 0xF1, 0x1E,
+    0xFA, 0x00, 0x04, 0x04, 0xFF, 0x10, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00,
+    0x05, 0xFF, 0x10, 0x00, 0x00, 0x1F, 0xF7, 0x00, 0x01, 0x00, 0x8F, 0xFA,
+    0x89, 0xE1, 0x00, 0x6D, 0xFF, 0xFB, 0x00, 0x00, 0x02, 0x21, 0x00, 0xAB,
+    0xBB, 0xA6, 0x10, 0x0D, 0xFF, 0xFF, 0xFE, 0x30, 0xDF, 0x50, 0x3C, 0xFD,
+    0x0D, 0xF5, 0x00, 0x3F, 0xF3, 0xDF, 0x50, 0x00, 0xFF, 0x5D, 0xF5, 0x00,
+    0x2F, 0xF4, 0xDF, 0x50, 0x0A, 0xFE, 0x1D, 0xFD, 0xBE, 0xFF, 0x50, 0xDF,
+    0xFF, 0xDA, 0x40, 0x00, 0xAB, 0xBB, 0xBB, 0x2D, 0xFF, 0xFF, 0xF3, 0xDF,
+    0x50, 0x00, 0x0D, 0xF9, 0x66, 0x50, 0xDF, 0xFF, 0xFE, 0x0D, 0xF8, 0x44,
+    0x40, 0xDF, 0x50, 0x00, 0x0D, 0xFD, 0xBB, 0xB4, 0xDF, 0xFF, 0xFF, 0x50,
+    0xAB, 0xBB, 0xBB, 0x2D, 0xFF, 0xFF, 0xF3, 0xDF, 0x50, 0x00, 0x0D, 0xF9,
+    0x66, 0x50, 0xDF, 0xFF, 0xFE, 0x0D, 0xF8, 0x44, 0x40, 0xDF, 0x50, 0x00,
+    0x0D, 0xF5, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x29, 0xDD, 0xDA,
+    0x40, 0x4F, 0xFE, 0xBC, 0xFA, 0x1E, 0xFA, 0x00, 0x01, 0x44, 0xFF, 0x10,
+    0x00, 0x00, 0x6F, 0xE0, 0x07, 0xDD, 0xD5, 0xFF, 0x10, 0x5A, 0xFE, 0x1F,
+    0xF7, 0x00, 0x3F, 0xE0, 0x8F, 0xFA, 0x89, 0xFE, 0x00, 0x6D, 0xFF, 0xFD,
+    0x80, 0x00, 0x02, 0x21, 0x00, 0xAB, 0x40, 0x04, 0xBB, 0xDF, 0x50, 0x05,
+    0xFE, 0xDF, 0x50, 0x05, 0xFE, 0xDF, 0x96, 0x69, 0xFE, 0xDF, 0xFF, 0xFF,
+    0xFE, 0xDF, 0x84, 0x47, 0xFE, 0xDF, 0x50, 0x05, 0xFE, 0xDF, 0x50, 0x05,
+    0xFE, 0xDF, 0x50, 0x05, 0xFE, 0xAB, 0x4D, 0xF5, 0xDF, 0x5D, 0xF5, 0xDF,
+    0x5D, 0xF5, 0xDF, 0x5D, 0xF5, 0xDF, 0x50, 0x00, 0xAB, 0x40, 0x0D, 0xF5,
+    0x00, 0xDF, 0x50, 0x0D, 0xF5, 0x00, 0xDF, 0x50, 0x0D, 0xF5, 0x00, 0xDF,
+    0x50, 0x0D, 0xF5, 0x00, 0xEF, 0x53, 0x9F, 0xF2, 0xAF, 0xF8, 0x04, 0x52,
+    0x00, 0xAB, 0x40, 0x09, 0xB9, 0x0D, 0xF5, 0x0A, 0xFD, 0x20, 0xDF, 0x6A,
+    0xFD, 0x10, 0x0D, 0xFE, 0xFD, 0x10, 0x00, 0xDF, 0xFF, 0x40, 0x00, 0x0D,
+    0xFE, 0xFE, 0x30, 0x00, 0xDF, 0x6A, 0xFE, 0x30, 0x0D, 0xF5, 0x0A, 0xFE,
+    0x30, 0xDF, 0x50, 0x0A, 0xFE, 0x30, 0xAB, 0x40, 0x00, 0x0D, 0xF5, 0x00,
+    0x00, 0xDF, 0x50, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x0D,
+    0xF5, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x0D, 0xFD, 0xBB, 0xB4, 0xDF, 0xFF,
+    0xFF, 0x50, 0xAB, 0xB1, 0x00, 0x2B, 0xB9, 0xDF, 0xF8, 0x00, 0x8F, 0xFD,
+    0xDF, 0xEE, 0x01, 0xEE, 0xFD, 0xDF, 0x9F, 0x56, 0xF9, 0xFD, 0xDF, 0x4E,
+    0xCD, 0xD5, 0xFD, 0xDF, 0x48, 0xFF, 0x74, 0xFD, 0xDF, 0x42, 0xFE, 0x14,
+    0xFD, 0xDF, 0x40, 0x54, 0x04, 0xFD, 0xDF, 0x40, 0x00, 0x04, 0xFD, 0xAB,
+    0x90, 0x02, 0xBB, 0xDF, 0xF4, 0x03, 0xFE, 0xDF, 0xFC, 0x03, 0xFE, 0xDF,
+    0xBF, 0x53, 0xFE, 0xDF, 0x4E, 0xD3, 0xFE, 0xDF, 0x47, 0xF9, 0xFE, 0xDF,
+    0x40, 0xDF, 0xFE, 0xDF, 0x40, 0x6F, 0xFE, 0xDF, 0x40, 0x0C, 0xFE, 0x00,
+    0x4A, 0xDD, 0xB5, 0x00, 0x05, 0xFF, 0xCC, 0xFF, 0x80, 0x1E, 0xF8, 0x00,
+    0x5F, 0xF3, 0x4F, 0xF1, 0x00, 0x0D, 0xF7, 0x6F, 0xE0, 0x00, 0x0B, 0xF9,
+    0x5F, 0xF0, 0x00, 0x0C, 0xF8, 0x2F, 0xF5, 0x00, 0x2F, 0xF4, 0x09, 0xFE,
+    0x98, 0xEF, 0xB0, 0x00, 0x7E, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x22, 0x00,
+    0x00, 0xAB, 0xBB, 0xB7, 0x10, 0xDF, 0xED, 0xFF, 0xC0, 0xDF, 0x50, 0x3F,
+    0xF4, 0xDF, 0x50, 0x2F, 0xF4, 0xDF, 0xBA, 0xDF, 0xE1, 0xDF, 0xFF, 0xEB,
+    0x30, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00,
+    0x00, 0x00, 0x4A, 0xDD, 0xB5, 0x00, 0x05, 0xFF, 0xCC, 0xFF, 0x90, 0x1E,
+    0xF8, 0x00, 0x5F, 0xF3, 0x4F, 0xF1, 0x00, 0x0D, 0xF7, 0x6F, 0xE0, 0x00,
+    0x0B, 0xF9, 0x5F, 0xF0, 0x00, 0x0C, 0xF8, 0x2F, 0xF5, 0x00, 0x2F, 0xF4,
+    0x09, 0xFE, 0x88, 0xEF, 0xB0, 0x00, 0x7E, 0xFF, 0xFA, 0x10, 0x00, 0x00,
+    0x26, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x70, 0xAB, 0xBB, 0xA7, 0x00,
+    0xDF, 0xED, 0xFF, 0x90, 0xDF, 0x50, 0x7F, 0xD0, 0xDF, 0x50, 0x7F, 0xB0,
+    0xDF, 0xED, 0xFC, 0x20, 0xDF, 0xDC, 0xFE, 0x30, 0xDF, 0x50, 0xAF, 0xB0,
+    0xDF, 0x50, 0x2F, 0xF4, 0xDF, 0x50, 0x0A, 0xFB, 0x02, 0x9D, 0xDC, 0xA1,
+    0x0C, 0xFD, 0xBC, 0xF3, 0x2F, 0xE0, 0x00, 0x21, 0x1F, 0xFA, 0x63, 0x00,
+    0x07, 0xFF, 0xFF, 0xC2, 0x00, 0x26, 0x9E, 0xFA, 0x02, 0x00, 0x07, 0xFB,
+    0x1F, 0xB8, 0x8D, 0xF8, 0x0B, 0xFF, 0xFF, 0xB1, 0x00, 0x02, 0x21, 0x00,
+    0xBB, 0xBB, 0xBB, 0xBB, 0x1E, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x1F, 0xF3,
+    0x00, 0x00, 0x01, 0xFF, 0x30, 0x00, 0x00, 0x1F, 0xF3, 0x00, 0x00, 0x01,
+    0xFF, 0x30, 0x00, 0x00, 0x1F, 0xF3, 0x00, 0x00, 0x01, 0xFF, 0x30, 0x00,
+    0x00, 0x1F, 0xF3, 0x00, 0x00, 0xAB, 0x40, 0x07, 0xB7, 0xDF, 0x50, 0x09,
+    0xFA, 0xDF, 0x50, 0x09, 0xFA, 0xDF, 0x50, 0x09, 0xFA, 0xDF, 0x50, 0x09,
+    0xFA, 0xDF, 0x50, 0x09, 0xFA, 0xCF, 0x70, 0x0B, 0xF8, 0x7F, 0xE8, 0x9F,
+    0xF3, 0x09, 0xFF, 0xFE, 0x60, 0x00, 0x12, 0x20, 0x00, 0x9B, 0x50, 0x00,
+    0x2B, 0xB1, 0x7F, 0xC0, 0x00, 0x7F, 0xB0, 0x2F, 0xF2, 0x00, 0xDF, 0x60,
+    0x0B, 0xF7, 0x03, 0xFE, 0x10, 0x06, 0xFD, 0x08, 0xFA, 0x00, 0x01, 0xEF,
+    0x3E, 0xF4, 0x00, 0x00, 0x9F, 0xCF, 0xE0, 0x00, 0x00, 0x4F, 0xFF, 0x80,
+    0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x6B, 0x70, 0x06, 0xB9, 0x00, 0x4B,
+    0x95, 0xFC, 0x00, 0xBF, 0xF0, 0x09, 0xF9, 0x2F, 0xF1, 0x0F, 0xDF, 0x40,
+    0xCF, 0x50, 0xDF, 0x44, 0xF7, 0xF7, 0x1F, 0xF1, 0x09, 0xF8, 0x7F, 0x2D,
+    0xB4, 0xFD, 0x00, 0x6F, 0xCB, 0xD0, 0xAE, 0x8F, 0x90, 0x02, 0xFF, 0xE9,
+    0x06, 0xFE, 0xF6, 0x00, 0x0E, 0xFF, 0x60, 0x2F, 0xFF, 0x20, 0x00, 0xAF,
+    0xF2, 0x00, 0xEF, 0xE0, 0x00, 0x5B, 0xA0, 0x00, 0x8B, 0x70, 0xCF, 0x80,
+    0x5F, 0xE2, 0x02, 0xEF, 0x5E, 0xF5, 0x00, 0x07, 0xFF, 0xFA, 0x00, 0x00,
+    0x0D, 0xFF, 0x20, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x02, 0xEF, 0x6E, 0xF5,
+    0x00, 0xBF, 0x90, 0x5F, 0xE1, 0x6F, 0xD1, 0x00, 0xAF, 0xA0, 0xAB, 0x70,
+    0x00, 0xAB, 0x64, 0xFF, 0x30, 0x7F, 0xE1, 0x0A, 0xFC, 0x2E, 0xF5, 0x00,
+    0x1E, 0xFE, 0xFA, 0x00, 0x00, 0x5F, 0xFE, 0x10, 0x00, 0x00, 0xCF, 0x80,
+    0x00, 0x00, 0x0C, 0xF7, 0x00, 0x00, 0x00, 0xCF, 0x70, 0x00, 0x00, 0x0C,
+    0xF7, 0x00, 0x00, 0x4B, 0xBB, 0xBB, 0xBB, 0x05, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x4F, 0xF5, 0x00, 0x00, 0x2E, 0xF7, 0x00, 0x00, 0x1C, 0xFA,
+    0x00, 0x00, 0x0A, 0xFC, 0x00, 0x00, 0x08, 0xFD, 0x10, 0x00, 0x04, 0xFF,
+    0xDB, 0xBB, 0xB2, 0x7F, 0xFF, 0xFF, 0xFF, 0x20, 0x22, 0x21, 0xFF, 0xFA,
+    0xFF, 0x43, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xB8, 0x99, 0x96, 0xA5, 0x00, 0x09, 0xA0,
+    0x00, 0x4E, 0x10, 0x00, 0xE5, 0x00, 0x0A, 0x90, 0x00, 0x5E, 0x00, 0x01,
+    0xF4, 0x00, 0x0B, 0x80, 0x00, 0x6D, 0x00, 0x02, 0xF3, 0x00, 0x02, 0x10,
+    0x02, 0x22, 0x13, 0xFF, 0xF7, 0x14, 0xAF, 0x70, 0x08, 0xF7, 0x00, 0x8F,
+    0x70, 0x08, 0xF7, 0x00, 0x8F, 0x70, 0x08, 0xF7, 0x00, 0x8F, 0x70, 0x08,
+    0xF7, 0x2B, 0xDF, 0x72, 0x99, 0x94, 0x00, 0x1B, 0xB2, 0x00, 0x01, 0xCE,
+    0xED, 0x10, 0x1C, 0xD3, 0x2C, 0xC1, 0x47, 0x10, 0x00, 0x74, 0x44, 0x44,
+    0x44, 0xDD, 0xDD, 0xDD, 0x29, 0x40, 0x06, 0xE2, 0x00, 0x56, 0x07, 0x9B,
+    0xA7, 0x10, 0x0D, 0xCA, 0xDF, 0xB0, 0x01, 0x13, 0x4F, 0xF1, 0x1B, 0xFF,
+    0xFF, 0xF2, 0x6F, 0xC1, 0x0F, 0xF2, 0x6F, 0xD4, 0x9F, 0xF2, 0x1C, 0xFF,
+    0x9E, 0xF2, 0x00, 0x21, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xFF, 0x20,
+    0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0xFF, 0x39, 0xB6, 0x00, 0xFF, 0xEC,
+    0xFF, 0x60, 0xFF, 0x60, 0x6F, 0xD0, 0xFF, 0x20, 0x2F, 0xF1, 0xFF, 0x30,
+    0x3F, 0xF0, 0xFF, 0xC6, 0xCF, 0xA0, 0xFF, 0x8F, 0xFC, 0x20, 0x00, 0x01,
+    0x20, 0x00, 0x00, 0x6A, 0xB9, 0x20, 0xBF, 0xEC, 0xE5, 0x4F, 0xE2, 0x00,
+    0x17, 0xFB, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x02, 0xEF, 0xA6, 0x74, 0x04,
+    0xDF, 0xFF, 0x40, 0x00, 0x22, 0x10, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00,
+    0x08, 0xF9, 0x00, 0x00, 0x08, 0xF9, 0x01, 0x9B, 0x68, 0xF9, 0x0C, 0xFE,
+    0xDE, 0xF9, 0x4F, 0xE1, 0x0C, 0xF9, 0x7F, 0xB0, 0x08, 0xF9, 0x6F, 0xC0,
+    0x09, 0xF9, 0x2F, 0xF8, 0x7E, 0xF9, 0x06, 0xFF, 0xDA, 0xF9, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x6A, 0xB7, 0x10, 0x0B, 0xFC, 0xBF, 0xC1, 0x4F, 0xD0,
+    0x0B, 0xF6, 0x7F, 0xFF, 0xFF, 0xF8, 0x6F, 0xC4, 0x44, 0x42, 0x2E, 0xF7,
+    0x45, 0xA4, 0x04, 0xDF, 0xFF, 0xD2, 0x00, 0x02, 0x21, 0x00, 0x00, 0x02,
+    0x21, 0x04, 0xEF, 0xF5, 0x0A, 0xF9, 0x41, 0x7D, 0xFB, 0x92, 0xAE, 0xFE,
+    0xD2, 0x0B, 0xF6, 0x00, 0x0B, 0xF6, 0x00, 0x0B, 0xF6, 0x00, 0x0B, 0xF6,
+    0x00, 0x0B, 0xF6, 0x00, 0x01, 0x8B, 0x65, 0x95, 0x0C, 0xFE, 0xDE, 0xF9,
+    0x5F, 0xE1, 0x0C, 0xF9, 0x7F, 0xB0, 0x08, 0xF9, 0x6F, 0xD0, 0x0A, 0xF9,
+    0x1E, 0xFA, 0x9F, 0xF9, 0x04, 0xDF, 0xB9, 0xF9, 0x02, 0x00, 0x1C, 0xF6,
+    0x0A, 0xEC, 0xEF, 0xC0, 0x03, 0x79, 0x85, 0x00, 0x22, 0x00, 0x00, 0x0F,
+    0xF2, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x0F, 0xF3, 0x9B, 0x60, 0xFF, 0xED,
+    0xFF, 0x5F, 0xF7, 0x0A, 0xF9, 0xFF, 0x20, 0x8F, 0x9F, 0xF2, 0x08, 0xF9,
+    0xFF, 0x20, 0x8F, 0x9F, 0xF2, 0x08, 0xF9, 0x22, 0x0F, 0xF2, 0x99, 0x19,
+    0x91, 0xFF, 0x2F, 0xF2, 0xFF, 0x2F, 0xF2, 0xFF, 0x2F, 0xF2, 0x00, 0x22,
+    0x00, 0x0F, 0xF2, 0x00, 0x99, 0x10, 0x09, 0x91, 0x00, 0xFF, 0x20, 0x0F,
+    0xF2, 0x00, 0xFF, 0x20, 0x0F, 0xF2, 0x00, 0xFF, 0x20, 0x0F, 0xF2, 0x01,
+    0xFF, 0x14, 0xDF, 0xB0, 0x49, 0x71, 0x00, 0x22, 0x00, 0x00, 0x0F, 0xF2,
+    0x00, 0x00, 0xFF, 0x20, 0x00, 0x0F, 0xF2, 0x07, 0x96, 0xFF, 0x28, 0xFC,
+    0x1F, 0xFA, 0xFB, 0x10, 0xFF, 0xFE, 0x10, 0x0F, 0xFB, 0xFB, 0x10, 0xFF,
+    0x2B, 0xFB, 0x0F, 0xF2, 0x1B, 0xFB, 0x22, 0x0F, 0xF2, 0xFF, 0x2F, 0xF2,
+    0xFF, 0x2F, 0xF2, 0xFF, 0x2F, 0xF2, 0xFF, 0x2F, 0xF2, 0x99, 0x39, 0xA4,
+    0x19, 0xB6, 0x0F, 0xFE, 0xEF, 0xED, 0xDF, 0xF4, 0xFF, 0x60, 0xDF, 0x90,
+    0xAF, 0x8F, 0xF2, 0x0C, 0xF5, 0x08, 0xF8, 0xFF, 0x20, 0xCF, 0x50, 0x8F,
+    0x8F, 0xF2, 0x0C, 0xF5, 0x08, 0xF8, 0xFF, 0x20, 0xCF, 0x50, 0x8F, 0x80,
+    0x99, 0x39, 0xB6, 0x0F, 0xFE, 0xDF, 0xF5, 0xFF, 0x70, 0xAF, 0x9F, 0xF2,
+    0x08, 0xF9, 0xFF, 0x20, 0x8F, 0x9F, 0xF2, 0x08, 0xF9, 0xFF, 0x20, 0x8F,
+    0x90, 0x00, 0x6A, 0xB8, 0x20, 0x0B, 0xFE, 0xDF, 0xE2, 0x5F, 0xE1, 0x0B,
+    0xF8, 0x7F, 0xB0, 0x07, 0xFB, 0x6F, 0xC0, 0x08, 0xFA, 0x2E, 0xF8, 0x6E,
+    0xF5, 0x04, 0xDF, 0xFE, 0x70, 0x00, 0x02, 0x20, 0x00, 0x99, 0x39, 0xB6,
+    0x00, 0xFF, 0xEC, 0xFF, 0x60, 0xFF, 0x60, 0x6F, 0xD0, 0xFF, 0x20, 0x2F,
+    0xF1, 0xFF, 0x30, 0x3F, 0xF0, 0xFF, 0xC6, 0xCF, 0xA0, 0xFF, 0x8F, 0xFC,
+    0x20, 0xFF, 0x21, 0x20, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x78, 0x10, 0x00,
+    0x00, 0x01, 0x8B, 0x65, 0x95, 0x0C, 0xFE, 0xDE, 0xF9, 0x4F, 0xE1, 0x0C,
+    0xF9, 0x7F, 0xB0, 0x08, 0xF9, 0x6F, 0xC0, 0x09, 0xF9, 0x2F, 0xF8, 0x7E,
+    0xF9, 0x06, 0xFF, 0xDA, 0xF9, 0x00, 0x12, 0x08, 0xF9, 0x00, 0x00, 0x08,
+    0xF9, 0x00, 0x00, 0x04, 0x84, 0x99, 0x39, 0xAF, 0xFE, 0xFD, 0xFF, 0x90,
+    0x1F, 0xF2, 0x00, 0xFF, 0x20, 0x0F, 0xF2, 0x00, 0xFF, 0x20, 0x00, 0x04,
+    0x9B, 0xA7, 0x13, 0xFE, 0xAC, 0xE2, 0x5F, 0xA2, 0x01, 0x01, 0xEF, 0xFE,
+    0xA1, 0x01, 0x57, 0xCF, 0x73, 0x84, 0x4A, 0xF8, 0x3E, 0xFF, 0xFC, 0x20,
+    0x02, 0x21, 0x00, 0x04, 0x62, 0x00, 0x0C, 0xF4, 0x00, 0x8E, 0xFB, 0x94,
+    0xBF, 0xFE, 0xD6, 0x0C, 0xF4, 0x00, 0x0C, 0xF4, 0x00, 0x0C, 0xF5, 0x00,
+    0x0B, 0xFB, 0x82, 0x04, 0xDF, 0xF4, 0x19, 0x90, 0x05, 0x95, 0x1F, 0xF1,
+    0x08, 0xF8, 0x1F, 0xF1, 0x08, 0xF8, 0x1F, 0xF1, 0x08, 0xF8, 0x1F, 0xF1,
+    0x0A, 0xF8, 0x0E, 0xFA, 0x8F, 0xF8, 0x06, 0xFF, 0xCA, 0xF8, 0x00, 0x12,
+    0x00, 0x00, 0x79, 0x30, 0x05, 0x95, 0x6F, 0xA0, 0x0D, 0xF3, 0x1E, 0xE1,
+    0x3F, 0xD0, 0x09, 0xF6, 0x8F, 0x70, 0x03, 0xFB, 0xEF, 0x10, 0x00, 0xCF,
+    0xFA, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x59, 0x50, 0x49, 0x50, 0x49, 0x64,
+    0xFB, 0x09, 0xFA, 0x09, 0xF6, 0x1F, 0xE0, 0xDE, 0xE0, 0xDF, 0x20, 0xCF,
+    0x4F, 0x8F, 0x5F, 0xD0, 0x08, 0xFC, 0xF1, 0xEC, 0xF9, 0x00, 0x4F, 0xFC,
+    0x0B, 0xFF, 0x50, 0x00, 0xEF, 0x80, 0x7F, 0xF1, 0x00, 0x59, 0x60, 0x09,
+    0x92, 0x1D, 0xF4, 0x8F, 0xA0, 0x03, 0xFE, 0xFD, 0x10, 0x00, 0x8F, 0xF4,
+    0x00, 0x01, 0xDF, 0xFB, 0x00, 0x0B, 0xF7, 0xBF, 0x70, 0x7F, 0xB0, 0x1E,
+    0xF3, 0x79, 0x30, 0x05, 0x95, 0x6F, 0xA0, 0x0D, 0xF3, 0x1E, 0xF1, 0x3F,
+    0xC0, 0x08, 0xF7, 0x8F, 0x60, 0x02, 0xFD, 0xDF, 0x10, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x09, 0xDF, 0x60,
+    0x00, 0x07, 0x95, 0x00, 0x00, 0x39, 0x99, 0x99, 0x44, 0xDD, 0xDF, 0xF6,
+    0x00, 0x08, 0xFC, 0x10, 0x08, 0xFC, 0x10, 0x07, 0xFD, 0x10, 0x05, 0xFF,
+    0x98, 0x83, 0x7F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x22, 0x00, 0x03, 0xEF,
+    0xF1, 0x00, 0x9F, 0x94, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0xAF, 0x50, 0x02,
+    0x5E, 0xF3, 0x00, 0x8F, 0xFA, 0x00, 0x01, 0x3E, 0xF3, 0x00, 0x00, 0xAF,
+    0x50, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x9F, 0xB6, 0x00, 0x02, 0xBE, 0xF1,
+    0x12, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D,
+    0x6B, 0x12, 0x10, 0x00, 0x08, 0xFF, 0xA0, 0x00, 0x24, 0xEF, 0x20, 0x00,
+    0x0C, 0xF3, 0x00, 0x00, 0xCF, 0x40, 0x00, 0x09, 0xFA, 0x40, 0x00, 0x3E,
+    0xFF, 0x10, 0x0A, 0xF9, 0x20, 0x00, 0xCF, 0x40, 0x00, 0x0C, 0xF3, 0x00,
+    0x36, 0xEF, 0x20, 0x08, 0xFD, 0x70, 0x00, 0x2A, 0xDA, 0x51, 0x38, 0xBB,
+    0x8B, 0xFF, 0xF8, 0x20, 0x00, 0x25, 0x20,
+};
+constexpr AaGlyph SANS_BOLD_12_GLYPHS[] = {
+    {0, 0, 0, 0, 0, 4}, // space
+    {0, 3, 9, 1, 1, 5}, // '!'
+    {14, 5, 4, 1, 1, 6}, // '"'
+    {24, 10, 9, 0, 1, 10}, // '#'
+    {69, 8, 12, 0, 0, 8}, // '$'
+    {117, 12, 10, 0, 1, 12}, // '%'
+    {177, 10, 10, 0, 1, 10}, // '&'
+    {227, 2, 4, 1, 1, 4}, // '''
+    {231, 4, 12, 1, 0, 5}, // '('
+    {255, 4, 12, 1, 0, 5}, // ')'
+    {279, 6, 6, 0, 1, 6}, // '*'
+    {297, 8, 8, 1, 2, 10}, // '+'
+    {329, 4, 5, 0, 7, 5}, // ','
+    {339, 5, 3, 0, 5, 5}, // '-'
+    {347, 3, 3, 1, 7, 5}, // '.'
+    {352, 5, 11, 0, 1, 4}, // '/'
+    {380, 8, 10, 0, 1, 8}, // '0'
+    {420, 7, 9, 1, 1, 8}, // '1'
+    {452, 8, 9, 0, 1, 8}, // '2'
+    {488, 8, 10, 0, 1, 8}, // '3'
+    {528, 8, 9, 0, 1, 8}, // '4'
+    {564, 8, 10, 0, 1, 8}, // '5'
+    {604, 8, 10, 0, 1, 8}, // '6'
+    {644, 8, 9, 0, 1, 8}, // '7'
+    {680, 8, 10, 0, 1, 8}, // '8'
+    {720, 8, 10, 0, 1, 8}, // '9'
+    {760, 3, 7, 1, 3, 5}, // ':'
+    {771, 4, 9, 0, 3, 5}, // ';'
+    {789, 8, 8, 1, 2, 10}, // '<'
+    {821, 8, 5, 1, 4, 10}, // '='
+    {841, 8, 8, 1, 2, 10}, // '>'
+    {873, 7, 9, 0, 1, 7}, // '?'
+    {905, 12, 12, 0, 1, 12}, // '@'
+    {977, 10, 9, 0, 1, 9}, // 'A'
+    {1022, 8, 9, 1, 1, 9}, // 'B'
+    {1058, 9, 10, 0, 1, 9}, // 'C'
+    {1103, 9, 9, 1, 1, 10}, // 'D'
+    {1144, 7, 9, 1, 1, 8}, // 'E'
+    {1176, 7, 9, 1, 1, 8}, // 'F'
+    {1208, 9, 10, 0, 1, 10}, // 'G'
+    {1253, 8, 9, 1, 1, 10}, // 'H'
+    {1289, 3, 9, 1, 1, 4}, // 'I'
+    {1303, 5, 12, -1, 1, 4}, // 'J'
+    {1333, 9, 9, 1, 1, 9}, // 'K'
+    {1374, 7, 9, 1, 1, 8}, // 'L'
+    {1406, 10, 9, 1, 1, 12}, // 'M'
+    {1451, 8, 9, 1, 1, 10}, // 'N'
+    {1487, 10, 10, 0, 1, 10}, // 'O'
+    {1537, 8, 9, 1, 1, 9}, // 'P'
+    {1573, 10, 11, 0, 1, 10}, // 'Q'
+    {1628, 8, 9, 1, 1, 9}, // 'R'
+    {1664, 8, 10, 0, 1, 9}, // 'S'
+    {1704, 9, 9, 0, 1, 8}, // 'T'
+    {1745, 8, 10, 1, 1, 10}, // 'U'
+    {1785, 10, 9, 0, 1, 9}, // 'V'
+    {1830, 13, 9, 0, 1, 13}, // 'W'
+    {1889, 9, 9, 0, 1, 9}, // 'X'
+    {1930, 9, 9, 0, 1, 9}, // 'Y'
+    {1971, 9, 9, 0, 1, 9}, // 'Z'
+    {2012, 4, 12, 1, 0, 5}, // '['
+    {2036, 5, 11, 0, 1, 4}, // '\'
+    {2064, 5, 12, 0, 0, 5}, // ']'
+    {2094, 8, 4, 1, 1, 10}, // '^'
+    {2110, 6, 2, 0, 11, 6}, // '_'
+    {2116, 4, 3, 0, 0, 6}, // '`'
+    {2122, 8, 8, 0, 3, 8}, // 'a'
+    {2154, 8, 11, 1, 0, 9}, // 'b'
+    {2198, 7, 8, 0, 3, 7}, // 'c'
+    {2226, 8, 11, 0, 0, 9}, // 'd'
+    {2270, 8, 8, 0, 3, 8}, // 'e'
+    {2302, 6, 10, 0, 0, 5}, // 'f'
+    {2332, 8, 10, 0, 3, 9}, // 'g'
+    {2372, 7, 10, 1, 0, 9}, // 'h'
+    {2407, 3, 10, 1, 0, 4}, // 'i'
+    {2422, 5, 13, -1, 0, 4}, // 'j'
+    {2455, 7, 10, 1, 0, 8}, // 'k'
+    {2490, 3, 10, 1, 0, 4}, // 'l'
+    {2505, 11, 7, 1, 3, 13}, // 'm'
+    {2544, 7, 7, 1, 3, 9}, // 'n'
+    {2569, 8, 8, 0, 3, 8}, // 'o'
+    {2601, 8, 10, 1, 3, 9}, // 'p'
+    {2641, 8, 10, 0, 3, 9}, // 'q'
+    {2681, 5, 7, 1, 3, 6}, // 'r'
+    {2699, 7, 8, 0, 3, 7}, // 's'
+    {2727, 6, 9, 0, 1, 6}, // 't'
+    {2754, 8, 8, 0, 3, 9}, // 'u'
+    {2786, 8, 7, 0, 3, 8}, // 'v'
+    {2814, 11, 7, 0, 3, 11}, // 'w'
+    {2853, 8, 7, 0, 3, 8}, // 'x'
+    {2881, 8, 10, 0, 3, 8}, // 'y'
+    {2921, 7, 7, 0, 3, 7}, // 'z'
+    {2946, 7, 12, 1, 0, 9}, // '{'
+    {2988, 2, 13, 1, 0, 4}, // '|'
+    {3001, 7, 12, 1, 0, 9}, // '}'
+    {3043, 8, 3, 1, 5, 10}, // '~'
+};
+constexpr AaKern SANS_BOLD_12_KERNS[] = {
+    {'-', 'T', -2}, {'-', 'V', -1}, {'-', 'W', -1}, {'-', 'X', -1},
+    {'-', 'Y', -2}, {'A', 'T', -1}, {'A', 'V', -1}, {'A', 'W', -1},
+    {'A', 'Y', -1}, {'B', 'W', -1}, {'B', 'Y', -1}, {'D', 'Y', -1},
+    {'F', ',', -2}, {'F', '.', -2}, {'F', ':', -1}, {'F', ';', -1},
+    {'F', 'A', -1}, {'F', 'a', -1}, {'F', 'r', -1}, {'F', 'u', -1},
+    {'F', 'y', -1}, {'K', '-', -1}, {'K', 'C', -1}, {'K', 'O', -1},
+    {'K', 'y', -1}, {'L', 'T', -2}, {'L', 'V', -2}, {'L', 'W', -1},
+    {'L', 'Y', -2}, {'L', 'y', -1}, {'P', ',', -2}, {'P', '.', -2},
+    {'P', 'A', -1}, {'R', 'T', -1}, {'R', 'Y', -1}, {'R', 'y', -1},
+    {'S', 'S', -1}, {'T', ',', -2}, {'T', '-', -2}, {'T', '.', -2},
+    {'T', ':', -1}, {'T', ';', -1}, {'T', 'A', -1}, {'T', 'a', -2},
+    {'T', 'c', -2}, {'T', 'e', -2}, {'T', 'o', -2}, {'T', 'r', -1},
+    {'T', 's', -2}, {'T', 'u', -1}, {'T', 'w', -1}, {'T', 'y', -1},
+    {'V', ',', -2}, {'V', '-', -1}, {'V', '.', -2}, {'V', ':', -1},
+    {'V', ';', -1}, {'V', 'A', -1}, {'V', 'a', -1}, {'V', 'e', -1},
+    {'V', 'o', -1}, {'W', ',', -1}, {'W', '-', -1}, {'W', '.', -1},
+    {'W', 'A', -1}, {'X', '-', -1}, {'Y', ',', -2}, {'Y', '-', -2},
+    {'Y', '.', -2}, {'Y', ':', -1}, {'Y', ';', -1}, {'Y', 'A', -1},
+    {'Y', 'a', -1}, {'Y', 'e', -1}, {'Y', 'o', -1}, {'Y', 'u', -1},
+    {'f', ',', -1}, {'f', '.', -1}, {'r', ',', -2}, {'r', '.', -2},
+    {'v', ',', -1}, {'v', '.', -1}, {'w', ',', -1}, {'w', '.', -1},
+    {'y', ',', -1}, {'y', '.', -1},
+};
+constexpr AaFont SANS_BOLD_12 = {SANS_BOLD_12_BITMAP, SANS_BOLD_12_GLYPHS,
+                                 SANS_BOLD_12_KERNS, 86, 32, 126, 13, 10};
+
+// 19 px, 95 glyphs, 21 px line: 7163 bitmap bytes, 8268 in all
+constexpr uint8_t SANS_BOLD_19_BITMAP[] = {
+    0x4D, 0xDD, 0x5F, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF,
+    0x3F, 0xFD, 0x1F, 0xFB, 0x0E, 0xF9, 0x05, 0x63, 0x14, 0x44, 0x5F, 0xFF,
+    0x5F, 0xFF, 0x5F, 0xFF, 0x3D, 0xD0, 0x1D, 0xD1, 0x3F, 0xF0, 0x2F, 0xF1,
+    0x3F, 0xF0, 0x2F, 0xF1, 0x3F, 0xF0, 0x2F, 0xF1, 0x3F, 0xF0, 0x2F, 0xF1,
+    0x14, 0x40, 0x04, 0x40, 0x00, 0x00, 0x07, 0x93, 0x02, 0x98, 0x00, 0x00,
+    0x00, 0x0D, 0xF3, 0x06, 0xFA, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x09, 0xF6,
+    0x00, 0x01, 0x22, 0x7F, 0xB2, 0x2D, 0xF4, 0x21, 0x0A, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF9, 0x08, 0xDD, 0xFF, 0xDD, 0xEF, 0xED, 0xD8, 0x00, 0x03,
+    0xFD, 0x00, 0xAF, 0x60, 0x00, 0x00, 0x06, 0xFA, 0x00, 0xEF, 0x30, 0x00,
+    0x58, 0x8C, 0xFB, 0x88, 0xFF, 0x88, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x58, 0x9F, 0xE8, 0x8D, 0xFA, 0x88, 0x40, 0x00, 0x6F, 0xA0,
+    0x0D, 0xF3, 0x00, 0x00, 0x00, 0xAF, 0x60, 0x2F, 0xE0, 0x00, 0x00, 0x00,
+    0xDF, 0x30, 0x6F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x16, 0x20, 0x00, 0x00,
+    0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x02, 0x5F, 0x83, 0x10, 0x00, 0x3C,
+    0xFF, 0xFF, 0xFF, 0xD1, 0x1E, 0xFF, 0xEF, 0xDE, 0xFF, 0x16, 0xFF, 0x92,
+    0xF6, 0x02, 0x71, 0x8F, 0xF9, 0x2F, 0x60, 0x00, 0x05, 0xFF, 0xFD, 0xFA,
+    0x51, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x05, 0xBE, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x2F, 0x9A, 0xFF, 0xD1, 0x00, 0x02, 0xF6, 0x1F, 0xFE,
+    0x7D, 0x74, 0x4F, 0x77, 0xFF, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x27,
+    0xBD, 0xFF, 0xFD, 0x92, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0x60, 0x00, 0x00, 0x00, 0x01, 0xB4, 0x00, 0x00, 0x00, 0x01, 0x20,
+    0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x2B, 0xFF, 0xE7, 0x00, 0x00,
+    0x08, 0xF8, 0x00, 0x00, 0x0C, 0xFC, 0x8E, 0xF7, 0x00, 0x02, 0xFD, 0x10,
+    0x00, 0x04, 0xFF, 0x10, 0x7F, 0xD0, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x6F,
+    0xE0, 0x05, 0xFF, 0x00, 0x5F, 0xB0, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x6F,
+    0xE0, 0x1D, 0xF2, 0x00, 0x00, 0x00, 0x1E, 0xF8, 0x2C, 0xFA, 0x08, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFC, 0x13, 0xFD, 0x00, 0x24, 0x30,
+    0x00, 0x00, 0x15, 0x64, 0x00, 0xBF, 0x40, 0xAF, 0xFF, 0xD4, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xA0, 0x8F, 0xD5, 0xAF, 0xE1, 0x00, 0x00, 0x00, 0x1E,
+    0xE2, 0x0D, 0xF7, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x08, 0xF7, 0x00, 0xFF,
+    0x50, 0x0E, 0xF6, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0D, 0xF7, 0x01, 0xFF,
+    0x50, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x8F, 0xE6, 0xAF, 0xE1, 0x00, 0x00,
+    0x6F, 0xA0, 0x00, 0x00, 0xAF, 0xFF, 0xD3, 0x00, 0x00, 0x03, 0x41, 0x00,
+    0x00, 0x00, 0x24, 0x30, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4C, 0xFF, 0xFE, 0xB2, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+    0xFF, 0x30, 0x00, 0x00, 0x0A, 0xFF, 0xC3, 0x25, 0xA3, 0x00, 0x00, 0x00,
+    0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE2, 0x00, 0x03, 0x44, 0x00, 0x8F, 0xFF,
+    0xFF, 0xD1, 0x00, 0xCF, 0xF1, 0x5F, 0xFE, 0x5E, 0xFF, 0xC1, 0x1F, 0xFD,
+    0x0B, 0xFF, 0x70, 0x3E, 0xFF, 0xB8, 0xFF, 0x80, 0xDF, 0xF6, 0x00, 0x4F,
+    0xFF, 0xFF, 0xF2, 0x0C, 0xFF, 0xA0, 0x00, 0x6F, 0xFF, 0xF7, 0x00, 0x7F,
+    0xFF, 0x93, 0x27, 0xFF, 0xFF, 0x70, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x60, 0x01, 0x8E, 0xFF, 0xFF, 0xB4, 0x9F, 0xFF, 0x50, 0x00, 0x03,
+    0x43, 0x10, 0x00, 0x00, 0x00, 0x3D, 0xD3, 0xFF, 0x3F, 0xF3, 0xFF, 0x3F,
+    0xF1, 0x44, 0x00, 0x04, 0x66, 0x00, 0x2F, 0xFA, 0x00, 0xAF, 0xF4, 0x02,
+    0xFF, 0xD0, 0x08, 0xFF, 0x70, 0x0D, 0xFF, 0x30, 0x1F, 0xFF, 0x00, 0x4F,
+    0xFD, 0x00, 0x5F, 0xFC, 0x00, 0x5F, 0xFC, 0x00, 0x4F, 0xFD, 0x00, 0x2F,
+    0xFF, 0x00, 0x0D, 0xFF, 0x30, 0x08, 0xFF, 0x70, 0x03, 0xFF, 0xC0, 0x00,
+    0xBF, 0xF3, 0x00, 0x3F, 0xFA, 0x00, 0x06, 0x87, 0x26, 0x62, 0x00, 0x01,
+    0xEF, 0xC0, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xCF,
+    0xF3, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x5F, 0xFC, 0x00, 0x03, 0xFF, 0xE0,
+    0x00, 0x2F, 0xFF, 0x00, 0x02, 0xFF, 0xF1, 0x00, 0x3F, 0xFE, 0x00, 0x05,
+    0xFF, 0xC0, 0x00, 0x8F, 0xF8, 0x00, 0x0C, 0xFF, 0x40, 0x02, 0xFF, 0xD0,
+    0x00, 0x8F, 0xF6, 0x00, 0x1E, 0xFD, 0x00, 0x03, 0x88, 0x30, 0x00, 0x00,
+    0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x15, 0x00, 0xCB,
+    0x00, 0x60, 0x6F, 0xC4, 0xCB, 0x5D, 0xF5, 0x04, 0xCF, 0xFF, 0xFC, 0x40,
+    0x00, 0x3D, 0xFF, 0xD2, 0x00, 0x2A, 0xFD, 0xEE, 0xDF, 0x92, 0x5E, 0x70,
+    0xCB, 0x17, 0xE4, 0x01, 0x00, 0xCB, 0x00, 0x10, 0x00, 0x00, 0x99, 0x00,
+    0x00, 0x00, 0x00, 0x2D, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x22, 0x22, 0x4F, 0xF3, 0x22,
+    0x22, 0x00, 0x00, 0x2F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00,
+    0x00, 0x19, 0x99, 0x31, 0xFF, 0xF4, 0x1F, 0xFF, 0x42, 0xFF, 0xE2, 0x6F,
+    0xF7, 0x0A, 0xFC, 0x00, 0xAB, 0x20, 0x00, 0xDD, 0xDD, 0xDB, 0xFF, 0xFF,
+    0xFD, 0xDD, 0xDD, 0xDB, 0x19, 0x99, 0x31, 0xFF, 0xF4, 0x1F, 0xFF, 0x41,
+    0xFF, 0xF4, 0x00, 0x00, 0x3D, 0xB0, 0x00, 0x08, 0xF8, 0x00, 0x00, 0xDF,
+    0x30, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xF9, 0x00, 0x00, 0xCF, 0x40, 0x00,
+    0x2F, 0xE0, 0x00, 0x06, 0xFA, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x1F, 0xE1,
+    0x00, 0x05, 0xFA, 0x00, 0x00, 0xAF, 0x60, 0x00, 0x0E, 0xF1, 0x00, 0x04,
+    0xFB, 0x00, 0x00, 0x9F, 0x70, 0x00, 0x0A, 0xB2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFC, 0x60, 0x00, 0x00,
+    0x5F, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x2E, 0xFF, 0xB6, 0x9F, 0xFF, 0x50,
+    0x08, 0xFF, 0xE1, 0x00, 0xBF, 0xFB, 0x00, 0xCF, 0xFA, 0x00, 0x07, 0xFF,
+    0xF1, 0x0F, 0xFF, 0x80, 0x00, 0x5F, 0xFF, 0x31, 0xFF, 0xF7, 0x00, 0x04,
+    0xFF, 0xF4, 0x1F, 0xFF, 0x70, 0x00, 0x4F, 0xFF, 0x40, 0xFF, 0xF8, 0x00,
+    0x05, 0xFF, 0xF4, 0x0D, 0xFF, 0xA0, 0x00, 0x6F, 0xFF, 0x10, 0x9F, 0xFD,
+    0x00, 0x0A, 0xFF, 0xC0, 0x03, 0xFF, 0xF9, 0x36, 0xFF, 0xF6, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x06, 0xEF, 0xFF, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x34, 0x30, 0x00, 0x00, 0x47, 0xAD, 0xDD, 0xA0, 0x00, 0xDF,
+    0xFF, 0xFF, 0xB0, 0x00, 0xDE, 0xBD, 0xFF, 0xB0, 0x00, 0x20, 0x09, 0xFF,
+    0xB0, 0x00, 0x00, 0x09, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xB0, 0x00,
+    0x00, 0x09, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xB0, 0x00, 0x00, 0x09,
+    0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xB0,
+    0x00, 0x68, 0x8C, 0xFF, 0xD8, 0x87, 0xCF, 0xFF, 0xFF, 0xFF, 0xFE, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x12, 0x00, 0x00, 0x02, 0x9C, 0xFF,
+    0xFF, 0xC6, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF9, 0x07, 0xFB, 0x76, 0x8E,
+    0xFF, 0xF3, 0x43, 0x00, 0x00, 0x5F, 0xFF, 0x70, 0x00, 0x00, 0x02, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x30, 0x00, 0x00, 0x2E, 0xFF, 0xA0,
+    0x00, 0x00, 0x3E, 0xFF, 0xB1, 0x00, 0x00, 0x4E, 0xFF, 0xB1, 0x00, 0x00,
+    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x8F, 0xFF, 0x70, 0x00, 0x00, 0x6F, 0xFF,
+    0xD9, 0x99, 0x99, 0x57, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x22, 0x00, 0x00, 0x01, 0xAD, 0xFF, 0xFF,
+    0xD7, 0x10, 0x2F, 0xFF, 0xFF, 0xFF, 0xFB, 0x02, 0xD8, 0x66, 0x7E, 0xFF,
+    0xF4, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x60, 0x00, 0x00, 0x04, 0xFF, 0xF3,
+    0x00, 0x14, 0x47, 0xDF, 0xFA, 0x00, 0x05, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x5F, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x0E, 0xFF, 0xA0, 0x00, 0x00, 0x01, 0xEF, 0xFA, 0xBA, 0x53, 0x25,
+    0xBF, 0xFF, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x8E, 0xFF, 0xFF, 0xFE,
+    0x81, 0x00, 0x02, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xDD,
+    0x50, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0x60, 0x00, 0x00, 0x0C, 0xFB, 0xFF, 0xF6, 0x00, 0x00, 0x08, 0xFE,
+    0x2F, 0xFF, 0x60, 0x00, 0x03, 0xFF, 0x60, 0xFF, 0xF6, 0x00, 0x00, 0xCF,
+    0xA0, 0x0F, 0xFF, 0x60, 0x00, 0x8F, 0xE1, 0x00, 0xFF, 0xF6, 0x00, 0x2F,
+    0xF7, 0x22, 0x2F, 0xFF, 0x72, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0x88, 0x88, 0x88, 0xFF, 0xFA,
+    0x83, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xF6, 0x00, 0x0D, 0xDD, 0xDD, 0xDD, 0xDC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xD0, 0x0F, 0xFE, 0xBB, 0xBB, 0xBA, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0x0F, 0xFD, 0x34, 0x41, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFA, 0x20, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0xB6, 0x32, 0x4B, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xAF, 0xFD, 0x30, 0x00, 0x00,
+    0x0D, 0xFF, 0xC8, 0xE8, 0x42, 0x4B, 0xFF, 0xF7, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x14, 0xBE, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x02, 0x44, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x05, 0xCF, 0xFF, 0xEB,
+    0x20, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0x40, 0x08, 0xFF, 0xF9, 0x44, 0x6B,
+    0x40, 0x2F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x01, 0x21, 0x00,
+    0x00, 0xAF, 0xFC, 0xBF, 0xFF, 0xC3, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x40, 0xCF, 0xFF, 0xB3, 0x4D, 0xFF, 0xD0, 0xBF, 0xFF, 0x20, 0x06, 0xFF,
+    0xF2, 0x9F, 0xFF, 0x00, 0x04, 0xFF, 0xF3, 0x5F, 0xFF, 0x10, 0x05, 0xFF,
+    0xF1, 0x1E, 0xFF, 0x90, 0x1C, 0xFF, 0xB0, 0x04, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x30, 0x00, 0x4C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x24, 0x41, 0x00,
+    0x00, 0xAD, 0xDD, 0xDD, 0xDD, 0xDD, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+    0x8B, 0xBB, 0xBB, 0xCF, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0xF2, 0x00,
+    0x00, 0x00, 0xDF, 0xFA, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x30, 0x00, 0x00,
+    0x0B, 0xFF, 0xB0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xAF,
+    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x50, 0x00, 0x00, 0x09, 0xFF, 0xD0,
+    0x00, 0x00, 0x01, 0xEF, 0xF7, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x10, 0x00,
+    0x00, 0x0E, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00,
+    0x19, 0xDF, 0xFF, 0xEA, 0x20, 0x1D, 0xFF, 0xFF, 0xFF, 0xFE, 0x26, 0xFF,
+    0xF7, 0x25, 0xFF, 0xF9, 0x8F, 0xFD, 0x00, 0x0A, 0xFF, 0xB6, 0xFF, 0xE0,
+    0x00, 0xBF, 0xF9, 0x0C, 0xFF, 0xB7, 0xAF, 0xFE, 0x20, 0x0A, 0xFF, 0xFF,
+    0xFC, 0x10, 0x0A, 0xFF, 0xFC, 0xEF, 0xFC, 0x17, 0xFF, 0xD2, 0x01, 0xBF,
+    0xFA, 0xCF, 0xF9, 0x00, 0x06, 0xFF, 0xFC, 0xFF, 0x90, 0x00, 0x6F, 0xFF,
+    0x9F, 0xFE, 0x40, 0x2D, 0xFF, 0xD3, 0xEF, 0xFF, 0xFF, 0xFF, 0xF5, 0x03,
+    0xBF, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x13, 0x44, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xFE, 0xB3, 0x00, 0x0B, 0xFF, 0xFF,
+    0xFF, 0xF5, 0x07, 0xFF, 0xE5, 0x39, 0xFF, 0xE1, 0xDF, 0xF9, 0x00, 0x0E,
+    0xFF, 0x7F, 0xFF, 0x70, 0x00, 0xCF, 0xFB, 0xFF, 0xF8, 0x00, 0x0E, 0xFF,
+    0xEB, 0xFF, 0xD2, 0x06, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x4D, 0xFF, 0xFE, 0xCF, 0xFD, 0x00, 0x03, 0x54, 0x19, 0xFF, 0xA0, 0x00,
+    0x00, 0x01, 0xEF, 0xF6, 0x19, 0x42, 0x25, 0xDF, 0xFD, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x20, 0x1D, 0xFF, 0xFF, 0xFA, 0x20, 0x00, 0x01, 0x44, 0x31,
+    0x00, 0x00, 0x56, 0x63, 0xDF, 0xF7, 0xDF, 0xF7, 0xDF, 0xF7, 0x34, 0x42,
+    0x00, 0x00, 0x00, 0x00, 0x89, 0x94, 0xDF, 0xF7, 0xDF, 0xF7, 0xDF, 0xF7,
+    0x05, 0x66, 0x30, 0xDF, 0xF7, 0x0D, 0xFF, 0x70, 0xDF, 0xF7, 0x03, 0x44,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x94, 0x0D, 0xFF, 0x70, 0xDF,
+    0xF7, 0x0E, 0xFF, 0x43, 0xFF, 0xA0, 0x7F, 0xE1, 0x08, 0xB4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x27, 0xDE, 0x00,
+    0x00, 0x01, 0x6B, 0xFF, 0xFE, 0x00, 0x05, 0xAF, 0xFF, 0xFC, 0x72, 0x39,
+    0xEF, 0xFF, 0xD7, 0x20, 0x00, 0xFF, 0xFD, 0x83, 0x00, 0x00, 0x00, 0xFF,
+    0xFB, 0x61, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xFF, 0xB6, 0x10, 0x00, 0x00,
+    0x16, 0xBF, 0xFF, 0xFB, 0x61, 0x00, 0x00, 0x02, 0x7D, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x38, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x71, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xB5, 0x10, 0x00, 0x00, 0x27, 0xCF, 0xFF, 0xEA, 0x40, 0x00, 0x00,
+    0x03, 0x8D, 0xFF, 0xFE, 0x83, 0x00, 0x00, 0x00, 0x38, 0xDF, 0xFE, 0x00,
+    0x00, 0x00, 0x27, 0xCF, 0xFE, 0x00, 0x01, 0x6B, 0xFF, 0xFE, 0xA4, 0x16,
+    0xBF, 0xFF, 0xFB, 0x61, 0x00, 0xFF, 0xFF, 0xC7, 0x20, 0x00, 0x00, 0xFD,
+    0x83, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x20, 0x00, 0x05, 0xBE, 0xFF, 0xFB, 0x40, 0xAF, 0xFF, 0xFF, 0xFF,
+    0x3A, 0xD8, 0x67, 0xEF, 0xFA, 0x40, 0x00, 0x09, 0xFF, 0xC0, 0x00, 0x00,
+    0xCF, 0xFA, 0x00, 0x00, 0x9F, 0xFF, 0x30, 0x00, 0xAF, 0xFF, 0x60, 0x00,
+    0x6F, 0xFF, 0x50, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0x46, 0x63, 0x00,
+    0x00, 0x03, 0x44, 0x20, 0x00, 0x00, 0xCF, 0xF9, 0x00, 0x00, 0x0C, 0xFF,
+    0x90, 0x00, 0x00, 0xCF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x65,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xE8, 0x10, 0x00,
+    0x00, 0x0A, 0xFF, 0xB7, 0x66, 0x9E, 0xFD, 0x30, 0x00, 0x0B, 0xFB, 0x20,
+    0x00, 0x00, 0x07, 0xFE, 0x20, 0x07, 0xFA, 0x00, 0x01, 0x20, 0x00, 0x06,
+    0xFB, 0x01, 0xEE, 0x10, 0x1B, 0xFF, 0xC9, 0xF7, 0x0A, 0xF3, 0x6F, 0x70,
+    0x0B, 0xFD, 0x9D, 0xFF, 0x70, 0x4F, 0x89, 0xF2, 0x03, 0xFE, 0x10, 0x1E,
+    0xF7, 0x02, 0xFA, 0xBF, 0x00, 0x6F, 0xB0, 0x00, 0xBF, 0x70, 0x2F, 0x9B,
+    0xF0, 0x06, 0xFB, 0x00, 0x0B, 0xF7, 0x05, 0xF7, 0x9F, 0x20, 0x3F, 0xE1,
+    0x01, 0xEF, 0x71, 0xCF, 0x26, 0xF7, 0x00, 0xCF, 0xD8, 0xDF, 0xFC, 0xDF,
+    0x70, 0x1E, 0xE1, 0x01, 0xBF, 0xFD, 0x9F, 0xFC, 0x50, 0x00, 0x7F, 0xB0,
+    0x00, 0x12, 0x02, 0x31, 0x00, 0x00, 0x00, 0xAF, 0xC3, 0x00, 0x00, 0x02,
+    0xB5, 0x00, 0x00, 0x00, 0x9F, 0xFB, 0x88, 0x8B, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x4B, 0xFF, 0xFF, 0xFC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34,
+    0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xDD, 0xD8, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xDF, 0xFB, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0xE4, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x0E, 0xFF, 0x70,
+    0x00, 0x00, 0x2F, 0xFF, 0x40, 0x9F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xE0,
+    0x04, 0xFF, 0xF3, 0x00, 0x00, 0xDF, 0xFA, 0x22, 0x2E, 0xFF, 0x90, 0x00,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF5, 0x01, 0xEF, 0xFB, 0x88, 0x88, 0x8D, 0xFF, 0xA0, 0x5F, 0xFF,
+    0x30, 0x00, 0x00, 0x7F, 0xFF, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF,
+    0xF6, 0x3D, 0xDD, 0xDD, 0xDC, 0xA5, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x00, 0x4F, 0xFF, 0xB9, 0x9D, 0xFF, 0xF6, 0x04, 0xFF, 0xF5, 0x00,
+    0x2F, 0xFF, 0x80, 0x4F, 0xFF, 0x50, 0x01, 0xFF, 0xF8, 0x04, 0xFF, 0xFA,
+    0x88, 0xCF, 0xFE, 0x20, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x4F, 0xFF, 0x50, 0x02, 0xCF, 0xFD, 0x04,
+    0xFF, 0xF5, 0x00, 0x07, 0xFF, 0xF2, 0x4F, 0xFF, 0x50, 0x00, 0x9F, 0xFF,
+    0x24, 0xFF, 0xF9, 0x66, 0x9F, 0xFF, 0xD0, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF5, 0x04, 0xFF, 0xFF, 0xFF, 0xFD, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x21, 0x00, 0x00, 0x00, 0x04, 0xAE, 0xFF, 0xFD, 0x93, 0x00, 0x09, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x09, 0xFF, 0xFE, 0xA8, 0x8B, 0xFB, 0x04, 0xFF,
+    0xFD, 0x20, 0x00, 0x02, 0x60, 0xAF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x0E,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xB1, 0x00,
+    0x00, 0x04, 0x00, 0xBF, 0xFF, 0xD7, 0x66, 0x9E, 0xB0, 0x01, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00,
+    0x01, 0x34, 0x31, 0x00, 0x3D, 0xDD, 0xDD, 0xCB, 0x84, 0x00, 0x00, 0x4F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x4F, 0xFF, 0xED, 0xEF, 0xFF, 0xFE,
+    0x40, 0x4F, 0xFF, 0x50, 0x02, 0x9F, 0xFF, 0xD1, 0x4F, 0xFF, 0x50, 0x00,
+    0x09, 0xFF, 0xF6, 0x4F, 0xFF, 0x50, 0x00, 0x02, 0xFF, 0xFA, 0x4F, 0xFF,
+    0x50, 0x00, 0x00, 0xEF, 0xFB, 0x4F, 0xFF, 0x50, 0x00, 0x00, 0xEF, 0xFB,
+    0x4F, 0xFF, 0x50, 0x00, 0x01, 0xFF, 0xFA, 0x4F, 0xFF, 0x50, 0x00, 0x08,
+    0xFF, 0xF6, 0x4F, 0xFF, 0x50, 0x00, 0x7F, 0xFF, 0xE1, 0x4F, 0xFF, 0xCB,
+    0xBE, 0xFF, 0xFF, 0x50, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x00, 0x4F,
+    0xFF, 0xFF, 0xED, 0xB7, 0x10, 0x00, 0x3D, 0xDD, 0xDD, 0xDD, 0xDD, 0x54,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x4F, 0xFF, 0xED, 0xDD, 0xDD, 0x54, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x50, 0x00, 0x00, 0x04, 0xFF, 0xFB,
+    0x99, 0x99, 0x90, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x4F, 0xFF, 0x62, 0x22, 0x22, 0x04, 0xFF, 0xF5, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0x50, 0x00, 0x00, 0x04, 0xFF, 0xFC, 0xBB, 0xBB, 0xB7,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x3D,
+    0xDD, 0xDD, 0xDD, 0xDD, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x4F, 0xFF,
+    0xED, 0xDD, 0xDD, 0x54, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x50,
+    0x00, 0x00, 0x04, 0xFF, 0xFB, 0x99, 0x99, 0x90, 0x4F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x4F, 0xFF, 0x62, 0x22, 0x22,
+    0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x50, 0x00, 0x00, 0x04,
+    0xFF, 0xF5, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x50, 0x00, 0x00, 0x04, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x9D, 0xFF, 0xFF, 0xC8, 0x20, 0x00, 0x09, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFA, 0x00, 0x09, 0xFF, 0xFF, 0xB8, 0x89, 0xDF, 0xA0, 0x04, 0xFF,
+    0xFD, 0x20, 0x00, 0x00, 0x36, 0x00, 0xAF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0x00,
+    0x04, 0xBB, 0xBB, 0xB2, 0x1F, 0xFF, 0xA0, 0x00, 0x6F, 0xFF, 0xFF, 0x30,
+    0xEF, 0xFC, 0x00, 0x04, 0xBC, 0xFF, 0xF3, 0x0B, 0xFF, 0xF2, 0x00, 0x00,
+    0x3F, 0xFF, 0x30, 0x5F, 0xFF, 0xB1, 0x00, 0x03, 0xFF, 0xF3, 0x00, 0xBF,
+    0xFF, 0xD8, 0x66, 0x9F, 0xFF, 0x30, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF3, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFE, 0xA4, 0x00, 0x00, 0x00, 0x01,
+    0x34, 0x42, 0x00, 0x00, 0x3D, 0xDD, 0x40, 0x00, 0x05, 0xDD, 0xD2, 0x4F,
+    0xFF, 0x50, 0x00, 0x06, 0xFF, 0xF2, 0x4F, 0xFF, 0x50, 0x00, 0x06, 0xFF,
+    0xF2, 0x4F, 0xFF, 0x50, 0x00, 0x06, 0xFF, 0xF2, 0x4F, 0xFF, 0x50, 0x00,
+    0x06, 0xFF, 0xF2, 0x4F, 0xFF, 0xB9, 0x99, 0x9C, 0xFF, 0xF2, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2,
+    0x4F, 0xFF, 0x62, 0x22, 0x27, 0xFF, 0xF2, 0x4F, 0xFF, 0x50, 0x00, 0x06,
+    0xFF, 0xF2, 0x4F, 0xFF, 0x50, 0x00, 0x06, 0xFF, 0xF2, 0x4F, 0xFF, 0x50,
+    0x00, 0x06, 0xFF, 0xF2, 0x4F, 0xFF, 0x50, 0x00, 0x06, 0xFF, 0xF2, 0x4F,
+    0xFF, 0x50, 0x00, 0x06, 0xFF, 0xF2, 0x3D, 0xDD, 0x44, 0xFF, 0xF5, 0x4F,
+    0xFF, 0x54, 0xFF, 0xF5, 0x4F, 0xFF, 0x54, 0xFF, 0xF5, 0x4F, 0xFF, 0x54,
+    0xFF, 0xF5, 0x4F, 0xFF, 0x54, 0xFF, 0xF5, 0x4F, 0xFF, 0x54, 0xFF, 0xF5,
+    0x4F, 0xFF, 0x54, 0xFF, 0xF5, 0x00, 0x03, 0xDD, 0xD4, 0x00, 0x04, 0xFF,
+    0xF5, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x04, 0xFF,
+    0xF5, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x04, 0xFF,
+    0xF5, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x04, 0xFF,
+    0xF5, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x05, 0xFF,
+    0xF4, 0x00, 0x2C, 0xFF, 0xF1, 0x1D, 0xFF, 0xFF, 0xA0, 0x1F, 0xFF, 0xFC,
+    0x10, 0x1B, 0xB9, 0x50, 0x00, 0x3D, 0xDD, 0x40, 0x00, 0x1B, 0xDD, 0xD3,
+    0x04, 0xFF, 0xF5, 0x00, 0x1C, 0xFF, 0xE4, 0x00, 0x4F, 0xFF, 0x50, 0x1D,
+    0xFF, 0xE4, 0x00, 0x04, 0xFF, 0xF5, 0x2D, 0xFF, 0xE4, 0x00, 0x00, 0x4F,
+    0xFF, 0x6D, 0xFF, 0xE4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xE3, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xDF, 0xFF, 0xB0, 0x00, 0x00,
+    0x04, 0xFF, 0xF5, 0xAF, 0xFF, 0xB1, 0x00, 0x00, 0x4F, 0xFF, 0x50, 0xAF,
+    0xFF, 0xB1, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0xAF, 0xFF, 0xB1, 0x00, 0x4F,
+    0xFF, 0x50, 0x00, 0xAF, 0xFF, 0xB1, 0x04, 0xFF, 0xF5, 0x00, 0x00, 0xAF,
+    0xFF, 0xB1, 0x3D, 0xDD, 0x40, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0x50, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0x50, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0x50, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0x50, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x50,
+    0x00, 0x00, 0x04, 0xFF, 0xFC, 0xBB, 0xBB, 0xB7, 0x4F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x3D, 0xDD, 0xD6, 0x00, 0x00,
+    0x07, 0xDD, 0xDD, 0x24, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xEF, 0xFF, 0xF2,
+    0x4F, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xFF, 0x24, 0xFF, 0xFF, 0xFB,
+    0x00, 0x0C, 0xFF, 0xFF, 0xF2, 0x4F, 0xFF, 0xBF, 0xF2, 0x04, 0xFF, 0xBF,
+    0xFF, 0x24, 0xFF, 0xF5, 0xFF, 0x90, 0xAF, 0xF5, 0xFF, 0xF2, 0x4F, 0xFF,
+    0x2B, 0xFE, 0x2F, 0xFA, 0x3F, 0xFF, 0x24, 0xFF, 0xF2, 0x5F, 0xFD, 0xFF,
+    0x33, 0xFF, 0xF2, 0x4F, 0xFF, 0x20, 0xDF, 0xFF, 0xC0, 0x3F, 0xFF, 0x24,
+    0xFF, 0xF2, 0x07, 0xFF, 0xF6, 0x03, 0xFF, 0xF2, 0x4F, 0xFF, 0x20, 0x1E,
+    0xFE, 0x00, 0x3F, 0xFF, 0x24, 0xFF, 0xF2, 0x00, 0x46, 0x40, 0x03, 0xFF,
+    0xF2, 0x4F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x24, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xF2, 0x3D, 0xDD, 0xC0, 0x00, 0x03, 0xDD,
+    0xD2, 0x4F, 0xFF, 0xF7, 0x00, 0x03, 0xFF, 0xF2, 0x4F, 0xFF, 0xFE, 0x10,
+    0x03, 0xFF, 0xF2, 0x4F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xF2, 0x4F, 0xFF,
+    0xEF, 0xE1, 0x03, 0xFF, 0xF2, 0x4F, 0xFF, 0x7F, 0xF9, 0x03, 0xFF, 0xF2,
+    0x4F, 0xFF, 0x2C, 0xFF, 0x23, 0xFF, 0xF2, 0x4F, 0xFF, 0x24, 0xFF, 0x93,
+    0xFF, 0xF2, 0x4F, 0xFF, 0x20, 0xBF, 0xF6, 0xFF, 0xF2, 0x4F, 0xFF, 0x20,
+    0x3F, 0xFD, 0xFF, 0xF2, 0x4F, 0xFF, 0x20, 0x0A, 0xFF, 0xFF, 0xF2, 0x4F,
+    0xFF, 0x20, 0x03, 0xFF, 0xFF, 0xF2, 0x4F, 0xFF, 0x20, 0x00, 0x9F, 0xFF,
+    0xF2, 0x4F, 0xFF, 0x20, 0x00, 0x2F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x02,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xEF, 0xFF, 0xC6, 0x00, 0x00,
+    0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0xBF, 0xFF, 0xD8,
+    0x8C, 0xFF, 0xFD, 0x10, 0x05, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0x70,
+    0x0B, 0xFF, 0xF2, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x0E, 0xFF, 0xC0, 0x00,
+    0x00, 0x0A, 0xFF, 0xF1, 0x0F, 0xFF, 0xA0, 0x00, 0x00, 0x08, 0xFF, 0xF3,
+    0x1F, 0xFF, 0xA0, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x0E, 0xFF, 0xB0, 0x00,
+    0x00, 0x09, 0xFF, 0xF1, 0x0B, 0xFF, 0xF1, 0x00, 0x00, 0x0D, 0xFF, 0xD0,
+    0x06, 0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xCF, 0xFF, 0xB6,
+    0x6A, 0xFF, 0xFE, 0x10, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00,
+    0x00, 0x01, 0x8E, 0xFF, 0xFF, 0xE9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0x42, 0x00, 0x00, 0x00, 0x3D, 0xDD, 0xDD, 0xDC, 0xA6, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x4F, 0xFF, 0xCB, 0xBE, 0xFF, 0xFA, 0x04,
+    0xFF, 0xF5, 0x00, 0x1D, 0xFF, 0xF1, 0x4F, 0xFF, 0x50, 0x00, 0x8F, 0xFF,
+    0x24, 0xFF, 0xF5, 0x00, 0x0B, 0xFF, 0xF1, 0x4F, 0xFF, 0x96, 0x6A, 0xFF,
+    0xFC, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x4F, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x30, 0x04, 0xFF, 0xF7, 0x44, 0x21, 0x00, 0x00, 0x4F, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xEF, 0xFF,
+    0xC7, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00,
+    0xBF, 0xFF, 0xD8, 0x8C, 0xFF, 0xFD, 0x10, 0x05, 0xFF, 0xFB, 0x00, 0x00,
+    0x9F, 0xFF, 0x70, 0x0B, 0xFF, 0xF2, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x0E,
+    0xFF, 0xC0, 0x00, 0x00, 0x0A, 0xFF, 0xF1, 0x0F, 0xFF, 0xA0, 0x00, 0x00,
+    0x08, 0xFF, 0xF3, 0x1F, 0xFF, 0xA0, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x0E,
+    0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xF1, 0x0B, 0xFF, 0xE1, 0x00, 0x00,
+    0x0D, 0xFF, 0xD0, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
+    0xCF, 0xFF, 0xA6, 0x6A, 0xFF, 0xFD, 0x10, 0x00, 0x2D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xD3, 0x00, 0x00, 0x01, 0x7D, 0xFF, 0xFF, 0xFB, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x6F, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xB9, 0x00, 0x3D,
+    0xDD, 0xDD, 0xDC, 0x95, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0x4F, 0xFF, 0xCB, 0xCF, 0xFF, 0xF4, 0x00, 0x4F, 0xFF, 0x50, 0x05,
+    0xFF, 0xF7, 0x00, 0x4F, 0xFF, 0x50, 0x01, 0xFF, 0xF7, 0x00, 0x4F, 0xFF,
+    0x50, 0x05, 0xFF, 0xF3, 0x00, 0x4F, 0xFF, 0xCB, 0xCF, 0xFF, 0x80, 0x00,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x4F, 0xFF, 0xCB, 0xEF, 0xFF,
+    0x50, 0x00, 0x4F, 0xFF, 0x50, 0x1D, 0xFF, 0xE1, 0x00, 0x4F, 0xFF, 0x50,
+    0x04, 0xFF, 0xF8, 0x00, 0x4F, 0xFF, 0x50, 0x00, 0xCF, 0xFE, 0x10, 0x4F,
+    0xFF, 0x50, 0x00, 0x4F, 0xFF, 0x80, 0x4F, 0xFF, 0x50, 0x00, 0x0C, 0xFF,
+    0xE1, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF, 0xC9,
+    0x30, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x5F, 0xFF, 0xB8, 0x89, 0xDF,
+    0x60, 0x9F, 0xFB, 0x00, 0x00, 0x02, 0x20, 0x9F, 0xFC, 0x10, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xEA, 0x74, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xE8,
+    0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x01, 0x47, 0xBF, 0xFF,
+    0xF2, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF4, 0x54, 0x00, 0x00, 0x03, 0xFF,
+    0xF4, 0x8F, 0xD8, 0x66, 0x7D, 0xFF, 0xF1, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x39, 0xDF, 0xFF, 0xFF, 0xD7, 0x00, 0x00, 0x01, 0x34, 0x42, 0x00,
+    0x00, 0xCD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFD, 0xCD, 0xDD, 0xEF, 0xFF, 0xED, 0xDD, 0xB0, 0x00, 0x05, 0xFF,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x05, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x05, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xF4, 0x00, 0x00, 0x3D, 0xDD, 0x40, 0x00,
+    0x0C, 0xDD, 0x94, 0xFF, 0xF5, 0x00, 0x00, 0xDF, 0xFA, 0x4F, 0xFF, 0x50,
+    0x00, 0x0D, 0xFF, 0xA4, 0xFF, 0xF5, 0x00, 0x00, 0xDF, 0xFA, 0x4F, 0xFF,
+    0x50, 0x00, 0x0D, 0xFF, 0xA4, 0xFF, 0xF5, 0x00, 0x00, 0xDF, 0xFA, 0x4F,
+    0xFF, 0x50, 0x00, 0x0D, 0xFF, 0xA4, 0xFF, 0xF5, 0x00, 0x00, 0xDF, 0xFA,
+    0x4F, 0xFF, 0x50, 0x00, 0x0D, 0xFF, 0xA3, 0xFF, 0xF6, 0x00, 0x00, 0xEF,
+    0xF9, 0x1F, 0xFF, 0xA0, 0x00, 0x4F, 0xFF, 0x70, 0xAF, 0xFF, 0x96, 0x7E,
+    0xFF, 0xF2, 0x02, 0xEF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x02, 0xAF, 0xFF,
+    0xFF, 0xD5, 0x00, 0x00, 0x00, 0x13, 0x44, 0x20, 0x00, 0x00, 0xAD, 0xDB,
+    0x00, 0x00, 0x00, 0x2D, 0xDD, 0x66, 0xFF, 0xF3, 0x00, 0x00, 0x07, 0xFF,
+    0xF2, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xCF, 0xFB, 0x00, 0xAF, 0xFD, 0x00,
+    0x00, 0x3F, 0xFF, 0x60, 0x04, 0xFF, 0xF4, 0x00, 0x08, 0xFF, 0xE1, 0x00,
+    0x0E, 0xFF, 0x90, 0x00, 0xDF, 0xF9, 0x00, 0x00, 0x8F, 0xFE, 0x00, 0x4F,
+    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xF5, 0x09, 0xFF, 0xD0, 0x00, 0x00, 0x0C,
+    0xFF, 0xA0, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x6F, 0xFF, 0x20,
+    0x00, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xFF, 0xA0, 0x00, 0x00, 0x4D, 0xDD, 0x10, 0x00, 0x4D,
+    0xDD, 0x40, 0x00, 0x2D, 0xDD, 0x32, 0xFF, 0xF5, 0x00, 0x08, 0xFF, 0xF8,
+    0x00, 0x05, 0xFF, 0xF1, 0x0D, 0xFF, 0x80, 0x00, 0xCF, 0xFF, 0xB0, 0x00,
+    0x9F, 0xFC, 0x00, 0xAF, 0xFC, 0x00, 0x1F, 0xFE, 0xFE, 0x00, 0x0C, 0xFF,
+    0x90, 0x06, 0xFF, 0xF1, 0x04, 0xFF, 0x8F, 0xF3, 0x01, 0xFF, 0xF5, 0x00,
+    0x2F, 0xFF, 0x40, 0x8F, 0xE1, 0xFF, 0x70, 0x5F, 0xFF, 0x20, 0x00, 0xEF,
+    0xF7, 0x0B, 0xFB, 0x0C, 0xFA, 0x08, 0xFF, 0xD0, 0x00, 0x0A, 0xFF, 0xB0,
+    0xEF, 0x80, 0x9F, 0xE0, 0xCF, 0xF9, 0x00, 0x00, 0x7F, 0xFE, 0x3F, 0xF4,
+    0x05, 0xFF, 0x3F, 0xFF, 0x60, 0x00, 0x03, 0xFF, 0xFA, 0xFF, 0x10, 0x1F,
+    0xFA, 0xFF, 0xF2, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xC0, 0x00, 0xDF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x09, 0xFF, 0xFF, 0xA0,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x50, 0x00, 0x6F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF1, 0x00, 0x02, 0xFF, 0xFF, 0x30, 0x00, 0x2D, 0xDD,
+    0x70, 0x00, 0x01, 0xCD, 0xDA, 0x00, 0x8F, 0xFF, 0x30, 0x00, 0x9F, 0xFF,
+    0x30, 0x00, 0xCF, 0xFD, 0x00, 0x4F, 0xFF, 0x70, 0x00, 0x03, 0xFF, 0xF8,
+    0x1D, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFB, 0xFF, 0xE2, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01,
+    0xDF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xAF, 0xFF, 0x30,
+    0x00, 0x00, 0x4F, 0xFF, 0x70, 0xCF, 0xFD, 0x10, 0x00, 0x1D, 0xFF, 0xC0,
+    0x03, 0xFF, 0xF9, 0x00, 0x09, 0xFF, 0xE2, 0x00, 0x07, 0xFF, 0xF4, 0x04,
+    0xFF, 0xF7, 0x00, 0x00, 0x0C, 0xFF, 0xD1, 0xCD, 0xDC, 0x10, 0x00, 0x03,
+    0xDD, 0xD9, 0x4F, 0xFF, 0x90, 0x00, 0x0C, 0xFF, 0xE2, 0x0A, 0xFF, 0xF3,
+    0x00, 0x7F, 0xFF, 0x60, 0x01, 0xEF, 0xFD, 0x02, 0xFF, 0xFB, 0x00, 0x00,
+    0x5F, 0xFF, 0x8B, 0xFF, 0xE2, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0x60,
+    0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0xE2, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xA0, 0x00, 0x00, 0x0C, 0xDD, 0xDD,
+    0xDD, 0xDD, 0xDD, 0x90, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x0C, 0xDD,
+    0xDD, 0xDD, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x2E, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xE2, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF6, 0x00,
+    0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x02, 0xEF, 0xFD, 0x10, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xDB,
+    0xBB, 0xBB, 0xBA, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x26, 0x66, 0x66, 0x26, 0xFF, 0xFF, 0xF6, 0x6F,
+    0xFE, 0x99, 0x46, 0xFF, 0xC0, 0x00, 0x6F, 0xFC, 0x00, 0x06, 0xFF, 0xC0,
+    0x00, 0x6F, 0xFC, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x6F, 0xFC, 0x00, 0x06,
+    0xFF, 0xC0, 0x00, 0x6F, 0xFC, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x6F, 0xFC,
+    0x00, 0x06, 0xFF, 0xC0, 0x00, 0x6F, 0xFC, 0x00, 0x06, 0xFF, 0xE9, 0x94,
+    0x6F, 0xFF, 0xFF, 0x63, 0x88, 0x88, 0x83, 0xBD, 0x20, 0x00, 0x09, 0xF7,
+    0x00, 0x00, 0x4F, 0xC0, 0x00, 0x00, 0xEF, 0x20, 0x00, 0x0A, 0xF6, 0x00,
+    0x00, 0x5F, 0xB0, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x0B, 0xF5, 0x00, 0x00,
+    0x6F, 0xA0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x7F,
+    0x90, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x8F, 0x80,
+    0x00, 0x03, 0xB9, 0x46, 0x66, 0x66, 0x0B, 0xFF, 0xFF, 0xF1, 0x79, 0xAF,
+    0xFF, 0x10, 0x02, 0xFF, 0xF1, 0x00, 0x2F, 0xFF, 0x10, 0x02, 0xFF, 0xF1,
+    0x00, 0x2F, 0xFF, 0x10, 0x02, 0xFF, 0xF1, 0x00, 0x2F, 0xFF, 0x10, 0x02,
+    0xFF, 0xF1, 0x00, 0x2F, 0xFF, 0x10, 0x02, 0xFF, 0xF1, 0x00, 0x2F, 0xFF,
+    0x10, 0x02, 0xFF, 0xF1, 0x00, 0x2F, 0xFF, 0x17, 0x9A, 0xFF, 0xF1, 0xBF,
+    0xFF, 0xFF, 0x15, 0x88, 0x88, 0x80, 0x00, 0x00, 0x8D, 0xD6, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x6F, 0xFC, 0xDF, 0xF5, 0x00,
+    0x05, 0xFF, 0x91, 0x1A, 0xFF, 0x40, 0x5F, 0xE5, 0x00, 0x00, 0x6E, 0xF4,
+    0x56, 0x20, 0x00, 0x00, 0x02, 0x65, 0x44, 0x44, 0x44, 0x44, 0x42, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x84, 0x44, 0x20, 0x07,
+    0xFE, 0x20, 0x07, 0xFB, 0x00, 0x07, 0xF8, 0x00, 0x03, 0x40, 0x01, 0x47,
+    0x99, 0x98, 0x50, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0x04, 0xFC,
+    0x99, 0xAE, 0xFF, 0xC0, 0x01, 0x10, 0x00, 0x03, 0xFF, 0xF2, 0x00, 0x16,
+    0x99, 0x99, 0xFF, 0xF5, 0x04, 0xEF, 0xFF, 0xFF, 0xFF, 0xF5, 0x0E, 0xFF,
+    0xC6, 0x66, 0xFF, 0xF5, 0x2F, 0xFF, 0x30, 0x02, 0xFF, 0xF5, 0x2F, 0xFF,
+    0x70, 0x1B, 0xFF, 0xF5, 0x0C, 0xFF, 0xFF, 0xFD, 0xFF, 0xF5, 0x02, 0xCF,
+    0xFF, 0xC2, 0xFF, 0xF5, 0x00, 0x03, 0x42, 0x00, 0x00, 0x00, 0x26, 0x65,
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE,
+    0x03, 0x89, 0x71, 0x00, 0x6F, 0xFE, 0x8F, 0xFF, 0xFE, 0x30, 0x6F, 0xFF,
+    0xFD, 0xCF, 0xFF, 0xD1, 0x6F, 0xFF, 0x90, 0x05, 0xFF, 0xF6, 0x6F, 0xFF,
+    0x10, 0x00, 0xDF, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0xAF, 0xFB, 0x6F, 0xFE,
+    0x00, 0x00, 0xBF, 0xFB, 0x6F, 0xFF, 0x30, 0x00, 0xEF, 0xF8, 0x6F, 0xFF,
+    0xC4, 0x3A, 0xFF, 0xF4, 0x6F, 0xFE, 0xEF, 0xFF, 0xFF, 0xA0, 0x6F, 0xFE,
+    0x3D, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x34, 0x20, 0x00, 0x00, 0x00,
+    0x58, 0x99, 0x73, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xCB,
+    0xEF, 0x0B, 0xFF, 0xE3, 0x00, 0x05, 0x1F, 0xFF, 0x70, 0x00, 0x00, 0x3F,
+    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0x50, 0x00, 0x00, 0x0E, 0xFF, 0xA0,
+    0x00, 0x00, 0x09, 0xFF, 0xF9, 0x32, 0x4B, 0x01, 0xCF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x18, 0xEF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0x44, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x26, 0x66, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x00, 0x04,
+    0x99, 0x71, 0x5F, 0xFF, 0x00, 0x8F, 0xFF, 0xFE, 0x8F, 0xFF, 0x05, 0xFF,
+    0xFE, 0xBE, 0xFF, 0xFF, 0x0C, 0xFF, 0xD1, 0x01, 0xDF, 0xFF, 0x1F, 0xFF,
+    0x70, 0x00, 0x7F, 0xFF, 0x2F, 0xFF, 0x50, 0x00, 0x5F, 0xFF, 0x2F, 0xFF,
+    0x50, 0x00, 0x6F, 0xFF, 0x0E, 0xFF, 0x90, 0x00, 0x9F, 0xFF, 0x0A, 0xFF,
+    0xF6, 0x26, 0xFF, 0xFF, 0x02, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x00, 0x3D,
+    0xFF, 0xF9, 0x5F, 0xFF, 0x00, 0x00, 0x34, 0x10, 0x00, 0x00, 0x00, 0x01,
+    0x69, 0x99, 0x50, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFD, 0x30, 0x04, 0xFF,
+    0xFC, 0x9C, 0xFF, 0xE2, 0x0C, 0xFF, 0xA0, 0x00, 0xBF, 0xF8, 0x1F, 0xFF,
+    0x96, 0x66, 0xAF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF,
+    0xCB, 0xBB, 0xBB, 0xBB, 0x0E, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x09, 0xFF,
+    0xE4, 0x00, 0x15, 0xB7, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x19,
+    0xEF, 0xFF, 0xFE, 0xA3, 0x00, 0x00, 0x03, 0x44, 0x20, 0x00, 0x00, 0x01,
+    0x56, 0x66, 0x20, 0x03, 0xEF, 0xFF, 0xF6, 0x00, 0xBF, 0xFE, 0xBB, 0x50,
+    0x0E, 0xFF, 0x60, 0x00, 0x46, 0xFF, 0xF9, 0x66, 0x1A, 0xFF, 0xFF, 0xFF,
+    0xF3, 0xAF, 0xFF, 0xFF, 0xFF, 0x30, 0x0F, 0xFF, 0x50, 0x00, 0x00, 0xFF,
+    0xF5, 0x00, 0x00, 0x0F, 0xFF, 0x50, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x00,
+    0x0F, 0xFF, 0x50, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x00, 0x0F, 0xFF, 0x50,
+    0x00, 0x00, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x03, 0x89, 0x71, 0x26, 0x66,
+    0x00, 0x8F, 0xFF, 0xFE, 0x8F, 0xFF, 0x05, 0xFF, 0xFE, 0xBE, 0xFF, 0xFF,
+    0x0C, 0xFF, 0xD1, 0x01, 0xDF, 0xFF, 0x1F, 0xFF, 0x70, 0x00, 0x7F, 0xFF,
+    0x2F, 0xFF, 0x50, 0x00, 0x5F, 0xFF, 0x1F, 0xFF, 0x50, 0x00, 0x6F, 0xFF,
+    0x0E, 0xFF, 0xA0, 0x00, 0xBF, 0xFF, 0x08, 0xFF, 0xFA, 0x6A, 0xFF, 0xFF,
+    0x01, 0xCF, 0xFF, 0xFF, 0xBF, 0xFF, 0x00, 0x19, 0xEF, 0xC5, 0x6F, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFC, 0x00, 0xB7, 0x32, 0x38, 0xFF, 0xF6,
+    0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x8D, 0xFF, 0xFF, 0xB5, 0x00,
+    0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x26, 0x65, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x03, 0x89, 0x82, 0x00,
+    0x6F, 0xFE, 0x7F, 0xFF, 0xFE, 0x30, 0x6F, 0xFF, 0xFE, 0xEF, 0xFF, 0xA0,
+    0x6F, 0xFF, 0xA0, 0x0A, 0xFF, 0xE0, 0x6F, 0xFF, 0x20, 0x05, 0xFF, 0xF1,
+    0x6F, 0xFE, 0x00, 0x05, 0xFF, 0xF1, 0x6F, 0xFE, 0x00, 0x04, 0xFF, 0xF1,
+    0x6F, 0xFE, 0x00, 0x04, 0xFF, 0xF1, 0x6F, 0xFE, 0x00, 0x04, 0xFF, 0xF1,
+    0x6F, 0xFE, 0x00, 0x04, 0xFF, 0xF1, 0x6F, 0xFE, 0x00, 0x04, 0xFF, 0xF1,
+    0x26, 0x65, 0x6F, 0xFE, 0x6F, 0xFE, 0x24, 0x43, 0x26, 0x65, 0x6F, 0xFE,
+    0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE,
+    0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x00, 0x26, 0x65, 0x00, 0x6F, 0xFE,
+    0x00, 0x6F, 0xFE, 0x00, 0x24, 0x43, 0x00, 0x26, 0x65, 0x00, 0x6F, 0xFE,
+    0x00, 0x6F, 0xFE, 0x00, 0x6F, 0xFE, 0x00, 0x6F, 0xFE, 0x00, 0x6F, 0xFE,
+    0x00, 0x6F, 0xFE, 0x00, 0x6F, 0xFE, 0x00, 0x6F, 0xFE, 0x00, 0x6F, 0xFE,
+    0x00, 0x6F, 0xFE, 0x00, 0x7F, 0xFD, 0x12, 0xCF, 0xFA, 0x9F, 0xFF, 0xF4,
+    0x9F, 0xFD, 0x50, 0x12, 0x10, 0x00, 0x26, 0x65, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x03, 0x66, 0x62,
+    0x6F, 0xFE, 0x00, 0x3E, 0xFF, 0xA0, 0x6F, 0xFE, 0x03, 0xEF, 0xF9, 0x00,
+    0x6F, 0xFE, 0x3E, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0xEF, 0xF7, 0x00, 0x00,
+    0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+    0x6F, 0xFE, 0x5F, 0xFF, 0x90, 0x00, 0x6F, 0xFE, 0x06, 0xFF, 0xF8, 0x00,
+    0x6F, 0xFE, 0x00, 0x6F, 0xFF, 0x80, 0x6F, 0xFE, 0x00, 0x07, 0xFF, 0xF8,
+    0x26, 0x65, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE,
+    0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE,
+    0x6F, 0xFE, 0x6F, 0xFE, 0x6F, 0xFE, 0x26, 0x65, 0x04, 0x99, 0x50, 0x01,
+    0x79, 0x83, 0x00, 0x6F, 0xFE, 0x8F, 0xFF, 0xFA, 0x3E, 0xFF, 0xFF, 0x50,
+    0x6F, 0xFF, 0xFE, 0xEF, 0xFF, 0xEF, 0xDF, 0xFF, 0xE0, 0x6F, 0xFF, 0x90,
+    0x1E, 0xFF, 0xF4, 0x05, 0xFF, 0xF3, 0x6F, 0xFF, 0x10, 0x0C, 0xFF, 0xC0,
+    0x01, 0xFF, 0xF4, 0x6F, 0xFE, 0x00, 0x0B, 0xFF, 0x90, 0x01, 0xFF, 0xF4,
+    0x6F, 0xFE, 0x00, 0x0B, 0xFF, 0x90, 0x01, 0xFF, 0xF4, 0x6F, 0xFE, 0x00,
+    0x0B, 0xFF, 0x90, 0x01, 0xFF, 0xF4, 0x6F, 0xFE, 0x00, 0x0B, 0xFF, 0x90,
+    0x01, 0xFF, 0xF4, 0x6F, 0xFE, 0x00, 0x0B, 0xFF, 0x90, 0x01, 0xFF, 0xF4,
+    0x6F, 0xFE, 0x00, 0x0B, 0xFF, 0x90, 0x01, 0xFF, 0xF4, 0x26, 0x65, 0x03,
+    0x89, 0x82, 0x00, 0x6F, 0xFE, 0x7F, 0xFF, 0xFE, 0x30, 0x6F, 0xFF, 0xFE,
+    0xEF, 0xFF, 0xA0, 0x6F, 0xFF, 0xA0, 0x0A, 0xFF, 0xE0, 0x6F, 0xFF, 0x20,
+    0x05, 0xFF, 0xF1, 0x6F, 0xFE, 0x00, 0x05, 0xFF, 0xF1, 0x6F, 0xFE, 0x00,
+    0x04, 0xFF, 0xF1, 0x6F, 0xFE, 0x00, 0x04, 0xFF, 0xF1, 0x6F, 0xFE, 0x00,
+    0x04, 0xFF, 0xF1, 0x6F, 0xFE, 0x00, 0x04, 0xFF, 0xF1, 0x6F, 0xFE, 0x00,
+    0x04, 0xFF, 0xF1, 0x00, 0x01, 0x69, 0x99, 0x61, 0x00, 0x00, 0x05, 0xEF,
+    0xFF, 0xFF, 0xE6, 0x00, 0x04, 0xFF, 0xFE, 0xBE, 0xFF, 0xF5, 0x00, 0xCF,
+    0xFD, 0x10, 0x1C, 0xFF, 0xC0, 0x1F, 0xFF, 0x70, 0x00, 0x6F, 0xFF, 0x23,
+    0xFF, 0xF4, 0x00, 0x04, 0xFF, 0xF3, 0x2F, 0xFF, 0x50, 0x00, 0x4F, 0xFF,
+    0x30, 0xEF, 0xF8, 0x00, 0x08, 0xFF, 0xF1, 0x09, 0xFF, 0xF6, 0x25, 0xEF,
+    0xFA, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x19, 0xFF, 0xFF,
+    0xFA, 0x20, 0x00, 0x00, 0x01, 0x34, 0x31, 0x00, 0x00, 0x26, 0x65, 0x03,
+    0x89, 0x71, 0x00, 0x6F, 0xFE, 0x8F, 0xFF, 0xFE, 0x30, 0x6F, 0xFF, 0xFD,
+    0xCF, 0xFF, 0xD1, 0x6F, 0xFF, 0x90, 0x05, 0xFF, 0xF6, 0x6F, 0xFF, 0x10,
+    0x00, 0xDF, 0xFA, 0x6F, 0xFE, 0x00, 0x00, 0xAF, 0xFB, 0x6F, 0xFE, 0x00,
+    0x00, 0xBF, 0xFB, 0x6F, 0xFF, 0x30, 0x00, 0xEF, 0xF8, 0x6F, 0xFF, 0xC4,
+    0x3A, 0xFF, 0xF4, 0x6F, 0xFE, 0xEF, 0xFF, 0xFF, 0xA0, 0x6F, 0xFE, 0x3D,
+    0xFF, 0xFA, 0x10, 0x6F, 0xFE, 0x00, 0x34, 0x20, 0x00, 0x6F, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x89, 0x71, 0x26, 0x66, 0x00, 0x8F, 0xFF,
+    0xFE, 0x8F, 0xFF, 0x05, 0xFF, 0xFE, 0xBE, 0xFF, 0xFF, 0x0C, 0xFF, 0xD1,
+    0x01, 0xDF, 0xFF, 0x1F, 0xFF, 0x70, 0x00, 0x7F, 0xFF, 0x2F, 0xFF, 0x50,
+    0x00, 0x5F, 0xFF, 0x2F, 0xFF, 0x50, 0x00, 0x6F, 0xFF, 0x0E, 0xFF, 0x90,
+    0x00, 0x9F, 0xFF, 0x0A, 0xFF, 0xF6, 0x26, 0xFF, 0xFF, 0x02, 0xEF, 0xFF,
+    0xFF, 0xDF, 0xFF, 0x00, 0x3D, 0xFF, 0xF9, 0x5F, 0xFF, 0x00, 0x00, 0x34,
+    0x10, 0x5F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x26, 0x65, 0x03,
+    0x89, 0x36, 0xFF, 0xE7, 0xFF, 0xF5, 0x6F, 0xFF, 0xFF, 0xFF, 0x56, 0xFF,
+    0xFD, 0x40, 0x32, 0x6F, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00,
+    0x6F, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFE, 0x00,
+    0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x01,
+    0x69, 0x99, 0x75, 0x20, 0x4E, 0xFF, 0xFF, 0xFF, 0xB0, 0xDF, 0xFC, 0x99,
+    0xBF, 0xB0, 0xFF, 0xE0, 0x00, 0x01, 0x30, 0xEF, 0xFC, 0x86, 0x30, 0x00,
+    0x7F, 0xFF, 0xFF, 0xFE, 0x60, 0x04, 0xAD, 0xFF, 0xFF, 0xF2, 0x00, 0x00,
+    0x03, 0xDF, 0xF6, 0x96, 0x20, 0x02, 0xDF, 0xF5, 0xDF, 0xFF, 0xFF, 0xFF,
+    0xE1, 0x9E, 0xFF, 0xFF, 0xFC, 0x30, 0x00, 0x24, 0x44, 0x10, 0x00, 0x01,
+    0x66, 0x61, 0x00, 0x00, 0x1F, 0xFF, 0x30, 0x00, 0x01, 0xFF, 0xF3, 0x00,
+    0x04, 0x7F, 0xFF, 0x86, 0x64, 0xBF, 0xFF, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF,
+    0xFF, 0xFA, 0x01, 0xFF, 0xF3, 0x00, 0x00, 0x1F, 0xFF, 0x30, 0x00, 0x01,
+    0xFF, 0xF3, 0x00, 0x00, 0x1F, 0xFF, 0x30, 0x00, 0x01, 0xFF, 0xF4, 0x00,
+    0x00, 0x0F, 0xFF, 0xB6, 0x62, 0x00, 0xBF, 0xFF, 0xFF, 0x50, 0x01, 0xAE,
+    0xFF, 0xF5, 0x36, 0x65, 0x00, 0x02, 0x66, 0x58, 0xFF, 0xC0, 0x00, 0x6F,
+    0xFE, 0x8F, 0xFC, 0x00, 0x06, 0xFF, 0xE8, 0xFF, 0xC0, 0x00, 0x6F, 0xFE,
+    0x8F, 0xFC, 0x00, 0x06, 0xFF, 0xE8, 0xFF, 0xC0, 0x00, 0x6F, 0xFE, 0x8F,
+    0xFC, 0x00, 0x07, 0xFF, 0xE7, 0xFF, 0xE0, 0x00, 0xBF, 0xFE, 0x5F, 0xFF,
+    0x84, 0x9F, 0xFF, 0xE1, 0xEF, 0xFF, 0xFF, 0xDF, 0xFE, 0x04, 0xEF, 0xFF,
+    0x86, 0xFF, 0xE0, 0x00, 0x34, 0x10, 0x00, 0x00, 0x46, 0x64, 0x00, 0x00,
+    0x26, 0x66, 0x5F, 0xFE, 0x00, 0x00, 0x8F, 0xFB, 0x1E, 0xFF, 0x40, 0x00,
+    0xDF, 0xF5, 0x09, 0xFF, 0xA0, 0x04, 0xFF, 0xE1, 0x03, 0xFF, 0xE1, 0x09,
+    0xFF, 0x90, 0x00, 0xCF, 0xF6, 0x1E, 0xFF, 0x30, 0x00, 0x6F, 0xFB, 0x5F,
+    0xFC, 0x00, 0x00, 0x1E, 0xFF, 0xCF, 0xF6, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+    0xE1, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0x30, 0x00, 0x26, 0x65, 0x00, 0x04, 0x66, 0x10, 0x02, 0x66, 0x51, 0xFF,
+    0xF2, 0x00, 0xCF, 0xF6, 0x00, 0x8F, 0xFA, 0x0D, 0xFF, 0x50, 0x1F, 0xFF,
+    0x90, 0x0C, 0xFF, 0x60, 0x9F, 0xF9, 0x05, 0xFF, 0xFD, 0x01, 0xFF, 0xF2,
+    0x05, 0xFF, 0xD0, 0x8F, 0xAF, 0xF2, 0x4F, 0xFD, 0x00, 0x1F, 0xFF, 0x1C,
+    0xF6, 0xCF, 0x68, 0xFF, 0x90, 0x00, 0xCF, 0xF6, 0xFF, 0x29, 0xF9, 0xCF,
+    0xF5, 0x00, 0x08, 0xFF, 0xDF, 0xD0, 0x5F, 0xDF, 0xFF, 0x10, 0x00, 0x4F,
+    0xFF, 0xFA, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x0D,
+    0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF2, 0x00, 0x9F, 0xFF, 0x40, 0x00,
+    0x26, 0x66, 0x10, 0x00, 0x56, 0x64, 0x1C, 0xFF, 0x90, 0x05, 0xFF, 0xE2,
+    0x03, 0xEF, 0xF4, 0x2E, 0xFF, 0x60, 0x00, 0x6F, 0xFE, 0xCF, 0xFA, 0x00,
+    0x00, 0x0A, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0x40, 0x00,
+    0x00, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x2E, 0xFF, 0xEF, 0xF6, 0x00,
+    0x01, 0xCF, 0xF8, 0x5F, 0xFE, 0x20, 0x09, 0xFF, 0xC0, 0x09, 0xFF, 0xC1,
+    0x5F, 0xFF, 0x30, 0x01, 0xDF, 0xF9, 0x46, 0x64, 0x00, 0x00, 0x26, 0x65,
+    0x6F, 0xFD, 0x00, 0x00, 0x9F, 0xFA, 0x1E, 0xFF, 0x50, 0x00, 0xEF, 0xF5,
+    0x08, 0xFF, 0xA0, 0x04, 0xFF, 0xE0, 0x02, 0xFF, 0xF2, 0x09, 0xFF, 0x80,
+    0x00, 0xAF, 0xF7, 0x0E, 0xFF, 0x20, 0x00, 0x4F, 0xFD, 0x4F, 0xFC, 0x00,
+    0x00, 0x0C, 0xFF, 0xDF, 0xF6, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE1, 0x00,
+    0x00, 0x00, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x22, 0xAF, 0xF7, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x20, 0x00, 0x00,
+    0x00, 0x22, 0x10, 0x00, 0x00, 0x00, 0x05, 0x66, 0x66, 0x66, 0x66, 0x10,
+    0xEF, 0xFF, 0xFF, 0xFF, 0xF2, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x3E, 0xFF, 0x90, 0x00, 0x00, 0x3E, 0xFF, 0x90, 0x00, 0x00, 0x3E,
+    0xFF, 0xA0, 0x00, 0x00, 0x2E, 0xFF, 0xA0, 0x00, 0x00, 0x2D, 0xFF, 0xB0,
+    0x00, 0x00, 0x1D, 0xFF, 0xE6, 0x66, 0x66, 0x12, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF2, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x04, 0x66, 0x61,
+    0x00, 0x01, 0xCF, 0xFF, 0xF2, 0x00, 0x08, 0xFF, 0xFB, 0x91, 0x00, 0x0B,
+    0xFF, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0x60, 0x00, 0x00, 0x0B, 0xFF, 0x60,
+    0x00, 0x00, 0x0C, 0xFF, 0x60, 0x00, 0x00, 0x2E, 0xFF, 0x50, 0x00, 0x6A,
+    0xEF, 0xFD, 0x10, 0x00, 0x9F, 0xFF, 0xE4, 0x00, 0x00, 0x47, 0xCF, 0xFF,
+    0x20, 0x00, 0x00, 0x0E, 0xFF, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0x60, 0x00,
+    0x00, 0x0B, 0xFF, 0x60, 0x00, 0x00, 0x0B, 0xFF, 0x70, 0x00, 0x00, 0x0A,
+    0xFF, 0xB1, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x7E, 0xFF,
+    0xF2, 0x00, 0x00, 0x00, 0x12, 0x20, 0x48, 0x49, 0xF8, 0x9F, 0x89, 0xF8,
+    0x9F, 0x89, 0xF8, 0x9F, 0x89, 0xF8, 0x9F, 0x89, 0xF8, 0x9F, 0x89, 0xF8,
+    0x9F, 0x89, 0xF8, 0x9F, 0x89, 0xF8, 0x9F, 0x89, 0xF8, 0x9F, 0x84, 0x84,
+    0x46, 0x65, 0x20, 0x00, 0x00, 0x9F, 0xFF, 0xF6, 0x00, 0x00, 0x6A, 0xDF,
+    0xFF, 0x10, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x0D, 0xFF, 0x50, 0x00, 0x00,
+    0x0C, 0xFF, 0x90, 0x00, 0x00, 0x06, 0xFF, 0xFC, 0x91, 0x00, 0x01, 0xAF,
+    0xFF, 0xF2, 0x00, 0x09, 0xFF, 0xE9, 0x61, 0x00, 0x0D, 0xFF, 0x70, 0x00,
+    0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x0E,
+    0xFF, 0x40, 0x00, 0x00, 0x5F, 0xFF, 0x30, 0x00, 0x9F, 0xFF, 0xFD, 0x00,
+    0x00, 0x9F, 0xFF, 0xB3, 0x00, 0x00, 0x12, 0x20, 0x00, 0x00, 0x00, 0x03,
+    0x89, 0x84, 0x00, 0x00, 0x17, 0x9F, 0xFF, 0xFF, 0xD9, 0x68, 0xDE, 0xFE,
+    0x98, 0xAE, 0xFF, 0xFF, 0xF9, 0x91, 0x00, 0x01, 0x6A, 0xB9, 0x40,
+};
+constexpr AaGlyph SANS_BOLD_19_GLYPHS[] = {
+    {0, 0, 0, 0, 0, 7}, // space
+    {0, 4, 14, 2, 2, 9}, // '!'
+    {28, 8, 6, 1, 2, 10}, // '"'
+    {52, 14, 14, 1, 2, 16}, // '#'
+    {150, 11, 18, 1, 1, 13}, // '$'
+    {249, 19, 16, 0, 1, 19}, // '%'
+    {401, 15, 16, 1, 1, 17}, // '&'
+    {521, 3, 6, 1, 2, 6}, // '''
+    {530, 6, 18, 1, 1, 9}, // '('
+    {584, 7, 18, 1, 1, 9}, // ')'
+    {647, 10, 10, 0, 1, 10}, // '*'
+    {697, 12, 12, 2, 4, 16}, // '+'
+    {769, 5, 7, 1, 12, 7}, // ','
+    {787, 6, 3, 1, 9, 8}, // '-'
+    {796, 5, 4, 1, 12, 7}, // '.'
+    {806, 7, 16, 0, 2, 7}, // '/'
+    {862, 13, 16, 0, 1, 13}, // '0'
+    {966, 10, 14, 2, 2, 13}, // '1'
+    {1036, 11, 15, 1, 1, 13}, // '2'
+    {1119, 11, 16, 1, 1, 13}, // '3'
+    {1207, 13, 14, 0, 2, 13}, // '4'
+    {1298, 11, 15, 1, 2, 13}, // '5'
+    {1381, 12, 16, 1, 1, 13}, // '6'
+    {1477, 11, 14, 1, 2, 13}, // '7'
+    {1554, 11, 16, 1, 1, 13}, // '8'
+    {1642, 11, 16, 1, 1, 13}, // '9'
+    {1730, 4, 11, 2, 5, 8}, // ':'
+    {1752, 5, 14, 1, 5, 8}, // ';'
+    {1787, 12, 12, 2, 4, 16}, // '<'
+    {1859, 12, 8, 2, 6, 16}, // '='
+    {1907, 12, 12, 2, 4, 16}, // '>'
+    {1979, 9, 15, 1, 1, 11}, // '?'
+    {2047, 17, 18, 1, 2, 19}, // '@'
+    {2200, 15, 14, 0, 2, 15}, // 'A'
+    {2305, 13, 14, 1, 2, 14}, // 'B'
+    {2396, 13, 16, 0, 1, 14}, // 'C'
+    {2500, 14, 14, 1, 2, 16}, // 'D'
+    {2598, 11, 14, 1, 2, 13}, // 'E'
+    {2675, 11, 14, 1, 2, 13}, // 'F'
+    {2752, 15, 16, 0, 1, 16}, // 'G'
+    {2872, 14, 14, 1, 2, 16}, // 'H'
+    {2970, 5, 14, 1, 2, 7}, // 'I'
+    {3005, 8, 18, -2, 2, 7}, // 'J'
+    {3077, 15, 14, 1, 2, 15}, // 'K'
+    {3182, 11, 14, 1, 2, 12}, // 'L'
+    {3259, 17, 14, 1, 2, 19}, // 'M'
+    {3378, 14, 14, 1, 2, 16}, // 'N'
+    {3476, 16, 16, 0, 1, 16}, // 'O'
+    {3604, 13, 14, 1, 2, 14}, // 'P'
+    {3695, 16, 18, 0, 1, 16}, // 'Q'
+    {3839, 14, 14, 1, 2, 15}, // 'R'
+    {3937, 12, 16, 1, 1, 14}, // 'S'
+    {4033, 13, 14, 0, 2, 13}, // 'T'
+    {4124, 13, 15, 1, 2, 15}, // 'U'
+    {4222, 15, 14, 0, 2, 15}, // 'V'
+    {4327, 21, 14, 0, 2, 21}, // 'W'
+    {4474, 15, 14, 0, 2, 15}, // 'X'
+    {4579, 14, 14, 0, 2, 14}, // 'Y'
+    {4677, 13, 14, 0, 2, 14}, // 'Z'
+    {4768, 7, 18, 1, 1, 9}, // '['
+    {4831, 7, 16, 0, 2, 7}, // '\'
+    {4887, 7, 18, 1, 1, 9}, // ']'
+    {4950, 12, 6, 2, 2, 16}, // '^'
+    {4986, 10, 3, 0, 18, 10}, // '_'
+    {5001, 5, 5, 1, 0, 10}, // '`'
+    {5014, 12, 12, 0, 5, 13}, // 'a'
+    {5086, 12, 16, 1, 1, 14}, // 'b'
+    {5182, 10, 12, 0, 5, 11}, // 'c'
+    {5242, 12, 16, 0, 1, 14}, // 'd'
+    {5338, 12, 12, 0, 5, 13}, // 'e'
+    {5410, 9, 15, 0, 1, 8}, // 'f'
+    {5478, 12, 16, 0, 5, 14}, // 'g'
+    {5574, 12, 15, 1, 1, 14}, // 'h'
+    {5664, 4, 15, 1, 1, 7}, // 'i'
+    {5694, 6, 20, -1, 1, 7}, // 'j'
+    {5754, 12, 15, 1, 1, 13}, // 'k'
+    {5844, 4, 15, 1, 1, 7}, // 'l'
+    {5874, 18, 11, 1, 5, 20}, // 'm'
+    {5973, 12, 11, 1, 5, 14}, // 'n'
+    {6039, 13, 12, 0, 5, 13}, // 'o'
+    {6117, 12, 15, 1, 5, 14}, // 'p'
+    {6207, 12, 15, 0, 5, 14}, // 'q'
+    {6297, 9, 11, 1, 5, 9}, // 'r'
+    {6347, 10, 12, 1, 5, 11}, // 's'
+    {6407, 9, 14, 0, 2, 9}, // 't'
+    {6470, 11, 12, 1, 5, 14}, // 'u'
+    {6536, 12, 11, 0, 5, 12}, // 'v'
+    {6602, 17, 11, 0, 5, 18}, // 'w'
+    {6696, 12, 11, 0, 5, 12}, // 'x'
+    {6762, 12, 16, 0, 5, 12}, // 'y'
+    {6858, 11, 11, 0, 5, 11}, // 'z'
+    {6919, 10, 19, 2, 1, 14}, // '{'
+    {7014, 3, 20, 2, 1, 7}, // '|'
+    {7044, 10, 19, 2, 1, 14}, // '}'
+    {7139, 12, 4, 2, 8, 16}, // '~'
+};
+constexpr AaKern SANS_BOLD_19_KERNS[] = {
+    {'-', 'T', -3}, {'-', 'V', -1}, {'-', 'W', -1}, {'-', 'X', -2},
+    {'-', 'Y', -3}, {'A', 'T', -1}, {'A', 'U', -1}, {'A', 'V', -1},
+    {'A', 'W', -1}, {'A', 'Y', -2}, {'A', 'v', -1}, {'A', 'y', -1},
+    {'B', 'V', -1}, {'B', 'W', -1}, {'B', 'Y', -1}, {'D', 'Y', -1},
+    {'F', ',', -3}, {'F', '-', -1}, {'F', '.', -3}, {'F', ':', -1},
+    {'F', ';', -1}, {'F', 'A', -2}, {'F', 'a', -1}, {'F', 'e', -1},
+    {'F', 'o', -1}, {'F', 'r', -1}, {'F', 'u', -1}, {'F', 'y', -1},
+    {'K', '-', -2}, {'K', 'C', -1}, {'K', 'O', -1}, {'K', 'y', -1},
+    {'L', 'O', -1}, {'L', 'T', -3}, {'L', 'U', -1}, {'L', 'V', -3},
+    {'L', 'W', -1}, {'L', 'Y', -3}, {'L', 'y', -1}, {'O', 'A', -1},
+    {'O', 'V', -1}, {'O', 'X', -1}, {'O', 'Y', -1}, {'P', ',', -3},
+    {'P', '.', -3}, {'P', 'A', -2}, {'P', 'a', -1}, {'R', 'T', -1},
+    {'R', 'Y', -1}, {'R', 'y', -1}, {'S', 'S', -1}, {'T', ',', -3},
+    {'T', '-', -3}, {'T', '.', -3}, {'T', ':', -1}, {'T', ';', -1},
+    {'T', 'A', -1}, {'T', 'a', -2}, {'T', 'c', -3}, {'T', 'e', -3},
+    {'T', 'o', -3}, {'T', 'r', -2}, {'T', 's', -3}, {'T', 'u', -2},
+    {'T', 'w', -2}, {'T', 'y', -2}, {'U', 'A', -1}, {'V', ',', -2},
+    {'V', '-', -1}, {'V', '.', -2}, {'V', ':', -1}, {'V', ';', -1},
+    {'V', 'A', -1}, {'V', 'a', -1}, {'V', 'e', -1}, {'V', 'o', -1},
+    {'V', 'u', -1}, {'W', ',', -2}, {'W', '-', -1}, {'W', '.', -2},
+    {'W', ':', -1}, {'W', ';', -1}, {'W', 'A', -1}, {'W', 'a', -1},
+    {'W', 'e', -1}, {'W', 'o', -1}, {'X', '-', -2}, {'X', 'C', -1},
+    {'X', 'O', -1}, {'X', 'e', -1}, {'Y', ',', -3}, {'Y', '-', -3},
+    {'Y', '.', -3}, {'Y', ':', -2}, {'Y', ';', -2}, {'Y', 'A', -2},
+    {'Y', 'C', -1}, {'Y', 'O', -1}, {'Y', 'a', -2}, {'Y', 'e', -2},
+    {'Y', 'o', -2}, {'Y', 'u', -1}, {'a', 'y', -1}, {'f', ',', -1},
+    {'f', '.', -1}, {'k', 'e', -1}, {'k', 'o', -1}, {'r', ',', -3},
+    {'r', '.', -3}, {'v', ',', -2}, {'v', '.', -2}, {'w', ',', -1},
+    {'w', '.', -1}, {'y', ',', -1}, {'y', '.', -2},
+};
+constexpr AaFont SANS_BOLD_19 = {SANS_BOLD_19_BITMAP, SANS_BOLD_19_GLYPHS,
+                                 SANS_BOLD_19_KERNS, 115, 32, 126, 21, 16};
+
+// 32 px, 51 glyphs, 32 px line: 11350 bitmap bytes, 12071 in all
+constexpr uint8_t SANS_BOLD_32_BITMAP[] = {
+    0x36, 0x66, 0x66, 0x18, 0xFF, 0xFF, 0xF2, 0x8F, 0xFF, 0xFF, 0x28, 0xFF,
+    0xFF, 0xF2, 0x8F, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0xF2, 0x8F, 0xFF, 0xFF,
+    0x28, 0xFF, 0xFF, 0xF2, 0x8F, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0xF2, 0x6F,
+    0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFB, 0x01, 0xFF, 0xFF,
+    0xA0, 0x0E, 0xFF, 0xF8, 0x00, 0xCF, 0xFF, 0x60, 0x01, 0x22, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x59, 0x99, 0x99, 0x18, 0xFF, 0xFF, 0xF2, 0x8F, 0xFF,
+    0xFF, 0x28, 0xFF, 0xFF, 0xF2, 0x8F, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x20, 0x00, 0xBF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xD0, 0x00, 0x0E, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0xF9, 0x00, 0x04, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xFF, 0x60, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xFF, 0xF2, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0xFD, 0x00, 0x00, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x06, 0x66, 0x6C, 0xFF,
+    0xD6, 0x66, 0x6F, 0xFF, 0x96, 0x66, 0x64, 0x00, 0x00, 0x00, 0xDF, 0xF9,
+    0x00, 0x04, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x50,
+    0x00, 0x8F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF1, 0x00,
+    0x0C, 0xFF, 0xA0, 0x00, 0x00, 0x05, 0x66, 0x66, 0xBF, 0xFE, 0x66, 0x66,
+    0xFF, 0xFA, 0x66, 0x65, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xD0, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x09, 0xFF, 0xD0, 0x00, 0x0E, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFA, 0x00, 0x03, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x60, 0x00, 0x7F, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xF2, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0xFD, 0x00, 0x00, 0xEF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0xA0, 0x00, 0x4F, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x8B, 0xBA, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B,
+    0xB9, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xEF, 0xFF,
+    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0xC1, 0x05, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x01, 0xEF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x60, 0x00,
+    0x09, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFE, 0x00, 0x00, 0x6F,
+    0xFF, 0x70, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF,
+    0x00, 0x00, 0x7F, 0xFF, 0x70, 0x00, 0xCF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0x30, 0x00, 0xAF, 0xFF, 0x40, 0x06, 0xFF, 0xE2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xA0, 0x02, 0xEF, 0xFE, 0x10, 0x1E,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFC, 0xAE, 0xFF,
+    0xF6, 0x00, 0x9F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x24, 0x31, 0x00,
+    0x00, 0x00, 0x17, 0xBD, 0xED, 0xA3, 0x00, 0x0C, 0xFF, 0xA0, 0x00, 0x7E,
+    0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE,
+    0x20, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xEF, 0xF7, 0x00, 0x9F, 0xFF, 0xC6, 0x8F, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x10, 0x06, 0xFF,
+    0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x05, 0xFF, 0xF9,
+    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFA, 0x00,
+    0x07, 0xFF, 0xF7, 0x00, 0x00, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0xE2, 0x00, 0x07, 0xFF, 0xF7, 0x00, 0x00, 0xEF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x1E, 0xFF, 0x70, 0x00, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFD,
+    0x00, 0x05, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xA4, 0x5E, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0xA0, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+    0x00, 0x6F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFF, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x68, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x57, 0x64, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xAB, 0xBA, 0x86,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+    0xFF, 0xA2, 0x01, 0x48, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x06,
+    0xFF, 0xFF, 0x70, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00,
+    0x08, 0xFF, 0xFF, 0x50, 0x00, 0xCF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFF, 0xE3,
+    0x00, 0x0B, 0xFF, 0xFF, 0x20, 0x06, 0xFF, 0xFF, 0xF4, 0x09, 0xFF, 0xFF,
+    0xFD, 0x20, 0x1E, 0xFF, 0xFE, 0x00, 0x0C, 0xFF, 0xFF, 0xA0, 0x00, 0xBF,
+    0xFF, 0xFF, 0xD1, 0x7F, 0xFF, 0xF9, 0x00, 0x0F, 0xFF, 0xFF, 0x60, 0x00,
+    0x1C, 0xFF, 0xFF, 0xFC, 0xEF, 0xFF, 0xF3, 0x00, 0x1F, 0xFF, 0xFF, 0x50,
+    0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x0F, 0xFF, 0xFF,
+    0x90, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x0D, 0xFF,
+    0xFF, 0xE2, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x08,
+    0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+    0x02, 0xEF, 0xFF, 0xFF, 0xFC, 0x99, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60,
+    0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF5, 0x00, 0x00, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0xFF,
+    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x18, 0xEF, 0xFF, 0xFF, 0xFF, 0xB5, 0x00,
+    0x8F, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x03, 0x56, 0x76, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x64, 0xEF, 0xFB, 0xEF, 0xFB, 0xEF,
+    0xFB, 0xEF, 0xFB, 0xEF, 0xFB, 0xEF, 0xFB, 0xEF, 0xFB, 0xEF, 0xFB, 0x56,
+    0x64, 0x00, 0x00, 0x03, 0x44, 0x44, 0x00, 0x00, 0x1E, 0xFF, 0xFA, 0x00,
+    0x00, 0x9F, 0xFF, 0xF2, 0x00, 0x03, 0xFF, 0xFF, 0xA0, 0x00, 0x0A, 0xFF,
+    0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00,
+    0x00, 0xDF, 0xFF, 0xF3, 0x00, 0x04, 0xFF, 0xFF, 0xE0, 0x00, 0x08, 0xFF,
+    0xFF, 0xA0, 0x00, 0x0B, 0xFF, 0xFF, 0x70, 0x00, 0x0E, 0xFF, 0xFF, 0x50,
+    0x00, 0x1F, 0xFF, 0xFF, 0x30, 0x00, 0x3F, 0xFF, 0xFF, 0x20, 0x00, 0x4F,
+    0xFF, 0xFF, 0x10, 0x00, 0x4F, 0xFF, 0xFF, 0x10, 0x00, 0x3F, 0xFF, 0xFF,
+    0x20, 0x00, 0x1F, 0xFF, 0xFF, 0x30, 0x00, 0x0E, 0xFF, 0xFF, 0x50, 0x00,
+    0x0B, 0xFF, 0xFF, 0x70, 0x00, 0x08, 0xFF, 0xFF, 0xA0, 0x00, 0x03, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0xDF, 0xFF, 0xF3, 0x00, 0x00, 0x8F, 0xFF, 0xF8,
+    0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00,
+    0x02, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x9F, 0xFF, 0xF3, 0x00, 0x00, 0x1E,
+    0xFF, 0xFA, 0x00, 0x00, 0x02, 0x44, 0x44, 0x14, 0x44, 0x41, 0x00, 0x00,
+    0x1E, 0xFF, 0xFA, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0xAF, 0xFF, 0xF4, 0x00, 0x00, 0x4F, 0xFF, 0xFB,
+    0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x20, 0x00, 0x09, 0xFF, 0xFF, 0x80, 0x00,
+    0x04, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0xDF,
+    0xFF, 0xF6, 0x00, 0x00, 0xAF, 0xFF, 0xF9, 0x00, 0x00, 0x9F, 0xFF, 0xFB,
+    0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00,
+    0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x9F, 0xFF,
+    0xFB, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0xDF, 0xFF, 0xF6, 0x00,
+    0x01, 0xFF, 0xFF, 0xF2, 0x00, 0x05, 0xFF, 0xFF, 0xD0, 0x00, 0x09, 0xFF,
+    0xFF, 0x80, 0x00, 0x0E, 0xFF, 0xFF, 0x20, 0x00, 0x4F, 0xFF, 0xFB, 0x00,
+    0x00, 0xAF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xB0, 0x00, 0x08, 0xFF,
+    0xFF, 0x30, 0x00, 0x1E, 0xFF, 0xFA, 0x00, 0x00, 0x14, 0x44, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x08,
+    0xDD, 0xDD, 0xDD, 0xDE, 0xFF, 0xFE, 0xDD, 0xDD, 0xDD, 0xD6, 0x9F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x69, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x7B, 0xBB, 0xBB, 0xBB, 0xDF,
+    0xFF, 0xCB, 0xBB, 0xBB, 0xBB, 0x50, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBF,
+    0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBF,
+    0xFF, 0xFD, 0x00, 0xEF, 0xFF, 0xF6, 0x03, 0xFF, 0xFF, 0xB0, 0x07, 0xFF,
+    0xFE, 0x20, 0x0B, 0xFF, 0xF6, 0x00, 0x1F, 0xFF, 0xB0, 0x00, 0x28, 0x88,
+    0x20, 0x00, 0x28, 0x88, 0x88, 0x88, 0x88, 0x44, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD,
+    0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x56, 0x64, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x9F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF8, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFA, 0x00, 0x00,
+    0x00, 0x02, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xAF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xF7, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+    0x09, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x8F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x9B, 0xBA,
+    0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3,
+    0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+    0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF,
+    0xFF, 0xFF, 0xC6, 0x6A, 0xFF, 0xFF, 0xFE, 0x10, 0x03, 0xFF, 0xFF, 0xFB,
+    0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x70, 0x09, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+    0x1E, 0xFF, 0xFF, 0xD0, 0x0E, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0A, 0xFF,
+    0xFF, 0xF3, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF6,
+    0x4F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x6F, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFA, 0x7F, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFB, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0xFB, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0xFF,
+    0xFF, 0xFB, 0x5F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF9,
+    0x4F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF5, 0x0C, 0xFF, 0xFF, 0xF1,
+    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF2, 0x08, 0xFF, 0xFF, 0xF6, 0x00, 0x00,
+    0x2F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x20, 0x01, 0xBF, 0xFF,
+    0xFF, 0x50, 0x00, 0x8F, 0xFF, 0xFF, 0xFB, 0xAE, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x01,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x06, 0xCF,
+    0xFF, 0xFF, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x56, 0x75,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x66, 0x66, 0x64, 0x00, 0x00,
+    0x00, 0x16, 0x9C, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x5A, 0x85, 0x10, 0xEF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0xEF, 0xFF,
+    0xFC, 0x22, 0x22, 0x20, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF1, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x03, 0x68, 0xAB, 0xBB, 0x97, 0x30, 0x00,
+    0x00, 0x3A, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x40, 0x00, 0x6F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x40, 0x6F, 0xFF, 0xD9, 0x66, 0x8D, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x6F, 0xA3, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xF2, 0x43, 0x00,
+    0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD2,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x01, 0xAF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF,
+    0xFC, 0x10, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xA1, 0x00, 0x00,
+    0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFB, 0x66,
+    0x66, 0x66, 0x66, 0x63, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x15, 0x79, 0xAB, 0xBB, 0x97, 0x40, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x70, 0x00, 0x0D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x0D, 0xFD, 0x97, 0x66, 0x7C, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x06, 0x20, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x26, 0xEF, 0xFF, 0xFE, 0x30, 0x00, 0x00,
+    0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF,
+    0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6,
+    0x00, 0x00, 0x00, 0xBD, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0xCF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
+    0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFB, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF9, 0xDB, 0x61, 0x00, 0x00, 0x01,
+    0x8F, 0xFF, 0xFF, 0xF6, 0xDF, 0xFF, 0xDB, 0x9A, 0xCF, 0xFF, 0xFF, 0xFF,
+    0xE1, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x00, 0x6A, 0xEF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC7, 0x10, 0x00, 0x00, 0x02, 0x46, 0x77, 0x65, 0x31, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x66, 0x66, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF,
+    0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xEF, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x30,
+    0x3F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x0C, 0xFF, 0xF7, 0x00, 0x3F, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x70,
+    0x00, 0x03, 0xFF, 0xFF, 0x30, 0x00, 0x3F, 0xFF, 0xFF, 0x70, 0x00, 0x0C,
+    0xFF, 0xF7, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x70, 0x00, 0x7F, 0xFF, 0xC0,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x70, 0x00, 0x8F, 0xFF, 0xB9, 0x99, 0x99,
+    0xBF, 0xFF, 0xFF, 0xC9, 0x97, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x6B,
+    0xBB, 0xBB, 0xBB, 0xBB, 0xCF, 0xFF, 0xFF, 0xDB, 0xB9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x70,
+    0x00, 0x03, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x20, 0x09, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x09, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x50, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x50, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x09, 0xFF,
+    0xFF, 0x42, 0x22, 0x22, 0x22, 0x22, 0x10, 0x09, 0xFF, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xFF, 0xFF, 0x89, 0x99, 0x97, 0x40, 0x00, 0x00, 0x09, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x60, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFA, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x90, 0x09, 0xFF, 0xC9, 0x76, 0x8C, 0xFF, 0xFF, 0xFF, 0xF3, 0x06, 0x61,
+    0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xFF, 0xFF, 0xFC, 0x8F, 0xC6, 0x10, 0x00, 0x01, 0x8F, 0xFF, 0xFF,
+    0xF7, 0x8F, 0xFF, 0xFC, 0xA9, 0xBE, 0xFF, 0xFF, 0xFF, 0xE1, 0x8F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE4, 0x00, 0x04, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x10,
+    0x00, 0x00, 0x00, 0x14, 0x67, 0x76, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x79, 0xBB, 0x98, 0x62, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xCF, 0xFF, 0xFF, 0xE8, 0x44, 0x46, 0x9E, 0xF0, 0x00, 0x6F, 0xFF,
+    0xFF, 0xA1, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0D, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0xFF, 0xFE, 0x00, 0x25, 0x65, 0x30, 0x00, 0x00, 0x0B,
+    0xFF, 0xFF, 0xC5, 0xDF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0xDF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x9E, 0xFF, 0xFF,
+    0xFA, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2E, 0xFF, 0xFF, 0xF2, 0xEF,
+    0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x6C, 0xFF, 0xFF, 0xF7,
+    0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF8, 0xAF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+    0x4F, 0xFF, 0xFF, 0x86, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+    0xF7, 0x2F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0xAF,
+    0xFF, 0xFF, 0x20, 0x00, 0x1D, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFE,
+    0x76, 0x7D, 0xFF, 0xFF, 0xF7, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFB, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10,
+    0x00, 0x00, 0x03, 0xAF, 0xFF, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x67, 0x65, 0x10, 0x00, 0x00, 0x00, 0x56, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x64, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFB, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xFF,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xEF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69,
+    0xAB, 0xBB, 0x97, 0x30, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x40, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF6, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20,
+    0x04, 0xFF, 0xFF, 0xFE, 0x61, 0x14, 0xDF, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
+    0xFF, 0xF7, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xB0, 0x08, 0xFF, 0xFF, 0xF3,
+    0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xFF, 0xF3, 0x00, 0x00,
+    0x0E, 0xFF, 0xFF, 0xA0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x5F, 0xFF,
+    0xFF, 0x50, 0x00, 0x8F, 0xFF, 0xFF, 0x94, 0x47, 0xEF, 0xFF, 0xFB, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00,
+    0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xD9, 0x9B,
+    0xFF, 0xFF, 0xFC, 0x10, 0x05, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x5F, 0xFF,
+    0xFF, 0x90, 0x0C, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xE1,
+    0x0F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF3, 0x1F, 0xFF,
+    0xFF, 0xA0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xD0,
+    0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF3, 0x0C, 0xFF, 0xFF, 0xF5, 0x00, 0x00,
+    0x2E, 0xFF, 0xFF, 0xF1, 0x07, 0xFF, 0xFF, 0xFF, 0xA6, 0x68, 0xEF, 0xFF,
+    0xFF, 0xA0, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20,
+    0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
+    0x6C, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0x67, 0x76, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xAB, 0xA9,
+    0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFE, 0x81,
+    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF,
+    0xFF, 0xFC, 0x42, 0x3A, 0xFF, 0xFF, 0xF7, 0x00, 0x0D, 0xFF, 0xFF, 0xE1,
+    0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x10, 0x2F, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+    0x6F, 0xFF, 0xFF, 0x60, 0x4F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0xA0, 0x5F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
+    0x4F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xF1, 0x2F, 0xFF,
+    0xFF, 0xD0, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF2, 0x0D, 0xFF, 0xFF, 0xF8,
+    0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xF3, 0x06, 0xFF, 0xFF, 0xFF, 0xEB, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF2, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF1,
+    0x00, 0x00, 0x3A, 0xEF, 0xFF, 0xEA, 0x39, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x01, 0x22, 0x00, 0x0D, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xFE, 0x10, 0x00, 0x84, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFF,
+    0xF7, 0x00, 0x00, 0xCF, 0xEA, 0x88, 0x8B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x67, 0x76, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x88, 0x88, 0x26, 0xFF, 0xFF, 0xF3, 0x6F,
+    0xFF, 0xFF, 0x36, 0xFF, 0xFF, 0xF3, 0x6F, 0xFF, 0xFF, 0x36, 0xFF, 0xFF,
+    0xF3, 0x38, 0x88, 0x88, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+    0xFF, 0x36, 0xFF, 0xFF, 0xF3, 0x6F, 0xFF, 0xFF, 0x36, 0xFF, 0xFF, 0xF3,
+    0x6F, 0xFF, 0xFF, 0x36, 0xFF, 0xFF, 0xF3, 0x00, 0x36, 0x9B, 0xBB, 0x97,
+    0x30, 0x00, 0x07, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xD0, 0xCF, 0xFC, 0x86, 0x6A, 0xFF, 0xFF, 0xFF, 0x4C, 0xA3, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xF6, 0x20, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+    0x01, 0xBF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xD2,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0xC1, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x99, 0x99, 0x91, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x0C, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x30, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0C, 0xFF, 0xFF, 0xE1, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0x30, 0x00, 0x6F, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0xF2, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xB9, 0x99, 0x99, 0xCF, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF3, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0xEB, 0xBB, 0xBB, 0xBB,
+    0xBB, 0xEF, 0xFF, 0xFE, 0x00, 0x08, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xFF, 0xF5, 0x00, 0xEF, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xA0, 0x4F, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF6, 0x06, 0x66, 0x66, 0x66, 0x66,
+    0x54, 0x31, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFD, 0x92, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF7, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFB, 0xBB, 0xBE, 0xFF, 0xFF, 0xFF, 0xC0, 0x01,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x10, 0x1F, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xF3, 0x01, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0x20, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFE, 0x44, 0x44, 0x7D,
+    0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFA, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x01,
+    0xFF, 0xFF, 0xFF, 0xBB, 0xBB, 0xDF, 0xFF, 0xFF, 0xFE, 0x10, 0x1F, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xF9, 0x01, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0xDF, 0xFF, 0xFF, 0x11, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+    0x0E, 0xFF, 0xFF, 0xF2, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0x11, 0xFF, 0xFF, 0xFE, 0x22, 0x22, 0x37, 0xEF, 0xFF, 0xFF,
+    0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0xDA, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x8A, 0xBB, 0xB9, 0x63, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x71, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x70, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF7, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFE, 0xA9, 0x9B, 0xEF, 0xFF, 0x70,
+    0x09, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x4A, 0xF7, 0x03, 0xFF,
+    0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x9F, 0xFF, 0xFF,
+    0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x60, 0x06, 0xFF, 0xFF, 0xFF, 0xF9, 0x30, 0x00, 0x14, 0x9E,
+    0xF7, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xEF, 0xFF, 0xFF, 0x70,
+    0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+    0x06, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x01,
+    0x6C, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x36, 0x67, 0x64, 0x20, 0x00, 0x00, 0x06, 0x66, 0x66, 0x66, 0x54, 0x42,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xEB, 0x72, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF9, 0x10, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x30, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x30, 0x01, 0xFF, 0xFF, 0xFE, 0x44, 0x44, 0x7B, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x10, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xCF, 0xFF,
+    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF,
+    0xFF, 0xE1, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+    0xFF, 0x61, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0xF9, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xC1, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xD1,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFD, 0x1F,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB1, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xF6, 0x01, 0xFF, 0xFF, 0xFF,
+    0x88, 0x89, 0xCF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+    0xDB, 0x96, 0x20, 0x00, 0x00, 0x00, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x61, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF3, 0x1F, 0xFF, 0xFF, 0xE4, 0x44, 0x44, 0x44, 0x44, 0x41,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x40,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x1F, 0xFF, 0xFF, 0xE2, 0x22, 0x22, 0x22, 0x22, 0x10, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xF8, 0x88, 0x88, 0x88, 0x88, 0x84, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x61, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF3, 0x1F, 0xFF, 0xFF, 0xE4, 0x44, 0x44, 0x44, 0x44, 0x41,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x40,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x1F, 0xFF, 0xFF, 0xE2, 0x22, 0x22, 0x22, 0x22, 0x10, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x89,
+    0xBB, 0xBA, 0x86, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE9, 0x40, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFE, 0xC9, 0x9A,
+    0xCE, 0xFF, 0xFF, 0x10, 0x09, 0xFF, 0xFF, 0xFF, 0xE6, 0x10, 0x00, 0x00,
+    0x04, 0x9E, 0xF1, 0x03, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x10, 0x9F, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5,
+    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x4F,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x12, 0x22, 0xCF, 0xFF, 0xFE, 0x0C, 0xFF,
+    0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFE, 0x01, 0xEF, 0xFF,
+    0xFF, 0xE3, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xE0, 0x06, 0xFF, 0xFF,
+    0xFF, 0xF9, 0x40, 0x00, 0x03, 0xDF, 0xFF, 0xFE, 0x00, 0x0A, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFD, 0xDF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x09, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x60, 0x00, 0x00, 0x01, 0x6C, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x36,
+    0x68, 0x65, 0x31, 0x00, 0x00, 0x00, 0x06, 0x66, 0x66, 0x50, 0x00, 0x00,
+    0x00, 0x01, 0x66, 0x66, 0x65, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFD, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x1F,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
+    0xF8, 0x88, 0x88, 0x88, 0x89, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xE2, 0x22, 0x22, 0x22, 0x24,
+    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFD, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x1F,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x06, 0x66, 0x66, 0x51, 0xFF, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xE1,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
+    0xFF, 0xE1, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFE,
+    0x1F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xE1, 0xFF,
+    0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
+    0xE1, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0x66, 0x66, 0x50,
+    0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x01,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x05, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xA1,
+    0x25, 0xCF, 0xFF, 0xFF, 0xF5, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0C, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x40, 0xCF, 0xFF, 0xFF, 0xFE, 0x50, 0x0C, 0xFF, 0xFF,
+    0xD8, 0x10, 0x00, 0x46, 0x64, 0x20, 0x00, 0x00, 0x00, 0x06, 0x66, 0x66,
+    0x50, 0x00, 0x00, 0x00, 0x03, 0x66, 0x66, 0x66, 0x30, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFB, 0x10, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFF, 0xB0, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x5F, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x05, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x5F, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE5, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE5, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x5F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x05, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x5F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x06, 0x66, 0x66,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x84, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x06, 0x66, 0x66,
+    0x66, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x66, 0x66, 0x51, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1E, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x06,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0x70, 0x00, 0x0A, 0xFF, 0xFE, 0xCF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
+    0xAA, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0xD1, 0xFF,
+    0xFF, 0xFA, 0x4F, 0xFF, 0xF5, 0x00, 0x8F, 0xFF, 0xF2, 0xCF, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xFF, 0xA0, 0xDF, 0xFF, 0xC0, 0x1E, 0xFF, 0xFA, 0x0C, 0xFF,
+    0xFF, 0xD1, 0xFF, 0xFF, 0xFA, 0x06, 0xFF, 0xFF, 0x36, 0xFF, 0xFF, 0x40,
+    0xCF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xA0, 0x1E, 0xFF, 0xF9, 0xCF, 0xFF,
+    0xC0, 0x0C, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFA, 0x00, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xF6, 0x00, 0xCF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xA0, 0x02, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x10, 0x0C, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFA, 0x00,
+    0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xCF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
+    0xA0, 0x00, 0x4F, 0xFF, 0xFF, 0xF2, 0x00, 0x0C, 0xFF, 0xFF, 0xD1, 0xFF,
+    0xFF, 0xFA, 0x00, 0x00, 0xDF, 0xFF, 0xFA, 0x00, 0x00, 0xCF, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xFF, 0xA0, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x0C, 0xFF,
+    0xFF, 0xD1, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x18, 0x88, 0x70, 0x00, 0x00,
+    0xCF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFD, 0x06, 0x66, 0x66,
+    0x64, 0x00, 0x00, 0x00, 0x00, 0x56, 0x66, 0x65, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x90,
+    0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xF2, 0x00,
+    0x00, 0x00, 0xDF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0xDF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+    0xDF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xDF,
+    0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xDF, 0xFF,
+    0xFD, 0x1F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0xDF, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xFF, 0xA8, 0xFF, 0xFF, 0x50, 0x00, 0xDF, 0xFF, 0xFD, 0x1F,
+    0xFF, 0xFF, 0xA1, 0xEF, 0xFF, 0xD0, 0x00, 0xDF, 0xFF, 0xFD, 0x1F, 0xFF,
+    0xFF, 0xA0, 0x8F, 0xFF, 0xF6, 0x00, 0xDF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
+    0xA0, 0x1E, 0xFF, 0xFD, 0x10, 0xDF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xA0,
+    0x07, 0xFF, 0xFF, 0x70, 0xDF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xA0, 0x00,
+    0xDF, 0xFF, 0xE1, 0xDF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xA0, 0x00, 0x6F,
+    0xFF, 0xF8, 0xDF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xA0, 0x00, 0x0D, 0xFF,
+    0xFE, 0xEF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xA0, 0x00, 0x05, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0xCF, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+    0xFD, 0x1F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F,
+    0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
+    0xFF, 0xA0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0x37, 0x9B, 0xBB, 0x97, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00,
+    0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+    0x2E, 0xFF, 0xFF, 0xFF, 0xEB, 0x9A, 0xEF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+    0x0B, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFD, 0x10,
+    0x04, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF7,
+    0x00, 0xAF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF,
+    0xD0, 0x0E, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0x22, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0xFF, 0x76, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xFF, 0xF8, 0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0xF8, 0x4F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0x72, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xFF, 0xFF, 0xF4, 0x0D, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x10, 0x8F, 0xFF, 0xFF, 0xE1, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xB0, 0x02, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+    0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF5, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xC4,
+    0x00, 0x03, 0xAF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x1C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x19, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x9E, 0xFF, 0xFF, 0xFF, 0xFE, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x56, 0x76, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66,
+    0x66, 0x66, 0x66, 0x65, 0x42, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x93, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF9, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x38, 0xFF, 0xFF, 0xFF,
+    0xB0, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFE, 0x01,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF2, 0x1F, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x21, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF1, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x1C, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x9E,
+    0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE1, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xB7, 0x30, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x37, 0x9B, 0xBB, 0xA7, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x60, 0x00, 0x00,
+    0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xEB, 0x9A, 0xEF, 0xFF, 0xFF, 0xFF, 0x50,
+    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFE,
+    0x10, 0x04, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+    0xF7, 0x00, 0xAF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF,
+    0xFF, 0xD0, 0x0E, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0x22, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0x76, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0xF8, 0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xFF, 0xF8, 0x4F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x72, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xF4, 0x0D, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x10, 0x8F, 0xFF, 0xFF, 0xD1, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xA0, 0x02, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF4, 0x00, 0x09, 0xFF, 0xFF, 0xFF,
+    0xB4, 0x00, 0x03, 0xAF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x1C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x1C, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x19,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x46, 0x6B, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xC1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x99, 0x99, 0x40,
+    0x00, 0x06, 0x66, 0x66, 0x66, 0x66, 0x54, 0x31, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x10, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xE0,
+    0x00, 0x15, 0xDF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xA0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0xDF, 0xFF, 0xFF,
+    0x30, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xE2, 0x24, 0x8F, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x09, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02,
+    0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x9F,
+    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF,
+    0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF,
+    0xFB, 0x00, 0x00, 0x15, 0x8A, 0xBB, 0xB9, 0x86, 0x30, 0x00, 0x00, 0x00,
+    0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x20, 0x01, 0xCF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x30, 0x3F, 0xFF, 0xFF, 0xFE, 0xA9, 0x9B, 0xDF, 0xFF, 0xF3,
+    0x07, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x15, 0xAF, 0x30, 0xAF, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0A, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x71, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xEA, 0x74, 0x10, 0x00, 0x00, 0x00,
+    0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x30, 0x00, 0x00, 0x6F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x18, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE1, 0x00, 0x00, 0x00, 0x36, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x7E, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFF, 0xFF, 0xFA, 0x8C, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0xFF, 0x98, 0xFF, 0xE9, 0x52, 0x00, 0x01, 0x6E, 0xFF, 0xFF, 0xF5, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFE, 0x18, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x70, 0x00, 0x27, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x30,
+    0x00, 0x00, 0x00, 0x02, 0x46, 0x68, 0x65, 0x30, 0x00, 0x00, 0x00, 0x56,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xDF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x34, 0x44, 0x44, 0x45, 0xFF, 0xFF,
+    0xFE, 0x44, 0x44, 0x44, 0x42, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x66, 0x66, 0x50, 0x00, 0x00, 0x00, 0x05, 0x66, 0x66, 0x60, 0x1F, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF1, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF1, 0x1F, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF1, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF1, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xF1, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0xF1, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xF1, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0xF1, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xF1, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF1,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF1, 0x1F,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF1, 0x1F, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF1, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF1, 0x1F, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x0E, 0xFF, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x0C, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xFF, 0xC0, 0x09, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x3A, 0xFF,
+    0xFF, 0xFF, 0x30, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2,
+    0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x00,
+    0x00, 0x00, 0x06, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x46, 0x77, 0x64, 0x10, 0x00, 0x00, 0x00, 0x46, 0x66,
+    0x66, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x66, 0x66, 0x38, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF5, 0x2F,
+    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00,
+    0xCF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80,
+    0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xF3,
+    0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+    0x70, 0x00, 0x05, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF,
+    0xF1, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x9F, 0xFF,
+    0xFF, 0x50, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x0E, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xF2, 0x00, 0x05, 0xFF,
+    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x70, 0x00, 0xAF,
+    0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
+    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF3, 0x06,
+    0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x80,
+    0xBF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFD,
+    0x2F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+    0xFB, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66,
+    0x64, 0x00, 0x00, 0x00, 0x02, 0x66, 0x66, 0x63, 0x00, 0x00, 0x00, 0x03,
+    0x66, 0x66, 0x61, 0xDF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF2, 0x9F, 0xFF, 0xFF, 0x20,
+    0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF,
+    0xD0, 0x6F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0x30,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x90, 0x2F, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+    0x2F, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x60, 0x0D,
+    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+    0x9F, 0xFF, 0xFF, 0x20, 0x0A, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x9F, 0xFF,
+    0xDF, 0xFF, 0xE0, 0x00, 0x00, 0xCF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFF,
+    0xF5, 0x00, 0x00, 0xDF, 0xFF, 0x6F, 0xFF, 0xF2, 0x00, 0x01, 0xFF, 0xFF,
+    0xFA, 0x00, 0x03, 0xFF, 0xFF, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0x1D, 0xFF,
+    0xF6, 0x00, 0x04, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0xEF, 0xFF, 0xFC, 0x00,
+    0x05, 0xFF, 0xFD, 0x09, 0xFF, 0xF9, 0x00, 0x08, 0xFF, 0xFF, 0xF3, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0x10, 0x09, 0xFF, 0xF9, 0x05, 0xFF, 0xFD, 0x00,
+    0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0C, 0xFF,
+    0xF6, 0x02, 0xFF, 0xFF, 0x20, 0x0F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x4F,
+    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF2, 0x00, 0xDF, 0xFF, 0x50, 0x4F, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x4F, 0xFF, 0xE0, 0x00,
+    0xAF, 0xFF, 0x90, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0xF0, 0x8F, 0xFF, 0xA0, 0x00, 0x6F, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0x10,
+    0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0x70, 0x00, 0x3F, 0xFF,
+    0xF1, 0xEF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF8, 0xEF,
+    0xFF, 0x30, 0x00, 0x0E, 0xFF, 0xF7, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x00, 0x0A, 0xFF, 0xFE, 0xFF,
+    0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0xEF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x66,
+    0x66, 0x62, 0x00, 0x00, 0x00, 0x00, 0x04, 0x66, 0x66, 0x64, 0x08, 0xFF,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF3, 0x00, 0xCF,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0x70, 0x00, 0x3F,
+    0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xFF, 0x70, 0x00, 0xDF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+    0x2E, 0xFF, 0xFF, 0xF3, 0x08, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xFF, 0xFF, 0xFC, 0x4F, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0xFF, 0xFF, 0xF5, 0x0A, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xFF, 0xA0, 0x01, 0xEF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x05,
+    0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x5F, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x1E,
+    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0xAF,
+    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0x50, 0x06, 0xFF,
+    0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xE1, 0x2E, 0xFF,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFA, 0x16, 0x66,
+    0x66, 0x62, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0x66, 0x66, 0x20, 0xBF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xD1, 0x02,
+    0xEF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF4, 0x00,
+    0x07, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xF9, 0x00,
+    0x00, 0x0C, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFD, 0x10,
+    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF5, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE1, 0x00, 0xCF, 0xFF, 0xFF, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0x90, 0x7F, 0xFF, 0xFF, 0xE1,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF,
+    0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x16, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x23, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x31, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0xFF, 0xFF, 0xFF,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+    0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xF8, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x86, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+};
+constexpr AaGlyph SANS_BOLD_32_GLYPHS[] = {
+    {0, 0, 0, 0, 0, 11}, // space
+    {0, 7, 24, 4, 1, 15}, // '!'
+    {0, 0, 0, 0, 0, 0}, // (none)
+    {84, 23, 23, 2, 2, 27}, // '#'
+    {0, 0, 0, 0, 0, 0}, // (none)
+    {349, 30, 25, 1, 1, 32}, // '%'
+    {724, 26, 25, 1, 1, 28}, // '&'
+    {1049, 4, 10, 3, 1, 10}, // '''
+    {1069, 10, 30, 2, 0, 15}, // '('
+    {1219, 10, 30, 2, 0, 15}, // ')'
+    {0, 0, 0, 0, 0, 0}, // (none)
+    {1369, 21, 21, 3, 4, 27}, // '+'
+    {1590, 8, 11, 1, 19, 12}, // ','
+    {1634, 11, 5, 1, 13, 13}, // '-'
+    {1662, 6, 6, 3, 19, 12}, // '.'
+    {1680, 12, 27, 0, 1, 12}, // '/'
+    {1842, 20, 25, 1, 1, 22}, // '0'
+    {2092, 18, 24, 3, 1, 22}, // '1'
+    {2308, 18, 24, 2, 1, 22}, // '2'
+    {2524, 18, 25, 2, 1, 22}, // '3'
+    {2749, 20, 24, 1, 1, 22}, // '4'
+    {2989, 18, 25, 2, 1, 22}, // '5'
+    {3214, 19, 25, 2, 1, 22}, // '6'
+    {3452, 18, 24, 2, 1, 22}, // '7'
+    {3668, 20, 25, 1, 1, 22}, // '8'
+    {3918, 20, 25, 1, 1, 22}, // '9'
+    {4168, 7, 18, 3, 7, 13}, // ':'
+    {0, 0, 0, 0, 0, 0}, // (none)
+    {0, 0, 0, 0, 0, 0}, // (none)
+    {0, 0, 0, 0, 0, 0}, // (none)
+    {0, 0, 0, 0, 0, 0}, // (none)
+    {4231, 15, 24, 2, 1, 19}, // '?'
+    {0, 0, 0, 0, 0, 0}, // (none)
+    {4411, 25, 24, 0, 1, 25}, // 'A'
+    {4711, 21, 24, 2, 1, 24}, // 'B'
+    {4963, 21, 25, 1, 1, 23}, // 'C'
+    {5226, 23, 24, 2, 1, 27}, // 'D'
+    {5502, 18, 24, 2, 1, 22}, // 'E'
+    {5718, 18, 24, 2, 1, 22}, // 'F'
+    {5934, 23, 25, 1, 1, 26}, // 'G'
+    {6222, 22, 24, 2, 1, 27}, // 'H'
+    {6486, 7, 24, 2, 1, 12}, // 'I'
+    {6570, 11, 31, -2, 1, 12}, // 'J'
+    {6741, 24, 24, 2, 1, 25}, // 'K'
+    {7029, 18, 24, 2, 1, 20}, // 'L'
+    {7245, 27, 24, 2, 1, 32}, // 'M'
+    {7569, 22, 24, 2, 1, 27}, // 'N'
+    {7833, 25, 25, 1, 1, 27}, // 'O'
+    {8146, 21, 24, 2, 1, 23}, // 'P'
+    {8398, 25, 29, 1, 1, 27}, // 'Q'
+    {8761, 22, 24, 2, 1, 25}, // 'R'
+    {9025, 19, 25, 2, 1, 23}, // 'S'
+    {9263, 22, 24, 0, 1, 22}, // 'T'
+    {9527, 22, 25, 2, 1, 26}, // 'U'
+    {9802, 25, 24, 0, 1, 25}, // 'V'
+    {10102, 34, 24, 1, 1, 35}, // 'W'
+    {10510, 24, 24, 0, 1, 25}, // 'X'
+    {10798, 25, 24, -1, 1, 23}, // 'Y'
+    {11098, 21, 24, 1, 1, 23}, // 'Z'
+};
+constexpr AaKern SANS_BOLD_32_KERNS[] = {
+    {'-', 'T', -5}, {'-', 'V', -2}, {'-', 'W', -1}, {'-', 'X', -3},
+    {'-', 'Y', -5}, {'A', ',', 1}, {'A', '.', 1}, {'A', ':', 1},
+    {'A', 'T', -2}, {'A', 'U', -1}, {'A', 'V', -2}, {'A', 'W', -1},
+    {'A', 'Y', -3}, {'B', 'V', -1}, {'B', 'W', -2}, {'B', 'Y', -2},
+    {'C', '-', 1}, {'C', 'S', 1}, {'D', '-', 1}, {'D', 'Y', -2},
+    {'F', ',', -5}, {'F', '-', -1}, {'F', '.', -5}, {'F', ':', -2},
+    {'F', 'A', -4}, {'G', 'T', -1}, {'G', 'Y', -1}, {'K', '-', -3},
+    {'K', 'C', -1}, {'K', 'O', -1}, {'K', 'U', -1}, {'L', 'O', -1},
+    {'L', 'T', -5}, {'L', 'U', -1}, {'L', 'V', -4}, {'L', 'W', -2},
+    {'L', 'Y', -5}, {'O', ',', -1}, {'O', '-', 1}, {'O', '.', -1},
+    {'O', 'A', -1}, {'O', 'V', -1}, {'O', 'X', -1}, {'O', 'Y', -1},
+    {'P', ',', -6}, {'P', '-', -1}, {'P', '.', -6}, {'P', 'A', -3},
+    {'Q', '-', 1}, {'R', ',', 1}, {'R', '.', 1}, {'R', 'T', -1},
+    {'R', 'Y', -2}, {'S', 'S', -1}, {'T', ',', -5}, {'T', '-', -5},
+    {'T', '.', -5}, {'T', ':', -2}, {'T', 'A', -2}, {'T', 'T', 1},
+    {'U', 'A', -1}, {'V', ',', -4}, {'V', '-', -2}, {'V', '.', -4},
+    {'V', ':', -1}, {'V', 'A', -2}, {'V', 'O', -1}, {'W', ',', -3},
+    {'W', '-', -1}, {'W', '.', -3}, {'W', ':', -1}, {'W', 'A', -1},
+    {'X', '-', -3}, {'X', 'C', -1}, {'X', 'O', -1}, {'Y', ',', -5},
+    {'Y', '-', -5}, {'Y', '.', -5}, {'Y', ':', -3}, {'Y', 'A', -3},
+    {'Y', 'C', -1}, {'Y', 'O', -1}, {'Z', '-', -1},
+};
+constexpr AaFont SANS_BOLD_32 = {SANS_BOLD_32_BITMAP, SANS_BOLD_32_GLYPHS,
+                                 SANS_BOLD_32_KERNS, 83, 32, 90, 32, 25};
+
+} // namespace aa
+} // namespace lifeline
+
+#endif // LIFELINE_AA_TEXT_FONTS_H
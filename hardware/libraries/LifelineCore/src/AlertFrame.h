@@ -0,0 +1,218 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                      LIFELINE CORE - LORA FRAME PARSER
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * The one parser every receiver runs on a frame straight out of the radio
+ * FIFO. It works in place on (buffer, length): no String, no heap, no read
+ * past len, no terminator required.
+ *
+ *   TX003,A;k=412;s=7     alert: device 3, code A, optional trailer
+ *   3,5                   bare alert (only without FRAME_REQUIRE_TX)
+ *   HB003;i=123;l=40;u=9  energy heartbeat: device 3, trailer fields
+ *
+ * The device is a decimal number (0..65535). The code is a letter A..O in
+ * either case or a decimal index; spaces around both are ignored. Anything
+ * else in the code position (empty, out of range, non-numeric) is an
+ * unknown code, mapped to the last alert (OTHER) unless FRAME_STRICT_CODE
+ * asks for the frame to be rejected.
+ *
+ *   lifeline::AlertFrame f;
+ *   if (lifeline::parseFrame(buf, len, f) == lifeline::FRAME_ALERT) ...
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_ALERT_FRAME_H
+#define LIFELINE_ALERT_FRAME_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "LatencyBudget.h"
+
+#ifndef FRAME_MAX_LEN
+#define FRAME_MAX_LEN 255 // SX127x FIFO payload limit
+#endif
+#ifndef FRAME_ALERT_CODES
+#define FRAME_ALERT_CODES 15 // A..O; the last one is OTHER
+#endif
+
+namespace lifeline {
+
+enum FrameType : uint8_t { FRAME_INVALID, FRAME_ALERT, FRAME_HEARTBEAT };
+
+/** Parser options (or-ed together). */
+enum FrameFlags : uint8_t {
+  FRAME_REQUIRE_TX = 0x01,  // Reject the bare "<id>,<code>" form
+  FRAME_STRICT_CODE = 0x02, // Reject unknown codes instead of using OTHER
+};
+
+/**
+ * The policy every receiver parses with: bare frames are taken and an
+ * unknown code is shown as OTHER, so no alert is lost for its form. The
+ * strict flags are for tools that check what the transmitters send.
+ */
+constexpr uint8_t FRAME_RX_FLAGS = 0;
+
+enum FrameError : uint8_t {
+  FRAME_OK,
+  FRAME_EMPTY,
+  FRAME_TOO_LONG,
+  FRAME_NO_PREFIX,
+  FRAME_NO_COMMA,
+  FRAME_BAD_DEVICE,
+  FRAME_BAD_CODE,
+};
+
+static const char *const frameErrorNames[] = {
+    "ok", "empty", "too long", "no TX prefix", "no comma", "bad device",
+    "bad code"};
+
+struct AlertFrame {
+  FrameType type = FRAME_INVALID;
+  FrameError error = FRAME_EMPTY;
+  uint16_t deviceId = 0;
+  int8_t alertIndex = -1;
+  bool codeDefaulted = false; // Unknown code mapped to OTHER
+  long seq = -1;              // ";s=", -1 when absent
+  long txUiMs = -1;           // ";k=", -1 when absent
+  const char *trailer = nullptr; // At the first ';' inside the buffer
+  uint8_t trailerLen = 0;
+
+  /** Any other trailer field (heartbeat i/l/u/v/b); def when absent. */
+  long field(char key, long def = -1) const {
+    long v = def;
+    frameTrailerField(trailer, trailerLen, key, v);
+    return v;
+  }
+};
+
+namespace frame_detail {
+
+inline bool blank(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+/** Trim [b, e) in place. */
+inline void trim(const char *&b, const char *&e) {
+  while (b < e && blank(*b))
+    b++;
+  while (e > b && blank(e[-1]))
+    e--;
+}
+
+/** Whole of [b, e) as a decimal number no greater than max. */
+inline bool parseUnsigned(const char *b, const char *e, uint32_t max,
+                          uint32_t &out) {
+  if (b == e)
+    return false;
+  uint32_t v = 0;
+  for (; b < e; b++) {
+    if (*b < '0' || *b > '9')
+      return false;
+    v = v * 10 + (uint32_t)(*b - '0');
+    if (v > max)
+      return false;
+  }
+  out = v;
+  return true;
+}
+
+} // namespace frame_detail
+
+/**
+ * Parse one frame. Returns the frame type and fills out; out.error says why
+ * a frame was rejected. alertCodes is the size of the sketch's alert table
+ * (at most 127).
+ */
+inline FrameType parseFrame(const char *buf, size_t len, AlertFrame &out,
+                            uint8_t flags = 0,
+                            uint8_t alertCodes = FRAME_ALERT_CODES) {
+  using namespace frame_detail;
+  out = AlertFrame();
+  if (!buf || len == 0)
+    return FRAME_INVALID;
+  if (len > FRAME_MAX_LEN) {
+    out.error = FRAME_TOO_LONG;
+    return FRAME_INVALID;
+  }
+
+  const char *const end = buf + len;
+  const char *bodyEnd = (const char *)memchr(buf, ';', len);
+  if (bodyEnd) {
+    out.trailer = bodyEnd;
+    out.trailerLen = (uint8_t)(end - bodyEnd);
+    frameTrailerField(out.trailer, out.trailerLen, 's', out.seq);
+    frameTrailerField(out.trailer, out.trailerLen, 'k', out.txUiMs);
+  } else {
+    bodyEnd = end;
+  }
+
+  const char *p = buf;
+  const bool heartbeat = len >= 2 && p[0] == 'H' && p[1] == 'B';
+  const bool prefixed = len >= 2 && p[0] == 'T' && p[1] == 'X';
+  if (heartbeat || prefixed)
+    p += 2;
+  else if (flags & FRAME_REQUIRE_TX) {
+    out.error = FRAME_NO_PREFIX;
+    return FRAME_INVALID;
+  }
+
+  const char *comma = heartbeat ? bodyEnd
+                                : (const char *)memchr(p, ',', bodyEnd - p);
+  if (!comma) {
+    out.error = FRAME_NO_COMMA;
+    return FRAME_INVALID;
+  }
+
+  const char *idBegin = p, *idEnd = comma;
+  trim(idBegin, idEnd);
+  uint32_t id;
+  if (!parseUnsigned(idBegin, idEnd, 0xFFFF, id)) {
+    out.error = FRAME_BAD_DEVICE;
+    return FRAME_INVALID;
+  }
+  out.deviceId = (uint16_t)id;
+
+  if (heartbeat) {
+    out.error = FRAME_OK;
+    out.type = FRAME_HEARTBEAT;
+    return out.type;
+  }
+
+  if (alertCodes == 0) {
+    out.error = FRAME_BAD_CODE;
+    return FRAME_INVALID;
+  }
+  const char *codeBegin = comma + 1, *codeEnd = bodyEnd;
+  trim(codeBegin, codeEnd);
+  const int letters = alertCodes < 26 ? alertCodes : 26;
+  int code = -1;
+  uint32_t number;
+  if (codeEnd - codeBegin == 1 && *codeBegin >= 'A' &&
+      *codeBegin < 'A' + letters)
+    code = *codeBegin - 'A';
+  else if (codeEnd - codeBegin == 1 && *codeBegin >= 'a' &&
+           *codeBegin < 'a' + letters)
+    code = *codeBegin - 'a';
+  else if (parseUnsigned(codeBegin, codeEnd, alertCodes - 1, number))
+    code = (int)number;
+
+  if (code < 0) {
+    if (flags & FRAME_STRICT_CODE) {
+      out.error = FRAME_BAD_CODE;
+      return FRAME_INVALID;
+    }
+    code = alertCodes - 1;
+    out.codeDefaulted = true;
+  }
+  out.alertIndex = (int8_t)code;
+  out.error = FRAME_OK;
+  out.type = FRAME_ALERT;
+  return out.type;
+}
+
+} // namespace lifeline
+
+#endif // LIFELINE_ALERT_FRAME_H
@@ -0,0 +1,301 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                  LIFELINE CORE - RECEIVER ALERT INBOX
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Every alert the receiver shows stays in the inbox until the operator
+ * acknowledges it. A later alert no longer takes the place of an earlier
+ * one. The inbox is a binary min-heap in a fixed array, ordered by
+ * priority (0 = critical) and then by arrival, so the most urgent alert
+ * that has waited longest is always on top:
+ *
+ *   lifeline::AlertInbox<> inbox;
+ *   const uint32_t id = inbox.push(deviceId, alertIndex, priority, rssi,
+ *                                  millis());
+ *   const lifeline::InboxAlert *next = inbox.top();   // O(1)
+ *   inbox.page(rows, 6, 6);                           // Ranks 6..11
+ *   inbox.acknowledge(id);                            // O(n) find, O(log n)
+ *
+ *   Repeats  The same alert from the same device while one is still open
+ *            is counted on that entry (repeats, last RSSI) and keeps its
+ *            place. A duplicate frame (same s=) never gets here: the
+ *            DuplicateFilter drops it first.
+ *   Full     ALERT_INBOX_SLOTS entries. When full, a new alert replaces
+ *            the least urgent, newest entry if it is more urgent than it.
+ *            Otherwise the new alert is not kept. A critical alert only
+ *            goes once every open alert is critical. dropped() counts both
+ *            cases, and lost() keeps the last ALERT_INBOX_LOST of them, so
+ *            the list view can say which devices they came from.
+ *   Pages    page() returns ranks in order without sorting the heap. It
+ *            runs a selection pass for each rank, which costs nothing
+ *            at 48 entries.
+ *
+ * ids count up from 1 and are never reused, so a view can keep the id of
+ * a row it drew and compare it against the current one.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_ALERT_INBOX_H
+#define LIFELINE_ALERT_INBOX_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "MemoryBudget.h" // printfTo(): the gateway runs with the heap frozen
+
+#ifndef ALERT_INBOX_SLOTS
+#define ALERT_INBOX_SLOTS 48 // Open alerts (16 bytes each)
+#endif
+#ifndef ALERT_INBOX_LOST
+#define ALERT_INBOX_LOST 8 // Last alerts a full inbox could not keep
+#endif
+
+namespace lifeline {
+
+struct InboxAlert {
+  uint32_t id;         // Arrival number, from 1
+  uint32_t receivedMs; // First arrival
+  uint16_t deviceId;
+  int16_t rssi;        // Last arrival
+  uint8_t alertIndex;
+  uint8_t priority;    // 0 = critical
+  uint8_t repeats;     // Further arrivals while open (saturates)
+};
+
+/** An alert a full inbox turned away or made room for. */
+struct InboxLost {
+  uint32_t lostMs;
+  uint16_t deviceId;
+  uint8_t alertIndex;
+  uint8_t priority;
+};
+
+/** a before b: more urgent, or as urgent and older. */
+inline bool inboxBefore(const InboxAlert &a, const InboxAlert &b) {
+  return a.priority != b.priority ? a.priority < b.priority : a.id < b.id;
+}
+
+template <uint8_t SLOTS = ALERT_INBOX_SLOTS> class AlertInbox {
+public:
+  struct Stats {
+    uint32_t received = 0;     // push() calls
+    uint32_t acknowledged = 0;
+    uint32_t merged = 0;       // Counted as repeats of an open alert
+    uint32_t dropped = 0;      // Lost to a full inbox
+    uint8_t peak = 0;          // Most alerts open at once
+  };
+
+  /**
+   * Add an alert, or count it on the open one from the same device with
+   * the same code. Returns its id, or 0 if the inbox is full of alerts
+   * more urgent than this one.
+   */
+  uint32_t push(uint16_t deviceId, uint8_t alertIndex, uint8_t priority,
+                int16_t rssi, uint32_t nowMs) {
+    stats_.received++;
+    version_++;
+    for (uint8_t i = 0; i < size_; i++) {
+      InboxAlert &e = heap_[i];
+      if (e.deviceId == deviceId && e.alertIndex == alertIndex) {
+        if (e.repeats < 255)
+          e.repeats++;
+        e.rssi = rssi;
+        stats_.merged++;
+        return e.id;
+      }
+    }
+
+    InboxAlert a;
+    a.id = nextId_++;
+    a.receivedMs = nowMs;
+    a.deviceId = deviceId;
+    a.rssi = rssi;
+    a.alertIndex = alertIndex;
+    a.priority = priority;
+    a.repeats = 0;
+
+    if (size_ == SLOTS) {
+      stats_.dropped++;
+      const uint8_t last = leastUrgent();
+      if (!inboxBefore(a, heap_[last])) {
+        noteLost(a, nowMs);
+        return 0;
+      }
+      noteLost(heap_[last], nowMs);
+      removeAt(last);
+    }
+    heap_[size_] = a;
+    siftUp(size_++);
+    if (size_ > stats_.peak)
+      stats_.peak = size_;
+    return a.id;
+  }
+
+  /** The most urgent open alert, or nullptr. */
+  const InboxAlert *top() const { return size_ ? &heap_[0] : nullptr; }
+
+  const InboxAlert *find(uint32_t id) const {
+    const int i = indexOf(id);
+    return i < 0 ? nullptr : &heap_[i];
+  }
+
+  /** Close an alert. False if it is not open. */
+  bool acknowledge(uint32_t id) {
+    const int i = indexOf(id);
+    if (i < 0)
+      return false;
+    removeAt((uint8_t)i);
+    stats_.acknowledged++;
+    version_++;
+    return true;
+  }
+
+  /**
+   * Up to n alerts of rank first, first + 1, ... (0 = top) into out, most
+   * urgent first. Returns how many there were.
+   */
+  uint8_t page(InboxAlert *out, uint8_t first, uint8_t n) const {
+    const InboxAlert *prev = nullptr;
+    uint8_t got = 0;
+    for (uint16_t rank = 0; rank < (uint16_t)first + n; rank++) {
+      const InboxAlert *best = nullptr;
+      for (uint8_t i = 0; i < size_; i++) {
+        const InboxAlert &e = heap_[i];
+        if ((!prev || inboxBefore(*prev, e)) && (!best || inboxBefore(e, *best)))
+          best = &e;
+      }
+      if (!best)
+        break;
+      if (rank >= first)
+        out[got++] = *best;
+      prev = best;
+    }
+    return got;
+  }
+
+  /** Open alerts at priority <= priority. */
+  uint8_t countAtMost(uint8_t priority) const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < size_; i++)
+      n += heap_[i].priority <= priority;
+    return n;
+  }
+
+  uint8_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  static constexpr uint8_t capacity() { return SLOTS; }
+  /** Changes with every push() and acknowledge(): views redraw on it. */
+  uint32_t version() const { return version_; }
+  uint32_t dropped() const { return stats_.dropped; }
+
+  /**
+   * Up to n of the last alerts lost to a full inbox into out, newest
+   * first. Returns how many there were.
+   */
+  uint8_t lost(InboxLost *out, uint8_t n) const {
+    const uint8_t kept = stats_.dropped < ALERT_INBOX_LOST
+                             ? (uint8_t)stats_.dropped
+                             : ALERT_INBOX_LOST;
+    if (n > kept)
+      n = kept;
+    for (uint8_t i = 0; i < n; i++)
+      out[i] = lost_[(lostNext_ + ALERT_INBOX_LOST - 1 - i) % ALERT_INBOX_LOST];
+    return n;
+  }
+  const Stats &stats() const { return stats_; }
+
+  void printReport(Print &out) const {
+    printfTo(out, "[INBOX] %u open (%u critical) of %u; %lu received, %lu "
+               "acknowledged, %lu repeats, %lu dropped, peak %u\n",
+             size_, countAtMost(0), SLOTS, (unsigned long)stats_.received,
+             (unsigned long)stats_.acknowledged, (unsigned long)stats_.merged,
+             (unsigned long)stats_.dropped, stats_.peak);
+    InboxLost gone[ALERT_INBOX_LOST];
+    const uint8_t n = lost(gone, ALERT_INBOX_LOST);
+    if (!n)
+      return;
+    printfTo(out, "[INBOX] Last lost:");
+    for (uint8_t i = 0; i < n; i++)
+      printfTo(out, " TX #%03u code %u%s", gone[i].deviceId,
+               gone[i].alertIndex, i + 1 < n ? "," : "\n");
+  }
+
+private:
+  int indexOf(uint32_t id) const {
+    for (uint8_t i = 0; i < size_; i++) {
+      if (heap_[i].id == id)
+        return i;
+    }
+    return -1;
+  }
+
+  /** The entry every other one comes before: one of the leaves. */
+  uint8_t leastUrgent() const {
+    uint8_t worst = size_ / 2;
+    for (uint8_t i = worst + 1; i < size_; i++) {
+      if (inboxBefore(heap_[worst], heap_[i]))
+        worst = i;
+    }
+    return worst;
+  }
+
+  void noteLost(const InboxAlert &a, uint32_t nowMs) {
+    InboxLost &l = lost_[lostNext_];
+    l.lostMs = nowMs;
+    l.deviceId = a.deviceId;
+    l.alertIndex = a.alertIndex;
+    l.priority = a.priority;
+    lostNext_ = (uint8_t)((lostNext_ + 1) % ALERT_INBOX_LOST);
+  }
+
+  void removeAt(uint8_t i) {
+    heap_[i] = heap_[--size_];
+    if (i < size_) {
+      siftUp(i);
+      siftDown(i);
+    }
+  }
+
+  void siftUp(uint8_t i) {
+    while (i > 0) {
+      const uint8_t parent = (i - 1) / 2;
+      if (!inboxBefore(heap_[i], heap_[parent]))
+        break;
+      swap(i, parent);
+      i = parent;
+    }
+  }
+
+  void siftDown(uint8_t i) {
+    for (;;) {
+      const uint8_t l = 2 * i + 1, r = l + 1;
+      uint8_t m = i;
+      if (l < size_ && inboxBefore(heap_[l], heap_[m]))
+        m = l;
+      if (r < size_ && inboxBefore(heap_[r], heap_[m]))
+        m = r;
+      if (m == i)
+        return;
+      swap(i, m);
+      i = m;
+    }
+  }
+
+  void swap(uint8_t a, uint8_t b) {
+    const InboxAlert t = heap_[a];
+    heap_[a] = heap_[b];
+    heap_[b] = t;
+  }
+
+  InboxAlert heap_[SLOTS];
+  InboxLost lost_[ALERT_INBOX_LOST];
+  uint8_t lostNext_ = 0; // Where the next lost alert goes
+  uint8_t size_ = 0;
+  uint32_t nextId_ = 1;
+  uint32_t version_ = 0;
+  Stats stats_;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_ALERT_INBOX_H
@@ -0,0 +1,296 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                LIFELINE CORE - CRASH-SAFE ALERT JOURNAL
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * A confirmed SOS is written to RTC slow memory (RTC_NOINIT) before the radio
+ * is touched and cleared only after TxDone. RTC_NOINIT survives brownout,
+ * watchdog, panic and software resets, so an alert interrupted anywhere
+ * between the confirm key and endPacket() is found again on the next boot
+ * and resumed before the UI starts.
+ *
+ *   confirm ──► arm(seq) ──► endPacket() ──► sent()
+ *                  │                            ▲
+ *                  └── reset ──► boot: pending() ┘ resume
+ *
+ * Both RTC blocks carry a CRC32, so the random contents after a cold
+ * power-on are recognised and discarded. Every alert gets a 16-bit sequence
+ * number that is reused for retries and resumes and sent as ";s=<seq>".
+ * A receiver that already saw the frame drops the repeat with a
+ * DuplicateFilter, so resuming is always safe even if the frame made it out
+ * just before the reset.
+ *
+ * Reset reasons are counted per cause since the last cold power-on.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_ALERT_JOURNAL_H
+#define LIFELINE_ALERT_JOURNAL_H
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include <esp_attr.h>
+#include <esp_system.h>
+#define LIFELINE_RTC_NOINIT RTC_NOINIT_ATTR
+#else
+#define LIFELINE_RTC_NOINIT
+#endif
+
+#ifndef JOURNAL_MAX_RESUMES
+#define JOURNAL_MAX_RESUMES 3 // Boots that may resume one alert (stops loops)
+#endif
+#ifndef DEDUPE_SLOTS
+#define DEDUPE_SLOTS 16 // (device, seq) pairs remembered by the RX
+#endif
+#ifndef DEDUPE_WINDOW_MS
+#define DEDUPE_WINDOW_MS 120000 // Repeats inside this window are dropped
+#endif
+
+namespace lifeline {
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                 CRC32
+// ═══════════════════════════════════════════════════════════════════════════
+
+/** IEEE 802.3 CRC32, bitwise (the blocks are a few dozen bytes). */
+inline uint32_t crc32(const void *data, size_t len, uint32_t crc = 0) {
+  const uint8_t *p = (const uint8_t *)data;
+  crc = ~crc;
+  while (len--) {
+    crc ^= *p++;
+    for (uint8_t b = 0; b < 8; b++)
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1)));
+  }
+  return ~crc;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              RESET REASONS
+// ═══════════════════════════════════════════════════════════════════════════
+
+#define RESET_REASON_SLOTS 16
+
+/** Indexed by esp_reset_reason_t; later IDF causes fold into "unknown". */
+static const char *const resetReasonNames[RESET_REASON_SLOTS] = {
+    "unknown",  "poweron",  "external", "software",   "panic",     "int_wdt",
+    "task_wdt", "wdt",      "deepsleep", "brownout",  "sdio",      "usb",
+    "jtag",     "efuse",    "pwr_glitch", "cpu_lockup"};
+
+enum : uint8_t { RESET_UNKNOWN = 0, RESET_POWERON = 1 };
+
+inline uint8_t platformResetReason() {
+#if defined(ESP_PLATFORM)
+  const int r = (int)esp_reset_reason();
+  return (r >= 0 && r < RESET_REASON_SLOTS) ? (uint8_t)r : RESET_UNKNOWN;
+#else
+  return RESET_UNKNOWN;
+#endif
+}
+
+inline uint32_t platformRandom() {
+#if defined(ESP_PLATFORM)
+  return esp_random();
+#else
+  return micros();
+#endif
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              RTC LAYOUT
+// ═══════════════════════════════════════════════════════════════════════════
+
+enum PendingState : uint8_t { PENDING_NONE, PENDING_ARMED };
+
+/**
+ * Lives in RTC_NOINIT memory; declare one per sketch:
+ *   LIFELINE_RTC_NOINIT lifeline::RtcJournal rtcJournal;
+ */
+struct RtcJournal {
+  struct Alert {
+    uint32_t magic;
+    uint16_t seq;
+    uint8_t alertIndex;
+    uint8_t state;   // PendingState
+    uint8_t resumes; // Boots that already tried to resume this alert
+    uint8_t reserved[3];
+    uint32_t crc;
+  } alert;
+
+  struct Boot {
+    uint32_t magic;
+    uint32_t boots;
+    uint16_t nextSeq;
+    uint16_t resets[RESET_REASON_SLOTS];
+    uint16_t reserved;
+    uint32_t crc;
+  } boot;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                JOURNAL
+// ═══════════════════════════════════════════════════════════════════════════
+
+class AlertJournal {
+public:
+  explicit AlertJournal(RtcJournal &store) : rtc_(&store) {}
+
+  /** Validate both blocks and count this reset. Call first in setup(). */
+  uint8_t begin(uint8_t reason = platformResetReason()) {
+    reason_ = reason < RESET_REASON_SLOTS ? reason : (uint8_t)RESET_UNKNOWN;
+
+    RtcJournal::Boot &b = rtc_->boot;
+    if (b.magic != BOOT_MAGIC || b.crc != blockCrc(b)) {
+      memset(&b, 0, sizeof(b));
+      b.magic = BOOT_MAGIC;
+      b.nextSeq = (uint16_t)platformRandom(); // Avoid RX dedupe hits after power loss
+    }
+    b.boots++;
+    b.resets[reason_]++;
+    seal(b);
+
+    RtcJournal::Alert &a = rtc_->alert;
+    if (a.magic != ALERT_MAGIC || a.crc != blockCrc(a) ||
+        a.state > PENDING_ARMED) {
+      clear();
+    } else if (a.state == PENDING_ARMED) {
+      recovered_ = true;
+      if (a.resumes >= JOURNAL_MAX_RESUMES) {
+        abandoned_ = true; // Sending it keeps crashing the unit
+        clear();
+      } else {
+        a.resumes++;
+        seal(a);
+      }
+    }
+    return reason_;
+  }
+
+  uint8_t resetReason() const { return reason_; }
+  const char *resetReasonName() const { return resetReasonNames[reason_]; }
+  uint32_t boots() const { return rtc_->boot.boots; }
+  uint16_t resets(uint8_t reason) const {
+    return reason < RESET_REASON_SLOTS ? rtc_->boot.resets[reason] : 0;
+  }
+
+  /** An alert is armed but TxDone was never seen. */
+  bool pending() const { return rtc_->alert.state == PENDING_ARMED; }
+  /** begin() found an interrupted alert (resumable or abandoned). */
+  bool recovered() const { return recovered_; }
+  bool abandoned() const { return abandoned_; }
+  uint8_t pendingAlert() const { return rtc_->alert.alertIndex; }
+  uint8_t resumes() const { return rtc_->alert.resumes; }
+
+  /** Sequence number of the armed (or last armed) alert. */
+  uint16_t seq() const { return rtc_->alert.seq; }
+
+  /** Journal a newly confirmed alert under a fresh sequence number. */
+  uint16_t arm(uint8_t alertIndex) {
+    RtcJournal::Boot &b = rtc_->boot;
+    RtcJournal::Alert &a = rtc_->alert;
+    a.magic = ALERT_MAGIC;
+    a.seq = b.nextSeq++;
+    a.alertIndex = alertIndex;
+    a.state = PENDING_ARMED;
+    a.resumes = 0;
+    seal(a);
+    seal(b);
+    return a.seq;
+  }
+
+  /** TxDone seen: nothing left to resume. */
+  void sent() { clear(); }
+
+  /** Operator gave up on a failed alert. */
+  void cancel() { clear(); }
+
+  void printReport(Print &out) const {
+    out.printf("[RESET] boot #%lu, reason %s\n", (unsigned long)boots(),
+               resetReasonName());
+    out.printf("[RESET] since power-on:");
+    for (uint8_t r = 0; r < RESET_REASON_SLOTS; r++) {
+      if (rtc_->boot.resets[r])
+        out.printf(" %s=%u", resetReasonNames[r], rtc_->boot.resets[r]);
+    }
+    out.println();
+    if (pending())
+      out.printf("[RESET] pending alert %u (s=%u, resume %u/%u)\n",
+                 pendingAlert(), seq(), resumes(), JOURNAL_MAX_RESUMES);
+  }
+
+private:
+  static const uint32_t ALERT_MAGIC = 0x4C4C4A41UL; // "AJLL"
+  static const uint32_t BOOT_MAGIC = 0x4C4C4A42UL;  // "BJLL"
+
+  template <typename T> static uint32_t blockCrc(const T &block) {
+    return crc32(&block, offsetof(T, crc));
+  }
+  template <typename T> static void seal(T &block) {
+    block.crc = blockCrc(block);
+  }
+
+  void clear() {
+    RtcJournal::Alert &a = rtc_->alert;
+    const uint16_t lastSeq = a.seq;
+    memset(&a, 0, sizeof(a));
+    a.magic = ALERT_MAGIC;
+    a.seq = lastSeq;
+    a.state = PENDING_NONE;
+    seal(a);
+  }
+
+  RtcJournal *rtc_;
+  uint8_t reason_ = RESET_UNKNOWN;
+  bool recovered_ = false;
+  bool abandoned_ = false;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                            RX DUPLICATE FILTER
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * Remembers the last DEDUPE_SLOTS (device, seq) pairs so a resumed or retried
+ * frame that already arrived is not shown or uplinked twice.
+ */
+class DuplicateFilter {
+public:
+  /** True when the pair was seen within the window; otherwise records it. */
+  bool seen(uint16_t deviceId, uint16_t seq, uint32_t nowMs = millis()) {
+    for (uint8_t i = 0; i < DEDUPE_SLOTS; i++) {
+      const Entry &e = entries_[i];
+      if (e.used && e.deviceId == deviceId && e.seq == seq &&
+          nowMs - e.ms < DEDUPE_WINDOW_MS) {
+        dropped_++;
+        return true;
+      }
+    }
+    Entry &slot = entries_[next_];
+    next_ = (uint8_t)((next_ + 1) % DEDUPE_SLOTS);
+    slot.deviceId = deviceId;
+    slot.seq = seq;
+    slot.ms = nowMs;
+    slot.used = true;
+    return false;
+  }
+
+  uint32_t dropped() const { return dropped_; }
+
+private:
+  struct Entry {
+    uint16_t deviceId;
+    uint16_t seq;
+    uint32_t ms;
+    bool used;
+  };
+  Entry entries_[DEDUPE_SLOTS] = {};
+  uint8_t next_ = 0;
+  uint32_t dropped_ = 0;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_ALERT_JOURNAL_H
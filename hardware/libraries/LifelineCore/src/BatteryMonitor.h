@@ -0,0 +1,246 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                 LIFELINE CORE - BATTERY MONITOR & POWER TIERS
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Reads the pack through a resistor divider on an ADC1 pin, calibrated with
+ * the eFuse Vref (or Two Point values) via esp_adc_cal, oversampled and
+ * smoothed, then mapped to state of charge through a Li-ion discharge curve.
+ *
+ * State of charge selects a power tier. Each tier is a PowerPolicy the
+ * sketch applies to its non-essential work: animations, NeoPixel duty,
+ * heartbeat period and the heartbeat radio profile. SOS transmissions never
+ * consult the policy and always go out at full configured power.
+ *
+ *   NORMAL ──► SAVER (<30%) ──► LOW (<15%) ──► CRITICAL (<5%)
+ *
+ * Tiers step back up only after the charge recovers by the hysteresis
+ * margin, so a sagging cell under TX load does not make the UI flicker.
+ * A reading outside the plausible Li-ion window means "no battery" (USB).
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_BATTERY_MONITOR_H
+#define LIFELINE_BATTERY_MONITOR_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#if defined(ESP_PLATFORM)
+#include <esp_adc_cal.h>
+#endif
+
+#ifndef BATTERY_SAVER_PCT
+#define BATTERY_SAVER_PCT 30 // Enter SAVER below this charge (%)
+#endif
+#ifndef BATTERY_LOW_PCT
+#define BATTERY_LOW_PCT 15 // Enter LOW below this charge (%)
+#endif
+#ifndef BATTERY_CRITICAL_PCT
+#define BATTERY_CRITICAL_PCT 5 // Enter CRITICAL below this charge (%)
+#endif
+#ifndef BATTERY_TIER_HYSTERESIS
+#define BATTERY_TIER_HYSTERESIS 3 // Recovery margin before stepping up (%)
+#endif
+#ifndef BATTERY_SAMPLE_INTERVAL
+#define BATTERY_SAMPLE_INTERVAL 1000 // Time between filtered samples (ms)
+#endif
+#ifndef BATTERY_OVERSAMPLE
+#define BATTERY_OVERSAMPLE 16 // Raw ADC reads averaged per sample
+#endif
+
+namespace lifeline {
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                              POWER TIERS
+// ═══════════════════════════════════════════════════════════════════════════
+
+enum PowerTier : uint8_t { POWER_NORMAL, POWER_SAVER, POWER_LOW, POWER_CRITICAL };
+
+static const char *const powerTierNames[] = {"NORMAL", "SAVER", "LOW",
+                                             "CRITICAL"};
+
+/** What a sketch may spend on non-essential work in a tier. */
+struct PowerPolicy {
+  uint8_t animationLevel;   // 2 = full, 1 = reduced rate, 0 = off
+  uint16_t strobePeriodMs;  // NeoPixel flash period, 0 = off
+  uint8_t strobeOnMs;       // NeoPixel flash length
+  uint8_t heartbeatScale;   // Heartbeat period multiplier, 0 = no heartbeats
+  int8_t heartbeatTxPower;  // dBm for heartbeats (SOS ignores this)
+  bool radioSleep;          // Put the radio to sleep between transmissions
+  bool uiTones;             // Navigation/click tones
+};
+
+static const PowerPolicy powerPolicies[] = {
+    {2, 1000, 80, 1, 17, false, true},  // NORMAL
+    {1, 3000, 60, 2, 14, true, true},   // SAVER
+    {0, 10000, 40, 4, 10, true, false}, // LOW
+    {0, 0, 0, 0, 10, true, false},      // CRITICAL - SOS only
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                           DISCHARGE CURVE
+// ═══════════════════════════════════════════════════════════════════════════
+
+struct SocPoint {
+  uint16_t mV;
+  uint8_t pct;
+};
+
+/** Single Li-ion/LiPo cell at light load, highest voltage first. */
+static const SocPoint liIonDischargeCurve[] = {
+    {4200, 100}, {4150, 95}, {4110, 90}, {4080, 85}, {4020, 80}, {3980, 75},
+    {3950, 70},  {3910, 65}, {3870, 60}, {3850, 55}, {3840, 50}, {3820, 45},
+    {3800, 40},  {3790, 35}, {3770, 30}, {3750, 25}, {3730, 20}, {3710, 15},
+    {3690, 10},  {3610, 5},  {3270, 0}};
+
+/** Piecewise-linear state of charge from a cell voltage. */
+inline uint8_t socFromMillivolts(
+    uint16_t mV, const SocPoint *curve = liIonDischargeCurve,
+    uint8_t points = sizeof(liIonDischargeCurve) / sizeof(SocPoint)) {
+  if (mV >= curve[0].mV)
+    return curve[0].pct;
+  for (uint8_t i = 1; i < points; i++) {
+    if (mV >= curve[i].mV) {
+      const SocPoint &hi = curve[i - 1];
+      const SocPoint &lo = curve[i];
+      return lo.pct + (uint8_t)((uint32_t)(mV - lo.mV) * (hi.pct - lo.pct) /
+                                (hi.mV - lo.mV));
+    }
+  }
+  return curve[points - 1].pct;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                MONITOR
+// ═══════════════════════════════════════════════════════════════════════════
+
+class BatteryMonitor {
+public:
+  /** pin < 0 disables measurement (no free ADC pin / USB-only build). */
+  BatteryMonitor(int8_t pin, float dividerRatio)
+      : pin_(pin), divider_(dividerRatio) {}
+
+  bool begin() {
+    if (pin_ < 0)
+      return false;
+#if defined(ESP_PLATFORM)
+    analogReadResolution(12);
+    analogSetPinAttenuation(pin_, ADC_11db);
+    const esp_adc_cal_value_t src = esp_adc_cal_characterize(
+        ADC_UNIT_1, ADC_ATTEN_DB_11, ADC_WIDTH_BIT_12, 1100, &chars_);
+    vrefSource_ = (src == ESP_ADC_CAL_VAL_EFUSE_TP)     ? "eFuse Two Point"
+                  : (src == ESP_ADC_CAL_VAL_EFUSE_VREF) ? "eFuse Vref"
+                                                        : "default 1100mV";
+#endif
+    sample();
+    return true;
+  }
+
+  /** Take a filtered sample when due and re-evaluate the tier. */
+  void update(uint32_t nowMs = millis()) {
+    if (pin_ < 0 || nowMs - lastSampleMs_ < BATTERY_SAMPLE_INTERVAL)
+      return;
+    lastSampleMs_ = nowMs;
+    sample();
+  }
+
+  bool present() const {
+    return pin_ >= 0 && filteredMv_ >= 2500 && filteredMv_ <= 4500;
+  }
+  uint16_t millivolts() const { return present() ? filteredMv_ : 0; }
+  int8_t percent() const {
+    return present() ? (int8_t)socFromMillivolts(filteredMv_) : -1;
+  }
+  const char *vrefSource() const { return vrefSource_; }
+
+  PowerTier tier() const { return tier_; }
+  const PowerPolicy &policy() const { return powerPolicies[tier_]; }
+
+  /** True once after every tier change. */
+  bool tierChanged() {
+    const bool changed = tierChanged_;
+    tierChanged_ = false;
+    return changed;
+  }
+
+  /** Pin a tier for testing; pass -1 to return to automatic selection. */
+  void forceTier(int8_t tier) {
+    forced_ = tier;
+    if (tier >= 0 && tier <= POWER_CRITICAL)
+      setTier((PowerTier)tier);
+    else
+      evaluateTier();
+  }
+
+private:
+  void sample() {
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < BATTERY_OVERSAMPLE; i++) {
+      sum += analogRead(pin_);
+    }
+    const uint32_t raw = sum / BATTERY_OVERSAMPLE;
+#if defined(ESP_PLATFORM)
+    const uint32_t pinMv = esp_adc_cal_raw_to_voltage(raw, &chars_);
+#else
+    const uint32_t pinMv = raw * 3300UL / 4095UL;
+#endif
+    const uint32_t mv = (uint32_t)((float)pinMv * divider_);
+
+    // EMA with alpha 1/8 kept in 1/8 mV to avoid drift
+    if (!seeded_) {
+      emaMv8_ = mv << 3;
+      seeded_ = true;
+    } else {
+      emaMv8_ += mv - (emaMv8_ >> 3);
+    }
+    filteredMv_ = (uint16_t)(emaMv8_ >> 3);
+    evaluateTier();
+  }
+
+  void evaluateTier() {
+    if (forced_ >= 0)
+      return;
+    const int8_t pct = percent();
+    if (pct < 0) {
+      setTier(POWER_NORMAL);
+      return;
+    }
+    static const uint8_t enter[] = {101, BATTERY_SAVER_PCT, BATTERY_LOW_PCT,
+                                    BATTERY_CRITICAL_PCT};
+    PowerTier next = tier_;
+    // Step down as soon as the charge crosses a threshold
+    while (next < POWER_CRITICAL && pct < enter[next + 1])
+      next = (PowerTier)(next + 1);
+    // Step up only with hysteresis
+    while (next > POWER_NORMAL &&
+           pct >= enter[next] + BATTERY_TIER_HYSTERESIS)
+      next = (PowerTier)(next - 1);
+    setTier(next);
+  }
+
+  void setTier(PowerTier t) {
+    if (t != tier_) {
+      tier_ = t;
+      tierChanged_ = true;
+    }
+  }
+
+  int8_t pin_;
+  float divider_;
+#if defined(ESP_PLATFORM)
+  esp_adc_cal_characteristics_t chars_ = {};
+#endif
+  const char *vrefSource_ = "none";
+  uint32_t lastSampleMs_ = 0;
+  uint32_t emaMv8_ = 0;
+  uint16_t filteredMv_ = 0;
+  bool seeded_ = false;
+  PowerTier tier_ = POWER_NORMAL;
+  bool tierChanged_ = false;
+  int8_t forced_ = -1;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_BATTERY_MONITOR_H
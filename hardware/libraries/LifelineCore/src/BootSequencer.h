@@ -0,0 +1,184 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                    LIFELINE CORE - BOOT SEQUENCER
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Most of a cold boot is spent waiting on datasheet timers: panel reset and
+ * sleep-out, radio reset, sensor wake-up. The sequencer runs each peripheral's
+ * bring-up as a task of short phases. A phase does its bus work and returns
+ * how long the hardware needs before the next phase. Other tasks run in the
+ * gaps, so boot time approaches the longest chain instead of the sum.
+ *
+ *   panel  RST─150─RST─150─SWRESET─150─SLPOUT─150─config
+ *   radio     reset─10─begin─config
+ *   sensor       begin
+ *
+ * Phases run to completion, one at a time, on the loop task. Tasks that
+ * share a bus never interleave inside a transaction.
+ *
+ * Milestones ("radio", "idle", "first alert", ...) record the millis() at
+ * which the unit reached them, so the serial report shows what power-on to
+ * first reception actually costs.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_BOOT_SEQUENCER_H
+#define LIFELINE_BOOT_SEQUENCER_H
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef BOOT_MAX_TASKS
+#define BOOT_MAX_TASKS 4 // Concurrent bring-up tasks
+#endif
+#ifndef BOOT_MAX_MILESTONES
+#define BOOT_MAX_MILESTONES 6 // Named timestamps in the boot report
+#endif
+
+namespace lifeline {
+
+/** Returned by a step when its task has finished. */
+static const int32_t BOOT_DONE = -1;
+
+/**
+ * One phase of a bring-up task. Does the work for `phase` (0, 1, 2, ...)
+ * and returns the milliseconds to wait before the next phase, or BOOT_DONE.
+ */
+typedef int32_t (*BootStep)(uint8_t phase);
+
+class BootSequencer {
+public:
+  /** Register a task; returns its id (-1 when the table is full). */
+  int8_t add(const char *name, BootStep step) {
+    if (taskCount_ >= BOOT_MAX_TASKS)
+      return -1;
+    Task &t = tasks_[taskCount_];
+    t.name = name;
+    t.step = step;
+    t.phase = 0;
+    t.wakeMs = millis();
+    t.doneMs = 0;
+    t.busyUs = 0;
+    t.done = false;
+    return (int8_t)taskCount_++;
+  }
+
+  /** Run every task that is due once. True when all tasks have finished. */
+  bool poll(uint32_t nowMs = millis()) {
+    bool all = true;
+    for (uint8_t i = 0; i < taskCount_; i++) {
+      Task &t = tasks_[i];
+      if (t.done)
+        continue;
+      if ((int32_t)(nowMs - t.wakeMs) >= 0) {
+        const uint32_t startUs = micros();
+        const int32_t waitMs = t.step(t.phase++);
+        t.busyUs += micros() - startUs;
+        nowMs = millis();
+        if (waitMs == BOOT_DONE) {
+          t.done = true;
+          t.doneMs = nowMs;
+          continue;
+        }
+        t.wakeMs = nowMs + (uint32_t)waitMs;
+      }
+      all = false;
+    }
+    return all;
+  }
+
+  /** Spin on poll() until one task (or every task, id -1) has finished. */
+  void runUntil(int8_t id = -1) {
+    for (;;) {
+      const bool all = poll();
+      if (id < 0 ? all : done(id))
+        return;
+      yield();
+    }
+  }
+
+  bool done(int8_t id) const {
+    return id >= 0 && id < taskCount_ && tasks_[id].done;
+  }
+  bool allDone() const {
+    for (uint8_t i = 0; i < taskCount_; i++) {
+      if (!tasks_[i].done)
+        return false;
+    }
+    return true;
+  }
+
+  /** Phases the task has started so far (lets one task wait for another). */
+  uint8_t phase(int8_t id) const {
+    return (id >= 0 && id < taskCount_) ? tasks_[id].phase : 0;
+  }
+
+  /** millis() when the task finished (0 while still running). */
+  uint32_t doneAtMs(int8_t id) const {
+    return (id >= 0 && id < taskCount_) ? tasks_[id].doneMs : 0;
+  }
+
+  /** Remember when the unit reached a point of interest (first call wins). */
+  void mark(const char *name, uint32_t nowMs = millis()) {
+    for (uint8_t i = 0; i < markCount_; i++) {
+      if (strcmp(marks_[i].name, name) == 0)
+        return;
+    }
+    if (markCount_ >= BOOT_MAX_MILESTONES)
+      return;
+    marks_[markCount_].name = name;
+    marks_[markCount_].ms = nowMs;
+    markCount_++;
+  }
+
+  /** Milestone timestamp, or 0 when it has not been reached yet. */
+  uint32_t markMs(const char *name) const {
+    for (uint8_t i = 0; i < markCount_; i++) {
+      if (strcmp(marks_[i].name, name) == 0)
+        return marks_[i].ms;
+    }
+    return 0;
+  }
+
+  void printReport(Print &out) const {
+    out.println(F("[BOOT] task        done at   busy   phases"));
+    for (uint8_t i = 0; i < taskCount_; i++) {
+      const Task &t = tasks_[i];
+      if (t.done)
+        out.printf("[BOOT] %-10s %6lu ms %4lu ms %5u\n", t.name,
+                   (unsigned long)t.doneMs,
+                   (unsigned long)((t.busyUs + 500) / 1000), t.phase);
+      else
+        out.printf("[BOOT] %-10s   (running, phase %u)\n", t.name, t.phase);
+    }
+    for (uint8_t i = 0; i < markCount_; i++) {
+      out.printf("[BOOT] %-10s %6lu ms since boot\n", marks_[i].name,
+                 (unsigned long)marks_[i].ms);
+    }
+  }
+
+private:
+  struct Task {
+    const char *name;
+    BootStep step;
+    uint8_t phase;
+    uint32_t wakeMs;
+    uint32_t doneMs;
+    uint32_t busyUs;
+    bool done;
+  };
+  struct Milestone {
+    const char *name;
+    uint32_t ms;
+  };
+
+  Task tasks_[BOOT_MAX_TASKS] = {};
+  uint8_t taskCount_ = 0;
+  Milestone marks_[BOOT_MAX_MILESTONES] = {};
+  uint8_t markCount_ = 0;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_BOOT_SEQUENCER_H
@@ -0,0 +1,235 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                 LIFELINE CORE - GATEWAY DEVICE REGISTRY CACHE
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * API/Create/message.php turns away an alert from a DID that is not in the
+ * devices table. The gateway keeps a copy of the registered DIDs, so it
+ * knows before the uplink that a newly deployed handheld is not registered
+ * yet and can send its first alert on the auto-register lane (UplinkLane.h).
+ *
+ *   lifeline::DeviceRegistry<> registry;
+ *   // GET API/Read/registry.php, If-None-Match: registry.etag()
+ *   if (status == 200) registry.load(body, len, etagHeader, millis());
+ *   if (status == 304) registry.notModified(millis());
+ *   if (registry.lookup(did) == lifeline::DEVICE_UNKNOWN) ...
+ *
+ *   Sync     The body is {"data":{"dids":[1,2,3,...]}} and the reply
+ *            carries an ETag. The next fetch sends it back as If-None-Match;
+ *            while the registry is unchanged the server answers 304 with no
+ *            body, so a re-check costs a few hundred bytes.
+ *   Lookup   Binary search over the sorted DIDs. Before the first sync
+ *            every DID is DEVICE_UNSURE: the uplink goes out as usual and a
+ *            404 moves it to the auto-register lane.
+ *   Load     A body that does not parse, or has more than REGISTRY_MAX
+ *            DIDs, leaves the cache as it was.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_DEVICE_REGISTRY_H
+#define LIFELINE_DEVICE_REGISTRY_H
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "MemoryBudget.h"
+
+#ifndef REGISTRY_MAX
+#define REGISTRY_MAX 512 // Registered DIDs cached (2 bytes each)
+#endif
+#ifndef REGISTRY_ETAG_MAX
+#define REGISTRY_ETAG_MAX 48
+#endif
+
+namespace lifeline {
+
+enum DeviceKnown : uint8_t {
+  DEVICE_UNSURE,  // No registry yet
+  DEVICE_KNOWN,
+  DEVICE_UNKNOWN, // Not registered when the registry was last fetched
+};
+
+template <uint16_t MAX = REGISTRY_MAX> class DeviceRegistry {
+public:
+  struct Stats {
+    uint32_t loads = 0;       // 200 with a new list
+    uint32_t notModified = 0; // 304
+    uint32_t rejected = 0;    // Bodies that did not parse or fit
+    uint32_t learned = 0;     // Added by add() between fetches
+  };
+
+  DeviceKnown lookup(uint16_t did) const {
+    if (!synced_)
+      return DEVICE_UNSURE;
+    return indexOf(did) >= 0 ? DEVICE_KNOWN : DEVICE_UNKNOWN;
+  }
+
+  /**
+   * Replace the list with the "dids" array of a 200 reply. etag may be
+   * nullptr or empty (the next fetch is then unconditional).
+   */
+  bool load(const char *body, size_t len, const char *etag, uint32_t nowMs) {
+    const char *p = findArray(body, len);
+    if (!p) {
+      stats_.rejected++;
+      return false;
+    }
+    const char *end = body + len;
+    // Check the whole array before touching the cache
+    uint16_t n = 0;
+    if (!parseArray(p, end, nullptr, n)) {
+      stats_.rejected++;
+      return false;
+    }
+    parseArray(p, end, dids_, n);
+    count_ = n;
+    sort();
+    etag_ = etag ? etag : "";
+    if (etag_.truncated())
+      etag_.clear(); // A cut tag never matches: fetch in full next time
+    synced_ = true;
+    syncedMs_ = nowMs;
+    stats_.loads++;
+    return true;
+  }
+
+  /** A 304: the list is still current. */
+  void notModified(uint32_t nowMs) {
+    syncedMs_ = nowMs;
+    stats_.notModified++;
+  }
+
+  /** A DID the server registered since the fetch (auto-register). */
+  bool add(uint16_t did) {
+    if (indexOf(did) >= 0)
+      return true;
+    if (count_ >= MAX)
+      return false;
+    uint16_t i = count_++;
+    while (i > 0 && dids_[i - 1] > did) {
+      dids_[i] = dids_[i - 1];
+      i--;
+    }
+    dids_[i] = did;
+    stats_.learned++;
+    return true;
+  }
+
+  /** For If-None-Match; empty before the first sync. */
+  const char *etag() const { return etag_.c_str(); }
+  bool synced() const { return synced_; }
+  uint32_t syncedMs() const { return syncedMs_; }
+  uint16_t size() const { return count_; }
+  static constexpr uint16_t capacity() { return MAX; }
+  const Stats &stats() const { return stats_; }
+
+  void printReport(Print &out, uint32_t nowMs) const {
+    if (!synced_) {
+      printfTo(out, "[REG] Not synced yet; %lu bodies rejected\n",
+               (unsigned long)stats_.rejected);
+      return;
+    }
+    printfTo(out, "[REG] %u of %u DIDs, etag %s, checked %lu s ago; %lu "
+                  "loads, %lu not modified, %lu learned, %lu rejected\n",
+             count_, MAX, etag_.length() ? etag_.c_str() : "-",
+             (unsigned long)((nowMs - syncedMs_) / 1000),
+             (unsigned long)stats_.loads, (unsigned long)stats_.notModified,
+             (unsigned long)stats_.learned, (unsigned long)stats_.rejected);
+  }
+
+private:
+  int indexOf(uint16_t did) const {
+    int lo = 0, hi = (int)count_ - 1;
+    while (lo <= hi) {
+      const int mid = (lo + hi) / 2;
+      if (dids_[mid] == did)
+        return mid;
+      if (dids_[mid] < did)
+        lo = mid + 1;
+      else
+        hi = mid - 1;
+    }
+    return -1;
+  }
+
+  /** Just past the '[' of "dids", or nullptr. */
+  static const char *findArray(const char *body, size_t len) {
+    static const char KEY[] = "\"dids\"";
+    const size_t k = sizeof(KEY) - 1;
+    for (size_t i = 0; i + k <= len; i++) {
+      if (memcmp(body + i, KEY, k))
+        continue;
+      const char *p = body + i + k;
+      const char *end = body + len;
+      while (p < end && (*p == ' ' || *p == ':'))
+        p++;
+      return p < end && *p == '[' ? p + 1 : nullptr;
+    }
+    return nullptr;
+  }
+
+  /** Numbers up to ']'. out == nullptr only counts and checks. */
+  static bool parseArray(const char *p, const char *end, uint16_t *out,
+                         uint16_t &n) {
+    n = 0;
+    bool digits = false, comma = true;
+    uint32_t v = 0;
+    for (; p < end; p++) {
+      const char c = *p;
+      if (c >= '0' && c <= '9') {
+        if (!comma)
+          return false;
+        v = v * 10 + (uint32_t)(c - '0');
+        if (v > 0xFFFF)
+          return false;
+        digits = true;
+      } else if (c == ',' || c == ']') {
+        if (digits) {
+          if (n >= MAX)
+            return false;
+          if (out)
+            out[n] = (uint16_t)v;
+          n++;
+        } else if (c == ',' || n > 0) {
+          return false; // ",," or "1,]"
+        }
+        if (c == ']')
+          return true;
+        v = 0;
+        digits = false;
+        comma = true;
+      } else if (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+        if (digits)
+          comma = false; // "1 2" is not a list
+      } else {
+        return false;
+      }
+    }
+    return false;
+  }
+
+  /** The server sends them in order; anything else is sorted here. */
+  void sort() {
+    for (uint16_t i = 1; i < count_; i++) {
+      const uint16_t d = dids_[i];
+      uint16_t j = i;
+      while (j > 0 && dids_[j - 1] > d) {
+        dids_[j] = dids_[j - 1];
+        j--;
+      }
+      dids_[j] = d;
+    }
+  }
+
+  uint16_t dids_[MAX];
+  uint16_t count_ = 0;
+  bool synced_ = false;
+  uint32_t syncedMs_ = 0;
+  FixedString<REGISTRY_ETAG_MAX> etag_;
+  Stats stats_;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_DEVICE_REGISTRY_H
@@ -0,0 +1,205 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                   LIFELINE CORE - ENERGY ACCOUNTING
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Time-in-state counters per subsystem, folded through a calibration table
+ * (mA per state) into charge used, average current and projected runtime.
+ *
+ *   RADIO     sleep / standby / rx / tx
+ *   DISPLAY   off / on
+ *   CPU       light sleep / idle (WFI in delay) / active
+ *   NEOPIXEL  off / on
+ *   BUZZER    off / on
+ *
+ * A transition costs one millis() read and two adds, so the meter stays on
+ * in production builds. Short fire-and-forget loads (tone(), strobe flash)
+ * can be booked with pulse() instead of two transitions.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_ENERGY_METER_H
+#define LIFELINE_ENERGY_METER_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#ifndef ENERGY_BATTERY_MAH
+#define ENERGY_BATTERY_MAH 2000 // Nominal pack capacity for projections
+#endif
+
+namespace lifeline {
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                           SUBSYSTEMS & STATES
+// ═══════════════════════════════════════════════════════════════════════════
+
+enum EnergySubsystem : uint8_t {
+  EN_RADIO,
+  EN_DISPLAY,
+  EN_CPU,
+  EN_NEOPIXEL,
+  EN_BUZZER,
+  EN_SUBSYSTEM_COUNT
+};
+
+#define ENERGY_MAX_STATES 4
+
+enum RadioPowerState : uint8_t { RADIO_SLEEP, RADIO_STANDBY, RADIO_RX, RADIO_TX };
+enum DisplayPowerState : uint8_t { DISPLAY_OFF, DISPLAY_ON };
+enum CpuPowerState : uint8_t { CPU_LIGHT_SLEEP, CPU_IDLE, CPU_ACTIVE };
+enum SwitchPowerState : uint8_t { LOAD_OFF, LOAD_ON };
+
+static const char *const energySubsystemNames[EN_SUBSYSTEM_COUNT] = {
+    "radio", "display", "cpu", "neopixel", "buzzer"};
+
+static const char *const energyStateNames[EN_SUBSYSTEM_COUNT][ENERGY_MAX_STATES] = {
+    {"sleep", "standby", "rx", "tx"},
+    {"off", "on", "", ""},
+    {"lsleep", "idle", "active", ""},
+    {"off", "on", "", ""},
+    {"off", "on", "", ""}};
+
+/**
+ * Supply current per subsystem state in mA, plus a constant board load
+ * (regulator quiescent, sensors). Each sketch carries its own table since
+ * the numbers belong to a hardware configuration, not to the code.
+ */
+struct EnergyCalibration {
+  float mA[EN_SUBSYSTEM_COUNT][ENERGY_MAX_STATES];
+  float baselineMa;
+};
+
+/** Datasheet-typical values; replace with bench measurements per build. */
+static const EnergyCalibration defaultEnergyCalibration = {
+    {
+        {0.0002f, 1.6f, 10.8f, 100.0f}, // SX1278 @ +18 dBm
+        {0.0f, 35.0f, 0.0f, 0.0f},      // 2.8" SPI TFT incl. backlight
+        {0.8f, 27.0f, 50.0f, 0.0f},     // ESP32 @ 240 MHz, WiFi off
+        {0.6f, 18.0f, 0.0f, 0.0f},      // One WS2812 at strobe colour
+        {0.0f, 30.0f, 0.0f, 0.0f},      // Passive buzzer via transistor
+    },
+    2.0f};
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                 METER
+// ═══════════════════════════════════════════════════════════════════════════
+
+class EnergyMeter {
+public:
+  explicit EnergyMeter(const EnergyCalibration &cal = defaultEnergyCalibration)
+      : cal_(&cal) {}
+
+  /** Start counting; every subsystem begins in state 0 unless told. */
+  void begin(uint32_t nowMs = millis()) {
+    startMs_ = nowMs;
+    for (uint8_t s = 0; s < EN_SUBSYSTEM_COUNT; s++) {
+      since_[s] = nowMs;
+    }
+  }
+
+  void set(EnergySubsystem sub, uint8_t state, uint32_t nowMs = millis()) {
+    if (state == state_[sub] || state >= ENERGY_MAX_STATES)
+      return;
+    accMs_[sub][state_[sub]] += (int64_t)(uint32_t)(nowMs - since_[sub]);
+    since_[sub] = nowMs;
+    state_[sub] = state;
+  }
+
+  /** Book a timed load (e.g. tone(pin, f, ms)) without two transitions. */
+  void pulse(EnergySubsystem sub, uint8_t state, uint32_t ms) {
+    if (state == state_[sub] || state >= ENERGY_MAX_STATES)
+      return;
+    accMs_[sub][state] += ms;
+    accMs_[sub][state_[sub]] -= ms;
+  }
+
+  uint8_t state(EnergySubsystem sub) const { return state_[sub]; }
+
+  /** Milliseconds spent in a state, including the running period. */
+  uint64_t timeInState(EnergySubsystem sub, uint8_t state,
+                       uint32_t nowMs = millis()) const {
+    int64_t t = accMs_[sub][state];
+    if (state == state_[sub])
+      t += (uint32_t)(nowMs - since_[sub]);
+    return t > 0 ? (uint64_t)t : 0;
+  }
+
+  uint64_t uptimeMs(uint32_t nowMs = millis()) const {
+    return wrapsMs_ + (uint32_t)(nowMs - startMs_);
+  }
+
+  /** Charge drawn by one subsystem since begin(), in mAh. */
+  float chargeMah(EnergySubsystem sub, uint32_t nowMs = millis()) const {
+    float mAms = 0.0f;
+    for (uint8_t st = 0; st < ENERGY_MAX_STATES; st++) {
+      mAms += (float)timeInState(sub, st, nowMs) * cal_->mA[sub][st];
+    }
+    return mAms / 3.6e6f;
+  }
+
+  float totalChargeMah(uint32_t nowMs = millis()) const {
+    float mah = cal_->baselineMa * (float)uptimeMs(nowMs) / 3.6e6f;
+    for (uint8_t s = 0; s < EN_SUBSYSTEM_COUNT; s++) {
+      mah += chargeMah((EnergySubsystem)s, nowMs);
+    }
+    return mah;
+  }
+
+  float averageMa(uint32_t nowMs = millis()) const {
+    const uint64_t up = uptimeMs(nowMs);
+    return up ? totalChargeMah(nowMs) * 3.6e6f / (float)up : 0.0f;
+  }
+
+  /** Hours left from remainingMah at the average draw so far. */
+  float projectedHours(float remainingMah = ENERGY_BATTERY_MAH,
+                       uint32_t nowMs = millis()) const {
+    const float ma = averageMa(nowMs);
+    return ma > 0.0f ? remainingMah / ma : 0.0f;
+  }
+
+  /**
+   * Fold the running 32-bit millis() period into the 64-bit counters.
+   * Call at least once every 49 days (the loop does it every heartbeat).
+   */
+  void checkpoint(uint32_t nowMs = millis()) {
+    for (uint8_t s = 0; s < EN_SUBSYSTEM_COUNT; s++) {
+      accMs_[s][state_[s]] += (uint32_t)(nowMs - since_[s]);
+      since_[s] = nowMs;
+    }
+    wrapsMs_ += (uint32_t)(nowMs - startMs_);
+    startMs_ = nowMs;
+  }
+
+  void printReport(Print &out, float remainingMah = ENERGY_BATTERY_MAH) const {
+    const uint32_t now = millis();
+    out.printf("[ENERGY] uptime %.1f min, avg %.1f mA, used %.2f mAh\n",
+               uptimeMs(now) / 60000.0, averageMa(now), totalChargeMah(now));
+    for (uint8_t s = 0; s < EN_SUBSYSTEM_COUNT; s++) {
+      const EnergySubsystem sub = (EnergySubsystem)s;
+      out.printf("[ENERGY] %-9s %7.2f mAh |", energySubsystemNames[s],
+                 chargeMah(sub, now));
+      for (uint8_t st = 0; st < ENERGY_MAX_STATES; st++) {
+        if (energyStateNames[s][st][0] == '\0')
+          continue;
+        out.printf(" %s %.1fs", energyStateNames[s][st],
+                   timeInState(sub, st, now) / 1000.0);
+      }
+      out.println();
+    }
+    out.printf("[ENERGY] projected %.1f h on %.0f mAh\n",
+               projectedHours(remainingMah, now), remainingMah);
+  }
+
+private:
+  const EnergyCalibration *cal_;
+  uint32_t startMs_ = 0;
+  uint64_t wrapsMs_ = 0;
+  uint32_t since_[EN_SUBSYSTEM_COUNT] = {};
+  uint8_t state_[EN_SUBSYSTEM_COUNT] = {};
+  int64_t accMs_[EN_SUBSYSTEM_COUNT][ENERGY_MAX_STATES] = {};
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_ENERGY_METER_H
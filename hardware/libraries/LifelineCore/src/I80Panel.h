@@ -0,0 +1,405 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                  LIFELINE CORE - I80 PARALLEL PANEL OVER DMA
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * ParallelBus8 (PinMap.h) bit-bangs the 8080 bus: the CPU sets the data
+ * lines and strobes WR for every byte, so a 480x320 fill costs it 300 KB
+ * of register writes. The ESP32-S3 LCD_CAM peripheral drives the same pins
+ * from GDMA descriptor chains. I80Panel sends the panel's window, fill and
+ * pixel-stream calls through it (ESP-IDF esp_lcd i80 panel IO), with the
+ * same pins and the GPIO path as the fallback:
+ *
+ *   typedef lifeline::ParallelBus8<TFT_WR, TFT_D0, ...> TftBus;
+ *   lifeline::I80Panel<TftBus> tft(TFT_CS, TFT_RS);
+ *   tft.begin();                               // DMA, else GPIO
+ *   tft.command(0x3A, &format, 1);             // init: waits for the bus
+ *   tft.setAddressWindow(x0, y0, x1, y1);      // queued
+ *   tft.fill(color, w * h);                    // returns while it is sent
+ *   tft.pushPixels(line, n);                   // a row of RGB565
+ *   tft.pushStored(frame, n);                  // no copy (ScreenCache.h)
+ *
+ *   Slots        I80_QUEUE_DEPTH + 1 span buffers of I80_SPAN_PIXELS. Each
+ *                transfer takes the next slot. tx_color() blocks while the
+ *                queue is full, so the slot about to be written was sent
+ *                one queue ago: no buffer is rewritten on the bus.
+ *   Fill         A slot already holding the colour is sent again as is.
+ *   Window       CASET/RASET go out as queued transfers, skipped when they
+ *                have not changed. The first span of a window carries
+ *                RAMWR, the others Memory Write Continue (0x3C).
+ *   Memory       I80Memory::INTERNAL (DMA-capable SRAM) or PSRAM. esp_lcd
+ *                writes the cache back before a PSRAM transfer.
+ *   Callback     onIdle() runs in the DMA interrupt when the last queued
+ *                transfer is done.
+ *   Fallback     Without LCD_CAM (SOC_LCD_I80_SUPPORTED), or when the bus
+ *                or the buffers cannot be had, begin() returns false and
+ *                every call goes through Bus::write() as before.
+ *
+ * PCLK is 160 MHz over a whole divider (I80_PCLK_HZ, 20 MHz: the ILI9488
+ * write cycle). command() is for init: it waits until the queue is empty.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_I80_PANEL_H
+#define LIFELINE_I80_PANEL_H
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+
+#include <soc/soc_caps.h>
+#if SOC_LCD_I80_SUPPORTED
+#include <esp_heap_caps.h>
+#include <esp_lcd_panel_io.h>
+#endif
+
+#ifndef I80_PCLK_HZ
+#define I80_PCLK_HZ 20000000 // 8-bit writes: 10 Mpx/s
+#endif
+#ifndef I80_QUEUE_DEPTH
+#define I80_QUEUE_DEPTH 8 // Transfers in flight
+#endif
+#ifndef I80_SPAN_PIXELS
+#define I80_SPAN_PIXELS 1024 // Pixels per slot (2 bytes each)
+#endif
+
+namespace lifeline {
+
+enum class I80Memory : uint8_t { INTERNAL, PSRAM };
+
+template <typename Bus> class I80Panel {
+public:
+  typedef void (*IdleCallback)(void *ctx);
+
+  struct Stats {
+    uint32_t transfers = 0;    // Queued since begin()
+    uint32_t spansWritten = 0; // Slots the CPU filled
+    uint32_t spansReused = 0;  // ... sent again without a rewrite
+    uint32_t spansStored = 0;  // Sent from the caller's memory
+    uint32_t windowsSkipped = 0;
+  };
+
+  I80Panel(int8_t cs, int8_t dc) : cs_(cs), dc_(dc) {}
+
+  /**
+   * Pins, then the LCD_CAM bus and the slot buffers. True when drawing
+   * goes through DMA; false leaves the GPIO path (Bus::write) in charge.
+   */
+  bool begin(I80Memory memory = I80Memory::INTERNAL,
+             uint32_t pclkHz = I80_PCLK_HZ) {
+    pinMode(cs_, OUTPUT);
+    pinMode(dc_, OUTPUT);
+    digitalWrite(cs_, HIGH);
+#if SOC_LCD_I80_SUPPORTED
+    if (beginDma(memory, pclkHz))
+      return true;
+#else
+    (void)memory;
+    (void)pclkHz;
+#endif
+    Bus::begin();
+    return false;
+  }
+
+  bool dma() const { return dma_; }
+  /** PCLK the bus runs at; 0 on the GPIO path. */
+  uint32_t clockHz() const { return dma_ ? hz_ : 0; }
+
+  /** cb(ctx) in the DMA interrupt when the last queued transfer is done. */
+  void onIdle(IdleCallback cb, void *ctx) {
+    idleCb_ = cb;
+    idleCtx_ = ctx;
+  }
+
+  /** Transfers queued and not yet done (0 on the GPIO path). */
+  uint32_t pending() const {
+    return queued_ - done_.load(std::memory_order_acquire);
+  }
+
+  /** A command and its parameters, once the queue is empty. */
+  void command(uint8_t cmd, const uint8_t *params = nullptr, uint8_t n = 0) {
+    if (cmd == 0x2A || cmd == 0x2B)
+      windowValid_ = false;
+#if SOC_LCD_I80_SUPPORTED
+    if (dma_) {
+      esp_lcd_panel_io_tx_param(io_, cmd, params, n);
+      return;
+    }
+#endif
+    digitalWrite(dc_, LOW);
+    digitalWrite(cs_, LOW);
+    Bus::write(cmd);
+    digitalWrite(dc_, HIGH);
+    for (uint8_t i = 0; i < n; i++)
+      Bus::write(params[i]);
+    digitalWrite(cs_, HIGH);
+  }
+
+  /** Columns x0..x1, rows y0..y1; the next pixels start at (x0, y0). */
+  void setAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    const uint8_t ca[4] = {(uint8_t)(x0 >> 8), (uint8_t)x0, (uint8_t)(x1 >> 8),
+                           (uint8_t)x1};
+    const uint8_t ra[4] = {(uint8_t)(y0 >> 8), (uint8_t)y0, (uint8_t)(y1 >> 8),
+                           (uint8_t)y1};
+    ramwr_ = true;
+    if (windowValid_ && x0 == x0_ && x1 == x1_ && y0 == y0_ && y1 == y1_) {
+      stats_.windowsSkipped++;
+      return;
+    }
+    windowValid_ = true;
+    x0_ = x0, x1_ = x1, y0_ = y0, y1_ = y1;
+#if SOC_LCD_I80_SUPPORTED
+    if (dma_) {
+      queueParams(0x2A, ca);
+      queueParams(0x2B, ra);
+      return;
+    }
+#endif
+    command(0x2A, ca, 4);
+    command(0x2B, ra, 4);
+    windowValid_ = true;
+  }
+
+  /** count pixels of one colour into the window. */
+  void fill(uint16_t color, uint32_t count) {
+#if SOC_LCD_I80_SUPPORTED
+    if (dma_) {
+      while (count) {
+        const uint32_t n = count < I80_SPAN_PIXELS ? count : I80_SPAN_PIXELS;
+        Slot &s = slots_[next_];
+        if (s.color != color || s.filled < n) {
+          const uint8_t hi = (uint8_t)(color >> 8), lo = (uint8_t)color;
+          for (uint32_t i = 0; i < n; i++) {
+            s.buf[2 * i] = hi;
+            s.buf[2 * i + 1] = lo;
+          }
+          s.color = color;
+          s.filled = (uint16_t)n;
+          stats_.spansWritten++;
+        } else {
+          stats_.spansReused++;
+        }
+        queuePixels(n);
+        count -= n;
+      }
+      return;
+    }
+#endif
+    startGpioPixels();
+    const uint8_t hi = (uint8_t)(color >> 8), lo = (uint8_t)color;
+    for (uint32_t i = 0; i < count; i++) {
+      Bus::write(hi);
+      Bus::write(lo);
+    }
+    digitalWrite(cs_, HIGH);
+  }
+
+  /** n RGB565 pixels into the window (the caller may reuse px at once). */
+  void pushPixels(const uint16_t *px, uint32_t n) {
+#if SOC_LCD_I80_SUPPORTED
+    if (dma_) {
+      while (n) {
+        const uint32_t k = n < I80_SPAN_PIXELS ? n : I80_SPAN_PIXELS;
+        Slot &s = slots_[next_];
+        for (uint32_t i = 0; i < k; i++) {
+          s.buf[2 * i] = (uint8_t)(px[i] >> 8);
+          s.buf[2 * i + 1] = (uint8_t)px[i];
+        }
+        s.color = NO_COLOR;
+        stats_.spansWritten++;
+        queuePixels(k);
+        px += k;
+        n -= k;
+      }
+      return;
+    }
+#endif
+    startGpioPixels();
+    for (uint32_t i = 0; i < n; i++) {
+      Bus::write((uint8_t)(px[i] >> 8));
+      Bus::write((uint8_t)px[i]);
+    }
+    digitalWrite(cs_, HIGH);
+  }
+
+  /**
+   * n pixels already in panel byte order (big-endian RGB565), sent from
+   * bytes without a copy: a stored frame. bytes must stay as they are
+   * until they are on the panel (flush(), or a queue's worth of later
+   * transfers); DMA buffers are 64-byte aligned.
+   */
+  void pushStored(const uint8_t *bytes, uint32_t n) {
+#if SOC_LCD_I80_SUPPORTED
+    if (dma_) {
+      while (n) {
+        const uint32_t k = n < I80_SPAN_PIXELS ? n : I80_SPAN_PIXELS;
+        const int cmd = ramwr_ ? 0x2C : 0x3C;
+        ramwr_ = false;
+        queued_++;
+        stats_.transfers++;
+        stats_.spansStored++;
+        esp_lcd_panel_io_tx_color(io_, cmd, bytes, k * 2);
+        bytes += k * 2;
+        n -= k;
+      }
+      return;
+    }
+#endif
+    startGpioPixels();
+    for (uint32_t i = 0; i < 2 * n; i++)
+      Bus::write(bytes[i]);
+    digitalWrite(cs_, HIGH);
+  }
+
+  /** Wait until everything queued is on the panel. */
+  void flush() {
+#if SOC_LCD_I80_SUPPORTED
+    // tx_param() waits for the queue; NOP is the cheapest thing to send
+    if (dma_ && pending())
+      esp_lcd_panel_io_tx_param(io_, 0x00, nullptr, 0);
+#endif
+  }
+
+  const Stats &stats() const { return stats_; }
+
+private:
+  static constexpr uint32_t NO_COLOR = 0x10000;
+
+  struct Slot {
+    uint8_t *buf = nullptr;
+    uint8_t params[4] = {};
+    uint32_t color = NO_COLOR; // Solid colour in buf, or NO_COLOR
+    uint16_t filled = 0;       // ... over this many pixels
+  };
+
+  /** The GPIO path streams after RAMWR with CS low. */
+  void startGpioPixels() {
+    if (ramwr_) {
+      ramwr_ = false;
+      command(0x2C);
+    }
+    digitalWrite(dc_, HIGH);
+    digitalWrite(cs_, LOW);
+  }
+
+#if SOC_LCD_I80_SUPPORTED
+  bool beginDma(I80Memory memory, uint32_t pclkHz) {
+    esp_lcd_i80_bus_config_t bus = {};
+    bus.dc_gpio_num = dc_;
+    bus.wr_gpio_num = Bus::WR_PIN;
+    bus.clk_src = LCD_CLK_SRC_DEFAULT;
+    for (uint8_t i = 0; i < 8; i++)
+      bus.data_gpio_nums[i] = Bus::dataPin(i);
+    bus.bus_width = 8;
+    bus.max_transfer_bytes = I80_SPAN_PIXELS * 2;
+    bus.psram_trans_align = 64;
+    bus.sram_trans_align = 4;
+    if (esp_lcd_new_i80_bus(&bus, &bus_) != ESP_OK)
+      return false;
+
+    esp_lcd_panel_io_i80_config_t io = {};
+    io.cs_gpio_num = cs_;
+    io.pclk_hz = pclkHz;
+    io.trans_queue_depth = I80_QUEUE_DEPTH;
+    io.on_color_trans_done = transferDone;
+    io.user_ctx = this;
+    io.lcd_cmd_bits = 8;
+    io.lcd_param_bits = 8;
+    io.dc_levels.dc_idle_level = 0;
+    io.dc_levels.dc_cmd_level = 0;
+    io.dc_levels.dc_dummy_level = 0;
+    io.dc_levels.dc_data_level = 1;
+    if (esp_lcd_new_panel_io_i80(bus_, &io, &io_) != ESP_OK) {
+      esp_lcd_del_i80_bus(bus_);
+      bus_ = nullptr;
+      return false;
+    }
+
+    const uint32_t caps = memory == I80Memory::PSRAM
+                              ? MALLOC_CAP_SPIRAM
+                              : MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL;
+    for (uint8_t i = 0; i < SLOTS; i++) {
+      slots_[i].buf = (uint8_t *)heap_caps_aligned_alloc(
+          64, I80_SPAN_PIXELS * 2, caps);
+      if (!slots_[i].buf) {
+        endDma();
+        return false;
+      }
+    }
+    // 160 MHz over a whole divider, as the peripheral sets it
+    const uint32_t div = (160000000 + pclkHz - 1) / pclkHz;
+    hz_ = 160000000 / (div ? div : 1);
+    dma_ = true;
+    return true;
+  }
+
+  void endDma() {
+    for (uint8_t i = 0; i < SLOTS; i++) {
+      heap_caps_free(slots_[i].buf);
+      slots_[i].buf = nullptr;
+    }
+    esp_lcd_panel_io_del(io_);
+    esp_lcd_del_i80_bus(bus_);
+    io_ = nullptr;
+    bus_ = nullptr;
+  }
+
+  /** on_color_trans_done, in the DMA interrupt. */
+  static bool IRAM_ATTR transferDone(esp_lcd_panel_io_handle_t,
+                                     esp_lcd_panel_io_event_data_t *,
+                                     void *ctx) {
+    I80Panel *self = (I80Panel *)ctx;
+    const uint32_t done =
+        self->done_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    if (done == self->queued_ && self->idleCb_)
+      self->idleCb_(self->idleCtx_);
+    return false;
+  }
+
+  /** Send the next slot's n pixels (RAMWR first in a window). */
+  void queuePixels(uint32_t n) {
+    const int cmd = ramwr_ ? 0x2C : 0x3C;
+    ramwr_ = false;
+    queue(cmd, slots_[next_].buf, n * 2);
+  }
+
+  void queueParams(uint8_t cmd, const uint8_t p[4]) {
+    Slot &s = slots_[next_];
+    memcpy(s.params, p, 4);
+    queue(cmd, s.params, 4);
+  }
+
+  /** Queue from the current slot and move on (blocks on a full queue). */
+  void queue(int cmd, const uint8_t *data, size_t len) {
+    queued_++; // Before the transfer can finish, for onIdle()
+    stats_.transfers++;
+    esp_lcd_panel_io_tx_color(io_, cmd, data, len);
+    next_ = (uint8_t)((next_ + 1) % SLOTS);
+  }
+
+  esp_lcd_i80_bus_handle_t bus_ = nullptr;
+  esp_lcd_panel_io_handle_t io_ = nullptr;
+#endif
+
+  static constexpr uint8_t SLOTS = I80_QUEUE_DEPTH + 1;
+
+  const int8_t cs_, dc_;
+  bool dma_ = false;
+  uint32_t hz_ = 0;
+  Slot slots_[SLOTS];
+  uint8_t next_ = 0;
+  volatile uint32_t queued_ = 0;
+  std::atomic<uint32_t> done_{0};
+  IdleCallback idleCb_ = nullptr;
+  void *idleCtx_ = nullptr;
+  bool ramwr_ = false; // The next pixels start the window
+  bool windowValid_ = false;
+  uint16_t x0_ = 0, x1_ = 0, y0_ = 0, y1_ = 0;
+  Stats stats_;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_I80_PANEL_H
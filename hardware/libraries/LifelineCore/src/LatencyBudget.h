@@ -0,0 +1,249 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                    LIFELINE CORE - SOS LATENCY BUDGET
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Breaks the time from the TX key press to the database row into stages:
+ *
+ *   TX   key press ──► radio start ──► TxDone
+ *   AIR  time on air, computed at the RX from the LoRa parameters
+ *   RX   RxDone ──► parsed ──► alert on screen
+ *                         └──► uplink sent ──► uplink acknowledged
+ *   API  ingested_at, stamped by the database
+ *
+ * Clocks are never synchronised. The TX appends its key → radio delta to the
+ * frame as ";k=<ms>", the RX adds the computed airtime and its own deltas,
+ * and the uplink carries all of them to the API.
+ *
+ * Samples are kept in a small ring per stage so the serial report can print
+ * p50/p90/p99 without any allocation.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_LATENCY_BUDGET_H
+#define LIFELINE_LATENCY_BUDGET_H
+
+#include <Arduino.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef LATENCY_SAMPLES
+#define LATENCY_SAMPLES 64 // Samples kept per stage
+#endif
+
+namespace lifeline {
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                                 STAGES
+// ═══════════════════════════════════════════════════════════════════════════
+
+enum LatencyStage : uint8_t {
+  LAT_TX_UI,         // TX: confirm key press → radio start
+  LAT_TX_RADIO,      // TX: radio start → TxDone
+  LAT_AIR,           // Time on air (computed)
+  LAT_RX_PARSE,      // RX: RxDone → frame parsed
+  LAT_RX_DISPLAY,    // RX: frame parsed → alert screen drawn
+  LAT_UPLINK_SEND,   // RX: frame parsed → HTTP request started
+  LAT_UPLINK_ACK,    // RX: HTTP request → response received
+  LAT_KEY_TO_SCREEN, // Key press → alert visible on the RX
+  LAT_KEY_TO_ACK,    // Key press → API acknowledged the row
+  LAT_STAGE_COUNT
+};
+
+static const char *const latencyStageNames[LAT_STAGE_COUNT] = {
+    "tx_ui",     "tx_radio",   "air",        "rx_parse", "rx_display",
+    "uplink_tx", "uplink_ack", "key>screen", "key>ack"};
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                               TIME ON AIR
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * SX127x time on air (Semtech AN1200.13) in microseconds.
+ * crDenom is the coding-rate denominator (5..8 for 4/5..4/8).
+ * Low data rate optimisation is assumed on when the symbol exceeds 16 ms,
+ * matching what the LoRa library programs for SF11/SF12 at 125 kHz.
+ */
+inline uint32_t loraTimeOnAirUs(uint16_t payloadLen, uint8_t sf, uint32_t bwHz,
+                                uint8_t crDenom = 5, uint16_t preambleLen = 8,
+                                bool crc = true, bool implicitHeader = false) {
+  const float tSym = (float)(1UL << sf) * 1e6f / (float)bwHz;
+  const int de = (tSym > 16000.0f) ? 1 : 0;
+  const int num = 8 * payloadLen - 4 * sf + 28 + (crc ? 16 : 0) -
+                  (implicitHeader ? 20 : 0);
+  const int den = 4 * (sf - 2 * de);
+  int nPayload = 8;
+  if (num > 0) {
+    nPayload += ((num + den - 1) / den) * crDenom;
+  }
+  const float tPreamble = ((float)preambleLen + 4.25f) * tSym;
+  return (uint32_t)(tPreamble + (float)nPayload * tSym);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                               RX TRACE
+// ═══════════════════════════════════════════════════════════════════════════
+
+/** Stamps for the frame currently moving through the receiver. */
+struct LatencyTrace {
+  bool active = false;
+  bool overAir = false;   // false for serial-simulated packets
+  int32_t txUiMs = -1;    // ";k=" trailer, -1 when the TX did not send one
+  uint32_t airUs = 0;
+  uint32_t rxDoneUs = 0;
+  uint32_t parsedUs = 0;
+  uint32_t displayedUs = 0;
+  uint32_t uplinkSentUs = 0;
+  uint32_t uplinkAckUs = 0;
+
+  void begin(uint32_t nowUs, bool fromRadio) {
+    *this = LatencyTrace();
+    active = true;
+    overAir = fromRadio;
+    rxDoneUs = nowUs;
+  }
+
+  /** Microseconds before RxDone that the TX key was pressed, 0 if unknown. */
+  uint32_t preRxUs() const {
+    return (overAir && txUiMs >= 0) ? (uint32_t)txUiMs * 1000UL + airUs : 0;
+  }
+
+  uint16_t airMs() const { return (uint16_t)((airUs + 500) / 1000); }
+  uint32_t gatewayMs() const {
+    return uplinkSentUs ? (uplinkSentUs - rxDoneUs + 500) / 1000 : 0;
+  }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                               RECORDER
+// ═══════════════════════════════════════════════════════════════════════════
+
+template <uint16_t N = LATENCY_SAMPLES> class LatencyRecorder {
+public:
+  void record(LatencyStage stage, uint32_t us) {
+    if (stage >= LAT_STAGE_COUNT)
+      return;
+    samples_[stage][head_[stage]] = us;
+    head_[stage] = (uint16_t)((head_[stage] + 1) % N);
+    if (count_[stage] < N)
+      count_[stage]++;
+    if (us > max_[stage])
+      max_[stage] = us;
+  }
+
+  /** Record every stage a finished RX trace can account for. */
+  void recordTrace(const LatencyTrace &t) {
+    if (!t.active)
+      return;
+    if (t.overAir) {
+      record(LAT_AIR, t.airUs);
+      if (t.txUiMs >= 0)
+        record(LAT_TX_UI, (uint32_t)t.txUiMs * 1000UL);
+    }
+    if (t.parsedUs)
+      record(LAT_RX_PARSE, t.parsedUs - t.rxDoneUs);
+    if (t.displayedUs) {
+      record(LAT_RX_DISPLAY, t.displayedUs - t.parsedUs);
+      if (t.preRxUs())
+        record(LAT_KEY_TO_SCREEN, t.preRxUs() + (t.displayedUs - t.rxDoneUs));
+    }
+    if (t.uplinkSentUs)
+      record(LAT_UPLINK_SEND, t.uplinkSentUs - t.parsedUs);
+    if (t.uplinkAckUs) {
+      record(LAT_UPLINK_ACK, t.uplinkAckUs - t.uplinkSentUs);
+      if (t.preRxUs())
+        record(LAT_KEY_TO_ACK, t.preRxUs() + (t.uplinkAckUs - t.rxDoneUs));
+    }
+  }
+
+  uint16_t count(LatencyStage stage) const { return count_[stage]; }
+
+  /** Nearest-rank percentile over the retained window, in microseconds. */
+  uint32_t percentile(LatencyStage stage, uint8_t pct) const {
+    const uint16_t n = count_[stage];
+    if (n == 0)
+      return 0;
+    uint32_t sorted[N];
+    for (uint16_t i = 0; i < n; i++) {
+      uint32_t v = samples_[stage][i];
+      uint16_t j = i;
+      while (j > 0 && sorted[j - 1] > v) {
+        sorted[j] = sorted[j - 1];
+        j--;
+      }
+      sorted[j] = v;
+    }
+    uint16_t rank = (uint16_t)((pct * (uint32_t)n + 99) / 100);
+    if (rank == 0)
+      rank = 1;
+    return sorted[rank - 1];
+  }
+
+  void clear() {
+    memset(max_, 0, sizeof(max_));
+    memset(head_, 0, sizeof(head_));
+    memset(count_, 0, sizeof(count_));
+  }
+
+  /** Print the per-stage table; stages without samples are skipped. */
+  void printReport(Print &out) const {
+    out.println(F("[LAT] stage          n      p50      p90      p99      max (ms)"));
+    for (uint8_t s = 0; s < LAT_STAGE_COUNT; s++) {
+      const LatencyStage st = (LatencyStage)s;
+      if (count_[s] == 0)
+        continue;
+      out.printf("[LAT] %-11s %4u %8.1f %8.1f %8.1f %8.1f\n",
+                 latencyStageNames[s], count_[s], percentile(st, 50) / 1000.0,
+                 percentile(st, 90) / 1000.0, percentile(st, 99) / 1000.0,
+                 max_[s] / 1000.0);
+    }
+  }
+
+private:
+  uint32_t samples_[LAT_STAGE_COUNT][N] = {};
+  uint32_t max_[LAT_STAGE_COUNT] = {};
+  uint16_t head_[LAT_STAGE_COUNT] = {};
+  uint16_t count_[LAT_STAGE_COUNT] = {};
+};
+
+/**
+ * Parse an integer "key=value" field from the first len bytes of a frame
+ * trailer such as ";k=412;s=7" (no terminator needed). Returns false when the
+ * key is absent; a present key without digits reads as 0, like strtol().
+ * Values saturate at LONG_MIN/LONG_MAX.
+ */
+inline bool frameTrailerField(const char *trailer, size_t len, char key,
+                              long &value) {
+  if (!trailer)
+    return false;
+  for (size_t i = 0; i + 2 < len; i++) {
+    if (trailer[i] != ';' || trailer[i + 1] != key || trailer[i + 2] != '=')
+      continue;
+    size_t p = i + 3;
+    while (p < len && (trailer[p] == ' ' || trailer[p] == '\t'))
+      p++;
+    const bool negative = p < len && trailer[p] == '-';
+    if (p < len && (trailer[p] == '-' || trailer[p] == '+'))
+      p++;
+    unsigned long v = 0;
+    const unsigned long limit =
+        negative ? (unsigned long)LONG_MAX + 1UL : (unsigned long)LONG_MAX;
+    for (; p < len && trailer[p] >= '0' && trailer[p] <= '9'; p++) {
+      const unsigned d = (unsigned)(trailer[p] - '0');
+      v = (v > (limit - d) / 10) ? limit : v * 10 + d;
+    }
+    value = negative ? (v == limit ? LONG_MIN : -(long)v) : (long)v;
+    return true;
+  }
+  return false;
+}
+
+inline bool frameTrailerField(const char *trailer, char key, long &value) {
+  return trailer && frameTrailerField(trailer, strlen(trailer), key, value);
+}
+
+} // namespace lifeline
+
+#endif // LIFELINE_LATENCY_BUDGET_H
@@ -0,0 +1,39 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                              LIFELINE CORE
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Shared, header-only building blocks for the LifeLine TX/RX sketches.
+ * Sketches normally include the individual headers they need; this umbrella
+ * pulls in everything that is platform independent.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_CORE_H
+#define LIFELINE_CORE_H
+
+#define LIFELINE_CORE_VERSION "1.0.0"
+
+#include "AaText.h"
+#include "AlertFrame.h"
+#include "AlertInbox.h"
+#include "AlertJournal.h"
+#include "BatteryMonitor.h"
+#include "BootSequencer.h"
+#include "DeviceRegistry.h"
+#include "EnergyMeter.h"
+#include "LatencyBudget.h"
+#include "LinkStats.h"
+#include "MemoryBudget.h"
+#include "ObjectPool.h"
+#include "PanelImage.h"
+#include "PinMap.h"
+#include "RateLimiter.h"
+#include "RingQueue.h"
+#include "SpiArbiter.h"
+#include "StagedRender.h"
+#include "UiText.h"
+#include "UiTextNe.h"
+#include "UplinkLane.h"
+
+#endif // LIFELINE_CORE_H
@@ -0,0 +1,288 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                  LIFELINE CORE - PER-DEVICE LINK STATISTICS
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * What the receiver hears from each handheld, so a weak one gets a relay or
+ * a better antenna before it has to send an SOS. Every frame from a device
+ * updates its entry: alerts, retries and heartbeats alike.
+ *
+ *   lifeline::LinkStats<> links;
+ *   links.record(frame.deviceId, rssi, snr, frame.seq, alertIndex, millis());
+ *   const lifeline::LinkEntry *e = links.find(3);
+ *   links.page(rows, 0, 6);             // Weakest first
+ *
+ *   Table    Open addressing with linear probing, keyed by device ID, in a
+ *            fixed array of LINK_STATS_SLOTS (a power of two). At most 3/4
+ *            of the slots are used, so a lookup is a probe or two. When the
+ *            table is full, the device heard least recently makes room (a
+ *            scan, only when a new device turns up).
+ *   Signal   RSSI and SNR are EWMAs (1/8 per frame) in 1/16 dB steps.
+ *   Loss     Alerts carry s=, one number per alert, repeated on retries. A
+ *            jump from s=7 to s=10 means 8 and 9 never arrived. A jump
+ *            back, or ahead by more than LINK_MAX_GAP, is a TX restart and
+ *            counts nothing.
+ *   Weak     SNR under LINK_WEAK_SNR_DB (SF12 decodes to about -20 dB) or
+ *            loss at LINK_WEAK_LOSS_PCT or more.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_LINK_STATS_H
+#define LIFELINE_LINK_STATS_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "MemoryBudget.h" // printfTo(): the gateway runs with the heap frozen
+
+#ifndef LINK_STATS_SLOTS
+#define LINK_STATS_SLOTS 64 // Hash slots (32 bytes each); 48 devices
+#endif
+#ifndef LINK_MAX_GAP
+#define LINK_MAX_GAP 32 // Larger s= jumps are a TX restart, not loss
+#endif
+#ifndef LINK_WEAK_SNR_DB
+#define LINK_WEAK_SNR_DB -15 // Under this: less than 5 dB of fade margin
+#endif
+#ifndef LINK_WEAK_LOSS_PCT
+#define LINK_WEAK_LOSS_PCT 10
+#endif
+
+namespace lifeline {
+
+static const uint8_t LINK_NO_ALERT = 0xFF;
+
+struct LinkEntry {
+  uint16_t deviceId;
+  int16_t rssiQ4;       // EWMA, dBm x 16
+  int16_t snrQ4;        // EWMA, dB x 16
+  uint16_t lastSeq;     // Last s= heard
+  uint32_t packets;     // Frames heard
+  uint32_t alerts;      // Distinct alerts (s= values) heard
+  uint32_t lost;        // s= values never heard
+  uint32_t lastSeenMs;
+  uint32_t lastAlertMs;
+  uint8_t lastAlert;    // Alert index, LINK_NO_ALERT before the first
+  uint8_t flags;        // Private: slot in use, s= seen
+
+  float rssi() const { return rssiQ4 / 16.0f; }
+  float snr() const { return snrQ4 / 16.0f; }
+  /** Share of alerts that never arrived, 0..100. */
+  uint8_t lossPct() const {
+    const uint32_t sent = alerts + lost;
+    return sent ? (uint8_t)((lost * 100 + sent / 2) / sent) : 0;
+  }
+  bool weak() const {
+    return snrQ4 < LINK_WEAK_SNR_DB * 16 || lossPct() >= LINK_WEAK_LOSS_PCT;
+  }
+};
+
+/** a before b on the screen: weak first, then by SNR, lowest first. */
+inline bool linkBefore(const LinkEntry &a, const LinkEntry &b) {
+  if (a.weak() != b.weak())
+    return a.weak();
+  return a.snrQ4 != b.snrQ4 ? a.snrQ4 < b.snrQ4 : a.deviceId < b.deviceId;
+}
+
+template <uint8_t SLOTS = LINK_STATS_SLOTS> class LinkStats {
+  static_assert(SLOTS >= 4 && (SLOTS & (SLOTS - 1)) == 0 && SLOTS <= 128,
+                "LINK_STATS_SLOTS must be a power of two, 4..128");
+
+public:
+  struct Stats {
+    uint32_t frames = 0;  // record() calls
+    uint32_t evicted = 0; // Devices dropped for a new one
+    uint8_t maxProbe = 0; // Longest probe sequence seen
+  };
+
+  /**
+   * One frame from deviceId. seq is the frame's s= (-1 without one), and
+   * alertIndex its alert (-1 for a heartbeat). O(1) unless a new device
+   * finds the table full.
+   */
+  const LinkEntry &record(uint16_t deviceId, int rssi, float snr, long seq,
+                          int alertIndex, uint32_t nowMs) {
+    stats_.frames++;
+    version_++;
+    int i = indexOf(deviceId);
+    if (i < 0)
+      i = insert(deviceId);
+    LinkEntry &e = slots_[i];
+
+    const int32_t rssiQ4 = rssi * 16;
+    const int32_t snrQ4 = (int32_t)(snr * 16.0f + (snr < 0 ? -0.5f : 0.5f));
+    if (e.packets == 0) {
+      e.rssiQ4 = (int16_t)rssiQ4;
+      e.snrQ4 = (int16_t)snrQ4;
+    } else {
+      e.rssiQ4 = ewma(e.rssiQ4, rssiQ4);
+      e.snrQ4 = ewma(e.snrQ4, snrQ4);
+    }
+    e.packets++;
+    e.lastSeenMs = nowMs;
+
+    if (seq >= 0) {
+      const uint16_t s = (uint16_t)seq;
+      if (!(e.flags & SEQ)) {
+        e.alerts++;
+      } else {
+        const uint16_t gap = (uint16_t)(s - e.lastSeq);
+        if (gap >= 1 && gap <= LINK_MAX_GAP) {
+          e.lost += gap - 1u;
+          e.alerts++;
+        } else if (gap != 0) {
+          e.alerts++; // TX restarted: a new run of s=
+        }
+      }
+      e.lastSeq = s;
+      e.flags |= SEQ;
+    }
+    if (alertIndex >= 0) {
+      e.lastAlert = (uint8_t)alertIndex;
+      e.lastAlertMs = nowMs;
+    }
+    return e;
+  }
+
+  const LinkEntry *find(uint16_t deviceId) const {
+    const int i = indexOf(deviceId);
+    return i < 0 ? nullptr : &slots_[i];
+  }
+
+  /**
+   * Up to n devices of rank first, first + 1, ... into out, weakest first
+   * (linkBefore). Returns how many there were.
+   */
+  uint8_t page(LinkEntry *out, uint8_t first, uint8_t n) const {
+    const LinkEntry *prev = nullptr;
+    uint8_t got = 0;
+    for (uint16_t rank = 0; rank < (uint16_t)first + n; rank++) {
+      const LinkEntry *best = nullptr;
+      for (uint8_t i = 0; i < SLOTS; i++) {
+        const LinkEntry &e = slots_[i];
+        if ((e.flags & USED) && (!prev || linkBefore(*prev, e)) &&
+            (!best || linkBefore(e, *best)))
+          best = &e;
+      }
+      if (!best)
+        break;
+      if (rank >= first)
+        out[got++] = *best;
+      prev = best;
+    }
+    return got;
+  }
+
+  /** Devices under the weak thresholds. */
+  uint8_t weakCount() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < SLOTS; i++)
+      n += (slots_[i].flags & USED) && slots_[i].weak();
+    return n;
+  }
+
+  uint8_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  static constexpr uint8_t capacity() { return SLOTS / 4 * 3; }
+  /** Changes with every record(): views redraw on it. */
+  uint32_t version() const { return version_; }
+  const Stats &stats() const { return stats_; }
+
+  void printReport(Print &out) const {
+    printfTo(out, "[LINK] %u devices (%u weak) of %u; %lu frames, %lu "
+                  "evicted, longest probe %u\n",
+             size_, weakCount(), capacity(), (unsigned long)stats_.frames,
+             (unsigned long)stats_.evicted, stats_.maxProbe);
+  }
+
+private:
+  static const uint8_t USED = 0x01;
+  static const uint8_t SEQ = 0x02;
+  static const uint8_t MASK = SLOTS - 1;
+
+  static constexpr uint8_t bits(uint8_t n) { return n > 1 ? 1 + bits(n / 2) : 0; }
+
+  /** Fibonacci hashing: the top bits of id x 2^16 / phi. */
+  static uint8_t home(uint16_t deviceId) {
+    return (uint8_t)((uint16_t)(deviceId * 40503u) >> (16 - bits(SLOTS)));
+  }
+
+  static int16_t ewma(int16_t avg, int32_t sample) {
+    const int32_t d = sample - avg;
+    return (int16_t)(avg + (d >= 0 ? (d + 4) / 8 : (d - 4) / 8));
+  }
+
+  int indexOf(uint16_t deviceId) const {
+    uint8_t i = home(deviceId);
+    for (uint8_t probe = 0; probe < SLOTS; probe++) {
+      const LinkEntry &e = slots_[i];
+      if (!(e.flags & USED))
+        return -1;
+      if (e.deviceId == deviceId)
+        return i;
+      i = (i + 1) & MASK;
+    }
+    return -1;
+  }
+
+  uint8_t insert(uint16_t deviceId) {
+    if (size_ >= capacity()) {
+      removeAt(stalest());
+      stats_.evicted++;
+    }
+    uint8_t i = home(deviceId), probe = 0;
+    while (slots_[i].flags & USED) {
+      i = (i + 1) & MASK;
+      probe++;
+    }
+    if (probe > stats_.maxProbe)
+      stats_.maxProbe = probe;
+    slots_[i] = LinkEntry();
+    slots_[i].deviceId = deviceId;
+    slots_[i].lastAlert = LINK_NO_ALERT;
+    slots_[i].flags = USED;
+    size_++;
+    return i;
+  }
+
+  /** The device heard least recently. */
+  uint8_t stalest() const {
+    uint8_t worst = 0;
+    bool found = false;
+    for (uint8_t i = 0; i < SLOTS; i++) {
+      if (!(slots_[i].flags & USED))
+        continue;
+      if (!found || (int32_t)(slots_[i].lastSeenMs - slots_[worst].lastSeenMs) < 0)
+        worst = i;
+      found = true;
+    }
+    return worst;
+  }
+
+  /** Backward-shift delete: no tombstones, probes stay short. */
+  void removeAt(uint8_t i) {
+    uint8_t j = i;
+    for (;;) {
+      j = (j + 1) & MASK;
+      if (!(slots_[j].flags & USED))
+        break;
+      // The entry at j may fill the hole at i if i is on its probe path
+      const uint8_t h = home(slots_[j].deviceId);
+      if (((j - h) & MASK) >= ((j - i) & MASK)) {
+        slots_[i] = slots_[j];
+        i = j;
+      }
+    }
+    slots_[i].flags = 0;
+    size_--;
+  }
+
+  LinkEntry slots_[SLOTS] = {};
+  uint8_t size_ = 0;
+  uint32_t version_ = 0;
+  Stats stats_;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_LINK_STATS_H
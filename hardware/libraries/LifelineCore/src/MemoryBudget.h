@@ -0,0 +1,326 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                 LIFELINE CORE - STATIC MEMORY BUDGET
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * A gateway that runs for months needs a flat heap. In the no-heap-after-
+ * boot mode, every buffer the firmware needs is sized at compile time. It
+ * uses the fixed string and vector below and static packet and uplink
+ * buffers in the sketch. Once boot is over, the sketch registers those
+ * blocks, prints the budget and freezes the heap:
+ *
+ *   [MEM] uplink body         320 B
+ *   [MEM] rx packet           256 B
+ *   [MEM] static total    576 B | heap free 201 KB, min 198 KB, ...
+ *
+ * After freeze():
+ *   - On the host build, the shim sees every allocation that sketch code
+ *     makes. One outside a LibraryHeap scope is reported and aborts when
+ *     freeze(true) asked for it.
+ *   - On the board, a sketch cannot hook malloc. check() watches the free
+ *     heap instead and trips when it sinks more than HEAP_DRIFT_LIMIT below
+ *     the post-boot level.
+ *
+ * The board guarantee is deliberately the weaker one. The prebuilt Arduino
+ * core has no allocation hooks, and wrapping malloc at link time catches
+ * the WiFi and lwIP tasks too, whose buffers come and go with traffic. So
+ * on the board a single stray allocation, or a leak that stays under
+ * HEAP_DRIFT_LIMIT, is not caught. Only a steady leak is. The host tests
+ * are what keep sketch code off the heap.
+ *
+ * "Boot" ends where the sketch says. lifeline_rx_pro freezes after setup()
+ * and its first WiFi connect attempt, because the WiFi stack allocates its
+ * buffers then. Closing the portal reconnects and takes a new baseline.
+ *
+ * LibraryHeap marks calls into libraries that allocate inside (HTTPClient,
+ * TLS, WebServer). They are outside the budget by design and on the board
+ * show up only as drift. Print::printf() on the board allocates for output
+ * of 64 characters or more; printfTo() formats into a stack buffer.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_MEMORY_BUDGET_H
+#define LIFELINE_MEMORY_BUDGET_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef BUDGET_MAX_ENTRIES
+#define BUDGET_MAX_ENTRIES 16 // Named static blocks in the boot report
+#endif
+#ifndef HEAP_DRIFT_LIMIT
+#define HEAP_DRIFT_LIMIT 16384 // Bytes the free heap may sink after boot
+#endif
+#ifndef PRINTF_TO_MAX
+#define PRINTF_TO_MAX 192 // Longest printfTo() output (the rest is cut)
+#endif
+
+namespace lifeline {
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                          FIXED-CAPACITY TYPES
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * NUL-terminated string in a char[N]. Appends that do not fit are cut at
+ * capacity and flag truncated(), never allocate.
+ */
+template <size_t N> class FixedString {
+public:
+  static_assert(N > 1, "FixedString needs room for a character");
+
+  FixedString() { clear(); }
+  explicit FixedString(const char *s) {
+    clear();
+    append(s);
+  }
+
+  void clear() {
+    len_ = 0;
+    buf_[0] = '\0';
+    truncated_ = false;
+  }
+
+  bool append(const char *s, size_t n) {
+    if (!s)
+      return true;
+    const size_t room = N - 1 - len_;
+    if (n > room) {
+      n = room;
+      truncated_ = true;
+    }
+    memcpy(buf_ + len_, s, n);
+    len_ += n;
+    buf_[len_] = '\0';
+    return !truncated_;
+  }
+  bool append(const char *s) { return s ? append(s, strlen(s)) : true; }
+  bool append(char c) { return append(&c, 1); }
+
+  __attribute__((format(printf, 2, 3))) bool appendf(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    const int n = vsnprintf(buf_ + len_, N - len_, fmt, args);
+    va_end(args);
+    if (n < 0) {
+      buf_[len_] = '\0';
+      return false;
+    }
+    if ((size_t)n >= N - len_) {
+      len_ = N - 1;
+      truncated_ = true;
+    } else {
+      len_ += (size_t)n;
+    }
+    return !truncated_;
+  }
+
+  /** Shorten to n characters (no-op when already shorter). */
+  void truncate(size_t n) {
+    if (n < len_) {
+      len_ = n;
+      buf_[len_] = '\0';
+    }
+  }
+
+  const char *c_str() const { return buf_; }
+  char *data() { return buf_; }
+  size_t length() const { return len_; }
+  bool empty() const { return len_ == 0; }
+  bool truncated() const { return truncated_; }
+  static constexpr size_t capacity() { return N - 1; }
+  char operator[](size_t i) const { return i < len_ ? buf_[i] : '\0'; }
+  bool equals(const char *s) const { return s && strcmp(buf_, s) == 0; }
+
+  /** Replace the contents with s (cut to capacity). */
+  FixedString &operator=(const char *s) {
+    clear();
+    append(s);
+    return *this;
+  }
+
+private:
+  char buf_[N];
+  size_t len_;
+  bool truncated_;
+};
+
+/** Vector with inline storage for N elements; push_back() fails when full. */
+template <typename T, size_t N> class FixedVector {
+public:
+  bool push_back(const T &v) {
+    if (size_ >= N)
+      return false;
+    items_[size_++] = v;
+    return true;
+  }
+
+  /** Remove element i, keeping the order of the rest. */
+  void erase(size_t i) {
+    if (i >= size_)
+      return;
+    for (size_t j = i + 1; j < size_; j++)
+      items_[j - 1] = items_[j];
+    size_--;
+  }
+
+  void pop_back() {
+    if (size_)
+      size_--;
+  }
+  void clear() { size_ = 0; }
+
+  T &operator[](size_t i) { return items_[i]; }
+  const T &operator[](size_t i) const { return items_[i]; }
+  T &back() { return items_[size_ - 1]; }
+  T *begin() { return items_; }
+  T *end() { return items_ + size_; }
+  const T *begin() const { return items_; }
+  const T *end() const { return items_ + size_; }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  bool full() const { return size_ >= N; }
+  static constexpr size_t capacity() { return N; }
+
+private:
+  T items_[N] = {};
+  size_t size_ = 0;
+};
+
+/** printf() to out through a stack buffer, cut at PRINTF_TO_MAX - 1. */
+__attribute__((format(printf, 2, 3))) inline size_t
+printfTo(Print &out, const char *fmt, ...) {
+  char line[PRINTF_TO_MAX];
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(line, sizeof(line), fmt, args);
+  va_end(args);
+  if (n < 0)
+    return 0;
+  if ((size_t)n >= sizeof(line))
+    n = sizeof(line) - 1;
+  return out.write((const uint8_t *)line, (size_t)n);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                             HEAP GUARD
+// ═══════════════════════════════════════════════════════════════════════════
+
+/** Marks a library call that may allocate after the heap is frozen. */
+class LibraryHeap {
+public:
+#ifdef LIFELINE_HOST
+  LibraryHeap() { host::heapLibraryEnter(); }
+  ~LibraryHeap() { host::heapLibraryLeave(); }
+#else
+  LibraryHeap() {}
+#endif
+  LibraryHeap(const LibraryHeap &) = delete;
+  LibraryHeap &operator=(const LibraryHeap &) = delete;
+};
+
+class MemoryBudget {
+public:
+  /**
+   * Book a static block for the report (name must outlive the budget).
+   * Past BUDGET_MAX_ENTRIES the block still counts in the total and the
+   * report says how many were left unnamed; returns false then.
+   */
+  bool add(const char *name, size_t bytes) {
+    total_ += (uint32_t)bytes;
+    if (count_ == BUDGET_MAX_ENTRIES) {
+      overflowCount_++;
+      overflowBytes_ += (uint32_t)bytes;
+      return false;
+    }
+    names_[count_] = name;
+    bytes_[count_] = (uint32_t)bytes;
+    count_++;
+    return true;
+  }
+
+  uint32_t staticBytes() const { return total_; }
+
+  /**
+   * End of boot: from here on the firmware runs on its static blocks.
+   * assertOnAlloc makes a stray allocation (host) or heap drift (board)
+   * fatal instead of only reported.
+   */
+  void freeze(bool assertOnAlloc) {
+    frozen_ = true;
+    assert_ = assertOnAlloc;
+    baselineFree_ = ESP.getFreeHeap();
+    lowestFree_ = baselineFree_;
+#ifdef LIFELINE_HOST
+    host::heapFreeze(assertOnAlloc);
+#endif
+  }
+
+  bool frozen() const { return frozen_; }
+
+  /**
+   * Call from loop() now and then. Returns false once the free heap has
+   * sunk more than HEAP_DRIFT_LIMIT below the post-boot level; with
+   * assertOnAlloc that aborts after printing to out.
+   */
+  bool check(Print &out) {
+    if (!frozen_)
+      return true;
+    const uint32_t freeNow = ESP.getFreeHeap();
+    if (freeNow < lowestFree_)
+      lowestFree_ = freeNow;
+    if (tripped_ || driftBytes() <= HEAP_DRIFT_LIMIT)
+      return !tripped_;
+    tripped_ = true;
+    printfTo(out, "[MEM] Heap drifted %lu B below boot level (limit %u B)\n",
+             (unsigned long)driftBytes(), (unsigned)HEAP_DRIFT_LIMIT);
+    if (assert_)
+      abort();
+    return false;
+  }
+
+  /** Sink below the post-boot free heap so far (0 before freeze). */
+  uint32_t driftBytes() const {
+    return frozen_ && lowestFree_ < baselineFree_ ? baselineFree_ - lowestFree_
+                                                  : 0;
+  }
+
+  void printReport(Print &out) const {
+    for (uint8_t i = 0; i < count_; i++)
+      printfTo(out, "[MEM] %-16s %6lu B\n", names_[i],
+               (unsigned long)bytes_[i]);
+    if (overflowCount_)
+      printfTo(out, "[MEM] %u more blocks %6lu B (raise BUDGET_MAX_ENTRIES)\n",
+               overflowCount_, (unsigned long)overflowBytes_);
+    printfTo(out, "[MEM] static total %6lu B | heap free %lu KB, min %lu KB, "
+                  "largest %lu KB\n",
+             (unsigned long)total_, (unsigned long)(ESP.getFreeHeap() / 1024),
+             (unsigned long)(ESP.getMinFreeHeap() / 1024),
+             (unsigned long)(ESP.getMaxAllocHeap() / 1024));
+    if (frozen_)
+      printfTo(out, "[MEM] frozen at %lu KB free, drift %lu B (limit %u B)\n",
+               (unsigned long)(baselineFree_ / 1024),
+               (unsigned long)driftBytes(), (unsigned)HEAP_DRIFT_LIMIT);
+  }
+
+private:
+  const char *names_[BUDGET_MAX_ENTRIES] = {};
+  uint32_t bytes_[BUDGET_MAX_ENTRIES] = {};
+  uint8_t count_ = 0;
+  uint8_t overflowCount_ = 0; // Booked past BUDGET_MAX_ENTRIES
+  uint32_t overflowBytes_ = 0;
+  uint32_t total_ = 0;
+  bool frozen_ = false;
+  bool assert_ = false;
+  bool tripped_ = false;
+  uint32_t baselineFree_ = 0;
+  uint32_t lowestFree_ = 0;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_MEMORY_BUDGET_H
@@ -0,0 +1,169 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                     LIFELINE CORE - FIXED-BLOCK OBJECT POOL
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Packets, uplink records and reassembly buffers come and go for every
+ * frame. ObjectPool<T, N> keeps N blocks of T in static storage and hands
+ * them out through a lock-free free list, so neither the heap nor a mutex
+ * is involved:
+ *
+ *   lifeline::ObjectPool<RxPacket, 8> rxPackets;
+ *   RxPacket *p = rxPackets.create();   // nullptr when all 8 are out
+ *   ...
+ *   rxPackets.destroy(p);
+ *
+ * The free list is a Treiber stack over block indices. Its head carries a
+ * 16-bit tag that changes on every push and pop, so a pop that raced with a
+ * pop/push of the same block (ABA) fails its CAS and retries. Every
+ * operation is a single 32-bit CAS loop, with no lock and no wait on another
+ * context. That makes it safe from a task, from the other core, and from
+ * ISR-deferred callbacks (LoRa onReceive). allocate() and release() are not
+ * marked IRAM_ATTR, so they must not be called from a raw hardware ISR.
+ *
+ * Each pool keeps its own metrics (in use, high-water mark, failed
+ * allocations). printStats() prints them, and the pool's size goes into a
+ * MemoryBudget like any other static block.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_OBJECT_POOL_H
+#define LIFELINE_OBJECT_POOL_H
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+#include "MemoryBudget.h"
+
+namespace lifeline {
+
+template <typename T, uint16_t N> class ObjectPool {
+public:
+  static_assert(N > 0 && N < 0xFFFF, "pool holds 1..65534 blocks");
+
+  ObjectPool() {
+    for (uint16_t i = 0; i < N; i++)
+      next_[i].store(i + 1 < N ? (uint16_t)(i + 1) : NONE,
+                     std::memory_order_relaxed);
+    head_.store(0, std::memory_order_release);
+  }
+
+  ObjectPool(const ObjectPool &) = delete;
+  ObjectPool &operator=(const ObjectPool &) = delete;
+
+  /** Raw block for a T, or nullptr when the pool is empty. */
+  void *allocate() {
+    uint32_t head = head_.load(std::memory_order_acquire);
+    uint16_t i;
+    for (;;) {
+      i = (uint16_t)(head & 0xFFFF);
+      if (i == NONE) {
+        failures_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+      }
+      // Stale if another context took i meanwhile; the tag catches that
+      const uint16_t next = next_[i].load(std::memory_order_relaxed);
+      if (head_.compare_exchange_weak(head, retag(head, next),
+                                      std::memory_order_acquire,
+                                      std::memory_order_acquire))
+        break;
+    }
+    noteTaken();
+    return slots_[i].bytes;
+  }
+
+  /** Give a block back. Returns false for a pointer the pool does not own. */
+  bool release(void *block) {
+    const int32_t i = indexOf(block);
+    if (i < 0)
+      return false;
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    do {
+      next_[i].store((uint16_t)(head & 0xFFFF), std::memory_order_relaxed);
+    } while (!head_.compare_exchange_weak(head, retag(head, (uint16_t)i),
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed));
+    inUse_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /** allocate() and construct; nullptr when the pool is empty. */
+  template <typename... Args> T *create(Args &&...args) {
+    void *block = allocate();
+    return block ? new (block) T(std::forward<Args>(args)...) : nullptr;
+  }
+
+  /** Destroy and release (nullptr is ignored). */
+  void destroy(T *obj) {
+    if (!obj)
+      return;
+    obj->~T();
+    release(obj);
+  }
+
+  bool owns(const void *block) const { return indexOf(block) >= 0; }
+
+  uint16_t inUse() const { return inUse_.load(std::memory_order_relaxed); }
+  uint16_t available() const { return (uint16_t)(N - inUse()); }
+  /** Most blocks ever out at once. */
+  uint16_t highWater() const {
+    return highWater_.load(std::memory_order_relaxed);
+  }
+  /** allocate() calls that found the pool empty. */
+  uint32_t failures() const {
+    return failures_.load(std::memory_order_relaxed);
+  }
+  static constexpr uint16_t capacity() { return N; }
+  static constexpr size_t blockSize() { return sizeof(Slot); }
+
+  void printStats(Print &out, const char *name) const {
+    printfTo(out, "[POOL] %-14s %3u/%-3u in use, high %3u, failed %lu\n",
+             name, inUse(), N, highWater(), (unsigned long)failures());
+  }
+
+private:
+  static constexpr uint16_t NONE = 0xFFFF;
+
+  union Slot {
+    alignas(T) unsigned char bytes[sizeof(T)];
+  };
+
+  /** Head word for index i with the next tag. */
+  static uint32_t retag(uint32_t head, uint16_t i) {
+    return ((head & 0xFFFF0000u) + 0x10000u) | i;
+  }
+
+  int32_t indexOf(const void *block) const {
+    const unsigned char *p = (const unsigned char *)block;
+    const unsigned char *base = slots_[0].bytes;
+    if (p < base || p >= base + sizeof(slots_))
+      return -1;
+    const size_t off = (size_t)(p - base);
+    return off % sizeof(Slot) ? -1 : (int32_t)(off / sizeof(Slot));
+  }
+
+  void noteTaken() {
+    const uint16_t now = inUse_.fetch_add(1, std::memory_order_relaxed) + 1;
+    uint16_t high = highWater_.load(std::memory_order_relaxed);
+    while (now > high &&
+           !highWater_.compare_exchange_weak(high, now,
+                                             std::memory_order_relaxed))
+      ;
+  }
+
+  Slot slots_[N];
+  std::atomic<uint16_t> next_[N];
+  std::atomic<uint32_t> head_{0}; // tag << 16 | first free index
+  std::atomic<uint16_t> inUse_{0};
+  std::atomic<uint16_t> highWater_{0};
+  std::atomic<uint32_t> failures_{0};
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_OBJECT_POOL_H
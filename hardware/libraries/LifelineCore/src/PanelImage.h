@@ -0,0 +1,103 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                 LIFELINE CORE - RUN-LENGTH PANEL IMAGES
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Screen backgrounds rendered at build time (esp32txs: tools/bake_screens
+ * in the host build) and kept in flash as run-length RGB565. A background
+ * goes to the panel as one stream: a window, then fills and pixel rows, the
+ * same calls the drawing code makes:
+ *
+ *   lifeline::drawPanelImage(bg::MENU, out);              // whole screen
+ *   lifeline::drawPanelImage(bg::MENU, out, bg::MENU_LIST); // one field
+ *
+ *   Stream   16-bit words. n (1..0x7FFF) then a colour: n pixels of it.
+ *            0x8000 | n then n colours: pixels as they are. The runs go
+ *            through the image row-major and cross row ends.
+ *   Sink     Anything with window(x0, y0, x1, y1), fill(color, n) and
+ *            pixels(px, n): the panel, and ScreenCache.h.
+ *   Fields   FieldRect is a part of the screen the firmware draws over the
+ *            background (an alert name, a counter). Restoring one decodes
+ *            the stream and sends only the pixels inside it.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_PANEL_IMAGE_H
+#define LIFELINE_PANEL_IMAGE_H
+
+#include <stdint.h>
+
+namespace lifeline {
+
+static const uint16_t PANEL_IMAGE_LITERAL = 0x8000;
+
+struct PanelImage {
+  uint16_t width;
+  uint16_t height;
+  const uint16_t *words;
+  uint32_t count;
+};
+
+struct FieldRect {
+  uint16_t x, y, w, h;
+};
+
+/** The whole image through out, from (0, 0). */
+template <typename Sink>
+void drawPanelImage(const PanelImage &img, Sink &out) {
+  if (!img.count)
+    return;
+  out.window(0, 0, img.width - 1, img.height - 1);
+  uint32_t i = 0;
+  while (i < img.count) {
+    const uint16_t t = img.words[i++];
+    const uint16_t n = t & ~PANEL_IMAGE_LITERAL;
+    if (t & PANEL_IMAGE_LITERAL) {
+      out.pixels(img.words + i, n);
+      i += n;
+    } else {
+      out.fill(img.words[i++], n);
+    }
+  }
+}
+
+/** Only the pixels inside r (in a window of r). */
+template <typename Sink>
+void drawPanelImage(const PanelImage &img, Sink &out, const FieldRect &r) {
+  if (!img.count || !r.w || !r.h)
+    return;
+  out.window(r.x, r.y, r.x + r.w - 1, r.y + r.h - 1);
+  const uint32_t end = (uint32_t)(r.y + r.h) * img.width; // Past the rect
+  uint32_t pos = 0, i = 0;
+  while (i < img.count && pos < end) {
+    const uint16_t t = img.words[i++];
+    const bool literal = t & PANEL_IMAGE_LITERAL;
+    uint32_t n = t & ~PANEL_IMAGE_LITERAL;
+    const uint16_t *px = img.words + i;
+    i += literal ? n : 1;
+    // One row piece of the run at a time
+    while (n) {
+      const uint16_t y = (uint16_t)(pos / img.width);
+      const uint16_t x = (uint16_t)(pos % img.width);
+      const uint32_t k = n < (uint32_t)(img.width - x) ? n : img.width - x;
+      if (y >= r.y && y < r.y + r.h) {
+        const uint16_t a = x > r.x ? x : r.x;
+        const uint32_t b = x + k < (uint32_t)(r.x + r.w) ? x + k : r.x + r.w;
+        if (a < b) {
+          if (literal)
+            out.pixels(px + (a - x), b - a);
+          else
+            out.fill(*px, b - a);
+        }
+      }
+      if (literal)
+        px += k;
+      pos += k;
+      n -= k;
+    }
+  }
+}
+
+} // namespace lifeline
+
+#endif // LIFELINE_PANEL_IMAGE_H
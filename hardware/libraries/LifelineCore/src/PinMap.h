@@ -0,0 +1,187 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                  LIFELINE CORE - PARALLEL BUS PIN MAP
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * An 8080-style 8-bit panel bus is eight GPIOs scattered over the two
+ * output banks (GPIO 0-31 in GPIO_OUT, 32 and up in GPIO_OUT1). Writing a
+ * byte means turning it into set/clear masks for each bank. Here the pin
+ * list is a template argument, and the masks come from nibble tables built
+ * at compile time from it. A bus write is therefore two table loads and
+ * one OR per bank, two register writes per bank and the WR strobe, with no
+ * branch on the data and no per-bit loop. A bank with no data pin compiles
+ * away.
+ *
+ *   typedef lifeline::ParallelBus8<TFT_WR, TFT_D0, TFT_D1, TFT_D2, TFT_D3,
+ *                                  TFT_D4, TFT_D5, TFT_D6, TFT_D7> TftBus;
+ *   TftBus::begin();       // pins to OUTPUT, WR idle high
+ *   TftBus::write(0x2C);   // data, then WR low → high
+ *
+ * Rewiring a board is editing its TFT_Dn defines; nothing else changes.
+ * C++11 constexpr only, so it builds on every Arduino-ESP32 core.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_PIN_MAP_H
+#define LIFELINE_PIN_MAP_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include <soc/gpio_reg.h>
+
+#ifndef PINMAP_GPIO_COUNT
+#define PINMAP_GPIO_COUNT 49 // GPIO 0-48 (ESP32-S3); the ESP32 stops at 39
+#endif
+
+namespace lifeline {
+
+namespace pinmap_detail {
+
+template <uint8_t... I> struct Seq {};
+template <uint8_t N, uint8_t... I>
+struct MakeSeq : MakeSeq<N - 1, N - 1, I...> {};
+template <uint8_t... I> struct MakeSeq<0, I...> { typedef Seq<I...> type; };
+
+/** Register bit of pin in bank (0 or 1); 0 when the pin is in the other. */
+constexpr uint32_t bankBit(uint8_t pin, uint8_t bank) {
+  return (pin >> 5) == bank ? (uint32_t)1 << (pin & 31) : 0;
+}
+
+/** Data lines D0 (LSB) .. D7 and the bank masks they produce. */
+template <uint8_t D0, uint8_t D1, uint8_t D2, uint8_t D3, uint8_t D4,
+          uint8_t D5, uint8_t D6, uint8_t D7>
+struct Lines {
+  /** Bank register bit of data line i (0..7). */
+  static constexpr uint32_t lineBit(uint8_t i, uint8_t bank) {
+    return bankBit(i == 0   ? D0
+                   : i == 1 ? D1
+                   : i == 2 ? D2
+                   : i == 3 ? D3
+                   : i == 4 ? D4
+                   : i == 5 ? D5
+                   : i == 6 ? D6
+                            : D7,
+                   bank);
+  }
+
+  /** Bits to set in bank for data byte d (lines i..7). */
+  static constexpr uint32_t setMask(uint8_t bank, uint8_t d, uint8_t i = 0) {
+    return i == 8 ? 0
+                  : (((d >> i) & 1) ? lineBit(i, bank) : 0) |
+                        setMask(bank, d, (uint8_t)(i + 1));
+  }
+};
+
+template <typename L, typename S> struct NibbleTables;
+
+/**
+ * set[bank][half][v]: bank's set mask for nibble v in the low (half 0) or
+ * high (half 1) four data bits.
+ */
+template <typename L, uint8_t... V> struct NibbleTables<L, Seq<V...>> {
+  static constexpr uint32_t set[2][2][16] = {
+      {{L::setMask(0, V)...}, {L::setMask(0, (uint8_t)(V << 4))...}},
+      {{L::setMask(1, V)...}, {L::setMask(1, (uint8_t)(V << 4))...}}};
+};
+
+template <typename L, uint8_t... V>
+constexpr uint32_t NibbleTables<L, Seq<V...>>::set[2][2][16];
+
+} // namespace pinmap_detail
+
+/**
+ * 8-bit write-only bus: WR strobe plus D0 (LSB) .. D7. Every member is
+ * static; one instantiation per board wiring.
+ */
+template <uint8_t WR, uint8_t D0, uint8_t D1, uint8_t D2, uint8_t D3,
+          uint8_t D4, uint8_t D5, uint8_t D6, uint8_t D7>
+class ParallelBus8 {
+public:
+  typedef pinmap_detail::Lines<D0, D1, D2, D3, D4, D5, D6, D7> DataLines;
+
+  /** Bits to set in bank (0: GPIO_OUT, 1: GPIO_OUT1) for data byte d. */
+  static constexpr uint32_t setMask(uint8_t bank, uint8_t d) {
+    return DataLines::setMask(bank, d);
+  }
+
+  /** GPIO of data line i (0: D0 .. 7: D7), for a peripheral that drives
+   *  the same wiring (LCD_CAM i80, see I80Panel.h). */
+  static constexpr uint8_t dataPin(uint8_t i) {
+    return i == 0   ? D0
+           : i == 1 ? D1
+           : i == 2 ? D2
+           : i == 3 ? D3
+           : i == 4 ? D4
+           : i == 5 ? D5
+           : i == 6 ? D6
+                    : D7;
+  }
+  static constexpr uint8_t WR_PIN = WR;
+
+  static constexpr uint32_t BANK0_MASK = DataLines::setMask(0, 0xFF);
+  static constexpr uint32_t BANK1_MASK = DataLines::setMask(1, 0xFF);
+
+  static_assert(D0 < PINMAP_GPIO_COUNT && D1 < PINMAP_GPIO_COUNT &&
+                    D2 < PINMAP_GPIO_COUNT && D3 < PINMAP_GPIO_COUNT &&
+                    D4 < PINMAP_GPIO_COUNT && D5 < PINMAP_GPIO_COUNT &&
+                    D6 < PINMAP_GPIO_COUNT && D7 < PINMAP_GPIO_COUNT &&
+                    WR < PINMAP_GPIO_COUNT,
+                "bus pin out of GPIO range");
+  static_assert(__builtin_popcount(BANK0_MASK) +
+                        __builtin_popcount(BANK1_MASK) ==
+                    8,
+                "data pins must be eight distinct GPIOs");
+  static_assert(!(pinmap_detail::bankBit(WR, 0) & BANK0_MASK) &&
+                    !(pinmap_detail::bankBit(WR, 1) & BANK1_MASK),
+                "WR must not be a data pin");
+
+  /** Data pins and WR to OUTPUT, WR idle high. */
+  static void begin() {
+    const uint8_t pins[] = {D0, D1, D2, D3, D4, D5, D6, D7};
+    for (uint8_t i = 0; i < 8; i++)
+      pinMode(pins[i], OUTPUT);
+    pinMode(WR, OUTPUT);
+    REG_WRITE(WR < 32 ? GPIO_OUT_W1TS_REG : GPIO_OUT1_W1TS_REG, WR_BIT);
+  }
+
+  /** Put d on the bus and strobe WR (the panel latches on the rising edge). */
+  static inline void write(uint8_t d) {
+    typedef pinmap_detail::NibbleTables<
+        DataLines, typename pinmap_detail::MakeSeq<16>::type>
+        Tables;
+    if (BANK0_MASK) {
+      const uint32_t s =
+          Tables::set[0][0][d & 0x0F] | Tables::set[0][1][d >> 4];
+      REG_WRITE(GPIO_OUT_W1TS_REG, s);
+      REG_WRITE(GPIO_OUT_W1TC_REG, BANK0_MASK & ~s);
+    }
+    if (BANK1_MASK) {
+      const uint32_t s =
+          Tables::set[1][0][d & 0x0F] | Tables::set[1][1][d >> 4];
+      REG_WRITE(GPIO_OUT1_W1TS_REG, s);
+      REG_WRITE(GPIO_OUT1_W1TC_REG, BANK1_MASK & ~s);
+    }
+    REG_WRITE(WR < 32 ? GPIO_OUT_W1TC_REG : GPIO_OUT1_W1TC_REG, WR_BIT);
+    REG_WRITE(WR < 32 ? GPIO_OUT_W1TS_REG : GPIO_OUT1_W1TS_REG, WR_BIT);
+  }
+
+private:
+  static constexpr uint32_t WR_BIT = (uint32_t)1 << (WR & 31);
+};
+
+template <uint8_t WR, uint8_t D0, uint8_t D1, uint8_t D2, uint8_t D3,
+          uint8_t D4, uint8_t D5, uint8_t D6, uint8_t D7>
+constexpr uint32_t
+    ParallelBus8<WR, D0, D1, D2, D3, D4, D5, D6, D7>::BANK0_MASK;
+template <uint8_t WR, uint8_t D0, uint8_t D1, uint8_t D2, uint8_t D3,
+          uint8_t D4, uint8_t D5, uint8_t D6, uint8_t D7>
+constexpr uint32_t
+    ParallelBus8<WR, D0, D1, D2, D3, D4, D5, D6, D7>::BANK1_MASK;
+template <uint8_t WR, uint8_t D0, uint8_t D1, uint8_t D2, uint8_t D3,
+          uint8_t D4, uint8_t D5, uint8_t D6, uint8_t D7>
+constexpr uint8_t ParallelBus8<WR, D0, D1, D2, D3, D4, D5, D6, D7>::WR_PIN;
+
+} // namespace lifeline
+
+#endif // LIFELINE_PIN_MAP_H
@@ -0,0 +1,321 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                 LIFELINE CORE - PER-DEVICE ALERT RATE LIMIT
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * A stuck key or a faulty sensor trigger on one handheld can send alert
+ * after alert. Each one would cost an uplink, push notifications and email,
+ * and would fill the inbox. The gateway gives every device a token bucket,
+ * so a unit that floods loses its own alerts and nobody else's:
+ *
+ *   lifeline::RateLimiter<> limiter;
+ *   if (limiter.admit(deviceId, priority == 0, millis()) == lifeline::RATE_SUPPRESS)
+ *     return;                                  // Counted, not handled
+ *   uint32_t since;
+ *   const uint32_t n = limiter.takeSuppressed(deviceId, since);   // For the uplink
+ *   uint16_t quiet;                                          // In loop():
+ *   const uint32_t m = limiter.takeOverdue(millis(), 60000, quiet, since);
+ *
+ *   Bucket    burst alerts back to back, then perMinute per minute. Tokens
+ *             are counted in thousandths, so slow rates refill smoothly.
+ *   Critical  A critical alert that finds the bucket empty may still use the
+ *             criticalBurst reserve. The same refill tops the reserve up once
+ *             the bucket is full. A stuck SOS key is limited too, only later.
+ *   Counted   An alert the limit keeps out is never dropped silently. It is
+ *             counted on the device, and takeSuppressed() hands the count to
+ *             the device's next alert that gets through. A device that
+ *             floods and then goes quiet has no next alert: takeOverdue()
+ *             hands out counts that have waited too long, to be reported
+ *             on their own.
+ *   Table     RATE_LIMIT_SLOTS devices, found by a linear scan. A new device
+ *             in a full table takes the slot of the one heard least recently.
+ *             Counts it had not reported yet wait in RATE_HANDOFF_SLOTS
+ *             for takeOverdue(). Only past those are they lost (lostCounts).
+ *
+ * perMinute 0 turns the limit off.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_RATE_LIMITER_H
+#define LIFELINE_RATE_LIMITER_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "MemoryBudget.h" // printfTo(): the gateway runs with the heap frozen
+
+#ifndef RATE_LIMIT_SLOTS
+#define RATE_LIMIT_SLOTS 32 // Devices tracked (32 bytes each)
+#endif
+#ifndef RATE_PER_MINUTE
+#define RATE_PER_MINUTE 6 // Sustained alerts per device
+#endif
+#ifndef RATE_BURST
+#define RATE_BURST 4 // Alerts a device may send back to back
+#endif
+#ifndef RATE_CRITICAL_BURST
+#define RATE_CRITICAL_BURST 6 // Further critical alerts once the burst is spent
+#endif
+#ifndef RATE_HANDOFF_SLOTS
+#define RATE_HANDOFF_SLOTS 4 // Unreported counts of evicted devices
+#endif
+
+namespace lifeline {
+
+struct RateLimits {
+  uint8_t perMinute = RATE_PER_MINUTE; // 0: no limit
+  uint8_t burst = RATE_BURST;          // At least 1
+  uint8_t criticalBurst = RATE_CRITICAL_BURST;
+};
+
+enum RateVerdict : uint8_t {
+  RATE_PASS,
+  RATE_PASS_CRITICAL, // Taken from the critical reserve
+  RATE_SUPPRESS,
+};
+
+struct RateEntry {
+  uint32_t tokens;         // Thousandths, up to burst x 1000
+  uint32_t reserve;        // Critical reserve, thousandths
+  uint32_t refillMs;       // Refilled up to here
+  uint32_t lastSeenMs;
+  uint32_t pending;        // Suppressed since the last takeSuppressed()
+  uint32_t pendingSinceMs; // First of those
+  uint32_t suppressed;     // Since boot
+  uint16_t deviceId;
+  bool used;
+};
+
+/** Suppressions of a device evicted before they were reported. */
+struct RateHandoff {
+  uint32_t pending;
+  uint32_t pendingSinceMs;
+  uint16_t deviceId;
+};
+
+template <uint8_t SLOTS = RATE_LIMIT_SLOTS> class RateLimiter {
+public:
+  struct Stats {
+    uint32_t admitted = 0;
+    uint32_t critical = 0;   // Admitted on the critical reserve
+    uint32_t suppressed = 0;
+    uint32_t evicted = 0;    // Devices dropped for a new one
+    uint32_t handedOff = 0;  // Evicted with suppressions not yet reported
+    uint32_t lostCounts = 0; // Suppressions the handoff had no room for
+  };
+
+  /** New limits apply at once; fuller buckets are cut to the new size. */
+  void setLimits(const RateLimits &limits) {
+    limits_ = limits;
+    if (limits_.burst == 0)
+      limits_.burst = 1;
+    for (uint8_t i = 0; i < SLOTS; i++) {
+      RateEntry &e = slots_[i];
+      if (e.tokens > limits_.burst * 1000u)
+        e.tokens = limits_.burst * 1000u;
+      if (e.reserve > limits_.criticalBurst * 1000u)
+        e.reserve = limits_.criticalBurst * 1000u;
+    }
+  }
+  const RateLimits &limits() const { return limits_; }
+
+  /** One alert from deviceId. critical: it may use the critical reserve. */
+  RateVerdict admit(uint16_t deviceId, bool critical, uint32_t nowMs) {
+    if (limits_.perMinute == 0) {
+      stats_.admitted++;
+      return RATE_PASS;
+    }
+    RateEntry &e = entry(deviceId, nowMs);
+    refill(e, nowMs);
+    e.lastSeenMs = nowMs;
+    if (e.tokens >= 1000) {
+      e.tokens -= 1000;
+      stats_.admitted++;
+      return RATE_PASS;
+    }
+    if (critical && e.reserve >= 1000) {
+      e.reserve -= 1000;
+      stats_.admitted++;
+      stats_.critical++;
+      return RATE_PASS_CRITICAL;
+    }
+    if (!e.pending)
+      e.pendingSinceMs = nowMs;
+    e.pending++;
+    e.suppressed++;
+    stats_.suppressed++;
+    return RATE_SUPPRESS;
+  }
+
+  /**
+   * Suppressed alerts from deviceId not yet reported, and when the first
+   * of them arrived. Reported once: the count starts again from 0.
+   */
+  uint32_t takeSuppressed(uint16_t deviceId, uint32_t &sinceMs) {
+    const int i = indexOf(deviceId);
+    if (i < 0 || !slots_[i].pending)
+      return 0;
+    const uint32_t n = slots_[i].pending;
+    sinceMs = slots_[i].pendingSinceMs;
+    slots_[i].pending = 0;
+    return n;
+  }
+
+  /**
+   * One device whose suppressed alerts have waited afterMs or more without
+   * an alert to carry them, or that was evicted with some: the count, its
+   * id and when the first arrived. 0 when there is none. Reported once.
+   * Evicted devices come first, then the count that has waited longest.
+   */
+  uint32_t takeOverdue(uint32_t nowMs, uint32_t afterMs, uint16_t &deviceId,
+                       uint32_t &sinceMs) {
+    if (handoffCount_) {
+      const RateHandoff &h = handoff_[--handoffCount_];
+      deviceId = h.deviceId;
+      sinceMs = h.pendingSinceMs;
+      return h.pending;
+    }
+    int oldest = -1;
+    for (uint8_t i = 0; i < SLOTS; i++) {
+      const RateEntry &e = slots_[i];
+      if (!e.used || !e.pending || nowMs - e.pendingSinceMs < afterMs)
+        continue;
+      if (oldest < 0 ||
+          (int32_t)(e.pendingSinceMs - slots_[oldest].pendingSinceMs) < 0)
+        oldest = i;
+    }
+    if (oldest < 0)
+      return 0;
+    deviceId = slots_[oldest].deviceId;
+    return takeSuppressed(deviceId, sinceMs);
+  }
+
+  const RateEntry *find(uint16_t deviceId) const {
+    const int i = indexOf(deviceId);
+    return i < 0 ? nullptr : &slots_[i];
+  }
+
+  /** Devices with suppressed alerts not yet reported. */
+  uint8_t suppressing() const {
+    uint8_t n = handoffCount_;
+    for (uint8_t i = 0; i < SLOTS; i++)
+      n += slots_[i].used && slots_[i].pending > 0;
+    return n;
+  }
+
+  static constexpr uint8_t capacity() { return SLOTS; }
+  const Stats &stats() const { return stats_; }
+
+  void printReport(Print &out, uint32_t nowMs) const {
+    if (limits_.perMinute == 0) {
+      printfTo(out, "[RATE] Off; %lu alerts\n", (unsigned long)stats_.admitted);
+      return;
+    }
+    printfTo(out, "[RATE] %u/min per device, burst %u, critical +%u; %lu "
+                  "admitted (%lu on the critical reserve), %lu suppressed, "
+                  "%lu evicted (%lu with counts, %lu counts lost)\n",
+             limits_.perMinute, limits_.burst, limits_.criticalBurst,
+             (unsigned long)stats_.admitted, (unsigned long)stats_.critical,
+             (unsigned long)stats_.suppressed, (unsigned long)stats_.evicted,
+             (unsigned long)stats_.handedOff,
+             (unsigned long)stats_.lostCounts);
+    for (uint8_t i = 0; i < SLOTS; i++) {
+      const RateEntry &e = slots_[i];
+      if (!e.used || !e.suppressed)
+        continue;
+      printfTo(out, "[RATE] TX #%03u %lu suppressed, %lu not reported yet",
+               e.deviceId, (unsigned long)e.suppressed,
+               (unsigned long)e.pending);
+      if (e.pending)
+        printfTo(out, " (first %lu s ago)",
+                 (unsigned long)((nowMs - e.pendingSinceMs) / 1000));
+      out.println();
+    }
+  }
+
+private:
+  int indexOf(uint16_t deviceId) const {
+    for (uint8_t i = 0; i < SLOTS; i++) {
+      if (slots_[i].used && slots_[i].deviceId == deviceId)
+        return i;
+    }
+    return -1;
+  }
+
+  /** deviceId's entry; a new one starts with full buckets. */
+  RateEntry &entry(uint16_t deviceId, uint32_t nowMs) {
+    uint8_t slot = SLOTS, stalest = 0;
+    for (uint8_t i = 0; i < SLOTS; i++) {
+      const RateEntry &e = slots_[i];
+      if (!e.used) {
+        if (slot == SLOTS)
+          slot = i;
+        continue;
+      }
+      if (e.deviceId == deviceId)
+        return slots_[i];
+      if ((int32_t)(e.lastSeenMs - slots_[stalest].lastSeenMs) < 0)
+        stalest = i;
+    }
+    if (slot == SLOTS) {
+      // Full: every slot is used, so stalest is a real device
+      slot = stalest;
+      stats_.evicted++;
+      handOff(slots_[slot]);
+    }
+    RateEntry &e = slots_[slot];
+    e = RateEntry();
+    e.deviceId = deviceId;
+    e.tokens = limits_.burst * 1000u;
+    e.reserve = limits_.criticalBurst * 1000u;
+    e.refillMs = nowMs;
+    e.used = true;
+    return e;
+  }
+
+  /** Keep an evicted device's unreported count for takeOverdue(). */
+  void handOff(const RateEntry &e) {
+    if (!e.pending)
+      return;
+    if (handoffCount_ == RATE_HANDOFF_SLOTS) {
+      stats_.lostCounts += e.pending;
+      return;
+    }
+    RateHandoff &h = handoff_[handoffCount_++];
+    h.pending = e.pending;
+    h.pendingSinceMs = e.pendingSinceMs;
+    h.deviceId = e.deviceId;
+    stats_.handedOff++;
+  }
+
+  /** perMinute tokens a minute: the bucket first, then the reserve. */
+  void refill(RateEntry &e, uint32_t nowMs) {
+    const uint32_t bucket = limits_.burst * 1000u;
+    const uint32_t reserve = limits_.criticalBurst * 1000u;
+    if (e.tokens >= bucket && e.reserve >= reserve) {
+      e.refillMs = nowMs;
+      return;
+    }
+    const uint32_t elapsed = nowMs - e.refillMs;
+    uint32_t add = (uint32_t)((uint64_t)elapsed * limits_.perMinute / 60);
+    if (!add)
+      return;
+    // Keep the part of a thousandth not yet earned for the next call
+    e.refillMs += (uint32_t)((uint64_t)add * 60 / limits_.perMinute);
+    const uint32_t toBucket = add < bucket - e.tokens ? add : bucket - e.tokens;
+    e.tokens += toBucket;
+    add -= toBucket;
+    if (e.reserve < reserve)
+      e.reserve = add < reserve - e.reserve ? e.reserve + add : reserve;
+  }
+
+  RateEntry slots_[SLOTS] = {};
+  RateHandoff handoff_[RATE_HANDOFF_SLOTS] = {};
+  uint8_t handoffCount_ = 0;
+  RateLimits limits_;
+  Stats stats_;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_RATE_LIMITER_H
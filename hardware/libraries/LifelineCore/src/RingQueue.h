@@ -0,0 +1,255 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                   LIFELINE CORE - LOCK-FREE RING QUEUES
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Hand-off between the radio, UI and uplink contexts without a FreeRTOS
+ * queue copying every record through a critical section. Records stay in
+ * an ObjectPool and the queues carry pointers to them:
+ *
+ *   SpscQueue<T, N>    one producer, one consumer (LoRa callback → loop).
+ *                      A push or pop is one acquire load and one release
+ *                      store, plus a reload of the other side's index only
+ *                      when the cached copy says full/empty.
+ *   MpscQueue<T, N>    any number of producers, one consumer (radio, serial
+ *                      and portal → uplink worker). Each cell carries a
+ *                      sequence number (Vyukov's bounded queue), and a
+ *                      producer claims a cell with one CAS.
+ *   NotifyingQueue<Q>  either of the above plus a blocking pop(timeout)
+ *                      for the consumer task, woken by a direct-to-task
+ *                      notification instead of polling.
+ *
+ *   lifeline::NotifyingQueue<lifeline::MpscQueue<UplinkRecord *, 16>> uplinks;
+ *   uplinks.push(rec);                          // any task
+ *   UplinkRecord *rec;
+ *   if (uplinks.pop(rec, 1000)) send(rec);      // the uplink task
+ *
+ * N is a power of two. Producer and consumer indices sit on separate
+ * QUEUE_CACHE_LINE-aligned lines, so contexts on two cores do not share a
+ * line. Internal SRAM on the ESP32 is not cached, but PSRAM on the S3 is,
+ * in 32-byte lines. Like ObjectPool these are fine from ISR-deferred
+ * callbacks but are not IRAM_ATTR, so not from a raw ISR.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_RING_QUEUE_H
+#define LIFELINE_RING_QUEUE_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#ifndef QUEUE_CACHE_LINE
+#ifdef LIFELINE_HOST
+#define QUEUE_CACHE_LINE 64 // x86/ARM hosts
+#else
+#define QUEUE_CACHE_LINE 32 // ESP32-S3 PSRAM cache line
+#endif
+#endif
+
+namespace lifeline {
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                          SINGLE PRODUCER / CONSUMER
+// ═══════════════════════════════════════════════════════════════════════════
+
+template <typename T, uint16_t N> class SpscQueue {
+public:
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "N must be a power of two");
+  typedef T value_type;
+
+  /** Producer side. False (and counted) when the queue is full. */
+  bool push(const T &v) {
+    const uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - headCache_ == N) {
+      headCache_ = head_.load(std::memory_order_acquire);
+      if (tail - headCache_ == N) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+    }
+    items_[tail & (N - 1)] = v;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /** Consumer side. False when the queue is empty. */
+  bool pop(T &out) {
+    const uint32_t head = head_.load(std::memory_order_relaxed);
+    if (head == tailCache_) {
+      tailCache_ = tail_.load(std::memory_order_acquire);
+      if (head == tailCache_)
+        return false;
+    }
+    out = items_[head & (N - 1)];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /** Exact from either side when the other is idle, a snapshot otherwise. */
+  uint16_t size() const {
+    return (uint16_t)(tail_.load(std::memory_order_acquire) -
+                      head_.load(std::memory_order_acquire));
+  }
+  bool empty() const { return size() == 0; }
+  /** push() calls that found the queue full. */
+  uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+  static constexpr uint16_t capacity() { return N; }
+
+private:
+  // Producer's line
+  alignas(QUEUE_CACHE_LINE) std::atomic<uint32_t> tail_{0};
+  uint32_t headCache_ = 0;
+  std::atomic<uint32_t> dropped_{0};
+  // Consumer's line
+  alignas(QUEUE_CACHE_LINE) std::atomic<uint32_t> head_{0};
+  uint32_t tailCache_ = 0;
+  alignas(QUEUE_CACHE_LINE) T items_[N] = {};
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                          MULTI PRODUCER / ONE CONSUMER
+// ═══════════════════════════════════════════════════════════════════════════
+
+template <typename T, uint16_t N> class MpscQueue {
+public:
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "N must be a power of two");
+  typedef T value_type;
+
+  MpscQueue() {
+    for (uint32_t i = 0; i < N; i++)
+      cells_[i].seq.store(i, std::memory_order_relaxed);
+  }
+
+  /** Any producer. False (and counted) when the queue is full. */
+  bool push(const T &v) {
+    uint32_t pos = tail_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = &cells_[pos & (N - 1)];
+      const uint32_t seq = cell->seq.load(std::memory_order_acquire);
+      const int32_t diff = (int32_t)(seq - pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false; // The consumer has not freed this lap's cell yet
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+    cell->value = v;
+    cell->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /** The consumer. False when empty or the oldest push is still writing. */
+  bool pop(T &out) {
+    const uint32_t head = head_.load(std::memory_order_relaxed);
+    Cell &cell = cells_[head & (N - 1)];
+    const uint32_t seq = cell.seq.load(std::memory_order_acquire);
+    if ((int32_t)(seq - (head + 1)) < 0)
+      return false;
+    out = cell.value;
+    cell.seq.store(head + N, std::memory_order_release);
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /** Claimed cells not yet popped (a snapshot). */
+  uint16_t size() const {
+    return (uint16_t)(tail_.load(std::memory_order_acquire) -
+                      head_.load(std::memory_order_acquire));
+  }
+  bool empty() const { return size() == 0; }
+  uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+  static constexpr uint16_t capacity() { return N; }
+
+private:
+  struct Cell {
+    std::atomic<uint32_t> seq;
+    T value = T();
+  };
+
+  // Producers' line
+  alignas(QUEUE_CACHE_LINE) std::atomic<uint32_t> tail_{0};
+  std::atomic<uint32_t> dropped_{0};
+  // Consumer's line
+  alignas(QUEUE_CACHE_LINE) std::atomic<uint32_t> head_{0};
+  alignas(QUEUE_CACHE_LINE) Cell cells_[N];
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+//                             BLOCKING ADAPTER
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * Queue Q whose consumer task sleeps in pop(out, timeoutMs) until a push
+ * notifies it. The consumer is the task given to setConsumer() or else the
+ * first caller of the blocking pop(). Set it before the producers start: a
+ * push racing that first pop() may not wake it before the timeout.
+ */
+template <typename Q> class NotifyingQueue : public Q {
+public:
+  typedef typename Q::value_type T;
+  using Q::pop;
+
+  void setConsumer(TaskHandle_t task) {
+    consumer_.store(task, std::memory_order_release);
+  }
+
+  bool push(const T &v) {
+    if (!Q::push(v))
+      return false;
+    TaskHandle_t task = consumer_.load(std::memory_order_acquire);
+    if (task)
+      xTaskNotifyGive(task);
+    return true;
+  }
+
+  /** From an ISR-deferred callback; *woken as for vTaskNotifyGiveFromISR. */
+  bool pushFromISR(const T &v, BaseType_t *woken) {
+    if (!Q::push(v))
+      return false;
+    TaskHandle_t task = consumer_.load(std::memory_order_acquire);
+    if (task)
+      vTaskNotifyGiveFromISR(task, woken);
+    return true;
+  }
+
+  /** Wait up to timeoutMs (portMAX_DELAY: forever) for an item. */
+  bool pop(T &out, uint32_t timeoutMs) {
+    if (!consumer_.load(std::memory_order_acquire))
+      setConsumer(xTaskGetCurrentTaskHandle());
+    if (Q::pop(out))
+      return true;
+    const TickType_t start = xTaskGetTickCount();
+    const TickType_t wait =
+        timeoutMs == portMAX_DELAY ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+    for (;;) {
+      TickType_t left = portMAX_DELAY;
+      if (wait != portMAX_DELAY) {
+        const TickType_t spent = xTaskGetTickCount() - start;
+        if (spent >= wait)
+          return Q::pop(out);
+        left = wait - spent;
+      }
+      ulTaskNotifyTake(pdTRUE, left);
+      if (Q::pop(out))
+        return true;
+    }
+  }
+
+private:
+  std::atomic<TaskHandle_t> consumer_{nullptr};
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_RING_QUEUE_H
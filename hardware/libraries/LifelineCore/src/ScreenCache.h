@@ -0,0 +1,267 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                  LIFELINE CORE - SCREEN SNAPSHOTS IN PSRAM
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * The S3 TX moves between the same few screens: menu, confirm, sending,
+ * result, menu. Drawing one from primitives is thousands of small fills;
+ * its time grows with what is on it. ScreenCache keeps the last drawn
+ * image of a screen (or of its static layer) in PSRAM, so a revisit is one
+ * full-frame blit whatever the screen holds:
+ *
+ *   lifeline::ScreenCache<> screens;
+ *   screens.begin(480, 320);                   // false: no PSRAM, no cache
+ *   if (const uint8_t *f = screens.find(MENU, hash)) {
+ *     tft.setAddressWindow(0, 0, 479, 319);
+ *     tft.pushStored(f, 480 * 320);            // DMA straight from PSRAM
+ *   } else {
+ *     screens.record(MENU, hash);
+ *     drawMenu();                              // every window/fill mirrored
+ *     screens.commit();
+ *   }
+ *   drawOverlays();                            // the fields that change
+ *
+ *   Key      A screen ID and a hash (fnv1a()) of everything its static
+ *            layer shows: the selected alert, the language. A changed
+ *            field is a different key, so nothing is invalidated by hand.
+ *   Record   The drawing code sends every window(), fill() and pixels()
+ *            it gives the panel here too. They land in the frame at the
+ *            panel's cursor, in its byte order (big-endian RGB565). A
+ *            static layer paints every pixel: the screens start with a
+ *            full-screen background.
+ *   Slots    SCREEN_CACHE_SLOTS frames of w * h * 2 bytes, least recently
+ *            used replaced first. The frame last shown may still be on
+ *            the bus and is never the one recorded over.
+ *
+ * Everything runs in the loop task. esp_lcd writes the cache back before
+ * it sends from PSRAM.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_SCREEN_CACHE_H
+#define LIFELINE_SCREEN_CACHE_H
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef SCREEN_CACHE_SLOTS
+#define SCREEN_CACHE_SLOTS 4 // 480x320 frames: 300 KB of PSRAM each
+#endif
+
+namespace lifeline {
+
+/** FNV-1a over n bytes; pass the previous result as h to chain fields. */
+inline uint32_t fnv1a(const void *data, size_t n, uint32_t h = 2166136261u) {
+  const uint8_t *p = (const uint8_t *)data;
+  for (size_t i = 0; i < n; i++)
+    h = (h ^ p[i]) * 16777619u;
+  return h;
+}
+
+template <uint8_t SLOTS = SCREEN_CACHE_SLOTS> class ScreenCache {
+  static_assert(SLOTS >= 2, "the frame on the bus is never recorded over");
+
+public:
+  struct Stats {
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t evictions = 0;    // A valid frame recorded over
+    uint32_t lastRenderUs = 0; // Drawing time of the last recording
+    uint32_t maxRenderUs = 0;
+  };
+
+  ~ScreenCache() {
+    for (uint8_t i = 0; i < SLOTS; i++)
+      heap_caps_free(frames_[i].buf);
+  }
+
+  /** Frames of w x h in PSRAM. False (no cache) without room for two. */
+  bool begin(uint16_t w, uint16_t h) {
+    w_ = w;
+    h_ = h;
+    count_ = 0;
+    for (uint8_t i = 0; i < SLOTS; i++) {
+      frames_[i].buf = (uint8_t *)heap_caps_aligned_alloc(
+          64, frameBytes(), MALLOC_CAP_SPIRAM);
+      if (!frames_[i].buf)
+        break;
+      count_++;
+    }
+    if (count_ < 2) {
+      for (uint8_t i = 0; i < count_; i++) {
+        heap_caps_free(frames_[i].buf);
+        frames_[i].buf = nullptr;
+      }
+      count_ = 0;
+    }
+    return count_ > 0;
+  }
+
+  bool ready() const { return count_ > 0; }
+  uint8_t frames() const { return count_; }
+  uint32_t frameBytes() const { return (uint32_t)w_ * h_ * 2; }
+  bool recording() const { return rec_ >= 0; }
+
+  /** The stored frame of (id, hash), or nullptr: draw and record it. */
+  const uint8_t *find(uint8_t id, uint32_t hash) {
+    if (!count_)
+      return nullptr;
+    for (uint8_t i = 0; i < count_; i++) {
+      Frame &f = frames_[i];
+      if (f.valid && f.id == id && f.hash == hash) {
+        f.used = ++tick_;
+        shown_ = (int8_t)i;
+        stats_.hits++;
+        return f.buf;
+      }
+    }
+    stats_.misses++;
+    return nullptr;
+  }
+
+  /** Mirror the drawing from here to commit() into a frame for (id, hash). */
+  void record(uint8_t id, uint32_t hash) {
+    if (!count_)
+      return;
+    int8_t victim = -1;
+    for (uint8_t i = 0; i < count_; i++) {
+      if (i == shown_)
+        continue;
+      if (!frames_[i].valid) {
+        victim = (int8_t)i;
+        break;
+      }
+      if (victim < 0 || frames_[i].used < frames_[victim].used)
+        victim = (int8_t)i;
+    }
+    Frame &f = frames_[victim];
+    if (f.valid)
+      stats_.evictions++;
+    f.valid = false;
+    f.id = id;
+    f.hash = hash;
+    rec_ = victim;
+    startUs_ = micros();
+    window(0, 0, w_ - 1, h_ - 1);
+  }
+
+  /** The frame is complete: it can be found from now on. */
+  void commit() {
+    if (rec_ < 0)
+      return;
+    Frame &f = frames_[rec_];
+    f.valid = true;
+    f.used = ++tick_;
+    shown_ = rec_;
+    rec_ = -1;
+    stats_.lastRenderUs = micros() - startUs_;
+    if (stats_.lastRenderUs > stats_.maxRenderUs)
+      stats_.maxRenderUs = stats_.lastRenderUs;
+  }
+
+  /** Drop an unfinished recording (the screen was left half drawn). */
+  void abort() { rec_ = -1; }
+
+  /** Columns x0..x1, rows y0..y1, as sent to the panel. */
+  void window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    if (rec_ < 0)
+      return;
+    x0_ = x0;
+    y0_ = y0;
+    x1_ = x1 < w_ ? x1 : w_ - 1;
+    y1_ = y1 < h_ ? y1 : h_ - 1;
+    cx_ = x0_;
+    cy_ = y0_;
+  }
+
+  /** count pixels of one colour at the cursor. */
+  void fill(uint16_t color, uint32_t count) {
+    if (rec_ < 0)
+      return;
+    const uint8_t hi = (uint8_t)(color >> 8), lo = (uint8_t)color;
+    while (count) {
+      uint32_t run = 0;
+      uint8_t *p = span(count, run);
+      if (!p)
+        return;
+      for (uint32_t i = 0; i < run; i++) {
+        p[2 * i] = hi;
+        p[2 * i + 1] = lo;
+      }
+      count -= run;
+    }
+  }
+
+  /** n RGB565 pixels at the cursor. */
+  void pixels(const uint16_t *px, uint32_t n) {
+    if (rec_ < 0)
+      return;
+    while (n) {
+      uint32_t run = 0;
+      uint8_t *p = span(n, run);
+      if (!p)
+        return;
+      for (uint32_t i = 0; i < run; i++) {
+        p[2 * i] = (uint8_t)(px[i] >> 8);
+        p[2 * i + 1] = (uint8_t)px[i];
+      }
+      px += run;
+      n -= run;
+    }
+  }
+
+  const Stats &stats() const { return stats_; }
+
+  void printReport(Print &out) const {
+    out.printf("[UI] screen cache: %u x %lu KB PSRAM, %lu hits, %lu misses, "
+               "%lu evictions; drawing max %lu ms\n",
+               (unsigned)count_, (unsigned long)(frameBytes() / 1024),
+               (unsigned long)stats_.hits, (unsigned long)stats_.misses,
+               (unsigned long)stats_.evictions,
+               (unsigned long)(stats_.maxRenderUs / 1000));
+  }
+
+private:
+  struct Frame {
+    uint8_t *buf = nullptr;
+    uint32_t hash = 0;
+    uint32_t used = 0; // tick_ of the last find() or commit()
+    uint8_t id = 0;
+    bool valid = false;
+  };
+
+  /**
+   * Up to want pixels of the cursor's row (run), and the cursor moved past
+   * them, wrapping inside the window like the panel does.
+   */
+  uint8_t *span(uint32_t want, uint32_t &run) {
+    if (x0_ > x1_ || y0_ > y1_)
+      return nullptr;
+    const uint32_t left = (uint32_t)(x1_ - cx_) + 1;
+    run = want < left ? want : left;
+    uint8_t *p = frames_[rec_].buf + ((uint32_t)cy_ * w_ + cx_) * 2;
+    cx_ = (uint16_t)(cx_ + run);
+    if (cx_ > x1_) {
+      cx_ = x0_;
+      cy_ = cy_ < y1_ ? (uint16_t)(cy_ + 1) : y0_;
+    }
+    return p;
+  }
+
+  Frame frames_[SLOTS];
+  uint8_t count_ = 0;
+  uint16_t w_ = 0, h_ = 0;
+  int8_t rec_ = -1;   // Frame being recorded
+  int8_t shown_ = -1; // Frame last blitted or recorded
+  uint32_t tick_ = 0;
+  uint32_t startUs_ = 0;
+  uint16_t x0_ = 0, y0_ = 0, x1_ = 0, y1_ = 0;
+  uint16_t cx_ = 0, cy_ = 0;
+  Stats stats_;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_SCREEN_CACHE_H
@@ -0,0 +1,153 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                   LIFELINE CORE - SHARED SPI BUS ARBITER
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * On the pro boards the ST7789 and the SX127x share SCK, MISO and MOSI.
+ * A full-screen paint keeps the bus for tens of milliseconds. The radio
+ * must not wait that long after RxDone: in continuous RX the next packet
+ * overwrites the FIFO. SpiArbiter gives the radio the bus at the display's
+ * slice boundaries:
+ *
+ *   lifeline::SpiArbiter spiBus;
+ *   tft.attachArbiter(spiBus);                       // display side
+ *   spiBus.setRadio(dio0High, readFifo, nullptr);    // radio side
+ *   spiBus.poll();                                   // loop(): same check
+ *   spiBus.radioAccess();                            // before LoRa TX
+ *
+ *   Display   keeps at most a bounded number of pixels queued on the bus
+ *             (St7789Dma: ST7789_INFLIGHT_PIXELS). It calls poll() before
+ *             every window and slice, so the radio waits for at most
+ *             that much bus time.
+ *   poll()    reads DIO0 (a GPIO read, no SPI). When it is high, the
+ *             display drains and lets go of the pins, and the radio's
+ *             service() runs with the bus.
+ *   Wait      DIO0 may have risen any time after the previous check, so
+ *             a wait is counted from the previous poll() or radioAccess().
+ *             That is the worst case. maxPaintWaitUs is the longest at a
+ *             slice boundary; maxWaitUs also covers loop() passes, which
+ *             include whatever else blocks the loop (an HTTP request).
+ *
+ * Everything runs in the loop task: the arbiter decides the order of work
+ * between the two devices and takes no lock.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_SPI_ARBITER_H
+#define LIFELINE_SPI_ARBITER_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+namespace lifeline {
+
+class SpiArbiter {
+public:
+  typedef void (*Hook)(void *ctx);
+  typedef bool (*Ready)(void *ctx);
+
+  struct Stats {
+    uint32_t grants = 0;      // The radio was given the bus
+    uint32_t preemptions = 0; // ... in the middle of display work
+    uint32_t polls = 0;       // DIO0 checks (loop and slice boundaries)
+    uint32_t maxWaitUs = 0;   // Longest wait, worst case
+    uint32_t maxPaintWaitUs = 0; // ... of the preemptions
+    uint32_t lastWaitUs = 0;
+    uint64_t totalWaitUs = 0;
+  };
+
+  /** release(ctx) drains the display's queue and hands the pins back. */
+  void setDisplay(Hook release, void *ctx) {
+    release_ = release;
+    displayCtx_ = ctx;
+  }
+
+  /** ready(ctx): the radio has an event (DIO0). service(ctx) handles it. */
+  void setRadio(Ready ready, Hook service, void *ctx) {
+    ready_ = ready;
+    service_ = service;
+    radioCtx_ = ctx;
+  }
+
+  /**
+   * Serve the radio if it is waiting. The display calls this at slice
+   * boundaries (midDisplay), loop() calls it every pass. True when the
+   * radio ran.
+   */
+  bool poll(bool midDisplay = false) {
+    if (inRadio_ || !ready_)
+      return false;
+    stats_.polls++;
+    const uint32_t now = micros();
+    const uint32_t since = checked_ ? checkedUs_ : now;
+    checked_ = true;
+    checkedUs_ = now;
+    if (!ready_(radioCtx_))
+      return false;
+    grant(since, midDisplay);
+    inRadio_ = true;
+    if (service_)
+      service_(radioCtx_);
+    inRadio_ = false;
+    checkedUs_ = micros();
+    return true;
+  }
+
+  /** Take the bus for the radio now (transmit, mode changes). */
+  void radioAccess() {
+    if (inRadio_)
+      return;
+    grant(micros(), false);
+    checked_ = true;
+    checkedUs_ = micros();
+  }
+
+  /** Wait of the last grant, in microseconds. */
+  uint32_t lastWaitUs() const { return stats_.lastWaitUs; }
+  bool inRadio() const { return inRadio_; }
+  const Stats &stats() const { return stats_; }
+
+  void printReport(Print &out) const {
+    out.printf("[BUS] radio %lu grants (%lu mid-paint, max %lu us), wait "
+               "max %lu us, avg %lu us; %lu DIO0 checks\n",
+               (unsigned long)stats_.grants,
+               (unsigned long)stats_.preemptions,
+               (unsigned long)stats_.maxPaintWaitUs,
+               (unsigned long)stats_.maxWaitUs,
+               (unsigned long)(stats_.grants
+                                   ? stats_.totalWaitUs / stats_.grants
+                                   : 0),
+               (unsigned long)stats_.polls);
+  }
+
+private:
+  void grant(uint32_t sinceUs, bool midDisplay) {
+    if (release_)
+      release_(displayCtx_);
+    const uint32_t wait = micros() - sinceUs;
+    stats_.grants++;
+    if (midDisplay) {
+      stats_.preemptions++;
+      if (wait > stats_.maxPaintWaitUs)
+        stats_.maxPaintWaitUs = wait;
+    }
+    stats_.lastWaitUs = wait;
+    stats_.totalWaitUs += wait;
+    if (wait > stats_.maxWaitUs)
+      stats_.maxWaitUs = wait;
+  }
+
+  Hook release_ = nullptr;
+  void *displayCtx_ = nullptr;
+  Ready ready_ = nullptr;
+  Hook service_ = nullptr;
+  void *radioCtx_ = nullptr;
+  uint32_t checkedUs_ = 0; // Last DIO0 check or radio access
+  bool checked_ = false;
+  bool inRadio_ = false;
+  Stats stats_;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_SPI_ARBITER_H
@@ -0,0 +1,524 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                    LIFELINE CORE - ST7789 SPI DMA DRIVER
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Adafruit_ST7789 sends every primitive with blocking SPI writes, so the
+ * CPU waits out each byte of a fillScreen(). St7789Dma is an Adafruit_GFX
+ * panel for the same wiring that queues ESP-IDF spi_master transactions
+ * instead. A primitive returns once its transactions are queued, and DMA
+ * sends them while the sketch carries on:
+ *
+ *   lifeline::St7789Dma tft(TFT_CS, TFT_DC, TFT_RST, 240, 320);
+ *   tft.begin(SPI_SCK, SPI_MISO, SPI_MOSI);   // init, probe the clock
+ *   tft.fillScreen(bg);                        // returns while it is sent
+ *   tft.releaseBus();                          // before touching LoRa
+ *
+ *   Commands     Up to 4 bytes, inline in the transaction (no buffer).
+ *   Pixels       Two span buffers of ST7789_SPAN_PIXELS, one slice each. A
+ *                solid fill sends one span for every slice of its
+ *                rectangle. A fill in another colour goes to the other
+ *                span while the first is still on the bus, and
+ *                pushPixels() alternates them.
+ *   Queue        ST7789_QUEUE_DEPTH transactions and ST7789_INFLIGHT_PIXELS
+ *                pixels in flight. A primitive that needs more waits for
+ *                the oldest ones to finish, so draining the queue never
+ *                takes longer than that many pixels on the bus.
+ *   Window       CASET/RASET are skipped when they have not changed.
+ *   Clock        begin() writes a test row at each candidate clock, fastest
+ *                first, and reads it back (RAMRD) at ST7789_READ_HZ. The
+ *                first clock that reads back intact is kept. Without MISO
+ *                nothing reads back, and ST7789_FALLBACK_HZ is used.
+ *
+ * The panel shares SCK and MOSI with the LoRa radio, which the Arduino SPI
+ * object drives on VSPI. The driver runs on HSPI and routes the two pins
+ * to it through the GPIO matrix while it has work. releaseBus() waits for
+ * the queue and hands them back. begin() ends released. With an arbiter
+ * (SpiArbiter.h) attached, the driver lets the radio in before every
+ * window and slice; without one, call releaseBus() before LoRa access.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_ST7789_DMA_H
+#define LIFELINE_ST7789_DMA_H
+
+#include "SpiArbiter.h"
+
+#include <Adafruit_GFX.h>
+#include <Arduino.h>
+#include <driver/spi_master.h>
+#include <soc/gpio_reg.h>
+#include <soc/gpio_sig_map.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef ST7789_QUEUE_DEPTH
+#define ST7789_QUEUE_DEPTH 24 // Transactions in flight
+#endif
+#ifndef ST7789_SPAN_PIXELS
+#define ST7789_SPAN_PIXELS 1024 // Pixels per span buffer and slice
+#endif
+#ifndef ST7789_INFLIGHT_PIXELS
+#define ST7789_INFLIGHT_PIXELS 2048 // Queued pixels: 0.8 ms at 40 MHz
+#endif
+#ifndef ST7789_READ_HZ
+#define ST7789_READ_HZ 6666667 // RAMRD: 150 ns read cycle
+#endif
+#ifndef ST7789_FALLBACK_HZ
+#define ST7789_FALLBACK_HZ 20000000 // No readback: a clock every module takes
+#endif
+
+namespace lifeline {
+
+static_assert(ST7789_INFLIGHT_PIXELS >= ST7789_SPAN_PIXELS,
+              "a slice must fit in flight");
+
+/** Write clocks begin() tries, fastest first (80 MHz APB over 2, 3, ...). */
+constexpr uint32_t ST7789_PROBE_HZ[] = {40000000, 26666667, 20000000,
+                                        16000000, 10000000};
+
+class St7789Dma : public Adafruit_GFX {
+public:
+  struct Stats {
+    uint32_t transactions = 0; // Queued since begin()
+    uint32_t queueWaits = 0;   // The queue was full
+    uint32_t spanWaits = 0;    // The span to fill was still on the bus
+    uint32_t capWaits = 0;     // ST7789_INFLIGHT_PIXELS were on the bus
+  };
+
+  St7789Dma(int8_t cs, int8_t dc, int8_t rst, uint16_t width,
+            uint16_t height)
+      : Adafruit_GFX((int16_t)width, (int16_t)height), cs_(cs), dc_(dc),
+        rst_(rst) {}
+
+  /**
+   * Bring up the bus and the panel, then probe the clock. false when the
+   * SPI host or the device could not be set up.
+   */
+  bool begin(int8_t sck, int8_t miso, int8_t mosi,
+             spi_host_device_t host = HSPI_HOST) {
+    sck_ = sck;
+    mosi_ = mosi;
+    host_ = host;
+    pinMode(dc_, OUTPUT);
+    digitalWrite(dc_, HIGH);
+    if (rst_ >= 0) {
+      pinMode(rst_, OUTPUT);
+      digitalWrite(rst_, LOW);
+      delay(10);
+      digitalWrite(rst_, HIGH);
+      delay(120);
+    }
+
+    spi_bus_config_t bus;
+    memset(&bus, 0, sizeof(bus));
+    bus.sclk_io_num = sck;
+    bus.miso_io_num = miso;
+    bus.mosi_io_num = mosi;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = ST7789_SPAN_PIXELS * 2;
+    if (spi_bus_initialize(host_, &bus, SPI_DMA_CH_AUTO) != ESP_OK)
+      return false;
+    owned_ = true; // The bus driver routed SCK/MOSI to this host
+    if (!attach(ST7789_FALLBACK_HZ))
+      return false;
+
+    command(0x01); // SWRESET
+    flush();
+    delay(150);
+    command(0x11); // SLPOUT
+    flush();
+    delay(10);
+    const uint8_t colmod = 0x55; // 16-bit RGB565
+    command(0x3A, &colmod, 1);
+    command(0x21); // INVON (ST7789 modules are inverted)
+    command(0x13); // NORON
+    command(0x29); // DISPON
+    flush();
+    delay(10);
+
+    probeClock();
+    setRotation(0);
+    releaseBus();
+    return true;
+  }
+
+  void setRotation(uint8_t r) override {
+    static const uint8_t MADCTL[4] = {0xC0, 0xA0, 0x00, 0x60}; // MY MX MV
+    Adafruit_GFX::setRotation(r);
+    if (dev_)
+      command(0x36, &MADCTL[r & 3], 1);
+    colValid_ = rowValid_ = false;
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    fillRect(x, y, 1, 1, color);
+  }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w,
+                     uint16_t color) override {
+    fillRect(x, y, w, 1, color);
+  }
+
+  void drawFastVLine(int16_t x, int16_t y, int16_t h,
+                     uint16_t color) override {
+    fillRect(x, y, 1, h, color);
+  }
+
+  void fillScreen(uint16_t color) override {
+    fillRect(0, 0, width(), height(), color);
+  }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) override {
+    if (!clip(x, y, w, h))
+      return;
+    window(x, y, w, h);
+    uint32_t total = (uint32_t)w * h;
+    const uint16_t be = (uint16_t)(color << 8 | color >> 8);
+    if (total <= 2) { // Fits inline
+      spi_transaction_t &t = slot();
+      t.flags = SPI_TRANS_USE_TXDATA;
+      t.length = total * 16;
+      memcpy(t.tx_data, &be, 2);
+      memcpy(t.tx_data + 2, &be, 2);
+      t.user = dcUser(true);
+      submit(t);
+      return;
+    }
+    const uint32_t need = total < ST7789_SPAN_PIXELS ? total
+                                                      : ST7789_SPAN_PIXELS;
+    uint8_t b = cur_;
+    if (!holds(b, be, need)) {
+      b = (uint8_t)(cur_ ^ 1);
+      if (!holds(b, be, need)) {
+        waitSpan(b);
+        for (uint32_t i = 0; i < need; i++)
+          span_[b][i] = be;
+        spanSolid_[b] = true;
+        spanColor_[b] = be;
+        spanFill_[b] = need;
+      }
+    }
+    cur_ = b;
+    while (total) {
+      const uint32_t n = total < need ? total : need;
+      sendSpan(b, n);
+      total -= n;
+    }
+  }
+
+  /** Queue a w x h block of RGB565 pixels (row by row, copied). */
+  void pushPixels(int16_t x, int16_t y, int16_t w, int16_t h,
+                  const uint16_t *pixels) {
+    if (x < 0 || y < 0 || w <= 0 || h <= 0 || x + w > width() ||
+        y + h > height())
+      return;
+    window(x, y, w, h);
+    uint32_t total = (uint32_t)w * h;
+    while (total) {
+      const uint32_t n =
+          total < ST7789_SPAN_PIXELS ? total : ST7789_SPAN_PIXELS;
+      const uint8_t b = (uint8_t)(cur_ ^ 1);
+      waitSpan(b);
+      for (uint32_t i = 0; i < n; i++)
+        span_[b][i] = (uint16_t)(pixels[i] << 8 | pixels[i] >> 8);
+      spanSolid_[b] = false;
+      cur_ = b;
+      sendSpan(b, n);
+      pixels += n;
+      total -= n;
+    }
+  }
+
+  /** Let the radio in at slice boundaries (see SpiArbiter.h). */
+  void attachArbiter(SpiArbiter &arbiter) {
+    arbiter_ = &arbiter;
+    arbiter.setDisplay(releaseHook, this);
+  }
+
+  /** Wait until everything queued is on the panel. */
+  void flush() {
+    while (inFlight_)
+      reap();
+  }
+
+  /** flush(), then give SCK/MOSI back to the Arduino SPI object. */
+  void releaseBus() {
+    flush();
+    if (!owned_)
+      return;
+    route(VSPICLK_OUT_IDX, VSPID_OUT_IDX);
+    owned_ = false;
+  }
+
+  uint32_t clockHz() const { return clockHz_; }
+  /** The clock was confirmed by reading the test row back. */
+  bool clockProbed() const { return probed_; }
+  const Stats &stats() const { return stats_; }
+
+private:
+  static void releaseHook(void *ctx) { ((St7789Dma *)ctx)->releaseBus(); }
+
+  /** A slice boundary: the radio goes first if it is waiting. */
+  void boundary() {
+    if (arbiter_)
+      arbiter_->poll(true);
+  }
+
+  /** pre_cb: set DC from the transaction's user word (pin << 1 | level). */
+  static void IRAM_ATTR setDc(spi_transaction_t *t) {
+    const uint32_t v = (uint32_t)(uintptr_t)t->user;
+    const uint8_t pin = (uint8_t)(v >> 1);
+    const uint32_t bit = (uint32_t)1 << (pin & 31);
+    if (pin < 32)
+      REG_WRITE((v & 1) ? GPIO_OUT_W1TS_REG : GPIO_OUT_W1TC_REG, bit);
+    else
+      REG_WRITE((v & 1) ? GPIO_OUT1_W1TS_REG : GPIO_OUT1_W1TC_REG, bit);
+  }
+
+  void *dcUser(bool data) const {
+    return (void *)(uintptr_t)((uint32_t)dc_ << 1 | (data ? 1 : 0));
+  }
+
+  bool attach(uint32_t hz) {
+    if (dev_) {
+      flush();
+      spi_bus_remove_device(dev_);
+      dev_ = nullptr;
+    }
+    spi_device_interface_config_t cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.clock_speed_hz = (int)hz;
+    cfg.mode = 0;
+    cfg.spics_io_num = cs_;
+    cfg.queue_size = ST7789_QUEUE_DEPTH;
+    cfg.flags = SPI_DEVICE_HALFDUPLEX;
+    cfg.pre_cb = setDc;
+    if (spi_bus_add_device(host_, &cfg, &dev_) != ESP_OK) {
+      dev_ = nullptr;
+      return false;
+    }
+    clockHz_ = hz;
+    colValid_ = rowValid_ = false;
+    return true;
+  }
+
+  void route(uint8_t clk, uint8_t data) {
+    if (sck_ >= 0)
+      pinMatrixOutAttach(sck_, clk, false, false);
+    if (mosi_ >= 0)
+      pinMatrixOutAttach(mosi_, data, false, false);
+  }
+
+  spi_transaction_t &slot() {
+    if (inFlight_ == ST7789_QUEUE_DEPTH) {
+      stats_.queueWaits++;
+      reap();
+    }
+    if (!owned_) {
+      route(host_ == SPI2_HOST ? HSPICLK_OUT_IDX : VSPICLK_OUT_IDX,
+            host_ == SPI2_HOST ? HSPID_OUT_IDX : VSPID_OUT_IDX);
+      owned_ = true;
+    }
+    spi_transaction_t &t = trans_[next_];
+    memset(&t, 0, sizeof(t));
+    return t;
+  }
+
+  void submit(spi_transaction_t &t, uint16_t pixels = 0) {
+    spi_device_queue_trans(dev_, &t, portMAX_DELAY);
+    pixels_[next_] = pixels;
+    inFlightPixels_ += pixels;
+    next_ = (uint8_t)((next_ + 1) % ST7789_QUEUE_DEPTH);
+    inFlight_++;
+    queuedSeq_++;
+    stats_.transactions++;
+  }
+
+  /** Collect the oldest result (transactions finish in queue order). */
+  void reap() {
+    spi_transaction_t *done;
+    if (spi_device_get_trans_result(dev_, &done, portMAX_DELAY) == ESP_OK) {
+      const uint8_t oldest =
+          (uint8_t)((next_ + ST7789_QUEUE_DEPTH - inFlight_) %
+                    ST7789_QUEUE_DEPTH);
+      inFlightPixels_ -= pixels_[oldest];
+      inFlight_--;
+      doneSeq_++;
+    }
+  }
+
+  bool holds(uint8_t b, uint16_t be, uint32_t n) const {
+    return spanSolid_[b] && spanColor_[b] == be && spanFill_[b] >= n;
+  }
+
+  void waitSpan(uint8_t b) {
+    if (doneSeq_ < spanSeq_[b])
+      stats_.spanWaits++;
+    while (doneSeq_ < spanSeq_[b])
+      reap();
+  }
+
+  void sendSpan(uint8_t b, uint32_t n) {
+    boundary();
+    if (inFlightPixels_ + n > ST7789_INFLIGHT_PIXELS && inFlight_)
+      stats_.capWaits++;
+    while (inFlightPixels_ + n > ST7789_INFLIGHT_PIXELS && inFlight_)
+      reap();
+    spi_transaction_t &t = slot();
+    t.tx_buffer = span_[b];
+    t.length = n * 16;
+    t.user = dcUser(true);
+    submit(t, (uint16_t)n);
+    spanSeq_[b] = queuedSeq_;
+  }
+
+  void command(uint8_t cmd, const uint8_t *data = nullptr, uint8_t n = 0) {
+    spi_transaction_t &c = slot();
+    c.flags = SPI_TRANS_USE_TXDATA;
+    c.length = 8;
+    c.tx_data[0] = cmd;
+    c.user = dcUser(false);
+    submit(c);
+    if (!n)
+      return;
+    spi_transaction_t &d = slot();
+    d.flags = SPI_TRANS_USE_TXDATA;
+    d.length = 8u * n;
+    memcpy(d.tx_data, data, n);
+    d.user = dcUser(true);
+    submit(d);
+  }
+
+  /** CASET/RASET (when changed) and RAMWR for the rectangle. */
+  void window(int16_t x, int16_t y, int16_t w, int16_t h) {
+    boundary();
+    const uint16_t x1 = (uint16_t)(x + w - 1), y1 = (uint16_t)(y + h - 1);
+    if (!colValid_ || colFrom_ != (uint16_t)x || colTo_ != x1) {
+      const uint8_t a[4] = {(uint8_t)(x >> 8), (uint8_t)x, (uint8_t)(x1 >> 8),
+                            (uint8_t)x1};
+      command(0x2A, a, 4);
+      colFrom_ = (uint16_t)x;
+      colTo_ = x1;
+      colValid_ = true;
+    }
+    if (!rowValid_ || rowFrom_ != (uint16_t)y || rowTo_ != y1) {
+      const uint8_t a[4] = {(uint8_t)(y >> 8), (uint8_t)y, (uint8_t)(y1 >> 8),
+                            (uint8_t)y1};
+      command(0x2B, a, 4);
+      rowFrom_ = (uint16_t)y;
+      rowTo_ = y1;
+      rowValid_ = true;
+    }
+    command(0x2C);
+  }
+
+  bool clip(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const {
+    if (w <= 0 || h <= 0 || x >= width() || y >= height())
+      return false;
+    if (x < 0) {
+      w = (int16_t)(w + x);
+      x = 0;
+    }
+    if (y < 0) {
+      h = (int16_t)(h + y);
+      y = 0;
+    }
+    if (x + w > width())
+      w = (int16_t)(width() - x);
+    if (y + h > height())
+      h = (int16_t)(height() - y);
+    return w > 0 && h > 0;
+  }
+
+  /** Keep the fastest candidate whose test row reads back intact. */
+  void probeClock() {
+    static const int16_t N = 16;
+    uint16_t pattern[N];
+    for (int16_t i = 0; i < N; i++) // Every bit of R, G and B toggles
+      pattern[i] = (uint16_t)((0xA5C3u * (i + 1)) ^ (0x0F0Fu << (i & 3)));
+    for (uint32_t hz : ST7789_PROBE_HZ) {
+      if (!attach(hz))
+        break;
+      pushPixels(0, 0, N, 1, pattern);
+      if (readBack(pattern, N)) {
+        probed_ = true;
+        attach(hz);
+        return;
+      }
+    }
+    attach(ST7789_FALLBACK_HZ);
+  }
+
+  /** RAMRD the first n pixels of the last window at ST7789_READ_HZ. */
+  bool readBack(const uint16_t *expect, int16_t n) {
+    if (!attach(ST7789_READ_HZ))
+      return false;
+    spi_device_acquire_bus(dev_, portMAX_DELAY);
+    spi_transaction_t &c = trans_[0];
+    memset(&c, 0, sizeof(c));
+    c.flags = SPI_TRANS_USE_TXDATA | SPI_TRANS_CS_KEEP_ACTIVE;
+    c.length = 8;
+    c.tx_data[0] = 0x2E; // RAMRD
+    c.user = dcUser(false);
+    spi_device_polling_transmit(dev_, &c);
+
+    // One dummy byte, then 3 bytes (6-bit R, G, B) per pixel
+    uint8_t *rx = (uint8_t *)span_[0];
+    spi_transaction_t &r = trans_[1];
+    memset(&r, 0, sizeof(r));
+    r.rxlength = (size_t)(1 + 3 * n) * 8;
+    r.rx_buffer = rx;
+    r.user = dcUser(true);
+    spi_device_polling_transmit(dev_, &r);
+    spi_device_release_bus(dev_);
+    spanSolid_[0] = false;
+
+    for (int16_t i = 0; i < n; i++) {
+      const uint8_t *p = rx + 1 + 3 * i;
+      const uint16_t c565 =
+          (uint16_t)((p[0] & 0xF8) << 8 | (p[1] & 0xFC) << 3 | p[2] >> 3);
+      if (c565 != expect[i])
+        return false;
+    }
+    return true;
+  }
+
+  const int8_t cs_, dc_, rst_;
+  int8_t sck_ = -1, mosi_ = -1;
+  spi_host_device_t host_ = HSPI_HOST;
+  spi_device_handle_t dev_ = nullptr;
+  uint32_t clockHz_ = 0;
+  bool probed_ = false;
+  bool owned_ = false; // SCK/MOSI routed to this host
+
+  SpiArbiter *arbiter_ = nullptr;
+
+  spi_transaction_t trans_[ST7789_QUEUE_DEPTH];
+  uint16_t pixels_[ST7789_QUEUE_DEPTH] = {}; // Span pixels per transaction
+  uint8_t next_ = 0;
+  uint8_t inFlight_ = 0;
+  uint32_t inFlightPixels_ = 0;
+  uint32_t queuedSeq_ = 0; // Transactions queued
+  uint32_t doneSeq_ = 0;   // ... and collected back
+
+  // Big-endian RGB565. The driver is a global, so these sit in internal
+  // DRAM, which DMA can read.
+  alignas(4) uint16_t span_[2][ST7789_SPAN_PIXELS];
+  uint32_t spanSeq_[2] = {};  // Last transaction reading each span
+  uint32_t spanFill_[2] = {}; // Pixels of spanColor_ a solid span holds
+  uint16_t spanColor_[2] = {};
+  bool spanSolid_[2] = {};
+  uint8_t cur_ = 0;
+
+  bool colValid_ = false, rowValid_ = false;
+  uint16_t colFrom_ = 0, colTo_ = 0, rowFrom_ = 0, rowTo_ = 0;
+
+  Stats stats_;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_ST7789_DMA_H
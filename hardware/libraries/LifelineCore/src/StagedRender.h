@@ -0,0 +1,181 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                   LIFELINE CORE - STAGED SCREEN RENDERING
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * On a bit-banged panel a full alert screen is a few hundred thousand bus
+ * writes, and a responder can read nothing until the last of them unless
+ * the order is right. StagedRender splits a screen into steps in priority
+ * tiers. The critical tier (the colour band, the alert word, the sender)
+ * is drawn at once; labels and the backdrop follow over the next loop
+ * passes, a few milliseconds at a time:
+ *
+ *   render.begin();                      // New alert: drop the old steps
+ *   render.add(0, drawBand);             // Tier 0: readable after these
+ *   render.add(0, drawWord);
+ *   render.add(1, drawLabels);
+ *   render.add(2, drawBackdrop, 0);      // arg: which part of it
+ *   render.add(2, drawBackdrop, 1);
+ *   render.run(0);                       // Tier 0 only, whatever it costs
+ *   ...
+ *   render.run(8000);                    // Each loop pass: 8 ms of the rest
+ *
+ *   Tiers    Steps run by tier, and in the order added within a tier. A
+ *            step paints its own background: it must not rely on a step
+ *            of a later tier having cleared the screen.
+ *   Frames   run() always runs tier 0 whole, and at least one step. Past
+ *            that it stops once budgetUs is spent, or when setPreempt()'s
+ *            check says something more urgent is waiting (a packet).
+ *   Preempt  begin() while steps are left drops them; the new screen
+ *            starts at its own tier 0. Stats count how often.
+ *
+ * readableUs is the time from begin() to the end of tier 0: the number the
+ * gateway operator sees, and what the alert latency trace should record.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_STAGED_RENDER_H
+#define LIFELINE_STAGED_RENDER_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#ifndef RENDER_MAX_STEPS
+#define RENDER_MAX_STEPS 12 // Steps of one screen
+#endif
+
+namespace lifeline {
+
+/** The tier that makes a screen readable. */
+static const uint8_t RENDER_TIER_CRITICAL = 0;
+
+/** One part of a screen; arg is the value given to add(). */
+typedef void (*RenderStep)(uint8_t arg);
+
+/** True when run() should hand the loop back before its budget is spent. */
+typedef bool (*RenderPreempt)();
+
+class StagedRender {
+public:
+  struct Stats {
+    uint32_t screens = 0;   // begin() calls
+    uint32_t completed = 0; // Screens drawn to the last step
+    uint32_t preempted = 0; // Screens dropped with steps left
+    uint32_t frames = 0;    // run() calls that drew something
+    uint32_t lastReadableUs = 0;
+    uint32_t maxReadableUs = 0;
+    uint32_t lastCompleteUs = 0;
+    uint32_t maxCompleteUs = 0;
+  };
+
+  /** Checked between steps past tier 0. */
+  void setPreempt(RenderPreempt check) { preempt_ = check; }
+
+  /** Start a new screen. Steps left from the last one are dropped. */
+  void begin() {
+    cancel();
+    count_ = 0;
+    next_ = 0;
+    critical_ = 0;
+    startUs_ = micros();
+    stats_.screens++;
+  }
+
+  /** Drop the steps left (the screen is being replaced). */
+  void cancel() {
+    if (next_ < count_)
+      stats_.preempted++;
+    next_ = count_;
+  }
+
+  /** Add a step to a tier. False when the table is full. */
+  bool add(uint8_t tier, RenderStep step, uint8_t arg = 0) {
+    if (count_ >= RENDER_MAX_STEPS)
+      return false;
+    // Keep the table sorted by tier, stable within one
+    uint8_t i = count_++;
+    while (i > next_ && steps_[i - 1].tier > tier) {
+      steps_[i] = steps_[i - 1];
+      i--;
+    }
+    steps_[i] = {step, tier, arg};
+    if (tier == RENDER_TIER_CRITICAL)
+      critical_++;
+    return true;
+  }
+
+  /**
+   * Draw the next steps: all of tier 0, then more until budgetUs has been
+   * spent or the preempt check fires. True once the screen is complete.
+   */
+  bool run(uint32_t budgetUs) {
+    if (next_ >= count_)
+      return true;
+    const uint32_t frameUs = micros();
+    bool first = true;
+    while (next_ < count_) {
+      const bool critical = next_ < critical_;
+      if (!critical && !first &&
+          ((uint32_t)(micros() - frameUs) >= budgetUs ||
+           (preempt_ && preempt_())))
+        break;
+      const Step &s = steps_[next_++];
+      s.step(s.arg);
+      first = false;
+      if (next_ == critical_ && critical)
+        record(stats_.lastReadableUs, stats_.maxReadableUs);
+    }
+    stats_.frames++;
+    if (next_ < count_)
+      return false;
+    if (!critical_)
+      record(stats_.lastReadableUs, stats_.maxReadableUs);
+    record(stats_.lastCompleteUs, stats_.maxCompleteUs);
+    stats_.completed++;
+    return true;
+  }
+
+  /** Tier 0 is on the panel. */
+  bool readable() const { return next_ >= critical_; }
+  /** Every step has run (or the screen was dropped). */
+  bool done() const { return next_ >= count_; }
+  uint8_t stepsLeft() const { return count_ - next_; }
+
+  const Stats &stats() const { return stats_; }
+
+  void printReport(Print &out, const char *name) const {
+    out.printf("[UI] %s: readable %lu ms (max %lu), complete %lu ms (max "
+               "%lu); %lu screens, %lu frames, %lu preempted\n",
+               name, (unsigned long)(stats_.lastReadableUs / 1000),
+               (unsigned long)(stats_.maxReadableUs / 1000),
+               (unsigned long)(stats_.lastCompleteUs / 1000),
+               (unsigned long)(stats_.maxCompleteUs / 1000),
+               (unsigned long)stats_.screens, (unsigned long)stats_.frames,
+               (unsigned long)stats_.preempted);
+  }
+
+private:
+  struct Step {
+    RenderStep step;
+    uint8_t tier;
+    uint8_t arg;
+  };
+
+  void record(uint32_t &last, uint32_t &max) {
+    last = micros() - startUs_;
+    if (last > max)
+      max = last;
+  }
+
+  Step steps_[RENDER_MAX_STEPS];
+  uint8_t count_ = 0;
+  uint8_t next_ = 0;     // First step not yet run
+  uint8_t critical_ = 0; // Steps in tier 0 (they sort first)
+  uint32_t startUs_ = 0;
+  RenderPreempt preempt_ = nullptr;
+  Stats stats_;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_STAGED_RENDER_H
@@ -0,0 +1,70 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                   LIFELINE CORE - FLASH-RESIDENT UI TEXT
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Alert names, priority labels, titles and the other fixed strings the
+ * sketches draw exist once, in UiTextTable.h. That header is generated by
+ * extras/gen_ui_text.py from extras/ui_text.txt. Every entry points into
+ * one constant pool (flash on the ESP32) and carries its width in pixels,
+ * so centring and right-aligning cost a multiply instead of strlen() or
+ * getTextBounds():
+ *
+ *   const lifeline::Text &t = lifeline::ui::ALERT_NAMES[alertIndex];
+ *   tft.setCursor(lifeline::centerX(t, 2, SCREEN_WIDTH), y);
+ *   tft.print(t.str);
+ *
+ * The width is for text size 1 in the classic 6x8 GFX font that all four
+ * sketches draw with. That font scales by whole pixels, so width * size is
+ * exact for every size (and what getTextBounds() reports).
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_UI_TEXT_H
+#define LIFELINE_UI_TEXT_H
+
+#include <stdint.h>
+#include <string.h>
+
+namespace lifeline {
+
+/** Glyph cell of the classic GFX font at text size 1. */
+constexpr uint8_t TEXT_CHAR_W = 6;
+constexpr uint8_t TEXT_CHAR_H = 8;
+
+/** A string from the UI text table and its width at text size 1. */
+struct Text {
+  const char *str;
+  uint16_t width;
+
+  constexpr uint16_t widthAt(uint8_t size) const {
+    return (uint16_t)(width * size);
+  }
+};
+
+/** Width of a runtime string (counts, IDs) at text size; O(length). */
+inline uint16_t textWidth(const char *s, uint8_t size) {
+  return (uint16_t)(strlen(s) * TEXT_CHAR_W * size);
+}
+
+/** Cursor x that centres a span of width w in [left, left + area). */
+constexpr int16_t centerSpan(uint16_t w, int16_t area, int16_t left = 0) {
+  return (int16_t)(left + (area - (int16_t)w) / 2);
+}
+
+/** Cursor x that centres t at text size in [left, left + area). */
+constexpr int16_t centerX(const Text &t, uint8_t size, int16_t area,
+                          int16_t left = 0) {
+  return centerSpan(t.widthAt(size), area, left);
+}
+
+/** Cursor x that ends t at text size on column right (exclusive). */
+constexpr int16_t rightX(const Text &t, uint8_t size, int16_t right) {
+  return (int16_t)(right - (int16_t)t.widthAt(size));
+}
+
+} // namespace lifeline
+
+#include "UiTextTable.h"
+
+#endif // LIFELINE_UI_TEXT_H
@@ -0,0 +1,137 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                 LIFELINE CORE - NEPALI UI TEXT (DEVANAGARI)
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Nepali versions of UI text table entries, drawn from a 16 px Devanagari
+ * bitmap font. The sketches' font5x7 has no Devanagari, and the script
+ * needs shaping (conjuncts, half forms, ि drawn before its consonant) that
+ * is too much to do on the device. extras/gen_devanagari.py shapes every
+ * string from extras/ui_text_ne.txt at build time and writes
+ * UiTextNeTable.h. That header holds the glyph indices of each string in
+ * visual order and a font with only the glyphs those strings use:
+ *
+ *   const lifeline::ShapedText &t = lifeline::ui_ne::ALERT_WORDS[i];
+ *   lifeline::drawShaped(fillRect, lifeline::ui_ne::FONT, t, x, y, color);
+ *
+ * Glyphs are stored as horizontal runs, with equal rows below each other
+ * merged, so each run is one fillRect(). The shared headline (shirorekha)
+ * is one fillRect per word. For the alert words that is about a third of
+ * the panel windows that font5x7 at size 2 (14 px) opens for the English
+ * word, one per lit pixel.
+ *
+ * Arrays have the same names and indices as in lifeline::ui, so a sketch
+ * switches language per call site, not per table.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_UI_TEXT_NE_H
+#define LIFELINE_UI_TEXT_NE_H
+
+#include <stdint.h>
+
+#include "UiText.h"
+
+namespace lifeline {
+
+/** Language for the strings that have a Nepali version. */
+enum class Lang : uint8_t { EN, NE };
+
+/** The glyph joins the word's headline; its headline row is not stored. */
+constexpr uint8_t GLYPH_HEADLINE = 0x01;
+
+/**
+ * Metrics of one glyph. Its runs start at RunFont::runs + offset: groups
+ * rows from row top, each a (repeat - 1) << 4 | runs byte followed by one
+ * x << 4 | (length - 1) byte per run. x counts from pen + bearing.
+ */
+struct GlyphInfo {
+  uint16_t offset;
+  int8_t bearing;
+  uint8_t advance;
+  uint8_t top;
+  uint8_t groups;
+  uint8_t flags;
+};
+static_assert(sizeof(GlyphInfo) == 8, "gen_devanagari.py counts 8 bytes");
+
+struct RunFont {
+  const uint8_t *runs;
+  const GlyphInfo *glyphs;
+  uint8_t count;
+  uint8_t height;      // Line height at scale 1
+  uint8_t headlineRow; // Row of the shared headline
+};
+
+/** A shaped string: glyph indices in visual order and the pen width. */
+struct ShapedText {
+  const uint8_t *glyphs;
+  uint8_t count;
+  uint16_t width;
+
+  constexpr uint16_t widthAt(uint8_t scale) const {
+    return (uint16_t)(width * scale);
+  }
+};
+
+/**
+ * Draw t with its top-left at (x, y), every pixel scale x scale. fill is
+ * anything callable as fill(x, y, w, h, color), such as a sketch's
+ * fillRect(). Returns the number of fill calls.
+ */
+template <typename Fill>
+uint16_t drawShaped(Fill &&fill, const RunFont &font, const ShapedText &t,
+                    int16_t x, int16_t y, uint16_t color, uint8_t scale = 1) {
+  uint16_t fills = 0;
+  int16_t pen = 0;
+  int16_t lineFrom = -1; // Pen where the current headline started
+  const int16_t lineY = (int16_t)(y + font.headlineRow * scale);
+
+  for (uint8_t i = 0; i < t.count; i++) {
+    const GlyphInfo &g = font.glyphs[t.glyphs[i]];
+    if (g.flags & GLYPH_HEADLINE) {
+      if (lineFrom < 0)
+        lineFrom = pen;
+    } else if (g.advance && lineFrom >= 0) {
+      fill((int16_t)(x + lineFrom * scale), lineY,
+           (int16_t)((pen - lineFrom) * scale), (int16_t)scale, color);
+      fills++;
+      lineFrom = -1;
+    }
+
+    const uint8_t *p = font.runs + g.offset;
+    int16_t row = g.top;
+    const int16_t left = (int16_t)(pen + g.bearing);
+    for (uint8_t k = 0; k < g.groups; k++) {
+      const uint8_t head = *p++;
+      const uint8_t repeat = (uint8_t)((head >> 4) + 1);
+      for (uint8_t r = head & 0x0F; r > 0; r--) {
+        const uint8_t run = *p++;
+        fill((int16_t)(x + (left + (run >> 4)) * scale),
+             (int16_t)(y + row * scale), (int16_t)(((run & 0x0F) + 1) * scale),
+             (int16_t)(repeat * scale), color);
+        fills++;
+      }
+      row += repeat;
+    }
+    pen += g.advance;
+  }
+  if (lineFrom >= 0) {
+    fill((int16_t)(x + lineFrom * scale), lineY,
+         (int16_t)((pen - lineFrom) * scale), (int16_t)scale, color);
+    fills++;
+  }
+  return fills;
+}
+
+/** Left x that centres t at scale in [left, left + area). */
+constexpr int16_t centerX(const ShapedText &t, uint8_t scale, int16_t area,
+                          int16_t left = 0) {
+  return centerSpan(t.widthAt(scale), area, left);
+}
+
+} // namespace lifeline
+
+#include "UiTextNeTable.h"
+
+#endif // LIFELINE_UI_TEXT_NE_H
@@ -0,0 +1,141 @@
+/*
+ * GENERATED from extras/ui_text_ne.txt and extras/devanagari16.glyphs by
+ * extras/gen_devanagari.py. Do not edit; change the text or glyph
+ * file and rerun the generator.
+ */
+
+#ifndef LIFELINE_UI_TEXT_NE_TABLE_H
+#define LIFELINE_UI_TEXT_NE_TABLE_H
+
+namespace lifeline {
+namespace ui_ne {
+
+// 33 of 48 glyphs: 522 run bytes, 264 metric bytes,
+// 75 glyph index bytes for 15 strings
+constexpr uint8_t RUNS[] = {
+    0x02, 0x21, 0xA0, 0x03, 0x10, 0x40, 0xA0, 0x02, 0x40, 0xA0, 0x02, 0x21,
+    0xA0, 0x02, 0x40, 0xA0, 0x02, 0x10, 0x46, 0x02, 0x21, 0xA0, 0x11, 0xA0,
+    0x01, 0x21, 0x01, 0x40, 0x01, 0x21, 0x02, 0x10, 0x41, 0x01, 0x50, 0x01,
+    0x40, 0x01, 0x30, 0x01, 0x40, 0x01, 0x51, 0x01, 0x42, 0x01, 0x70, 0x01,
+    0x60, 0x00, 0x01, 0x21, 0x01, 0x40, 0x01, 0x21, 0x02, 0x10, 0x41, 0x01,
+    0x50, 0x01, 0x40, 0x01, 0x30, 0x01, 0x40, 0x01, 0x51, 0x01, 0x20, 0x01,
+    0x30, 0x01, 0x20, 0x01, 0x10, 0x01, 0x23, 0x11, 0x60, 0x01, 0x50, 0x01,
+    0x22, 0x01, 0x50, 0x01, 0x40, 0x01, 0x30, 0x01, 0x20, 0x01, 0x21, 0x01,
+    0x40, 0x01, 0x50, 0x01, 0x40, 0x01, 0x30, 0x11, 0x50, 0x03, 0x21, 0x50,
+    0x71, 0x13, 0x10, 0x42, 0x90, 0x03, 0x21, 0x50, 0x71, 0x21, 0x50, 0x03,
+    0x10, 0x60, 0x80, 0x04, 0x00, 0x20, 0x50, 0x80, 0x03, 0x20, 0x50, 0x80,
+    0x02, 0x10, 0x62, 0x02, 0x00, 0x80, 0x02, 0x10, 0x80, 0x02, 0x20, 0x80,
+    0x11, 0x80, 0x03, 0x10, 0x40, 0x70, 0x04, 0x00, 0x20, 0x40, 0x70, 0x03,
+    0x00, 0x31, 0x70, 0x03, 0x10, 0x40, 0x70, 0x03, 0x20, 0x50, 0x70, 0x02,
+    0x30, 0x61, 0x21, 0x70, 0x02, 0x40, 0x70, 0x02, 0x30, 0x70, 0x01, 0x25,
+    0x02, 0x30, 0x70, 0x02, 0x40, 0x70, 0x02, 0x50, 0x70, 0x02, 0x22, 0x70,
+    0x11, 0x70, 0x01, 0x30, 0x02, 0x20, 0x40, 0x22, 0x10, 0x50, 0x02, 0x20,
+    0x40, 0x01, 0x30, 0x13, 0x10, 0x50, 0x80, 0x03, 0x20, 0x40, 0x80, 0x02,
+    0x30, 0x80, 0x03, 0x20, 0x40, 0x80, 0x03, 0x10, 0x50, 0x80, 0x21, 0x80,
+    0x11, 0x70, 0x02, 0x20, 0x70, 0x03, 0x10, 0x30, 0x70, 0x02, 0x10, 0x43,
+    0x02, 0x20, 0x70, 0x21, 0x70, 0x11, 0x30, 0x01, 0x40, 0x11, 0x50, 0x01,
+    0x40, 0x01, 0x21, 0x01, 0x10, 0x01, 0x22, 0x21, 0x70, 0x01, 0x25, 0x12,
+    0x10, 0x70, 0x02, 0x20, 0x70, 0x11, 0x70, 0x22, 0x10, 0x70, 0x01, 0x25,
+    0x41, 0x70, 0x02, 0x22, 0x70, 0x03, 0x10, 0x50, 0x70, 0x02, 0x10, 0x61,
+    0x02, 0x11, 0x70, 0x02, 0x21, 0x70, 0x02, 0x31, 0x70, 0x01, 0x52, 0x11,
+    0x70, 0x02, 0x11, 0x70, 0x13, 0x00, 0x30, 0x70, 0x01, 0x16, 0x41, 0x70,
+    0x02, 0x10, 0x70, 0x03, 0x00, 0x20, 0x70, 0x02, 0x11, 0x70, 0x02, 0x20,
+    0x70, 0x01, 0x34, 0x31, 0x70, 0x21, 0x10, 0x01, 0x22, 0x01, 0x40, 0x01,
+    0x30, 0x01, 0x20, 0x01, 0x10, 0x01, 0x21, 0x02, 0x20, 0x80, 0x03, 0x10,
+    0x30, 0x80, 0x03, 0x10, 0x40, 0x80, 0x03, 0x20, 0x50, 0x80, 0x03, 0x40,
+    0x60, 0x80, 0x02, 0x30, 0x71, 0x02, 0x30, 0x80, 0x02, 0x41, 0x80, 0x01,
+    0x80, 0x02, 0x22, 0x70, 0x03, 0x10, 0x50, 0x70, 0x02, 0x10, 0x61, 0x02,
+    0x10, 0x70, 0x02, 0x20, 0x70, 0x02, 0x31, 0x70, 0x01, 0x52, 0x11, 0x70,
+    0x02, 0x30, 0x70, 0x13, 0x20, 0x40, 0x70, 0x01, 0x16, 0x03, 0x00, 0x40,
+    0x70, 0x03, 0x00, 0x30, 0x70, 0x02, 0x11, 0x70, 0x11, 0x70, 0x11, 0x30,
+    0x01, 0x20, 0x01, 0x31, 0x01, 0x50, 0x01, 0x23, 0x01, 0x10, 0x01, 0x21,
+    0x01, 0x41, 0x01, 0x23, 0x11, 0x10, 0x01, 0x20, 0x11, 0x30, 0x01, 0x40,
+    0x01, 0x30, 0x01, 0x20, 0x02, 0x10, 0x30, 0x02, 0x00, 0x40, 0x02, 0x10,
+    0x40, 0x02, 0x21, 0x50, 0x01, 0x60, 0x01, 0x50, 0x81, 0x10, 0x01, 0x24,
+    0x02, 0x10, 0x70, 0x01, 0x10, 0x00, 0x81, 0x10, 0x01, 0x14, 0x02, 0x00,
+    0x60, 0x01, 0x70, 0x00, 0x81, 0x70, 0x01, 0x00, 0x01, 0x11, 0x01, 0x30,
+    0x02, 0x00, 0x30, 0x02, 0x10, 0x40, 0x02, 0x20, 0x50, 0x01, 0x00, 0x01,
+    0x11, 0x01, 0x30, 0x00, 0x81, 0x40, 0x02, 0x00, 0x30, 0x02, 0x10, 0x40,
+    0x02, 0x20, 0x50, 0x00, 0x81, 0x40,
+};
+
+constexpr GlyphInfo GLYPHS[] = {
+    {0, 0, 4, 0, 0, 0}, // space
+    {0, 0, 12, 4, 8, GLYPH_HEADLINE}, // अ
+    {24, 0, 8, 4, 9, GLYPH_HEADLINE}, // इ
+    {43, 0, 8, 0, 13, GLYPH_HEADLINE}, // ई
+    {69, 0, 8, 4, 8, GLYPH_HEADLINE}, // उ
+    {85, 0, 8, 4, 9, GLYPH_HEADLINE}, // ए
+    {103, 0, 10, 4, 5, GLYPH_HEADLINE}, // क
+    {119, 0, 10, 4, 8, GLYPH_HEADLINE}, // ख
+    {146, 0, 9, 4, 7, GLYPH_HEADLINE}, // घ
+    {172, 0, 9, 4, 8, GLYPH_HEADLINE}, // ज
+    {194, 0, 8, 4, 5, GLYPH_HEADLINE}, // ठ
+    {207, 0, 10, 4, 6, GLYPH_HEADLINE}, // ण
+    {228, 0, 9, 4, 6, GLYPH_HEADLINE}, // त
+    {245, 0, 8, 4, 7, GLYPH_HEADLINE}, // द
+    {259, 0, 9, 4, 5, GLYPH_HEADLINE}, // न
+    {271, 0, 9, 4, 3, GLYPH_HEADLINE}, // प
+    {278, 0, 9, 4, 8, GLYPH_HEADLINE}, // ब
+    {301, 0, 9, 4, 4, GLYPH_HEADLINE}, // म
+    {312, 0, 9, 4, 6, GLYPH_HEADLINE}, // य
+    {329, 0, 6, 4, 7, GLYPH_HEADLINE}, // र
+    {343, 0, 10, 4, 9, GLYPH_HEADLINE}, // ल
+    {373, 0, 9, 4, 8, GLYPH_HEADLINE}, // व
+    {396, 0, 9, 4, 7, GLYPH_HEADLINE}, // स
+    {418, 0, 8, 4, 8, GLYPH_HEADLINE}, // ह
+    {434, 0, 6, 7, 3, GLYPH_HEADLINE}, // न्
+    {440, 0, 8, 4, 10, GLYPH_HEADLINE}, // द्ध
+    {464, 0, 3, 4, 1, GLYPH_HEADLINE}, // ा
+    {466, 0, 3, 0, 5, GLYPH_HEADLINE}, // ि
+    {476, -6, 3, 0, 5, GLYPH_HEADLINE}, // ी
+    {486, -6, 0, 0, 3, 0}, // े
+    {492, -6, 0, 0, 3, 0}, // ै
+    {501, -3, 3, 0, 5, GLYPH_HEADLINE}, // ो
+    {510, -3, 3, 0, 5, GLYPH_HEADLINE}, // ौ
+};
+constexpr uint8_t GLYPH_COUNT = 33;
+
+constexpr RunFont FONT = {RUNS, GLYPHS, GLYPH_COUNT, 16, 3};
+
+constexpr uint8_t SEQ[] = {
+    0x01, 0x1A, 0x0F, 0x0C, 0x06, 0x1A, 0x14,
+    0x16, 0x10, 0x1E, 0x00, 0x0A, 0x1C, 0x06,
+    0x17, 0x13, 0x1A, 0x05, 0x06, 0x1F,
+    0x1B, 0x10, 0x13, 0x1A, 0x11, 0x1C,
+    0x1B, 0x17, 0x11, 0x0F, 0x1A, 0x0C,
+    0x04, 0x0F, 0x06, 0x13, 0x0B,
+    0x08, 0x1A, 0x02, 0x0C, 0x1D,
+    0x09, 0x0E, 0x1A, 0x15, 0x13,
+    0x0F, 0x1B, 0x17, 0x13, 0x1F,
+    0x04, 0x19, 0x1A, 0x13,
+    0x07, 0x1A, 0x0E, 0x1A,
+    0x0D, 0x10, 0x1A, 0x03,
+    0x0F, 0x1A, 0x0E, 0x1C,
+    0x11, 0x20, 0x16, 0x11,
+    0x01, 0x18, 0x12,
+};
+
+constexpr ShapedText ALERT_WORDS[15] = {
+    {SEQ + 0, 7, 56}, // आपतकाल
+    {SEQ + 20, 6, 33}, // बिरामी
+    {SEQ + 60, 4, 28}, // दबाई
+    {SEQ + 52, 4, 25}, // उद्धार
+    {SEQ + 7, 7, 43}, // सबै ठीक
+    {SEQ + 37, 5, 29}, // घाइते
+    {SEQ + 56, 4, 25}, // खाना
+    {SEQ + 64, 4, 24}, // पानी
+    {SEQ + 68, 4, 30}, // मौसम
+    {SEQ + 14, 6, 38}, // हराएको
+    {SEQ + 42, 5, 36}, // जनावर
+    {SEQ + 47, 5, 29}, // पहिरो
+    {SEQ + 26, 6, 41}, // हिमपात
+    {SEQ + 32, 5, 43}, // उपकरण
+    {SEQ + 72, 3, 27} // अन्य
+};
+constexpr uint8_t ALERT_WORDS_COUNT = 15;
+
+} // namespace ui_ne
+} // namespace lifeline
+
+#endif // LIFELINE_UI_TEXT_NE_TABLE_H
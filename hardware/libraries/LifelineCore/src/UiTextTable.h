@@ -0,0 +1,183 @@
+/*
+ * GENERATED from extras/ui_text.txt by extras/gen_ui_text.py.
+ * Do not edit; change the text file and rerun the generator.
+ */
+
+#ifndef LIFELINE_UI_TEXT_TABLE_H
+#define LIFELINE_UI_TEXT_TABLE_H
+
+namespace lifeline {
+namespace ui {
+
+// 80 strings in 832 bytes (984 as separate literals)
+constexpr char POOL[] =
+    "Waiting for emergency signals...\0" // 0
+    "EMERGENCY COMMUNICATION\0" // 33
+    "Waiting for signals...\0" // 57
+    "CALIBRATION COMPLETE!\0" // 80
+    "EMERGENCY TRANSMITTER\0" // 102
+    "Returning to menu...\0" // 124
+    "SENDING SOS CODE: 55\0" // 145
+    "EMERGENCY RECEIVER\0" // 166
+    "LANDSLIDE DETECTED\0" // 185
+    "EQUIPMENT FAILURE\0" // 204
+    "EVACUATION NEEDED\0" // 222
+    "KEEP DEVICE STILL\0" // 240
+    "MEDICAL EMERGENCY\0" // 258
+    "MEDICINE SHORTAGE\0" // 276
+    "RED = Send Failed\0" // 294
+    "GREEN = Sent OK\0" // 312
+    "INJURY REPORTED\0" // 328
+    "Initializing...\0" // 344
+    "OTHER EMERGENCY\0" // 360
+    "CALIBRATING...\0" // 376
+    "LED INDICATORS\0" // 391
+    "WATER SHORTAGE\0" // 406
+    "ANIMAL ATTACK\0" // 421
+    "FOOD SHORTAGE\0" // 435
+    "MEDICAL EMERG\0" // 449
+    "Message Sent!\0" // 463
+    "SELECT ALERTS\0" // 477
+    "WEATHER ALERT\0" // 491
+    "BASE STATION\0" // 505
+    "MED SHORTAGE\0" // 518
+    "Returning...\0" // 531
+    "Send Failed!\0" // 544
+    "ANIMAL ATTK\0" // 557
+    "LOST PERSON\0" // 569
+    "WATER SHORT\0" // 581
+    "EQUIP FAIL\0" // 593
+    "EVACUATION\0" // 604
+    "FOOD SHORT\0" // 615
+    "NAVIGATION\0" // 626
+    "SNOW STORM\0" // 637
+    "EQUIPMENT\0" // 648
+    "LANDSLIDE\0" // 658
+    "LISTENING\0" // 668
+    "STATUS OK\0" // 678
+    "# CANCEL\0" // 688
+    "CRITICAL\0" // 697
+    "LifeLine\0" // 706
+    "MEDICINE\0" // 715
+    "WARNING!\0" // 724
+    "* RETRY\0" // 733
+    "MEDICAL\0" // 741
+    "SENDING\0" // 749
+    "WEATHER\0" // 757
+    "# MENU\0" // 765
+    "* SEND\0" // 772
+    "ANIMAL\0" // 779
+    "INJURY\0" // 786
+    "MEDIUM\0" // 793
+    "OTHER\0" // 800
+    "WATER\0" // 806
+    "FOOD\0" // 812
+    "HIGH\0" // 817
+    "INFO\0" // 822
+    "SNOW\0"; // 827
+
+constexpr Text ALERT_NAMES[15] = {
+    {POOL + 266, 54}, // EMERGENCY
+    {POOL + 258, 102}, // MEDICAL EMERGENCY
+    {POOL + 276, 102}, // MEDICINE SHORTAGE
+    {POOL + 222, 102}, // EVACUATION NEEDED
+    {POOL + 678, 54}, // STATUS OK
+    {POOL + 328, 90}, // INJURY REPORTED
+    {POOL + 435, 78}, // FOOD SHORTAGE
+    {POOL + 406, 84}, // WATER SHORTAGE
+    {POOL + 491, 78}, // WEATHER ALERT
+    {POOL + 569, 66}, // LOST PERSON
+    {POOL + 421, 78}, // ANIMAL ATTACK
+    {POOL + 658, 54}, // LANDSLIDE
+    {POOL + 637, 60}, // SNOW STORM
+    {POOL + 204, 102}, // EQUIPMENT FAILURE
+    {POOL + 360, 90} // OTHER EMERGENCY
+};
+constexpr uint8_t ALERT_NAMES_COUNT = 15;
+
+constexpr Text ALERT_SHORT[15] = {
+    {POOL + 266, 54}, // EMERGENCY
+    {POOL + 449, 78}, // MEDICAL EMERG
+    {POOL + 518, 72}, // MED SHORTAGE
+    {POOL + 604, 60}, // EVACUATION
+    {POOL + 678, 54}, // STATUS OK
+    {POOL + 786, 36}, // INJURY
+    {POOL + 615, 60}, // FOOD SHORT
+    {POOL + 581, 66}, // WATER SHORT
+    {POOL + 757, 42}, // WEATHER
+    {POOL + 569, 66}, // LOST PERSON
+    {POOL + 557, 66}, // ANIMAL ATTK
+    {POOL + 658, 54}, // LANDSLIDE
+    {POOL + 637, 60}, // SNOW STORM
+    {POOL + 593, 60}, // EQUIP FAIL
+    {POOL + 800, 30} // OTHER
+};
+constexpr uint8_t ALERT_SHORT_COUNT = 15;
+
+constexpr Text ALERT_WORDS[15] = {
+    {POOL + 266, 54}, // EMERGENCY
+    {POOL + 741, 42}, // MEDICAL
+    {POOL + 715, 48}, // MEDICINE
+    {POOL + 604, 60}, // EVACUATION
+    {POOL + 678, 54}, // STATUS OK
+    {POOL + 786, 36}, // INJURY
+    {POOL + 812, 24}, // FOOD
+    {POOL + 806, 30}, // WATER
+    {POOL + 757, 42}, // WEATHER
+    {POOL + 569, 66}, // LOST PERSON
+    {POOL + 779, 36}, // ANIMAL
+    {POOL + 658, 54}, // LANDSLIDE
+    {POOL + 827, 24}, // SNOW
+    {POOL + 648, 54}, // EQUIPMENT
+    {POOL + 800, 30} // OTHER
+};
+constexpr uint8_t ALERT_WORDS_COUNT = 15;
+
+constexpr Text PRIORITY_LABELS[5] = {
+    {POOL + 697, 48}, // CRITICAL
+    {POOL + 817, 24}, // HIGH
+    {POOL + 793, 36}, // MEDIUM
+    {POOL + 325, 12}, // OK
+    {POOL + 822, 24} // INFO
+};
+constexpr uint8_t PRIORITY_LABELS_COUNT = 5;
+
+constexpr Text MANUAL_TITLES[4] = {
+    {POOL + 477, 78}, // SELECT ALERTS
+    {POOL + 626, 60}, // NAVIGATION
+    {POOL + 749, 42}, // SENDING
+    {POOL + 391, 84} // LED INDICATORS
+};
+constexpr uint8_t MANUAL_TITLES_COUNT = 4;
+
+constexpr Text LIFELINE = {POOL + 706, 48}; // LifeLine
+constexpr Text EMERGENCY_COMMUNICATION = {POOL + 33, 138}; // EMERGENCY COMMUNICATION
+constexpr Text EMERGENCY_TRANSMITTER = {POOL + 102, 126}; // EMERGENCY TRANSMITTER
+constexpr Text EMERGENCY_RECEIVER = {POOL + 166, 108}; // EMERGENCY RECEIVER
+constexpr Text TRANSMITTER = {POOL + 112, 66}; // TRANSMITTER
+constexpr Text BASE_STATION = {POOL + 505, 72}; // BASE STATION
+constexpr Text INITIALIZING = {POOL + 344, 90}; // Initializing...
+constexpr Text LISTENING = {POOL + 668, 54}; // LISTENING
+constexpr Text WAITING_FOR_SIGNALS = {POOL + 57, 132}; // Waiting for signals...
+constexpr Text WAITING_FOR_EMERGENCY_SIGNALS = {POOL + 0, 192}; // Waiting for emergency signals...
+constexpr Text SEND = {POOL + 772, 36}; // * SEND
+constexpr Text CANCEL = {POOL + 688, 48}; // # CANCEL
+constexpr Text RETRY = {POOL + 733, 42}; // * RETRY
+constexpr Text MENU = {POOL + 765, 36}; // # MENU
+constexpr Text MESSAGE_SENT = {POOL + 463, 78}; // Message Sent!
+constexpr Text SEND_FAILED = {POOL + 544, 72}; // Send Failed!
+constexpr Text RETURNING = {POOL + 531, 72}; // Returning...
+constexpr Text RETURNING_TO_MENU = {POOL + 124, 120}; // Returning to menu...
+constexpr Text CALIBRATING = {POOL + 376, 84}; // CALIBRATING...
+constexpr Text KEEP_DEVICE_STILL = {POOL + 240, 102}; // KEEP DEVICE STILL
+constexpr Text CALIBRATION_COMPLETE = {POOL + 80, 126}; // CALIBRATION COMPLETE!
+constexpr Text WARNING = {POOL + 724, 48}; // WARNING!
+constexpr Text LANDSLIDE_DETECTED = {POOL + 185, 108}; // LANDSLIDE DETECTED
+constexpr Text SENDING_SOS_CODE = {POOL + 145, 120}; // SENDING SOS CODE: 55
+constexpr Text MANUAL_LED_GREEN = {POOL + 312, 90}; // GREEN = Sent OK
+constexpr Text MANUAL_LED_RED = {POOL + 294, 102}; // RED = Send Failed
+
+} // namespace ui
+} // namespace lifeline
+
+#endif // LIFELINE_UI_TEXT_TABLE_H
@@ -0,0 +1,201 @@
+/*
+ * ═══════════════════════════════════════════════════════════════════════════
+ *                   LIFELINE CORE - GATEWAY UPLINK RETRY LANE
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * What the gateway does with an uplink the API did not take. Each reply is
+ * classified once:
+ *
+ *   UPLINK_OK        2xx: the row exists.
+ *   UPLINK_RETRY     No reply (refused, timeout, connection lost), 408,
+ *                    425, 429 or 5xx: the same request can work later.
+ *   UPLINK_UNKNOWN   404 "Device not found": the handheld is not registered.
+ *                    The alert goes to the lane and out again with
+ *                    "auto_register", which creates the device row first.
+ *   UPLINK_TERMINAL  Any other status: the request itself is wrong, and
+ *                    sending it again cannot help. Logged and counted.
+ *
+ *   lifeline::UplinkLane<> lane;
+ *   const lifeline::UplinkResult r = lifeline::classifyUplink(status, reply);
+ *   if (r == lifeline::UPLINK_RETRY || r == lifeline::UPLINK_UNKNOWN)
+ *     lane.push(alert, r, millis());
+ *   lifeline::PendingUplink next;
+ *   if (lane.popDue(next, millis())) ...    // One per loop pass
+ *
+ *   Backoff  A retry waits UPLINK_RETRY_BASE_MS, doubling with each attempt
+ *            up to UPLINK_RETRY_MAX_MS. The unknown-device lane goes out on
+ *            the next pass: the first SOS of a new handheld should not wait.
+ *   Full     UPLINK_LANE_SLOTS alerts. A new one replaces the least urgent
+ *            waiting alert if it is more urgent. Otherwise it is dropped and
+ *            counted.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef LIFELINE_UPLINK_LANE_H
+#define LIFELINE_UPLINK_LANE_H
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "MemoryBudget.h" // printfTo(): the gateway runs with the heap frozen
+
+#ifndef UPLINK_LANE_SLOTS
+#define UPLINK_LANE_SLOTS 8 // Alerts waiting for another uplink attempt
+#endif
+#ifndef UPLINK_RETRY_BASE_MS
+#define UPLINK_RETRY_BASE_MS 2000
+#endif
+#ifndef UPLINK_RETRY_MAX_MS
+#define UPLINK_RETRY_MAX_MS 60000
+#endif
+
+namespace lifeline {
+
+enum UplinkResult : uint8_t {
+  UPLINK_OK,
+  UPLINK_RETRY,
+  UPLINK_UNKNOWN,
+  UPLINK_TERMINAL,
+};
+
+static const char *const uplinkResultNames[] = {"ok", "retry",
+                                                "unknown device", "terminal"};
+
+/** status: HTTP code, or < 0 for an HTTPClient error. reply may be nullptr. */
+inline UplinkResult classifyUplink(int status, const char *reply) {
+  if (status >= 200 && status < 300)
+    return UPLINK_OK;
+  if (status < 0)
+    return UPLINK_RETRY;
+  if (status == 404 && reply && strstr(reply, "Device not found"))
+    return UPLINK_UNKNOWN;
+  if (status == 408 || status == 425 || status == 429 || status >= 500)
+    return UPLINK_RETRY;
+  return UPLINK_TERMINAL;
+}
+
+struct PendingUplink {
+  uint32_t firstMs;   // When the alert arrived
+  uint32_t dueMs;     // Next attempt
+  uint16_t deviceId;
+  int16_t rssi;
+  uint8_t alertIndex;
+  uint8_t priority;   // 0 = critical
+  uint8_t attempts;   // Uplinks tried so far
+  uint16_t suppressed; // Rate-limited alerts reported with this one
+  bool autoRegister;  // Send with "auto_register"
+  bool reportOnly;    // Just the suppressed count, for the device's last row
+};
+
+template <uint8_t SLOTS = UPLINK_LANE_SLOTS> class UplinkLane {
+public:
+  struct Stats {
+    uint32_t queued = 0;
+    uint32_t delivered = 0; // Reached the API on a later attempt
+    uint32_t dropped = 0;   // Lost to a full lane
+    uint32_t terminal = 0;  // Given up on (countTerminal)
+    uint8_t peak = 0;
+  };
+
+  /**
+   * Queue an alert after an attempt that came back as why (UPLINK_RETRY or
+   * UPLINK_UNKNOWN). p.attempts is the number tried so far.
+   */
+  bool push(PendingUplink p, UplinkResult why, uint32_t nowMs) {
+    stats_.queued++;
+    if (why == UPLINK_UNKNOWN) {
+      p.autoRegister = true;
+      p.dueMs = nowMs;
+    } else {
+      p.dueMs = nowMs + backoffMs(p.attempts);
+    }
+    if (count_ == SLOTS) {
+      stats_.dropped++;
+      const uint8_t worst = leastUrgent();
+      if (p.priority >= slots_[worst].priority)
+        return false;
+      removeAt(worst);
+    }
+    slots_[count_++] = p;
+    if (count_ > stats_.peak)
+      stats_.peak = count_;
+    return true;
+  }
+
+  /** The most urgent alert that is due, taken out of the lane. */
+  bool popDue(PendingUplink &out, uint32_t nowMs) {
+    int best = -1;
+    for (uint8_t i = 0; i < count_; i++) {
+      const PendingUplink &p = slots_[i];
+      if ((int32_t)(nowMs - p.dueMs) < 0)
+        continue;
+      if (best < 0 || p.priority < slots_[best].priority ||
+          (p.priority == slots_[best].priority &&
+           (int32_t)(p.firstMs - slots_[best].firstMs) < 0))
+        best = i;
+    }
+    if (best < 0)
+      return false;
+    out = slots_[best];
+    removeAt((uint8_t)best);
+    return true;
+  }
+
+  /** A queued alert reached the API. */
+  void delivered() { stats_.delivered++; }
+  /** A queued alert came back terminal. */
+  void countTerminal() { stats_.terminal++; }
+
+  /** Alerts from deviceId go out on the next pass (it was just registered). */
+  void release(uint16_t deviceId, uint32_t nowMs) {
+    for (uint8_t i = 0; i < count_; i++) {
+      if (slots_[i].deviceId == deviceId)
+        slots_[i].dueMs = nowMs;
+    }
+  }
+
+  static uint32_t backoffMs(uint8_t attempts) {
+    uint32_t ms = UPLINK_RETRY_BASE_MS;
+    for (uint8_t i = 1; i < attempts && ms < UPLINK_RETRY_MAX_MS; i++)
+      ms *= 2;
+    return ms < UPLINK_RETRY_MAX_MS ? ms : UPLINK_RETRY_MAX_MS;
+  }
+
+  uint8_t size() const { return count_; }
+  bool empty() const { return count_ == 0; }
+  static constexpr uint8_t capacity() { return SLOTS; }
+  const Stats &stats() const { return stats_; }
+
+  void printReport(Print &out) const {
+    printfTo(out, "[LANE] %u waiting of %u; %lu queued, %lu delivered, %lu "
+                  "dropped, %lu terminal, peak %u\n",
+             count_, SLOTS, (unsigned long)stats_.queued,
+             (unsigned long)stats_.delivered, (unsigned long)stats_.dropped,
+             (unsigned long)stats_.terminal, stats_.peak);
+  }
+
+private:
+  /** Lowest priority, and of those the newest. */
+  uint8_t leastUrgent() const {
+    uint8_t worst = 0;
+    for (uint8_t i = 1; i < count_; i++) {
+      const PendingUplink &p = slots_[i];
+      if (p.priority > slots_[worst].priority ||
+          (p.priority == slots_[worst].priority &&
+           (int32_t)(p.firstMs - slots_[worst].firstMs) > 0))
+        worst = i;
+    }
+    return worst;
+  }
+
+  void removeAt(uint8_t i) { slots_[i] = slots_[--count_]; }
+
+  PendingUplink slots_[SLOTS];
+  uint8_t count_ = 0;
+  Stats stats_;
+};
+
+} // namespace lifeline
+
+#endif // LIFELINE_UPLINK_LANE_H
@@ -22,7 +22,32 @@
  *   - Communication: LoRa SX1278 @ 433 MHz
  *   - Indicators: Buzzer for alert notifications
  * 
- * PACKET FORMAT: TX[ID],[ALERT_CODE] (e.g., "TX003,A")
+ * PACKET FORMAT: TX[ID],[ALERT_CODE][;k=MS][;s=SEQ] (e.g., "TX003,A;k=412;s=17")
+ *   k = TX key press → radio start in ms, folded into the latency budget
+ *   s = alert sequence number; a repeat inside 2 minutes is dropped
+ * HEARTBEAT:     HB[ID];i=[AVG_mA x10];l=[HOURS];u=[UPTIME_MIN] - logged, never an alert
+ * 
+ * INBOX: every alert stays open until acknowledged, most urgent first
+ *   List    BOOT press: next row, hold ~1 s: open it
+ *   Alert   BOOT press: back to the list, hold ~1 s: acknowledge
+ *   Serial  next / open / ack / back / inbox (no keypad on the RX)
+ * 
+ * LINKS: RSSI/SNR averages and s= loss for every device heard, weakest first
+ *   Idle    BOOT press: link screen (press: next page, hold: back)
+ *   Serial  links; each uplink carries the sender's numbers ("link")
+ * 
+ * UPLINK: registered DIDs are fetched from the API (ETag, 304 when unchanged)
+ *   Unknown  An unregistered DID goes out with "auto_register"; a 404 for
+ *            one the registry missed is sent again the same way
+ *   Retry    No reply, 408, 429, 5xx: back off 2 s .. 60 s, most urgent first
+ *   Serial   uplink
+ * 
+ * RATE LIMIT: a token bucket per device, so one stuck unit cannot flood the site
+ *   Limit    4 back to back, then 6 a minute; +6 for critical alerts (portal)
+ *   Over     Not uplinked, shown or sounded: counted, and the count goes out
+ *            with the device's next uplink ("suppressed"), or on its own
+ *            ("suppressed_only") once it has waited a minute
+ *   Serial   rate
  * 
  * Author: LifeLine Development Team
  * Version: 3.1.0 PRO
@@ -38,6 +63,20 @@
 #include <HTTPClient.h>
 #include <WebServer.h>
 #include <Preferences.h>
+#include <AlertFrame.h>
+#include <AlertInbox.h>
+#include <AlertJournal.h>
+#include <BootSequencer.h>
+#include <DeviceRegistry.h>
+#include <LatencyBudget.h>
+#include <LinkStats.h>
+#include <MemoryBudget.h>
+#include <RateLimiter.h>
+#include <RingQueue.h>
+#include <SpiArbiter.h>
+#include <St7789Dma.h>
+#include <UiText.h>
+#include <UplinkLane.h>
 
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                              DEVICE CONFIGURATION
@@ -60,12 +99,22 @@
 
 // Web Dashboard API Endpoint
 #define API_ENDPOINT        "https://zenithkandel.com.np/lifeline/API/Create/message.php"
+#define API_REGISTRY_ENDPOINT "https://zenithkandel.com.np/lifeline/API/Read/registry.php"
+#define API_AUTO_REGISTER   true           // Unregistered DIDs are created by the API
+#define REGISTRY_SYNC_MS    300000         // Registry re-check (304 when unchanged): 5 minutes
+#define REGISTRY_RETRY_MS   30000          // After a failed fetch
+#define API_CONNECT_TIMEOUT_MS 3000        // HTTP connect; the radio is not read while it blocks
+#define API_READ_TIMEOUT_MS 4000           // HTTP response; a timeout goes to the retry lane
 
 // WiFi Portal Configuration
 #define WIFI_AP_SSID        "LifeLine-RX-Setup"
 #define WIFI_AP_PASSWORD    "lifeline123"
 #define WIFI_PORTAL_TIMEOUT 180000         // Portal timeout: 3 minutes (ms)
 #define WIFI_CONNECT_TIMEOUT 10000         // Connection timeout: 10 seconds (ms)
+#define WIFI_SSID_MAX       32             // 802.11 SSID limit
+#define WIFI_PASSWORD_MAX   64             // WPA2 passphrase limit
+#define UPLINK_BODY_MAX     256            // JSON body of one API uplink
+#define UPLINK_REPLY_MAX    128            // API response kept for the MID
 
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                              PIN DEFINITIONS
@@ -269,43 +318,11 @@
 
 #define ALERT_COUNT 15
 
-// Alert messages - MUST match transmitter configuration
-const char* alertNames[ALERT_COUNT] = {
-    "EMERGENCY",            // 0  - A - CRITICAL
-    "MEDICAL EMERGENCY",    // 1  - B - CRITICAL
-    "MEDICINE SHORTAGE",    // 2  - C - MEDIUM
-    "EVACUATION NEEDED",    // 3  - D - CRITICAL
-    "STATUS OK",            // 4  - E - OK
-    "INJURY REPORTED",      // 5  - F - HIGH
-    "FOOD SHORTAGE",        // 6  - G - MEDIUM
-    "WATER SHORTAGE",       // 7  - H - MEDIUM
-    "WEATHER ALERT",        // 8  - I - MEDIUM
-    "LOST PERSON",          // 9  - J - HIGH
-    "ANIMAL ATTACK",        // 10 - K - HIGH
-    "LANDSLIDE",            // 11 - L - HIGH
-    "SNOW STORM",           // 12 - M - HIGH
-    "EQUIPMENT FAILURE",    // 13 - N - MEDIUM
-    "OTHER EMERGENCY"       // 14 - O - NEUTRAL
-};
-
-// Shorter names for compact display
-const char* alertNamesShort[ALERT_COUNT] = {
-    "EMERGENCY",
-    "MEDICAL EMERG",
-    "MED SHORTAGE",
-    "EVACUATION",
-    "STATUS OK",
-    "INJURY",
-    "FOOD SHORT",
-    "WATER SHORT",
-    "WEATHER",
-    "LOST PERSON",
-    "ANIMAL ATTK",
-    "LANDSLIDE",
-    "SNOW STORM",
-    "EQUIP FAIL",
-    "OTHER"
-};
+// Alert names live once in LifelineCore (UiText.h), shared with the transmitter
+const lifeline::Text* const alertNames = lifeline::ui::ALERT_NAMES;
+const lifeline::Text* const alertNamesShort = lifeline::ui::ALERT_SHORT;
+static_assert(lifeline::ui::ALERT_NAMES_COUNT == ALERT_COUNT,
+              "alert table size must match ALERT_COUNT");
 
 // Priority levels: 0=CRITICAL, 1=HIGH, 2=MEDIUM, 3=OK, 4=NEUTRAL
 const uint8_t alertPriority[ALERT_COUNT] = {
@@ -313,23 +330,55 @@ const uint8_t alertPriority[ALERT_COUNT] = {
 };
 
 // Priority label text
-const char* priorityLabels[] = {"CRITICAL", "HIGH", "MEDIUM", "OK", "INFO"};
+const lifeline::Text* const priorityLabels = lifeline::ui::PRIORITY_LABELS;
 
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                              TIMING CONSTANTS
 // ═══════════════════════════════════════════════════════════════════════════════════
 
-#define BOOT_DISPLAY_TIME       1000    // Boot screen duration (ms) - 1 second
+#define LORA_INIT_RETRIES       3       // Extra LoRa.begin() attempts at boot
 #define ALERT_DISPLAY_TIME      30000   // Alert display time before auto-return (ms)
 #define IDLE_PULSE_INTERVAL     600     // Pulse animation interval (ms)
 #define HISTORY_MAX_ITEMS       10      // Maximum alerts in history
+#define INBOX_ROW_H             26      // List row pitch (px)
+#define INBOX_ROWS              (CONTENT_HEIGHT / INBOX_ROW_H)  // Rows per page
+#define INBOX_REFRESH_MS        1000    // Row ages are checked this often
+#define LINKS_REFRESH_MS        1000    // Link rows are redrawn at most this often
+#define RX_FRAME_SLOTS          8       // Frames read off the radio, not yet parsed
+
+// After boot the gateway runs on static buffers only. On the host an
+// allocation outside a library call (HTTPClient, WebServer) asserts; on the
+// board only heap drift is watched. Serial "mem" prints the budget and the
+// drift since boot.
+#define NO_HEAP_AFTER_BOOT      true
 
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                              GLOBAL OBJECTS
 // ═══════════════════════════════════════════════════════════════════════════════════
 
-// TFT Display (Hardware SPI - shared with LoRa module)
-Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_RST);
+// TFT Display (DMA on HSPI; SCK/MOSI shared with LoRa, see spiBus)
+// RST is pulsed by the boot sequencer so the driver does not block on it
+lifeline::St7789Dma tft(TFT_CS, TFT_DC, -1, NATIVE_WIDTH, NATIVE_HEIGHT);
+
+// LoRa gets the shared bus first: DIO0 is checked between display slices
+// and the FIFO read right away (serial "lat" prints the bus waits)
+lifeline::SpiArbiter spiBus;
+
+// A frame read off the radio at RxDone, parsed later by the loop
+struct RxFrame {
+    char data[FRAME_MAX_LEN + 1];
+    uint8_t len;
+    int16_t rssi;
+    float snr;
+    uint32_t readUs;    // FIFO read done
+    uint32_t busWaitUs; // Worst-case wait for the bus after RxDone
+};
+lifeline::SpscQueue<RxFrame, RX_FRAME_SLOTS> rxFrames;
+
+// Overlapped panel / radio / WiFi bring-up (serial "boot" prints the timeline)
+lifeline::BootSequencer bootSeq;
+int8_t radioBootTask = -1;
+int8_t panelBootTask = -1;
 
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                              STATE MANAGEMENT
@@ -341,7 +390,9 @@ enum ScreenState {
     SCREEN_IDLE,            // 1 - Waiting for signals
     SCREEN_ALERT,           // 2 - Alert display
     SCREEN_HISTORY,         // 3 - Alert history view
-    SCREEN_SYSTEM_INFO      // 4 - System information display
+    SCREEN_SYSTEM_INFO,     // 4 - System information display
+    SCREEN_INBOX,           // 5 - Open alerts, most urgent first
+    SCREEN_LINKS            // 6 - Link quality per device, weakest first
 };
 
 // Current application state
@@ -371,10 +422,72 @@ AlertRecord alertHistory[HISTORY_MAX_ITEMS];
 int historyCount = 0;
 int historyScrollOffset = 0;
 
+// Open alerts until the operator acknowledges them (serial "inbox")
+lifeline::AlertInbox<> inbox;
+uint32_t shownAlertId = 0;      // Inbox alert on the alert screen
+
+// List view: cursor rank, and what each row shows now (redrawn on change)
+struct InboxRowShown {
+    uint32_t id;                // 0: empty row
+    uint32_t ageMin;
+    uint8_t repeats;
+    bool selected;
+};
+InboxRowShown inboxRows[INBOX_ROWS];
+uint8_t inboxCursor = 0;
+uint8_t inboxBadgeCount = 0;
+uint32_t inboxShownVersion = 0;
+unsigned long inboxRefreshTime = 0;
+char inboxFooter[64] = "";
+uint32_t inboxDroppedShown = 0;  // Count on the "+N dropped" row (0: none drawn)
+
 // System status
 bool loraInitialized = false;
 int totalAlertsReceived = 0;
 
+// Latency budget for the frame in flight (serial "lat" prints the report)
+lifeline::LatencyTrace rxTrace;
+lifeline::LatencyRecorder<> rxLatency;
+
+// Repeats of an alert (TX retry or resume after reset) carry the same s=
+lifeline::DuplicateFilter rxDedupe;
+
+// Signal and loss per device (serial "links", the LINKS screen, the uplink)
+lifeline::LinkStats<> links;
+
+// Alerts per device: one unit with a stuck key must not take the site's
+// uplink, notifications and inbox with it (limits set in the WiFi portal)
+lifeline::RateLimiter<> rateLimiter;
+#define RATE_REPORT_MS      60000   // A count no alert has carried goes out on its own
+
+// Link screen: page, and what each row shows now (redrawn on change)
+struct LinkRowShown {
+    uint16_t deviceId;          // 0xFFFF: empty row
+    uint32_t packets;           // UINT32_MAX: not drawn yet
+    uint32_t ageMin;
+};
+LinkRowShown linkRows[INBOX_ROWS];
+uint8_t linksFirst = 0;
+unsigned long linksRefreshTime = 0;
+char linksFooter[64] = "";
+
+// Uplink round trip of the previous message, reported with the next one
+int prevUplinkMid = 0;
+long prevUplinkMs = -1;
+
+// Uplink record: JSON body and API reply, reused for every message
+lifeline::FixedString<UPLINK_BODY_MAX> uplinkBody;
+lifeline::FixedString<UPLINK_REPLY_MAX> uplinkReply;
+
+// Registered DIDs (API/Read/registry.php) and the uplinks waiting for a retry
+lifeline::DeviceRegistry<> registry;
+lifeline::UplinkLane<> uplinkLane;
+unsigned long registryFetchTime = 0;
+bool registryFetched = false;           // At least one fetch tried
+
+// Static blocks booked at boot; the heap is frozen once boot is done
+lifeline::MemoryBudget memBudget;
+
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                              WIFI STATE MANAGEMENT
 // ═══════════════════════════════════════════════════════════════════════════════════
@@ -390,10 +503,17 @@ unsigned long portalStartTime = 0;
 unsigned long buttonPressStartTime = 0;
 bool buttonPressed = false;
 #define LONG_PRESS_DURATION 3000  // 3 seconds for long press
+#define BUTTON_DEBOUNCE_MS  30    // Shorter is contact bounce
+#define BUTTON_HOLD_MS      600   // Released after this: a hold (open / acknowledge)
+#define BUTTON_HOLD_MAX_MS  1500  // Past this the WiFi setup bar shows
 
 // Stored WiFi credentials
-String storedSSID = "";
-String storedPassword = "";
+char storedSSID[WIFI_SSID_MAX + 1] = "";
+char storedPassword[WIFI_PASSWORD_MAX + 1] = "";
+
+// Background connect started at boot (loop() follows it, never blocks)
+bool wifiConnecting = false;
+unsigned long wifiConnectStart = 0;
 
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                          SERIAL DEBUG CONFIGURATION
@@ -402,7 +522,7 @@ String storedPassword = "";
 #define SERIAL_DEBUG_ENABLED true
 #define SERIAL_BAUD_RATE     115200
 
-String serialInputBuffer = "";
+lifeline::FixedString<48> serialInputBuffer;
 
 /**
  * Check for Serial input to simulate received alerts
@@ -416,72 +536,141 @@ bool checkSerialSimulatedPacket(int& deviceId, int& alertIndex, int& rssi) {
         if (c == '\n' || c == '\r') {
             if (serialInputBuffer.length() > 0) break;
         } else {
-            serialInputBuffer += c;
+            serialInputBuffer.append(c);
         }
     }
     
     if (serialInputBuffer.length() == 0) return false;
     
-    String input = serialInputBuffer;
-    serialInputBuffer = "";
-    input.trim();
+    // Trimmed copy of the line on the stack
+    char input[serialInputBuffer.capacity() + 1];
+    const char* start = serialInputBuffer.c_str();
+    while (*start == ' ' || *start == '\t') start++;
+    size_t inputLen = strlen(start);
+    while (inputLen > 0 && (start[inputLen - 1] == ' ' || start[inputLen - 1] == '\t')) inputLen--;
+    memcpy(input, start, inputLen);
+    input[inputLen] = '\0';
+    serialInputBuffer.clear();
     
-    if (input.length() == 0) return false;
+    if (inputLen == 0) return false;
     
     // Help command
-    if (input == "h" || input == "H" || input == "help" || input == "?") {
+    if (!strcmp(input, "h") || !strcmp(input, "H") || !strcmp(input, "help") || !strcmp(input, "?")) {
         printSerialDebugMenu();
         return false;
     }
     
+    // Latency report
+    if (!strcmp(input, "lat") || !strcmp(input, "LAT")) {
+        rxLatency.printReport(Serial);
+        spiBus.printReport(Serial);
+        lifeline::printfTo(Serial, "[BUS] %lu frames lost in the FIFO queue\n",
+                                   (unsigned long)rxFrames.dropped());
+        return false;
+    }
+    
+    // Boot timeline
+    if (!strcmp(input, "boot") || !strcmp(input, "BOOT")) {
+        bootSeq.printReport(Serial);
+        return false;
+    }
+    
+    // Static memory budget and heap drift
+    if (!strcmp(input, "mem") || !strcmp(input, "MEM")) {
+        memBudget.printReport(Serial);
+        return false;
+    }
+    
+    // Inbox keys (the RX has no keypad) and the open alerts
+    if (!strcmp(input, "inbox")) {
+        printInbox();
+        return false;
+    }
+    if (!strcmp(input, "next")) {
+        inboxNext();
+        return false;
+    }
+    if (!strcmp(input, "open")) {
+        inboxOpen();
+        return false;
+    }
+    if (!strcmp(input, "ack")) {
+        inboxAcknowledge();
+        return false;
+    }
+    if (!strcmp(input, "back")) {
+        inboxBack();
+        return false;
+    }
+    
+    // Link quality per device
+    if (!strcmp(input, "links")) {
+        printLinks();
+        return false;
+    }
+    
+    // Per-device rate limit
+    if (!strcmp(input, "rate")) {
+        rateLimiter.printReport(Serial, millis());
+        return false;
+    }
+    
+    // Device registry and the uplink retry lane
+    if (!strcmp(input, "uplink")) {
+        registry.printReport(Serial, millis());
+        uplinkLane.printReport(Serial);
+        return false;
+    }
+    
     // Quick single-digit command (1-9, 0)
-    if (input.length() == 1 && ((input[0] >= '0' && input[0] <= '9'))) {
+    if (inputLen == 1 && ((input[0] >= '0' && input[0] <= '9'))) {
         deviceId = 1;
         alertIndex = (input[0] == '0') ? 9 : input[0] - '1';
         rssi = -65;
-        Serial.printf("[SERIAL DEBUG] Quick alert: Device=%d, Alert=%d (%s)\n", 
-                      deviceId, alertIndex, alertNames[alertIndex]);
+        lifeline::printfTo(Serial, "[SERIAL DEBUG] Quick alert: Device=%d, Alert=%d (%s)\n", 
+                                   deviceId, alertIndex, alertNames[alertIndex].str);
         return true;
     }
     
     // Single letter alert code (A-O)
-    if (input.length() == 1 && ((input[0] >= 'A' && input[0] <= 'O') || (input[0] >= 'a' && input[0] <= 'o'))) {
+    if (inputLen == 1 && ((input[0] >= 'A' && input[0] <= 'O') || (input[0] >= 'a' && input[0] <= 'o'))) {
         deviceId = 1;
         char code = (input[0] >= 'a') ? (input[0] - 'a' + 'A') : input[0];
         alertIndex = code - 'A';
         rssi = -65;
-        Serial.printf("[SERIAL DEBUG] Quick alert: Device=%d, Alert=%c (%s)\n", 
-                      deviceId, code, alertNames[alertIndex]);
+        lifeline::printfTo(Serial, "[SERIAL DEBUG] Quick alert: Device=%d, Alert=%c (%s)\n", 
+                                   deviceId, code, alertNames[alertIndex].str);
         return true;
     }
     
     // Parse full format: DEVICE_ID,ALERT_CODE
-    int comma = input.indexOf(',');
-    if (comma <= 0) {
+    char* comma = strchr(input, ',');
+    if (comma == NULL || comma == input) {
         Serial.println("[SERIAL DEBUG] Invalid format. Use: DEVICE_ID,ALERT_CODE (e.g., '3,A')");
         return false;
     }
     
-    deviceId = input.substring(0, comma).toInt();
-    String alertPart = input.substring(comma + 1);
-    alertPart.trim();
+    *comma = '\0';
+    deviceId = atoi(input);
+    const char* alertPart = comma + 1;
+    while (*alertPart == ' ' || *alertPart == '\t') alertPart++;
     
-    if (alertPart.length() == 1 && alertPart[0] >= 'A' && alertPart[0] <= 'O') {
+    if (strlen(alertPart) == 1 && alertPart[0] >= 'A' && alertPart[0] <= 'O') {
         alertIndex = alertPart[0] - 'A';
-    } else if (alertPart.length() == 1 && alertPart[0] >= 'a' && alertPart[0] <= 'o') {
+    } else if (strlen(alertPart) == 1 && alertPart[0] >= 'a' && alertPart[0] <= 'o') {
         alertIndex = alertPart[0] - 'a';
     } else {
-        alertIndex = alertPart.toInt();
+        alertIndex = atoi(alertPart);
     }
     
     if (alertIndex < 0 || alertIndex >= ALERT_COUNT) {
-        Serial.printf("[SERIAL DEBUG] Invalid alert index: %d\n", alertIndex);
+        lifeline::printfTo(Serial, "[SERIAL DEBUG] Invalid alert index: %d\n", alertIndex);
         return false;
     }
     
     rssi = -65;
-    Serial.printf("[SERIAL DEBUG] Simulated packet: Device=%d, Alert=%d (%s)\n", 
-                  deviceId, alertIndex, alertNames[alertIndex]);
+    lifeline::printfTo(Serial, "[SERIAL DEBUG] Simulated packet: Device=%d, Alert=%d (%s)\n", 
+                               deviceId, alertIndex, alertNames[alertIndex].str);
     
     return true;
 }
@@ -501,6 +690,21 @@ void printSerialDebugMenu() {
     Serial.println(F("║ FULL FORMAT:                                               ║"));
     Serial.println(F("║   DEVICE_ID,ALERT_CODE  (e.g., '3,A' or '3,5')             ║"));
     Serial.println(F("║                                                            ║"));
+    Serial.println(F("║ REPORTS:                                                   ║"));
+    Serial.println(F("║   lat  : Latency budget per stage (p50/p90/p99)            ║"));
+    Serial.println(F("║   boot : Boot timeline (radio ready, first alert)          ║"));
+    Serial.println(F("║   mem  : Static memory budget, heap drift since boot       ║"));
+    Serial.println(F("║   uplink : Device registry, uplinks waiting for a retry    ║"));
+    Serial.println(F("║   rate : Per-device limits, alerts suppressed              ║"));
+    Serial.println(F("║                                                            ║"));
+    Serial.println(F("║ INBOX (BOOT button: press / hold ~1 s):                    ║"));
+    Serial.println(F("║   inbox : Open alerts, most urgent first                   ║"));
+    Serial.println(F("║   next  : Next row (press)    open : Open the row (hold)   ║"));
+    Serial.println(F("║   ack   : Acknowledge (hold)  back : Back to the list      ║"));
+    Serial.println(F("║                                                            ║"));
+    Serial.println(F("║ LINKS (BOOT press on the idle screen):                     ║"));
+    Serial.println(F("║   links : RSSI/SNR averages, loss, last heard per device   ║"));
+    Serial.println(F("║                                                            ║"));
     Serial.println(F("║ ALERT CODES:                                               ║"));
     Serial.println(F("║   A(0)=EMERGENCY       B(1)=MEDICAL      C(2)=MEDICINE     ║"));
     Serial.println(F("║   D(3)=EVACUATION      E(4)=STATUS OK    F(5)=INJURY       ║"));
@@ -557,13 +761,20 @@ int getRssiBarLevel(int rssi) {
 /**
  * Draw text centered horizontally
  */
+void drawCenteredText(const lifeline::Text& text, int y, uint8_t textSize, uint16_t color) {
+    tft.setTextSize(textSize);
+    tft.setTextColor(color);
+    tft.setCursor(lifeline::centerX(text, textSize, SCREEN_WIDTH), y);
+    tft.print(text.str);
+}
+
+/**
+ * Draw a runtime string (IDs, counters) centered horizontally
+ */
 void drawCenteredText(const char* text, int y, uint8_t textSize, uint16_t color) {
     tft.setTextSize(textSize);
     tft.setTextColor(color);
-    int16_t x1, y1;
-    uint16_t w, h;
-    tft.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
-    tft.setCursor((SCREEN_WIDTH - w) / 2, y);
+    tft.setCursor(lifeline::centerSpan(lifeline::textWidth(text, textSize), SCREEN_WIDTH), y);
     tft.print(text);
 }
 
@@ -573,10 +784,7 @@ void drawCenteredText(const char* text, int y, uint8_t textSize, uint16_t color)
 void drawRightText(const char* text, int y, uint8_t textSize, uint16_t color) {
     tft.setTextSize(textSize);
     tft.setTextColor(color);
-    int16_t x1, y1;
-    uint16_t w, h;
-    tft.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
-    tft.setCursor(SCREEN_WIDTH - w - MARGIN, y);
+    tft.setCursor(SCREEN_WIDTH - lifeline::textWidth(text, textSize) - MARGIN, y);
     tft.print(text);
 }
 
@@ -678,10 +886,7 @@ void drawHeader(const char* title) {
     
     // Title with slight shadow for depth
     tft.setTextSize(TEXT_MEDIUM);
-    int16_t x1, y1;
-    uint16_t w, h;
-    tft.getTextBounds(title, 0, 0, &x1, &y1, &w, &h);
-    int textY = (HEADER_HEIGHT - h) / 2 - 1;
+    int textY = (HEADER_HEIGHT - lifeline::TEXT_CHAR_H * TEXT_MEDIUM) / 2 - 1;
     
     // Shadow
     tft.setTextColor(RGB565(0, 0, 0));
@@ -818,24 +1023,21 @@ void drawBootScreen() {
     
     // ─────────────────── MAIN TITLE ───────────────────
     tft.setTextSize(TEXT_LARGE);
-    int16_t x1, y1;
-    uint16_t tw, th;
-    tft.getTextBounds("LifeLine", 0, 0, &x1, &y1, &tw, &th);
-    int titleX = (SCREEN_WIDTH - tw) / 2;
+    int titleX = lifeline::centerX(lifeline::ui::LIFELINE, TEXT_LARGE, SCREEN_WIDTH);
     int titleY = 78;
     
     // Shadow
     tft.setTextColor(RGB565(0, 50, 70));
     tft.setCursor(titleX + 1, titleY + 1);
-    tft.print(F("LifeLine"));
+    tft.print(lifeline::ui::LIFELINE.str);
     
     // Main text
     tft.setTextColor(COLOR_TEXT_PRIMARY);
     tft.setCursor(titleX, titleY);
-    tft.print(F("LifeLine"));
+    tft.print(lifeline::ui::LIFELINE.str);
     
     // ─────────────────── SUBTITLE ───────────────────
-    drawCenteredText("EMERGENCY RECEIVER", 108, TEXT_SMALL, COLOR_CYAN);
+    drawCenteredText(lifeline::ui::EMERGENCY_RECEIVER, 108, TEXT_SMALL, COLOR_CYAN);
     
     // Separator line
     int lineY = 122;
@@ -850,7 +1052,7 @@ void drawBootScreen() {
     
     tft.fillRoundRect(badgeX, badgeY, badgeW, 22, 4, COLOR_BG_CARD);
     tft.drawRoundRect(badgeX, badgeY, badgeW, 22, 4, COLOR_CYAN_DARK);
-    drawCenteredText("BASE STATION", badgeY + 7, TEXT_SMALL, COLOR_CYAN);
+    drawCenteredText(lifeline::ui::BASE_STATION, badgeY + 7, TEXT_SMALL, COLOR_CYAN);
     
     // ─────────────────── INFO CARDS ───────────────────
     int cardY = SCREEN_HEIGHT - 55;
@@ -895,10 +1097,9 @@ void drawBootScreen() {
 }
 
 /**
- * Update boot screen loading animation
- * Returns true when boot is complete
+ * Update boot screen loading animation (shown only while the radio comes up)
  */
-bool updateBootAnimation() {
+void updateBootAnimation() {
     unsigned long elapsed = millis() - bootStartTime;
     
     uint8_t newDotState = (elapsed / 400) % 4;
@@ -921,8 +1122,6 @@ bool updateBootAnimation() {
             tft.print(F("."));
         }
     }
-    
-    return elapsed >= BOOT_DISPLAY_TIME;
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════════
@@ -974,11 +1173,11 @@ void drawIdleScreen() {
     tft.drawLine(contentCenterX, contentCenterY, contentCenterX + 18, contentCenterY - 12, COLOR_CYAN_BRIGHT);
     
     // Status text below icon
-    drawCenteredText("LISTENING", mainCardY + 68, TEXT_SMALL, COLOR_TEXT_PRIMARY);
+    drawCenteredText(lifeline::ui::LISTENING, mainCardY + 68, TEXT_SMALL, COLOR_TEXT_PRIMARY);
     
     // ─────────────────── STATUS MESSAGE ───────────────────
     int msgY = mainCardY + mainCardH + 10;
-    drawCenteredText("Waiting for emergency signals...", msgY, TEXT_SMALL, COLOR_TEXT_MUTED);
+    drawCenteredText(lifeline::ui::WAITING_FOR_EMERGENCY_SIGNALS, msgY, TEXT_SMALL, COLOR_TEXT_MUTED);
     
     // ─────────────────── PULSE INDICATORS ───────────────────
     int pulseY = msgY + 18;
@@ -1025,7 +1224,7 @@ void drawIdleScreen() {
     tft.print(F("READY"));
     
     // ─────────────────── PREMIUM FOOTER ───────────────────
-    drawFooter("Auto-receiving mode");
+    drawFooter("Auto-receiving mode   Press: link quality");
     
     lastPulseTime = millis();
     pulseState = 0;
@@ -1128,7 +1327,7 @@ void drawAlertScreen(int deviceId, int alertIndex, int rssi) {
     tft.setTextSize(TEXT_SMALL);
     tft.setTextColor(COLOR_TEXT_DARK);
     tft.setCursor(MARGIN + 5, badgeY + 4);
-    tft.print(priorityLabels[min((int)priority, 4)]);
+    tft.print(priorityLabels[min((int)priority, 4)].str);
     
     // ─────────────────── MAIN ALERT CARD ───────────────────
     int cardY = badgeY + 24;
@@ -1146,7 +1345,7 @@ void drawAlertScreen(int deviceId, int alertIndex, int rssi) {
     tft.setTextSize(TEXT_MEDIUM);
     tft.setTextColor(alertColor);
     tft.setCursor(MARGIN + 12, cardY + 8);
-    tft.print(alertNamesShort[alertIndex]);
+    tft.print(alertNamesShort[alertIndex].str);
     
     // Alert code badge (right side of card)
     int codeBadgeX = SCREEN_WIDTH - MARGIN - 32;
@@ -1239,7 +1438,19 @@ void drawAlertScreen(int deviceId, int alertIndex, int rssi) {
     tft.print(F("VERIFIED"));
     
     // ─────────────────── FOOTER ───────────────────
-    drawFooter("Auto-dismiss in 30 seconds");
+    // The other open alerts are one press away
+    char hint[48];
+    if (inbox.size() > 1) {
+        snprintf(hint, sizeof(hint), "Hold: acknowledge   Press: inbox (%u open)", inbox.size());
+    } else {
+        snprintf(hint, sizeof(hint), "Hold: acknowledge   Press: inbox");
+    }
+    drawFooter(hint);
+    
+    // Alert is readable from here on; the tone is not part of the budget
+    if (rxTrace.active && rxTrace.displayedUs == 0) {
+        rxTrace.displayedUs = micros();
+    }
     
     // Store alert data
     lastDeviceId = deviceId;
@@ -1247,22 +1458,597 @@ void drawAlertScreen(int deviceId, int alertIndex, int rssi) {
     lastRssi = rssi;
     alertReceivedTime = millis();
     
-    // Add to history
+    lifeline::printfTo(Serial, "[SCREEN] Alert displayed: Device %d, Alert %d (%s)\n", 
+                               deviceId, alertIndex, alertNames[alertIndex].str);
+}
+
+/**
+ * Close the latency trace of the alert just handled and log its budget
+ */
+void finishLatencyTrace() {
+    if (!rxTrace.active) return;
+    
+    rxLatency.recordTrace(rxTrace);
+    
+    if (rxTrace.preRxUs() > 0) {
+        lifeline::printfTo(Serial, "[LAT] ui %ld ms | air %u ms | parse %lu us | screen %lu ms | uplink %lu ms | key>screen %lu ms\n",
+                                   (long)rxTrace.txUiMs, rxTrace.airMs(),
+                                   rxTrace.parsedUs - rxTrace.rxDoneUs,
+                                   (rxTrace.displayedUs - rxTrace.parsedUs) / 1000,
+                                   rxTrace.uplinkAckUs ? (rxTrace.uplinkAckUs - rxTrace.uplinkSentUs) / 1000 : 0,
+                                   (rxTrace.preRxUs() + rxTrace.displayedUs - rxTrace.rxDoneUs) / 1000);
+    }
+    rxTrace.active = false;
+}
+
+/**
+ * Check if alert display time has elapsed (back to the inbox, or idle)
+ */
+bool shouldReturnToIdle() {
+    if (currentScreen != SCREEN_ALERT) return false;
+    return (millis() - alertReceivedTime >= ALERT_DISPLAY_TIME);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════════
+//                              4. ALERT INBOX
+//         Purpose: No open alert is hidden by a newer one
+//         Design: Most urgent first, rows redrawn only when they change
+// ═══════════════════════════════════════════════════════════════════════════════════
+
+/**
+ * Red while a critical or high alert is open, green otherwise
+ */
+void updateAlertLeds() {
+    bool urgent = inbox.countAtMost(1) > 0;
+    digitalWrite(LED_RED, urgent ? HIGH : LOW);
+    digitalWrite(LED_GREEN, urgent ? LOW : HIGH);
+}
+
+/**
+ * Age of an open alert for a list row: "now", "12m", "3h"
+ */
+void formatAlertAge(char* buf, size_t len, uint32_t ageMs) {
+    uint32_t minutes = ageMs / 60000;
+    if (minutes == 0) {
+        snprintf(buf, len, "now");
+    } else if (minutes < 60) {
+        snprintf(buf, len, "%lum", (unsigned long)minutes);
+    } else {
+        snprintf(buf, len, "%luh", (unsigned long)(minutes / 60));
+    }
+}
+
+/**
+ * One list row: priority bar, code, name, sender, signal, age and repeats.
+ * nullptr clears the row.
+ */
+void drawInboxRow(uint8_t slot, const lifeline::InboxAlert* a, bool selected) {
+    int y = CONTENT_START_Y + slot * INBOX_ROW_H;
+    int w = SCREEN_WIDTH - MARGIN * 2;
+    int h = INBOX_ROW_H - 2;
+    if (!a) {
+        tft.fillRect(MARGIN, y, w, h, COLOR_BG_PRIMARY);
+        return;
+    }
+    
+    uint16_t color = getPriorityColor(a->priority);
+    tft.fillRect(MARGIN, y, w, h, selected ? COLOR_BG_CARD_ACTIVE : COLOR_BG_CARD);
+    if (selected) {
+        tft.drawRect(MARGIN, y, w, h, COLOR_BORDER_FOCUS);
+    }
+    tft.fillRect(MARGIN, y, 4, h, color);
+    
+    // Code badge and name
+    tft.fillRoundRect(MARGIN + 10, y + 4, 16, 16, 3, color);
+    tft.setTextSize(TEXT_SMALL);
+    tft.setTextColor(COLOR_TEXT_DARK);
+    tft.setCursor(MARGIN + 15, y + 8);
+    tft.print(getAlertCode(a->alertIndex));
+    tft.setTextSize(TEXT_MEDIUM);
+    tft.setTextColor(color);
+    tft.setCursor(MARGIN + 34, y + 5);
+    tft.print(alertNamesShort[a->alertIndex].str);
+    
+    // Sender and signal; age and repeats below
+    char buf[12];
+    int infoX = SCREEN_WIDTH - MARGIN - 100;
+    tft.setTextSize(TEXT_SMALL);
+    tft.setTextColor(COLOR_CYAN);
+    tft.setCursor(infoX, y + 3);
+    snprintf(buf, sizeof(buf), "TX#%03u", a->deviceId);
+    tft.print(buf);
+    tft.setTextColor(COLOR_TEXT_SECONDARY);
+    tft.setCursor(infoX + 50, y + 3);
+    tft.print(a->rssi);
+    
+    formatAlertAge(buf, sizeof(buf), millis() - a->receivedMs);
+    tft.setTextColor(COLOR_TEXT_MUTED);
+    tft.setCursor(infoX, y + 14);
+    tft.print(buf);
+    if (a->repeats) {
+        tft.setTextColor(COLOR_AMBER);
+        tft.setCursor(infoX + 50, y + 14);
+        tft.print('x');
+        tft.print(a->repeats + 1);
+    }
+}
+
+/**
+ * Open count in the header, in the colour of the most urgent alert
+ */
+void drawInboxBadge() {
+    int badgeX = SCREEN_WIDTH - 70;
+    const lifeline::InboxAlert* top = inbox.top();
+    tft.fillRoundRect(badgeX, 12, 60, 16, 3, top ? getPriorityColor(top->priority) : COLOR_GREEN);
+    tft.setTextSize(TEXT_SMALL);
+    tft.setTextColor(COLOR_TEXT_DARK);
+    tft.setCursor(badgeX + 6, 16);
+    tft.print(inbox.size());
+    tft.print(F(" OPEN"));
+}
+
+/**
+ * Last list row once the inbox has been full: how many alerts it could not
+ * keep and the devices the last of them came from, so nobody takes the
+ * list for everything that came in
+ */
+void drawInboxDroppedRow() {
+    int y = CONTENT_START_Y + (INBOX_ROWS - 1) * INBOX_ROW_H;
+    int w = SCREEN_WIDTH - MARGIN * 2;
+    int h = INBOX_ROW_H - 2;
+    tft.fillRect(MARGIN, y, w, h, COLOR_BG_CARD);
+    tft.fillRect(MARGIN, y, 4, h, COLOR_RED);
+    
+    char buf[16];
+    snprintf(buf, sizeof(buf), "+%lu dropped", (unsigned long)inbox.dropped());
+    tft.setTextSize(TEXT_MEDIUM);
+    tft.setTextColor(COLOR_RED);
+    tft.setCursor(MARGIN + 10, y + 5);
+    tft.print(buf);
+    
+    // Newest first, as many as fit right of the count
+    lifeline::InboxLost gone[ALERT_INBOX_LOST];
+    uint8_t n = inbox.lost(gone, ALERT_INBOX_LOST);
+    int room = (SCREEN_WIDTH - MARGIN - 4 - (MARGIN + 10 + (int)strlen(buf) * 12 + 6)) / 6;
+    char devices[64] = "";
+    int len = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        char one[8];
+        int w = snprintf(one, sizeof(one), "%sTX%03u", len ? " " : "", gone[i].deviceId);
+        if (len + w > room || len + w >= (int)sizeof(devices)) break;
+        strcpy(devices + len, one);
+        len += w;
+    }
+    tft.setTextSize(TEXT_SMALL);
+    tft.setTextColor(COLOR_TEXT_MUTED);
+    tft.setCursor(SCREEN_WIDTH - MARGIN - 4 - len * 6, y + 9);
+    tft.print(devices);
+}
+
+/**
+ * Bring the list up to date. Only the rows, badge and footer that changed
+ * are drawn, so a new alert or a minute of age costs one row.
+ */
+void refreshInbox() {
+    if (inbox.empty()) return;
+    if (inboxCursor >= inbox.size()) inboxCursor = inbox.size() - 1;
+    
+    // Once alerts were dropped, the last row of every page counts them
+    const uint8_t pageRows = inbox.dropped() ? INBOX_ROWS - 1 : INBOX_ROWS;
+    uint8_t first = inboxCursor / pageRows * pageRows;
+    lifeline::InboxAlert rows[INBOX_ROWS];
+    uint8_t n = inbox.page(rows, first, pageRows);
+    unsigned long now = millis();
+    
+    if (inbox.dropped() != inboxDroppedShown) {
+        drawInboxDroppedRow();
+        inboxDroppedShown = inbox.dropped();
+    }
+    
+    for (uint8_t i = 0; i < pageRows; i++) {
+        InboxRowShown want = {0, 0, 0, false};
+        if (i < n) {
+            want.id = rows[i].id;
+            want.ageMin = (now - rows[i].receivedMs) / 60000;
+            want.repeats = rows[i].repeats;
+            want.selected = (first + i == inboxCursor);
+        }
+        InboxRowShown& shown = inboxRows[i];
+        if (want.id == shown.id && want.ageMin == shown.ageMin &&
+            want.repeats == shown.repeats && want.selected == shown.selected) {
+            continue;
+        }
+        drawInboxRow(i, i < n ? &rows[i] : nullptr, want.selected);
+        shown = want;
+    }
+    
+    if (inbox.version() != inboxShownVersion) {
+        drawInboxBadge();
+        inboxShownVersion = inbox.version();
+    }
+    
+    char footer[sizeof(inboxFooter)];
+    snprintf(footer, sizeof(footer), "Press: next  Hold: open   %u-%u of %u",
+             first + 1, first + n, inbox.size());
+    if (strcmp(footer, inboxFooter)) {
+        drawFooter(footer);
+        strcpy(inboxFooter, footer);
+    }
+    inboxRefreshTime = now;
+}
+
+void drawInboxScreen() {
+    tft.fillScreen(COLOR_BG_PRIMARY);
+    drawHeader("INBOX");
+    
+    // Nothing on the panel matches: every row, the badge and the footer
+    for (uint8_t i = 0; i < INBOX_ROWS; i++) {
+        inboxRows[i].id = UINT32_MAX;
+    }
+    inboxShownVersion = inbox.version() + 1;
+    inboxFooter[0] = '\0';
+    inboxDroppedShown = 0;
+    refreshInbox();
+    
+    if (inbox.dropped()) {
+        lifeline::printfTo(Serial, "[SCREEN] Inbox: %u open, +%lu dropped\n",
+                                   inbox.size(), (unsigned long)inbox.dropped());
+    } else {
+        lifeline::printfTo(Serial, "[SCREEN] Inbox: %u open\n", inbox.size());
+    }
+}
+
+/**
+ * The list, or the idle screen once nothing is open
+ */
+void showInbox() {
+    shownAlertId = 0;
+    if (inbox.empty()) {
+        currentScreen = SCREEN_IDLE;
+        drawIdleScreen();
+        updateAlertLeds();
+        return;
+    }
+    currentScreen = SCREEN_INBOX;
+    drawInboxScreen();
+}
+
+/**
+ * One open alert on the alert screen
+ */
+void showInboxAlert(uint32_t id) {
+    const lifeline::InboxAlert* a = inbox.find(id);
+    if (!a) {
+        showInbox();
+        return;
+    }
+    currentScreen = SCREEN_ALERT;
+    shownAlertId = id;
+    drawAlertScreen(a->deviceId, a->alertIndex, a->rssi);
+}
+
+/**
+ * The alert at the list cursor (0 if none)
+ */
+uint32_t inboxCursorId() {
+    lifeline::InboxAlert row;
+    return inbox.page(&row, inboxCursor, 1) ? row.id : 0;
+}
+
+void acknowledgeAlert(uint32_t id) {
+    const lifeline::InboxAlert* a = inbox.find(id);
+    if (!a) return;
+    lifeline::printfTo(Serial, "[INBOX] #%lu acknowledged: TX #%03u %s (%u still open)\n",
+                               (unsigned long)id, a->deviceId, alertNames[a->alertIndex].str,
+                               inbox.size() - 1);
+    inbox.acknowledge(id);
+    updateAlertLeds();
+    showInbox();
+}
+
+/**
+ * Operator keys: the BOOT button or the serial commands
+ */
+void inboxNext() {
+    if (currentScreen != SCREEN_INBOX || inbox.empty()) return;
+    inboxCursor = (inboxCursor + 1) % inbox.size();
+    refreshInbox();
+}
+
+void inboxOpen() {
+    if (currentScreen != SCREEN_INBOX) return;
+    uint32_t id = inboxCursorId();
+    if (id) showInboxAlert(id);
+}
+
+void inboxAcknowledge() {
+    if (currentScreen == SCREEN_ALERT) {
+        acknowledgeAlert(shownAlertId);
+    } else if (currentScreen == SCREEN_INBOX) {
+        acknowledgeAlert(inboxCursorId());
+    }
+}
+
+void inboxBack() {
+    if (currentScreen == SCREEN_ALERT) showInbox();
+}
+
+/**
+ * BOOT button released: a press steps or goes back, a hold opens or
+ * acknowledges. On the idle screen a press shows the link screen.
+ */
+void onButtonPress(bool hold) {
+    if (currentScreen == SCREEN_IDLE) {
+        showLinks();
+    } else if (currentScreen == SCREEN_LINKS) {
+        if (hold) linksBack(); else linksNextPage();
+    } else if (currentScreen == SCREEN_INBOX) {
+        if (hold) inboxOpen(); else inboxNext();
+    } else if (currentScreen == SCREEN_ALERT) {
+        if (hold) inboxAcknowledge(); else inboxBack();
+    }
+}
+
+/**
+ * Redraw whatever screen is up (after the WiFi setup bar)
+ */
+void redrawScreen() {
+    if (currentScreen == SCREEN_IDLE) {
+        drawIdleScreen();
+    } else if (currentScreen == SCREEN_ALERT) {
+        showInboxAlert(shownAlertId);
+    } else if (currentScreen == SCREEN_INBOX) {
+        drawInboxScreen();
+    } else if (currentScreen == SCREEN_LINKS) {
+        drawLinksScreen();
+    }
+}
+
+/**
+ * Serial "inbox": the counters, then every open alert in rank order
+ */
+void printInbox() {
+    inbox.printReport(Serial);
+    lifeline::InboxAlert rows[INBOX_ROWS];
+    unsigned long now = millis();
+    for (uint8_t first = 0; first < inbox.size(); first += INBOX_ROWS) {
+        uint8_t n = inbox.page(rows, first, INBOX_ROWS);
+        for (uint8_t i = 0; i < n; i++) {
+            char age[12];
+            formatAlertAge(age, sizeof(age), now - rows[i].receivedMs);
+            lifeline::printfTo(Serial, "[INBOX] %u. #%lu TX #%03u %s, %d dBm, %s, x%u\n",
+                                       first + i + 1, (unsigned long)rows[i].id, rows[i].deviceId,
+                                       alertNames[rows[i].alertIndex].str, rows[i].rssi, age,
+                                       rows[i].repeats + 1);
+        }
+    }
+}
+
+/**
+ * A new alert: uplink first, then the inbox and the screen. The alert
+ * screen shows it only if nothing open is more urgent; otherwise the list
+ * comes up with the most urgent alert on top.
+ */
+void handleAlert(int deviceId, int alertIndex, int rssi) {
+    uint8_t priority = alertPriority[alertIndex];
+    
+    // Over its limit: counted for the next uplink, nothing else
+    const lifeline::RateVerdict verdict = rateLimiter.admit(deviceId, priority == 0, millis());
+    if (verdict == lifeline::RATE_SUPPRESS) {
+        if (rateLimiter.find(deviceId)->pending == 1) {
+            lifeline::printfTo(Serial, "[RATE] TX #%03d over %u alerts/min: suppressing, counted for its next uplink\n",
+                                       deviceId, rateLimiter.limits().perMinute);
+        }
+        rxTrace.active = false;
+        return;
+    }
+    if (verdict == lifeline::RATE_PASS_CRITICAL) {
+        lifeline::printfTo(Serial, "[RATE] TX #%03d %s let through on the critical reserve\n",
+                                   deviceId, alertNames[alertIndex].str);
+    }
+    
+    // Push alert to web dashboard API
+    pushAlertToAPI(deviceId, alertIndex, rssi);
     addToHistory(deviceId, alertIndex, rssi);
     
-    // Play alert sound
+    uint32_t droppedBefore = inbox.dropped();
+    uint32_t id = inbox.push(deviceId, alertIndex, priority, rssi, millis());
+    if (!id) {
+        lifeline::printfTo(Serial, "[INBOX] Full of more urgent alerts: TX #%03d %s not kept\n",
+                                   deviceId, alertNames[alertIndex].str);
+    } else if (inbox.dropped() != droppedBefore) {
+        lifeline::InboxLost gone;
+        inbox.lost(&gone, 1);
+        lifeline::printfTo(Serial, "[INBOX] Full: TX #%03u %s dropped for TX #%03d %s\n",
+                                   gone.deviceId, alertNames[gone.alertIndex].str,
+                                   deviceId, alertNames[alertIndex].str);
+    }
+    
+    const lifeline::InboxAlert* top = inbox.top();
+    if (id && top->id == id) {
+        showInboxAlert(id);
+    } else if (currentScreen == SCREEN_INBOX) {
+        refreshInbox();
+    } else {
+        showInbox();
+    }
+    
+    // The list row counts as readable too; the tone is not part of the budget
+    if (rxTrace.active && rxTrace.displayedUs == 0) {
+        rxTrace.displayedUs = micros();
+    }
+    finishLatencyTrace();
+    updateAlertLeds();
     playAlertTone(priority);
+}
+
+/**
+ * Radio first, then the serial simulator
+ */
+void pollAlerts() {
+    int deviceId, alertIndex, rssi;
+    bool packetReceived = parseLoRaPacket(deviceId, alertIndex, rssi);
+    
+    #if SERIAL_DEBUG_ENABLED
+    if (!packetReceived) {
+        packetReceived = checkSerialSimulatedPacket(deviceId, alertIndex, rssi);
+        if (packetReceived) {
+            rxTrace.begin(micros(), false);
+            rxTrace.parsedUs = rxTrace.rxDoneUs;
+        }
+    }
+    #endif
     
-    Serial.printf("[SCREEN] Alert displayed: Device %d, Alert %d (%s)\n", 
-                  deviceId, alertIndex, alertNames[alertIndex]);
+    if (!packetReceived) return;
+    markFirstAlert();
+    lifeline::printfTo(Serial, "[RX] Alert received: Device=%d, Alert=%d (%s), RSSI=%d\n",
+                               deviceId, alertIndex, alertNames[alertIndex].str, rssi);
+    handleAlert(deviceId, alertIndex, rssi);
 }
 
+// ═══════════════════════════════════════════════════════════════════════════════════
+//                              5. LINK QUALITY
+//         Purpose: See which handhelds need a relay before an emergency does
+//         Design: Weakest link first, rows redrawn only when they change
+// ═══════════════════════════════════════════════════════════════════════════════════
+
 /**
- * Check if alert display time has elapsed
+ * One device: status bar, ID, averages, loss and when it was last heard.
+ * nullptr clears the row.
  */
-bool shouldReturnToIdle() {
-    if (currentScreen != SCREEN_ALERT) return false;
-    return (millis() - alertReceivedTime >= ALERT_DISPLAY_TIME);
+void drawLinkRow(uint8_t slot, const lifeline::LinkEntry* e) {
+    int y = CONTENT_START_Y + slot * INBOX_ROW_H;
+    int w = SCREEN_WIDTH - MARGIN * 2;
+    int h = INBOX_ROW_H - 2;
+    if (!e) {
+        tft.fillRect(MARGIN, y, w, h, COLOR_BG_PRIMARY);
+        return;
+    }
+    
+    uint16_t color = e->weak() ? COLOR_RED : (e->lost ? COLOR_AMBER : COLOR_GREEN);
+    tft.fillRect(MARGIN, y, w, h, COLOR_BG_CARD);
+    tft.fillRect(MARGIN, y, 4, h, color);
+    
+    char buf[28];
+    tft.setTextSize(TEXT_MEDIUM);
+    tft.setTextColor(COLOR_CYAN);
+    tft.setCursor(MARGIN + 10, y + 5);
+    snprintf(buf, sizeof(buf), "TX#%03u", e->deviceId);
+    tft.print(buf);
+    
+    // Averages on top; loss, frames and last heard below
+    int infoX = MARGIN + 90;
+    tft.setTextSize(TEXT_SMALL);
+    tft.setTextColor(color);
+    tft.setCursor(infoX, y + 3);
+    snprintf(buf, sizeof(buf), "%.0f dBm  SNR %.1f", e->rssi(), e->snr());
+    tft.print(buf);
+    tft.setTextColor(COLOR_TEXT_SECONDARY);
+    tft.setCursor(infoX, y + 14);
+    snprintf(buf, sizeof(buf), "loss %u%%  %lu rx", e->lossPct(), (unsigned long)e->packets);
+    tft.print(buf);
+    
+    formatAlertAge(buf, sizeof(buf), millis() - e->lastSeenMs);
+    tft.setTextColor(COLOR_TEXT_MUTED);
+    tft.setCursor(SCREEN_WIDTH - MARGIN - 100, y + 3);
+    tft.print(buf);
+    if (e->lastAlert != lifeline::LINK_NO_ALERT) {
+        tft.setTextColor(getAlertColor(e->lastAlert));
+        tft.setCursor(SCREEN_WIDTH - MARGIN - 100, y + 14);
+        tft.print(alertNamesShort[e->lastAlert].str);
+    }
+}
+
+/**
+ * Bring the page up to date; a row is drawn again only when its device
+ * sent something or its last-heard age moved on.
+ */
+void refreshLinks() {
+    if (linksFirst >= links.size()) linksFirst = 0;
+    lifeline::LinkEntry rows[INBOX_ROWS];
+    uint8_t n = links.page(rows, linksFirst, INBOX_ROWS);
+    unsigned long now = millis();
+    
+    for (uint8_t i = 0; i < INBOX_ROWS; i++) {
+        LinkRowShown want = {0xFFFF, 0, 0};
+        if (i < n) {
+            want.deviceId = rows[i].deviceId;
+            want.packets = rows[i].packets;
+            want.ageMin = (now - rows[i].lastSeenMs) / 60000;
+        }
+        LinkRowShown& shown = linkRows[i];
+        if (want.deviceId == shown.deviceId && want.packets == shown.packets &&
+            want.ageMin == shown.ageMin) {
+            continue;
+        }
+        drawLinkRow(i, i < n ? &rows[i] : nullptr);
+        shown = want;
+    }
+    
+    char footer[sizeof(linksFooter)];
+    if (n == 0) {
+        snprintf(footer, sizeof(footer), "Hold: back   No device heard yet");
+    } else {
+        snprintf(footer, sizeof(footer), "Press: next page  Hold: back   %u-%u of %u, %u weak",
+                 linksFirst + 1, linksFirst + n, links.size(), links.weakCount());
+    }
+    if (strcmp(footer, linksFooter)) {
+        drawFooter(footer);
+        strcpy(linksFooter, footer);
+    }
+    linksRefreshTime = now;
+}
+
+void drawLinksScreen() {
+    tft.fillScreen(COLOR_BG_PRIMARY);
+    drawHeader("LINKS");
+    
+    // Nothing on the panel matches: every row and the footer
+    for (uint8_t i = 0; i < INBOX_ROWS; i++) {
+        linkRows[i].packets = UINT32_MAX;
+    }
+    linksFooter[0] = '\0';
+    refreshLinks();
+    
+    lifeline::printfTo(Serial, "[SCREEN] Links: %u devices, %u weak\n", links.size(), links.weakCount());
+}
+
+void showLinks() {
+    currentScreen = SCREEN_LINKS;
+    linksFirst = 0;
+    drawLinksScreen();
+}
+
+void linksNextPage() {
+    linksFirst += INBOX_ROWS;
+    if (linksFirst >= links.size()) linksFirst = 0;
+    drawLinksScreen();
+}
+
+void linksBack() {
+    showInbox();
+}
+
+/**
+ * Serial "links": the counters, then every device, weakest first
+ */
+void printLinks() {
+    links.printReport(Serial);
+    lifeline::LinkEntry rows[INBOX_ROWS];
+    unsigned long now = millis();
+    for (uint8_t first = 0; first < links.size(); first += INBOX_ROWS) {
+        uint8_t n = links.page(rows, first, INBOX_ROWS);
+        for (uint8_t i = 0; i < n; i++) {
+            const lifeline::LinkEntry& e = rows[i];
+            char age[12];
+            formatAlertAge(age, sizeof(age), now - e.lastSeenMs);
+            lifeline::printfTo(Serial, "[LINK] TX #%03u%s %.1f dBm, SNR %.1f dB, %lu frames, %lu alerts, %lu lost (%u%%), heard %s, last %s\n",
+                                       e.deviceId, e.weak() ? " WEAK" : "", e.rssi(), e.snr(),
+                                       (unsigned long)e.packets, (unsigned long)e.alerts,
+                                       (unsigned long)e.lost, e.lossPct(), age,
+                                       e.lastAlert == lifeline::LINK_NO_ALERT ? "-" : alertNames[e.lastAlert].str);
+        }
+    }
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════════
@@ -1270,57 +2056,108 @@ bool shouldReturnToIdle() {
 // ═══════════════════════════════════════════════════════════════════════════════════
 
 /**
- * Parse incoming LoRa packet
- * Expected format: DEVICE_ID,ALERT_CODE or TX[ID],[CODE]
+ * Log an energy heartbeat from a field unit
+ * Format: HB[ID];i=[AVG_mA x10];l=[HOURS];u=[UPTIME_MIN]
  */
-bool parseLoRaPacket(int& deviceId, int& alertIndex, int& rssi) {
+void logHeartbeat(const lifeline::AlertFrame& frame, int rssi) {
+    lifeline::printfTo(Serial, "[HB] TX #%03u: avg %.1f mA, projected %ld h, up %ld min, RSSI %d\n",
+                               frame.deviceId, frame.field('i') / 10.0f, frame.field('l'),
+                               frame.field('u'), rssi);
+}
+
+/**
+ * DIO0 is high from RxDone until the FIFO is read (a GPIO read, no SPI).
+ */
+bool loraRxDone(void*) {
+    return loraInitialized && digitalRead(LORA_DIO0) == HIGH;
+}
+
+/**
+ * Read the FIFO while the arbiter holds the bus, before the next packet
+ * can overwrite it, and go straight back to receive. Parsing waits.
+ */
+void readLoRaFifo(void*) {
     int packetSize = LoRa.parsePacket();
-    if (packetSize == 0) return false;
-    
-    String data = "";
+    if (packetSize == 0) return;
+    RxFrame rx;
+    rx.len = 0;
     while (LoRa.available()) {
-        data += (char)LoRa.read();
+        int c = LoRa.read();
+        if (rx.len < FRAME_MAX_LEN) rx.data[rx.len++] = (char)c;
     }
+    rx.data[rx.len] = '\0';
+    rx.rssi = LoRa.packetRssi();
+    rx.snr = LoRa.packetSnr();
+    LoRa.receive();
+    rx.readUs = micros();
+    rx.busWaitUs = spiBus.lastWaitUs();
+    rxFrames.push(rx);
+}
+
+/**
+ * Parse incoming LoRa packet
+ * Expected format: DEVICE_ID,ALERT_CODE or TX[ID],[CODE] (see AlertFrame.h)
+ * Unknown codes become OTHER; heartbeats (HB...) are logged and return false
+ */
+bool parseLoRaPacket(int& deviceId, int& alertIndex, int& rssi) {
+    spiBus.poll();
+    RxFrame rx;
+    if (!rxFrames.pop(rx)) return false;
     
-    rssi = LoRa.packetRssi();
+    // RxDone was at most busWaitUs before the read
+    rxTrace.begin(rx.readUs - rx.busWaitUs, true);
+    // Airtime from the radio settings (LoRa library defaults: CR 4/5, 8 symbol preamble)
+    rxTrace.airUs = lifeline::loraTimeOnAirUs(rx.len, LORA_SF, LORA_BW);
     
-    Serial.printf("[RX] Raw packet (%d bytes): '%s', RSSI: %d\n", packetSize, data.c_str(), rssi);
+    const char* data = rx.data;
+    size_t len = rx.len;
+    int packetSize = rx.len;
+    rssi = rx.rssi;
     
-    // Handle TX prefix if present
-    if (data.startsWith("TX")) {
-        data = data.substring(2);
+    lifeline::printfTo(Serial, "[RX] Raw packet (%d bytes): '%s', RSSI: %d\n", packetSize, data, rssi);
+    
+    lifeline::AlertFrame frame;
+    lifeline::FrameType type = lifeline::parseFrame(data, len, frame, lifeline::FRAME_RX_FLAGS, ALERT_COUNT);
+    
+    // Every frame a device gets through counts for its link, repeats too
+    if (type != lifeline::FRAME_INVALID) {
+        links.record(frame.deviceId, rssi, rx.snr, frame.seq,
+                     type == lifeline::FRAME_ALERT ? frame.alertIndex : -1, millis());
     }
     
-    int comma = data.indexOf(',');
-    if (comma <= 0) {
-        Serial.println(F("[RX] Invalid packet format"));
+    // Energy heartbeat from a field unit - not an alert
+    if (type == lifeline::FRAME_HEARTBEAT) {
+        logHeartbeat(frame, rssi);
+        rxTrace.active = false;
         return false;
     }
     
-    deviceId = data.substring(0, comma).toInt();
+    if (type != lifeline::FRAME_ALERT) {
+        lifeline::printfTo(Serial, "[RX] Invalid packet format (%s)\n",
+                                   lifeline::frameErrorNames[frame.error]);
+        rxTrace.active = false;
+        return false;
+    }
     
-    String alertPart = data.substring(comma + 1);
-    alertPart.trim();
+    if (frame.txUiMs >= 0) rxTrace.txUiMs = frame.txUiMs;
+    deviceId = frame.deviceId;
+    alertIndex = frame.alertIndex;
     
-    // Handle character-based alert code (A-O = 0-14)
-    if (alertPart.length() == 1 && alertPart[0] >= 'A' && alertPart[0] <= 'O') {
-        alertIndex = alertPart[0] - 'A';
-    } else if (alertPart.length() == 1 && alertPart[0] >= 'a' && alertPart[0] <= 'o') {
-        alertIndex = alertPart[0] - 'a';
-    } else {
-        alertIndex = alertPart.toInt();
+    if (frame.codeDefaulted) {
+        Serial.println(F("[RX] Unknown alert code, defaulting to OTHER"));
     }
     
-    // Validate
-    if (alertIndex < 0 || alertIndex >= ALERT_COUNT) {
-        Serial.printf("[RX] Invalid alert index %d, defaulting to OTHER\n", alertIndex);
-        alertIndex = ALERT_COUNT - 1;
+    // Already shown and uplinked: the TX retried or resumed after a reset
+    if (frame.seq >= 0 && rxDedupe.seen(deviceId, (uint16_t)frame.seq)) {
+        lifeline::printfTo(Serial, "[RX] Duplicate TX%03d s=%ld dropped (%lu total)\n",
+                                   deviceId, frame.seq, (unsigned long)rxDedupe.dropped());
+        rxTrace.active = false;
+        return false;
     }
     
-    Serial.printf("[RX] Parsed: Device=%d, Alert=%d (%s)\n", deviceId, alertIndex, alertNames[alertIndex]);
+    rxTrace.parsedUs = micros();
     
-    // Re-enter receive mode for next packet
-    LoRa.receive();
+    lifeline::printfTo(Serial, "[RX] Parsed: Device=%d, Alert=%d (%s)\n", deviceId, alertIndex, alertNames[alertIndex].str);
     
     return true;
 }
@@ -1334,17 +2171,33 @@ bool parseLoRaPacket(int& deviceId, int& alertIndex, int& rssi) {
  */
 void loadWiFiCredentials() {
     preferences.begin("lifeline", true);  // Read-only
-    storedSSID = preferences.getString("ssid", "");
-    storedPassword = preferences.getString("password", "");
+    if (!preferences.getString("ssid", storedSSID, sizeof(storedSSID))) storedSSID[0] = '\0';
+    if (!preferences.getString("password", storedPassword, sizeof(storedPassword))) storedPassword[0] = '\0';
     preferences.end();
     
-    if (storedSSID.length() > 0) {
-        Serial.printf("[WIFI] Loaded credentials for SSID: %s\n", storedSSID.c_str());
+    if (storedSSID[0]) {
+        lifeline::printfTo(Serial, "[WIFI] Loaded credentials for SSID: %s\n", storedSSID);
     } else {
         Serial.println(F("[WIFI] No stored credentials found"));
     }
 }
 
+/**
+ * Load the per-device rate limits (defaults until the portal saves them)
+ */
+void loadRateLimits() {
+    lifeline::RateLimits limits;
+    preferences.begin("lifeline", true);  // Read-only
+    limits.perMinute = preferences.getUChar("rate_pm", RATE_PER_MINUTE);
+    limits.burst = preferences.getUChar("rate_burst", RATE_BURST);
+    limits.criticalBurst = preferences.getUChar("rate_crit", RATE_CRITICAL_BURST);
+    preferences.end();
+    
+    rateLimiter.setLimits(limits);
+    lifeline::printfTo(Serial, "[RATE] %u alerts/min per device, burst %u, critical +%u\n",
+                               limits.perMinute, limits.burst, limits.criticalBurst);
+}
+
 /**
  * Save WiFi credentials to persistent storage
  */
@@ -1354,15 +2207,15 @@ void saveWiFiCredentials(const String& ssid, const String& password) {
     preferences.putString("password", password);
     preferences.end();
     
-    storedSSID = ssid;
-    storedPassword = password;
-    Serial.printf("[WIFI] Saved credentials for SSID: %s\n", ssid.c_str());
+    snprintf(storedSSID, sizeof(storedSSID), "%s", ssid.c_str());
+    snprintf(storedPassword, sizeof(storedPassword), "%s", password.c_str());
+    lifeline::printfTo(Serial, "[WIFI] Saved credentials for SSID: %s\n", ssid.c_str());
 }
 
 /**
  * Draw WiFi connecting screen on TFT
  */
-void drawWiFiConnectingScreen(const String& ssid) {
+void drawWiFiConnectingScreen(const char* ssid) {
     tft.fillScreen(COLOR_BG_PRIMARY);
     
     // Header
@@ -1394,7 +2247,7 @@ void drawWiFiConnectingScreen(const String& ssid) {
 /**
  * Draw WiFi connected screen with IP
  */
-void drawWiFiConnectedScreen(const String& ip) {
+void drawWiFiConnectedScreen(const char* ip) {
     tft.fillScreen(COLOR_BG_PRIMARY);
     
     // Header
@@ -1468,35 +2321,40 @@ void drawWiFiFailedScreen() {
 }
 
 /**
- * Connect to WiFi silently at boot (no display, no auto-portal on failure)
- * Used for automatic connection on startup
+ * Start connecting with the stored credentials at boot without waiting.
+ * serviceWiFiConnection() picks up the result from loop().
  */
-bool connectToWiFiSilent() {
-    if (storedSSID.length() == 0) {
-        Serial.println(F("[WIFI] No credentials stored"));
-        return false;
+void beginWiFiBackground() {
+    if (!storedSSID[0]) {
+        Serial.println(F("[WIFI] No credentials - Hold EN button for 3 seconds to configure"));
+        return;
     }
     
-    Serial.printf("[WIFI] Silent connecting to %s...\n", storedSSID.c_str());
+    lifeline::printfTo(Serial, "[WIFI] Connecting to %s in background...\n", storedSSID);
     
     WiFi.mode(WIFI_STA);
-    WiFi.begin(storedSSID.c_str(), storedPassword.c_str());
-    
-    unsigned long startTime = millis();
-    while (WiFi.status() != WL_CONNECTED && (millis() - startTime) < WIFI_CONNECT_TIMEOUT) {
-        delay(500);
-        Serial.print(".");
-    }
-    Serial.println();
+    WiFi.begin(storedSSID, storedPassword);
+    wifiConnecting = true;
+    wifiConnectStart = millis();
+}
+
+/**
+ * Follow the background connection (no display, no auto-portal on failure)
+ */
+void serviceWiFiConnection() {
+    if (!wifiConnecting) return;
     
     if (WiFi.status() == WL_CONNECTED) {
+        wifiConnecting = false;
         wifiConnected = true;
-        Serial.printf("[WIFI] Connected! IP: %s\n", WiFi.localIP().toString().c_str());
-        return true;
-    } else {
+        bootSeq.mark("wifi");
+        IPAddress ip = WiFi.localIP();
+        lifeline::printfTo(Serial, "[WIFI] Connected! IP: %u.%u.%u.%u (%lu ms after boot)\n",
+                                   ip[0], ip[1], ip[2], ip[3], millis());
+    } else if (millis() - wifiConnectStart >= WIFI_CONNECT_TIMEOUT) {
+        wifiConnecting = false;
         wifiConnected = false;
         Serial.println(F("[WIFI] Connection failed - Hold EN 3s to reconfigure"));
-        return false;
     }
 }
 
@@ -1504,18 +2362,18 @@ bool connectToWiFiSilent() {
  * Connect to WiFi using stored credentials with display feedback
  */
 bool connectToWiFi() {
-    if (storedSSID.length() == 0) {
+    if (!storedSSID[0]) {
         Serial.println(F("[WIFI] No credentials stored"));
         return false;
     }
     
-    Serial.printf("[WIFI] Connecting to %s...\n", storedSSID.c_str());
+    lifeline::printfTo(Serial, "[WIFI] Connecting to %s...\n", storedSSID);
     
     // Show connecting screen
     drawWiFiConnectingScreen(storedSSID);
     
     WiFi.mode(WIFI_STA);
-    WiFi.begin(storedSSID.c_str(), storedPassword.c_str());
+    WiFi.begin(storedSSID, storedPassword);
     
     unsigned long startTime = millis();
     int dotCount = 0;
@@ -1537,8 +2395,10 @@ bool connectToWiFi() {
     
     if (WiFi.status() == WL_CONNECTED) {
         wifiConnected = true;
-        String ip = WiFi.localIP().toString();
-        Serial.printf("[WIFI] Connected! IP: %s\n", ip.c_str());
+        IPAddress addr = WiFi.localIP();
+        char ip[16];
+        snprintf(ip, sizeof(ip), "%u.%u.%u.%u", addr[0], addr[1], addr[2], addr[3]);
+        lifeline::printfTo(Serial, "[WIFI] Connected! IP: %s\n", ip);
         
         // Show connected screen
         drawWiFiConnectedScreen(ip);
@@ -1562,35 +2422,279 @@ bool connectToWiFi() {
 }
 
 /**
- * Push alert data to web dashboard API
+ * Push alert data to web dashboard API. A DID the registry does not know
+ * goes out with "auto_register" so its first alert is not turned away.
  */
 void pushAlertToAPI(int deviceId, int alertIndex, int rssi) {
+    lifeline::PendingUplink p = {};
+    p.firstMs = millis();
+    p.deviceId = deviceId;
+    p.rssi = rssi;
+    p.alertIndex = alertIndex;
+    p.priority = alertPriority[alertIndex];
+    p.autoRegister = API_AUTO_REGISTER && registry.lookup(deviceId) == lifeline::DEVICE_UNKNOWN;
+    
+    // Alerts the rate limit kept out since this device's last uplink
+    uint32_t suppressedSince;
+    const uint32_t suppressed = rateLimiter.takeSuppressed(deviceId, suppressedSince);
+    if (suppressed) {
+        p.suppressed = suppressed < 0xFFFF ? suppressed : 0xFFFF;
+        lifeline::printfTo(Serial, "[RATE] TX #%03d: %lu alerts suppressed over the last %lu s\n",
+                                   deviceId, (unsigned long)suppressed,
+                                   (unsigned long)((millis() - suppressedSince) / 1000));
+    }
+    
+    // No WiFi: the retry lane holds it until the connection is back
     if (!wifiConnected || WiFi.status() != WL_CONNECTED) {
-        Serial.println(F("[API] WiFi not connected, skipping API push"));
+        Serial.println(F("[API] WiFi not connected, alert held for the retry lane"));
+        queueUplink(p, lifeline::UPLINK_RETRY);
         return;
     }
-    
-    HTTPClient http;
-    http.begin(API_ENDPOINT);
-    http.addHeader("Content-Type", "application/json");
+    sendUplink(p, true);
+}
+
+/**
+ * One uplink attempt. What the API says decides where the alert goes next:
+ * done, the retry lane, the auto-register lane, or the terminal count.
+ * fresh: straight from the radio, so the latency trace running is its own.
+ */
+void sendUplink(lifeline::PendingUplink& p, bool fresh) {
+    const bool firstAttempt = fresh && p.attempts == 0 && !p.reportOnly;
+    if (firstAttempt && rxTrace.active) {
+        rxTrace.uplinkSentUs = micros();
+    }
     
     // Create JSON payload: { DID: device_id, message_code: alert_code, RSSI: rssi }
-    String jsonPayload = "{\"DID\":" + String(deviceId) + 
-                         ",\"message_code\":" + String(alertIndex) + 
-                         ",\"RSSI\":" + String(rssi) + "}";
+    uplinkBody.clear();
+    uplinkBody.appendf("{\"DID\":%d,\"message_code\":%d,\"RSSI\":%d",
+                       p.deviceId, p.alertIndex, p.rssi);
+    if (p.autoRegister) {
+        uplinkBody.append(",\"auto_register\":true");
+    }
+    if (p.suppressed) {
+        uplinkBody.appendf(",\"suppressed\":%u", p.suppressed);
+    }
+    if (p.reportOnly) {
+        uplinkBody.append(",\"suppressed_only\":true");
+    }
     
-    Serial.printf("[API] Sending: %s\n", jsonPayload.c_str());
+    // Latency stamps: TX UI, airtime, gateway RxDone → uplink
+    if (firstAttempt && rxTrace.active) {
+        uplinkBody.appendf(",\"latency\":{\"gw_ms\":%ld", (long)rxTrace.gatewayMs());
+        if (rxTrace.overAir) {
+            uplinkBody.appendf(",\"air_ms\":%ld", (long)rxTrace.airMs());
+            if (rxTrace.txUiMs >= 0) {
+                uplinkBody.appendf(",\"tx_ui_ms\":%ld", (long)rxTrace.txUiMs);
+            }
+        }
+        uplinkBody.append('}');
+    }
     
-    int httpResponseCode = http.POST(jsonPayload);
+    // What the gateway hears from this device: relays and antennas are planned on it
+    const lifeline::LinkEntry* link = p.reportOnly ? nullptr : links.find(p.deviceId);
+    if (link) {
+        uplinkBody.appendf(",\"link\":{\"rssi\":%.1f,\"snr\":%.1f,\"packets\":%lu,\"alerts\":%lu,\"lost\":%lu}",
+                           link->rssi(), link->snr(), (unsigned long)link->packets,
+                           (unsigned long)link->alerts, (unsigned long)link->lost);
+    }
+    
+    // Round trip of the previous uplink can only be known after its response
+    if (prevUplinkMid > 0 && prevUplinkMs >= 0 && !p.reportOnly) {
+        uplinkBody.appendf(",\"prev_uplink\":{\"MID\":%d,\"uplink_ms\":%ld}",
+                           prevUplinkMid, prevUplinkMs);
+        prevUplinkMid = 0;
+        prevUplinkMs = -1;
+    }
+    uplinkBody.append('}');
+    
+    lifeline::printfTo(Serial, "[API] Sending: %s\n", uplinkBody.c_str());
+    
+    // HTTPClient and TLS allocate inside; the reply is copied out before
+    // the client goes away, so nothing of ours stays on the heap
+    int httpResponseCode;
+    unsigned long requestStart, requestDone;
+    uplinkReply.clear();
+    {
+        lifeline::LibraryHeap library;
+        HTTPClient http;
+        http.begin(API_ENDPOINT);
+        http.setConnectTimeout(API_CONNECT_TIMEOUT_MS);
+        http.setTimeout(API_READ_TIMEOUT_MS);
+        http.addHeader("Content-Type", "application/json");
+        
+        requestStart = micros();
+        httpResponseCode = http.POST((uint8_t*)uplinkBody.data(), uplinkBody.length());
+        requestDone = micros();
+        
+        if (httpResponseCode > 0) {
+            uplinkReply = http.getString().c_str();
+        } else {
+            lifeline::printfTo(Serial, "[API] Error: %s\n", http.errorToString(httpResponseCode).c_str());
+        }
+        http.end();
+    }
+    p.attempts++;
     
     if (httpResponseCode > 0) {
-        String response = http.getString();
-        Serial.printf("[API] Response (%d): %s\n", httpResponseCode, response.c_str());
-    } else {
-        Serial.printf("[API] Error: %s\n", http.errorToString(httpResponseCode).c_str());
+        if (firstAttempt && rxTrace.active) {
+            rxTrace.uplinkAckUs = requestDone;
+        }
+        lifeline::printfTo(Serial, "[API] Response (%d): %s\n", httpResponseCode, uplinkReply.c_str());
+        
+        // Remember the row ID so the next uplink can report this round trip
+        const char* mid = strstr(uplinkReply.c_str(), "\"MID\":");
+        if (mid) {
+            mid += 6;
+            if (*mid == '"') mid++;
+            prevUplinkMid = atoi(mid);
+            prevUplinkMs = (requestDone - requestStart) / 1000;
+        }
     }
     
-    http.end();
+    lifeline::UplinkResult result = lifeline::classifyUplink(httpResponseCode, uplinkReply.c_str());
+    switch (result) {
+        case lifeline::UPLINK_OK:
+            if (!fresh) {
+                uplinkLane.delivered();
+                lifeline::printfTo(Serial, "[UPLINK] TX #%03d %s delivered after %u attempts\n",
+                                           p.deviceId, alertNames[p.alertIndex].str, p.attempts);
+            }
+            if (p.autoRegister) {
+                // Registered now: anything else it has waiting can go too
+                registry.add(p.deviceId);
+                uplinkLane.release(p.deviceId, millis());
+                lifeline::printfTo(Serial, "[UPLINK] TX #%03d auto-registered\n", p.deviceId);
+            }
+            return;
+        
+        case lifeline::UPLINK_UNKNOWN:
+            // A device the API does not know has no row to add a count to
+            if (p.reportOnly) {
+                uplinkLane.countTerminal();
+                lifeline::printfTo(Serial, "[UPLINK] TX #%03d suppressed count refused: device not registered\n",
+                                           p.deviceId);
+                return;
+            }
+            // Sent with auto_register and still unknown: the API does not
+            // register, so wait for an operator like any other retry
+            if (p.autoRegister || !API_AUTO_REGISTER) {
+                result = lifeline::UPLINK_RETRY;
+            }
+            break;
+        
+        case lifeline::UPLINK_TERMINAL:
+            uplinkLane.countTerminal();
+            lifeline::printfTo(Serial, "[UPLINK] TX #%03d %s refused (%d), not retried\n",
+                                       p.deviceId, alertNames[p.alertIndex].str, httpResponseCode);
+            return;
+        
+        default:
+            break;
+    }
+    queueUplink(p, result);
+}
+
+/**
+ * Put an alert in the retry lane after an attempt that came back as why
+ */
+void queueUplink(const lifeline::PendingUplink& p, lifeline::UplinkResult why) {
+    if (!uplinkLane.push(p, why, millis())) {
+        lifeline::printfTo(Serial, "[UPLINK] Lane full of more urgent alerts: TX #%03d %s dropped\n",
+                                   p.deviceId, alertNames[p.alertIndex].str);
+        return;
+    }
+    lifeline::printfTo(Serial, "[UPLINK] TX #%03d %s queued (%s, attempt %u)\n",
+                               p.deviceId, alertNames[p.alertIndex].str,
+                               lifeline::uplinkResultNames[why], p.attempts);
+}
+
+/**
+ * Suppressed alerts no admitted alert has carried for RATE_REPORT_MS (the
+ * device flooded, then went quiet) or whose device lost its slot: one
+ * count per loop pass goes out on its own and is added to the device's
+ * last row, so nothing is notified again
+ */
+void serviceRateReports() {
+    uint16_t deviceId;
+    uint32_t since;
+    const uint32_t suppressed = rateLimiter.takeOverdue(millis(), RATE_REPORT_MS, deviceId, since);
+    if (!suppressed) return;
+    
+    const lifeline::LinkEntry* link = links.find(deviceId);
+    lifeline::PendingUplink p = {};
+    p.firstMs = millis();
+    p.deviceId = deviceId;
+    p.rssi = link ? (int16_t)link->rssi() : 0;
+    p.alertIndex = link && link->lastAlert < ALERT_COUNT ? link->lastAlert : ALERT_COUNT - 1;
+    p.priority = alertPriority[ALERT_COUNT - 1];  // Behind every real alert
+    p.suppressed = suppressed < 0xFFFF ? suppressed : 0xFFFF;
+    p.reportOnly = true;
+    lifeline::printfTo(Serial, "[RATE] TX #%03d: %lu alerts suppressed over the last %lu s, reported on their own\n",
+                               deviceId, (unsigned long)suppressed,
+                               (unsigned long)((millis() - since) / 1000));
+    
+    if (!wifiConnected || WiFi.status() != WL_CONNECTED) {
+        queueUplink(p, lifeline::UPLINK_RETRY);
+        return;
+    }
+    sendUplink(p, true);
+}
+
+/**
+ * One due uplink from the lane per loop pass, so the radio is never kept
+ * waiting for more than one request
+ */
+void serviceUplinkLane() {
+    lifeline::PendingUplink p;
+    if (uplinkLane.popDue(p, millis())) {
+        sendUplink(p, false);
+    }
+}
+
+/**
+ * Fetch the registered DIDs when due. The stored ETag goes out as
+ * If-None-Match, so an unchanged registry costs a 304 and no body.
+ */
+void serviceRegistry() {
+    const unsigned long interval = registry.synced() ? REGISTRY_SYNC_MS : REGISTRY_RETRY_MS;
+    if (registryFetched && millis() - registryFetchTime < interval) {
+        return;
+    }
+    registryFetched = true;
+    registryFetchTime = millis();
+    
+    // The body is parsed into the static registry before the client goes away
+    int status;
+    bool loaded = false;
+    {
+        lifeline::LibraryHeap library;
+        HTTPClient http;
+        http.begin(API_REGISTRY_ENDPOINT);
+        http.setConnectTimeout(API_CONNECT_TIMEOUT_MS);
+        http.setTimeout(API_READ_TIMEOUT_MS);
+        const char* keys[] = {"ETag"};
+        http.collectHeaders(keys, 1);
+        if (registry.etag()[0]) {
+            http.addHeader("If-None-Match", registry.etag());
+        }
+        status = http.GET();
+        if (status == HTTP_CODE_OK) {
+            String body = http.getString();
+            loaded = registry.load(body.c_str(), body.length(), http.header("ETag").c_str(), millis());
+        }
+        http.end();
+    }
+    
+    if (status == HTTP_CODE_NOT_MODIFIED) {
+        registry.notModified(millis());
+    } else if (loaded) {
+        lifeline::printfTo(Serial, "[REG] %u registered devices\n", registry.size());
+    } else {
+        // Keep what we had; lookups stay as they were until the next try
+        lifeline::printfTo(Serial, "[REG] Fetch failed (%d), retry in %lu s\n",
+                                   status, (unsigned long)(REGISTRY_RETRY_MS / 1000));
+        registryFetchTime = millis() - (interval - REGISTRY_RETRY_MS);
+    }
 }
 
 /**
@@ -1605,7 +2709,7 @@ String getPortalHTML() {
     html += ".container{max-width:400px;margin:0 auto;background:#252542;padding:30px;border-radius:10px;}";
     html += "h1{color:#00d4ff;text-align:center;margin-bottom:30px;}";
     html += "h2{color:#ffb800;font-size:16px;margin-bottom:20px;}";
-    html += "input[type=text],input[type=password]{width:100%;padding:12px;margin:8px 0 20px;border:1px solid #444;border-radius:5px;background:#1a1a2e;color:#fff;box-sizing:border-box;}";
+    html += "input[type=text],input[type=password],input[type=number]{width:100%;padding:12px;margin:8px 0 20px;border:1px solid #444;border-radius:5px;background:#1a1a2e;color:#fff;box-sizing:border-box;}";
     html += "input[type=submit]{width:100%;padding:14px;background:#00d4ff;color:#000;border:none;border-radius:5px;cursor:pointer;font-weight:bold;font-size:16px;}";
     html += "input[type=submit]:hover{background:#00b8e6;}";
     html += ".status{text-align:center;margin-top:20px;padding:10px;border-radius:5px;}";
@@ -1623,10 +2727,25 @@ String getPortalHTML() {
     html += "<input type='submit' value='Connect'>";
     html += "</form>";
     
-    if (storedSSID.length() > 0) {
-        html += "<div class='status info'>Currently configured: " + storedSSID + "</div>";
+    if (storedSSID[0]) {
+        html += "<div class='status info'>Currently configured: ";
+        html += storedSSID;
+        html += "</div>";
     }
     
+    // Per-device rate limit: saved without a restart
+    const lifeline::RateLimits& limits = rateLimiter.limits();
+    html += "<h2>Alert Limits (per device)</h2>";
+    html += "<form action='/limits' method='POST'>";
+    html += "<label>Alerts per minute (0 = no limit):</label>";
+    html += "<input type='number' name='per_minute' min='0' max='60' value='" + String(limits.perMinute) + "'>";
+    html += "<label>Burst (alerts back to back):</label>";
+    html += "<input type='number' name='burst' min='1' max='20' value='" + String(limits.burst) + "'>";
+    html += "<label>Extra critical alerts after the burst:</label>";
+    html += "<input type='number' name='critical_burst' min='0' max='30' value='" + String(limits.criticalBurst) + "'>";
+    html += "<input type='submit' value='Save Limits'>";
+    html += "</form>";
+    
     html += "</div></body></html>";
     return html;
 }
@@ -1667,10 +2786,52 @@ void handlePortalSave() {
     }
 }
 
+/**
+ * Handle save rate limits request; they apply at once, no restart
+ */
+void handlePortalLimits() {
+    const long perMinute = wifiServer.arg("per_minute").toInt();
+    const long burst = wifiServer.arg("burst").toInt();
+    const long criticalBurst = wifiServer.arg("critical_burst").toInt();
+    
+    if (perMinute < 0 || perMinute > 60 || burst < 1 || burst > 20 ||
+        criticalBurst < 0 || criticalBurst > 30) {
+        wifiServer.send(400, "text/plain", "Limits out of range: 0-60 per minute, burst 1-20, critical 0-30");
+        return;
+    }
+    
+    lifeline::RateLimits limits;
+    limits.perMinute = perMinute;
+    limits.burst = burst;
+    limits.criticalBurst = criticalBurst;
+    preferences.begin("lifeline", false);  // Read-write
+    preferences.putUChar("rate_pm", limits.perMinute);
+    preferences.putUChar("rate_burst", limits.burst);
+    preferences.putUChar("rate_crit", limits.criticalBurst);
+    preferences.end();
+    rateLimiter.setLimits(limits);
+    lifeline::printfTo(Serial, "[RATE] Saved: %u alerts/min per device, burst %u, critical +%u\n",
+                               limits.perMinute, limits.burst, limits.criticalBurst);
+    
+    String html = "<!DOCTYPE html><html><head>";
+    html += "<meta name='viewport' content='width=device-width, initial-scale=1'>";
+    html += "<title>LifeLine RX - Saved</title>";
+    html += "<style>body{font-family:Arial;background:#1a1a2e;color:#fff;text-align:center;padding:50px;}";
+    html += ".success{background:#00ff87;color:#000;padding:20px;border-radius:10px;max-width:400px;margin:0 auto;}</style></head><body>";
+    html += "<div class='success'><h2>Alert Limits Saved!</h2>";
+    html += "<p>" + String(limits.perMinute) + " per minute, burst " + String(limits.burst) +
+            ", critical +" + String(limits.criticalBurst) + "</p>";
+    html += "<p><a href='/'>Back</a></p></div>";
+    html += "</body></html>";
+    wifiServer.send(200, "text/html", html);
+}
+
 /**
  * Start WiFi configuration portal (AP mode)
  */
 void startWiFiPortal() {
+    // The portal is a maintenance mode: WebServer and its pages may allocate
+    lifeline::LibraryHeap portalHeap;
     Serial.println(F("[WIFI] Starting configuration portal..."));
     
     // Stop any existing connection
@@ -1682,12 +2843,13 @@ void startWiFiPortal() {
     WiFi.softAP(WIFI_AP_SSID, WIFI_AP_PASSWORD);
     
     IPAddress apIP = WiFi.softAPIP();
-    Serial.printf("[WIFI] Portal started! Connect to '%s' (password: %s)\n", WIFI_AP_SSID, WIFI_AP_PASSWORD);
-    Serial.printf("[WIFI] Portal IP: %s\n", apIP.toString().c_str());
+    lifeline::printfTo(Serial, "[WIFI] Portal started! Connect to '%s' (password: %s)\n", WIFI_AP_SSID, WIFI_AP_PASSWORD);
+    lifeline::printfTo(Serial, "[WIFI] Portal IP: %s\n", apIP.toString().c_str());
     
     // Setup web server routes
     wifiServer.on("/", handlePortalRoot);
     wifiServer.on("/save", HTTP_POST, handlePortalSave);
+    wifiServer.on("/limits", HTTP_POST, handlePortalLimits);
     wifiServer.begin();
     
     portalActive = true;
@@ -1703,16 +2865,22 @@ void startWiFiPortal() {
 void stopWiFiPortal() {
     if (!portalActive) return;
     
+    lifeline::LibraryHeap portalHeap;
     Serial.println(F("[WIFI] Stopping portal..."));
     wifiServer.stop();
     WiFi.softAPdisconnect(true);
     portalActive = false;
     
     // Try to connect with stored credentials
-    if (storedSSID.length() > 0) {
+    if (storedSSID[0]) {
         connectToWiFi();
     }
     
+    // WiFi came back up in a new place on the heap
+    if (memBudget.frozen()) {
+        memBudget.freeze(NO_HEAP_AFTER_BOOT);
+    }
+    
     // Return to idle screen
     if (currentScreen != SCREEN_ALERT) {
         currentScreen = SCREEN_IDLE;
@@ -1804,7 +2972,8 @@ void drawLongPressProgress(float progress) {
 }
 
 /**
- * Check WiFi portal button (EN/GPIO0) - 3 second long press
+ * Check WiFi portal button (EN/GPIO0) - 3 second long press. Shorter
+ * presses and holds are the inbox keys (onButtonPress).
  */
 void checkWiFiPortalButton() {
     bool currentButtonState = digitalRead(WIFI_PORTAL_PIN);
@@ -1823,7 +2992,7 @@ void checkWiFiPortalButton() {
             if (progress > 1.0) progress = 1.0;
             
             // Show progress on current screen (only if not in portal mode)
-            if (!portalActive && pressDuration > 200) {  // Start showing after 200ms
+            if (!portalActive && pressDuration > BUTTON_HOLD_MAX_MS) {  // Past an inbox hold
                 drawLongPressProgress(progress);
             }
             
@@ -1836,7 +3005,7 @@ void checkWiFiPortalButton() {
                     stopWiFiPortal();
                 } else {
                     // Enter WiFi setup - try connecting first, portal opens on failure
-                    if (storedSSID.length() > 0) {
+                    if (storedSSID[0]) {
                         connectToWiFi();  // This will auto-open portal if it fails
                     } else {
                         startWiFiPortal();  // No credentials, open portal directly
@@ -1845,11 +3014,7 @@ void checkWiFiPortalButton() {
                 
                 // Redraw current screen to remove progress bar
                 if (!portalActive) {
-                    if (currentScreen == SCREEN_IDLE) {
-                        drawIdleScreen();
-                    } else if (currentScreen == SCREEN_ALERT) {
-                        drawAlertScreen(lastDeviceId, lastAlertIndex, lastRssi);
-                    }
+                    redrawScreen();
                 }
             }
         }
@@ -1857,14 +3022,15 @@ void checkWiFiPortalButton() {
         // Button released
         if (buttonPressed) {
             buttonPressed = false;
+            unsigned long pressDuration = millis() - buttonPressStartTime;
             
-            // Redraw screen to remove progress bar (if short press)
-            if (!portalActive && (millis() - buttonPressStartTime) > 200) {
-                if (currentScreen == SCREEN_IDLE) {
-                    drawIdleScreen();
-                } else if (currentScreen == SCREEN_ALERT) {
-                    drawAlertScreen(lastDeviceId, lastAlertIndex, lastRssi);
-                }
+            if (portalActive) {
+                // Only the long press counts in portal mode
+            } else if (pressDuration > BUTTON_HOLD_MAX_MS) {
+                // Released before WiFi setup: remove the progress bar
+                redrawScreen();
+            } else if (pressDuration >= BUTTON_DEBOUNCE_MS) {
+                onButtonPress(pressDuration >= BUTTON_HOLD_MS);
             }
         }
     }
@@ -1876,7 +3042,10 @@ void checkWiFiPortalButton() {
 void handleWiFiPortal() {
     if (!portalActive) return;
     
-    wifiServer.handleClient();
+    {
+        lifeline::LibraryHeap portalHeap;
+        wifiServer.handleClient();
+    }
     
     // Auto-timeout portal
     if (millis() - portalStartTime >= WIFI_PORTAL_TIMEOUT) {
@@ -1885,6 +3054,125 @@ void handleWiFiPortal() {
     }
 }
 
+// ═══════════════════════════════════════════════════════════════════════════════════
+//                              BOOT SEQUENCE
+// ═══════════════════════════════════════════════════════════════════════════════════
+
+/**
+ * LoRa bring-up: reset pulse, then begin() with retries.
+ * The reset is timed here so LoRa.begin() does not repeat it with delay().
+ */
+int32_t radioBootStep(uint8_t phase) {
+    switch (phase) {
+        case 0:
+            digitalWrite(LORA_RST, LOW);
+            return 10;
+        case 1:
+            digitalWrite(LORA_RST, HIGH);
+            return 10;
+        default:
+            spiBus.radioAccess();
+            LoRa.setPins(LORA_CS, -1, LORA_DIO0);
+            if (!LoRa.begin(LORA_FREQUENCY)) {
+                if (phase < 2 + LORA_INIT_RETRIES) {
+                    lifeline::printfTo(Serial, "[WARN] LoRa init failed, retry %d/%d\n", phase - 1, LORA_INIT_RETRIES);
+                    return 100;
+                }
+                Serial.println(F("[ERROR] LoRa initialization failed!"));
+                loraInitialized = false;
+                return lifeline::BOOT_DONE;
+            }
+            LoRa.setSpreadingFactor(LORA_SF);
+            LoRa.setSignalBandwidth(LORA_BW);
+            LoRa.enableCrc();
+            LoRa.receive();  // Continuous RX: DIO0 rises at every RxDone
+            loraInitialized = true;
+            bootSeq.mark("radio");
+            lifeline::printfTo(Serial, "[OK] LoRa initialized @ 433MHz, SF12, BW125kHz, CRC enabled (%lu ms)\n", millis());
+            return lifeline::BOOT_DONE;
+    }
+}
+
+/**
+ * ST7789 bring-up: hardware reset and the 120 ms wait before the first
+ * command run as timers; the driver's own init sequence follows.
+ */
+int32_t panelBootStep(uint8_t phase) {
+    switch (phase) {
+        case 0:
+            digitalWrite(TFT_RST, LOW);
+            return 10;
+        case 1:
+            digitalWrite(TFT_RST, HIGH);
+            return 120;
+        default:
+            if (!tft.begin(SPI_SCK, SPI_MISO, SPI_MOSI)) {
+                Serial.println(F("[ERROR] TFT SPI host init failed!"));
+            }
+            tft.setRotation(SCREEN_ROTATION);
+            tft.fillScreen(ST77XX_BLACK);
+            lifeline::printfTo(Serial, "[OK] TFT initialized (%dx%d @ %lu MHz%s)\n",
+                               SCREEN_WIDTH, SCREEN_HEIGHT,
+                               (unsigned long)(tft.clockHz() / 1000000),
+                               tft.clockProbed() ? "" : ", not probed");
+            return lifeline::BOOT_DONE;
+    }
+}
+
+/**
+ * WiFi start-up blocks for tens of ms, so it waits for the radio
+ */
+int32_t wifiBootStep(uint8_t phase) {
+    if (!bootSeq.done(radioBootTask)) return 5;
+    loadWiFiCredentials();
+    beginWiFiBackground();
+    return lifeline::BOOT_DONE;
+}
+
+/**
+ * Leave boot as soon as the radio is listening
+ */
+void finishBoot() {
+    currentScreen = SCREEN_IDLE;
+    drawIdleScreen();
+    playBootTone();
+    digitalWrite(LED_GREEN, HIGH);
+    bootSeq.mark("idle");
+    lifeline::printfTo(Serial, "[BOOT] Listening %lu ms after boot (radio ready at %lu ms)\n",
+                               millis(), bootSeq.markMs("radio"));
+}
+
+/**
+ * Book the static blocks, print the budget and freeze the heap. Runs once
+ * boot and the first WiFi connect are over, so the WiFi stack has settled.
+ */
+void freezeHeapAfterBoot() {
+    memBudget.add("alert history", sizeof(alertHistory));
+    memBudget.add("alert inbox", sizeof(inbox));
+    memBudget.add("uplink body", sizeof(uplinkBody));
+    memBudget.add("uplink reply", sizeof(uplinkReply));
+    memBudget.add("device registry", sizeof(registry));
+    memBudget.add("uplink lane", sizeof(uplinkLane));
+    memBudget.add("dedupe filter", sizeof(rxDedupe));
+    memBudget.add("link stats", sizeof(links));
+    memBudget.add("rate limiter", sizeof(rateLimiter));
+    memBudget.add("latency log", sizeof(rxLatency));
+    memBudget.add("rx frames", sizeof(rxFrames));
+    memBudget.add("wifi creds", sizeof(storedSSID) + sizeof(storedPassword));
+    memBudget.add("serial input", sizeof(serialInputBuffer));
+    memBudget.freeze(NO_HEAP_AFTER_BOOT);
+    memBudget.printReport(Serial);
+}
+
+/**
+ * Time to first over-the-air alert after power-on, logged once
+ */
+void markFirstAlert() {
+    if (!rxTrace.overAir || bootSeq.markMs("first alert")) return;
+    bootSeq.mark("first alert");
+    lifeline::printfTo(Serial, "[BOOT] First alert %lu ms after boot\n", millis());
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                              SETUP
 // ═══════════════════════════════════════════════════════════════════════════════════
@@ -1892,7 +3180,6 @@ void handleWiFiPortal() {
 void setup() {
     // Initialize Serial for debugging
     Serial.begin(SERIAL_BAUD_RATE);
-    delay(100);
     
     Serial.println(F("\n╔═══════════════════════════════════════════════════════════╗"));
     Serial.println(F("║      LIFELINE EMERGENCY RECEIVER v3.1 PRO                 ║"));
@@ -1904,61 +3191,41 @@ void setup() {
     pinMode(LED_GREEN, OUTPUT);
     pinMode(LED_RED, OUTPUT);
     pinMode(TFT_CS, OUTPUT);
+    pinMode(TFT_RST, OUTPUT);
     pinMode(LORA_CS, OUTPUT);
     pinMode(LORA_RST, OUTPUT);
+    pinMode(LORA_DIO0, INPUT);
     pinMode(WIFI_PORTAL_PIN, INPUT_PULLUP);  // WiFi portal button (EN/GPIO0)
     
+    // The radio preempts display DMA at slice boundaries
+    tft.attachArbiter(spiBus);
+    spiBus.setRadio(loraRxDone, readLoRaFifo, nullptr);
+    
     digitalWrite(TFT_CS, HIGH);
     digitalWrite(LORA_CS, HIGH);
     digitalWrite(LED_GREEN, LOW);
     digitalWrite(LED_RED, LOW);
     
-    // Manual LoRa reset for reliable initialization
-    digitalWrite(LORA_RST, LOW);
-    delay(10);
-    digitalWrite(LORA_RST, HIGH);
-    delay(10);
-    
     // Initialize SPI
     SPI.begin(SPI_SCK, SPI_MISO, SPI_MOSI);
     Serial.println(F("[OK] SPI initialized"));
     
-    // Initialize LoRa - WORKING CONFIGURATION
-    LoRa.setPins(LORA_CS, LORA_RST, LORA_DIO0);
-    if (!LoRa.begin(LORA_FREQUENCY)) {
-        Serial.println(F("[ERROR] LoRa initialization failed!"));
-        loraInitialized = false;
-    } else {
-        LoRa.setSpreadingFactor(LORA_SF);
-        LoRa.setSignalBandwidth(LORA_BW);
-        LoRa.enableCrc();
-        loraInitialized = true;
-        Serial.println(F("[OK] LoRa initialized @ 433MHz, SF12, BW125kHz, CRC enabled"));
-        Serial.println(F("[OK] LoRa in continuous receive mode"));
-    }
+    // Before the radio: the first alert is already limited
+    loadRateLimits();
     
-    // Initialize TFT Display
-    tft.init(NATIVE_WIDTH, NATIVE_HEIGHT);
-    tft.setRotation(SCREEN_ROTATION);
-    tft.fillScreen(ST77XX_BLACK);
+    // Radio, panel and WiFi come up together; the radio goes first in every gap
+    radioBootTask = bootSeq.add("radio", radioBootStep);
+    panelBootTask = bootSeq.add("panel", panelBootStep);
+    bootSeq.add("wifi", wifiBootStep);
+    bootSeq.runUntil(panelBootTask);
     
-    Serial.printf("[OK] TFT initialized (%dx%d)\n", SCREEN_WIDTH, SCREEN_HEIGHT);
-    
-    // Show boot screen
-    currentScreen = SCREEN_BOOT;
-    drawBootScreen();
-    playBootTone();
-    
-    Serial.println(F("[OK] Boot screen displayed"));
-    
-    // Load and auto-connect WiFi if credentials exist
-    loadWiFiCredentials();
-    if (storedSSID.length() > 0) {
-        Serial.printf("[WIFI] Auto-connecting to: %s\n", storedSSID.c_str());
-        // Try to connect (but don't open portal on failure during boot)
-        connectToWiFiSilent();
+    // Boot screen only if the radio is still not listening
+    if (bootSeq.done(radioBootTask)) {
+        finishBoot();
     } else {
-        Serial.println(F("[WIFI] No credentials - Hold EN button for 3 seconds to configure"));
+        currentScreen = SCREEN_BOOT;
+        drawBootScreen();
+        Serial.println(F("[OK] Boot screen displayed"));
     }
     
     Serial.println(F("=== Ready to receive emergency alerts ===\n"));
@@ -1974,6 +3241,9 @@ void setup() {
 // ═══════════════════════════════════════════════════════════════════════════════════
 
 void loop() {
+    // A finished packet is read before anything else gets the bus
+    spiBus.poll();
+    
     // Handle WiFi portal if active
     if (portalActive) {
         checkWiFiPortalButton();  // Allow exiting portal
@@ -1981,100 +3251,84 @@ void loop() {
         return;  // Don't process other things while portal is active
     }
     
+    // Remaining boot tasks (radio retries, WiFi start) and the WiFi connect
+    if (!bootSeq.allDone()) {
+        bootSeq.poll();
+    }
+    serviceWiFiConnection();
+    
+    // Registry re-check and one due retry, between radio polls
+    if (wifiConnected && WiFi.status() == WL_CONNECTED) {
+        serviceRegistry();
+        serviceUplinkLane();
+    }
+    serviceRateReports();
+    
+    // From here on only static buffers (see NO_HEAP_AFTER_BOOT)
+    if (!memBudget.frozen()) {
+        if (bootSeq.allDone() && !wifiConnecting) freezeHeapAfterBoot();
+    } else {
+        memBudget.check(Serial);
+    }
+    
     // State machine for screen management
     switch (currentScreen) {
         
         case SCREEN_BOOT:
-            // Update boot animation and check if complete
-            if (updateBootAnimation()) {
-                currentScreen = SCREEN_IDLE;
-                drawIdleScreen();
-                digitalWrite(LED_GREEN, HIGH);
+            // Boot screen stays up only until the radio is listening
+            updateBootAnimation();
+            if (bootSeq.done(radioBootTask)) {
+                finishBoot();
                 Serial.println(F("[STATE] Switched to IDLE - Listening for alerts"));
             }
             break;
             
         case SCREEN_IDLE:
-            // Check WiFi button (3 second long press)
+            // Check WiFi button (3 second long press), press: link screen
             checkWiFiPortalButton();
             
             // Update idle animation
             updateIdleAnimation();
             
             // Check for incoming LoRa packets (priority)
-            {
-                int deviceId, alertIndex, rssi;
-                bool packetReceived = parseLoRaPacket(deviceId, alertIndex, rssi);
-                
-                // If no LoRa packet, check for Serial simulated packet
-                #if SERIAL_DEBUG_ENABLED
-                if (!packetReceived) {
-                    packetReceived = checkSerialSimulatedPacket(deviceId, alertIndex, rssi);
-                }
-                #endif
-                
-                if (packetReceived) {
-                    Serial.printf("[RX] Alert received: Device=%d, Alert=%d (%s), RSSI=%d\n",
-                                  deviceId, alertIndex, alertNames[alertIndex], rssi);
-                    
-                    // Push alert to web dashboard API
-                    pushAlertToAPI(deviceId, alertIndex, rssi);
-                    
-                    currentScreen = SCREEN_ALERT;
-                    drawAlertScreen(deviceId, alertIndex, rssi);
-                    
-                    // Set LED based on priority
-                    if (alertPriority[alertIndex] <= 1) {
-                        digitalWrite(LED_RED, HIGH);
-                        digitalWrite(LED_GREEN, LOW);
-                    } else {
-                        digitalWrite(LED_GREEN, HIGH);
-                        digitalWrite(LED_RED, LOW);
-                    }
-                    
-                    Serial.println(F("[STATE] Switched to ALERT"));
-                }
-            }
+            pollAlerts();
             break;
             
         case SCREEN_ALERT:
-            // Check WiFi button (3 second long press)
+            // Check WiFi button (3 second long press), inbox press / hold
             checkWiFiPortalButton();
             
-            // Check for new packets (higher priority alert would override)
-            {
-                int deviceId, alertIndex, rssi;
-                bool packetReceived = parseLoRaPacket(deviceId, alertIndex, rssi);
-                
-                #if SERIAL_DEBUG_ENABLED
-                if (!packetReceived) {
-                    packetReceived = checkSerialSimulatedPacket(deviceId, alertIndex, rssi);
-                }
-                #endif
-                
-                if (packetReceived) {
-                    Serial.printf("[RX] New alert received while displaying: Device=%d, Alert=%d\n", 
-                                  deviceId, alertIndex);
-                    
-                    // Push alert to web dashboard API
-                    pushAlertToAPI(deviceId, alertIndex, rssi);
-                    
-                    drawAlertScreen(deviceId, alertIndex, rssi);
-                    
-                    if (alertPriority[alertIndex] <= 1) {
-                        digitalWrite(LED_RED, HIGH);
-                        digitalWrite(LED_GREEN, LOW);
-                    }
-                }
-            }
+            // A new alert goes to the inbox; it takes the screen only if most urgent
+            pollAlerts();
             
-            // Return to idle after display time
+            // Back to the list (idle when nothing is open) after display time
             if (shouldReturnToIdle()) {
-                currentScreen = SCREEN_IDLE;
-                drawIdleScreen();
-                digitalWrite(LED_GREEN, HIGH);
-                digitalWrite(LED_RED, LOW);
-                Serial.println(F("[STATE] Auto-returned to IDLE"));
+                showInbox();
+                lifeline::printfTo(Serial, "[STATE] Auto-returned to %s\n",
+                                           currentScreen == SCREEN_IDLE ? "IDLE" : "INBOX");
+            }
+            break;
+            
+        case SCREEN_INBOX:
+            checkWiFiPortalButton();
+            pollAlerts();
+            
+            // New alerts are in the rows already; ages move once a minute
+            if (currentScreen == SCREEN_INBOX &&
+                (inbox.version() != inboxShownVersion ||
+                 millis() - inboxRefreshTime >= INBOX_REFRESH_MS)) {
+                refreshInbox();
+            }
+            break;
+            
+        case SCREEN_LINKS:
+            checkWiFiPortalButton();
+            pollAlerts();
+            
+            // A busy channel changes the numbers every frame: once a second is enough
+            if (currentScreen == SCREEN_LINKS &&
+                millis() - linksRefreshTime >= LINKS_REFRESH_MS) {
+                refreshLinks();
             }
             break;
             
@@ -24,7 +24,10 @@
  *   - Input: 4×4 Matrix Keypad (Primary) / Serial Monitor (Debug)
  *   - Indicators: Green LED (Success), Red LED (Failure), Buzzer
  * 
- * PACKET FORMAT: TX[ID],[ALERT_CODE] (e.g., "TX003,A")
+ * PACKET FORMAT: TX[ID],[ALERT_CODE][;k=MS][;s=SEQ] (e.g., "TX003,A;k=412;s=17")
+ *   k = milliseconds from the confirm key press to radio start (latency budget)
+ *   s = alert sequence number, repeated on retries/resumes so the RX can dedupe
+ * HEARTBEAT:     HB[ID];i=[AVG_mA x10];l=[HOURS];u=[UPTIME_MIN][;v=mV;b=%] (e.g., "HB003;i=523;l=38;u=120")
  * 
  * Author: LifeLine Development Team
  * Version: 3.1.0 PRO
@@ -37,6 +40,13 @@
 #include <Keypad.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7789.h>
+#include <AlertJournal.h>
+#include <BatteryMonitor.h>
+#include <EnergyMeter.h>
+#include <LatencyBudget.h>
+#include <SpiArbiter.h>
+#include <St7789Dma.h>
+#include <UiText.h>
 
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                              DEVICE CONFIGURATION
@@ -82,6 +92,10 @@
 // Audio Feedback
 #define BUZZER_PIN  12      // Buzzer
 
+// Battery Sense (ADC1, input-only) - 100k/100k divider from the cell
+#define BATTERY_ADC_PIN  35      // -1 if no divider is fitted
+#define BATTERY_DIVIDER  2.0f    // Cell voltage / pin voltage
+
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                          DISPLAY AUTO-ADAPTIVE CONFIGURATION
 // ═══════════════════════════════════════════════════════════════════════════════════
@@ -277,43 +291,11 @@ Keypad keypad = Keypad(makeKeymap(keypadLayout), rowPins, colPins, KEYPAD_ROWS,
 
 #define ALERT_COUNT 15
 
-// Alert messages - MUST match receiver configuration
-const char* alertNames[ALERT_COUNT] = {
-    "EMERGENCY",            // 0  - A - CRITICAL
-    "MEDICAL EMERGENCY",    // 1  - B - CRITICAL
-    "MEDICINE SHORTAGE",    // 2  - C - MEDIUM
-    "EVACUATION NEEDED",    // 3  - D - CRITICAL
-    "STATUS OK",            // 4  - E - OK
-    "INJURY REPORTED",      // 5  - F - HIGH
-    "FOOD SHORTAGE",        // 6  - G - MEDIUM
-    "WATER SHORTAGE",       // 7  - H - MEDIUM
-    "WEATHER ALERT",        // 8  - I - MEDIUM
-    "LOST PERSON",          // 9  - J - HIGH
-    "ANIMAL ATTACK",        // 10 - K - HIGH
-    "LANDSLIDE",            // 11 - L - HIGH
-    "SNOW STORM",           // 12 - M - HIGH
-    "EQUIPMENT FAILURE",    // 13 - N - MEDIUM
-    "OTHER EMERGENCY"       // 14 - O - NEUTRAL
-};
-
-// Shorter names for compact display
-const char* alertNamesShort[ALERT_COUNT] = {
-    "EMERGENCY",
-    "MEDICAL EMERG",
-    "MED SHORTAGE",
-    "EVACUATION",
-    "STATUS OK",
-    "INJURY",
-    "FOOD SHORT",
-    "WATER SHORT",
-    "WEATHER",
-    "LOST PERSON",
-    "ANIMAL ATTK",
-    "LANDSLIDE",
-    "SNOW STORM",
-    "EQUIP FAIL",
-    "OTHER"
-};
+// Alert names live once in LifelineCore (UiText.h), shared with the receiver
+const lifeline::Text* const alertNames = lifeline::ui::ALERT_NAMES;
+const lifeline::Text* const alertNamesShort = lifeline::ui::ALERT_SHORT;
+static_assert(lifeline::ui::ALERT_NAMES_COUNT == ALERT_COUNT,
+              "alert table size must match ALERT_COUNT");
 
 // Priority levels: 0=CRITICAL, 1=HIGH, 2=MEDIUM, 3=OK, 4=NEUTRAL
 const uint8_t alertPriority[ALERT_COUNT] = {
@@ -339,13 +321,37 @@ char getAlertCode(int index) {
 #define DEBOUNCE_DELAY          30      // Keypress debounce (ms) - FAST
 #define SCROLL_REPEAT_DELAY     80      // Auto-scroll repeat delay (ms) - FAST
 #define MAX_RETRY_ATTEMPTS      3       // Maximum transmission retry attempts
+#define HEARTBEAT_INTERVAL      900000  // Energy heartbeat period (ms) - 15 minutes
 
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                              GLOBAL OBJECTS
 // ═══════════════════════════════════════════════════════════════════════════════════
 
-// TFT Display (Hardware SPI - shared with LoRa module)
-Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_RST);
+// TFT Display (DMA on HSPI; SCK/MOSI shared with LoRa, see spiBus)
+lifeline::St7789Dma tft(TFT_CS, TFT_DC, TFT_RST, NATIVE_WIDTH, NATIVE_HEIGHT);
+
+// The radio takes the shared bus from the display (serial 'L' prints waits)
+lifeline::SpiArbiter spiBus;
+
+// Energy model for this build (mA per state, see EnergyMeter.h for state order)
+const lifeline::EnergyCalibration energyCalibration = {
+    {
+        {0.0002f, 1.6f, 10.8f, 100.0f},  // Radio: sleep, standby, rx, tx @ +18 dBm
+        {0.0f, 35.0f, 0.0f, 0.0f},       // Display: off, on (ST7789 + backlight)
+        {0.8f, 27.0f, 50.0f, 0.0f},      // CPU: light sleep, idle, active
+        {0.0f, 0.0f, 0.0f, 0.0f},        // NeoPixel: not fitted
+        {0.0f, 30.0f, 0.0f, 0.0f},       // Buzzer: off, on
+    },
+    2.0f                                 // Board baseline (regulator, LEDs off)
+};
+lifeline::EnergyMeter energy(energyCalibration);
+
+// Battery state of charge and power-saver tier
+lifeline::BatteryMonitor battery(BATTERY_ADC_PIN, BATTERY_DIVIDER);
+
+// Pending SOS and reset counters in RTC memory (survive brownout/watchdog)
+LIFELINE_RTC_NOINIT lifeline::RtcJournal rtcJournal;
+lifeline::AlertJournal alertJournal(rtcJournal);
 
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                              STATE MANAGEMENT
@@ -379,6 +385,7 @@ unsigned long bootStartTime = 0;
 unsigned long resultStartTime = 0;
 unsigned long lastKeyPressTime = 0;
 unsigned long lastTransmitTime = 0;
+unsigned long lastHeartbeatTime = 0;
 
 // Transmission state
 bool lastTransmitSuccess = false;
@@ -386,9 +393,14 @@ int retryCount = 0;
 int totalTransmissions = 0;
 int successfulTransmissions = 0;
 
+// Latency budget: key press → radio start → TxDone (serial 'L' prints report)
+unsigned long keyPressMicros = 0;
+lifeline::LatencyRecorder<> txLatency;
+
 // System status
 bool loraInitialized = false;
 int batteryPercent = -1;  // -1 = not available
+bool resumedOnBoot = false;  // An interrupted SOS was re-sent during setup()
 
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                          SERIAL DEBUG CONFIGURATION
@@ -410,12 +422,26 @@ char readSerialKey() {
     if (c == 's' || c == 'S') c = '*';
     if (c == 'x' || c == 'X') c = '#';
     
+    if (c == 'l' || c == 'L') {
+        txLatency.printReport(Serial);
+        spiBus.printReport(Serial);
+        return '\0';
+    }
+    if (c == 'e' || c == 'E') {
+        energy.printReport(Serial, remainingBatteryMah());
+        return '\0';
+    }
+    if (c == 'r' || c == 'R') {
+        alertJournal.printReport(Serial);
+        return '\0';
+    }
+    
     if ((c >= '0' && c <= '9') || (c >= 'A' && c <= 'D') || c == '*' || c == '#') {
         return c;
     }
     
     if (c != '\n' && c != '\r') {
-        Serial.println(F("\n[DEBUG] Keys: 0-9=Select, A=Up, B=Down, C=Info, D=Help, S/*=OK, X/#=Cancel"));
+        Serial.println(F("\n[DEBUG] Keys: 0-9=Select, A=Up, B=Down, C=Info, D=Help, S/*=OK, X/#=Cancel, L=Latency, E=Energy, R=Resets"));
     }
     return '\0';
 }
@@ -470,13 +496,20 @@ void updateMenuScroll() {
 /**
  * Draw text centered horizontally
  */
+void drawCenteredText(const lifeline::Text& text, int y, uint8_t textSize, uint16_t color) {
+    tft.setTextSize(textSize);
+    tft.setTextColor(color);
+    tft.setCursor(lifeline::centerX(text, textSize, SCREEN_WIDTH), y);
+    tft.print(text.str);
+}
+
+/**
+ * Draw a runtime string (IDs, counters) centered horizontally
+ */
 void drawCenteredText(const char* text, int y, uint8_t textSize, uint16_t color) {
     tft.setTextSize(textSize);
     tft.setTextColor(color);
-    int16_t x1, y1;
-    uint16_t w, h;
-    tft.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
-    tft.setCursor((SCREEN_WIDTH - w) / 2, y);
+    tft.setCursor(lifeline::centerSpan(lifeline::textWidth(text, textSize), SCREEN_WIDTH), y);
     tft.print(text);
 }
 
@@ -486,10 +519,7 @@ void drawCenteredText(const char* text, int y, uint8_t textSize, uint16_t color)
 void drawRightText(const char* text, int y, uint8_t textSize, uint16_t color) {
     tft.setTextSize(textSize);
     tft.setTextColor(color);
-    int16_t x1, y1;
-    uint16_t w, h;
-    tft.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
-    tft.setCursor(SCREEN_WIDTH - w - MARGIN, y);
+    tft.setCursor(SCREEN_WIDTH - lifeline::textWidth(text, textSize) - MARGIN, y);
     tft.print(text);
 }
 
@@ -593,10 +623,7 @@ void drawHeader(const char* title) {
     
     // Title with slight shadow for depth
     tft.setTextSize(TEXT_MEDIUM);
-    int16_t x1, y1;
-    uint16_t w, h;
-    tft.getTextBounds(title, 0, 0, &x1, &y1, &w, &h);
-    int textY = (HEADER_HEIGHT - h) / 2 - 1;
+    int textY = (HEADER_HEIGHT - lifeline::TEXT_CHAR_H * TEXT_MEDIUM) / 2 - 1;
     
     // Shadow
     tft.setTextColor(RGB565(0, 0, 0));
@@ -671,22 +698,29 @@ void clearAllLEDs() {
  */
 void playSuccessTone() {
     tone(BUZZER_PIN, 2200, 80);  // Short, non-blocking
+    energy.pulse(lifeline::EN_BUZZER, lifeline::LOAD_ON, 80);
 }
 
 void playErrorTone() {
     tone(BUZZER_PIN, 800, 150);  // Single beep, no loop delays
+    energy.pulse(lifeline::EN_BUZZER, lifeline::LOAD_ON, 150);
 }
 
 void playConfirmTone() {
     tone(BUZZER_PIN, 2500, 30);  // Very short
+    energy.pulse(lifeline::EN_BUZZER, lifeline::LOAD_ON, 30);
 }
 
 void playClickTone() {
+    if (!battery.policy().uiTones) return;
     tone(BUZZER_PIN, 1800, 15);  // Minimal click
+    energy.pulse(lifeline::EN_BUZZER, lifeline::LOAD_ON, 15);
 }
 
 void playNavigateTone() {
+    if (!battery.policy().uiTones) return;
     tone(BUZZER_PIN, 1500, 10);  // Ultra-fast navigation beep
+    energy.pulse(lifeline::EN_BUZZER, lifeline::LOAD_ON, 10);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════════
@@ -729,21 +763,20 @@ void drawBootScreen() {
     
     // ─────────────────── MAIN TITLE "LifeLine" WITH GLOW ───────────────────
     tft.setTextSize(TEXT_XLARGE);
-    int16_t x1, y1;
-    uint16_t tw, th;
-    tft.getTextBounds("LifeLine", 0, 0, &x1, &y1, &tw, &th);
-    int titleX = (SCREEN_WIDTH - tw) / 2;
+    const uint16_t tw = lifeline::ui::LIFELINE.widthAt(TEXT_XLARGE);
+    const uint16_t th = lifeline::TEXT_CHAR_H * TEXT_XLARGE;
+    int titleX = lifeline::centerX(lifeline::ui::LIFELINE, TEXT_XLARGE, SCREEN_WIDTH);
     int titleY = 85;
     
     // Text glow/shadow
     tft.setTextColor(COLOR_CYAN_DARK);
     tft.setCursor(titleX + 2, titleY + 2);
-    tft.print(F("LifeLine"));
+    tft.print(lifeline::ui::LIFELINE.str);
     
     // Main title
     tft.setTextColor(COLOR_TEXT_PRIMARY);
     tft.setCursor(titleX, titleY);
-    tft.print(F("LifeLine"));
+    tft.print(lifeline::ui::LIFELINE.str);
     
     // Animated underline effect (gradient)
     for (int i = 0; i < tw; i++) {
@@ -753,11 +786,11 @@ void drawBootScreen() {
     }
     
     // ─────────────────── SUBTITLE WITH PREMIUM STYLING ───────────────────
-    drawCenteredText("EMERGENCY COMMUNICATION", 130, TEXT_SMALL, COLOR_CYAN);
+    drawCenteredText(lifeline::ui::EMERGENCY_COMMUNICATION, 130, TEXT_SMALL, COLOR_CYAN);
     
     // Decorative dots
     tft.fillCircle(SCREEN_WIDTH/2 - 60, 144, 2, COLOR_ACCENT_LINE);
-    drawCenteredText("TRANSMITTER", 140, TEXT_MEDIUM, COLOR_TEXT_SECONDARY);
+    drawCenteredText(lifeline::ui::TRANSMITTER, 140, TEXT_MEDIUM, COLOR_TEXT_SECONDARY);
     tft.fillCircle(SCREEN_WIDTH/2 + 60, 144, 2, COLOR_ACCENT_LINE);
     
     // ─────────────────── PREMIUM INFO CARDS ───────────────────
@@ -837,7 +870,7 @@ void updateMenuSelection(int oldIndex, int newIndex) {
         // Alert name
         tft.setTextColor(COLOR_TEXT_SECONDARY);
         tft.setCursor(MARGIN + 32, itemY + 9);
-        tft.print(alertNamesShort[oldIndex]);
+        tft.print(alertNamesShort[oldIndex].str);
         
         // Priority indicator with glow
         uint16_t prioColor = getAlertColor(oldIndex);
@@ -873,7 +906,7 @@ void updateMenuSelection(int oldIndex, int newIndex) {
         // Alert name (dark on amber)
         tft.setTextColor(COLOR_TEXT_DARK);
         tft.setCursor(MARGIN + 36, itemY + 8);
-        tft.print(alertNamesShort[newIndex]);
+        tft.print(alertNamesShort[newIndex].str);
         
         // Priority indicator with border
         uint16_t prioColor = getAlertColor(newIndex);
@@ -959,7 +992,7 @@ void drawMenuScreen() {
             // Alert name
             tft.setTextColor(COLOR_TEXT_DARK);
             tft.setCursor(MARGIN + 36, itemY + 8);
-            tft.print(alertNamesShort[alertIndex]);
+            tft.print(alertNamesShort[alertIndex].str);
             
             // Priority dot with border
             uint16_t prioColor = getAlertColor(alertIndex);
@@ -984,7 +1017,7 @@ void drawMenuScreen() {
             // Alert name
             tft.setTextColor(COLOR_TEXT_SECONDARY);
             tft.setCursor(MARGIN + 32, itemY + 9);
-            tft.print(alertNamesShort[alertIndex]);
+            tft.print(alertNamesShort[alertIndex].str);
             
             // Priority indicator
             uint16_t prioColor = getAlertColor(alertIndex);
@@ -1113,7 +1146,7 @@ void drawConfirmScreen() {
     tft.setTextSize(TEXT_MEDIUM);
     tft.setTextColor(alertColor);
     tft.setCursor(MARGIN + 18, alertBoxY + 12);
-    tft.print(alertNames[selectedAlertIndex]);
+    tft.print(alertNames[selectedAlertIndex].str);
     
     // Alert code badge - right aligned inside card
     int codeBadgeW = 34;
@@ -1177,11 +1210,9 @@ void drawConfirmScreen() {
     // SEND button text - centered
     tft.setTextSize(TEXT_MEDIUM);
     tft.setTextColor(COLOR_TEXT_DARK);
-    int16_t tx1, ty1;
-    uint16_t tw1, th1;
-    tft.getTextBounds("* SEND", 0, 0, &tx1, &ty1, &tw1, &th1);
-    tft.setCursor(btnStartX + (btnW - tw1) / 2, btnY + (btnH - th1) / 2);
-    tft.print(F("* SEND"));
+    const int16_t btnTextY = btnY + (btnH - lifeline::TEXT_CHAR_H * TEXT_MEDIUM) / 2;
+    tft.setCursor(lifeline::centerX(lifeline::ui::SEND, TEXT_MEDIUM, btnW, btnStartX), btnTextY);
+    tft.print(lifeline::ui::SEND.str);
     
     // CANCEL button (outline style)
     int cancelX = btnStartX + btnW + btnGap;
@@ -1191,9 +1222,8 @@ void drawConfirmScreen() {
     
     // CANCEL button text - centered
     tft.setTextColor(COLOR_RED);
-    tft.getTextBounds("# CANCEL", 0, 0, &tx1, &ty1, &tw1, &th1);
-    tft.setCursor(cancelX + (btnW - tw1) / 2, btnY + (btnH - th1) / 2);
-    tft.print(F("# CANCEL"));
+    tft.setCursor(lifeline::centerX(lifeline::ui::CANCEL, TEXT_MEDIUM, btnW, cancelX), btnTextY);
+    tft.print(lifeline::ui::CANCEL.str);
     
     Serial.println(F("[SCREEN] Confirm screen displayed"));
 }
@@ -1272,7 +1302,7 @@ void drawSendingScreen() {
     tft.setTextSize(TEXT_MEDIUM);
     tft.setTextColor(COLOR_TEXT_PRIMARY);
     tft.setCursor(MARGIN + 14, alertCardY + 28);
-    tft.print(alertNamesShort[selectedAlertIndex]);
+    tft.print(alertNamesShort[selectedAlertIndex].str);
     
     // Alert code badge - right side
     uint16_t alertColor = getAlertColor(selectedAlertIndex);
@@ -1370,13 +1400,13 @@ void drawResultScreen() {
         tft.setCursor(MARGIN + 16, successCardY + 32);
         tft.print(F("Alert: "));
         tft.setTextColor(COLOR_TEXT_PRIMARY);
-        tft.print(alertNamesShort[selectedAlertIndex]);
+        tft.print(alertNamesShort[selectedAlertIndex].str);
         
         // Auto-return indicator at bottom
         int autoReturnY = SCREEN_HEIGHT - 38;
         int autoReturnH = 26;
         tft.fillRoundRect(MARGIN * 2, autoReturnY, SCREEN_WIDTH - MARGIN * 4, autoReturnH, 4, RGB565(15, 30, 20));
-        drawCenteredText("Returning to menu...", autoReturnY + 9, TEXT_SMALL, COLOR_TEXT_MUTED);
+        drawCenteredText(lifeline::ui::RETURNING_TO_MENU, autoReturnY + 9, TEXT_SMALL, COLOR_TEXT_MUTED);
         
         setLED(LED_GREEN, true);
         setLED(LED_RED, false);
@@ -1420,7 +1450,7 @@ void drawResultScreen() {
         }
         
         // Failure message - centered
-        drawCenteredText("Send Failed!", 138, TEXT_LARGE, COLOR_CYAN);
+        drawCenteredText(lifeline::ui::SEND_FAILED, 138, TEXT_LARGE, COLOR_CYAN);
         
         // Retry info card
         int retryCardY = 166;
@@ -1451,11 +1481,9 @@ void drawResultScreen() {
         // RETRY button text - centered
         tft.setTextSize(TEXT_MEDIUM);
         tft.setTextColor(COLOR_TEXT_DARK);
-        int16_t rtx, rty;
-        uint16_t rtw, rth;
-        tft.getTextBounds("* RETRY", 0, 0, &rtx, &rty, &rtw, &rth);
-        tft.setCursor(failBtnStartX + (failBtnW - rtw) / 2, failBtnY + (failBtnH - rth) / 2);
-        tft.print(F("* RETRY"));
+        const int16_t failTextY = failBtnY + (failBtnH - lifeline::TEXT_CHAR_H * TEXT_MEDIUM) / 2;
+        tft.setCursor(lifeline::centerX(lifeline::ui::RETRY, TEXT_MEDIUM, failBtnW, failBtnStartX), failTextY);
+        tft.print(lifeline::ui::RETRY.str);
         
         // MENU button
         int menuBtnX = failBtnStartX + failBtnW + failBtnGap;
@@ -1464,9 +1492,8 @@ void drawResultScreen() {
         
         // MENU button text - centered
         tft.setTextColor(COLOR_TEXT_SECONDARY);
-        tft.getTextBounds("# MENU", 0, 0, &rtx, &rty, &rtw, &rth);
-        tft.setCursor(menuBtnX + (failBtnW - rtw) / 2, failBtnY + (failBtnH - rth) / 2);
-        tft.print(F("# MENU"));
+        tft.setCursor(lifeline::centerX(lifeline::ui::MENU, TEXT_MEDIUM, failBtnW, menuBtnX), failTextY);
+        tft.print(lifeline::ui::MENU.str);
         
         setLED(LED_GREEN, false);
         setLED(LED_RED, true);
@@ -1612,6 +1639,11 @@ void drawSystemInfoScreen() {
     if (batteryPercent >= 0) {
         tft.print(batteryPercent);
         tft.print(F("%"));
+        if (battery.tier() != lifeline::POWER_NORMAL) {
+            tft.setTextColor(battery.tier() >= lifeline::POWER_LOW ? COLOR_RED : COLOR_AMBER);
+            tft.print(' ');
+            tft.print(lifeline::powerTierNames[battery.tier()]);
+        }
     } else {
         tft.print(F("USB"));
     }
@@ -1638,6 +1670,22 @@ void drawSystemInfoScreen() {
     tft.setCursor(statsX + 38, dataRow1Y);
     tft.print(statsStr);
     
+    // Projected runtime at the average draw so far
+    tft.setTextColor(COLOR_TEXT_MUTED);
+    tft.setCursor(statsX, dataRow2Y);
+    tft.print(F("Life:"));
+    
+    char lifeStr[16];
+    float lifeHours = energy.projectedHours(remainingBatteryMah());
+    if (lifeHours >= 999.5f) {
+        sprintf(lifeStr, ">999h");
+    } else {
+        sprintf(lifeStr, "%.0fh %.0fmA", lifeHours, energy.averageMa());
+    }
+    tft.setTextColor(COLOR_AMBER);
+    tft.setCursor(statsX + 38, dataRow2Y);
+    tft.print(lifeStr);
+    
     // ─────────────────── PREMIUM FOOTER ───────────────────
     drawFooter("Press any key to return");
     
@@ -1690,7 +1738,7 @@ void drawUserManualScreen() {
             tft.setTextColor(COLOR_TEXT_PRIMARY);
             tft.setTextSize(TEXT_MEDIUM);
             tft.setCursor(contentX + 36, y + 3);
-            tft.print(F("SELECT ALERTS"));
+            tft.print(lifeline::ui::MANUAL_TITLES[0].str);
             y += 28;
             
             // Decorative line
@@ -1743,7 +1791,7 @@ void drawUserManualScreen() {
             tft.setTextColor(COLOR_TEXT_PRIMARY);
             tft.setTextSize(TEXT_MEDIUM);
             tft.setCursor(contentX + 36, y + 3);
-            tft.print(F("NAVIGATION"));
+            tft.print(lifeline::ui::MANUAL_TITLES[1].str);
             y += 28;
             
             tft.drawFastHLine(contentX, y, SCREEN_WIDTH - MARGIN * 2 - 24, COLOR_CYAN_DARK);
@@ -1782,7 +1830,7 @@ void drawUserManualScreen() {
             tft.setTextColor(COLOR_TEXT_PRIMARY);
             tft.setTextSize(TEXT_MEDIUM);
             tft.setCursor(contentX + 36, y + 3);
-            tft.print(F("SENDING"));
+            tft.print(lifeline::ui::MANUAL_TITLES[2].str);
             y += 28;
             
             tft.drawFastHLine(contentX, y, SCREEN_WIDTH - MARGIN * 2 - 24, COLOR_GREEN_DARK);
@@ -1833,14 +1881,14 @@ void drawUserManualScreen() {
             drawStatusIndicator(contentX + 8, y + 6, 6, COLOR_GREEN);
             tft.setTextColor(COLOR_TEXT_SECONDARY);
             tft.setCursor(contentX + 22, y + 2);
-            tft.print(F("GREEN = Sent OK"));
+            tft.print(lifeline::ui::MANUAL_LED_GREEN.str);
             y += 22;
             
             // Red LED with glow
             drawStatusIndicator(contentX + 8, y + 6, 6, COLOR_RED);
             tft.setTextColor(COLOR_TEXT_SECONDARY);
             tft.setCursor(contentX + 22, y + 2);
-            tft.print(F("RED = Send Failed"));
+            tft.print(lifeline::ui::MANUAL_LED_RED.str);
             y += 28;
             
             // Emergency tip box
@@ -1881,25 +1929,55 @@ void drawUserManualScreen() {
 //                              LORA TRANSMISSION
 // ═══════════════════════════════════════════════════════════════════════════════════
 
-bool transmitAlert() {
+/**
+ * Send the journaled alert. The frame carries its sequence number (s=) so the
+ * RX can drop repeats, and the UI latency (k=) unless it was resumed at boot.
+ */
+bool transmitAlert(bool resumed = false) {
     if (!loraInitialized) {
         Serial.println(F("[LORA] ERROR: Not initialized"));
         return false;
     }
     
-    char alertCode = getAlertCode(selectedAlertIndex);
-    char packet[16];
-    sprintf(packet, "TX%03d,%c", DEVICE_ID, alertCode);
-    
-    Serial.printf("[LORA] TX: %s (%s)\n", packet, alertNames[selectedAlertIndex]);
-    
     // Ensure LoRa is in idle state before transmitting
+    spiBus.radioAccess();
     LoRa.idle();
+    LoRa.setTxPower(LORA_TX_POWER);  // SOS always at full power, whatever the tier
     delay(10);
     
+    // Stamp radio start and carry the UI share of the budget in the frame
+    unsigned long radioStartMicros = micros();
+    unsigned long uiMs = (radioStartMicros - keyPressMicros) / 1000;
+    
+    char alertCode = getAlertCode(selectedAlertIndex);
+    char packet[40];
+    if (resumed) {
+        snprintf(packet, sizeof(packet), "TX%03d,%c;s=%u", DEVICE_ID, alertCode,
+                 alertJournal.seq());
+    } else {
+        snprintf(packet, sizeof(packet), "TX%03d,%c;k=%lu;s=%u", DEVICE_ID, alertCode,
+                 uiMs, alertJournal.seq());
+    }
+    
+    energy.set(lifeline::EN_RADIO, lifeline::RADIO_TX);
     LoRa.beginPacket();
     LoRa.print(packet);
     bool success = LoRa.endPacket();  // Synchronous mode - wait for TX complete
+    radioRest();
+    
+    if (success) {
+        alertJournal.sent();
+    }
+    
+    unsigned long radioDoneMicros = micros();
+    if (!resumed) {
+        txLatency.record(lifeline::LAT_TX_UI, radioStartMicros - keyPressMicros);
+    }
+    txLatency.record(lifeline::LAT_TX_RADIO, radioDoneMicros - radioStartMicros);
+    
+    Serial.printf("[LORA] TX: %s (%s)\n", packet, alertNames[selectedAlertIndex].str);
+    Serial.printf("[LAT] key->radio %lu ms, radio %lu ms\n",
+                  resumed ? 0UL : uiMs, (radioDoneMicros - radioStartMicros) / 1000);
     
     // Small delay to ensure radio returns to idle
     delay(50);
@@ -1914,6 +1992,114 @@ bool transmitAlert() {
     return success;
 }
 
+/**
+ * Re-send an SOS that a reset interrupted, before the UI comes up.
+ * Same sequence number as the original, so a copy that did go out is
+ * dropped by the RX.
+ */
+void resumePendingAlert() {
+    if (alertJournal.abandoned()) {
+        Serial.printf("[RESUME] Alert s=%u abandoned after %d resets during send\n",
+                      alertJournal.seq(), JOURNAL_MAX_RESUMES);
+        return;
+    }
+    if (!alertJournal.pending() || !loraInitialized) return;
+    if (alertJournal.pendingAlert() >= ALERT_COUNT) {
+        alertJournal.cancel();
+        return;
+    }
+    
+    selectedAlertIndex = alertJournal.pendingAlert();
+    Serial.printf("[RESUME] Re-sending %s (s=%u, attempt %u) after %s reset\n",
+                  alertNames[selectedAlertIndex].str, alertJournal.seq(),
+                  alertJournal.resumes(), alertJournal.resetReasonName());
+    
+    lastTransmitSuccess = transmitAlert(true);
+    retryCount = 0;
+    resumedOnBoot = true;
+}
+
+/**
+ * Park the radio after a transmission: standby normally, sleep in saver tiers
+ * (the next beginPacket() wakes it, so SOS latency is unaffected)
+ */
+void radioRest() {
+    if (battery.policy().radioSleep) {
+        LoRa.sleep();
+        energy.set(lifeline::EN_RADIO, lifeline::RADIO_SLEEP);
+    } else {
+        LoRa.idle();
+        energy.set(lifeline::EN_RADIO, lifeline::RADIO_STANDBY);
+    }
+}
+
+/**
+ * Battery left for projections: measured charge, or a full pack on USB
+ */
+float remainingBatteryMah() {
+    int pct = battery.percent();
+    return pct >= 0 ? ENERGY_BATTERY_MAH * pct / 100.0f : ENERGY_BATTERY_MAH;
+}
+
+/**
+ * Heartbeat period for the current power tier (0 = heartbeats off)
+ */
+unsigned long heartbeatInterval() {
+    return (unsigned long)HEARTBEAT_INTERVAL * battery.policy().heartbeatScale;
+}
+
+/**
+ * Broadcast the energy projection so the base station can track field units.
+ * Not counted as a transmission; only sent while the menu is idle, using the
+ * tier's efficient radio profile.
+ */
+void sendHeartbeat() {
+    lastHeartbeatTime = millis();
+    if (!loraInitialized) return;
+    
+    energy.checkpoint();
+    
+    char packet[64];
+    int len = snprintf(packet, sizeof(packet), "HB%03d;i=%u;l=%u;u=%lu", DEVICE_ID,
+                       (unsigned)(energy.averageMa() * 10.0f + 0.5f),
+                       (unsigned)(energy.projectedHours(remainingBatteryMah()) + 0.5f),
+                       (unsigned long)(energy.uptimeMs() / 60000ULL));
+    if (battery.present()) {
+        snprintf(packet + len, sizeof(packet) - len, ";v=%u;b=%d",
+                 battery.millivolts(), battery.percent());
+    }
+    
+    spiBus.radioAccess();
+    LoRa.idle();
+    LoRa.setTxPower(battery.policy().heartbeatTxPower);
+    energy.set(lifeline::EN_RADIO, lifeline::RADIO_TX);
+    LoRa.beginPacket();
+    LoRa.print(packet);
+    bool success = LoRa.endPacket();
+    LoRa.setTxPower(LORA_TX_POWER);
+    radioRest();
+    
+    Serial.printf("[HB] %s %s\n", packet, success ? "sent" : "FAILED");
+}
+
+/**
+ * Apply a new power tier (called once per tier change)
+ */
+void applyPowerTier() {
+    const lifeline::PowerPolicy& policy = battery.policy();
+    Serial.printf("[POWER] Tier %s at %d%% (%u mV): heartbeat x%u @ %d dBm, radio %s, UI tones %s\n",
+                  lifeline::powerTierNames[battery.tier()], battery.percent(),
+                  battery.millivolts(), policy.heartbeatScale, policy.heartbeatTxPower,
+                  policy.radioSleep ? "sleeps" : "standby", policy.uiTones ? "on" : "off");
+    
+    if (loraInitialized && currentScreen != SCREEN_SENDING) {
+        radioRest();
+    }
+    if (currentScreen == SCREEN_SYSTEM_INFO) {
+        drawSystemInfoScreen();
+    }
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════════
 //                              INPUT HANDLING
 // ═══════════════════════════════════════════════════════════════════════════════════
@@ -1921,6 +2107,8 @@ bool transmitAlert() {
 void handleKeyPress(char key) {
     if (key == '\0') return;
     
+    keyPressMicros = micros();
+    
     Serial.printf("[INPUT] Key: %c, Screen: %d\n", key, currentScreen);
     
     switch (currentScreen) {
@@ -2021,6 +2209,9 @@ void handleMenuInput(char key) {
 
 void handleConfirmInput(char key) {
     if (key == '*') {
+        // Journal first: a reset from here on resumes this alert at boot
+        alertJournal.arm(selectedAlertIndex);
+        
         // INSTANT SEND - Draw sending screen while transmitting
         currentScreen = SCREEN_SENDING;
         drawSendingScreen();
@@ -2060,6 +2251,7 @@ void handleResultInput(char key) {
             }
         }
         else if (key == '#') {
+            alertJournal.cancel();
             clearAllLEDs();
             retryCount = 0;
             currentScreen = SCREEN_MENU;
@@ -2094,7 +2286,10 @@ void handleUserManualInput(char key) {
 // ═══════════════════════════════════════════════════════════════════════════════════
 
 void setup() {
+    alertJournal.begin();
     Serial.begin(SERIAL_BAUD_RATE);
+    energy.begin();
+    energy.set(lifeline::EN_CPU, lifeline::CPU_ACTIVE);
     delay(100);
     
     #if SERIAL_DEBUG_ENABLED
@@ -2102,6 +2297,11 @@ void setup() {
     #endif
     
     Serial.println(F("[INIT] Starting LifeLine TX..."));
+    Serial.printf("[INIT] Reset: %s (boot #%lu)\n", alertJournal.resetReasonName(),
+                  (unsigned long)alertJournal.boots());
+    if (alertJournal.resetReason() != lifeline::RESET_POWERON) {
+        alertJournal.printReport(Serial);
+    }
     
     // GPIO
     pinMode(LED_GREEN, OUTPUT);
@@ -2120,6 +2320,13 @@ void setup() {
     digitalWrite(LORA_RST, HIGH);
     delay(10);
     
+    // Battery sense
+    if (battery.begin()) {
+        batteryPercent = battery.percent();
+        Serial.printf("[INIT] Battery: %u mV, %d%% (ADC cal: %s)\n",
+                      battery.millivolts(), batteryPercent, battery.vrefSource());
+    }
+    
     // SPI
     SPI.begin(SPI_SCK, SPI_MISO, SPI_MOSI);
     
@@ -2129,18 +2336,29 @@ void setup() {
         LoRa.setSpreadingFactor(LORA_SF);
         LoRa.setSignalBandwidth(LORA_BW);
         LoRa.enableCrc();
+        LoRa.setTxPower(LORA_TX_POWER);
         loraInitialized = true;
-        Serial.printf("[INIT] LoRa OK @ %.1f MHz, SF%d, BW125kHz, CRC enabled\\n", LORA_FREQUENCY / 1E6, LORA_SF);
+        energy.set(lifeline::EN_RADIO, lifeline::RADIO_STANDBY);
+        Serial.printf("[INIT] LoRa OK @ %.1f MHz, SF%d, BW125kHz, CRC enabled\n", LORA_FREQUENCY / 1E6, LORA_SF);
     } else {
         loraInitialized = false;
         Serial.println(F("[INIT] LoRa FAILED!"));
     }
     
+    // Interrupted SOS goes out before anything else is drawn
+    resumePendingAlert();
+    
     // TFT
-    tft.init(NATIVE_WIDTH, NATIVE_HEIGHT);
+    tft.attachArbiter(spiBus);
+    if (!tft.begin(SPI_SCK, SPI_MISO, SPI_MOSI)) {
+        Serial.println(F("[INIT] TFT: SPI host FAILED!"));
+    }
     tft.setRotation(SCREEN_ROTATION);
     tft.fillScreen(COLOR_BG_PRIMARY);
-    Serial.printf("[INIT] TFT: %dx%d\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    energy.set(lifeline::EN_DISPLAY, lifeline::DISPLAY_ON);
+    Serial.printf("[INIT] TFT: %dx%d @ %lu MHz%s\n", SCREEN_WIDTH, SCREEN_HEIGHT,
+                  (unsigned long)(tft.clockHz() / 1000000),
+                  tft.clockProbed() ? "" : " (not probed)");
     
     // Boot screen
     currentScreen = SCREEN_BOOT;
@@ -2161,9 +2379,23 @@ void setup() {
 // ═══════════════════════════════════════════════════════════════════════════════════
 
 void loop() {
+    battery.update();
+    batteryPercent = battery.percent();
+    if (battery.tierChanged()) {
+        applyPowerTier();
+    }
+    
     switch (currentScreen) {
         case SCREEN_BOOT:
             if (millis() - bootStartTime >= BOOT_DISPLAY_TIME) {
+                if (resumedOnBoot) {
+                    // Show the outcome of the resumed SOS (failure waits for retry/cancel)
+                    resumedOnBoot = false;
+                    currentScreen = SCREEN_RESULT;
+                    drawResultScreen();
+                    Serial.println(F("[STATE] -> RESULT (resumed)"));
+                    break;
+                }
                 currentScreen = SCREEN_MENU;
                 drawMenuScreen();
                 Serial.println(F("[STATE] -> MENU"));
@@ -2183,6 +2415,11 @@ void loop() {
                 }
                 #endif
                 if (key) handleKeyPress(key);
+                
+                if (currentScreen == SCREEN_MENU && heartbeatInterval() > 0 &&
+                    millis() - lastHeartbeatTime >= heartbeatInterval()) {
+                    sendHeartbeat();
+                }
             }
             break;
             
@@ -2212,7 +2449,10 @@ void loop() {
             break;
     }
     
+    // Loop pacing is idle time in the energy model
+    energy.set(lifeline::EN_CPU, lifeline::CPU_IDLE);
     delay(10);
+    energy.set(lifeline::EN_CPU, lifeline::CPU_ACTIVE);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════════
@@ -23,6 +23,7 @@ USE `lifeline`;
 -- Drop existing tables if they exist (for clean setup)
 -- --------------------------------------------------------
 
+DROP TABLE IF EXISTS `device_links`;
 DROP TABLE IF EXISTS `messages`;
 DROP TABLE IF EXISTS `devices`;
 DROP TABLE IF EXISTS `helps`;
@@ -105,11 +106,35 @@ CREATE TABLE `messages` (
   `RSSI` int(10) DEFAULT NULL COMMENT 'Signal strength indicator',
   `message_code` int(10) NOT NULL COMMENT 'Message code mapped from indexes',
   `timestamp` datetime DEFAULT CURRENT_TIMESTAMP,
+  `tx_ui_ms` int(10) DEFAULT NULL COMMENT 'TX: confirm key press to radio start (ms)',
+  `air_ms` int(10) DEFAULT NULL COMMENT 'LoRa time on air computed by the gateway (ms)',
+  `gw_ms` int(10) DEFAULT NULL COMMENT 'Gateway: RxDone to uplink request (ms)',
+  `uplink_ms` int(10) DEFAULT NULL COMMENT 'Gateway: uplink request to API response (ms), reported by the next uplink',
+  `ingested_at` datetime(3) DEFAULT CURRENT_TIMESTAMP(3) COMMENT 'Server clock when the row was written',
+  `suppressed` int(10) NOT NULL DEFAULT 0 COMMENT 'Alerts from this device rate-limited by the gateway since its previous uplink',
   PRIMARY KEY (`MID`),
   KEY `fk_device` (`DID`),
+  KEY `idx_ingested_at` (`ingested_at`),
   CONSTRAINT `fk_device` FOREIGN KEY (`DID`) REFERENCES `devices` (`DID`) ON DELETE CASCADE
 ) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COLLATE=utf8mb4_general_ci;
 
+-- --------------------------------------------------------
+-- Table structure for table `device_links`
+-- Link quality per device as the gateway hears it, from each uplink
+-- --------------------------------------------------------
+
+CREATE TABLE `device_links` (
+  `DID` int(10) NOT NULL COMMENT 'Device the gateway heard',
+  `rssi_avg` decimal(5,1) DEFAULT NULL COMMENT 'Gateway EWMA of RSSI (dBm)',
+  `snr_avg` decimal(4,1) DEFAULT NULL COMMENT 'Gateway EWMA of SNR (dB)',
+  `packets` int(10) UNSIGNED NOT NULL DEFAULT 0 COMMENT 'Frames heard since the gateway booted',
+  `alerts` int(10) UNSIGNED NOT NULL DEFAULT 0 COMMENT 'Distinct alerts (s= values) heard',
+  `lost` int(10) UNSIGNED NOT NULL DEFAULT 0 COMMENT 'Alerts missing from the s= sequence',
+  `updated_at` datetime DEFAULT CURRENT_TIMESTAMP ON UPDATE CURRENT_TIMESTAMP,
+  PRIMARY KEY (`DID`),
+  CONSTRAINT `fk_link_device` FOREIGN KEY (`DID`) REFERENCES `devices` (`DID`) ON DELETE CASCADE
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COLLATE=utf8mb4_general_ci;
+
 -- --------------------------------------------------------
 -- INSERT DUMMY DATA
 -- --------------------------------------------------------
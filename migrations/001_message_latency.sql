@@ -0,0 +1,15 @@
+-- --------------------------------------------------------
+-- Migration 001: per-stage SOS latency on messages
+-- Adds the latency budget columns to an existing `messages` table.
+-- Fresh installs get them from lifeline_updated.sql.
+-- Run it before deploying API/Create/message.php, which writes these
+-- columns and answers 500 until they exist.
+-- --------------------------------------------------------
+
+ALTER TABLE `messages`
+  ADD COLUMN `tx_ui_ms` int(10) DEFAULT NULL COMMENT 'TX: confirm key press to radio start (ms)',
+  ADD COLUMN `air_ms` int(10) DEFAULT NULL COMMENT 'LoRa time on air computed by the gateway (ms)',
+  ADD COLUMN `gw_ms` int(10) DEFAULT NULL COMMENT 'Gateway: RxDone to uplink request (ms)',
+  ADD COLUMN `uplink_ms` int(10) DEFAULT NULL COMMENT 'Gateway: uplink request to API response (ms), reported by the next uplink',
+  ADD COLUMN `ingested_at` datetime(3) DEFAULT CURRENT_TIMESTAMP(3) COMMENT 'Server clock when the row was written',
+  ADD KEY `idx_ingested_at` (`ingested_at`);
@@ -0,0 +1,17 @@
+-- --------------------------------------------------------
+-- Migration 002: per-device link quality as the gateway hears it
+-- Adds the `device_links` table. Fresh installs get it from
+-- lifeline_updated.sql.
+-- --------------------------------------------------------
+
+CREATE TABLE IF NOT EXISTS `device_links` (
+  `DID` int(10) NOT NULL COMMENT 'Device the gateway heard',
+  `rssi_avg` decimal(5,1) DEFAULT NULL COMMENT 'Gateway EWMA of RSSI (dBm)',
+  `snr_avg` decimal(4,1) DEFAULT NULL COMMENT 'Gateway EWMA of SNR (dB)',
+  `packets` int(10) UNSIGNED NOT NULL DEFAULT 0 COMMENT 'Frames heard since the gateway booted',
+  `alerts` int(10) UNSIGNED NOT NULL DEFAULT 0 COMMENT 'Distinct alerts (s= values) heard',
+  `lost` int(10) UNSIGNED NOT NULL DEFAULT 0 COMMENT 'Alerts missing from the s= sequence',
+  `updated_at` datetime DEFAULT CURRENT_TIMESTAMP ON UPDATE CURRENT_TIMESTAMP,
+  PRIMARY KEY (`DID`),
+  CONSTRAINT `fk_link_device` FOREIGN KEY (`DID`) REFERENCES `devices` (`DID`) ON DELETE CASCADE
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COLLATE=utf8mb4_general_ci;
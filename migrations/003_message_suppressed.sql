@@ -0,0 +1,10 @@
+-- --------------------------------------------------------
+-- Migration 003: rate-limited alert counts on messages
+-- Adds the count of alerts the gateway's per-device rate limit kept out
+-- since the device's previous uplink. Fresh installs get it from
+-- lifeline_updated.sql. Run it before deploying API/Create/message.php,
+-- which writes this column and answers 500 until it exists.
+-- --------------------------------------------------------
+
+ALTER TABLE `messages`
+  ADD COLUMN `suppressed` int(10) NOT NULL DEFAULT 0 COMMENT 'Alerts from this device rate-limited by the gateway since its previous uplink';